@@ -18,7 +18,7 @@ const char *byteCodeInstructionAluCmpBitStrings[BytecodeInstructionAluCmpBitNB]=
 BytecodeInstructionLength bytecodeInstructionParseLength(BytecodeInstruction3Byte instruction) {
 	if (instruction[0]<0xD0)
 		return BytecodeInstructionLength1Byte;
-	else if ((instruction[0]>>3)!=0x1B)
+	else if ((instruction[0]>>3)!=0x1B && (instruction[0]>>1)!=(0x70|BytecodeInstructionAluTypeMemory)) // set16 and alu memory instructions are the only 3 byte ones
 		return BytecodeInstructionLength2Byte;
 	else
 		return BytecodeInstructionLength3Byte;
@@ -47,6 +47,10 @@ void bytecodeInstructionParse(BytecodeInstructionInfo *info, BytecodeInstruction
 		info->d.alu.opAReg=((upper16>>3)&0x7);
 		info->d.alu.opBReg=(upper16&0x7);
 		info->d.alu.incDecValue=(upper16&63)+1;
+		if (info->d.alu.type==BytecodeInstructionAluTypeMemory) {
+			info->d.alu.displacement=(int8_t)instruction[2];
+			info->d.alu.lenReg=(instruction[2]&0x7);
+		}
 	} else {
 		// Otherwise this is a misc instruction.
 		info->type=BytecodeInstructionTypeMisc;
@@ -99,6 +103,25 @@ BytecodeInstruction2Byte bytecodeInstructionCreateAluIncDecValue(BytecodeInstruc
 	return bytecodeInstructionCreateAlu(type, destReg, opAReg, opBReg);
 }
 
+void bytecodeInstructionCreateAluMemoryDisp(BytecodeInstruction3Byte instruction, BytecodeInstructionAluMemoryType type, BytecodeRegister destReg, BytecodeRegister opAReg, int8_t displacement) {
+	assert(type==BytecodeInstructionAluMemoryTypeLoad8Disp || type==BytecodeInstructionAluMemoryTypeStore8Disp || type==BytecodeInstructionAluMemoryTypeLoad16Disp || type==BytecodeInstructionAluMemoryTypeStore16Disp);
+
+	BytecodeInstruction2Byte op=bytecodeInstructionCreateAlu(BytecodeInstructionAluTypeMemory, destReg, opAReg, (BytecodeRegister)type);
+	instruction[0]=(op>>8);
+	instruction[1]=(op&0xFF);
+	instruction[2]=(uint8_t)displacement;
+}
+
+void bytecodeInstructionCreateAluMemoryBlock(BytecodeInstruction3Byte instruction, BytecodeInstructionAluMemoryType type, BytecodeRegister destReg, BytecodeRegister opAReg, BytecodeRegister lenReg) {
+	assert(type==BytecodeInstructionAluMemoryTypeCopyBlock || type==BytecodeInstructionAluMemoryTypeFillBlock);
+	assert(lenReg<BytecodeRegisterNB);
+
+	BytecodeInstruction2Byte op=bytecodeInstructionCreateAlu(BytecodeInstructionAluTypeMemory, destReg, opAReg, (BytecodeRegister)type);
+	instruction[0]=(op>>8);
+	instruction[1]=(op&0xFF);
+	instruction[2]=lenReg;
+}
+
 BytecodeInstruction1Byte bytecodeInstructionCreateMiscNop(void) {
 	return 0xC0;
 }
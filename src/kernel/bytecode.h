@@ -61,6 +61,9 @@ typedef enum {
 	BytecodeSyscallIdSignal=M(0,12),
 	BytecodeSyscallIdGetPidFdN=M(0,13),
 	BytecodeSyscallIdExec2=M(0,14),
+	BytecodeSyscallIdClone=M(0,15),
+	BytecodeSyscallIdFutexWait=M(0,16),
+	BytecodeSyscallIdFutexWake=M(0,17),
 	BytecodeSyscallIdRead=M(1,0),
 	BytecodeSyscallIdWrite=M(1,1),
 	BytecodeSyscallIdOpen=M(1,2),
@@ -81,6 +84,8 @@ typedef enum {
 	BytecodeSyscallIdFlush=M(1,17),
 	BytecodeSyscallIdTryWriteByte=M(1,18),
 	BytecodeSyscallIdGetPathGlobal=M(1,19),
+	BytecodeSyscallIdDirGetChildNext=M(1,20),
+	BytecodeSyscallIdDirGetChildren=M(1,21),
 	BytecodeSyscallIdEnvGetPwd=M(2,2),
 	BytecodeSyscallIdEnvSetPwd=M(2,3),
 	BytecodeSyscallIdEnvGetPath=M(2,4),
@@ -91,6 +96,7 @@ typedef enum {
 	BytecodeSyscallIdTimeMonotonic32ms=M(3,3),
 	BytecodeSyscallIdTimeReal32s=M(3,4),
 	BytecodeSyscallIdTimeToDate32s=M(3,5),
+	BytecodeSyscallIdSleepMs=M(3,6),
 	BytecodeSyscallIdRegisterSignalHandler=M(4,0),
 	BytecodeSyscallIdShutdown=M(5,0),
 	BytecodeSyscallIdMount=M(5,1),
@@ -118,6 +124,8 @@ typedef enum {
 	BytecodeSyscallIdHwDeviceDht22GetHumidity=M(7,6),
 	BytecodeSyscallIdHwDeviceKeypadMount=M(7,7),
 	BytecodeSyscallIdHwDeviceKeypadUnmount=M(7,8),
+	BytecodeSyscallIdHwDeviceDht22Mount=M(7,9),
+	BytecodeSyscallIdHwDeviceDht22Unmount=M(7,10),
 	ByteCodeSyscallIdInt32Add16=M(8,0),
 	ByteCodeSyscallIdInt32Add32=M(8,1),
 	ByteCodeSyscallIdInt32Sub16=M(8,2),
@@ -198,6 +206,29 @@ typedef enum {
 	BytecodeInstructionAluExtraTypeClz,
 } BytecodeInstructionAluExtraType;
 
+// 32 bit values are stored big-endian in memory, with destReg and opAReg holding their addresses (the 16 variants instead take opAReg's value directly).
+typedef enum {
+	BytecodeInstructionAluInt32TypeAdd16, // [destReg]+=opAReg
+	BytecodeInstructionAluInt32TypeAdd32, // [destReg]+=[opAReg]
+	BytecodeInstructionAluInt32TypeSub16, // [destReg]-=opAReg
+	BytecodeInstructionAluInt32TypeSub32, // [destReg]-=[opAReg]
+	BytecodeInstructionAluInt32TypeMul16, // [destReg]*=opAReg
+	BytecodeInstructionAluInt32TypeMul32, // [destReg]*=[opAReg]
+	BytecodeInstructionAluInt32TypeShift, // [destReg]<<=opAReg if opAReg is non-negative (as a signed 16 bit value), otherwise [destReg]>>=-opAReg
+	BytecodeInstructionAluInt32TypeCmp, // destReg=cmp([destReg], [opAReg]), with the same bits as the 16 bit cmp instruction
+} BytecodeInstructionAluInt32Type;
+
+// These are 3 bytes long, with the third byte holding either a signed displacement or (for the block instructions) a length register.
+// The block instructions only process a bounded chunk each time they are executed, updating the registers to reflect this and then repeating until the length register is 0.
+typedef enum {
+	BytecodeInstructionAluMemoryTypeLoad8Disp, // destReg=[opAReg+displacement] (8 bit)
+	BytecodeInstructionAluMemoryTypeStore8Disp, // [destReg+displacement]=opAReg (8 bit)
+	BytecodeInstructionAluMemoryTypeLoad16Disp, // destReg=[opAReg+displacement] (16 bit)
+	BytecodeInstructionAluMemoryTypeStore16Disp, // [destReg+displacement]=opAReg (16 bit)
+	BytecodeInstructionAluMemoryTypeCopyBlock, // copy lenReg bytes from [opAReg] to [destReg] (regions may only overlap if destReg<=opAReg)
+	BytecodeInstructionAluMemoryTypeFillBlock, // set lenReg bytes from [destReg] to the lower byte of opAReg
+} BytecodeInstructionAluMemoryType;
+
 typedef enum {
 	BytecodeInstructionAluTypeInc,
 	BytecodeInstructionAluTypeDec,
@@ -213,12 +244,16 @@ typedef enum {
 	BytecodeInstructionAluTypeShiftRight,
 	BytecodeInstructionAluTypeSkip,
 	BytecodeInstructionAluTypeExtra,
+	BytecodeInstructionAluTypeInt32, // opBReg holds BytecodeInstructionAluInt32Type
+	BytecodeInstructionAluTypeMemory, // opBReg holds BytecodeInstructionAluMemoryType
 } BytecodeInstructionAluType;
 
 typedef struct {
 	BytecodeInstructionAluType type;
 	BytecodeRegister destReg, opAReg, opBReg;
 	uint8_t incDecValue; // post adjustment (i.e. true value)
+	int8_t displacement; // for memory type load/store instructions
+	BytecodeRegister lenReg; // for memory type block instructions
 } BytecodeInstructionAluInfo;
 
 typedef enum {
@@ -270,6 +305,8 @@ BytecodeInstruction1Byte bytecodeInstructionCreateMemory(BytecodeInstructionMemo
 BytecodeInstruction1Byte bytecodeInstructionCreateMemorySet4(BytecodeRegister destReg, uint8_t value); // destReg<4, value<16
 BytecodeInstruction2Byte bytecodeInstructionCreateAlu(BytecodeInstructionAluType type, BytecodeRegister destReg, BytecodeRegister opAReg, BytecodeRegister opBReg);
 BytecodeInstruction2Byte bytecodeInstructionCreateAluIncDecValue(BytecodeInstructionAluType type, BytecodeRegister destReg, uint8_t incDecValue);
+void bytecodeInstructionCreateAluMemoryDisp(BytecodeInstruction3Byte instruction, BytecodeInstructionAluMemoryType type, BytecodeRegister destReg, BytecodeRegister opAReg, int8_t displacement);
+void bytecodeInstructionCreateAluMemoryBlock(BytecodeInstruction3Byte instruction, BytecodeInstructionAluMemoryType type, BytecodeRegister destReg, BytecodeRegister opAReg, BytecodeRegister lenReg);
 BytecodeInstruction1Byte bytecodeInstructionCreateMiscNop(void);
 BytecodeInstruction1Byte bytecodeInstructionCreateMiscSyscall(void);
 BytecodeInstruction1Byte bytecodeInstructionCreateMiscClearInstructionCache(void);
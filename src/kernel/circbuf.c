@@ -18,6 +18,13 @@ bool circBufIsEmpty(volatile CircBuf *cb) {
 	return cb->head==cb->tail;
 }
 
+uint8_t circBufGetFreeSpace(volatile CircBuf *cb) {
+	assert(cb!=NULL);
+
+	uint8_t used=(cb->tail>=cb->head ? cb->tail-cb->head : cb->size-cb->head+cb->tail);
+	return cb->size-1-used; // one slot is always left empty to distinguish full from empty
+}
+
 bool circBufPush(volatile CircBuf *cb, uint8_t value) {
 	assert(cb!=NULL);
 
@@ -13,6 +13,7 @@ typedef struct {
 void circBufInit(volatile CircBuf *cb, volatile uint8_t *buffer, uint8_t size);
 
 bool circBufIsEmpty(volatile CircBuf *cb);
+uint8_t circBufGetFreeSpace(volatile CircBuf *cb); // number of values which can be pushed before the buffer is full
 
 bool circBufPush(volatile CircBuf *cb, uint8_t value);
 bool circBufPop(volatile CircBuf *cb, uint8_t *value);
@@ -308,6 +308,13 @@ bool fatDirIsEmpty(const Fat *fs, KStr path) {
 bool fatDirGetChildN(const Fat *fs, KStr path, unsigned childNum, char childPath[FATPATHMAX]) {
 	assert(childNum<FATMAXFILES);
 
+	uint16_t cursor=0;
+	return fatDirGetChildFromCursor(fs, path, &cursor, childNum, childPath);
+}
+
+bool fatDirGetChildFromCursor(const Fat *fs, KStr path, uint16_t *cursor, unsigned skip, char childPath[FATPATHMAX]) {
+	assert(cursor!=NULL);
+
 	// Find start of directory containing this path
 	uint32_t baseOffset;
 	if (kstrStrlen(path)==0) {
@@ -333,10 +340,11 @@ bool fatDirGetChildN(const Fat *fs, KStr path, unsigned childNum, char childPath
 		baseOffset=fatGetOffsetForCluster(fs, firstCluster);
 	}
 
-	// Loop over directory entries
+	// Loop over directory entries, starting from the one indicated by the cursor
 	// TODO: allow sub-directories rather than assuming root dir
-	unsigned childI=0;
-	for(uint32_t offset=baseOffset; 1; offset+=32) {
+	for(uint16_t entryIndex=*cursor; 1; ++entryIndex) {
+		uint32_t offset=baseOffset+((uint32_t)entryIndex)*32;
+
 		// Read filename
 		switch(fatReadDirEntryName(fs, offset, childPath)) {
 			case FatReadDirEntryNameResultError:
@@ -351,6 +359,7 @@ bool fatDirGetChildN(const Fat *fs, KStr path, unsigned childNum, char childPath
 			break;
 			case FatReadDirEntryNameResultEnd:
 				// Done
+				*cursor=entryIndex;
 				return false;
 			break;
 		}
@@ -364,9 +373,11 @@ bool fatDirGetChildN(const Fat *fs, KStr path, unsigned childNum, char childPath
 			continue;
 
 		// Nth child?
-		if (childI==childNum)
+		if (skip==0) {
+			*cursor=entryIndex+1;
 			return true;
-		++childI;
+		}
+		--skip;
 	}
 
 	return false;
@@ -48,6 +48,7 @@ void fatDebug(const Fat *fs);
 bool fatIsDir(const Fat *fs, const char *path);
 bool fatDirIsEmpty(const Fat *fs, KStr path);
 bool fatDirGetChildN(const Fat *fs, KStr path, unsigned childNum, char childPath[FATPATHMAX]); // n<FATMAXFILES, no gaps
+bool fatDirGetChildFromCursor(const Fat *fs, KStr path, uint16_t *cursor, unsigned skip, char childPath[FATPATHMAX]); // cursor is a directory entry index, initially 0 - skips 'skip' children and then returns the next, leaving cursor just past it
 
 bool fatFileExists(const Fat *fs, KStr path);
 
@@ -23,18 +23,60 @@ const char hwDeviceKeypadMapping[16] PROGMEM ={ // this should be accessed as hw
 	'A', '0', 'B', 'C',
 };
 
+// The keypad is only scanned once a row pin changes level. Between scans all column pins are held low, so any key press pulls its row pin low.
+// Where all of the row pins support pin change interrupts these detect the change, otherwise the row pins are read each tick (which is still far cheaper than a full scan).
+// Scans are delayed until the contacts have had time to settle, and repeated while keys are held (as a second key in the same row would not change the row pin's level).
+#define HwDeviceKeypadDebounceMs 20
+#define HwDeviceKeypadHeldScanIntervalMs 100
+
+typedef enum {
+	HwDeviceKeypadStateIdle, // waiting for a row pin to change
+	HwDeviceKeypadStateDebounce, // row pin changed, waiting for contacts to settle before scanning
+	HwDeviceKeypadStateHeld, // at least one key was pressed at the last scan
+} HwDeviceKeypadState;
+
 typedef struct {
 	KStr mountPoint;
 	uint16_t states; // a bitset of the 16 keys where 1s represent pressed buttons
 	volatile CircBuf circBuf;
 	#define HwDeviceKeypadCircBufSize 8
 	volatile uint8_t circBufBuffer[HwDeviceKeypadCircBufSize];
+	KTime stateTime; // when state was last changed
+	uint8_t state; // see HwDeviceKeypadState
+	uint8_t usePinChange:1; // true if all row pins support pin change interrupts
+	uint8_t rowLevels:4; // levels of row pins when last checked (only used if not using pin change interrupts)
+	uint8_t rowChangeCounts[4]; // pin change counts for row pins when last checked (only used if using pin change interrupts)
 } HwDeviceKeypadData;
 
+// The DHT22 is sampled by a state machine run from hwDeviceTick, so that the long start signal does not busy-wait.
+// Only the ~5ms burst in which the sensor sends its 40 data bits is read in one go.
+#define HwDeviceDht22IntervalMinMs 2000 // sensor should not be read more often than this
+#define HwDeviceDht22StartSignalMs 2 // data pin is held low for at least this long (datasheet requires at least 1ms, and we only have ms resolution)
+#define HwDeviceDht22StartSignalMaxMs 18 // if the start signal ends up being held longer than this (due to slow ticks) the sensor may not respond, so the sample is abandoned
+#define HwDeviceDht22RetryDelayMs 100 // delay before retrying after abandoning a sample
+#define HwDeviceDht22SampleSize 8
+#ifdef ARDUINO
+#define HwDeviceDht22SampleBufferCount 4
+#else
+#define HwDeviceDht22SampleBufferCount 16
+#endif
+STATICASSERT(HwDeviceDht22SampleBufferCount*HwDeviceDht22SampleSize<255); // one slot of circular buffer is always unused
+
+typedef enum {
+	HwDeviceDht22StateIdle, // waiting until next sample is due
+	HwDeviceDht22StateStartSignal, // holding data pin low to request a sample
+} HwDeviceDht22State;
+
 typedef struct {
 	KTime lastReadTime;
+	KTime stateTime; // when the last sample was requested (or device registered)
+	uint32_t sampleIntervalMs;
 	int16_t temperature;
 	int16_t humitity;
+	uint8_t state; // see HwDeviceDht22State
+	KStr mountPoint; // null if not mounted
+	volatile CircBuf circBuf; // buffers samples while mounted
+	uint8_t *circBufBuffer; // malloc'd when mounted
 } HwDeviceDht22Data;
 
 typedef struct {
@@ -43,7 +85,8 @@ typedef struct {
 	uint8_t *cache; // malloc'd, SdBlockSize in size
 	uint32_t cacheIsValid:1; // if false, cacheBlock field is undefined as is the data in the cache array
 	uint32_t cacheIsDirty:1; // if cache is valid, then this represents whether the cache array has been modified since reading
-	uint32_t cacheBlock:30; // Note: using only 30 bits is safe as some bits of addresses are 'used up' by the fixed size 512 byte blocks, so not all 32 bits are needed (only 32-9=23 strictly needed)
+	uint32_t cacheIsPending:1; // if true, cacheBlock is being read into the cache array in the background (cacheIsValid is false until complete)
+	uint32_t cacheBlock:29; // Note: using only 29 bits is safe as some bits of addresses are 'used up' by the fixed size 512 byte blocks, so not all 32 bits are needed (only 32-9=23 strictly needed)
 } HwDeviceSdCardReaderData;
 
 STATICASSERT(HwDeviceTypeBits<=8);
@@ -64,7 +107,9 @@ HwDevice hwDevices[HwDeviceIdMax];
 ////////////////////////////////////////////////////////////////////////////////
 
 uint32_t hwDeviceKeypadFsFunctor(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr);
-void hwDeviceKeypadRead(HwDeviceId id);
+void hwDeviceKeypadTick(HwDeviceId id);
+bool hwDeviceKeypadRowsChanged(HwDeviceId id); // returns true if any row pin has (or may have) changed level since the last call
+void hwDeviceKeypadRead(HwDeviceId id); // scans all keys, pushing characters for any newly pressed, and leaves column pins low
 bool hwDeviceKeypadIsPressed(HwDeviceId id, unsigned col, unsigned row); // unlike other similar functions, this does not verify id, col or row are sensible
 void hwDeviceKeypadSetPressed(HwDeviceId id, unsigned col, unsigned row, bool pressed);
 
@@ -72,8 +117,13 @@ uint32_t hwDeviceSdCardReaderFsFunctor(KernelFsDeviceFunctorType type, void *use
 bool hwDeviceSdCardReaderFlushFunctor(void *userData);
 KernelFsFileOffset hwDeviceSdCardReaderReadFunctor(KernelFsFileOffset addr, uint8_t *data, KernelFsFileOffset len, void *userData);
 KernelFsFileOffset hwDeviceSdCardReaderWriteFunctor(KernelFsFileOffset addr, const uint8_t *data, KernelFsFileOffset len, void *userData);
+bool hwDeviceSdCardReaderCanReadFunctor(KernelFsFileOffset addr, void *userData); // if the block containing addr is not cached, starts reading it in the background and returns false
+void hwDeviceSdCardReaderCompletePending(HwDeviceId id); // waits for any background read to complete, leaving the block in the cache
 
-bool hwDeviceDht22Read(HwDeviceId id);
+uint32_t hwDeviceDht22FsFunctor(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr);
+void hwDeviceDht22Tick(HwDeviceId id);
+bool hwDeviceDht22Read(HwDeviceId id); // start signal should already have been sent (see hwDeviceDht22Tick)
+void hwDeviceDht22PushSample(HwDeviceId id); // adds latest values to buffer if mounted (dropping them if full)
 
 ////////////////////////////////////////////////////////////////////////////////
 // Public functions
@@ -98,20 +148,19 @@ void hwDeviceTick(void) {
 		HwDevice *device=&hwDevices[i];
 		switch(device->type) {
 			case HwDeviceTypeUnused:
-			case HwDeviceTypeSdCardReader:
 				// Nothing to do
 			break;
+			case HwDeviceTypeSdCardReader:
+				// Background read complete? If so finish it to release the SPI bus
+				if (device->d.sdCardReader.cacheIsPending && sdReadBlockIsComplete(&device->d.sdCardReader.sdCard))
+					hwDeviceSdCardReaderCompletePending(i);
+			break;
 			case HwDeviceTypeKeypad:
-				hwDeviceKeypadRead(i);
+				hwDeviceKeypadTick(i);
+			break;
+			case HwDeviceTypeDht22:
+				hwDeviceDht22Tick(i);
 			break;
-			case HwDeviceTypeDht22: {
-				// Not yet time to read values again?
-				if (ktimeGetMonotonicMs()-device->d.dht22.lastReadTime<2000) // wait at least 2s between reads
-					break;
-
-				// Update values
-				hwDeviceDht22Read(i);
-			} break;
 		}
 	}
 }
@@ -171,9 +220,17 @@ bool hwDeviceRegister(HwDeviceId id, HwDeviceType type, const uint8_t *pins) {
 				pinWrite(rowPin, true);
 			}
 
-			// Set column pins to high (already set to output above in common code)
+			// Column pins are left as output low (set above in common code) so that any key press pulls its row pin low.
+			// Use pin change interrupts to detect this if all row pins support them.
+			hwDevices[id].d.keypad.usePinChange=true;
 			for(unsigned i=0; i<4; ++i)
-				pinWrite(hwDeviceKeypadGetColumnPin(id, i), true);
+				hwDevices[id].d.keypad.usePinChange&=pinChangeIsSupported(hwDeviceKeypadGetRowPin(id, i));
+			if (hwDevices[id].d.keypad.usePinChange)
+				for(unsigned i=0; i<4; ++i)
+					pinChangeSetEnabled(hwDeviceKeypadGetRowPin(id, i), true);
+			hwDevices[id].d.keypad.state=HwDeviceKeypadStateIdle;
+			hwDevices[id].d.keypad.stateTime=ktimeGetMonotonicMs();
+			hwDeviceKeypadRowsChanged(id); // record initial row pin levels/counts
 		break;
 		case HwDeviceTypeSdCardReader:
 			hwDevices[id].d.sdCardReader.cache=malloc(SdBlockSize);
@@ -193,6 +250,15 @@ bool hwDeviceRegister(HwDeviceId id, HwDeviceType type, const uint8_t *pins) {
 			hwDevices[id].d.dht22.temperature=0;
 			hwDevices[id].d.dht22.humitity=0;
 			hwDevices[id].d.dht22.lastReadTime=0;
+
+			// First sample is due once the sensor has had time to power on
+			hwDevices[id].d.dht22.state=HwDeviceDht22StateIdle;
+			hwDevices[id].d.dht22.stateTime=ktimeGetMonotonicMs();
+			hwDevices[id].d.dht22.sampleIntervalMs=HwDeviceDht22IntervalMinMs;
+
+			// Set mountPoint to null string to indicate not mounted
+			hwDevices[id].d.dht22.mountPoint=kstrNull();
+			hwDevices[id].d.dht22.circBufBuffer=NULL;
 		break;
 	}
 
@@ -241,6 +307,11 @@ void hwDeviceDeregister(HwDeviceId id) {
 		case HwDeviceTypeKeypad:
 			// May have to unmount
 			hwDeviceKeypadUnmount(id);
+
+			// Disable any pin change interrupts
+			if (hwDevices[id].d.keypad.usePinChange)
+				for(unsigned i=0; i<4; ++i)
+					pinChangeSetEnabled(hwDeviceKeypadGetRowPin(id, i), false);
 		break;
 		case HwDeviceTypeSdCardReader:
 			// We may have to unmount an SD card
@@ -250,7 +321,8 @@ void hwDeviceDeregister(HwDeviceId id) {
 			free(hwDevices[id].d.sdCardReader.cache);
 		break;
 		case HwDeviceTypeDht22:
-			// Nothing to do (power pin is turned off below which disables the device)
+			// May have to unmount (power pin is turned off below which disables the device)
+			hwDeviceDht22Unmount(id);
 		break;
 	}
 
@@ -406,6 +478,7 @@ bool hwDeviceSdCardReaderMount(HwDeviceId id, const char *mountPoint) {
 
 	// Mark cache block as undefined (before we even register read/write functors to be safe).
 	hwDevices[id].d.sdCardReader.cacheIsValid=false;
+	hwDevices[id].d.sdCardReader.cacheIsPending=false;
 
 	// Add block device at given point mount
 	uint32_t maxBlockCount=(((uint32_t)1u)<<(32-SdBlockSizeBits)); // we are limited by 32 bit addresses, regardless of how large blocks are
@@ -449,7 +522,8 @@ void hwDeviceSdCardReaderUnmount(HwDeviceId id) {
 	char mountPoint[KernelFsPathMax];
 	kstrStrcpy(mountPoint, hwDevices[id].d.sdCardReader.mountPoint);
 
-	// Write out cached block if valid but dirty
+	// Wait for any background read, then write out cached block if valid but dirty
+	hwDeviceSdCardReaderCompletePending(id);
 	if (hwDevices[id].d.sdCardReader.cacheIsValid && hwDevices[id].d.sdCardReader.cacheIsDirty && !sdWriteBlock(&hwDevices[id].d.sdCardReader.sdCard, hwDevices[id].d.sdCardReader.cacheBlock, hwDevices[id].d.sdCardReader.cache))
 		kernelLog(LogTypeWarning, kstrP("HW device SD card reader unmount: failed to write back dirty block %"PRIu32" (id=%u, mountPoint='%s')\n"), hwDevices[id].d.sdCardReader.cacheBlock, id, mountPoint);
 
@@ -492,6 +566,82 @@ uint32_t hwDeviceDht22GetLastReadTime(HwDeviceId id) {
 	return hwDevices[id].d.dht22.lastReadTime;
 }
 
+bool hwDeviceDht22Mount(HwDeviceId id, const char *mountPoint, uint16_t intervalS) {
+	// Bad id?
+	if (id>=HwDeviceIdMax) {
+		kernelLog(LogTypeInfo, kstrP("HW device DHT22 mount failed: bad id (id=%u, mountPoint='%s')\n"), id, mountPoint);
+		return false;
+	}
+
+	// Device slot not used for a DHT22 sensor?
+	if (hwDeviceGetType(id)!=HwDeviceTypeDht22) {
+		kernelLog(LogTypeInfo, kstrP("HW device DHT22 mount failed: bad device type (id=%u, mountPoint='%s')\n"), id, mountPoint);
+		return false;
+	}
+
+	// Already mounted?
+	if (!kstrIsNull(hwDevices[id].d.dht22.mountPoint)) {
+		kernelLog(LogTypeInfo, kstrP("HW device DHT22 mount failed: already mounted (id=%u, mountPoint='%s')\n"), id, mountPoint);
+		return false;
+	}
+
+	// Allocate sample buffer
+	uint8_t circBufSize=HwDeviceDht22SampleBufferCount*HwDeviceDht22SampleSize+1;
+	hwDevices[id].d.dht22.circBufBuffer=malloc(circBufSize);
+	if (hwDevices[id].d.dht22.circBufBuffer==NULL) {
+		kernelLog(LogTypeInfo, kstrP("HW device DHT22 mount failed: could not allocate sample buffer of size %u (id=%u, mountPoint='%s')\n"), circBufSize, id, mountPoint);
+		return false;
+	}
+	circBufInit(&hwDevices[id].d.dht22.circBuf, hwDevices[id].d.dht22.circBufBuffer, circBufSize);
+
+	// Add character device at given point mount
+	if (!kernelFsAddCharacterDeviceFile(kstrC(mountPoint), &hwDeviceDht22FsFunctor, (void *)(uintptr_t)id, false, false)) {
+		kernelLog(LogTypeInfo, kstrP("HW device DHT22 mount failed: could not add character device to VFS (id=%u, mountPoint='%s')\n"), id, mountPoint);
+		free(hwDevices[id].d.dht22.circBufBuffer);
+		hwDevices[id].d.dht22.circBufBuffer=NULL;
+		return false;
+	}
+
+	// Copy mount point and set sampling interval
+	hwDevices[id].d.dht22.mountPoint=kstrC(mountPoint);
+	hwDevices[id].d.dht22.sampleIntervalMs=MAX(((uint32_t)intervalS)*1000, HwDeviceDht22IntervalMinMs);
+
+	// Write to log
+	kernelLog(LogTypeInfo, kstrP("HW device DHT22 mount success (id=%u, mountPoint='%s', interval=%"PRIu32"ms)\n"), id, mountPoint, hwDevices[id].d.dht22.sampleIntervalMs);
+
+	return true;
+}
+
+void hwDeviceDht22Unmount(HwDeviceId id) {
+	// Bad id?
+	if (id>=HwDeviceIdMax)
+		return;
+
+	// Device slot not used for a DHT22 sensor?
+	if (hwDeviceGetType(id)!=HwDeviceTypeDht22)
+		return;
+
+	// Not mounted?
+	if (kstrIsNull(hwDevices[id].d.dht22.mountPoint))
+		return;
+
+	// Grab local copy of mount point
+	char mountPoint[KernelFsPathMax];
+	kstrStrcpy(mountPoint, hwDevices[id].d.dht22.mountPoint);
+
+	// Write to log
+	kernelLog(LogTypeInfo, kstrP("HW device DHT22 unmount (id=%u, mountPoint='%s')\n"), id, mountPoint);
+
+	// Remove virtual device file representing the sensor
+	kernelFsFileDelete(mountPoint);
+
+	// Free memory and return to default sampling interval
+	kstrFree(&hwDevices[id].d.dht22.mountPoint);
+	free(hwDevices[id].d.dht22.circBufBuffer);
+	hwDevices[id].d.dht22.circBufBuffer=NULL;
+	hwDevices[id].d.dht22.sampleIntervalMs=HwDeviceDht22IntervalMinMs;
+}
+
 unsigned hwDeviceTypeGetPinCount(HwDeviceType type) {
 	switch(type) {
 		case HwDeviceTypeUnused:
@@ -555,17 +705,83 @@ uint32_t hwDeviceKeypadFsFunctor(KernelFsDeviceFunctorType type, void *userData,
 		break;
 		case KernelFsDeviceFunctorTypeBlockWrite:
 		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+		break;
 	}
 
 	assert(false);
 	return 0;
 }
 
+void hwDeviceKeypadTick(HwDeviceId id) {
+	HwDeviceKeypadData *keypad=&hwDevices[id].d.keypad;
+
+	KTime now=ktimeGetMonotonicMs();
+	switch(keypad->state) {
+		case HwDeviceKeypadStateIdle:
+			// Nothing pressed or released?
+			if (!hwDeviceKeypadRowsChanged(id))
+				break;
+
+			// Wait for contacts to settle before scanning
+			keypad->state=HwDeviceKeypadStateDebounce;
+			keypad->stateTime=now;
+		break;
+		case HwDeviceKeypadStateDebounce:
+		case HwDeviceKeypadStateHeld:
+			// Further changes restart the wait for contacts to settle
+			if (hwDeviceKeypadRowsChanged(id)) {
+				keypad->state=HwDeviceKeypadStateDebounce;
+				keypad->stateTime=now;
+			}
+
+			// Not yet time to scan?
+			if (now-keypad->stateTime<(keypad->state==HwDeviceKeypadStateDebounce ? HwDeviceKeypadDebounceMs : HwDeviceKeypadHeldScanIntervalMs))
+				break;
+
+			// Scan keys, ignoring any row pin changes caused by the scan itself
+			hwDeviceKeypadRead(id);
+			hwDeviceKeypadRowsChanged(id);
+
+			// Keep scanning periodically while any keys are held, to catch changes which do not affect row pin levels
+			keypad->state=(keypad->states!=0 ? HwDeviceKeypadStateHeld : HwDeviceKeypadStateIdle);
+			keypad->stateTime=now;
+		break;
+	}
+}
+
+bool hwDeviceKeypadRowsChanged(HwDeviceId id) {
+	HwDeviceKeypadData *keypad=&hwDevices[id].d.keypad;
+
+	bool changed=false;
+	if (keypad->usePinChange) {
+		// Compare pin change counts (updated by interrupts)
+		for(unsigned row=0; row<4; ++row) {
+			uint8_t count=pinChangeGetCount(hwDeviceKeypadGetRowPin(id, row));
+			changed|=(count!=keypad->rowChangeCounts[row]);
+			keypad->rowChangeCounts[row]=count;
+		}
+	} else {
+		// Read row pins directly
+		uint8_t rowLevels=0;
+		for(unsigned row=0; row<4; ++row)
+			rowLevels|=(pinRead(hwDeviceKeypadGetRowPin(id, row))<<row);
+		changed=(rowLevels!=keypad->rowLevels);
+		keypad->rowLevels=rowLevels;
+	}
+
+	return changed;
+}
+
 void hwDeviceKeypadRead(HwDeviceId id) {
 	// Check device is actually registered as a keypad
 	if (id>=HwDeviceIdMax || hwDeviceGetType(id)!=HwDeviceTypeKeypad)
 		return;
 
+	// Set all column pins high so that only the column being tested below can pull row pins low
+	for(unsigned col=0; col<4; ++col)
+		pinWrite(hwDeviceKeypadGetColumnPin(id, col), true);
+
 	// Loop over columns to test each row within
 	for(unsigned col=0; col<4; ++col) {
 		uint8_t colPin=hwDeviceKeypadGetColumnPin(id, col);
@@ -599,6 +815,10 @@ void hwDeviceKeypadRead(HwDeviceId id) {
 		pinWrite(colPin, true);
 		ktimeDelayUs(3*1000);
 	}
+
+	// Return column pins to low, ready to detect the next key press
+	for(unsigned col=0; col<4; ++col)
+		pinWrite(hwDeviceKeypadGetColumnPin(id, col), false);
 }
 
 bool hwDeviceKeypadIsPressed(HwDeviceId id, unsigned col, unsigned row) {
@@ -641,6 +861,9 @@ uint32_t hwDeviceSdCardReaderFsFunctor(KernelFsDeviceFunctorType type, void *use
 		case KernelFsDeviceFunctorTypeBlockWrite:
 			return hwDeviceSdCardReaderWriteFunctor(addr, data, len, userData);
 		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+			return hwDeviceSdCardReaderCanReadFunctor(addr, userData);
+		break;
 	}
 
 	assert(false);
@@ -655,6 +878,7 @@ bool hwDeviceSdCardReaderFlushFunctor(void *userData) {
 		return false;
 
 	// Nothing to do? (invalid or clean cache)
+	hwDeviceSdCardReaderCompletePending(id);
 	if (!hwDevices[id].d.sdCardReader.cacheIsValid || !hwDevices[id].d.sdCardReader.cacheIsDirty)
 		return true;
 
@@ -674,6 +898,9 @@ KernelFsFileOffset hwDeviceSdCardReaderReadFunctor(KernelFsFileOffset addr, uint
 	if (id>=HwDeviceIdMax || hwDeviceGetType(id)!=HwDeviceTypeSdCardReader || hwDevices[id].d.sdCardReader.sdCard.type==SdTypeBadCard)
 		return 0;
 
+	// Wait for any background read (it may be for the block we want)
+	hwDeviceSdCardReaderCompletePending(id);
+
 	// Loop over addresses range reading bytes, reading new blocks as needed.
 	KernelFsFileOffset readCount;
 	for(readCount=0; readCount<len; ++readCount,++addr) {
@@ -722,6 +949,9 @@ KernelFsFileOffset hwDeviceSdCardReaderWriteFunctor(KernelFsFileOffset addr, con
 	if (id>=HwDeviceIdMax || hwDeviceGetType(id)!=HwDeviceTypeSdCardReader || hwDevices[id].d.sdCardReader.sdCard.type==SdTypeBadCard)
 		return 0;
 
+	// Wait for any background read (it may be for the block we want)
+	hwDeviceSdCardReaderCompletePending(id);
+
 	// Loop over address range writing bytes, reading and writing blocks as required.
 	KernelFsFileOffset writeCount=0;
 	while(writeCount<len) {
@@ -771,17 +1001,150 @@ KernelFsFileOffset hwDeviceSdCardReaderWriteFunctor(KernelFsFileOffset addr, con
 	return writeCount;
 }
 
+bool hwDeviceSdCardReaderCanReadFunctor(KernelFsFileOffset addr, void *userData) {
+	HwDeviceId id=(HwDeviceId)(uintptr_t)userData;
+
+	// Verify id is valid and that it represents an sd card reader device, with a mounted card.
+	// If not then a read fails immediately so there is no reason to wait.
+	if (id>=HwDeviceIdMax || hwDeviceGetType(id)!=HwDeviceTypeSdCardReader || hwDevices[id].d.sdCardReader.sdCard.type==SdTypeBadCard)
+		return true;
+
+	HwDeviceSdCardReaderData *reader=&hwDevices[id].d.sdCardReader;
+	uint32_t block=addr/SdBlockSize;
+
+	// Background read still in progress?
+	if (reader->cacheIsPending) {
+		if (!sdReadBlockIsComplete(&reader->sdCard))
+			return false;
+		hwDeviceSdCardReaderCompletePending(id);
+	}
+
+	// Already cached?
+	if (reader->cacheIsValid && reader->cacheBlock==block)
+		return true;
+
+	// Cached block needs writing back first? Leave this to the read itself (which blocks while writing).
+	if (reader->cacheIsValid && reader->cacheIsDirty)
+		return true;
+
+	// Start reading the block in the background.
+	// On failure (e.g. SPI bus in use) let the read itself retry and report any error.
+	reader->cacheIsValid=false;
+	if (!sdReadBlockStart(&reader->sdCard, block, reader->cache))
+		return true;
+	reader->cacheIsPending=true;
+	reader->cacheBlock=block;
+
+	return sdReadBlockIsComplete(&reader->sdCard);
+}
+
+void hwDeviceSdCardReaderCompletePending(HwDeviceId id) {
+	HwDeviceSdCardReaderData *reader=&hwDevices[id].d.sdCardReader;
+	if (!reader->cacheIsPending)
+		return;
+
+	sdReadBlockFinish(&reader->sdCard);
+	reader->cacheIsPending=false;
+	reader->cacheIsValid=true;
+	reader->cacheIsDirty=false;
+}
+
+uint32_t hwDeviceDht22FsFunctor(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr) {
+	HwDeviceId id=(HwDeviceId)(uintptr_t)userData;
+
+	// Functor-type specific logic
+	switch(type) {
+		case KernelFsDeviceFunctorTypeCommonFlush:
+			// Nothing to flush
+			return true;
+		break;
+		case KernelFsDeviceFunctorTypeCharacterRead: {
+			// Verify id is valid and that it represents a DHT22 device which is mounted.
+			if (id>=HwDeviceIdMax || hwDeviceGetType(id)!=HwDeviceTypeDht22 || kstrIsNull(hwDevices[id].d.dht22.mountPoint))
+				return -1;
+
+			// Attempt to pop byte from sample buffer
+			uint8_t value;
+			if (circBufPop(&hwDevices[id].d.dht22.circBuf, &value))
+				return value;
+
+			return -1;
+		} break;
+		case KernelFsDeviceFunctorTypeCharacterCanRead:
+			// Verify id is valid and that it represents a DHT22 device which is mounted.
+			if (id>=HwDeviceIdMax || hwDeviceGetType(id)!=HwDeviceTypeDht22 || kstrIsNull(hwDevices[id].d.dht22.mountPoint))
+				return false;
+
+			// Check if any samples waiting in buffer
+			return !circBufIsEmpty(&hwDevices[id].d.dht22.circBuf);
+		break;
+		case KernelFsDeviceFunctorTypeCharacterWrite:
+			// Not writable
+			return 0;
+		break;
+		case KernelFsDeviceFunctorTypeCharacterCanWrite:
+			// Not writable
+			return false;
+		break;
+		case KernelFsDeviceFunctorTypeBlockRead:
+		break;
+		case KernelFsDeviceFunctorTypeBlockWrite:
+		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+		break;
+	}
+
+	assert(false);
+	return 0;
+}
+
+void hwDeviceDht22Tick(HwDeviceId id) {
+	HwDeviceDht22Data *dht22=&hwDevices[id].d.dht22;
+	uint8_t pin=hwDeviceDht22GetDataPin(id);
+
+	KTime now=ktimeGetMonotonicMs();
+	switch(dht22->state) {
+		case HwDeviceDht22StateIdle:
+			// Not yet time to sample again?
+			if (now-dht22->stateTime<dht22->sampleIntervalMs)
+				break;
+
+			// Send start signal by pulling data pin low - this is held until a later tick rather than busy-waiting
+			pinWrite(pin, false);
+			pinSetMode(pin, PinModeOutput);
+			dht22->state=HwDeviceDht22StateStartSignal;
+			dht22->stateTime=now;
+		break;
+		case HwDeviceDht22StateStartSignal:
+			// Start signal not yet long enough?
+			if (now-dht22->stateTime<HwDeviceDht22StartSignalMs)
+				break;
+
+			// Start signal held too long? Release data pin and try again shortly
+			if (now-dht22->stateTime>HwDeviceDht22StartSignalMaxMs) {
+				kernelLog(LogTypeInfo, kstrP("HW device DHT22 start signal held too long (%ums), retrying (id=%u)\n"), (unsigned)(now-dht22->stateTime), id);
+				pinSetMode(pin, PinModeInput);
+				dht22->state=HwDeviceDht22StateIdle;
+				dht22->stateTime=now-(dht22->sampleIntervalMs-HwDeviceDht22RetryDelayMs);
+				break;
+			}
+
+			// Read response (stateTime is left as the time of the request so that samples are evenly spaced)
+			if (hwDeviceDht22Read(id))
+				hwDeviceDht22PushSample(id);
+			dht22->state=HwDeviceDht22StateIdle;
+		break;
+	}
+}
+
 bool hwDeviceDht22Read(HwDeviceId id) {
 	// Check device is actually registered as a DHT22 sensor
 	if (id>=HwDeviceIdMax || hwDeviceGetType(id)!=HwDeviceTypeDht22)
 		return false;
 
-	// Attempt to read data
+	// Attempt to read data - release data pin to end start signal
 	uint8_t pin=hwDeviceDht22GetDataPin(id);
 
-	pinWrite(pin, false);
-	pinSetMode(pin, PinModeOutput);
-	ktimeDelayUs(600);
 	pinSetMode(pin, PinModeInput);
 
 	ktimeDelayUs(70);
@@ -833,3 +1196,27 @@ bool hwDeviceDht22Read(HwDeviceId id) {
 
 	return true;
 }
+
+void hwDeviceDht22PushSample(HwDeviceId id) {
+	HwDeviceDht22Data *dht22=&hwDevices[id].d.dht22;
+
+	// Not mounted?
+	if (kstrIsNull(dht22->mountPoint))
+		return;
+
+	// Buffer full? Drop sample rather than corrupting one which may be partially read
+	if (circBufGetFreeSpace(&dht22->circBuf)<HwDeviceDht22SampleSize) {
+		kernelLog(LogTypeInfo, kstrP("HW device DHT22 sample buffer full, dropping sample (id=%u)\n"), id);
+		return;
+	}
+
+	// Push sample (big endian, to match values in process memory)
+	uint32_t time=ktimeGetRealMs()/1000;
+	uint8_t sample[HwDeviceDht22SampleSize]={
+		(time>>24)&0xFF, (time>>16)&0xFF, (time>>8)&0xFF, time&0xFF,
+		((uint16_t)dht22->temperature)>>8, ((uint16_t)dht22->temperature)&0xFF,
+		((uint16_t)dht22->humitity)>>8, ((uint16_t)dht22->humitity)&0xFF,
+	};
+	for(uint8_t i=0; i<HwDeviceDht22SampleSize; ++i)
+		circBufPush(&dht22->circBuf, sample[i]);
+}
@@ -41,6 +41,8 @@ uint8_t hwDeviceDht22GetDataPin(HwDeviceId id); // returns PinInvalid on failure
 int16_t hwDeviceDht22GetTemperature(HwDeviceId id);
 int16_t hwDeviceDht22GetHumidity(HwDeviceId id);
 uint32_t hwDeviceDht22GetLastReadTime(HwDeviceId id);
+bool hwDeviceDht22Mount(HwDeviceId id, const char *mountPoint, uint16_t intervalS); // samples the sensor every intervalS seconds (at least 2), buffering samples to be read from a character device at mountPoint. Each sample is 8 bytes: real time in seconds (4 bytes), temperature (2 bytes) and humidity (2 bytes), all big endian.
+void hwDeviceDht22Unmount(HwDeviceId id);
 
 unsigned hwDeviceTypeGetPinCount(HwDeviceType type); // number of pins that should be contained in the array passed to hwDeviceRegister
 
@@ -22,6 +22,7 @@
 #include "minifs.h"
 #include "pins.h"
 #include "procman.h"
+#include "snapshot.h"
 #include "spi.h"
 #include "tty.h"
 #include "util.h"
@@ -41,10 +42,67 @@ uint8_t kernelRamData[KernelRamSize];
 #define KernelEepromDevEepromOffset KernelEepromEtcSize
 #define KernelEepromDevEepromSize (KernelEepromTotalSize-KernelEepromDevEepromOffset)
 
+// EEPROM writes are slow (~3.3ms per byte on AVR) and wear the chip, so they are buffered in a few small lines.
+// This coalesces repeated writes to the same bytes (such as MiniFs updating a file's length several times),
+// and when a line is written back, bytes which already hold the buffered value are skipped.
+#define KernelEepromWriteBufferLineSize 16 // must be a power of two
+#ifdef ARDUINO
+#define KernelEepromWriteBufferLines 4
+#else
+#define KernelEepromWriteBufferLines 8
+#endif
+#define KernelEepromWriteBufferFlushDelayMs 500 // buffered data is written back at most this long after it was first buffered (sooner if flushed or evicted)
+#define KernelEepromWriteBufferRetryDelayMaxMs 32000 // if writing back fails the delay before retrying is doubled each time, up to this
+
+typedef struct {
+	uint16_t addr; // multiple of KernelEepromWriteBufferLineSize (only meaningful if dirtyMask is non-zero)
+	uint16_t dirtyMask; // bit n is set if data[n] holds a byte waiting to be written back
+	uint8_t data[KernelEepromWriteBufferLineSize];
+} KernelEepromWriteBufferLine;
+STATICASSERT(KernelEepromWriteBufferLineSize<=16); // size of dirtyMask
+STATICASSERT(KernelEepromTotalSize%KernelEepromWriteBufferLineSize==0);
+
+typedef struct {
+	uint32_t bytesRequested; // bytes passed to the write functor
+	uint32_t bytesWritten; // bytes actually written to EEPROM
+	uint32_t bytesUnchanged; // buffered bytes which already held the same value when written back (so were skipped)
+	uint32_t writeOps; // number of separate writes to EEPROM
+} KernelEepromWriteStats;
+
+KernelEepromWriteBufferLine kernelEepromWriteBuffer[KernelEepromWriteBufferLines];
+uint8_t kernelEepromWriteBufferNext=0; // line to evict next (round-robin)
+KTime kernelEepromWriteBufferDirtyTime=0; // when the oldest buffered data was buffered (or when writing back last failed)
+uint16_t kernelEepromWriteBufferDelayMs=KernelEepromWriteBufferFlushDelayMs; // current delay before writing back (see KernelEepromWriteBufferRetryDelayMaxMs)
+KernelEepromWriteStats kernelEepromWriteStats;
+
 #ifndef ARDUINO
+#define KernelBenchCommandMax 64
+
 const char *kernelFakeEepromPath="./eeprom";
 FILE *kernelFakeEepromFile=NULL;
 bool kernelFlagProfile=false;
+uint32_t kernelFlagProfileStacks=0;
+uint8_t kernelFlagThreads=1;
+bool kernelFlagScript=false;
+bool kernelFlagBench=false;
+
+// Benchmarking (--bench option) - totals are sampled whenever the tty script feeds in a new line, with the differences reported per command
+typedef struct {
+	KTime time; // monotonic, so 0 is (roughly) when the kernel started
+	uint64_t instructions;
+	uint32_t syscalls;
+} KernelBenchSample;
+
+KernelBenchSample kernelBenchCommandStart; // when the current command was fed in (or zero for boot)
+uint16_t kernelBenchLinesFed=0;
+char kernelBenchCommand[KernelBenchCommandMax]; // current command
+
+// Snapshots (--snapshot-out and --snapshot-in options, see snapshot.h)
+#define KernelSnapshotMagic "AOSFSNAP"
+#define KernelSnapshotMagicLen 8
+
+const char *kernelSnapshotOutPath=NULL; // saved once the shell is waiting for input (and any script has been fed in), after which the kernel shuts down
+const char *kernelSnapshotInPath=NULL; // restored instead of starting init
 #endif
 
 KernelFsFd kernelSpiLockFd=KernelFsFdInvalid;
@@ -85,6 +143,18 @@ uint32_t kernelEepromGenericFsFunctor(KernelFsDeviceFunctorType type, void *user
 KernelFsFileOffset kernelEepromGenericReadFunctor(KernelFsFileOffset addr, uint8_t *data, KernelFsFileOffset len, void *userData);
 KernelFsFileOffset kernelEepromGenericWriteFunctor(KernelFsFileOffset addr, const uint8_t *data, KernelFsFileOffset len, void *userData);
 
+// These use absolute addresses and bypass the write buffer
+bool kernelEepromRawRead(uint16_t addr, uint8_t *data, uint16_t len);
+bool kernelEepromRawWrite(uint16_t addr, const uint8_t *data, uint16_t len);
+
+void kernelEepromWriteBufferInit(void);
+void kernelEepromWriteBufferTick(void); // writes back buffered data once it is old enough
+bool kernelEepromWriteBufferFlush(void); // returns false if any buffered data could not be written back
+void kernelEepromWriteBufferDiscard(void); // drops any buffered data without writing it
+bool kernelEepromWriteBufferFlushLine(KernelEepromWriteBufferLine *line); // returns false (leaving data buffered) on failure
+bool kernelEepromWriteBufferIsDirty(void);
+KernelEepromWriteBufferLine *kernelEepromWriteBufferGetLine(uint16_t lineAddr); // finds or allocates a line (evicting if needed), returns NULL if no line could be freed
+
 uint16_t kernelVirtualDevFileDevRamMiniFsWriteFunctor(uint16_t addr, const uint8_t *data, uint16_t len, void *userData);
 uint32_t kernelVirtualDevFileGenericFsFunctor(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr);
 
@@ -94,6 +164,18 @@ bool kernelDevDigitalPinCanReadFunctor(void *userData);
 KernelFsFileOffset kernelDevDigitalPinWriteFunctor(const uint8_t *data, KernelFsFileOffset len, void *userData);
 bool kernelDevDigitalPinCanWriteFunctor(void *userData);
 
+#ifndef ARDUINO
+void kernelScriptTick(void); // starts shutdown once the tty script has been fed in and the shell has exited, and handles benchmark timing
+void kernelBenchSample(KernelBenchSample *sample);
+void kernelBenchPrintDiff(const char *name, const KernelBenchSample *start, const KernelBenchSample *end);
+void kernelBenchPrintReport(void);
+
+void kernelSnapshotTick(void); // saves snapshot and starts shutdown once the tty is waiting for input
+bool kernelSnapshotSave(const char *path);
+bool kernelSnapshotLoad(const char *path); // called during boot in place of starting init
+uint64_t kernelSnapshotGetBuildId(void); // hash of the kernel executable - snapshots contain details such as structure layouts, so can only be loaded by the same build
+#endif
+
 #ifndef ARDUINO
 uint32_t kernelExternalMountGenericFsFunctor(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr);
 KernelFsFileOffset kernelExternalMountGenericReadFunctor(KernelFsFileOffset addr, uint8_t *data, KernelFsFileOffset len, void *userData);
@@ -122,6 +204,51 @@ int main(int argc, char **argv) {
 	for(int i=1; i<argc; ++i) {
 		if (strcmp(argv[i], "--profile")==0)
 			kernelFlagProfile=true;
+		else if (strcmp(argv[i], "--profile-stacks")==0) {
+			if (i+1>=argc) {
+				printf("Warning: not enough arguments for --profile-stacks option (expect: sample interval in instructions)\n");
+			} else {
+				int interval=atoi(argv[++i]);
+				if (interval<1)
+					printf("Warning: bad sample interval '%s' for --profile-stacks option\n", argv[i]);
+				else
+					kernelFlagProfileStacks=interval;
+			}
+		}
+		else if (strcmp(argv[i], "--threads")==0) {
+			if (i+1>=argc) {
+				printf("Warning: not enough arguments for --threads option (expect: thread count)\n");
+			} else {
+				int threadCount=atoi(argv[++i]);
+				if (threadCount<1 || threadCount>UINT8_MAX)
+					printf("Warning: bad thread count '%s' for --threads option\n", argv[i]);
+				else
+					kernelFlagThreads=threadCount;
+			}
+		}
+		else if (strcmp(argv[i], "--script")==0 || strcmp(argv[i], "--bench")==0) {
+			if (i+1>=argc) {
+				printf("Warning: not enough arguments for %s option (expect: script path)\n", argv[i]);
+			} else {
+				const char *option=argv[i];
+				const char *scriptPath=argv[++i];
+				if (!ttySetScriptPath(scriptPath))
+					printf("Warning: could not open script '%s' for %s option\n", scriptPath, option);
+				else {
+					kernelFlagScript=true;
+					if (strcmp(option, "--bench")==0)
+						kernelFlagBench=true;
+				}
+			}
+		}
+		else if (strcmp(argv[i], "--snapshot-out")==0 || strcmp(argv[i], "--snapshot-in")==0) {
+			if (i+1>=argc) {
+				printf("Warning: not enough arguments for %s option (expect: snapshot path)\n", argv[i]);
+			} else if (strcmp(argv[i], "--snapshot-out")==0)
+				kernelSnapshotOutPath=argv[++i];
+			else
+				kernelSnapshotInPath=argv[++i];
+		}
 		else if (strcmp(argv[i], "--mountfile")==0) {
 			if (i+2>=argc) {
 				// Not enough args
@@ -201,12 +328,25 @@ int main(int argc, char **argv) {
 		if (kernelGetState()==KernelStateShuttingDownWaitInit && ktimeGetMonotonicMs()-kernelStateTime>=30000u) // 30s timeout
 			break; // break to call shutdown final
 
+		// Save snapshot if requested and the shell is waiting for input (done before checking for new input, so that any script's final ctrl+d is not fed in yet)
+		#ifndef ARDUINO
+		if (kernelSnapshotOutPath!=NULL && kernelGetState()==KernelStateRunning)
+			kernelSnapshotTick();
+		#endif
+
 		// Check for /dev/ttyS0 updates
 		ttyTick();
+		#ifndef ARDUINO
+		if (kernelFlagScript)
+			kernelScriptTick();
+		#endif
 
 		// Run hardware device tick functions.
 		hwDeviceTick();
 
+		// Write back buffered EEPROM data if it has waited long enough
+		kernelEepromWriteBufferTick();
+
 		// Run each process for 1 tick, and delay if we have spare time (PC wrapper only - pointless on Arduino)
 		#ifndef ARDUINO
 		KTime t=ktimeGetMonotonicMs();
@@ -215,9 +355,20 @@ int main(int argc, char **argv) {
 		procManTickAll();
 
 		#ifndef ARDUINO
-		t=ktimeGetMonotonicMs()-t;
-		if (t<kernelTickMinTimeMs)
-			ktimeDelayMs(kernelTickMinTimeMs-t);
+		KTime now=ktimeGetMonotonicMs();
+		t=now-t;
+		if (t<kernelTickMinTimeMs) {
+			// Use some of the spare time to coalesce free space in /tmp, which otherwise fragments as processes come and go
+			kernelFsDeviceCompactStep("/tmp");
+
+			// Idle until the next tick is due, or sooner if a sleeping process needs waking before then (benchmarks run unpaced so that timings reflect the kernel's own speed)
+			KTime delay=(kernelFlagBench ? 0 : kernelTickMinTimeMs-t);
+			KTime nextTimerTime;
+			if (procManGetNextTimerTime(&nextTimerTime))
+				delay=(nextTimerTime>now ? MIN(delay, nextTimerTime-now) : 0);
+			if (delay>0)
+				ktimeDelayMs(delay);
+		}
 		#endif
 	}
 
@@ -383,6 +534,8 @@ void kernelBoot(LogLevel logLevel) {
 	kernelLog(LogTypeInfo, kstrP("opened pseudo EEPROM storage file (PC wrapper)\n"));
 #endif
 
+	kernelEepromWriteBufferInit();
+
 	// Init file system and add virtual devices
 	kernelFsInit();
 	bool error;
@@ -413,7 +566,8 @@ void kernelBoot(LogLevel logLevel) {
 	// ... RO volumes
 	bool progmemError=false;
 	for(unsigned i=0; i<commonProgmemCount; ++i) {
-		progmemError|=!kernelFsAddBlockDeviceFile(commonProgmemData[i].mountPoint, kernelProgmemGenericFsFunctor, &commonProgmemData[i].dataPtr, KernelFsBlockDeviceFormatCustomMiniFs, commonProgmemData[i].size, false);
+		KernelFsBlockDeviceFormat format=(commonProgmemData[i].compressed ? KernelFsBlockDeviceFormatCompressedMiniFs : KernelFsBlockDeviceFormatCustomMiniFs);
+		progmemError|=!kernelFsAddBlockDeviceFile(commonProgmemData[i].mountPoint, kernelProgmemGenericFsFunctor, &commonProgmemData[i].dataPtr, format, commonProgmemData[i].size, false);
 	}
 	if (progmemError)
 		kernelLog(LogTypeWarning, kstrP("fs init failure: RO PROGMEM volume error\n"));
@@ -435,6 +589,9 @@ void kernelBoot(LogLevel logLevel) {
 #endif
 	error|=!kernelFsAddCharacterDeviceFile(kstrP("/dev/urandom"), &kernelVirtualDevFileGenericFsFunctor, (void *)(uintptr_t)KernelVirtualDevFileURandom, true, false);
 	error|=!kernelFsAddCharacterDeviceFile(kstrP("/dev/zero"), &kernelVirtualDevFileGenericFsFunctor, (void *)(uintptr_t)KernelVirtualDevFileZero, true, true);
+#ifndef ARDUINO
+	error|=!kernelFsAddBlockDeviceFile(kstrP("/dev/procstats"), &procManStatsFsFunctor, NULL, KernelFsBlockDeviceFormatFlatFile, ProcManStatsDevSize, false);
+#endif
 
 	if (error)
 		kernelLog(LogTypeWarning, kstrP("fs init failure: /dev\n"));
@@ -554,6 +711,18 @@ void kernelBoot(LogLevel logLevel) {
 	procManInit();
 	kernelLog(LogTypeInfo, kstrP("initialised process manager\n"));
 
+	// PC only: restore snapshot rather than starting init
+#ifndef ARDUINO
+	if (kernelSnapshotInPath!=NULL) {
+		kernelLog(LogTypeInfo, kstrP("restoring snapshot from '%s'\n"), kernelSnapshotInPath);
+		if (!kernelSnapshotLoad(kernelSnapshotInPath))
+			kernelFatalError(kstrP("could not restore snapshot from '%s'\n"), kernelSnapshotInPath);
+
+		kernelLog(LogTypeInfo, kstrP("booting complete\n"));
+		return;
+	}
+#endif
+
 	kernelLog(LogTypeInfo, kstrP("starting init\n"));
 	if (procManProcessNew("/bin/init")==ProcManPidMax)
 		kernelFatalError(kstrP("could not start init at '%s'\n"), "/bin/init");
@@ -565,6 +734,14 @@ void kernelShutdownFinal(void) {
 	kernelSetState(KernelStateShuttingDownFinal);
 	kernelLog(LogTypeInfo, kstrP("shutting down final\n"));
 
+	// Log /tmp fragmentation and compaction statistics
+	uint16_t tmpFreeSize, tmpLargestFreeRegionSize;
+	if (kernelFsDeviceGetFreeSpaceStats("/tmp", &tmpFreeSize, &tmpLargestFreeRegionSize))
+		kernelLog(LogTypeInfo, kstrP("/tmp: %u bytes free, largest free region %u bytes\n"), tmpFreeSize, tmpLargestFreeRegionSize);
+	KernelFsCompactStats compactStats;
+	kernelFsGetCompactStats(&compactStats);
+	kernelLog(LogTypeInfo, kstrP("compaction: %"PRIu32" files moved (%u full compactions after allocation failure), %"PRIu32"ms\n"), compactStats.steps, compactStats.onAllocFailureCount, compactStats.timeMs);
+
 	// Quit process manager
 	kernelLog(LogTypeInfo, kstrP("killing process manager\n"));
 	procManQuit();
@@ -573,12 +750,22 @@ void kernelShutdownFinal(void) {
 	kernelLog(LogTypeInfo, kstrP("unmounting filesystem\n"));
 	kernelFsQuit();
 
+	// Write back any buffered EEPROM data
+	kernelEepromWriteBufferFlush();
+	kernelLog(LogTypeInfo, kstrP("EEPROM writes: %"PRIu32" bytes requested, %"PRIu32" bytes written in %"PRIu32" ops, %"PRIu32" unchanged bytes skipped\n"), kernelEepromWriteStats.bytesRequested, kernelEepromWriteStats.bytesWritten, kernelEepromWriteStats.writeOps, kernelEepromWriteStats.bytesUnchanged);
+
 	// Non-arduino-only: close pretend EEPROM storage file
 #ifndef ARDUINO
 	kernelLog(LogTypeInfo, kstrP("closing pseudo EEPROM storage file (PC wrapper)\n"));
 	fclose(kernelFakeEepromFile);
 #endif
 
+	// Print benchmark results (PC only)
+#ifndef ARDUINO
+	if (kernelFlagBench)
+		kernelBenchPrintReport();
+#endif
+
 	// Reset tty stuff
 	ttyQuit();
 
@@ -617,6 +804,9 @@ uint32_t kernelProgmemGenericFsFunctor(KernelFsDeviceFunctorType type, void *use
 		break;
 		case KernelFsDeviceFunctorTypeBlockWrite:
 		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+			return true; // never blocks
+		break;
 	}
 
 	assert(false);
@@ -640,6 +830,7 @@ KernelFsFileOffset kernelProgmemGenericReadFunctor(KernelFsFileOffset addr, uint
 uint32_t kernelEepromGenericFsFunctor(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr) {
 	switch(type) {
 		case KernelFsDeviceFunctorTypeCommonFlush:
+			kernelEepromWriteBufferFlush();
 			return true;
 		break;
 		case KernelFsDeviceFunctorTypeCharacterRead:
@@ -656,6 +847,9 @@ uint32_t kernelEepromGenericFsFunctor(KernelFsDeviceFunctorType type, void *user
 		case KernelFsDeviceFunctorTypeBlockWrite:
 			return kernelEepromGenericWriteFunctor(addr, data, len, userData);
 		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+			return true; // never blocks
+		break;
 	}
 
 	assert(false);
@@ -665,47 +859,200 @@ uint32_t kernelEepromGenericFsFunctor(KernelFsDeviceFunctorType type, void *user
 KernelFsFileOffset kernelEepromGenericReadFunctor(KernelFsFileOffset addr, uint8_t *data, KernelFsFileOffset len, void *userData) {
 	uint16_t offset=(uint16_t)(uintptr_t)userData;
 	addr+=offset;
-	if (addr>UINT16_MAX)
+	if (addr>=KernelEepromTotalSize)
 		return 0;
+	if (len>KernelEepromTotalSize-addr)
+		len=KernelEepromTotalSize-addr;
 
-#ifdef ARDUINO
-	eeprom_read_block(data, (void *)(uint16_t)addr, len);
-	return len;
-#else
-	if (fseek(kernelFakeEepromFile, addr, SEEK_SET)!=0 || ftell(kernelFakeEepromFile)!=addr) {
-		kernelLog(LogTypeWarning, kstrP("could not seek to addr %"PRIu32" in generic EEPROM read functor (offset=%u)\n"), addr, offset);
+	if (!kernelEepromRawRead(addr, data, len))
 		return 0;
+
+	// Overlay any data still waiting in the write buffer
+	for(uint8_t i=0; i<KernelEepromWriteBufferLines; ++i) {
+		const KernelEepromWriteBufferLine *line=&kernelEepromWriteBuffer[i];
+		if (line->dirtyMask==0 || line->addr+KernelEepromWriteBufferLineSize<=addr || line->addr>=addr+len)
+			continue;
+		for(uint8_t j=0; j<KernelEepromWriteBufferLineSize; ++j) {
+			uint16_t byteAddr=line->addr+j;
+			if ((line->dirtyMask & (1u<<j)) && byteAddr>=addr && byteAddr<addr+len)
+				data[byteAddr-addr]=line->data[j];
+		}
 	}
-	KernelFsFileOffset result=fread(data, 1, len, kernelFakeEepromFile);
-	if (result!=len)
-		kernelLog(LogTypeWarning, kstrP("could not read at addr %"PRIu32" in generic EEPROM read functor (offset=%u, result=%u)\n"), addr, offset, result);
-	return result;
-#endif
+
+	return len;
 }
 
 KernelFsFileOffset kernelEepromGenericWriteFunctor(KernelFsFileOffset addr, const uint8_t *data, KernelFsFileOffset len, void *userData) {
-	if (len>UINT16_MAX)
-		len=UINT16_MAX;
 	uint16_t offset=(uint16_t)(uintptr_t)userData;
 	addr+=offset;
-	if (addr>UINT16_MAX)
+	if (addr>=KernelEepromTotalSize)
 		return 0;
+	if (len>KernelEepromTotalSize-addr)
+		len=KernelEepromTotalSize-addr;
+
+	kernelEepromWriteStats.bytesRequested+=len;
+
+	// Copy data into buffer lines
+	for(KernelFsFileOffset i=0; i<len; ) {
+		uint16_t byteAddr=addr+i;
+		KernelEepromWriteBufferLine *line=kernelEepromWriteBufferGetLine(byteAddr & ~(KernelEepromWriteBufferLineSize-1));
+		if (line==NULL)
+			return i;
+		for(uint8_t j=byteAddr-line->addr; j<KernelEepromWriteBufferLineSize && i<len; ++j, ++i) {
+			line->data[j]=data[i];
+			line->dirtyMask|=(1u<<j);
+		}
+	}
 
-#ifdef ARDUINO
-	eeprom_update_block((const void *)data, (void *)(uint16_t)addr, len);
 	return len;
+}
+
+bool kernelEepromRawRead(uint16_t addr, uint8_t *data, uint16_t len) {
+#ifdef ARDUINO
+	eeprom_read_block(data, (void *)addr, len);
+	return true;
 #else
 	if (fseek(kernelFakeEepromFile, addr, SEEK_SET)!=0 || ftell(kernelFakeEepromFile)!=addr) {
-		kernelLog(LogTypeWarning, kstrP("could not seek to addr %"PRIu32" in /dev/eeprom write functor (offset=%i)\n"), addr, offset);
-		return 0;
+		kernelLog(LogTypeWarning, kstrP("could not seek to addr %u in EEPROM read\n"), addr);
+		return false;
 	}
-	KernelFsFileOffset result=fwrite(data, 1, len, kernelFakeEepromFile);
-	if (result!=len)
-		kernelLog(LogTypeWarning, kstrP("could not write to addr %"PRIu32" in /dev/eeprom write functor (offset=%i,result=%i)\n"), addr, offset, result);
-	return result;
+	uint16_t result=fread(data, 1, len, kernelFakeEepromFile);
+	if (result!=len) {
+		kernelLog(LogTypeWarning, kstrP("could not read at addr %u in EEPROM read (len=%u, result=%u)\n"), addr, len, result);
+		return false;
+	}
+	return true;
+#endif
+}
+
+bool kernelEepromRawWrite(uint16_t addr, const uint8_t *data, uint16_t len) {
+	++kernelEepromWriteStats.writeOps;
+	kernelEepromWriteStats.bytesWritten+=len;
+
+#ifdef ARDUINO
+	eeprom_update_block((const void *)data, (void *)addr, len);
+	return true;
+#else
+	if (fseek(kernelFakeEepromFile, addr, SEEK_SET)!=0 || ftell(kernelFakeEepromFile)!=addr) {
+		kernelLog(LogTypeWarning, kstrP("could not seek to addr %u in EEPROM write\n"), addr);
+		return false;
+	}
+	uint16_t result=fwrite(data, 1, len, kernelFakeEepromFile);
+	if (result!=len) {
+		kernelLog(LogTypeWarning, kstrP("could not write to addr %u in EEPROM write (len=%u, result=%u)\n"), addr, len, result);
+		return false;
+	}
+	return true;
 #endif
 }
 
+void kernelEepromWriteBufferInit(void) {
+	kernelEepromWriteBufferDiscard();
+	memset(&kernelEepromWriteStats, 0, sizeof(kernelEepromWriteStats));
+}
+
+void kernelEepromWriteBufferTick(void) {
+	KTime now=ktimeGetMonotonicMs();
+	if (!kernelEepromWriteBufferIsDirty() || now-kernelEepromWriteBufferDirtyTime<kernelEepromWriteBufferDelayMs)
+		return;
+
+	if (kernelEepromWriteBufferFlush()) {
+		kernelEepromWriteBufferDelayMs=KernelEepromWriteBufferFlushDelayMs;
+		return;
+	}
+
+	// Failed - back off before trying again, to avoid retrying (and logging) on every pass of the main loop
+	kernelEepromWriteBufferDirtyTime=now;
+	kernelEepromWriteBufferDelayMs=MIN(((uint32_t)kernelEepromWriteBufferDelayMs)*2, KernelEepromWriteBufferRetryDelayMaxMs);
+	kernelLog(LogTypeWarning, kstrP("could not write back buffered EEPROM data, retrying in %ums\n"), kernelEepromWriteBufferDelayMs);
+}
+
+bool kernelEepromWriteBufferFlush(void) {
+	bool result=true;
+	for(uint8_t i=0; i<KernelEepromWriteBufferLines; ++i)
+		result&=kernelEepromWriteBufferFlushLine(&kernelEepromWriteBuffer[i]);
+
+#ifndef ARDUINO
+	fflush(kernelFakeEepromFile);
+#endif
+
+	return result;
+}
+
+void kernelEepromWriteBufferDiscard(void) {
+	for(uint8_t i=0; i<KernelEepromWriteBufferLines; ++i)
+		kernelEepromWriteBuffer[i].dirtyMask=0;
+	kernelEepromWriteBufferNext=0;
+	kernelEepromWriteBufferDirtyTime=0;
+	kernelEepromWriteBufferDelayMs=KernelEepromWriteBufferFlushDelayMs;
+}
+
+bool kernelEepromWriteBufferFlushLine(KernelEepromWriteBufferLine *line) {
+	if (line->dirtyMask==0)
+		return true;
+
+	uint8_t current[KernelEepromWriteBufferLineSize];
+	if (!kernelEepromRawRead(line->addr, current, KernelEepromWriteBufferLineSize))
+		return false; // leave data buffered
+
+	// Write each run of dirty bytes which differ from what is already stored
+	for(uint8_t i=0; i<KernelEepromWriteBufferLineSize; ) {
+		bool dirty=(line->dirtyMask & (1u<<i));
+		if (!dirty || line->data[i]==current[i]) {
+			if (dirty)
+				++kernelEepromWriteStats.bytesUnchanged;
+			++i;
+			continue;
+		}
+
+		uint8_t runStart=i;
+		while(i<KernelEepromWriteBufferLineSize && (line->dirtyMask & (1u<<i)) && line->data[i]!=current[i])
+			++i;
+		if (!kernelEepromRawWrite(line->addr+runStart, line->data+runStart, i-runStart))
+			return false; // leave data buffered (any runs already written will simply be found unchanged next time)
+	}
+
+	line->dirtyMask=0;
+	return true;
+}
+
+bool kernelEepromWriteBufferIsDirty(void) {
+	for(uint8_t i=0; i<KernelEepromWriteBufferLines; ++i)
+		if (kernelEepromWriteBuffer[i].dirtyMask!=0)
+			return true;
+	return false;
+}
+
+KernelEepromWriteBufferLine *kernelEepromWriteBufferGetLine(uint16_t lineAddr) {
+	// Look for a line already buffering this address, noting a free one in case not
+	KernelEepromWriteBufferLine *freeLine=NULL;
+	for(uint8_t i=0; i<KernelEepromWriteBufferLines; ++i) {
+		KernelEepromWriteBufferLine *line=&kernelEepromWriteBuffer[i];
+		if (line->dirtyMask==0) {
+			if (freeLine==NULL)
+				freeLine=line;
+		} else if (line->addr==lineAddr)
+			return line;
+	}
+
+	// Start timing if this is the first data to be buffered
+	if (!kernelEepromWriteBufferIsDirty())
+		kernelEepromWriteBufferDirtyTime=ktimeGetMonotonicMs();
+
+	// No free lines? Evict one (a line which could not be flushed still holds dirty data so must not be reused)
+	for(uint8_t i=0; i<KernelEepromWriteBufferLines && freeLine==NULL; ++i) {
+		KernelEepromWriteBufferLine *line=&kernelEepromWriteBuffer[kernelEepromWriteBufferNext];
+		kernelEepromWriteBufferNext=(kernelEepromWriteBufferNext+1)%KernelEepromWriteBufferLines;
+		if (kernelEepromWriteBufferFlushLine(line))
+			freeLine=line;
+	}
+	if (freeLine==NULL)
+		return NULL;
+
+	freeLine->addr=lineAddr;
+	return freeLine;
+}
+
 uint16_t kernelVirtualDevFileDevRamMiniFsWriteFunctor(uint16_t addr, const uint8_t *data, uint16_t len, void *userData) {
 	return kernelVirtualDevFileGenericFsFunctor(KernelFsDeviceFunctorTypeBlockWrite, userData, (uint8_t *)data, len, addr);
 }
@@ -857,6 +1204,9 @@ uint32_t kernelVirtualDevFileGenericFsFunctor(KernelFsDeviceFunctorType type, vo
 				break;
 			}
 		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+			return true; // never blocks
+		break;
 	}
 
 	assert(false);
@@ -884,6 +1234,8 @@ uint32_t kernelDevDigitalPinFsFunctor(KernelFsDeviceFunctorType type, void *user
 		break;
 		case KernelFsDeviceFunctorTypeBlockWrite:
 		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+		break;
 	}
 
 	assert(false);
@@ -947,6 +1299,9 @@ uint32_t kernelExternalMountGenericFsFunctor(KernelFsDeviceFunctorType type, voi
 		case KernelFsDeviceFunctorTypeBlockWrite:
 			return kernelExternalMountGenericWriteFunctor(addr, data, len, userData);
 		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+			return true; // never blocks
+		break;
 	}
 
 	assert(false);
@@ -1009,4 +1364,171 @@ KernelFsFileOffset kernelExternalMountGenericWriteFunctor(KernelFsFileOffset add
 	return result;
 }
 
+void kernelScriptTick(void) {
+	// Has the script fed in another line?
+	uint16_t linesFed=ttyScriptGetLinesFed();
+	if (linesFed!=kernelBenchLinesFed) {
+		if (kernelFlagBench) {
+			// Report on previous command (or boot if this is the first line)
+			KernelBenchSample now;
+			kernelBenchSample(&now);
+			kernelBenchPrintDiff((kernelBenchLinesFed==0 ? "boot" : kernelBenchCommand), &kernelBenchCommandStart, &now);
+
+			// Start timing new command
+			kernelBenchCommandStart=now;
+			strncpy(kernelBenchCommand, ttyScriptGetLastLine(), KernelBenchCommandMax-1);
+			kernelBenchCommand[KernelBenchCommandMax-1]='\0';
+		}
+		kernelBenchLinesFed=linesFed;
+	}
+
+	// Once the whole script has been fed in and the shell has exited (leaving only init), shutdown
+	if (ttyScriptIsDone() && kernelGetState()==KernelStateRunning && procManGetProcessCount()<=1) {
+		kernelLog(LogTypeInfo, kstrP("end of tty script and shell has exited, shutting down\n"));
+		kernelShutdownBegin();
+	}
+}
+
+void kernelBenchSample(KernelBenchSample *sample) {
+	assert(sample!=NULL);
+
+	sample->time=ktimeGetMonotonicMs();
+	sample->instructions=procManGetInstructionTotal();
+	sample->syscalls=procManGetSyscallTotal();
+}
+
+void kernelBenchPrintDiff(const char *name, const KernelBenchSample *start, const KernelBenchSample *end) {
+	assert(name!=NULL);
+	assert(start!=NULL);
+	assert(end!=NULL);
+
+	fprintf(stderr, "bench: %-32s %8"PRIu64" ms %12"PRIu64" instructions %8"PRIu32" syscalls\n", name, end->time-start->time, end->instructions-start->instructions, end->syscalls-start->syscalls);
+}
+
+void kernelBenchPrintReport(void) {
+	KernelBenchSample now;
+	kernelBenchSample(&now);
+
+	// Report on final command if the script did not get chance to finish (e.g. the command was 'shutdown')
+	if (kernelBenchLinesFed>0 && !ttyScriptIsDone())
+		kernelBenchPrintDiff(kernelBenchCommand, &kernelBenchCommandStart, &now);
+
+	// Report totals
+	KernelBenchSample zero={0};
+	kernelBenchPrintDiff("total", &zero, &now);
+
+	// Report syscall counts (by id, see BytecodeSyscallId)
+	for(uint16_t syscallId=0; syscallId<ProcManSyscallCountsMax; ++syscallId) {
+		uint32_t count=procManGetSyscallCount(syscallId);
+		if (count>0)
+			fprintf(stderr, "bench: syscall %u %"PRIu32"\n", syscallId, count);
+	}
+}
+
+void kernelSnapshotTick(void) {
+	if (!ttyIsWaitingForInput())
+		return;
+
+	if (kernelSnapshotSave(kernelSnapshotOutPath))
+		kernelLog(LogTypeInfo, kstrP("saved snapshot to '%s', shutting down\n"), kernelSnapshotOutPath);
+	else
+		kernelLog(LogTypeWarning, kstrP("could not save snapshot to '%s', shutting down\n"), kernelSnapshotOutPath);
+
+	kernelSnapshotOutPath=NULL;
+	kernelShutdownBegin();
+}
+
+bool kernelSnapshotSave(const char *path) {
+	assert(path!=NULL);
+
+	// Write back buffered EEPROM data so that the EEPROM file is up to date
+	kernelEepromWriteBufferFlush();
+
+	uint8_t eepromData[KernelEepromTotalSize];
+	if (!kernelEepromRawRead(0, eepromData, KernelEepromTotalSize))
+		return false;
+
+	FILE *file=fopen(path, "wb");
+	if (file==NULL)
+		return false;
+
+	// Write header, RAM and EEPROM contents, followed by the state of each module in turn
+	uint64_t buildId=kernelSnapshotGetBuildId();
+	bool success=snapshotWrite(file, KernelSnapshotMagic, KernelSnapshotMagicLen) &&
+	             snapshotWrite(file, &buildId, sizeof(buildId)) &&
+	             snapshotWrite(file, kernelRamData, KernelRamSize) &&
+	             snapshotWrite(file, eepromData, KernelEepromTotalSize) &&
+	             ktimeSnapshotSave(file) &&
+	             ttySnapshotSave(file) &&
+	             kernelFsSnapshotSave(file) &&
+	             kernelMountSnapshotSave(file) &&
+	             procManSnapshotSave(file);
+
+	if (fclose(file)!=0)
+		success=false;
+
+	return success;
+}
+
+bool kernelSnapshotLoad(const char *path) {
+	assert(path!=NULL);
+
+	FILE *file=fopen(path, "rb");
+	if (file==NULL) {
+		kernelLog(LogTypeWarning, kstrP("could not open snapshot '%s'\n"), path);
+		return false;
+	}
+
+	// Check header
+	char magic[KernelSnapshotMagicLen];
+	uint64_t buildId;
+	if (!snapshotRead(file, magic, KernelSnapshotMagicLen) || memcmp(magic, KernelSnapshotMagic, KernelSnapshotMagicLen)!=0 ||
+	    !snapshotRead(file, &buildId, sizeof(buildId)) || buildId!=kernelSnapshotGetBuildId()) {
+		kernelLog(LogTypeWarning, kstrP("snapshot '%s' is not valid or was saved by a different kernel build\n"), path);
+		fclose(file);
+		return false;
+	}
+
+	// Boot mounted a freshly formatted /tmp, undo this as the mounts and fds in use when the snapshot was saved are restored below (along with /dev/ram's contents)
+	kernelUnmount("/tmp");
+
+	// Drop anything buffered for writing to EEPROM during boot, as it would otherwise be written over the restored contents later
+	kernelEepromWriteBufferDiscard();
+
+	// Restore RAM and EEPROM contents, followed by the state of each module in turn (in dependency order - processes refer to fds, which refer to devices)
+	uint8_t eepromData[KernelEepromTotalSize];
+	bool success=snapshotRead(file, kernelRamData, KernelRamSize) &&
+	             snapshotRead(file, eepromData, KernelEepromTotalSize) &&
+	             fseek(kernelFakeEepromFile, 0L, SEEK_SET)==0 && // written directly to keep restoring out of the EEPROM write stats
+	             snapshotWrite(kernelFakeEepromFile, eepromData, KernelEepromTotalSize) &&
+	             fflush(kernelFakeEepromFile)==0 &&
+	             ktimeSnapshotLoad(file) &&
+	             ttySnapshotLoad(file) &&
+	             kernelFsSnapshotLoad(file) &&
+	             kernelMountSnapshotLoad(file) &&
+	             procManSnapshotLoad(file);
+
+	fclose(file);
+
+	return success;
+}
+
+uint64_t kernelSnapshotGetBuildId(void) {
+	// FNV-1a hash of our own executable (or 0 if it cannot be read)
+	FILE *file=fopen("/proc/self/exe", "rb");
+	if (file==NULL)
+		return 0;
+
+	uint64_t hash=14695981039346656037llu;
+	uint8_t buffer[4096];
+	size_t len;
+	while((len=fread(buffer, 1, sizeof(buffer), file))>0)
+		for(size_t i=0; i<len; ++i)
+			hash=(hash^buffer[i])*1099511628211llu;
+
+	fclose(file);
+
+	return hash;
+}
+
 #endif
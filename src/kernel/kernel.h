@@ -17,6 +17,8 @@ typedef enum {
 
 #ifndef ARDUINO
 extern bool kernelFlagProfile;
+extern uint32_t kernelFlagProfileStacks; // sample the call stack of each process every this many instructions (see --profile-stacks), 0 if disabled
+extern uint8_t kernelFlagThreads; // number of host threads to tick processes on (see procManTickAll)
 #endif
 
 void kernelShutdownBegin(void);
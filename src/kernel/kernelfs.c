@@ -12,12 +12,26 @@
 #include "kernelfs.h"
 #include "log.h"
 #include "minifs.h"
+#include "minifscompress.h"
 #include "ktime.h"
+#include "snapshot.h"
 #include "util.h"
 
 #define KernelFsDevicesMax 128
 typedef uint8_t KernelFsDeviceIndex;
 
+#ifdef ARDUINO
+#define KernelFsBlockCacheSize 1
+#else
+#define KernelFsBlockCacheSize 8
+#endif
+
+#ifdef ARDUINO
+#define KernelFsMiniFsIndexMax 0 // each index needs over 1kb of RAM
+#else
+#define KernelFsMiniFsIndexMax 4
+#endif
+
 typedef uint8_t KernelFsDeviceType;
 #define KernelFsDeviceTypeBlock 0
 #define KernelFsDeviceTypeCharacter 1
@@ -37,6 +51,8 @@ typedef struct {
 	uint8_t writable:1;
 	uint8_t reserved:4;
 
+	uint8_t generation; // incremented whenever files are created or deleted within this device (see kernelFsGetDirGenerationToken and kernelFsDeviceBumpGeneration)
+
 	// Type-specific data follows
 } KernelFsDeviceCommon;
 
@@ -60,12 +76,35 @@ typedef union {
 typedef struct {
 	KStr path; // also stores ref counter in spare bits - see kstrGetSpare and kstrSetSpare
 	KernelFsDeviceIndex deviceIndex;
+	uint16_t dirCursor; // for directories: position of the next child to be returned by kernelFsDirectoryGetNextChild (meaning depends on device type)
 } KernelFsFdtEntry;
 
+typedef struct {
+	uint8_t data[MINIFSCOMPRESSBLOCKSIZE];
+	uint16_t len;
+	KernelFsDeviceIndex deviceIndex; // KernelFsDevicesMax if entry is unused
+	uint8_t blockIndex;
+} KernelFsBlockCacheEntry; // decompressed block from a compressed MiniFs volume
+
+typedef struct {
+	MiniFsIndex index;
+	KernelFsDeviceIndex deviceIndex; // KernelFsDevicesMax if entry is unused
+} KernelFsMiniFsIndexEntry; // cached header of a writable MiniFs volume (see miniFsSetIndex)
+
 typedef struct {
 	KernelFsFdtEntry fdt[KernelFsFdMax];
 
 	KernelFsDevice devices[KernelFsDevicesMax];
+
+	uint16_t generation; // incremented whenever devices are added, removed or remounted (so caches of path lookups know when to invalidate)
+
+	KernelFsBlockCacheEntry blockCache[KernelFsBlockCacheSize];
+	uint8_t blockCacheNext; // entry to replace next (round-robin)
+
+	KernelFsCompactStats compactStats;
+
+	KernelFsMiniFsIndexEntry miniFsIndexes[KernelFsMiniFsIndexMax];
+	uint8_t miniFsWriteDepth; // non-zero while a MiniFs volume is being written via kernelFsDeviceMiniFsWriteWrapper (so we can tell such writes apart from raw writes to the underlying device)
 } KernelFsData;
 
 KernelFsData kernelFsData;
@@ -87,6 +126,7 @@ KernelFsDeviceIndex kernelFsGetDeviceIndexFromDevice(const KernelFsDevice *devic
 
 KernelFsDevice *kernelFsAddDeviceFile(KStr mountPoint, KernelFsDeviceFunctor *functor, void *userData, KernelFsDeviceType type, bool writable);
 void kernelFsRemoveDeviceFileRaw(KernelFsDevice *device);
+void kernelFsDeviceBumpGeneration(KernelFsDevice *device); // call whenever a file is created or deleted within the device
 
 bool kernelFsDeviceIsChildOfPath(KernelFsDevice *device, const char *parentDir);
 
@@ -105,6 +145,7 @@ bool kernelFsDeviceInvokeFunctorCharacterCanWrite(KernelFsDevice *device);
 
 KernelFsFileOffset kernelFsDeviceInvokeFunctorBlockRead(KernelFsDevice *device, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr);
 KernelFsFileOffset kernelFsDeviceInvokeFunctorBlockWrite(KernelFsDevice *device, const uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr);
+bool kernelFsDeviceInvokeFunctorBlockCanRead(KernelFsDevice *device, KernelFsFileOffset addr);
 
 // The following functions deal with logic handling the mode and ref count stored in the spare bits of fdt path fields.
 STATICASSERT(KernelFsFdModeNone==0); // so that make function can return 0 for error unambiguously
@@ -125,6 +166,20 @@ void kernelFsSetFileSpare(KernelFsFd fd, uint8_t spare);
 uint16_t kernelFsDeviceMiniFsReadWrapper(uint16_t addr, uint8_t *data, uint16_t len, void *userData);
 uint16_t kernelFsDeviceMiniFsWriteWrapper(uint16_t addr, const uint8_t *data, uint16_t len, void *userData);
 
+// For compressed MiniFs volumes kernelFsDeviceMiniFsReadWrapper returns decompressed data (via the block cache),
+// while this reads the compressed data directly
+uint16_t kernelFsDeviceRawReadWrapper(uint16_t addr, uint8_t *data, uint16_t len, void *userData);
+
+uint16_t kernelFsBlockCacheRead(KernelFsDevice *device, uint16_t addr, uint8_t *data, uint16_t len); // reads decompressed data from a compressed MiniFs volume
+void kernelFsBlockCacheInvalidateDevice(KernelFsDeviceIndex deviceIndex);
+
+void kernelFsDeviceMiniFsMountFast(MiniFs *miniFs, KernelFsDevice *device, bool writable); // attaches a MiniFs index if the device is writable and one is available
+MiniFsIndex *kernelFsMiniFsIndexGet(KernelFsDeviceIndex deviceIndex); // returns NULL if no index assigned and none free
+void kernelFsMiniFsIndexRelease(KernelFsDeviceIndex deviceIndex);
+void kernelFsMiniFsIndexInvalidateAll(void);
+
+bool kernelFsMiniFsCompact(MiniFs *miniFs, bool full); // if full is false then moves at most one file, returns true if anything was moved
+
 // These two functions can be passed to the fatMount functions to allow reading/writing a FAT volume in an open file,
 // with the KernelFsDevice pointer passed as the userData field
 uint32_t kernelFsFatReadWrapper(uint32_t addr, uint8_t *data, uint32_t len, void *userData);
@@ -139,11 +194,27 @@ void kernelFsInit(void) {
 	for(KernelFsFd i=0; i<KernelFsFdMax; ++i) {
 		kernelFsData.fdt[i].path=kstrNull();
 		kernelFsData.fdt[i].deviceIndex=KernelFsDevicesMax;
+		kernelFsData.fdt[i].dirCursor=0;
 	}
 
 	// Clear virtual device array
 	for(KernelFsDeviceIndex i=0; i<KernelFsDevicesMax; ++i)
 		kernelFsData.devices[i].common.type=KernelFsDeviceTypeNB;
+
+	kernelFsData.generation=0;
+
+	// Clear block cache
+	for(uint8_t i=0; i<KernelFsBlockCacheSize; ++i)
+		kernelFsData.blockCache[i].deviceIndex=KernelFsDevicesMax;
+	kernelFsData.blockCacheNext=0;
+
+	// Clear MiniFs indexes
+	for(uint8_t i=0; i<KernelFsMiniFsIndexMax; ++i)
+		kernelFsData.miniFsIndexes[i].deviceIndex=KernelFsDevicesMax;
+	kernelFsData.miniFsWriteDepth=0;
+
+	// Clear compaction stats
+	memset(&kernelFsData.compactStats, 0, sizeof(kernelFsData.compactStats));
 }
 
 void kernelFsQuit(void) {
@@ -163,6 +234,216 @@ void kernelFsQuit(void) {
 	}
 }
 
+#ifndef ARDUINO
+bool kernelFsSnapshotSave(FILE *file) {
+	assert(file!=NULL);
+
+	if (!snapshotWrite(file, &kernelFsData.generation, sizeof(kernelFsData.generation)))
+		return false;
+
+	// Save device table
+	for(KernelFsDeviceIndex i=0; i<KernelFsDevicesMax; ++i) {
+		const KernelFsDevice *device=&kernelFsData.devices[i];
+		uint8_t type=device->common.type;
+		if (!snapshotWrite(file, &type, sizeof(type)))
+			return false;
+		if (type==KernelFsDeviceTypeNB)
+			continue;
+
+		// Functor pointers are stored relative to a function in this file, as the whole executable may be loaded at a different address next time
+		uint8_t flags=(device->common.characterCanOpenManyFlag ? 1 : 0)|(device->common.writable ? 2 : 0);
+		int64_t functorOffset=(device->common.functor!=NULL ? (intptr_t)device->common.functor-(intptr_t)&kernelFsInit : 0);
+		uint8_t hasFunctor=(device->common.functor!=NULL);
+		uint64_t userData=(uintptr_t)device->common.userData;
+		if (!snapshotWriteKStr(file, device->common.mountPoint) ||
+		    !snapshotWrite(file, &flags, sizeof(flags)) ||
+		    !snapshotWrite(file, &device->common.generation, sizeof(device->common.generation)) ||
+		    !snapshotWrite(file, &hasFunctor, sizeof(hasFunctor)) ||
+		    !snapshotWrite(file, &functorOffset, sizeof(functorOffset)) ||
+		    !snapshotWrite(file, &userData, sizeof(userData)))
+			return false;
+
+		if (type==KernelFsDeviceTypeBlock) {
+			if (!snapshotWrite(file, &device->block.size, sizeof(device->block.size)) ||
+			    !snapshotWrite(file, &device->block.format, sizeof(device->block.format)))
+				return false;
+		}
+	}
+
+	// Save file descriptor table
+	for(KernelFsFd fd=0; fd<KernelFsFdMax; ++fd) {
+		const KernelFsFdtEntry *entry=&kernelFsData.fdt[fd];
+		if (!snapshotWriteKStr(file, entry->path))
+			return false;
+		if (kstrIsNull(entry->path))
+			continue;
+
+		uint8_t spare=kstrGetSpare(entry->path);
+		if (!snapshotWrite(file, &spare, sizeof(spare)) ||
+		    !snapshotWrite(file, &entry->deviceIndex, sizeof(entry->deviceIndex)) ||
+		    !snapshotWrite(file, &entry->dirCursor, sizeof(entry->dirCursor)))
+			return false;
+	}
+
+	return true;
+}
+
+bool kernelFsSnapshotLoad(FILE *file) {
+	assert(file!=NULL);
+
+	uint16_t generation;
+	if (!snapshotRead(file, &generation, sizeof(generation)))
+		return false;
+
+	// No files should be open yet
+	for(KernelFsFd fd=0; fd<KernelFsFdMax; ++fd)
+		if (!kstrIsNull(kernelFsData.fdt[fd].path))
+			return false;
+
+	// Move devices added during boot out of the way so that the device table can be restored with the same indexes as before
+	KernelFsDevice *bootDevices=malloc(sizeof(kernelFsData.devices));
+	if (bootDevices==NULL)
+		return false;
+	memcpy(bootDevices, kernelFsData.devices, sizeof(kernelFsData.devices));
+	for(KernelFsDeviceIndex i=0; i<KernelFsDevicesMax; ++i)
+		kernelFsData.devices[i].common.type=KernelFsDeviceTypeNB;
+
+	// Restore device table
+	bool success=true;
+	for(KernelFsDeviceIndex i=0; i<KernelFsDevicesMax && success; ++i) {
+		uint8_t type;
+		if (!snapshotRead(file, &type, sizeof(type)) || type>KernelFsDeviceTypeNB) {
+			success=false;
+			break;
+		}
+		if (type==KernelFsDeviceTypeNB)
+			continue;
+
+		KStr mountPoint;
+		uint8_t flags, deviceGeneration, hasFunctor;
+		int64_t functorOffset;
+		uint64_t userData;
+		if (!snapshotReadKStr(file, &mountPoint) || kstrIsNull(mountPoint)) {
+			success=false;
+			break;
+		}
+
+		KernelFsDevice *device=&kernelFsData.devices[i];
+		device->common.mountPoint=mountPoint;
+		device->common.type=type;
+
+		if (!snapshotRead(file, &flags, sizeof(flags)) ||
+		    !snapshotRead(file, &deviceGeneration, sizeof(deviceGeneration)) ||
+		    !snapshotRead(file, &hasFunctor, sizeof(hasFunctor)) ||
+		    !snapshotRead(file, &functorOffset, sizeof(functorOffset)) ||
+		    !snapshotRead(file, &userData, sizeof(userData))) {
+			success=false;
+			break;
+		}
+
+		device->common.characterCanOpenManyFlag=((flags&1)!=0);
+		device->common.writable=((flags&2)!=0);
+		device->common.generation=deviceGeneration;
+		device->common.functor=(hasFunctor ? (KernelFsDeviceFunctor *)((intptr_t)&kernelFsInit+functorOffset) : NULL);
+		device->common.userData=(void *)(uintptr_t)userData;
+
+		if (type==KernelFsDeviceTypeBlock) {
+			if (!snapshotRead(file, &device->block.size, sizeof(device->block.size)) ||
+			    !snapshotRead(file, &device->block.format, sizeof(device->block.format))) {
+				success=false;
+				break;
+			}
+		}
+
+		// If boot added a device at the same mount point then use its functor and user data instead, as the latter may be a pointer
+		for(KernelFsDeviceIndex j=0; j<KernelFsDevicesMax; ++j) {
+			KernelFsDevice *bootDevice=&bootDevices[j];
+			if (bootDevice->common.type==KernelFsDeviceTypeNB || kstrDoubleStrcmp(bootDevice->common.mountPoint, mountPoint)!=0)
+				continue;
+
+			device->common.functor=bootDevice->common.functor;
+			device->common.userData=bootDevice->common.userData;
+			kstrFree(&bootDevice->common.mountPoint);
+			bootDevice->common.type=KernelFsDeviceTypeNB;
+			break;
+		}
+	}
+
+	// Keep any devices added during boot which were not in the snapshot
+	for(KernelFsDeviceIndex j=0; j<KernelFsDevicesMax; ++j) {
+		KernelFsDevice *bootDevice=&bootDevices[j];
+		if (bootDevice->common.type==KernelFsDeviceTypeNB)
+			continue;
+
+		KernelFsDeviceIndex i;
+		for(i=0; i<KernelFsDevicesMax; ++i)
+			if (kernelFsData.devices[i].common.type==KernelFsDeviceTypeNB)
+				break;
+		if (success && i<KernelFsDevicesMax)
+			kernelFsData.devices[i]=*bootDevice;
+		else {
+			kstrFree(&bootDevice->common.mountPoint);
+			success=false;
+		}
+	}
+	free(bootDevices);
+
+	if (!success)
+		return false;
+
+	// Restore file descriptor table
+	for(KernelFsFd fd=0; fd<KernelFsFdMax; ++fd) {
+		KernelFsFdtEntry *entry=&kernelFsData.fdt[fd];
+		if (!snapshotReadKStr(file, &entry->path))
+			return false;
+		if (kstrIsNull(entry->path))
+			continue;
+
+		uint8_t spare;
+		if (!snapshotRead(file, &spare, sizeof(spare)) ||
+		    !snapshotRead(file, &entry->deviceIndex, sizeof(entry->deviceIndex)) ||
+		    !snapshotRead(file, &entry->dirCursor, sizeof(entry->dirCursor)))
+			return false;
+		if (entry->deviceIndex>=KernelFsDevicesMax || kernelFsData.devices[entry->deviceIndex].common.type==KernelFsDeviceTypeNB)
+			return false;
+		kstrSetSpare(&entry->path, spare);
+	}
+
+	// Drop anything cached against the old device indexes, and invalidate any cached path lookups
+	for(uint8_t i=0; i<KernelFsBlockCacheSize; ++i)
+		kernelFsData.blockCache[i].deviceIndex=KernelFsDevicesMax;
+	for(uint8_t i=0; i<KernelFsMiniFsIndexMax; ++i)
+		kernelFsData.miniFsIndexes[i].deviceIndex=KernelFsDevicesMax;
+	kernelFsData.generation=generation+1;
+
+	return true;
+}
+#endif
+
+uint16_t kernelFsGetGeneration(void) {
+	return kernelFsData.generation;
+}
+
+uint16_t kernelFsGetDirGenerationToken(const char *dirPath) {
+	assert(dirPath!=NULL);
+
+	KernelFsDevice *device=kernelFsGetDeviceFromPathRecursive(dirPath, NULL);
+	if (device==NULL)
+		return KernelFsDirGenerationTokenNoDevice;
+
+	return (((uint16_t)kernelFsGetDeviceIndexFromDevice(device))<<8)|device->common.generation;
+}
+
+bool kernelFsDirGenerationTokenIsCurrent(uint16_t token) {
+	// Only devices being added or removed can change whether a path has a device (and this is covered by kernelFsGetGeneration)
+	if (token==KernelFsDirGenerationTokenNoDevice)
+		return true;
+
+	KernelFsDeviceIndex deviceIndex=(token>>8);
+	assert(deviceIndex<KernelFsDevicesMax);
+	return (kernelFsData.devices[deviceIndex].common.generation==(token&255));
+}
+
 bool kernelFsAddCharacterDeviceFile(KStr mountPoint, KernelFsDeviceFunctor *functor, void *userData, bool canOpenMany, bool writable) {
 	assert(!kstrIsNull(mountPoint));
 	assert(functor!=NULL);
@@ -202,6 +483,11 @@ bool kernelFsAddBlockDeviceFile(KStr mountPoint, KernelFsDeviceFunctor *functor,
 
 	// Attempt to mount
 	switch(format) {
+		case KernelFsBlockDeviceFormatCompressedMiniFs:
+			// Compressed volumes are always read-only
+			if (writable || !miniFsCompressIsVolume(&kernelFsDeviceRawReadWrapper, device))
+				goto error;
+			// fall through to mount the decompressed MiniFs volume
 		case KernelFsBlockDeviceFormatCustomMiniFs: {
 			MiniFs miniFs;
 			if (!miniFsMountSafe(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), device))
@@ -245,8 +531,10 @@ bool kernelFsUpdateBlockDeviceFile(KStr mountPoint, KernelFsDeviceFunctor *funct
 	if (device==NULL)
 		return false;
 
-	// Update device fields
+	// Update device fields (any cached decompressed data is now out of date)
 	KernelFsDevice oldDevice=*device;
+	kernelFsBlockCacheInvalidateDevice(kernelFsGetDeviceIndexFromDevice(device));
+	kernelFsMiniFsIndexRelease(kernelFsGetDeviceIndexFromDevice(device));
 
 	device->common.functor=functor;
 	device->common.userData=userData;
@@ -256,8 +544,17 @@ bool kernelFsUpdateBlockDeviceFile(KStr mountPoint, KernelFsDeviceFunctor *funct
 	device->block.format=format;
 	device->block.size=size;
 
+	// Contents and writability may have changed, so invalidate any path lookups, direct mappings and directory tokens referring to this device
+	++device->common.generation;
+	++kernelFsData.generation;
+
 	// Attempt to mount
 	switch(format) {
+		case KernelFsBlockDeviceFormatCompressedMiniFs:
+			// Compressed volumes are always read-only
+			if (writable || !miniFsCompressIsVolume(&kernelFsDeviceRawReadWrapper, device))
+				goto error;
+			// fall through to mount the decompressed MiniFs volume
 		case KernelFsBlockDeviceFormatCustomMiniFs: {
 			MiniFs miniFs;
 			if (!miniFsMountSafe(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), device))
@@ -287,6 +584,44 @@ bool kernelFsUpdateBlockDeviceFile(KStr mountPoint, KernelFsDeviceFunctor *funct
 	return false;
 }
 
+bool kernelFsDeviceGetFreeSpaceStats(const char *mountPoint, uint16_t *freeSize, uint16_t *largestFreeRegionSize) {
+	assert(mountPoint!=NULL);
+	assert(freeSize!=NULL);
+	assert(largestFreeRegionSize!=NULL);
+
+	KernelFsDevice *device=kernelFsGetDeviceFromPath(mountPoint);
+	if (device==NULL || device->common.type!=KernelFsDeviceTypeBlock || (device->block.format!=KernelFsBlockDeviceFormatCustomMiniFs && device->block.format!=KernelFsBlockDeviceFormatCompressedMiniFs))
+		return false;
+
+	MiniFs miniFs;
+	kernelFsDeviceMiniFsMountFast(&miniFs, device, false);
+	miniFsGetFreeSpaceStats(&miniFs, freeSize, largestFreeRegionSize);
+	miniFsUnmount(&miniFs);
+
+	return true;
+}
+
+bool kernelFsDeviceCompactStep(const char *mountPoint) {
+	assert(mountPoint!=NULL);
+
+	KernelFsDevice *device=kernelFsGetDeviceFromPath(mountPoint);
+	if (device==NULL || device->common.type!=KernelFsDeviceTypeBlock || device->block.format!=KernelFsBlockDeviceFormatCustomMiniFs || !device->common.writable)
+		return false;
+
+	MiniFs miniFs;
+	kernelFsDeviceMiniFsMountFast(&miniFs, device, true);
+	bool res=kernelFsMiniFsCompact(&miniFs, false);
+	miniFsUnmount(&miniFs);
+
+	return res;
+}
+
+void kernelFsGetCompactStats(KernelFsCompactStats *stats) {
+	assert(stats!=NULL);
+
+	*stats=kernelFsData.compactStats;
+}
+
 void *kernelFsDeviceFileGetUserData(const char *mountPoint) {
 	assert(mountPoint!=NULL);
 
@@ -320,9 +655,10 @@ bool kernelFsFileExistsKStr(KStr path) {
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs: {
 						MiniFs miniFs;
-						miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (device->common.writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), device);
+						kernelFsDeviceMiniFsMountFast(&miniFs, device, device->common.writable);
 						bool res=miniFsFileExists(&miniFs, basename);
 						miniFsUnmount(&miniFs);
 						return res;
@@ -432,6 +768,7 @@ KernelFsFileOffset kernelFsFileGetLen(const char *path) {
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs:
 						// These act as directories at the top level (we check below for child)
 						return 0;
@@ -470,9 +807,10 @@ KernelFsFileOffset kernelFsFileGetLen(const char *path) {
 		switch(parentDevice->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(parentDevice->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs: {
 						MiniFs miniFs;
-						miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (parentDevice->common.writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), parentDevice);
+						kernelFsDeviceMiniFsMountFast(&miniFs, parentDevice, parentDevice->common.writable);
 						KernelFsFileOffset res=miniFsFileGetLen(&miniFs, basename);
 						miniFsUnmount(&miniFs);
 						return res;
@@ -527,15 +865,20 @@ bool kernelFsFileCreateWithSize(const char *path, KernelFsFileOffset size) {
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs: {
 						// In theory we can create files on a MiniFs if it is not mounted read only
 						bool res=false;
 						if (device->common.writable) {
 							MiniFs miniFs;
-							miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, &kernelFsDeviceMiniFsWriteWrapper, device);
+							kernelFsDeviceMiniFsMountFast(&miniFs, device, true);
 							res=miniFsFileCreate(&miniFs, basename, size);
+							if (!res && kernelFsMiniFsCompact(&miniFs, true)) // failure may be due to fragmentation
+								res=miniFsFileCreate(&miniFs, basename, size);
 							miniFsUnmount(&miniFs);
 						}
+						if (res)
+							kernelFsDeviceBumpGeneration(device);
 						return res;
 					} break;
 					case KernelFsBlockDeviceFormatFlatFile:
@@ -586,6 +929,7 @@ bool kernelFsFileDelete(const char *path) {
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs:
 						// Nothing to do - we don't keep the volume mounted as mounting is free
 					break;
@@ -625,11 +969,14 @@ bool kernelFsFileDelete(const char *path) {
 		switch(parentDevice->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(parentDevice->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs: {
 						MiniFs miniFs;
-						miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (parentDevice->common.writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), parentDevice);
+						kernelFsDeviceMiniFsMountFast(&miniFs, parentDevice, parentDevice->common.writable);
 						bool res=miniFsFileDelete(&miniFs, basename);
 						miniFsUnmount(&miniFs);
+						if (res)
+							kernelFsDeviceBumpGeneration(parentDevice);
 						return res;
 					} break;
 					case KernelFsBlockDeviceFormatFlatFile:
@@ -712,12 +1059,15 @@ bool kernelFsFileResize(const char *path, KernelFsFileOffset newSize) {
 		switch(parentDevice->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(parentDevice->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs: {
 						if (newSize>=UINT16_MAX)
 							return false; // minifs limits files to 64kb
 						MiniFs miniFs;
-						miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (parentDevice->common.writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), parentDevice);
+						kernelFsDeviceMiniFsMountFast(&miniFs, parentDevice, parentDevice->common.writable);
 						bool res=miniFsFileResize(&miniFs, basename, newSize);
+						if (!res && kernelFsMiniFsCompact(&miniFs, true)) // failure may be due to fragmentation
+							res=miniFsFileResize(&miniFs, basename, newSize);
 						miniFsUnmount(&miniFs);
 						return res;
 					} break;
@@ -796,6 +1146,7 @@ KernelFsFd kernelFsFileOpen(const char *path, KernelFsFdMode mode) {
 	}
 
 	kernelFsData.fdt[newFd].deviceIndex=kernelFsGetDeviceIndexFromDevice(device);
+	kernelFsData.fdt[newFd].dirCursor=0;
 
 	return newFd;
 }
@@ -851,6 +1202,7 @@ unsigned kernelFsFileClose(KernelFsFd fd) {
 	if (refCount==0) {
 		kstrFree(&kernelFsData.fdt[fd].path);
 		kernelFsData.fdt[fd].deviceIndex=KernelFsDevicesMax;
+		kernelFsData.fdt[fd].dirCursor=0;
 	}
 
 	return refCount;
@@ -914,6 +1266,7 @@ KernelFsFileOffset kernelFsFileReadOffset(KernelFsFd fd, KernelFsFileOffset offs
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs:
 						// These act as directories at the top level (we check below for child)
 						return 0;
@@ -960,13 +1313,14 @@ KernelFsFileOffset kernelFsFileReadOffset(KernelFsFd fd, KernelFsFileOffset offs
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs: {
 						if (offset>=UINT16_MAX)
 							return 0;
 						if (dataLen>=UINT16_MAX)
 							dataLen=UINT16_MAX;
 						MiniFs miniFs;
-						miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (device->common.writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), device);
+						kernelFsDeviceMiniFsMountFast(&miniFs, device, device->common.writable);
 						uint16_t read=miniFsFileReadKStr(&miniFs, subPath, offset, data, dataLen);
 						miniFsUnmount(&miniFs);
 						return read;
@@ -1033,6 +1387,92 @@ bool kernelFsFileCanRead(KernelFsFd fd) {
 	return true;
 }
 
+bool kernelFsFileCanReadAt(KernelFsFd fd, KernelFsFileOffset offset) {
+	assert(fd<KernelFsFdMax);
+
+	// Invalid fd?
+	if (kstrIsNull(kernelFsData.fdt[fd].path))
+		return true;
+
+	// Is this a flat block device file? (files within block devices map offsets to device addresses in their own ways, so these are read synchronously)
+	KernelFsDevice *device=&kernelFsData.devices[kernelFsData.fdt[fd].deviceIndex];
+	if (kstrDoubleStrcmp(kernelFsData.fdt[fd].path, device->common.mountPoint)==0 && device->common.type==KernelFsDeviceTypeBlock && device->block.format==KernelFsBlockDeviceFormatFlatFile)
+		return kernelFsDeviceInvokeFunctorBlockCanRead(device, offset);
+
+	return true;
+}
+
+bool kernelFsFileGetMapping(KernelFsFd fd, KernelFsFileMapping *mapping) {
+	assert(fd<KernelFsFdMax);
+	assert(mapping!=NULL);
+
+	// Invalid fd?
+	if (kstrIsNull(kernelFsData.fdt[fd].path))
+		return false;
+
+	// Bad mode?
+	if (!(kernelFsGetFileMode(fd) & KernelFsFdModeRO))
+		return false;
+
+	// Only block devices which are read-only can be mapped (otherwise data could move underneath us)
+	KernelFsDevice *device=&kernelFsData.devices[kernelFsData.fdt[fd].deviceIndex];
+	if (device->common.type!=KernelFsDeviceTypeBlock || device->common.writable)
+		return false;
+
+	mapping->deviceIndex=kernelFsData.fdt[fd].deviceIndex;
+	mapping->generation=kernelFsData.generation;
+
+	if (kstrDoubleStrcmp(kernelFsData.fdt[fd].path, device->common.mountPoint)==0) {
+		// This fd IS the device - only flat files can be mapped as a whole
+		if (device->block.format!=KernelFsBlockDeviceFormatFlatFile)
+			return false;
+
+		mapping->base=0;
+		mapping->len=device->block.size;
+		return true;
+	}
+
+	// This fd is a child of the device - only MiniFs volumes (which store files contiguously) are supported
+	if (device->block.format!=KernelFsBlockDeviceFormatCustomMiniFs)
+		return false;
+
+	KStr subPath=kstrO(&kernelFsData.fdt[fd].path, kstrStrlen(device->common.mountPoint)+1); // +1 to skip '/' also
+
+	MiniFs miniFs;
+	kernelFsDeviceMiniFsMountFast(&miniFs, device, false);
+	uint16_t contentOffset, contentLen;
+	bool res=miniFsFileGetContentRangeKStr(&miniFs, subPath, &contentOffset, &contentLen);
+	miniFsUnmount(&miniFs);
+	if (!res)
+		return false;
+
+	mapping->base=contentOffset;
+	mapping->len=contentLen;
+	return true;
+}
+
+KernelFsFileOffset kernelFsFileMappingRead(const KernelFsFileMapping *mapping, KernelFsFileOffset offset, uint8_t *data, KernelFsFileOffset dataLen) {
+	assert(mapping!=NULL);
+	assert(mapping->generation==kernelFsData.generation);
+	assert(mapping->deviceIndex<KernelFsDevicesMax);
+	assert(data!=NULL);
+
+	// Check offset against length
+	if (offset>=mapping->len)
+		return 0;
+	if (dataLen>mapping->len-offset)
+		dataLen=mapping->len-offset;
+
+	return kernelFsDeviceInvokeFunctorBlockRead(&kernelFsData.devices[mapping->deviceIndex], data, dataLen, mapping->base+offset);
+}
+
+bool kernelFsFileMappingEqual(const KernelFsFileMapping *a, const KernelFsFileMapping *b) {
+	assert(a!=NULL);
+	assert(b!=NULL);
+
+	return (a->deviceIndex==b->deviceIndex && a->base==b->base && a->len==b->len && a->generation==b->generation);
+}
+
 bool kernelFsFileReadByte(KernelFsFd fd, KernelFsFileOffset offset, uint8_t *value) {
 	assert(fd<KernelFsFdMax);
 	assert(value!=NULL);
@@ -1093,10 +1533,14 @@ KernelFsFileOffset kernelFsFileWriteOffset(KernelFsFd fd, KernelFsFileOffset off
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs:
 						// These act as directories at the top level (we check below for child)
 					break;
 					case KernelFsBlockDeviceFormatFlatFile:
+						// A raw write (rather than one made on behalf of a MiniFs volume stored in this file) may modify a volume behind the back of its index
+						if (kernelFsData.miniFsWriteDepth==0)
+							kernelFsMiniFsIndexInvalidateAll();
 						return kernelFsDeviceInvokeFunctorBlockWrite(device, data, dataLen, offset);
 					break;
 					case KernelFsBlockDeviceFormatFat:
@@ -1137,13 +1581,14 @@ KernelFsFileOffset kernelFsFileWriteOffset(KernelFsFd fd, KernelFsFileOffset off
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs: {
 						if (offset>=UINT16_MAX)
 							return false;
 						if (dataLen>=UINT16_MAX)
 							dataLen=UINT16_MAX;
 						MiniFs miniFs;
-						miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, &kernelFsDeviceMiniFsWriteWrapper, device);
+						kernelFsDeviceMiniFsMountFast(&miniFs, device, true);
 						KernelFsFileOffset res=miniFsFileWrite(&miniFs, basename, offset, data, dataLen);
 						miniFsUnmount(&miniFs);
 						return res;
@@ -1230,6 +1675,32 @@ bool kernelFsFileWriteDoubleWord(KernelFsFd fd, KernelFsFileOffset offset, uint3
 bool kernelFsDirectoryGetChild(KernelFsFd fd, unsigned childNum, char childPath[KernelFsPathMax]) {
 	assert(fd<KernelFsFdMax);
 
+	uint16_t cursor=0;
+	return kernelFsDirectoryGetChildFromCursor(fd, &cursor, childNum, childPath);
+}
+
+bool kernelFsDirectoryGetNextChild(KernelFsFd fd, char childPath[KernelFsPathMax]) {
+	assert(fd<KernelFsFdMax);
+
+	return kernelFsDirectoryGetChildFromCursor(fd, &kernelFsData.fdt[fd].dirCursor, 0, childPath);
+}
+
+uint16_t kernelFsDirectoryGetCursor(KernelFsFd fd) {
+	assert(fd<KernelFsFdMax);
+
+	return kernelFsData.fdt[fd].dirCursor;
+}
+
+void kernelFsDirectorySetCursor(KernelFsFd fd, uint16_t cursor) {
+	assert(fd<KernelFsFdMax);
+
+	kernelFsData.fdt[fd].dirCursor=cursor;
+}
+
+bool kernelFsDirectoryGetChildFromCursor(KernelFsFd fd, uint16_t *cursor, unsigned skip, char childPath[KernelFsPathMax]) {
+	assert(fd<KernelFsFdMax);
+	assert(cursor!=NULL);
+
 	// Invalid fd?
 	if (kstrIsNull(kernelFsData.fdt[fd].path))
 		return false;
@@ -1247,24 +1718,27 @@ bool kernelFsDirectoryGetChild(KernelFsFd fd, unsigned childNum, char childPath[
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs: {
 						MiniFs miniFs;
-						miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (device->common.writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), device);
+						kernelFsDeviceMiniFsMountFast(&miniFs, device, device->common.writable);
 
-						KernelFsFd j=0;
-						for(KernelFsFd i=0; i<MINIFSMAXFILES; ++i) {
+						// Cursor is the next slot to check
+						for(uint16_t i=*cursor; i<MINIFSMAXFILES; ++i) {
 							kstrStrcpy(childPath, kernelFsData.fdt[fd].path);
 							strcat(childPath, "/");
 							bool res=miniFsGetChildN(&miniFs, i, childPath+strlen(childPath));
 							if (!res)
 								continue;
-							if (j==childNum) {
+							if (skip==0) {
+								*cursor=i+1;
 								miniFsUnmount(&miniFs);
 								return true;
 							}
-							++j;
+							--skip;
 						}
 
+						*cursor=MINIFSMAXFILES;
 						miniFsUnmount(&miniFs);
 						return false;
 					} break;
@@ -1280,7 +1754,7 @@ bool kernelFsDirectoryGetChild(KernelFsFd fd, unsigned childNum, char childPath[
 						kstrStrcpy(childPath, kernelFsData.fdt[fd].path);
 						strcat(childPath, "/");
 
-						bool res=fatDirGetChildN(&fat, kstrS((char *)""), childNum, childPath+strlen(childPath));
+						bool res=fatDirGetChildFromCursor(&fat, kstrS((char *)""), cursor, skip, childPath+strlen(childPath));
 
 						fatUnmount(&fat);
 
@@ -1297,22 +1771,23 @@ bool kernelFsDirectoryGetChild(KernelFsFd fd, unsigned childNum, char childPath[
 				return false;
 			} break;
 			case KernelFsDeviceTypeDirectory: {
-				// Check for virtual devices as children
-				uint8_t foundCount=0;
-				for(uint8_t i=0; i<KernelFsDevicesMax; ++i) {
+				// Check for virtual devices as children (cursor is the next device index to check)
+				for(uint16_t i=*cursor; i<KernelFsDevicesMax; ++i) {
 					KernelFsDevice *childDevice=&kernelFsData.devices[i];
 					if (childDevice->common.type==KernelFsDeviceTypeNB)
 						continue;
 
 					kstrStrcpy(childPath, kernelFsData.fdt[fd].path); // Borrow childPath as a generic buffer temporarily
 					if (kernelFsDeviceIsChildOfPath(childDevice, childPath)) {
-						if (foundCount==childNum) {
+						if (skip==0) {
+							*cursor=i+1;
 							kstrStrcpy(childPath, childDevice->common.mountPoint);
 							return true;
 						}
-						++foundCount;
+						--skip;
 					}
 				}
+				*cursor=KernelFsDevicesMax;
 			} break;
 			case KernelFsDeviceTypeNB:
 			break;
@@ -1326,6 +1801,7 @@ bool kernelFsDirectoryGetChild(KernelFsFd fd, unsigned childNum, char childPath[
 		switch(device->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(device->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs:
 						// MiniFs volumes do not support sub-directories
 						return false;
@@ -1342,7 +1818,7 @@ bool kernelFsDirectoryGetChild(KernelFsFd fd, unsigned childNum, char childPath[
 						kstrStrcpy(childPath, kernelFsData.fdt[fd].path);
 						strcat(childPath, "/");
 
-						bool res=fatDirGetChildN(&fat, subPath, childNum, childPath+strlen(childPath));
+						bool res=fatDirGetChildFromCursor(&fat, subPath, cursor, skip, childPath+strlen(childPath));
 
 						fatUnmount(&fat);
 
@@ -1543,6 +2019,7 @@ bool kernelFsFileCanOpenMany(const char *path) {
 		switch(parentDevice->common.type) {
 			case KernelFsDeviceTypeBlock:
 				switch(parentDevice->block.format) {
+					case KernelFsBlockDeviceFormatCompressedMiniFs:
 					case KernelFsBlockDeviceFormatCustomMiniFs:
 						return !parentDevice->common.writable;
 					break;
@@ -1610,8 +2087,8 @@ KernelFsDevice *kernelFsGetDeviceFromPathRecursive(const char *path, char **subP
 		if (matchLen>bestMatchLen) {
 			unsigned deviceMountPointLen=kstrStrlen(device->common.mountPoint);
 
-			// Check if this device is a child of the file in the path (rather than the file's parent device)
-			if (pathLen<deviceMountPointLen)
+			// Check the whole of the device's mount point matches, ending at a path separator (otherwise the device is a child of the file in the path, or a sibling which merely shares a prefix, e.g. '/media/ab' vs '/media/ac')
+			if (matchLen<deviceMountPointLen || (deviceMountPointLen>1 && path[deviceMountPointLen]!='\0' && path[deviceMountPointLen]!='/'))
 				continue;
 
 			// Update best
@@ -1654,8 +2131,8 @@ KernelFsDevice *kernelFsGetDeviceFromPathRecursiveKStr(KStr path, KStr *subPath)
 		if (matchLen>bestMatchLen) {
 			unsigned deviceMountPointLen=kstrStrlen(device->common.mountPoint);
 
-			// Check if this device is a child of the file in the path (rather than the file's parent device)
-			if (pathLen<deviceMountPointLen)
+			// Check the whole of the device's mount point matches, ending at a path separator (see kernelFsGetDeviceFromPathRecursive)
+			if (matchLen<deviceMountPointLen || (deviceMountPointLen>1 && kstrGetChar(path, deviceMountPointLen)!='\0' && kstrGetChar(path, deviceMountPointLen)!='/'))
 				continue;
 
 			// Update best
@@ -1716,6 +2193,9 @@ KernelFsDevice *kernelFsAddDeviceFile(KStr mountPoint, KernelFsDeviceFunctor *fu
 		device->common.userData=userData;
 		device->common.type=type;
 		device->common.writable=writable;
+		device->common.generation=0;
+
+		++kernelFsData.generation;
 
 		return device;
 	}
@@ -1734,6 +2214,19 @@ void kernelFsRemoveDeviceFileRaw(KernelFsDevice *device) {
 	device->common.type=KernelFsDeviceTypeNB;
 	kstrFree(&device->common.mountPoint);
 	device->common.mountPoint=kstrNull();
+
+	kernelFsBlockCacheInvalidateDevice(kernelFsGetDeviceIndexFromDevice(device));
+	kernelFsMiniFsIndexRelease(kernelFsGetDeviceIndexFromDevice(device));
+
+	++kernelFsData.generation;
+}
+
+void kernelFsDeviceBumpGeneration(KernelFsDevice *device) {
+	assert(device!=NULL);
+
+	// On wrapping around old dir generation tokens could appear current again, so also bump the global generation (which invalidates them all)
+	if (++device->common.generation==0)
+		++kernelFsData.generation;
 }
 
 bool kernelFsDeviceIsChildOfPath(KernelFsDevice *device, const char *parentDir) {
@@ -1768,6 +2261,7 @@ bool kernelFsDeviceIsDir(const KernelFsDevice *device, const char *subPath) {
 	switch(device->common.type) {
 		case KernelFsDeviceTypeBlock:
 			switch(device->block.format) {
+				case KernelFsBlockDeviceFormatCompressedMiniFs:
 				case KernelFsBlockDeviceFormatCustomMiniFs:
 					// Device itself is a directory but such volumes cannot contain sub-directories
 					return isRoot;
@@ -1819,12 +2313,13 @@ bool kernelFsDeviceIsDirEmpty(const KernelFsDevice *device, const char *subPath)
 	switch(device->common.type) {
 		case KernelFsDeviceTypeBlock:
 			switch(device->block.format) {
+				case KernelFsBlockDeviceFormatCompressedMiniFs:
 				case KernelFsBlockDeviceFormatCustomMiniFs: {
 					if (!isRoot)
 						return false;
 
 					MiniFs miniFs;
-					miniFsMountFast(&miniFs, &kernelFsDeviceMiniFsReadWrapper, (device->common.writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), (KernelFsDevice *)device);
+					kernelFsDeviceMiniFsMountFast(&miniFs, (KernelFsDevice *)device, device->common.writable);
 					bool res=miniFsIsEmpty(&miniFs);
 					miniFsUnmount(&miniFs);
 					return res;
@@ -1908,6 +2403,10 @@ KernelFsFileOffset kernelFsDeviceInvokeFunctorBlockWrite(KernelFsDevice *device,
 	return (KernelFsFileOffset)device->common.functor(KernelFsDeviceFunctorTypeBlockWrite, device->common.userData, (uint8_t *)data, len, addr);
 }
 
+bool kernelFsDeviceInvokeFunctorBlockCanRead(KernelFsDevice *device, KernelFsFileOffset addr) {
+	return (bool)device->common.functor(KernelFsDeviceFunctorTypeBlockCanRead, device->common.userData, NULL, 0, addr);
+}
+
 uint8_t kernelFsFdPathSpareMake(KernelFsFdMode mode, unsigned refCount) {
 	if (mode==KernelFsFdModeNone || mode>=KernelFsFdModeMax)
 		return 0;
@@ -1953,11 +2452,75 @@ uint16_t kernelFsDeviceMiniFsReadWrapper(uint16_t addr, uint8_t *data, uint16_t
 
 	KernelFsDevice *device=(KernelFsDevice *)userData;
 	assert(device->common.type==KernelFsDeviceTypeBlock);
-	assert(device->block.format==KernelFsBlockDeviceFormatCustomMiniFs);
+	assert(device->block.format==KernelFsBlockDeviceFormatCustomMiniFs || device->block.format==KernelFsBlockDeviceFormatCompressedMiniFs);
+
+	if (device->block.format==KernelFsBlockDeviceFormatCompressedMiniFs)
+		return kernelFsBlockCacheRead(device, addr, data, len);
 
 	return kernelFsDeviceInvokeFunctorBlockRead(device, data, len, addr);
 }
 
+uint16_t kernelFsDeviceRawReadWrapper(uint16_t addr, uint8_t *data, uint16_t len, void *userData) {
+	assert(data!=NULL);
+	assert(userData!=NULL);
+
+	KernelFsDevice *device=(KernelFsDevice *)userData;
+	assert(device->common.type==KernelFsDeviceTypeBlock);
+
+	return kernelFsDeviceInvokeFunctorBlockRead(device, data, len, addr);
+}
+
+uint16_t kernelFsBlockCacheRead(KernelFsDevice *device, uint16_t addr, uint8_t *data, uint16_t len) {
+	assert(device!=NULL);
+	assert(device->block.format==KernelFsBlockDeviceFormatCompressedMiniFs);
+	assert(data!=NULL);
+
+	KernelFsDeviceIndex deviceIndex=kernelFsGetDeviceIndexFromDevice(device);
+
+	uint16_t read=0;
+	while(read<len) {
+		uint8_t blockIndex=(addr+read)/MINIFSCOMPRESSBLOCKSIZE;
+		uint16_t blockOffset=(addr+read)%MINIFSCOMPRESSBLOCKSIZE;
+
+		// Look for block in cache, otherwise decompress it into the next entry
+		KernelFsBlockCacheEntry *entry=NULL;
+		for(uint8_t i=0; i<KernelFsBlockCacheSize; ++i) {
+			if (kernelFsData.blockCache[i].deviceIndex==deviceIndex && kernelFsData.blockCache[i].blockIndex==blockIndex) {
+				entry=&kernelFsData.blockCache[i];
+				break;
+			}
+		}
+		if (entry==NULL) {
+			entry=&kernelFsData.blockCache[kernelFsData.blockCacheNext];
+			kernelFsData.blockCacheNext=(kernelFsData.blockCacheNext+1)%KernelFsBlockCacheSize;
+
+			entry->deviceIndex=KernelFsDevicesMax;
+			entry->len=miniFsCompressReadBlock(&kernelFsDeviceRawReadWrapper, device, blockIndex, entry->data);
+			if (entry->len==0)
+				break;
+			entry->deviceIndex=deviceIndex;
+			entry->blockIndex=blockIndex;
+		}
+
+		// Copy as much as we can from this block
+		if (blockOffset>=entry->len)
+			break;
+		uint16_t chunk=entry->len-blockOffset;
+		if (chunk>len-read)
+			chunk=len-read;
+		memcpy(data+read, entry->data+blockOffset, chunk);
+		read+=chunk;
+	}
+
+	return read;
+}
+
+void kernelFsBlockCacheInvalidateDevice(KernelFsDeviceIndex deviceIndex) {
+	for(uint8_t i=0; i<KernelFsBlockCacheSize; ++i)
+		if (kernelFsData.blockCache[i].deviceIndex==deviceIndex)
+			kernelFsData.blockCache[i].deviceIndex=KernelFsDevicesMax;
+}
+
 uint16_t kernelFsDeviceMiniFsWriteWrapper(uint16_t addr, const uint8_t *data, uint16_t len, void *userData) {
 	assert(data!=NULL);
 	assert(userData!=NULL);
@@ -1967,7 +2530,76 @@ uint16_t kernelFsDeviceMiniFsWriteWrapper(uint16_t addr, const uint8_t *data, ui
 	assert(device->block.format==KernelFsBlockDeviceFormatCustomMiniFs);
 	assert(device->common.writable);
 
-	return kernelFsDeviceInvokeFunctorBlockWrite(device, data, len, addr);
+	++kernelFsData.miniFsWriteDepth;
+	uint16_t res=kernelFsDeviceInvokeFunctorBlockWrite(device, data, len, addr);
+	--kernelFsData.miniFsWriteDepth;
+	return res;
+}
+
+void kernelFsDeviceMiniFsMountFast(MiniFs *miniFs, KernelFsDevice *device, bool writable) {
+	assert(miniFs!=NULL);
+	assert(device!=NULL);
+
+	miniFsMountFast(miniFs, &kernelFsDeviceMiniFsReadWrapper, (writable ? &kernelFsDeviceMiniFsWriteWrapper : NULL), device);
+
+	if (device->common.writable) {
+		MiniFsIndex *index=kernelFsMiniFsIndexGet(kernelFsGetDeviceIndexFromDevice(device));
+		if (index!=NULL)
+			miniFsSetIndex(miniFs, index);
+	}
+}
+
+MiniFsIndex *kernelFsMiniFsIndexGet(KernelFsDeviceIndex deviceIndex) {
+	// Look for existing index for this device, or failing that a free one to claim
+	KernelFsMiniFsIndexEntry *freeEntry=NULL;
+	for(uint8_t i=0; i<KernelFsMiniFsIndexMax; ++i) {
+		KernelFsMiniFsIndexEntry *entry=&kernelFsData.miniFsIndexes[i];
+		if (entry->deviceIndex==deviceIndex)
+			return &entry->index;
+		if (entry->deviceIndex==KernelFsDevicesMax && freeEntry==NULL)
+			freeEntry=entry;
+	}
+
+	if (freeEntry==NULL)
+		return NULL;
+
+	freeEntry->deviceIndex=deviceIndex;
+	miniFsIndexClear(&freeEntry->index);
+	return &freeEntry->index;
+}
+
+void kernelFsMiniFsIndexRelease(KernelFsDeviceIndex deviceIndex) {
+	for(uint8_t i=0; i<KernelFsMiniFsIndexMax; ++i)
+		if (kernelFsData.miniFsIndexes[i].deviceIndex==deviceIndex)
+			kernelFsData.miniFsIndexes[i].deviceIndex=KernelFsDevicesMax;
+}
+
+bool kernelFsMiniFsCompact(MiniFs *miniFs, bool full) {
+	assert(miniFs!=NULL);
+
+	KTime startTime=ktimeGetMonotonicMs();
+
+	uint16_t moved=0;
+	while(miniFsCompactStep(miniFs)) {
+		++moved;
+		if (!full)
+			break;
+	}
+
+	kernelFsData.compactStats.steps+=moved;
+	kernelFsData.compactStats.timeMs+=ktimeGetMonotonicMs()-startTime;
+	if (full && moved>0) {
+		++kernelFsData.compactStats.onAllocFailureCount;
+		kernelLog(LogTypeInfo, kstrP("compacted MiniFs volume after allocation failure (%u files moved)\n"), moved);
+	}
+
+	return (moved>0);
+}
+
+void kernelFsMiniFsIndexInvalidateAll(void) {
+	// Keep assignments but force rebuilding on next use
+	for(uint8_t i=0; i<KernelFsMiniFsIndexMax; ++i)
+		miniFsIndexClear(&kernelFsData.miniFsIndexes[i].index);
 }
 
 uint32_t kernelFsFatReadWrapper(uint32_t addr, uint8_t *data, uint32_t len, void *userData) {
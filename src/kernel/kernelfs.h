@@ -29,12 +29,27 @@ typedef uint8_t KernelFsFdMode;
 #define KernelFsFdModeBits 2
 #define KernelFsFdModeMax ((1u)<<KernelFsFdModeBits)
 
+// A file mapping addresses the data of a file on a read-only device directly in the device's underlying storage,
+// skipping the path and volume lookups that kernelFsFileReadOffset has to do on every call.
+typedef struct {
+	KernelFsFileOffset base, len;
+	uint16_t generation; // value of kernelFsGetGeneration() when created - mapping should be refreshed if this changes
+	uint8_t deviceIndex;
+} KernelFsFileMapping;
+
+typedef struct {
+	uint32_t steps; // number of files moved
+	uint16_t onAllocFailureCount; // number of times a whole volume was compacted due to a failed create or resize
+	uint32_t timeMs; // total time spent compacting
+} KernelFsCompactStats;
+
 typedef uint8_t KernelFsBlockDeviceFormat;
 #define KernelFsBlockDeviceFormatCustomMiniFs 0
 #define KernelFsBlockDeviceFormatFlatFile 1
 #define KernelFsBlockDeviceFormatFat 2
-#define KernelFsBlockDeviceFormatNB 3
-#define KernelFsBlockDeviceFormatBits 2
+#define KernelFsBlockDeviceFormatCompressedMiniFs 3 // read-only, see minifscompress.h
+#define KernelFsBlockDeviceFormatNB 4
+#define KernelFsBlockDeviceFormatBits 3
 
 /*
 ..... still needed?
@@ -58,6 +73,7 @@ typedef enum {
 	// Block device functors
 	KernelFsDeviceFunctorTypeBlockRead, // typedef KernelFsFileOffset (KernelFsBlockDeviceReadFunctor)(KernelFsDeviceFunctorTypeBlockRead, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr); - returns -1 on failure
 	KernelFsDeviceFunctorTypeBlockWrite, // typedef KernelFsFileOffset (KernelFsBlockDeviceWriteFunctor)(KernelFsDeviceFunctorTypeBlockWrite, void *userData, const uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr);
+	KernelFsDeviceFunctorTypeBlockCanRead, // typedef bool (KernelFsBlockDeviceCanReadFunctor)(KernelFsDeviceFunctorTypeBlockCanRead, void *userData, KernelFsFileOffset addr); - returns false if reading at addr would have to wait for the device, in which case the device should start fetching the data in the background
 } KernelFsDeviceFunctorType;
 
 typedef uint32_t (KernelFsDeviceFunctor)(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr);
@@ -69,6 +85,22 @@ typedef uint32_t (KernelFsDeviceFunctor)(KernelFsDeviceFunctorType type, void *u
 void kernelFsInit(void);
 void kernelFsQuit(void);
 
+#ifndef ARDUINO
+// PC only: save/restore the device and file descriptor tables (see snapshot.h). Loading should happen once boot has added its devices, but before any files are opened.
+// Devices which boot added are matched up by mount point and keep their current functor and user data, while any others (such as those added by kernelMount) have their functor translated and user data restored as saved.
+bool kernelFsSnapshotSave(FILE *file);
+bool kernelFsSnapshotLoad(FILE *file);
+#endif
+
+// These allow caching the results of path lookups (such as searching PATH during exec).
+// The generation changes whenever a device is added or removed (e.g. mounting).
+// A dir generation token captures the state of the device containing the given directory,
+// and stays current until a file is created or deleted within that device (only meaningful while the generation is unchanged, which also changes if the token would wrap around).
+#define KernelFsDirGenerationTokenNoDevice 65535u
+uint16_t kernelFsGetGeneration(void);
+uint16_t kernelFsGetDirGenerationToken(const char *dirPath);
+bool kernelFsDirGenerationTokenIsCurrent(uint16_t token);
+
 ////////////////////////////////////////////////////////////////////////////////
 // Virtual device functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -84,6 +116,12 @@ bool kernelFsUpdateBlockDeviceFile(KStr mountPoint, KernelFsDeviceFunctor *funct
 
 void *kernelFsDeviceFileGetUserData(const char *mountPoint);
 
+// The following only apply to MiniFs volumes. Writable volumes are compacted automatically if a create or resize fails,
+// while kernelFsDeviceCompactStep allows doing this incrementally ahead of time.
+bool kernelFsDeviceGetFreeSpaceStats(const char *mountPoint, uint16_t *freeSize, uint16_t *largestFreeRegionSize);
+bool kernelFsDeviceCompactStep(const char *mountPoint); // moves at most one file to coalesce free space, returns false if there was nothing to do
+void kernelFsGetCompactStats(KernelFsCompactStats *stats);
+
 ////////////////////////////////////////////////////////////////////////////////
 // File functions -including directories (all paths are expected to be valid and normalised)
 ////////////////////////////////////////////////////////////////////////////////
@@ -121,6 +159,11 @@ KernelFsFdMode kernelFsGetFileMode(KernelFsFd fd); // returns KernelFsFdModeNone
 KernelFsFileOffset kernelFsFileRead(KernelFsFd fd, uint8_t *data, KernelFsFileOffset dataLen); // Returns number of bytes read
 KernelFsFileOffset kernelFsFileReadOffset(KernelFsFd fd, KernelFsFileOffset offset, uint8_t *data, KernelFsFileOffset dataLen); // offset is ignored for character device files. Returns number of bytes read.
 bool kernelFsFileCanRead(KernelFsFd fd); // character device files may return false if a read would block, all other files return true (as they never block)
+bool kernelFsFileCanReadAt(KernelFsFd fd, KernelFsFileOffset offset); // block device files may return false if the data at offset is still being fetched (the fetch is started if needed), all other files return true. Unlike kernelFsFileCanRead a false return does not mean a read would fail, only that it would have to wait.
+
+bool kernelFsFileGetMapping(KernelFsFd fd, KernelFsFileMapping *mapping); // only possible for files on read-only flat file or MiniFs block devices
+KernelFsFileOffset kernelFsFileMappingRead(const KernelFsFileMapping *mapping, KernelFsFileOffset offset, uint8_t *data, KernelFsFileOffset dataLen); // mapping must be current (see generation field). Returns number of bytes read
+bool kernelFsFileMappingEqual(const KernelFsFileMapping *a, const KernelFsFileMapping *b);
 
 bool kernelFsFileReadByte(KernelFsFd fd, KernelFsFileOffset offset, uint8_t *value);
 bool kernelFsFileReadWord(KernelFsFd fd, KernelFsFileOffset offset, uint16_t *value);
@@ -136,6 +179,10 @@ bool kernelFsFileWriteDoubleWord(KernelFsFd fd, KernelFsFileOffset offset, uint3
 
 // The following functions are for directory files only.
 bool kernelFsDirectoryGetChild(KernelFsFd fd, unsigned childNum, char childPath[KernelFsPathMax]);
+bool kernelFsDirectoryGetNextChild(KernelFsFd fd, char childPath[KernelFsPathMax]); // uses a cursor stored with the fd (reset to the first child on open), advancing it past the returned child - avoids the rescan required to find the nth child
+uint16_t kernelFsDirectoryGetCursor(KernelFsFd fd);
+void kernelFsDirectorySetCursor(KernelFsFd fd, uint16_t cursor); // cursor should be 0 or a value previously returned by kernelFsDirectoryGetCursor
+bool kernelFsDirectoryGetChildFromCursor(KernelFsFd fd, uint16_t *cursor, unsigned skip, char childPath[KernelFsPathMax]); // skips 'skip' children from cursor and then returns the next, updating cursor to point past it
 
 ////////////////////////////////////////////////////////////////////////////////
 // Path functions
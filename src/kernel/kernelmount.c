@@ -6,6 +6,7 @@
 #include "log.h"
 #include "minifs.h"
 #include "ptable.h"
+#include "snapshot.h"
 
 typedef struct {
 	uint8_t format;
@@ -345,6 +346,38 @@ bool kernelRemountWithBuffers(KernelMountFormat newFormat, const char *newDevice
 	return false;
 }
 
+#ifndef ARDUINO
+bool kernelMountSnapshotSave(FILE *file) {
+	assert(file!=NULL);
+
+	if (!snapshotWrite(file, &kernelMountedDevicesNext, sizeof(kernelMountedDevicesNext)))
+		return false;
+	for(uint8_t i=0; i<kernelMountedDevicesNext; ++i) {
+		if (!snapshotWrite(file, &kernelMountedDevices[i].format, sizeof(kernelMountedDevices[i].format)) ||
+		    !snapshotWrite(file, &kernelMountedDevices[i].fd, sizeof(kernelMountedDevices[i].fd)))
+			return false;
+	}
+
+	return true;
+}
+
+bool kernelMountSnapshotLoad(FILE *file) {
+	assert(file!=NULL);
+
+	uint8_t count;
+	if (!snapshotRead(file, &count, sizeof(count)) || count>kernelMountedDevicesMax)
+		return false;
+	for(uint8_t i=0; i<count; ++i) {
+		if (!snapshotRead(file, &kernelMountedDevices[i].format, sizeof(kernelMountedDevices[i].format)) ||
+		    !snapshotRead(file, &kernelMountedDevices[i].fd, sizeof(kernelMountedDevices[i].fd)))
+			return false;
+	}
+	kernelMountedDevicesNext=count;
+
+	return true;
+}
+#endif
+
 bool KernelMountFormatIsFile(KernelMountFormat format) {
 	switch(format) {
 		case KernelMountFormatMiniFs:
@@ -406,6 +439,9 @@ uint32_t kernelMountFsFunctor(KernelFsDeviceFunctorType type, void *userData, ui
 		case KernelFsDeviceFunctorTypeBlockWrite:
 			return kernelMountBlockWriteFunctor(addr, data, len, userData);
 		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+			return true; // never blocks
+		break;
 	}
 
 	assert(false);
@@ -23,6 +23,12 @@ void kernelUnmount(const char *dirPath);
 bool kernelRemount(KernelMountFormat newFormat, const char *newDevicePath, const char *dirPath);
 bool kernelRemountWithBuffers(KernelMountFormat newFormat, const char *newDevicePath, const char *dirPath, char *pathBuffer, uint8_t *copyBuffer); // like kernelRemount function but uses provided buffers to do the copying etc. The pathBuffer and copyBuffer must be able to contain at least KernelFsPathMax and kernelRemountBufferSize bytes, respectively.
 
+#ifndef ARDUINO
+// PC only: save/restore the table of mounted devices (see snapshot.h). The devices themselves are restored by kernelFsSnapshotLoad.
+bool kernelMountSnapshotSave(FILE *file);
+bool kernelMountSnapshotLoad(FILE *file);
+#endif
+
 bool KernelMountFormatIsFile(KernelMountFormat format);
 bool KernelMountFormatIsDir(KernelMountFormat format);
 
@@ -99,6 +99,25 @@ void ktimeSetRealMs(KTime ms) {
 	ktimeRealTimeOffset=newOffset;
 }
 
+#ifndef ARDUINO
+bool ktimeSnapshotSave(FILE *file) {
+	// Note: this writes directly rather than using snapshot.h helpers as the emulator also uses this file
+	KTime values[2]={ktimeGetMonotonicMs(), ktimeGetRealMs()-ktimeGetRawMs()};
+	return (fwrite(values, sizeof(values), 1, file)==1);
+}
+
+bool ktimeSnapshotLoad(FILE *file) {
+	KTime values[2];
+	if (fread(values, sizeof(values), 1, file)!=1)
+		return false;
+
+	ktimeBootTime=ktimeGetRawMs()-values[0];
+	ktimeRealTimeOffset=ktimeBootTime+values[1];
+
+	return true;
+}
+#endif
+
 KTime ktimeGetRawMs(void) {
 	#ifdef ARDUINO
 	KTime ms;
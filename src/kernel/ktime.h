@@ -1,10 +1,12 @@
 #ifndef WRAPPER_H
 #define WRAPPER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #ifdef ARDUINO
 #include <util/delay.h>
 #else
+#include <stdio.h>
 #include <unistd.h>
 #endif
 
@@ -29,6 +31,12 @@ void ktimeDelayMs(KTime ms);
 
 void ktimeSetRealMs(KTime ms); // if we get an update of the current real time then pass it to this function to sync
 
+#ifndef ARDUINO
+// PC only: save/restore monotonic time (which carries on from the saved value) and any adjustment made to real time relative to the host clock (see snapshot.h)
+bool ktimeSnapshotSave(FILE *file);
+bool ktimeSnapshotLoad(FILE *file);
+#endif
+
 // Note: we have to define ktimeDelayUs this way as the AVR libc function _delay_us needs a compile time constant argument
 #ifdef ARDUINO
 #define ktimeDelayUs(us) _delay_us(us)
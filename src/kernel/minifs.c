@@ -6,12 +6,12 @@
 #include "minifs.h"
 
 #define MINIFSHEADERMAGICBYTEADDR 0
-#define MINIFSHEADERMAGICBYTEVALUE 53
+#define MINIFSHEADERMAGICBYTEVALUE 53 // original format, with an implied factor of MINIFSFACTOR
+#define MINIFSHEADERMAGICBYTEVALUEFACTORBASE 32 // volumes with smaller factors instead store this plus log2(factor)
 #define MINIFSHEADERTOTALSIZEADDR (MINIFSHEADERMAGICBYTEADDR+1)
 #define MINIFSHEADERFILEBASEADDR (MINIFSHEADERTOTALSIZEADDR+1)
 #define MINIFSHEADERSIZE (1+1+MINIFSMAXFILES) // 64 bytes
 
-#define MINIFSFILEMINOFFSETFACTOR MINIFSHEADERSIZE/MINIFSFACTOR // no file can be stored where the header is. note this is usually always 1
 #define MINIFSFILEOFFSETINVALID 0 // this would point into the header anyway
 
 typedef struct {
@@ -27,6 +27,7 @@ typedef struct {
 bool miniFsIsConsistent(const MiniFs *fs);
 
 uint8_t miniFsGetTotalSizeFactorMinusOne(const MiniFs *fs);
+uint8_t miniFsGetFileMinOffsetFactor(const MiniFs *fs); // no file can be stored where the header is
 
 uint16_t miniFsRead(const MiniFs *fs, uint16_t addr, uint8_t *data, uint16_t len);
 uint8_t miniFsReadByte(const MiniFs *fs, uint16_t addr);
@@ -72,10 +73,20 @@ void miniFsSetFileSizeFactorForIndex(MiniFs *fs, uint8_t index, uint8_t newSizeF
 
 void miniFsClearFileForIndex(MiniFs *fs, uint8_t index);
 
-uint8_t miniFsGetSizeFactorForTotalLength(uint16_t totalLen);
+uint16_t miniFsGetSizeFactorForTotalLength(const MiniFs *fs, uint16_t totalLen); // result may not fit in 8 bits, in which case the file is too large
 
 void miniFsResortFileOffsets(MiniFs *fs);
 
+bool miniFsHasIndex(const MiniFs *fs);
+void miniFsIndexRebuild(const MiniFs *fs); // reads header and file metadata from volume
+void miniFsIndexUpdateDerived(const MiniFs *fs); // recomputes file count, hash table and free extent list from the slot list
+void miniFsIndexSetSlot(MiniFs *fs, uint8_t index, uint8_t offsetFactor, uint8_t sizeFactor, uint16_t totalLen, const char *filename);
+uint8_t miniFsIndexFindSlotFromBaseOffset(const MiniFs *fs, uint16_t baseOffset); // binary search, returns MINIFSMAXFILES if not found
+uint8_t miniFsIndexFindSlotFromFilename(const MiniFs *fs, KStr filename); // hash probe, returns MINIFSMAXFILES if not found
+uint8_t miniFsIndexFindFreeRegionFactor(const MiniFs *fs, uint8_t sizeFactor); // best-fit, returns 0 on failure to find
+uint8_t miniFsIndexHashFilename(KStr filename, uint8_t *filenameLen);
+bool miniFsFilenameMatchesAtOffset(const MiniFs *fs, uint16_t filenameOffset, KStr filename);
+
 ////////////////////////////////////////////////////////////////////////////////
 // Public functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -85,16 +96,21 @@ bool miniFsFormat(MiniFsWriteFunctor *writeFunctor, void *functorUserData, uint1
 
 	uint8_t temp;
 
-	// Compute actual total size, which is rounded down to the next multiple of MINIFSFACTOR
-	uint16_t totalSizeFactor=maxTotalSize/MINIFSFACTOR;
-	uint16_t totalSize=totalSizeFactor*MINIFSFACTOR;
+	// Pick the smallest factor which still allows the whole volume to be addressed with 8 bit offsets
+	uint8_t factorShift=0;
+	while(factorShift<MINIFSFACTORSHIFTMAX && (maxTotalSize>>factorShift)>256)
+		++factorShift;
+
+	// Compute actual total size, which is rounded down to the next multiple of the factor
+	uint16_t totalSizeFactor=(maxTotalSize>>factorShift);
+	uint16_t totalSize=(totalSizeFactor<<factorShift);
 
 	// Sanity checks
-	if (totalSize<MINIFSHEADERSIZE || totalSize>MINIFSMAXSIZE)
+	if (totalSize<MINIFSHEADERSIZE || totalSize>MINIFSMAXSIZE || totalSizeFactor>256)
 		return false;
 
-	// Write magic number
-	temp=MINIFSHEADERMAGICBYTEVALUE;
+	// Write magic number (which also encodes the factor)
+	temp=(factorShift==MINIFSFACTORSHIFTMAX ? MINIFSHEADERMAGICBYTEVALUE : MINIFSHEADERMAGICBYTEVALUEFACTORBASE+factorShift);
 	writeFunctor(MINIFSHEADERMAGICBYTEADDR, &temp, 1, functorUserData);
 
 	// Write total size
@@ -110,10 +126,17 @@ bool miniFsFormat(MiniFsWriteFunctor *writeFunctor, void *functorUserData, uint1
 }
 
 bool miniFsMountFast(MiniFs *fs, MiniFsReadFunctor *readFunctor, MiniFsWriteFunctor *writeFunctor, void *functorUserData) {
-	// Simply copy IO functors and clear open bitset
+	// Copy IO functors
 	fs->readFunctor=readFunctor;
 	fs->writeFunctor=writeFunctor;
 	fs->functorUserData=functorUserData;
+	fs->index=NULL;
+
+	// Determine factor from magic byte (unknown values are caught by miniFsMountSafe)
+	fs->factorShift=MINIFSFACTORSHIFTMAX;
+	uint8_t magicByte=miniFsReadByte(fs, MINIFSHEADERMAGICBYTEADDR);
+	if (magicByte>=MINIFSHEADERMAGICBYTEVALUEFACTORBASE && magicByte<MINIFSHEADERMAGICBYTEVALUEFACTORBASE+MINIFSFACTORSHIFTMAX)
+		fs->factorShift=magicByte-MINIFSHEADERMAGICBYTEVALUEFACTORBASE;
 
 	return true;
 }
@@ -131,7 +154,21 @@ bool miniFsMountSafe(MiniFs *fs, MiniFsReadFunctor *readFunctor, MiniFsWriteFunc
 }
 
 void miniFsUnmount(MiniFs *fs) {
-	// Null-op
+	fs->index=NULL;
+}
+
+void miniFsIndexClear(MiniFsIndex *index) {
+	assert(index!=NULL);
+
+	index->valid=false;
+}
+
+void miniFsSetIndex(MiniFs *fs, MiniFsIndex *index) {
+	assert(index!=NULL);
+
+	fs->index=index;
+	if (!index->valid)
+		miniFsIndexRebuild(fs);
 }
 
 bool miniFsGetReadOnly(const MiniFs *fs) {
@@ -139,7 +176,11 @@ bool miniFsGetReadOnly(const MiniFs *fs) {
 }
 
 uint16_t miniFsGetTotalSize(const MiniFs *fs) {
-	return (((uint16_t)miniFsGetTotalSizeFactorMinusOne(fs))+1)*MINIFSFACTOR;
+	return (((uint16_t)miniFsGetTotalSizeFactorMinusOne(fs))+1)<<fs->factorShift;
+}
+
+uint16_t miniFsGetFactor(const MiniFs *fs) {
+	return (1u<<fs->factorShift);
 }
 
 bool miniFsGetChildN(const MiniFs *fs, unsigned childNum, char childPath[MiniFsPathMax]) {
@@ -163,11 +204,81 @@ bool miniFsIsEmpty(const MiniFs *fs) {
 	return miniFsIsFileSlotEmpty(fs, 0);
 }
 
+void miniFsGetFreeSpaceStats(const MiniFs *fs, uint16_t *freeSize, uint16_t *largestFreeRegionSize) {
+	assert(freeSize!=NULL);
+	assert(largestFreeRegionSize!=NULL);
+
+	// Walk files in offset order, looking at the gap before each one and finally the gap at the end of the volume
+	*freeSize=0;
+	*largestFreeRegionSize=0;
+	uint16_t prevEndFactor=miniFsGetFileMinOffsetFactor(fs);
+	for(uint8_t i=0; i<=MINIFSMAXFILES; ++i) {
+		uint8_t offsetFactor=(i<MINIFSMAXFILES ? miniFsFileGetBaseOffsetFactorFromIndex(fs, i) : 0);
+		uint16_t nextStartFactor=(offsetFactor!=0 ? offsetFactor : ((uint16_t)miniFsGetTotalSizeFactorMinusOne(fs))+1);
+
+		if (nextStartFactor>prevEndFactor) {
+			uint16_t gapSize=(nextStartFactor-prevEndFactor)<<fs->factorShift;
+			*freeSize+=gapSize;
+			if (gapSize>*largestFreeRegionSize)
+				*largestFreeRegionSize=gapSize;
+		}
+
+		if (offsetFactor==0)
+			break; // end of file list
+		prevEndFactor=offsetFactor+miniFsFileGetSizeFactorFromIndex(fs, i);
+	}
+}
+
+bool miniFsCompactStep(MiniFs *fs) {
+	// Is this file system read only?
+	if (miniFsGetReadOnly(fs))
+		return false;
+
+	// Find first file with a gap before it
+	uint16_t prevEndFactor=miniFsGetFileMinOffsetFactor(fs);
+	for(uint8_t i=0; i<MINIFSMAXFILES; ++i) {
+		uint8_t offsetFactor=miniFsFileGetBaseOffsetFactorFromIndex(fs, i);
+		if (offsetFactor==0)
+			break; // end of file list
+
+		if (offsetFactor==prevEndFactor) {
+			prevEndFactor=offsetFactor+miniFsFileGetSizeFactorFromIndex(fs, i);
+			continue;
+		}
+
+		// Slide file down to close the gap.
+		// Copying forwards in chunks is safe even though the regions may overlap, as the destination is below the source.
+		uint16_t srcOffset=((uint16_t)offsetFactor)<<fs->factorShift;
+		uint16_t destOffset=prevEndFactor<<fs->factorShift;
+		uint16_t totalLen=miniFsGetFileTotalLengthFromIndex(fs, i);
+		uint8_t chunk[32];
+		for(uint16_t done=0; done<totalLen; ) {
+			uint16_t chunkLen=(totalLen-done<sizeof(chunk) ? totalLen-done : sizeof(chunk));
+			miniFsRead(fs, srcOffset+done, chunk, chunkLen);
+			miniFsWrite(fs, destOffset+done, chunk, chunkLen);
+			done+=chunkLen;
+		}
+
+		// Update header (order of offsets is unchanged so no resort needed)
+		miniFsWriteByte(fs, MINIFSHEADERFILEBASEADDR+i, prevEndFactor);
+		if (miniFsHasIndex(fs)) {
+			fs->index->slots[i].offsetFactor=prevEndFactor;
+			miniFsIndexUpdateDerived(fs);
+		}
+
+		assert(miniFsIsConsistent(fs));
+		return true;
+	}
+
+	return false;
+}
+
 void miniFsDebug(const MiniFs *fs) {
 #ifndef ARDUINO
 	printf("Volume debug:\n");
 	printf("	max total size: %u bytes\n", miniFsGetTotalSize(fs));
 	printf("	header size: %u bytes (%u%% of total, leaving %u bytes for file data)\n", MINIFSHEADERSIZE, (100*MINIFSHEADERSIZE)/miniFsGetTotalSize(fs), miniFsGetTotalSize(fs)-MINIFSHEADERSIZE);
+	printf("	allocation factor: %u bytes\n", miniFsGetFactor(fs));
 	printf("	mount mode: %s\n", (miniFsGetReadOnly(fs) ? "RO" : "RW"));
 	printf("	files:\n");
 	printf("		ID OFFSET SIZE LENGTH SPARE FILENAME\n");
@@ -206,6 +317,20 @@ uint16_t miniFsFileGetLen(const MiniFs *fs, const char *filename) {
 	return miniFsFileGetContentLenFromBaseOffset(fs, baseOffset);
 }
 
+bool miniFsFileGetContentRangeKStr(const MiniFs *fs, KStr filename, uint16_t *contentOffset, uint16_t *contentLen) {
+	assert(contentOffset!=NULL);
+	assert(contentLen!=NULL);
+
+	uint16_t baseOffset;
+	if (miniFsFilenameToIndexKStr(fs, filename, &baseOffset)==MINIFSMAXFILES)
+		return false;
+
+	*contentLen=miniFsFileGetContentLenFromBaseOffset(fs, baseOffset);
+	*contentOffset=miniFsFileGetContentOffsetFromBaseOffset(fs, baseOffset);
+
+	return (*contentOffset!=0);
+}
+
 uint16_t miniFsFileGetSize(const MiniFs *fs, const char *filename) {
 	// This is the size available for content, not the true size (so does not include the filename)
 	uint16_t baseOffset;
@@ -238,8 +363,12 @@ bool miniFsFileCreate(MiniFs *fs, const char *filename, uint16_t contentSize) {
 		return false;
 
 	// Look for large enough region of free space to store the file
+	if (contentSize>UINT16_MAX-(3+filenameLen+1))
+		return false;
 	uint16_t fileTotalLength=3+filenameLen+1+contentSize;
-	uint8_t fileSizeFactor=miniFsGetSizeFactorForTotalLength(fileTotalLength);
+	uint16_t fileSizeFactor=miniFsGetSizeFactorForTotalLength(fs, fileTotalLength);
+	if (fileSizeFactor>UINT8_MAX)
+		return false;
 
 	uint8_t fileOffsetFactor=miniFsFindFreeRegionFactor(fs, fileSizeFactor);
 	if (fileOffsetFactor==0)
@@ -249,7 +378,7 @@ bool miniFsFileCreate(MiniFs *fs, const char *filename, uint16_t contentSize) {
 	miniFsWriteByte(fs, MINIFSHEADERFILEBASEADDR+freeIndex, fileOffsetFactor);
 
 	// Write file length, size factor and filename to start of file data
-	uint16_t fileOffset=((uint16_t)fileOffsetFactor)*MINIFSFACTOR;
+	uint16_t fileOffset=((uint16_t)fileOffsetFactor)<<fs->factorShift;
 	miniFsWriteByte(fs, fileOffset++, (fileTotalLength>>8));
 	miniFsWriteByte(fs, fileOffset++, (fileTotalLength&0xFF));
 	miniFsWriteByte(fs, fileOffset++, fileSizeFactor);
@@ -257,6 +386,9 @@ bool miniFsFileCreate(MiniFs *fs, const char *filename, uint16_t contentSize) {
 	miniFsWrite(fs, fileOffset, (const uint8_t *)filename, filenameLen+1);
 	fileOffset+=filenameLen+1;
 
+	// Update index (if any)
+	miniFsIndexSetSlot(fs, freeIndex, fileOffsetFactor, fileSizeFactor, fileTotalLength, filename);
+
 	// Resort the offset list
 	miniFsResortFileOffsets(fs);
 
@@ -303,7 +435,7 @@ bool miniFsFileResize(MiniFs *fs, const char *filename, uint16_t newContentLen)
 		miniFsSetFileTotalLengthForIndex(fs, index, newTotalLen);
 
 		// Reduced stored size
-		uint8_t newSizeFactor=miniFsGetSizeFactorForTotalLength(newTotalLen);
+		uint8_t newSizeFactor=miniFsGetSizeFactorForTotalLength(fs, newTotalLen);
 		miniFsSetFileSizeFactorForIndex(fs, index, newSizeFactor);
 
 		assert(miniFsIsConsistent(fs));
@@ -313,20 +445,22 @@ bool miniFsFileResize(MiniFs *fs, const char *filename, uint16_t newContentLen)
 	// Check for enough spare space already so that we can just update the length
 	uint16_t delta=newContentLen-contentLen;
 	uint16_t totalLen=miniFsGetFileTotalLengthFromBaseOffset(fs, baseOffset);
+	if (delta>UINT16_MAX-totalLen)
+		return false;
 	uint16_t newTotalLen=totalLen+delta;
 	uint16_t size=miniFsFileGetSizeFromBaseOffset(fs, baseOffset);
 	if (newTotalLen<=size) {
 		// Update stored length
-		uint16_t fileOffset=miniFsFileGetLengthOffsetFromBaseOffset(fs, baseOffset);
-		miniFsWriteByte(fs, fileOffset++, (newTotalLen>>8));
-		miniFsWriteByte(fs, fileOffset++, (newTotalLen&0xFF));
+		miniFsSetFileTotalLengthForIndex(fs, index, newTotalLen);
 
 		assert(miniFsIsConsistent(fs));
 		return true;
 	}
 
 	// Check if we have space after us to increase size (and length) sufficiently, without touching anything else
-	uint8_t newSizeFactor=(newTotalLen+MINIFSFACTOR-1)/MINIFSFACTOR;
+	uint16_t newSizeFactor=miniFsGetSizeFactorForTotalLength(fs, newTotalLen);
+	if (newSizeFactor>UINT8_MAX)
+		return false;
 	uint8_t nextFileIndex;
 	uint8_t nextFileOffsetFactor;
 	for(nextFileIndex=index+1; nextFileIndex<MINIFSMAXFILES; ++nextFileIndex) {
@@ -345,11 +479,8 @@ bool miniFsFileResize(MiniFs *fs, const char *filename, uint16_t newContentLen)
 		maxSizeIfDesiredFactor=miniFsGetTotalSizeFactorMinusOne(fs)-currFileOffsetFactor+1;
 	if (newSizeFactor<=maxSizeIfDesiredFactor) {
 		// We can simply extend in place, update stored length and size
-		uint16_t fileLenOffset=miniFsFileGetLengthOffsetFromBaseOffset(fs, baseOffset);
-		miniFsWriteByte(fs, fileLenOffset++, (newTotalLen>>8));
-		miniFsWriteByte(fs, fileLenOffset++, (newTotalLen&0xFF));
-		uint16_t fileSizeFactorOffset=miniFsFileGetSizeFactorOffsetFromBaseOffset(fs, baseOffset);
-		miniFsWriteByte(fs, fileSizeFactorOffset++, newSizeFactor);
+		miniFsSetFileTotalLengthForIndex(fs, index, newTotalLen);
+		miniFsSetFileSizeFactorForIndex(fs, index, newSizeFactor);
 
 		assert(miniFsIsConsistent(fs));
 		return true;
@@ -361,7 +492,7 @@ bool miniFsFileResize(MiniFs *fs, const char *filename, uint16_t newContentLen)
 		return false;
 
 	// Write file length, size factor and filename to start of new region
-	uint16_t fileOffset=((uint16_t)newFileOffsetFactor)*MINIFSFACTOR;
+	uint16_t fileOffset=((uint16_t)newFileOffsetFactor)<<fs->factorShift;
 	miniFsWriteByte(fs, fileOffset++, (newTotalLen>>8));
 	miniFsWriteByte(fs, fileOffset++, (newTotalLen&0xFF));
 	miniFsWriteByte(fs, fileOffset++, newSizeFactor);
@@ -378,6 +509,7 @@ bool miniFsFileResize(MiniFs *fs, const char *filename, uint16_t newContentLen)
 
 	// Update file offset factor in header
 	miniFsWriteByte(fs, MINIFSHEADERFILEBASEADDR+index, newFileOffsetFactor);
+	miniFsIndexSetSlot(fs, index, newFileOffsetFactor, newSizeFactor, newTotalLen, filename);
 
 	// Resort the offset list
 	miniFsResortFileOffsets(fs);
@@ -447,7 +579,7 @@ uint16_t miniFsFileWrite(MiniFs *fs, const char *filename, uint16_t offset, cons
 bool miniFsIsConsistent(const MiniFs *fs) {
 	// Verify header
 	uint8_t magicByte=miniFsReadByte(fs, MINIFSHEADERMAGICBYTEADDR);
-	if (magicByte!=MINIFSHEADERMAGICBYTEVALUE)
+	if (magicByte!=MINIFSHEADERMAGICBYTEVALUE && (magicByte<MINIFSHEADERMAGICBYTEVALUEFACTORBASE || magicByte>=MINIFSHEADERMAGICBYTEVALUEFACTORBASE+MINIFSFACTORSHIFTMAX))
 		return false;
 
 	uint16_t totalSize=miniFsGetTotalSize(fs);
@@ -464,7 +596,7 @@ bool miniFsIsConsistent(const MiniFs *fs) {
 			break; // end of file list
 
 		// Check the file offset does not overlap the header
-		if (fileOffsetFactor<MINIFSFILEMINOFFSETFACTOR)
+		if (fileOffsetFactor<miniFsGetFileMinOffsetFactor(fs))
 			return false;
 
 		// Check the file is located after the one in the previous slot.
@@ -489,7 +621,13 @@ bool miniFsIsConsistent(const MiniFs *fs) {
 	return true;
 }
 
+uint8_t miniFsGetFileMinOffsetFactor(const MiniFs *fs) {
+	return (MINIFSHEADERSIZE+miniFsGetFactor(fs)-1)>>fs->factorShift;
+}
+
 uint8_t miniFsGetTotalSizeFactorMinusOne(const MiniFs *fs) {
+	if (miniFsHasIndex(fs))
+		return fs->index->totalSizeFactorMinusOne;
 	return miniFsReadByte(fs, MINIFSHEADERTOTALSIZEADDR);
 }
 
@@ -517,6 +655,16 @@ bool miniFsGetFilenameFromIndex(const MiniFs *fs, uint8_t index, char filename[M
 	if (filenameOffset==0)
 		return false;
 
+	// Length known from index? Then read whole filename at once
+	if (miniFsHasIndex(fs)) {
+		uint8_t filenameLen=fs->index->slots[index].filenameLen;
+		if (filenameLen+1>MiniFsPathMax)
+			filenameLen=MiniFsPathMax-1;
+		miniFsRead(fs, filenameOffset, (uint8_t *)filename, filenameLen);
+		filename[filenameLen]='\0';
+		return true;
+	}
+
 	// Copy filename
 	char *dest;
 	for(dest=filename; dest+1<filename+MiniFsPathMax; dest++, filenameOffset++) {
@@ -536,6 +684,14 @@ uint8_t miniFsFilenameToIndex(const MiniFs *fs, const char *filename, uint16_t *
 }
 
 uint8_t miniFsFilenameToIndexKStr(const MiniFs *fs, KStr filename, uint16_t *baseOffsetPtr) {
+	// Use index if available
+	if (miniFsHasIndex(fs)) {
+		uint8_t index=miniFsIndexFindSlotFromFilename(fs, filename);
+		if (baseOffsetPtr!=NULL)
+			*baseOffsetPtr=(index!=MINIFSMAXFILES ? miniFsFileGetBaseOffsetFromIndex(fs, index) : 0);
+		return index;
+	}
+
 	// Loop over all slots looking for the given filename
 	for(uint8_t index=0; index<MINIFSMAXFILES; ++index) {
 		// Is there even a file using this slot?
@@ -597,7 +753,7 @@ bool miniFsReadFileInfoFromBaseOffset(const MiniFs *fs, MiniFsFileInfo *info, ui
 }
 
 bool miniFsIsFileSlotEmpty(const MiniFs *fs, uint8_t index) {
-	return (miniFsReadByte(fs, MINIFSHEADERFILEBASEADDR+index)==MINIFSFILEOFFSETINVALID);
+	return (miniFsFileGetBaseOffsetFactorFromIndex(fs, index)==MINIFSFILEOFFSETINVALID);
 }
 
 uint8_t miniFsGetEmptyIndex(const MiniFs *fs) {
@@ -608,18 +764,22 @@ uint8_t miniFsGetEmptyIndex(const MiniFs *fs) {
 }
 
 uint8_t miniFsFindFreeRegionFactor(const MiniFs *fs, uint8_t sizeFactor) {
+	// Use index if available (note this uses best-fit rather than first-fit)
+	if (miniFsHasIndex(fs))
+		return miniFsIndexFindFreeRegionFactor(fs, sizeFactor);
+
 	// No files?
 	uint8_t firstFileIndex=0; // due to sorting
 	if (miniFsFileGetBaseOffsetFactorFromIndex(fs, firstFileIndex)==0) {
 		// Check for insufficent space in volume
-		if (sizeFactor>miniFsGetTotalSizeFactorMinusOne(fs)-MINIFSFILEMINOFFSETFACTOR+1)
+		if (sizeFactor>miniFsGetTotalSizeFactorMinusOne(fs)-miniFsGetFileMinOffsetFactor(fs)+1)
 			return 0;
-		return MINIFSFILEMINOFFSETFACTOR;
+		return miniFsGetFileMinOffsetFactor(fs);
 	}
 
 	// Check for space before first file.
-	if (sizeFactor<=miniFsFileGetBaseOffsetFactorFromIndex(fs, firstFileIndex)-MINIFSFILEMINOFFSETFACTOR)
-		return MINIFSFILEMINOFFSETFACTOR;
+	if (sizeFactor<=miniFsFileGetBaseOffsetFactorFromIndex(fs, firstFileIndex)-miniFsGetFileMinOffsetFactor(fs))
+		return miniFsGetFileMinOffsetFactor(fs);
 
 	// Check for space between files.
 	uint8_t secondFileIndex;
@@ -650,11 +810,13 @@ uint8_t miniFsFindFreeRegionFactor(const MiniFs *fs, uint8_t sizeFactor) {
 }
 
 uint8_t miniFsFileGetBaseOffsetFactorFromIndex(const MiniFs *fs, uint8_t index) {
+	if (miniFsHasIndex(fs))
+		return fs->index->slots[index].offsetFactor;
 	return miniFsReadByte(fs, MINIFSHEADERFILEBASEADDR+index);
 }
 
 uint16_t miniFsFileGetBaseOffsetFromIndex(const MiniFs *fs, uint8_t index) {
-	return ((uint16_t)miniFsFileGetBaseOffsetFactorFromIndex(fs, index))*MINIFSFACTOR;
+	return ((uint16_t)miniFsFileGetBaseOffsetFactorFromIndex(fs, index))<<fs->factorShift;
 }
 
 uint16_t miniFsFileGetLengthOffsetFromIndex(const MiniFs *fs, uint8_t index) {
@@ -703,7 +865,7 @@ uint16_t miniFsGetFileTotalLengthFromIndex(const MiniFs *fs, uint8_t index) {
 }
 
 uint8_t miniFsFileGetBaseOffsetFactorFromBaseOffset(const MiniFs *fs, uint16_t baseOffset) {
-	return baseOffset/MINIFSFACTOR;
+	return baseOffset>>fs->factorShift;
 }
 
 uint16_t miniFsFileGetLengthOffsetFromBaseOffset(const MiniFs *fs, uint16_t baseOffset) {
@@ -721,6 +883,10 @@ uint8_t miniFsFileGetSizeFactorFromBaseOffset(const MiniFs *fs, uint16_t baseOff
 	if (sizeFactorOffset==0)
 		return 0;
 
+	uint8_t index=miniFsIndexFindSlotFromBaseOffset(fs, baseOffset);
+	if (index!=MINIFSMAXFILES)
+		return fs->index->slots[index].sizeFactor;
+
 	return miniFsReadByte(fs, sizeFactorOffset);
 }
 
@@ -728,7 +894,7 @@ uint16_t miniFsFileGetSizeFromBaseOffset(const MiniFs *fs, uint16_t baseOffset)
 	uint16_t sizeFactor=miniFsFileGetSizeFactorFromBaseOffset(fs, baseOffset);
 	if (sizeFactor==0)
 		return 0;
-	return sizeFactor*MINIFSFACTOR;
+	return sizeFactor<<fs->factorShift;
 }
 
 uint16_t miniFsFileGetFilenameOffsetFromBaseOffset(const MiniFs *fs, uint16_t baseOffset) {
@@ -738,6 +904,10 @@ uint16_t miniFsFileGetFilenameOffsetFromBaseOffset(const MiniFs *fs, uint16_t ba
 }
 
 uint16_t miniFsFileGetFilenameLenFromBaseOffset(const MiniFs *fs, uint16_t baseOffset) {
+	uint8_t index=miniFsIndexFindSlotFromBaseOffset(fs, baseOffset);
+	if (index!=MINIFSMAXFILES)
+		return fs->index->slots[index].filenameLen;
+
 	uint16_t filenameOffset=miniFsFileGetFilenameOffsetFromBaseOffset(fs, baseOffset);
 	uint16_t filenameLen;
 	for(filenameLen=0; ; ++filenameLen) {
@@ -767,6 +937,10 @@ uint16_t miniFsGetFileTotalLengthFromBaseOffset(const MiniFs *fs, uint16_t baseO
 	if (lengthFileOffset==0)
 		return 0;
 
+	uint8_t index=miniFsIndexFindSlotFromBaseOffset(fs, baseOffset);
+	if (index!=MINIFSMAXFILES)
+		return fs->index->slots[index].totalLen;
+
 	uint16_t fileTotalLength=0;
 	fileTotalLength|=miniFsReadByte(fs, lengthFileOffset+0);
 	fileTotalLength<<=8;
@@ -779,24 +953,62 @@ void miniFsSetFileTotalLengthForIndex(MiniFs *fs, uint8_t index, uint16_t newTot
 	assert(offset!=0);
 	miniFsWriteByte(fs, offset+0, (newTotalLen>>8));
 	miniFsWriteByte(fs, offset+1, (newTotalLen&0xFF));
+
+	if (miniFsHasIndex(fs))
+		fs->index->slots[index].totalLen=newTotalLen;
 }
 
 void miniFsSetFileSizeFactorForIndex(MiniFs *fs, uint8_t index, uint8_t newSizeFactor) {
 	uint16_t offset=miniFsFileGetSizeFactorOffsetFromIndex(fs, index);
 	assert(offset!=0);
 	miniFsWriteByte(fs, offset, newSizeFactor);
+
+	if (miniFsHasIndex(fs)) {
+		fs->index->slots[index].sizeFactor=newSizeFactor;
+		miniFsIndexUpdateDerived(fs);
+	}
 }
 
 void miniFsClearFileForIndex(MiniFs *fs, uint8_t index) {
 	// Clear all file offsets
 	miniFsWriteByte(fs, MINIFSHEADERFILEBASEADDR+index, MINIFSFILEOFFSETINVALID);
+
+	if (miniFsHasIndex(fs))
+		memset(&fs->index->slots[index], 0, sizeof(MiniFsIndexSlot));
 }
 
-uint8_t miniFsGetSizeFactorForTotalLength(uint16_t totalLen) {
-	return (totalLen+MINIFSFACTOR-1)/MINIFSFACTOR;
+uint16_t miniFsGetSizeFactorForTotalLength(const MiniFs *fs, uint16_t totalLen) {
+	return (((uint32_t)totalLen)+miniFsGetFactor(fs)-1)>>fs->factorShift;
 }
 
 void miniFsResortFileOffsets(MiniFs *fs) {
+	// With an index we can sort in memory and then only write header bytes which have changed
+	if (miniFsHasIndex(fs)) {
+		MiniFsIndex *index=fs->index;
+
+		uint8_t oldOffsetFactors[MINIFSMAXFILES];
+		for(uint8_t i=0; i<MINIFSMAXFILES; ++i)
+			oldOffsetFactors[i]=index->slots[i].offsetFactor;
+
+		// Insertion sort, pushing unused slots to the end
+		for(uint8_t i=1; i<MINIFSMAXFILES; ++i) {
+			MiniFsIndexSlot slot=index->slots[i];
+			if (slot.offsetFactor==MINIFSFILEOFFSETINVALID)
+				continue;
+			uint8_t j;
+			for(j=i; j>0 && (index->slots[j-1].offsetFactor==MINIFSFILEOFFSETINVALID || index->slots[j-1].offsetFactor>slot.offsetFactor); --j)
+				index->slots[j]=index->slots[j-1];
+			index->slots[j]=slot;
+		}
+
+		for(uint8_t i=0; i<MINIFSMAXFILES; ++i)
+			if (index->slots[i].offsetFactor!=oldOffsetFactors[i])
+				miniFsWriteByte(fs, MINIFSHEADERFILEBASEADDR+i, index->slots[i].offsetFactor);
+
+		miniFsIndexUpdateDerived(fs);
+		return;
+	}
+
 	// Bubble sort - should be fast due to small entry count (MINIFSMAXFILES max but typically much smaller) and being mostly ordered due to last sort
 
 	uint8_t max=MINIFSMAXFILES;
@@ -818,3 +1030,178 @@ void miniFsResortFileOffsets(MiniFs *fs) {
 		--max;
 	} while(change);
 }
+
+bool miniFsHasIndex(const MiniFs *fs) {
+	return (fs->index!=NULL && fs->index->valid);
+}
+
+void miniFsIndexRebuild(const MiniFs *fs) {
+	MiniFsIndex *index=fs->index;
+	assert(index!=NULL);
+
+	// Ensure the following reads go to the volume itself
+	index->valid=false;
+
+	index->totalSizeFactorMinusOne=miniFsGetTotalSizeFactorMinusOne(fs);
+
+	for(uint8_t i=0; i<MINIFSMAXFILES; ++i) {
+		MiniFsIndexSlot *slot=&index->slots[i];
+		memset(slot, 0, sizeof(MiniFsIndexSlot));
+
+		uint16_t baseOffset=miniFsFileGetBaseOffsetFromIndex(fs, i);
+		if (baseOffset==0)
+			continue;
+
+		char filename[MiniFsPathMax];
+		if (!miniFsGetFilenameFromIndex(fs, i, filename))
+			continue;
+
+		slot->offsetFactor=miniFsFileGetBaseOffsetFactorFromBaseOffset(fs, baseOffset);
+		slot->sizeFactor=miniFsFileGetSizeFactorFromBaseOffset(fs, baseOffset);
+		slot->totalLen=miniFsGetFileTotalLengthFromBaseOffset(fs, baseOffset);
+		slot->filenameHash=miniFsIndexHashFilename(kstrS(filename), &slot->filenameLen);
+	}
+
+	index->valid=true;
+	miniFsIndexUpdateDerived(fs);
+}
+
+void miniFsIndexUpdateDerived(const MiniFs *fs) {
+	MiniFsIndex *index=fs->index;
+	assert(index!=NULL);
+
+	// Count files and fill hash table
+	memset(index->hashTable, MINIFSMAXFILES, sizeof(index->hashTable));
+	index->fileCount=0;
+	for(uint8_t i=0; i<MINIFSMAXFILES; ++i) {
+		const MiniFsIndexSlot *slot=&index->slots[i];
+		if (slot->offsetFactor==MINIFSFILEOFFSETINVALID)
+			break; // end of file list
+		++index->fileCount;
+
+		// Add to hash table
+		uint8_t bucket=((slot->filenameHash^slot->filenameLen)&(MINIFSINDEXHASHSIZE-1));
+		while(index->hashTable[bucket]!=MINIFSMAXFILES)
+			bucket=((bucket+1)&(MINIFSINDEXHASHSIZE-1));
+		index->hashTable[bucket]=i;
+	}
+
+	// Compute free extents (gaps before, between and after files)
+	index->freeExtentCount=0;
+	uint16_t prevEndFactor=miniFsGetFileMinOffsetFactor(fs);
+	for(uint8_t i=0; i<=index->fileCount; ++i) {
+		uint16_t nextStartFactor=(i<index->fileCount ? index->slots[i].offsetFactor : ((uint16_t)index->totalSizeFactorMinusOne)+1);
+		if (nextStartFactor>prevEndFactor) {
+			MiniFsIndexExtent extent={.offsetFactor=prevEndFactor, .sizeFactor=nextStartFactor-prevEndFactor};
+
+			// Insert keeping list sorted by size and then offset
+			uint8_t j;
+			for(j=index->freeExtentCount; j>0 && (index->freeExtents[j-1].sizeFactor>extent.sizeFactor || (index->freeExtents[j-1].sizeFactor==extent.sizeFactor && index->freeExtents[j-1].offsetFactor>extent.offsetFactor)); --j)
+				index->freeExtents[j]=index->freeExtents[j-1];
+			index->freeExtents[j]=extent;
+			++index->freeExtentCount;
+		}
+		if (i<index->fileCount)
+			prevEndFactor=((uint16_t)index->slots[i].offsetFactor)+index->slots[i].sizeFactor;
+	}
+}
+
+void miniFsIndexSetSlot(MiniFs *fs, uint8_t index, uint8_t offsetFactor, uint8_t sizeFactor, uint16_t totalLen, const char *filename) {
+	if (!miniFsHasIndex(fs))
+		return;
+
+	MiniFsIndexSlot *slot=&fs->index->slots[index];
+	slot->offsetFactor=offsetFactor;
+	slot->sizeFactor=sizeFactor;
+	slot->totalLen=totalLen;
+	slot->filenameHash=miniFsIndexHashFilename(kstrS((char *)filename), &slot->filenameLen);
+}
+
+uint8_t miniFsIndexFindSlotFromBaseOffset(const MiniFs *fs, uint16_t baseOffset) {
+	if (!miniFsHasIndex(fs) || baseOffset==0)
+		return MINIFSMAXFILES;
+
+	const MiniFsIndex *index=fs->index;
+	uint8_t offsetFactor=baseOffset>>fs->factorShift;
+	uint8_t low=0, high=index->fileCount;
+	while(low<high) {
+		uint8_t mid=(low+high)/2;
+		if (index->slots[mid].offsetFactor<offsetFactor)
+			low=mid+1;
+		else
+			high=mid;
+	}
+
+	return (low<index->fileCount && index->slots[low].offsetFactor==offsetFactor ? low : MINIFSMAXFILES);
+}
+
+uint8_t miniFsIndexFindSlotFromFilename(const MiniFs *fs, KStr filename) {
+	assert(miniFsHasIndex(fs));
+
+	const MiniFsIndex *index=fs->index;
+	uint8_t filenameLen;
+	uint8_t filenameHash=miniFsIndexHashFilename(filename, &filenameLen);
+
+	uint8_t bucket=((filenameHash^filenameLen)&(MINIFSINDEXHASHSIZE-1));
+	while(index->hashTable[bucket]!=MINIFSMAXFILES) {
+		uint8_t i=index->hashTable[bucket];
+		const MiniFsIndexSlot *slot=&index->slots[i];
+		if (slot->filenameHash==filenameHash && slot->filenameLen==filenameLen && miniFsFilenameMatchesAtOffset(fs, miniFsFileGetFilenameOffsetFromIndex(fs, i), filename))
+			return i;
+		bucket=((bucket+1)&(MINIFSINDEXHASHSIZE-1));
+	}
+
+	return MINIFSMAXFILES;
+}
+
+uint8_t miniFsIndexFindFreeRegionFactor(const MiniFs *fs, uint8_t sizeFactor) {
+	assert(miniFsHasIndex(fs));
+
+	// Binary search for the smallest extent which is large enough
+	const MiniFsIndex *index=fs->index;
+	uint8_t low=0, high=index->freeExtentCount;
+	while(low<high) {
+		uint8_t mid=(low+high)/2;
+		if (index->freeExtents[mid].sizeFactor<sizeFactor)
+			low=mid+1;
+		else
+			high=mid;
+	}
+
+	return (low<index->freeExtentCount ? index->freeExtents[low].offsetFactor : 0);
+}
+
+uint8_t miniFsIndexHashFilename(KStr filename, uint8_t *filenameLen) {
+	assert(filenameLen!=NULL);
+
+	// FNV-1a (16 bit variant)
+	uint16_t hash=0x9DC5;
+	uint16_t len;
+	for(len=0; ; ++len) {
+		uint8_t c=kstrGetChar(filename, len);
+		if (c=='\0')
+			break;
+		hash=(hash^c)*0x0193;
+	}
+
+	*filenameLen=(len<MiniFsPathMax ? len : MiniFsPathMax);
+	return (hash>>8)^(hash&0xFF);
+}
+
+bool miniFsFilenameMatchesAtOffset(const MiniFs *fs, uint16_t filenameOffset, KStr filename) {
+	// Compare in chunks to reduce the number of calls to the read functor
+	uint8_t chunk[16];
+	uint16_t i=0;
+	while(1) {
+		uint16_t chunkLen=miniFsRead(fs, filenameOffset+i, chunk, sizeof(chunk));
+		if (chunkLen==0)
+			return false;
+		for(uint16_t j=0; j<chunkLen; ++j, ++i) {
+			char trueChar=kstrGetChar(filename, i);
+			if (chunk[j]!=trueChar)
+				return false;
+			if (trueChar=='\0')
+				return true;
+		}
+	}
+}
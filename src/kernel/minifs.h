@@ -6,8 +6,11 @@
 
 #include "kstr.h"
 
-#define MINIFSFACTOR 128u // 1<=factor<=256, increasing allows for a greater total volume size, but wastes more space padding small files (so their length is a multiple of the factor)
-#define MINIFSMINSIZE 128u // lcm(factor, 2headersize)=lcm(128,2*64)=128
+// Files are allocated in multiples of a per-volume factor (a power of two), chosen when formatting as the smallest which allows 8 bit offsets to address the whole volume.
+// Larger factors allow for a greater total volume size, but waste more space padding small files (so their length is a multiple of the factor).
+#define MINIFSFACTORSHIFTMAX 7
+#define MINIFSFACTOR (1u<<MINIFSFACTORSHIFTMAX) // maximum factor (and the only one supported by the original format)
+#define MINIFSMINSIZE 128u // the header (2+MINIFSMAXFILES bytes) is this size whatever the factor, and this is also a multiple of every factor (up to MINIFSFACTOR)
 #define MINIFSMAXSIZE (MINIFSFACTOR*256) // we use an 8 bit value with a factor to represent the total size (with factor=128 this allows up to 32kb)
 
 #define MINIFSMAXFILES (MINIFSFACTOR-2)
@@ -17,11 +20,42 @@
 typedef uint16_t (MiniFsReadFunctor)(uint16_t addr, uint8_t *data, uint16_t len, void *userData);
 typedef uint16_t (MiniFsWriteFunctor)(uint16_t addr, const uint8_t *data, uint16_t len, void *userData);
 
+#define MINIFSINDEXHASHSIZE 128u // number of buckets in an index's filename hash table, must be a power of two and greater than MINIFSMAXFILES
+#if MINIFSINDEXHASHSIZE<=MINIFSMAXFILES
+#error MINIFSINDEXHASHSIZE too small
+#endif
+
+typedef struct {
+	uint8_t offsetFactor; // MINIFSFILEOFFSETINVALID (0) if slot is unused
+	uint8_t sizeFactor;
+	uint16_t totalLen;
+	uint8_t filenameLen;
+	uint8_t filenameHash; // combined with filenameLen to choose the hash table bucket
+} MiniFsIndexSlot;
+
+typedef struct {
+	uint8_t offsetFactor, sizeFactor;
+} MiniFsIndexExtent;
+
+typedef struct {
+	// Members are to be considered private
+	MiniFsIndexSlot slots[MINIFSMAXFILES]; // mirrors the header's slot list (so is sorted by offset, with unused slots at the end)
+	uint8_t fileCount;
+	uint8_t totalSizeFactorMinusOne;
+	bool valid;
+
+	uint8_t hashTable[MINIFSINDEXHASHSIZE]; // slot indices (MINIFSMAXFILES if bucket is empty), open addressing with linear probing
+	MiniFsIndexExtent freeExtents[MINIFSMAXFILES+1]; // sorted by size and then offset, to allow best-fit allocation via a binary search
+	uint8_t freeExtentCount;
+} MiniFsIndex; // in-memory copy of a volume's header and file metadata, to avoid going through the read functor for lookups and allocation
+
 typedef struct {
 	// Members are to be considered private
 	MiniFsReadFunctor *readFunctor;
 	MiniFsWriteFunctor *writeFunctor; // NULL if read-only
 	void *functorUserData;
+	MiniFsIndex *index; // optional, NULL if not used (see miniFsSetIndex)
+	uint8_t factorShift; // log2 of this volume's allocation factor (read from header on mount)
 } MiniFs;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -35,13 +69,22 @@ bool miniFsMountFast(MiniFs *fs, MiniFsReadFunctor *readFunctor, MiniFsWriteFunc
 bool miniFsMountSafe(MiniFs *fs, MiniFsReadFunctor *readFunctor, MiniFsWriteFunctor *writeFunctor, void *functorUserData); // Verify the header is sensible before mounting
 void miniFsUnmount(MiniFs *fs);
 
+// An index can be attached to a writable volume after mounting to speed up operations. It is built from the header on first use (or after being cleared) and then kept up to date as the volume is modified.
+// The index should persist across mounts of the same volume, but must be cleared if the volume is modified without the index being attached (or by anything other than MiniFs).
+void miniFsIndexClear(MiniFsIndex *index);
+void miniFsSetIndex(MiniFs *fs, MiniFsIndex *index);
+
 bool miniFsGetReadOnly(const MiniFs *fs);
+uint16_t miniFsGetFactor(const MiniFs *fs); // allocation granularity in bytes
 uint16_t miniFsGetTotalSize(const MiniFs *fs); // Total size available for whole file system (including metadata)
 
 bool miniFsGetChildN(const MiniFs *fs, unsigned childNum, char childPath[MiniFsPathMax]); // n<MINIFSMAXFILES, gaps
 uint8_t miniFsGetChildCount(const MiniFs *fs);
 bool miniFsIsEmpty(const MiniFs *fs); // equivalent to: miniFsGetChildCount()==0, but usually much faster
 
+void miniFsGetFreeSpaceStats(const MiniFs *fs, uint16_t *freeSize, uint16_t *largestFreeRegionSize); // free space can only be allocated in contiguous regions, so largestFreeRegionSize<freeSize indicates fragmentation
+bool miniFsCompactStep(MiniFs *fs); // moves at most one file down to close the gap before it (so work per call is bounded), returns false if there was nothing to move (the volume is compact)
+
 void miniFsDebug(const MiniFs *fs);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -52,6 +95,7 @@ bool miniFsFileExists(const MiniFs *fs, const char *filename);
 bool miniFsFileExistsKStr(const MiniFs *fs, KStr filename);
 uint16_t miniFsFileGetLen(const MiniFs *fs, const char *filename);
 uint16_t miniFsFileGetSize(const MiniFs *fs, const char *filename);
+bool miniFsFileGetContentRangeKStr(const MiniFs *fs, KStr filename, uint16_t *contentOffset, uint16_t *contentLen); // contentOffset is relative to the start of the volume, so data can be read directly from the underlying storage (only stable while the volume is not modified)
 
 bool miniFsFileCreate(MiniFs *fs, const char *filename, uint16_t size);
 bool miniFsFileDelete(MiniFs *fs, const char *filename);
@@ -0,0 +1,197 @@
+#include <assert.h>
+#include <string.h>
+
+#include "minifscompress.h"
+
+#define MINIFSCOMPRESSMAGICBYTEADDR 0
+#define MINIFSCOMPRESSMAGICBYTEVALUE 90
+#define MINIFSCOMPRESSSIZEADDR (MINIFSCOMPRESSMAGICBYTEADDR+1)
+#define MINIFSCOMPRESSINDEXADDR (MINIFSCOMPRESSSIZEADDR+2)
+
+// Each block is a sequence of tokens:
+// 0x00-0x7F: literal run of (token+1) bytes, which follow the token
+// 0x80-0xFF: match of ((token&0x7F)+3) bytes, copied from (distance+1) bytes back in the same block, where distance is the byte following the token
+#define MINIFSCOMPRESSTOKENMATCHFLAG 0x80
+#define MINIFSCOMPRESSLITERALMAX 128
+#define MINIFSCOMPRESSMATCHMIN 3
+#define MINIFSCOMPRESSMATCHMAX (127+MINIFSCOMPRESSMATCHMIN)
+#define MINIFSCOMPRESSDISTANCEMAX 256
+
+////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////
+
+uint16_t miniFsCompressReadWord(MiniFsReadFunctor *readFunctor, void *functorUserData, uint16_t addr);
+
+uint16_t miniFsCompressBlock(const uint8_t *src, uint16_t srcLen, uint8_t *dest); // dest must have space for at least srcLen+srcLen/MINIFSCOMPRESSLITERALMAX+1 bytes
+
+////////////////////////////////////////////////////////////////////////////////
+// Public functions
+////////////////////////////////////////////////////////////////////////////////
+
+bool miniFsCompressIsVolume(MiniFsReadFunctor *readFunctor, void *functorUserData) {
+	uint8_t magicByte;
+	return (readFunctor(MINIFSCOMPRESSMAGICBYTEADDR, &magicByte, 1, functorUserData)==1 && magicByte==MINIFSCOMPRESSMAGICBYTEVALUE);
+}
+
+uint16_t miniFsCompressGetUncompressedSize(MiniFsReadFunctor *readFunctor, void *functorUserData) {
+	return miniFsCompressReadWord(readFunctor, functorUserData, MINIFSCOMPRESSSIZEADDR);
+}
+
+uint16_t miniFsCompressReadBlock(MiniFsReadFunctor *readFunctor, void *functorUserData, uint8_t blockIndex, uint8_t block[MINIFSCOMPRESSBLOCKSIZE]) {
+	assert(block!=NULL);
+
+	// Compute uncompressed length of this block
+	uint16_t size=miniFsCompressGetUncompressedSize(readFunctor, functorUserData);
+	uint16_t blockCount=(size+MINIFSCOMPRESSBLOCKSIZE-1)/MINIFSCOMPRESSBLOCKSIZE;
+	if (blockIndex>=blockCount)
+		return 0;
+	uint16_t blockLen=(blockIndex+1<blockCount ? MINIFSCOMPRESSBLOCKSIZE : size-blockIndex*MINIFSCOMPRESSBLOCKSIZE);
+
+	// Find compressed data from index
+	uint16_t srcStart=miniFsCompressReadWord(readFunctor, functorUserData, MINIFSCOMPRESSINDEXADDR+2*blockIndex);
+	uint16_t srcEnd=miniFsCompressReadWord(readFunctor, functorUserData, MINIFSCOMPRESSINDEXADDR+2*(blockIndex+1));
+	if (srcEnd<srcStart)
+		return 0;
+
+	// Stored raw?
+	if (srcEnd-srcStart==blockLen)
+		return (readFunctor(srcStart, block, blockLen, functorUserData)==blockLen ? blockLen : 0);
+
+	// Decode tokens
+	uint16_t srcAddr=srcStart, destPos=0;
+	while(srcAddr<srcEnd) {
+		uint8_t token;
+		if (readFunctor(srcAddr++, &token, 1, functorUserData)!=1)
+			return 0;
+
+		if (token & MINIFSCOMPRESSTOKENMATCHFLAG) {
+			uint8_t distanceMinusOne;
+			if (readFunctor(srcAddr++, &distanceMinusOne, 1, functorUserData)!=1)
+				return 0;
+
+			uint16_t matchLen=(token & ~MINIFSCOMPRESSTOKENMATCHFLAG)+MINIFSCOMPRESSMATCHMIN;
+			uint16_t distance=((uint16_t)distanceMinusOne)+1;
+			if (distance>destPos || destPos+matchLen>blockLen)
+				return 0;
+
+			// Copy forwards one byte at a time as matches may overlap their own output
+			for(uint16_t i=0; i<matchLen; ++i, ++destPos)
+				block[destPos]=block[destPos-distance];
+		} else {
+			uint16_t literalLen=((uint16_t)token)+1;
+			if (destPos+literalLen>blockLen || readFunctor(srcAddr, block+destPos, literalLen, functorUserData)!=literalLen)
+				return 0;
+			srcAddr+=literalLen;
+			destPos+=literalLen;
+		}
+	}
+
+	return (destPos==blockLen ? blockLen : 0);
+}
+
+uint16_t miniFsCompressVolume(const uint8_t *src, uint16_t srcLen, uint8_t *dest, uint16_t destMax) {
+	assert(src!=NULL);
+	assert(dest!=NULL);
+
+	uint16_t blockCount=(srcLen+MINIFSCOMPRESSBLOCKSIZE-1)/MINIFSCOMPRESSBLOCKSIZE;
+	if (blockCount>MINIFSCOMPRESSMAXBLOCKS)
+		return 0;
+
+	// Write header
+	uint32_t destLen=MINIFSCOMPRESSINDEXADDR+2*(blockCount+1);
+	if (destLen>destMax)
+		return 0;
+	dest[MINIFSCOMPRESSMAGICBYTEADDR]=MINIFSCOMPRESSMAGICBYTEVALUE;
+	dest[MINIFSCOMPRESSSIZEADDR]=(srcLen>>8);
+	dest[MINIFSCOMPRESSSIZEADDR+1]=(srcLen&0xFF);
+
+	// Compress blocks, writing index entries as we go
+	for(uint16_t blockIndex=0; blockIndex<=blockCount; ++blockIndex) {
+		if (destLen>UINT16_MAX)
+			return 0;
+		dest[MINIFSCOMPRESSINDEXADDR+2*blockIndex]=(destLen>>8);
+		dest[MINIFSCOMPRESSINDEXADDR+2*blockIndex+1]=(destLen&0xFF);
+		if (blockIndex==blockCount)
+			break;
+
+		const uint8_t *blockSrc=src+blockIndex*MINIFSCOMPRESSBLOCKSIZE;
+		uint16_t blockLen=(blockIndex+1<blockCount ? MINIFSCOMPRESSBLOCKSIZE : srcLen-blockIndex*MINIFSCOMPRESSBLOCKSIZE);
+
+		uint8_t compressed[MINIFSCOMPRESSBLOCKSIZE+MINIFSCOMPRESSBLOCKSIZE/MINIFSCOMPRESSLITERALMAX+1];
+		uint16_t compressedLen=miniFsCompressBlock(blockSrc, blockLen, compressed);
+
+		// Store raw if compression does not help (the decompressor detects this from the stored length)
+		const uint8_t *blockData=(compressedLen<blockLen ? compressed : blockSrc);
+		uint16_t blockDataLen=(compressedLen<blockLen ? compressedLen : blockLen);
+		if (destLen+blockDataLen>destMax)
+			return 0;
+		memcpy(dest+destLen, blockData, blockDataLen);
+		destLen+=blockDataLen;
+	}
+
+	return destLen;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Private functions
+////////////////////////////////////////////////////////////////////////////////
+
+uint16_t miniFsCompressReadWord(MiniFsReadFunctor *readFunctor, void *functorUserData, uint16_t addr) {
+	uint8_t data[2];
+	if (readFunctor(addr, data, 2, functorUserData)!=2)
+		return 0;
+	return (((uint16_t)data[0])<<8)|data[1];
+}
+
+uint16_t miniFsCompressBlock(const uint8_t *src, uint16_t srcLen, uint8_t *dest) {
+	assert(src!=NULL);
+	assert(dest!=NULL);
+
+	uint16_t destLen=0;
+	uint16_t literalStart=0, literalLen=0;
+	uint16_t pos=0;
+	while(pos<srcLen) {
+		// Greedily find longest match within the window
+		uint16_t bestLen=0, bestDistance=0;
+		uint16_t windowStart=(pos>MINIFSCOMPRESSDISTANCEMAX ? pos-MINIFSCOMPRESSDISTANCEMAX : 0);
+		for(uint16_t candidate=windowStart; candidate<pos; ++candidate) {
+			uint16_t len=0;
+			while(len<MINIFSCOMPRESSMATCHMAX && pos+len<srcLen && src[candidate+len]==src[pos+len])
+				++len;
+			if (len>bestLen) {
+				bestLen=len;
+				bestDistance=pos-candidate;
+			}
+		}
+
+		// Flush pending literals if needed (either full or about to emit a match)
+		bool match=(bestLen>=MINIFSCOMPRESSMATCHMIN);
+		if (literalLen>0 && (match || literalLen==MINIFSCOMPRESSLITERALMAX)) {
+			dest[destLen++]=literalLen-1;
+			memcpy(dest+destLen, src+literalStart, literalLen);
+			destLen+=literalLen;
+			literalLen=0;
+		}
+
+		if (match) {
+			dest[destLen++]=MINIFSCOMPRESSTOKENMATCHFLAG|(bestLen-MINIFSCOMPRESSMATCHMIN);
+			dest[destLen++]=bestDistance-1;
+			pos+=bestLen;
+		} else {
+			if (literalLen==0)
+				literalStart=pos;
+			++literalLen;
+			++pos;
+		}
+	}
+
+	// Flush final literals
+	if (literalLen>0) {
+		dest[destLen++]=literalLen-1;
+		memcpy(dest+destLen, src+literalStart, literalLen);
+		destLen+=literalLen;
+	}
+
+	return destLen;
+}
@@ -0,0 +1,22 @@
+#ifndef MINIFSCOMPRESS_H
+#define MINIFSCOMPRESS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "minifs.h"
+
+// A compressed volume wraps a standard (read-only) MiniFs image, splitting it into fixed size blocks which are compressed independently.
+// An index of block offsets follows the header so that random access only requires decompressing a single block.
+// Layout: magic byte, uncompressed size (2 bytes BE), then blockCount+1 block offsets (2 bytes BE each, relative to start of volume), then block data.
+// Blocks which do not compress are stored raw (their stored length equals their uncompressed length).
+#define MINIFSCOMPRESSBLOCKSIZE 256u
+#define MINIFSCOMPRESSMAXBLOCKS (MINIFSMAXSIZE/MINIFSCOMPRESSBLOCKSIZE)
+
+bool miniFsCompressIsVolume(MiniFsReadFunctor *readFunctor, void *functorUserData); // checks magic byte
+uint16_t miniFsCompressGetUncompressedSize(MiniFsReadFunctor *readFunctor, void *functorUserData);
+uint16_t miniFsCompressReadBlock(MiniFsReadFunctor *readFunctor, void *functorUserData, uint8_t blockIndex, uint8_t block[MINIFSCOMPRESSBLOCKSIZE]); // decompresses given block into given buffer, returning its length (0 on failure, less than MINIFSCOMPRESSBLOCKSIZE only for the final block)
+
+uint16_t miniFsCompressVolume(const uint8_t *src, uint16_t srcLen, uint8_t *dest, uint16_t destMax); // used by tools to create compressed volumes, returns size written (0 on failure)
+
+#endif
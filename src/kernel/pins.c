@@ -1,4 +1,5 @@
 #ifdef ARDUINO
+#include <avr/interrupt.h>
 #include <avr/io.h>
 #endif
 #include <stdlib.h>
@@ -33,6 +34,24 @@ volatile uint8_t *pinsArrayPort[PinsGroupMax]={&PORTA, &PORTB, &PORTC, &PORTD, &
 #define PinNumGetGroup(pinNum) ((pinNum)>>3)
 #define PinNumGetShift(pinNum) ((pinNum)&7)
 
+#define PinsChangeBankNB 3 // PCINT0-7, PCINT8-15 and PCINT16-23
+volatile uint8_t *pinsChangeMasks[PinsChangeBankNB]={&PCMSK0, &PCMSK1, &PCMSK2};
+volatile uint8_t pinsChangeCounts[PinsChangeBankNB];
+
+bool pinsChangeGetBankBit(uint8_t pinNum, uint8_t *bank, uint8_t *bit); // returns false if pin does not support pin change interrupts
+
+ISR(PCINT0_vect) {
+	++pinsChangeCounts[0];
+}
+
+ISR(PCINT1_vect) {
+	++pinsChangeCounts[1];
+}
+
+ISR(PCINT2_vect) {
+	++pinsChangeCounts[2];
+}
+
 #else
 
 bool pinStates[PinNB]={0};
@@ -124,6 +143,50 @@ bool pinWrite(uint8_t pinNum, bool value) {
 	return true;
 }
 
+bool pinChangeIsSupported(uint8_t pinNum) {
+	if (!pinIsValid(pinNum))
+		return false;
+#ifdef ARDUINO
+	uint8_t bank, bit;
+	return pinsChangeGetBankBit(pinNum, &bank, &bit);
+#else
+	return false;
+#endif
+}
+
+void pinChangeSetEnabled(uint8_t pinNum, bool enabled) {
+#ifdef ARDUINO
+	uint8_t bank, bit;
+	if (!pinIsValid(pinNum) || !pinsChangeGetBankBit(pinNum, &bank, &bit))
+		return;
+
+	// Update pin's bit in the mask register, and enable/disable the interrupt as a whole depending on whether any pins are left
+	uint8_t oldSReg=SREG;
+	cli();
+	if (enabled)
+		*pinsChangeMasks[bank]|=(1u<<bit);
+	else
+		*pinsChangeMasks[bank]&=~(1u<<bit);
+	if (*pinsChangeMasks[bank]!=0)
+		PCICR|=(1u<<bank);
+	else
+		PCICR&=~(1u<<bank);
+	SREG=oldSReg;
+#endif
+// Null-op on PC
+}
+
+uint8_t pinChangeGetCount(uint8_t pinNum) {
+#ifdef ARDUINO
+	uint8_t bank, bit;
+	if (!pinIsValid(pinNum) || !pinsChangeGetBankBit(pinNum, &bank, &bit))
+		return 0;
+	return pinsChangeCounts[bank];
+#else
+	return 0;
+#endif
+}
+
 void pinsDebug(void) {
 	kernelLog(LogTypeInfo, kstrP("Pins Info:\n"));
 	for(unsigned i=0; i<PinNB; ++i) {
@@ -133,3 +196,36 @@ void pinsDebug(void) {
 		kernelLog(LogTypeInfo, kstrP("	%u - state=%u (%s)\n"), i, pinRead(i), (pinInUse(i) ? "used" : "free"));
 	}
 }
+
+#ifdef ARDUINO
+bool pinsChangeGetBankBit(uint8_t pinNum, uint8_t *bank, uint8_t *bit) {
+	uint8_t shift=PinNumGetShift(pinNum);
+	switch(PinNumGetGroup(pinNum)) {
+		case 1: // PB0-7 are PCINT0-7
+			*bank=0;
+			*bit=shift;
+			return true;
+		break;
+		case 4: // PE0 is PCINT8
+			if (shift!=0)
+				return false;
+			*bank=1;
+			*bit=0;
+			return true;
+		break;
+		case 9: // PJ0-6 are PCINT9-15
+			if (shift>6)
+				return false;
+			*bank=1;
+			*bit=shift+1;
+			return true;
+		break;
+		case 10: // PK0-7 are PCINT16-23
+			*bank=2;
+			*bit=shift;
+			return true;
+		break;
+	}
+	return false;
+}
+#endif
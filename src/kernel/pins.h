@@ -97,6 +97,13 @@ void pinSetMode(uint8_t pinNum, PinMode mode);
 bool pinRead(uint8_t pinNum);
 bool pinWrite(uint8_t pinNum, bool value);
 
+// Pin change interrupts (Arduino only - on the Mega only pins on ports B, J, K and PE0 support these, and on PC no pins do).
+// Each count is incremented from an interrupt whenever any enabled pin sharing the same interrupt as the given pin changes level,
+// so a change in count tells the caller that one of its pins may have changed (and so is worth reading), rather than which one.
+bool pinChangeIsSupported(uint8_t pinNum);
+void pinChangeSetEnabled(uint8_t pinNum, bool enabled); // no-op if pin does not support pin change interrupts
+uint8_t pinChangeGetCount(uint8_t pinNum); // always 0 if pin does not support pin change interrupts
+
 void pinsDebug(void);
 
 #endif
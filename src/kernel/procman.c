@@ -9,6 +9,7 @@
 #include <alloca.h>
 #else
 #include <libgen.h>
+#include <pthread.h>
 #include <unistd.h>
 #endif
 
@@ -20,6 +21,7 @@
 #include "pins.h"
 #include "procman.h"
 #include "profile.h"
+#include "snapshot.h"
 #include "spi.h"
 #include "tty.h"
 #include "util.h"
@@ -27,6 +29,8 @@
 #define procManProcessInstructionCounterMax (65500u) // largest 16 bit unsigned number, less a small safety margin
 #define procManProcessInstructionsPerTick 160 // generally a higher value causes faster execution, but decreased responsiveness if many processes running
 #define procManTicksPerInstructionCounterReset (procManProcessInstructionCounterMax/procManProcessInstructionsPerTick)
+#define procManDirGetChildrenBufferTooSmallFlag 32768u // set in the value returned by the dirgetchildren syscall if the next child's name does not fit into the buffer at all, with the lower bits giving the size needed (counts cannot reach this as each name needs at least 2 bytes)
+#define procManProcessBlockChunkSize 64 // max bytes copied/filled by a single execution of a copyblock/fillblock instruction, bounding the time taken before the process can be interrupted
 
 #define ProcManSignalHandlerInvalid 0
 
@@ -37,6 +41,21 @@
 
 #define ProcManEnvVarsVirtualOffset ((BytecodeWord)64512u) // =63k - we map things like argv in to last 1kb of process memory
 
+#ifdef ARDUINO
+#define ProcManExecCacheSize 2
+#else
+#define ProcManExecCacheSize 8
+#endif
+#define ProcManExecCacheDirsMax 4 // searches through more PATH directories than this are not cached
+
+#define ProcManTextMax ProcManPidMax
+#define ProcManTextIndexInvalid ProcManTextMax
+
+#define ProcManWorkersMax ProcManPidMax // max host threads used to tick processes (PC only, see procManTickAll)
+
+#define ProcManProfileStackTableSize 1024 // max distinct call stacks recorded per process when sampling (must be a power of 2), see --profile-stacks
+#define ProcManProfileStackScanMax 128 // max bytes of stack searched for return addresses per sample
+
 typedef enum {
 	ProcManProcessStateUnused,
 	ProcManProcessStateActive,
@@ -45,6 +64,10 @@ typedef enum {
 	ProcManProcessStateWaitingRead32,
 	ProcManProcessStateWaitingWrite,
 	ProcManProcessStateWaitingWrite32,
+	ProcManProcessStateWaitingBlockRead, // waiting for a block device to fetch data in the background (e.g. an SD card transfer)
+	ProcManProcessStateWaitingBlockRead32,
+	ProcManProcessStateWaitingSleep, // woken by timer (see procManTimerAdd)
+	ProcManProcessStateWaitingFutex, // woken by a futexwake syscall from a process sharing the same ram
 	ProcManProcessStateExiting,
 } ProcManProcessState;
 
@@ -69,8 +92,7 @@ struct ProcManProcessProcData {
 };
 
 typedef struct {
-	uint64_t pid:8;
-	uint64_t timeoutTime:48; // set to 0 if infinite. note: we take the lowest 48 bits of the time, which is zero for the first ~8900 years after the system is booted
+	ProcManPid pid; // any timeout is handled by a timer (see procManTimerAdd)
 } ProcManProcessStateWaitingWaitpidData;
 
 typedef struct {
@@ -89,9 +111,20 @@ typedef struct {
 	KernelFsFd globalFd;
 } ProcManProcessStateWaitingWrite32Data;
 
+typedef struct {
+	KernelFsFd globalFd;
+	KernelFsFileOffset offset;
+} ProcManProcessStateWaitingBlockReadData;
+
+typedef struct {
+	BytecodeWord addr;
+} ProcManProcessStateWaitingFutexData;
+
 typedef struct {
 	uint16_t instructionCounter; // reset regularly
 	KernelFsFd progmemFd, procFd;
+	ProcManPid ramOwnerPid; // pid of the process which owns the ram file we use - this is our own pid unless we were created by the clone syscall (i.e. are a thread)
+	uint8_t textIndex; // index into shared text table if progmem file could be mapped, ProcManTextIndexInvalid otherwise (in which case reads go via progmemFd)
 	uint8_t state;
 	union {
 		ProcManProcessStateWaitingWaitpidData waitingWaitpid;
@@ -99,18 +132,86 @@ typedef struct {
 		ProcManProcessStateWaitingRead32Data waitingRead32;
 		ProcManProcessStateWaitingWriteData waitingWrite;
 		ProcManProcessStateWaitingWrite32Data waitingWrite32;
+		ProcManProcessStateWaitingBlockReadData waitingBlockRead; // used by both WaitingBlockRead and WaitingBlockRead32 states
+		ProcManProcessStateWaitingFutexData waitingFutex;
 	} stateData;
+	ProcManProcessProcData *tickProcData; // while the process is being ticked this points to its loaded proc data (which is more recent than its proc file, and stored back to it at the end of the tick), otherwise NULL
 #ifndef ARDUINO
-	ProfileCounter profilingCounts[BytecodeMemoryProgmemSize];
+	// Signals and kills directed at a process which is mid-tick on another host thread are deferred until that thread next holds the kernel lock (see procManProcessTickHandlePending)
+	uint8_t pendingSignals; // bitmask of BytecodeSignalIds
+	bool pendingKill;
+	ProcManExitStatus pendingKillExitStatus;
+
+	// Profiling data is only allocated if requested via kernel flags (see procManProcessProfileInit)
+	ProfileCounter *profilingCounts; // indexed by IP, BytecodeMemoryProgmemSize entries (--profile)
+	ProfileStack *profilingStacks; // hash table of ProcManProfileStackTableSize sampled stacks (--profile-stacks)
+	uint32_t profilingStacksDropped; // samples not recorded due to the table being full
+	uint32_t profilingStackCountdown; // instructions left until the next sample
+
+	ProcManProcessStats stats;
 #endif
 } ProcManProcess;
 
+typedef struct {
+	char envPath[KernelFsPathMax]; // PATH string searched (longer PATH strings are not cached)
+	char path[KernelFsPathMax]; // result of searching PATH for the exec name (whose basename is therefore the exec name), empty if entry is unused
+	uint16_t dirTokens[ProcManExecCacheDirsMax]; // dir generation tokens for each PATH directory checked (see kernelFsGetDirGenerationToken)
+	uint8_t dirCount;
+} ProcManExecCacheEntry;
+
+typedef struct {
+	KernelFsFileMapping mapping;
+	uint8_t refCount; // number of processes using this entry, 0 if unused
+} ProcManText; // shared between all processes running the same executable
+
 typedef struct {
 	ProcManProcess processes[ProcManPidMax];
 	uint16_t ticksSinceLastInstructionCounterReset;
+
+	ProcManText texts[ProcManTextMax];
+
+	// Cache of PATH searches done during exec, invalidated whenever the filesystem changes in a way which could alter the result
+	ProcManExecCacheEntry execCache[ProcManExecCacheSize];
+	uint16_t execCacheGeneration;
+	uint8_t execCacheNext; // entry to replace next (round-robin)
+	uint32_t execCacheHits, execCacheMisses;
+
+#ifndef ARDUINO
+	// Totals since boot, for benchmarking (see --bench kernel option)
+	uint64_t instructionTotal; // updated atomically at the end of each tick, as ticks may run on several host threads
+	uint32_t syscallCounts[ProcManSyscallCountsMax]; // indexed by syscall id (syscalls always run with the kernel lock held)
+	uint32_t syscallTotal;
+
+	uint32_t statsWaitLastTime; // lower 32 bits of monotonic ms time procManTickAll last ran, used to update ProcManProcessStats.waitMs
+#endif
+
+	// Min-heap of wake times for sleeping processes and waitpid timeouts, so that expiries can be found without inspecting each waiting process every tick.
+	// Each process has at most one timer. Times are the lower 32 bits of the monotonic ms time, compared allowing for wrap around.
+	uint32_t timerTimes[ProcManPidMax];
+	ProcManPid timerPids[ProcManPidMax];
+	uint8_t timerCount;
+
+#ifndef ARDUINO
+	// Optional pool of host threads which tick processes in parallel (see procManTickAll).
+	// Only register-only instructions run concurrently - everything else (memory access, syscalls, and so kernelfs access in general) is serialised by kernelLock.
+	uint8_t workerCount; // including the main thread, so 1 if not using extra threads
+	pthread_t workerThreads[ProcManWorkersMax];
+	pthread_mutex_t kernelLock;
+	pthread_mutex_t roundMutex;
+	pthread_cond_t roundStartCond, roundEndCond;
+	uint32_t roundGeneration; // incremented to start each round
+	uint8_t roundWorkersBusy; // number of extra threads yet to finish the current round
+	ProcManPid roundNextPid; // next pid to tick in the current round (accessed atomically)
+	bool workersQuit;
+#endif
 } ProcMan;
 ProcMan procManData;
 
+#ifndef ARDUINO
+__thread bool procManKernelLockHeld=false;
+__thread ProcManPid procManWorkerTickPid=ProcManPidMax; // process the calling host thread is ticking, if any
+#endif
+
 char procManScratchBufPath0[KernelFsPathMax];
 char procManScratchBufPath1[KernelFsPathMax];
 char procManScratchBufPath2[KernelFsPathMax];
@@ -124,6 +225,16 @@ typedef struct {
 
 void procManPrefetchDataClear(ProcManPrefetchData *pd);
 bool procManPrefetchDataReadByte(ProcManPrefetchData *pd, ProcManProcess *process, ProcManProcessProcData *procData, uint16_t addr, uint8_t *value);
+bool procManPrefetchDataCanExecUnlocked(const ProcManPrefetchData *pd, uint16_t addr); // true if the instruction at addr only touches registers and is already prefetched (so can run without the kernel lock)
+
+#ifndef ARDUINO
+void *procManWorkerThreadMain(void *userData);
+void procManWorkersRunRound(void); // ticks each process once, spread across all host threads
+void procManWorkersRunRoundTicks(void); // ticks processes until none are left in the current round
+#endif
+void procManKernelLock(void); // these are no-ops unless ticking processes on several host threads
+void procManKernelUnlock(void);
+bool procManKernelLockIsHeld(void); // always true if not using several host threads
 
 ////////////////////////////////////////////////////////////////////////////////
 // Private prototypes
@@ -132,6 +243,15 @@ bool procManPrefetchDataReadByte(ProcManPrefetchData *pd, ProcManProcess *proces
 ProcManProcess *procManGetProcessByPid(ProcManPid pid);
 ProcManPid procManGetPidFromProcess(const ProcManProcess *process);
 const char *procManGetExecPathFromProcess(const ProcManProcess *process);
+#ifndef ARDUINO
+ProcManWaitType procManProcessStateToWaitType(uint8_t state); // returns ProcManWaitTypeNB for non-waiting states
+void procManStatsToBigEndian(const ProcManProcessStats *stats, uint8_t *record); // record should have space for sizeof(ProcManProcessStats) bytes
+
+void procManProcessProfileInit(ProcManProcess *process); // allocates (or clears, if reusing a slot) whichever profiling data the kernel flags ask for
+void procManProcessProfileFree(ProcManProcess *process);
+void procManProcessProfileSave(ProcManProcess *process); // writes any profiling data to files in the current directory
+void procManProcessProfileSampleStack(ProcManProcess *process, ProcManProcessProcData *procData); // records the current call stack (see --profile-stacks)
+#endif
 
 ProcManPid procManFindUnusedPid(void);
 
@@ -142,12 +262,20 @@ bool procManProcessLoadProcDataRamLen(const ProcManProcess *process, uint16_t *v
 bool procManProcessLoadProcDataEnvVarDataLen(const ProcManProcess *process, uint8_t *value);
 bool procManProcessLoadProcDataRamFd(const ProcManProcess *process, KernelFsFd *ramFd);
 bool procManProcessSaveProcDataReg(const ProcManProcess *process, BytecodeRegister reg, BytecodeWord value);
+bool procManProcessSaveProcDataRam(const ProcManProcess *process, KernelFsFd ramFd, uint16_t ramLen);
+
+bool procManProcessIsThread(const ProcManProcess *process); // true if process was created by the clone syscall (and so does not own its ram file)
+bool procManProcessIsTickingElsewhere(const ProcManProcess *process); // true if process is mid-tick on another host thread
+bool procManProcessTickHandlePending(ProcManProcess *process, ProcManExitStatus *exitStatus); // delivers any signals deferred while the process was mid-tick, returning false (and setting exitStatus) if it should be killed instead. Kernel lock must be held.
+void procManProcessKillThreads(ProcManPid ramOwnerPid); // kills all threads using the given process' ram file (but not the process itself)
+void procManProcessUpdateThreadsRam(const ProcManProcess *process, const ProcManProcessProcData *procData); // copies ram fd and len into all other processes sharing the same ram file, after it has been resized
 
 bool procManProcessMemoryReadByte(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, uint8_t *value);
 bool procManProcessMemoryReadWord(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, BytecodeWord *value);
 bool procManProcessMemoryReadDoubleWord(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, BytecodeDoubleWord *value);
 bool procManProcessMemoryReadStr(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, char *str, uint16_t len);
 bool procManProcessMemoryReadBlock(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, uint8_t *data, uint16_t len, bool verbose); // block should not cross split in memory between two types
+bool procManProcessProgmemRead(ProcManProcess *process, BytecodeWord addr, uint8_t *data, uint16_t len);
 bool procManProcessMemoryWriteByte(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, uint8_t value);
 bool procManProcessMemoryWriteWord(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, BytecodeWord value);
 bool procManProcessMemoryWriteDoubleWord(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, BytecodeDoubleWord value);
@@ -165,12 +293,17 @@ bool procManProcessExecInstructionMisc(ProcManProcess *process, ProcManProcessPr
 bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *procData, ProcManExitStatus *exitStatus);
 
 void procManProcessFork(ProcManProcess *process, ProcManProcessProcData *procData);
+void procManProcessClone(ProcManProcess *process, ProcManProcessProcData *procData);
 bool procManProcessExec(ProcManProcess *process, ProcManProcessProcData *procData); // Returns false only on critical error (e.g. segfault), i.e. may return true even though exec operation itself failed
 bool procManProcessExec2(ProcManProcess *process, ProcManProcessProcData *procData); // See procManProcessExec
 bool procManProcessExecCommon(ProcManProcess *process, ProcManProcessProcData *procData, uint8_t argc, char *argv);
 
 KernelFsFd procManProcessLoadProgmemFile(ProcManProcess *process, uint8_t *argc, char *argvStart, const char *envPath, const char *envPwd); // Loads executable tiles, reading the magic byte (and potentially recursing), before returning fd of final executable (or KernelFsFdInvalid on failure)
 
+bool procManExecCacheEntryMatches(const ProcManExecCacheEntry *entry, const char *name, const char *envPath);
+bool procManExecCacheLookup(const char *name, const char *envPath, char path[KernelFsPathMax]); // if name has been searched for with the same PATH since the filesystem last changed, copies the result into path and returns true
+void procManExecCacheAdd(const char *name, const char *envPath, const char *path, const uint16_t *dirTokens, uint8_t dirCount);
+
 bool procManProcessMemoryStrlen(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord strAddr, BytecodeWord *len);
 bool procManProcessMemmove(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord destAddr, BytecodeWord srcAddr, BytecodeWord size);
 
@@ -189,6 +322,18 @@ KernelFsFd procManProcessGetGlobalFdFromLocalWithPid(ProcManPid pid, ProcManLoca
 
 void procManResetInstructionCounters(void);
 
+void procManTimerAdd(ProcManPid pid, uint32_t time); // process should not already have a timer
+void procManTimerRemove(ProcManPid pid); // does nothing if process has no timer
+void procManTimerRemoveIndex(uint8_t index);
+void procManTimerExpire(ProcManPid pid); // wakes process once its timer has expired
+bool procManTimerIsBefore(uint8_t indexA, uint8_t indexB);
+void procManTimerSwap(uint8_t indexA, uint8_t indexB);
+void procManTimerSiftUp(uint8_t index);
+void procManTimerSiftDown(uint8_t index);
+
+void procManProcessAttachText(ProcManProcess *process); // looks for (or creates) a shared text entry for the process' progmem file
+void procManProcessDetachText(ProcManProcess *process); // should be called before closing progmem fd
+
 void procManProcessDebug(ProcManProcess *process, ProcManProcessProcData *procData);
 
 char *procManArgvStringGetArgN(uint8_t argc, char *argvStart, uint8_t n);
@@ -203,27 +348,131 @@ void procManArgvDebug(uint8_t argc, const char *argvStart);
 ////////////////////////////////////////////////////////////////////////////////
 
 void procManInit(void) {
+	// Clear timers
+	procManData.timerCount=0;
+
 	// Clear processes table
 	for(ProcManPid i=0; i<ProcManPidMax; ++i) {
 		procManData.processes[i].state=ProcManProcessStateUnused;
 		procManData.processes[i].progmemFd=KernelFsFdInvalid;
 		procManData.processes[i].procFd=KernelFsFdInvalid;
+		procManData.processes[i].textIndex=ProcManTextIndexInvalid;
+		procManData.processes[i].ramOwnerPid=i;
+		procManData.processes[i].tickProcData=NULL;
 		procManData.processes[i].instructionCounter=0;
+#ifndef ARDUINO
+		procManData.processes[i].pendingSignals=0;
+		procManData.processes[i].pendingKill=false;
+#endif
 	}
 
+	// Clear shared text table
+	for(uint8_t i=0; i<ProcManTextMax; ++i)
+		procManData.texts[i].refCount=0;
+
 	// Clear other fields
 	procManData.ticksSinceLastInstructionCounterReset=0;
+
+	// Clear exec cache
+	for(uint8_t i=0; i<ProcManExecCacheSize; ++i)
+		procManData.execCache[i].path[0]='\0';
+	procManData.execCacheGeneration=kernelFsGetGeneration();
+	procManData.execCacheNext=0;
+	procManData.execCacheHits=0;
+	procManData.execCacheMisses=0;
+
+#ifndef ARDUINO
+	// Clear benchmarking totals
+	procManData.instructionTotal=0;
+	memset(procManData.syscallCounts, 0, sizeof(procManData.syscallCounts));
+	procManData.syscallTotal=0;
+	procManData.statsWaitLastTime=ktimeGetMonotonicMs();
+
+	// Start extra host threads to tick processes in parallel, if requested
+	procManData.workerCount=1;
+	procManData.roundGeneration=0;
+	procManData.workersQuit=false;
+	uint8_t targetCount=MIN(kernelFlagThreads, ProcManWorkersMax);
+	long cpuCount=sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpuCount>0 && targetCount>cpuCount) {
+		// More threads than cores would only contend for the kernel lock
+		kernelLog(LogTypeWarning, kstrP("only %li host cores available, using %li host threads rather than %u for ticking processes\n"), cpuCount, cpuCount, targetCount);
+		targetCount=cpuCount;
+	}
+	if (targetCount>1) {
+		pthread_mutex_init(&procManData.kernelLock, NULL);
+		pthread_mutex_init(&procManData.roundMutex, NULL);
+		pthread_cond_init(&procManData.roundStartCond, NULL);
+		pthread_cond_init(&procManData.roundEndCond, NULL);
+
+		while(procManData.workerCount<targetCount) {
+			if (pthread_create(&procManData.workerThreads[procManData.workerCount], NULL, &procManWorkerThreadMain, NULL)!=0) {
+				kernelLog(LogTypeWarning, kstrP("could only start %u/%u host threads for ticking processes\n"), procManData.workerCount, targetCount);
+				break;
+			}
+			++procManData.workerCount;
+		}
+		kernelLog(LogTypeInfo, kstrP("ticking processes on %u host threads\n"), procManData.workerCount);
+	}
+#endif
 }
 
 void procManQuit(void) {
 	// Kill all processes
 	procManKillAll();
+
+#ifndef ARDUINO
+	// Stop any extra host threads
+	if (procManData.workerCount>1) {
+		pthread_mutex_lock(&procManData.roundMutex);
+		procManData.workersQuit=true;
+		pthread_cond_broadcast(&procManData.roundStartCond);
+		pthread_mutex_unlock(&procManData.roundMutex);
+
+		for(uint8_t i=1; i<procManData.workerCount; ++i)
+			pthread_join(procManData.workerThreads[i], NULL);
+		procManData.workerCount=1;
+	}
+
+	// Free profiling data left in any slots which failed during process creation
+	for(ProcManPid pid=0; pid<ProcManPidMax; ++pid)
+		procManProcessProfileFree(&procManData.processes[pid]);
+#endif
+
+	// Log exec cache statistics
+	kernelLog(LogTypeInfo, kstrP("exec cache: %"PRIu32" hits, %"PRIu32" misses\n"), procManData.execCacheHits, procManData.execCacheMisses);
 }
 
 void procManTickAll(void) {
+	// Wake any processes whose timers have expired
+	uint32_t now=ktimeGetMonotonicMs();
+	while(procManData.timerCount>0 && (int32_t)(procManData.timerTimes[0]-now)<=0) {
+		ProcManPid timerPid=procManData.timerPids[0];
+		procManTimerRemoveIndex(0);
+		procManTimerExpire(timerPid);
+	}
+
+#ifndef ARDUINO
+	// Charge time since the last call to any processes which are blocked
+	uint32_t waitDelta=now-procManData.statsWaitLastTime;
+	procManData.statsWaitLastTime=now;
+	for(ProcManPid pid=0; pid<ProcManPidMax; ++pid) {
+		ProcManProcess *process=procManGetProcessByPid(pid);
+		if (process==NULL)
+			continue;
+		ProcManWaitType waitType=procManProcessStateToWaitType(process->state);
+		if (waitType!=ProcManWaitTypeNB)
+			process->stats.waitMs[waitType]+=waitDelta;
+	}
+#endif
+
 	// Run single tick for each process
-	ProcManPid pid;
-	for(pid=0; pid<ProcManPidMax; ++pid)
+#ifndef ARDUINO
+	if (procManData.workerCount>1)
+		procManWorkersRunRound();
+	else
+#endif
+	for(ProcManPid pid=0; pid<ProcManPidMax; ++pid)
 		procManProcessTick(pid);
 
 	// Have we ran enough ticks to reset the instruction counters? (they are about to overflow)
@@ -234,6 +483,18 @@ void procManTickAll(void) {
 	}
 }
 
+bool procManGetNextTimerTime(KTime *time) {
+	assert(time!=NULL);
+
+	if (procManData.timerCount==0)
+		return false;
+
+	// Reconstruct full time from the lower 32 bits (timers are never more than ~24 days in the future)
+	KTime now=ktimeGetMonotonicMs();
+	*time=now+(int32_t)(procManData.timerTimes[0]-(uint32_t)now);
+	return true;
+}
+
 ProcManPid procManGetProcessCount(void) {
 	ProcManPid count=0;
 	ProcManPid pid;
@@ -242,6 +503,155 @@ ProcManPid procManGetProcessCount(void) {
 	return count;
 }
 
+uint32_t procManGetExecCacheHits(void) {
+	return procManData.execCacheHits;
+}
+
+uint32_t procManGetExecCacheMisses(void) {
+	return procManData.execCacheMisses;
+}
+
+#ifndef ARDUINO
+uint64_t procManGetInstructionTotal(void) {
+	return __atomic_load_n(&procManData.instructionTotal, __ATOMIC_RELAXED);
+}
+
+uint32_t procManGetSyscallCount(uint16_t syscallId) {
+	return (syscallId<ProcManSyscallCountsMax ? procManData.syscallCounts[syscallId] : 0);
+}
+
+uint32_t procManGetSyscallTotal(void) {
+	return procManData.syscallTotal;
+}
+
+uint32_t procManStatsFsFunctor(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr) {
+	switch(type) {
+		case KernelFsDeviceFunctorTypeCommonFlush:
+			return true;
+		break;
+		case KernelFsDeviceFunctorTypeCharacterRead:
+		break;
+		case KernelFsDeviceFunctorTypeCharacterCanRead:
+		break;
+		case KernelFsDeviceFunctorTypeCharacterWrite:
+		break;
+		case KernelFsDeviceFunctorTypeCharacterCanWrite:
+		break;
+		case KernelFsDeviceFunctorTypeBlockRead: {
+			// Copy out whichever parts of the per-pid records overlap the requested range
+			KernelFsFileOffset i=0;
+			while(i<len) {
+				ProcManPid pid=(addr+i)/sizeof(ProcManProcessStats);
+				KernelFsFileOffset recordOffset=(addr+i)%sizeof(ProcManProcessStats);
+				if (pid>=ProcManPidMax)
+					break;
+
+				ProcManProcessStats stats;
+				if (!procManProcessGetStats(pid, &stats))
+					memset(&stats, 0, sizeof(stats));
+				uint8_t record[sizeof(ProcManProcessStats)];
+				procManStatsToBigEndian(&stats, record);
+
+				KernelFsFileOffset chunkSize=sizeof(ProcManProcessStats)-recordOffset;
+				if (chunkSize>len-i)
+					chunkSize=len-i;
+				memcpy(data+i, record+recordOffset, chunkSize);
+				i+=chunkSize;
+			}
+			return i;
+		} break;
+		case KernelFsDeviceFunctorTypeBlockWrite:
+			return 0; // read-only
+		break;
+		case KernelFsDeviceFunctorTypeBlockCanRead:
+			return true; // never blocks
+		break;
+	}
+
+	assert(false);
+	return 0;
+}
+
+bool procManSnapshotSave(FILE *file) {
+	assert(file!=NULL);
+
+	// Save process table (skipping fields which are rebuilt on load, such as the shared text index and profiling data)
+	for(ProcManPid pid=0; pid<ProcManPidMax; ++pid) {
+		const ProcManProcess *process=&procManData.processes[pid];
+		assert(process->tickProcData==NULL);
+
+		if (!snapshotWrite(file, &process->state, sizeof(process->state)))
+			return false;
+		if (process->state==ProcManProcessStateUnused)
+			continue;
+
+		if (!snapshotWrite(file, &process->instructionCounter, sizeof(process->instructionCounter)) ||
+		    !snapshotWrite(file, &process->progmemFd, sizeof(process->progmemFd)) ||
+		    !snapshotWrite(file, &process->procFd, sizeof(process->procFd)) ||
+		    !snapshotWrite(file, &process->ramOwnerPid, sizeof(process->ramOwnerPid)) ||
+		    !snapshotWrite(file, &process->stateData, sizeof(process->stateData)) ||
+		    !snapshotWrite(file, &process->pendingSignals, sizeof(process->pendingSignals)) ||
+		    !snapshotWrite(file, &process->pendingKill, sizeof(process->pendingKill)) ||
+		    !snapshotWrite(file, &process->pendingKillExitStatus, sizeof(process->pendingKillExitStatus)) ||
+		    !snapshotWrite(file, &process->stats, sizeof(process->stats)))
+			return false;
+	}
+
+	// Save timers (as times are monotonic, and monotonic time carries on from the snapshot when loaded, these need no adjustment)
+	return snapshotWrite(file, &procManData.ticksSinceLastInstructionCounterReset, sizeof(procManData.ticksSinceLastInstructionCounterReset)) &&
+	       snapshotWrite(file, &procManData.timerCount, sizeof(procManData.timerCount)) &&
+	       snapshotWrite(file, procManData.timerTimes, sizeof(procManData.timerTimes)) &&
+	       snapshotWrite(file, procManData.timerPids, sizeof(procManData.timerPids));
+}
+
+bool procManSnapshotLoad(FILE *file) {
+	assert(file!=NULL);
+
+	// Restore process table
+	for(ProcManPid pid=0; pid<ProcManPidMax; ++pid) {
+		ProcManProcess *process=&procManData.processes[pid];
+		assert(process->state==ProcManProcessStateUnused);
+
+		uint8_t state;
+		if (!snapshotRead(file, &state, sizeof(state)) || state>ProcManProcessStateExiting)
+			return false;
+		if (state==ProcManProcessStateUnused)
+			continue;
+
+		if (!snapshotRead(file, &process->instructionCounter, sizeof(process->instructionCounter)) ||
+		    !snapshotRead(file, &process->progmemFd, sizeof(process->progmemFd)) ||
+		    !snapshotRead(file, &process->procFd, sizeof(process->procFd)) ||
+		    !snapshotRead(file, &process->ramOwnerPid, sizeof(process->ramOwnerPid)) ||
+		    !snapshotRead(file, &process->stateData, sizeof(process->stateData)) ||
+		    !snapshotRead(file, &process->pendingSignals, sizeof(process->pendingSignals)) ||
+		    !snapshotRead(file, &process->pendingKill, sizeof(process->pendingKill)) ||
+		    !snapshotRead(file, &process->pendingKillExitStatus, sizeof(process->pendingKillExitStatus)) ||
+		    !snapshotRead(file, &process->stats, sizeof(process->stats)))
+			return false;
+		if (process->progmemFd==KernelFsFdInvalid || process->procFd==KernelFsFdInvalid || process->ramOwnerPid>=ProcManPidMax)
+			return false;
+
+		process->state=state;
+		process->textIndex=ProcManTextIndexInvalid;
+		process->tickProcData=NULL;
+		procManProcessAttachText(process);
+		procManProcessProfileInit(process);
+	}
+
+	// Restore timers
+	if (!snapshotRead(file, &procManData.ticksSinceLastInstructionCounterReset, sizeof(procManData.ticksSinceLastInstructionCounterReset)) ||
+	    !snapshotRead(file, &procManData.timerCount, sizeof(procManData.timerCount)) ||
+	    !snapshotRead(file, procManData.timerTimes, sizeof(procManData.timerTimes)) ||
+	    !snapshotRead(file, procManData.timerPids, sizeof(procManData.timerPids)) ||
+	    procManData.timerCount>ProcManPidMax)
+		return false;
+
+	procManData.statsWaitLastTime=ktimeGetMonotonicMs();
+
+	return true;
+}
+#endif
+
 ProcManPid procManProcessNew(const char *programPath) {
 	assert(programPath!=NULL);
 
@@ -275,6 +685,7 @@ ProcManPid procManProcessNew(const char *programPath) {
 		kernelLog(LogTypeWarning, kstrP("could not create new process - could not open progmem file ('%s')\n"), argvStart);
 		goto error;
 	}
+	procManProcessAttachText(&procManData.processes[pid]);
 
 	// Create env vars data
 	uint8_t envVarDataLen=0;
@@ -324,9 +735,11 @@ ProcManPid procManProcessNew(const char *programPath) {
 
 	// Initialise state
 	procManData.processes[pid].state=ProcManProcessStateActive;
+	procManData.processes[pid].ramOwnerPid=pid;
 	procManData.processes[pid].instructionCounter=0;
 #ifndef ARDUINO
-	memset(procManData.processes[pid].profilingCounts, 0, sizeof(procManData.processes[pid].profilingCounts[0])*BytecodeMemoryProgmemSize);
+	procManProcessProfileInit(&procManData.processes[pid]);
+	memset(&procManData.processes[pid].stats, 0, sizeof(procManData.processes[pid].stats));
 #endif
 
 	// Initialise proc file (and env var data in ram file)
@@ -355,6 +768,7 @@ ProcManPid procManProcessNew(const char *programPath) {
 
 	error:
 	if (pid!=ProcManPidMax) {
+		procManProcessDetachText(&procManData.processes[pid]);
 		kernelFsFileClose(procManData.processes[pid].progmemFd);
 		procManData.processes[pid].progmemFd=KernelFsFdInvalid;
 		kernelFsFileClose(procManData.processes[pid].procFd);
@@ -393,32 +807,26 @@ void procManProcessKill(ProcManPid pid, ProcManExitStatus exitStatus, ProcManPro
 	}
 
 #ifndef ARDUINO
-	// Save profiling counts to file before we start clearing things
-	if (kernelFlagProfile) {
-		char profilingFilePath[1024]; // TODO: this better
-		char profilingExecBaseNameRaw[1024]="unknown"; // TODO: better
-		char *profilingExecBaseName=profilingExecBaseNameRaw;
-		if (process->progmemFd!=KernelFsFdInvalid) {
-			kstrStrcpy(profilingExecBaseNameRaw, kernelFsGetFilePath(process->progmemFd));
-			profilingExecBaseName=basename(profilingExecBaseNameRaw);
-		}
-		sprintf(profilingFilePath, "profile.%"PRIu64".%s.%u", ktimeGetMonotonicMs(), profilingExecBaseName, pid);
-		FILE *profilingFile=fopen(profilingFilePath, "w");
-		if (profilingFile!=NULL) {
-			// Determine highest address instruction that was executed
-			// (this usually greatly reduces output file size)
-			BytecodeWord profilingFinal=0;
-			for(BytecodeWord i=0; i<BytecodeMemoryProgmemSize; ++i)
-				if (procManData.processes[pid].profilingCounts[i]>0)
-					profilingFinal=i;
-
-			// Write data and close file
-			fwrite(procManData.processes[pid].profilingCounts, sizeof(ProfileCounter), profilingFinal+1, profilingFile);
-			fclose(profilingFile);
+	// If the process is mid-tick on another host thread then leave it to that thread to do the kill (see procManProcessTickHandlePending)
+	if (procManProcessIsTickingElsewhere(process)) {
+		if (!process->pendingKill) {
+			process->pendingKill=true;
+			process->pendingKillExitStatus=exitStatus;
 		}
+		kernelLog(LogTypeInfo, kstrP("deferring kill of process %u until its current tick ends\n"), pid);
+		return;
 	}
 #endif
 
+#ifndef ARDUINO
+	// Save profiling data to files before we start clearing things
+	procManProcessProfileSave(process);
+#endif
+
+	// Kill any threads sharing our ram before it is deleted below
+	if (!procManProcessIsThread(process))
+		procManProcessKillThreads(pid);
+
 	// Attempt to get/load proc data, but note this is not critical (after all, we may be here precisely because we could not read the proc data file).
 	ProcManProcessProcData *procData=NULL;
 	ProcManProcessProcData procDataRaw;
@@ -435,13 +843,19 @@ void procManProcessKill(ProcManPid pid, ProcManExitStatus exitStatus, ProcManPro
 	}
 
 	// Close proc and ram files, deleting tmp ones
+	procManProcessDetachText(process);
 	kernelFsFileClose(process->progmemFd);
 	process->progmemFd=KernelFsFdInvalid;
 
 	if (process->procFd!=KernelFsFdInvalid) {
-		// Close and delete ram file
-		KernelFsFd ramFd;
-		if (procManProcessLoadProcDataRamFd(process, &ramFd) && ramFd!=KernelFsFdInvalid) {
+		// Close and delete ram file (unless we are a thread, in which case it belongs to another process)
+		// Note: prefer the given proc data as the ram fd changes if the ram is resized, so the proc file may be out of date.
+		KernelFsFd ramFd=KernelFsFdInvalid;
+		if (procData!=NULL)
+			ramFd=procData->ramFd;
+		else if (!procManProcessLoadProcDataRamFd(process, &ramFd))
+			ramFd=KernelFsFdInvalid;
+		if (!procManProcessIsThread(process) && ramFd!=KernelFsFdInvalid) {
 			char ramPath[KernelFsPathMax];
 			kstrStrcpy(ramPath, kernelFsGetFilePath(ramFd));
 			kernelFsFileClose(ramFd);
@@ -459,10 +873,16 @@ void procManProcessKill(ProcManPid pid, ProcManExitStatus exitStatus, ProcManPro
 	}
 
 	// Reset state
+	procManTimerRemove(pid);
 	process->state=ProcManProcessStateUnused;
+	process->ramOwnerPid=pid;
+	process->tickProcData=NULL;
 	process->instructionCounter=0;
 #ifndef ARDUINO
-	memset(process->profilingCounts, 0, sizeof(process->profilingCounts[0])*BytecodeMemoryProgmemSize);
+	process->pendingSignals=0;
+	process->pendingKill=false;
+	procManProcessProfileFree(process);
+	memset(&process->stats, 0, sizeof(process->stats));
 #endif
 
 	// Write to log
@@ -482,6 +902,7 @@ void procManProcessKill(ProcManPid pid, ProcManExitStatus exitStatus, ProcManPro
 			} else {
 				kernelLog(LogTypeInfo, kstrP("process %u died - woke process %u from waitpid syscall\n"), pid, waiterPid);
 				waiterProcess->state=ProcManProcessStateActive;
+				procManTimerRemove(waiterPid);
 			}
 		}
 	}
@@ -492,6 +913,7 @@ void procManProcessTick(ProcManPid pid) {
 
 	ProcManExitStatus exitStatus=ProcManExitStatusKilled;
 	bool procDataLoaded=false;
+	uint16_t instructionsRun=0;
 
 	// Find process from PID
 	ProcManProcess *process=procManGetProcessByPid(pid);
@@ -512,22 +934,12 @@ void procManProcessTick(ProcManPid pid) {
 				goto kill;
 			}
 		} break;
-		case ProcManProcessStateWaitingWaitpid: {
-			// Is this process waiting for a timeout, and that time has been reached?
-			if (process->stateData.waitingWaitpid.timeoutTime>0 && ktimeGetMonotonicMs()>=process->stateData.waitingWaitpid.timeoutTime) {
-				// It has - load process data so we can update the state and set r0 to indicate a timeout occured
-				if (!procManProcessLoadProcData(process, &procData)) {
-					kernelLog(LogTypeWarning, kstrP("process %u tick (waitpid timeout) - could not load proc data, killing\n"), pid);
-					goto kill;
-				}
-
-				process->state=ProcManProcessStateActive;
-				procData.regs[0]=ProcManExitStatusTimeout;
-			} else {
-				// Otherwise process stays waiting
-				return;
-			}
-		} break;
+		case ProcManProcessStateWaitingWaitpid:
+		case ProcManProcessStateWaitingSleep:
+		case ProcManProcessStateWaitingFutex:
+			// Process stays waiting (woken by the process it is waiting on dying, by its timer in procManTickAll, or by a futexwake syscall)
+			return;
+		break;
 		case ProcManProcessStateWaitingRead: {
 			// Is data now available?
 			if (kernelFsFileCanRead(process->stateData.waitingRead.globalFd)) {
@@ -604,6 +1016,27 @@ void procManProcessTick(ProcManPid pid) {
 				return;
 			}
 		} break;
+		case ProcManProcessStateWaitingBlockRead:
+		case ProcManProcessStateWaitingBlockRead32: {
+			// Has the device now fetched the data?
+			if (kernelFsFileCanReadAt(process->stateData.waitingBlockRead.globalFd, process->stateData.waitingBlockRead.offset)) {
+				// It has - load process data so we can update the state and read the data
+				if (!procManProcessLoadProcData(process, &procData)) {
+					kernelLog(LogTypeWarning, kstrP("process %u tick (block read available) - could not load proc data, killing\n"), pid);
+					goto kill;
+				}
+
+				bool is32=(process->state==ProcManProcessStateWaitingBlockRead32);
+				process->state=ProcManProcessStateActive;
+				if (!(is32 ? procManProcessRead32(process, &procData) : procManProcessRead(process, &procData))) {
+					kernelLog(LogTypeWarning, kstrP("process %u tick (block read available) - failed during read, killing\n"), pid);
+					goto kill;
+				}
+			} else {
+				// Otherwise process stays waiting
+				return;
+			}
+		} break;
 		case ProcManProcessStateExiting:
 			// This shouldn't happen as exiting processes are removed as soon as the syscall runs.
 			// But to be safe, kill
@@ -613,15 +1046,36 @@ void procManProcessTick(ProcManPid pid) {
 	}
 
 	procDataLoaded=true;
+	process->tickProcData=&procData;
+#ifndef ARDUINO
+	procManWorkerTickPid=pid;
+#endif
 
 	// Run a few instructions
 	ProcManPrefetchData prefetchData;
 	procManPrefetchDataClear(&prefetchData);
 	for(uint16_t instructionNum=0; instructionNum<procManProcessInstructionsPerTick; ++instructionNum) {
+		// Take the kernel lock unless the next instruction can run without it (only relevant if ticking processes on several host threads)
+		if (!procManKernelLockIsHeld() && !procManPrefetchDataCanExecUnlocked(&prefetchData, procData.regs[BytecodeRegisterIP])) {
+			procManKernelLock();
+			if (!procManProcessTickHandlePending(process, &exitStatus))
+				goto kill;
+		}
+
 #ifndef ARDUINO
 		// Update profiling info (before we update IP register)
-		if (procData.regs[BytecodeRegisterIP]<BytecodeMemoryProgmemSize)
-			++procManData.processes[pid].profilingCounts[procData.regs[BytecodeRegisterIP]];
+		if (process->profilingCounts!=NULL && procData.regs[BytecodeRegisterIP]<BytecodeMemoryProgmemSize)
+			++process->profilingCounts[procData.regs[BytecodeRegisterIP]];
+		if (process->profilingStacks!=NULL && --process->profilingStackCountdown==0) {
+			// Walking the stack reads process memory, so needs the kernel lock
+			if (!procManKernelLockIsHeld()) {
+				procManKernelLock();
+				if (!procManProcessTickHandlePending(process, &exitStatus))
+					goto kill;
+			}
+			procManProcessProfileSampleStack(process, &procData);
+			process->profilingStackCountdown=kernelFlagProfileStacks;
+		}
 #endif
 
 		// Run a single instruction
@@ -640,14 +1094,32 @@ void procManProcessTick(ProcManPid pid) {
 
 		// Increment instruction counter
 		assert(process->instructionCounter<procManProcessInstructionCounterMax); // we reset often enough to prevent this
-		++process->instructionCounter;
+		__atomic_store_n(&process->instructionCounter, process->instructionCounter+1, __ATOMIC_RELAXED); // only we write to this, but other host threads may read it (e.g. getallcpucounts syscall)
+		++instructionsRun;
 
 		// Has this process gone inactive?
 		if (procManData.processes[pid].state!=ProcManProcessStateActive)
 			break;
+
+		// Let other host threads use the kernel while we run the next instruction, if it only touches registers
+		// (otherwise keep the lock, rather than releasing and immediately retaking it)
+		if (procManPrefetchDataCanExecUnlocked(&prefetchData, procData.regs[BytecodeRegisterIP]))
+			procManKernelUnlock();
 	}
 
+	// Handle any signals/kills deferred while we did not hold the kernel lock
+	procManKernelLock();
+	if (!procManProcessTickHandlePending(process, &exitStatus))
+		goto kill;
+
 	// Save tmp data
+	process->tickProcData=NULL;
+#ifndef ARDUINO
+	procManWorkerTickPid=ProcManPidMax;
+	__atomic_fetch_add(&procManData.instructionTotal, instructionsRun, __ATOMIC_RELAXED);
+	process->stats.instructions+=instructionsRun;
+	++process->stats.ticks;
+#endif
 	if (!procManProcessStoreProcData(process, &procData)) {
 		kernelLog(LogTypeWarning, kstrP("process %u tick - could not store proc data post tick, killing\n"), pid);
 		goto kill;
@@ -656,6 +1128,11 @@ void procManProcessTick(ProcManPid pid) {
 	return;
 
 	kill:
+	process->tickProcData=NULL;
+#ifndef ARDUINO
+	procManWorkerTickPid=ProcManPidMax;
+	__atomic_fetch_add(&procManData.instructionTotal, instructionsRun, __ATOMIC_RELAXED);
+#endif
 	procManProcessKill(pid, exitStatus, (procDataLoaded ? &procData : NULL));
 }
 
@@ -679,6 +1156,15 @@ void procManProcessSendSignal(ProcManPid pid, BytecodeSignalId signalId) {
 		return;
 	}
 
+#ifndef ARDUINO
+	// If the process is mid-tick on another host thread then leave it to that thread to deliver the signal (see procManProcessTickHandlePending)
+	if (procManProcessIsTickingElsewhere(process)) {
+		process->pendingSignals|=(1u<<signalId);
+		kernelLog(LogTypeInfo, kstrP("deferring signal %u to process %u until its current tick ends\n"), signalId, pid);
+		return;
+	}
+#endif
+
 	// Load process' data.
 	ProcManProcessProcData procData;
 	if (!procManProcessLoadProcData(process, &procData)) {
@@ -705,9 +1191,23 @@ void procManProcessSendSignal(ProcManPid pid, BytecodeSignalId signalId) {
 			// Set process active again but set r0 to indicate waitpid was interrupted.
 			process->state=ProcManProcessStateActive;
 			procData.regs[0]=ProcManExitStatusInterrupted;
+			procManTimerRemove(pid);
+		break;
+		case ProcManProcessStateWaitingSleep:
+			// Set process active again but set r0 to indicate sleep was interrupted.
+			process->state=ProcManProcessStateActive;
+			procData.regs[0]=1;
+			procManTimerRemove(pid);
+		break;
+		case ProcManProcessStateWaitingFutex:
+			// Set process active again but set r0 to indicate wait was interrupted.
+			process->state=ProcManProcessStateActive;
+			procData.regs[0]=1;
 		break;
 		case ProcManProcessStateWaitingRead:
 		case ProcManProcessStateWaitingRead32:
+		case ProcManProcessStateWaitingBlockRead:
+		case ProcManProcessStateWaitingBlockRead32:
 			// Set process active again but set r0 to indicate read failed
 			process->state=ProcManProcessStateActive;
 			procData.regs[0]=0;
@@ -764,6 +1264,19 @@ bool procManProcessGetOpenGlobalFds(ProcManPid pid, KernelFsFd fds[ProcManMaxFds
 	return true;
 }
 
+#ifndef ARDUINO
+bool procManProcessGetStats(ProcManPid pid, ProcManProcessStats *stats) {
+	assert(stats!=NULL);
+
+	ProcManProcess *process=procManGetProcessByPid(pid);
+	if (process==NULL)
+		return false;
+
+	*stats=process->stats;
+	return true;
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Private functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -798,6 +1311,191 @@ const char *procManGetExecPathFromProcess(const ProcManProcess *process) {
 	return procManScratchBufPath2;
 }
 
+#ifndef ARDUINO
+ProcManWaitType procManProcessStateToWaitType(uint8_t state) {
+	switch((ProcManProcessState)state) {
+		case ProcManProcessStateWaitingWaitpid:
+			return ProcManWaitTypeWaitpid;
+		case ProcManProcessStateWaitingRead:
+		case ProcManProcessStateWaitingRead32:
+		case ProcManProcessStateWaitingBlockRead:
+		case ProcManProcessStateWaitingBlockRead32:
+			return ProcManWaitTypeRead;
+		case ProcManProcessStateWaitingWrite:
+		case ProcManProcessStateWaitingWrite32:
+			return ProcManWaitTypeWrite;
+		case ProcManProcessStateWaitingSleep:
+			return ProcManWaitTypeSleep;
+		case ProcManProcessStateWaitingFutex:
+			return ProcManWaitTypeFutex;
+		case ProcManProcessStateUnused:
+		case ProcManProcessStateActive:
+		case ProcManProcessStateExiting:
+		break;
+	}
+
+	return ProcManWaitTypeNB;
+}
+
+STATICASSERT(sizeof(ProcManProcessStats)%sizeof(uint32_t)==0);
+void procManStatsToBigEndian(const ProcManProcessStats *stats, uint8_t *record) {
+	assert(stats!=NULL);
+	assert(record!=NULL);
+
+	// Instruction count is the only 64 bit field, with everything after it being 32 bit
+	for(unsigned i=0; i<8; ++i)
+		*record++=(stats->instructions>>(56-8*i))&255;
+
+	const uint32_t *words=(const uint32_t *)(((const uint8_t *)stats)+sizeof(stats->instructions));
+	for(unsigned i=0; i<(sizeof(ProcManProcessStats)-sizeof(stats->instructions))/sizeof(uint32_t); ++i) {
+		uint32_t value=words[i];
+		*record++=(value>>24)&255;
+		*record++=(value>>16)&255;
+		*record++=(value>>8)&255;
+		*record++=value&255;
+	}
+}
+
+void procManProcessProfileInit(ProcManProcess *process) {
+	assert(process!=NULL);
+
+	if (kernelFlagProfile) {
+		if (process->profilingCounts==NULL)
+			process->profilingCounts=calloc(BytecodeMemoryProgmemSize, sizeof(ProfileCounter));
+		else
+			memset(process->profilingCounts, 0, sizeof(ProfileCounter)*BytecodeMemoryProgmemSize);
+		if (process->profilingCounts==NULL)
+			kernelLog(LogTypeWarning, kstrP("could not allocate profiling counts for process %u\n"), procManGetPidFromProcess(process));
+	}
+
+	if (kernelFlagProfileStacks>0) {
+		if (process->profilingStacks==NULL)
+			process->profilingStacks=calloc(ProcManProfileStackTableSize, sizeof(ProfileStack));
+		else
+			memset(process->profilingStacks, 0, sizeof(ProfileStack)*ProcManProfileStackTableSize);
+		if (process->profilingStacks==NULL)
+			kernelLog(LogTypeWarning, kstrP("could not allocate profiling stack table for process %u\n"), procManGetPidFromProcess(process));
+		process->profilingStacksDropped=0;
+		process->profilingStackCountdown=kernelFlagProfileStacks;
+	}
+}
+
+void procManProcessProfileFree(ProcManProcess *process) {
+	assert(process!=NULL);
+
+	free(process->profilingCounts);
+	process->profilingCounts=NULL;
+	free(process->profilingStacks);
+	process->profilingStacks=NULL;
+}
+
+void procManProcessProfileSave(ProcManProcess *process) {
+	assert(process!=NULL);
+
+	if (process->profilingCounts==NULL && process->profilingStacks==NULL)
+		return;
+
+	ProcManPid pid=procManGetPidFromProcess(process);
+	char profilingFilePath[1024]; // TODO: this better
+	char profilingExecBaseNameRaw[1024]="unknown"; // TODO: better
+	char *profilingExecBaseName=profilingExecBaseNameRaw;
+	if (process->progmemFd!=KernelFsFdInvalid) {
+		kstrStrcpy(profilingExecBaseNameRaw, kernelFsGetFilePath(process->progmemFd));
+		profilingExecBaseName=basename(profilingExecBaseNameRaw);
+	}
+	uint64_t now=ktimeGetMonotonicMs();
+
+	// Flat per-IP counts
+	if (process->profilingCounts!=NULL) {
+		sprintf(profilingFilePath, "profile.%"PRIu64".%s.%u", now, profilingExecBaseName, pid);
+		FILE *profilingFile=fopen(profilingFilePath, "w");
+		if (profilingFile!=NULL) {
+			// Determine highest address instruction that was executed
+			// (this usually greatly reduces output file size)
+			BytecodeWord profilingFinal=0;
+			for(BytecodeWord i=0; i<BytecodeMemoryProgmemSize; ++i)
+				if (process->profilingCounts[i]>0)
+					profilingFinal=i;
+
+			// Write data and close file
+			fwrite(process->profilingCounts, sizeof(ProfileCounter), profilingFinal+1, profilingFile);
+			fclose(profilingFile);
+		}
+	}
+
+	// Sampled call stacks, in folded form (outermost frame first)
+	if (process->profilingStacks!=NULL) {
+		sprintf(profilingFilePath, "profile-stacks.%"PRIu64".%s.%u", now, profilingExecBaseName, pid);
+		FILE *profilingFile=fopen(profilingFilePath, "w");
+		if (profilingFile!=NULL) {
+			for(unsigned i=0; i<ProcManProfileStackTableSize; ++i) {
+				const ProfileStack *stack=&process->profilingStacks[i];
+				if (stack->count==0)
+					continue;
+				for(int j=stack->depth-1; j>=0; --j)
+					fprintf(profilingFile, "0x%04X%c", stack->addrs[j], (j>0 ? ';' : ' '));
+				fprintf(profilingFile, "%"PRIu32"\n", stack->count);
+			}
+			fclose(profilingFile);
+		}
+		if (process->profilingStacksDropped>0)
+			kernelLog(LogTypeWarning, kstrP("process %u - %"PRIu32" stack samples dropped as table was full\n"), pid, process->profilingStacksDropped);
+	}
+}
+
+void procManProcessProfileSampleStack(ProcManProcess *process, ProcManProcessProcData *procData) {
+	assert(process!=NULL);
+	assert(procData!=NULL);
+	assert(process->profilingStacks!=NULL);
+
+	ProfileStack sample;
+	sample.depth=0;
+	sample.addrs[sample.depth++]=procData->regs[BytecodeRegisterIP];
+
+	// Scan back from SP for return addresses - with no frame pointer, we take any word pointing just past a call instruction to be one
+	// (this may pick up stale or coincidental values, but is good enough to attribute samples)
+	BytecodeWord sp=procData->regs[BytecodeRegisterSP];
+	if (sp>BytecodeMemoryRamAddr) {
+		uint16_t scanLen=sp-BytecodeMemoryRamAddr;
+		if (scanLen>ProcManProfileStackScanMax)
+			scanLen=ProcManProfileStackScanMax;
+		uint8_t stackData[ProcManProfileStackScanMax];
+		if (procManProcessMemoryReadBlock(process, procData, sp-scanLen, stackData, scanLen, false)) {
+			BytecodeInstruction2Byte callOp=bytecodeInstructionCreateAlu(BytecodeInstructionAluTypeExtra, BytecodeRegisterS, BytecodeRegisterSP, (BytecodeRegister)BytecodeInstructionAluExtraTypeCall);
+			int offset=scanLen-2;
+			while(offset>=0 && sample.depth<ProfileStackDepthMax) {
+				BytecodeWord retAddr=(((BytecodeWord)stackData[offset])<<8)|stackData[offset+1];
+				uint8_t callData[2];
+				if (retAddr>=2 && retAddr<BytecodeMemoryProgmemSize && procManProcessProgmemRead(process, retAddr-2, callData, 2) && ((((BytecodeInstruction2Byte)callData[0])<<8)|callData[1])==callOp) {
+					sample.addrs[sample.depth++]=retAddr-2; // record call site, so it is attributed to the calling function
+					offset-=2;
+				} else
+					--offset; // pushes may be of single bytes, so try every alignment
+			}
+		}
+	}
+
+	// Add to hash table of stacks (open addressing)
+	uint32_t hash=2166136261u;
+	for(uint8_t i=0; i<sample.depth; ++i)
+		hash=(hash^sample.addrs[i])*16777619u;
+	for(unsigned probe=0; probe<ProcManProfileStackTableSize; ++probe) {
+		ProfileStack *entry=&process->profilingStacks[(hash+probe)&(ProcManProfileStackTableSize-1)];
+		if (entry->count==0) {
+			*entry=sample;
+			entry->count=1;
+			return;
+		}
+		if (entry->depth==sample.depth && memcmp(entry->addrs, sample.addrs, sizeof(sample.addrs[0])*sample.depth)==0) {
+			++entry->count;
+			return;
+		}
+	}
+
+	++process->profilingStacksDropped;
+}
+#endif
+
 ProcManPid procManFindUnusedPid(void) {
 	// Given that fork uses return pid 0 to indicate child process, we have to make sure the first process created uses pid 0, and exists for as long as the system is running (so that fork can never return)
 	for(ProcManPid i=0; i<ProcManPidMax; ++i)
@@ -810,6 +1508,12 @@ bool procManProcessLoadProcData(const ProcManProcess *process, ProcManProcessPro
 	assert(process!=NULL);
 	assert(procData!=NULL);
 
+	// If the process is mid-tick then its proc file is out of date
+	if (process->tickProcData!=NULL) {
+		*procData=*process->tickProcData;
+		return true;
+	}
+
 	return (kernelFsFileReadOffset(process->procFd, 0, (uint8_t *)procData, sizeof(ProcManProcessProcData))==sizeof(ProcManProcessProcData));
 }
 
@@ -817,6 +1521,12 @@ bool procManProcessStoreProcData(ProcManProcess *process, ProcManProcessProcData
 	assert(process!=NULL);
 	assert(procData!=NULL);
 
+	// If the process is mid-tick then update the loaded copy instead, which is stored once the tick is done
+	if (process->tickProcData!=NULL) {
+		*process->tickProcData=*procData;
+		return true;
+	}
+
 	return (kernelFsFileWriteOffset(process->procFd, 0, (const uint8_t *)procData, sizeof(ProcManProcessProcData))==sizeof(ProcManProcessProcData));
 }
 
@@ -824,6 +1534,11 @@ bool procManProcessLoadProcDataRamLen(const ProcManProcess *process, uint16_t *v
 	assert(process!=NULL);
 	assert(value!=NULL);
 
+	if (process->tickProcData!=NULL) {
+		*value=process->tickProcData->ramLen;
+		return true;
+	}
+
 	return (process->procFd!=KernelFsFdInvalid && kernelFsFileReadOffset(process->procFd, offsetof(ProcManProcessProcData,ramLen), (uint8_t *)value, sizeof(uint16_t))==sizeof(uint16_t));
 }
 
@@ -831,6 +1546,11 @@ bool procManProcessLoadProcDataEnvVarDataLen(const ProcManProcess *process, uint
 	assert(process!=NULL);
 	assert(value!=NULL);
 
+	if (process->tickProcData!=NULL) {
+		*value=process->tickProcData->envVarDataLen;
+		return true;
+	}
+
 	return (process->procFd!=KernelFsFdInvalid && kernelFsFileReadOffset(process->procFd, offsetof(ProcManProcessProcData,envVarDataLen), value, sizeof(uint8_t))==sizeof(uint8_t));
 }
 
@@ -838,15 +1558,101 @@ bool procManProcessLoadProcDataRamFd(const ProcManProcess *process, KernelFsFd *
 	assert(process!=NULL);
 	assert(ramFd!=NULL);
 
+	if (process->tickProcData!=NULL) {
+		*ramFd=process->tickProcData->ramFd;
+		return true;
+	}
+
 	return (process->procFd!=KernelFsFdInvalid && kernelFsFileReadOffset(process->procFd, offsetof(ProcManProcessProcData,ramFd), (uint8_t *)ramFd, sizeof(KernelFsFd))==sizeof(KernelFsFd));
 }
 
 bool procManProcessSaveProcDataReg(const ProcManProcess *process, BytecodeRegister reg, BytecodeWord value) {
 	assert(process!=NULL);
 
+	if (process->tickProcData!=NULL) {
+		process->tickProcData->regs[reg]=value;
+		return true;
+	}
+
 	return (process->procFd!=KernelFsFdInvalid && kernelFsFileWriteOffset(process->procFd, offsetof(ProcManProcessProcData,regs)+sizeof(BytecodeWord)*reg, (uint8_t *)&value, sizeof(BytecodeWord))==sizeof(BytecodeWord));
 }
 
+bool procManProcessSaveProcDataRam(const ProcManProcess *process, KernelFsFd ramFd, uint16_t ramLen) {
+	assert(process!=NULL);
+
+	if (process->tickProcData!=NULL) {
+		process->tickProcData->ramFd=ramFd;
+		process->tickProcData->ramLen=ramLen;
+		return true;
+	}
+
+	return (process->procFd!=KernelFsFdInvalid &&
+	        kernelFsFileWriteOffset(process->procFd, offsetof(ProcManProcessProcData,ramFd), (uint8_t *)&ramFd, sizeof(KernelFsFd))==sizeof(KernelFsFd) &&
+	        kernelFsFileWriteOffset(process->procFd, offsetof(ProcManProcessProcData,ramLen), (uint8_t *)&ramLen, sizeof(uint16_t))==sizeof(uint16_t));
+}
+
+bool procManProcessIsThread(const ProcManProcess *process) {
+	assert(process!=NULL);
+
+	return (process->ramOwnerPid!=procManGetPidFromProcess(process));
+}
+
+bool procManProcessIsTickingElsewhere(const ProcManProcess *process) {
+	assert(process!=NULL);
+
+#ifndef ARDUINO
+	return (process->tickProcData!=NULL && procManGetPidFromProcess(process)!=procManWorkerTickPid);
+#else
+	return false;
+#endif
+}
+
+bool procManProcessTickHandlePending(ProcManProcess *process, ProcManExitStatus *exitStatus) {
+	assert(process!=NULL);
+	assert(exitStatus!=NULL);
+	assert(procManKernelLockIsHeld());
+
+#ifndef ARDUINO
+	if (process->pendingKill) {
+		*exitStatus=process->pendingKillExitStatus;
+		return false;
+	}
+
+	ProcManPid pid=procManGetPidFromProcess(process);
+	for(BytecodeSignalId signalId=0; process->pendingSignals!=0 && signalId<BytecodeSignalIdNB; ++signalId) {
+		if (process->pendingSignals & (1u<<signalId)) {
+			process->pendingSignals&=~(1u<<signalId);
+			procManProcessSendSignal(pid, signalId);
+		}
+	}
+#endif
+
+	return true;
+}
+
+void procManProcessKillThreads(ProcManPid ramOwnerPid) {
+	for(ProcManPid threadPid=0; threadPid<ProcManPidMax; ++threadPid) {
+		ProcManProcess *threadProcess=procManGetProcessByPid(threadPid);
+		if (threadProcess!=NULL && threadPid!=ramOwnerPid && threadProcess->ramOwnerPid==ramOwnerPid)
+			procManProcessKill(threadPid, ProcManExitStatusKilled, NULL);
+	}
+}
+
+void procManProcessUpdateThreadsRam(const ProcManProcess *process, const ProcManProcessProcData *procData) {
+	assert(process!=NULL);
+	assert(procData!=NULL);
+
+	ProcManPid pid=procManGetPidFromProcess(process);
+	for(ProcManPid threadPid=0; threadPid<ProcManPidMax; ++threadPid) {
+		ProcManProcess *threadProcess=procManGetProcessByPid(threadPid);
+		if (threadProcess==NULL || threadPid==pid || threadProcess->ramOwnerPid!=process->ramOwnerPid)
+			continue;
+
+		if (!procManProcessSaveProcDataRam(threadProcess, procData->ramFd, procData->ramLen))
+			kernelLog(LogTypeWarning, kstrP("could not update ram fd/len for process %u after ram resize in process %u\n"), threadPid, pid);
+	}
+}
+
 bool procManProcessMemoryReadByte(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, uint8_t *value) {
 	assert(process!=NULL);
 	assert(procData!=NULL);
@@ -907,7 +1713,7 @@ bool procManProcessMemoryReadBlock(ProcManProcess *process, ProcManProcessProcDa
 
 	if (addr+len<BytecodeMemoryRamAddr) {
 		// Addresss is in progmem data
-		if (kernelFsFileReadOffset(process->progmemFd, addr, data, len)==len)
+		if (procManProcessProgmemRead(process, addr, data, len))
 			return true;
 		else {
 			if (verbose)
@@ -950,6 +1756,23 @@ bool procManProcessMemoryReadBlock(ProcManProcess *process, ProcManProcessProcDa
 		return false;
 }
 
+bool procManProcessProgmemRead(ProcManProcess *process, BytecodeWord addr, uint8_t *data, uint16_t len) {
+	assert(process!=NULL);
+	assert(data!=NULL);
+
+	// Use shared mapping if available (refreshing it if devices have been added/removed since it was made)
+	if (process->textIndex!=ProcManTextIndexInvalid) {
+		ProcManText *text=&procManData.texts[process->textIndex];
+		if (text->mapping.generation==kernelFsGetGeneration() || kernelFsFileGetMapping(process->progmemFd, &text->mapping))
+			return (kernelFsFileMappingRead(&text->mapping, addr, data, len)==len);
+
+		// Mapping no longer possible - fall back to using fd
+		procManProcessDetachText(process);
+	}
+
+	return (kernelFsFileReadOffset(process->progmemFd, addr, data, len)==len);
+}
+
 bool procManProcessMemoryWriteByte(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord addr, uint8_t value) {
 	assert(process!=NULL);
 	assert(procData!=NULL);
@@ -1039,7 +1862,11 @@ bool procManProcessMemoryWriteBlock(ProcManProcess *process, ProcManProcessProcD
 			// Unable to allocate even 1 extra byte?
 			if (extra<=1) {
 				kernelLog(LogTypeWarning, kstrP("process %u (%s) tried to write to RAM (0x%04X, offset %u, len %u), beyond size, but could not allocate new size (%u vs %u), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process), addr, ramIndex, len, newRamLen, oldRamLen);
-				kernelFsFileDelete(ramFdPath);
+				// A thread's ram is still in use by its owner (and any other threads), so reopen it at its old size rather than deleting it
+				if (procManProcessIsThread(process))
+					procData->ramFd=kernelFsFileOpen(ramFdPath, KernelFsFdModeRW);
+				else
+					kernelFsFileDelete(ramFdPath);
 				goto error;
 			}
 		}
@@ -1052,8 +1879,12 @@ bool procManProcessMemoryWriteBlock(ProcManProcess *process, ProcManProcessProcD
 			goto error;
 		}
 
-		// Update stored ram len and write data
+		// Update stored ram len (also for any threads sharing this ram) and write data
 		procData->ramLen=newRamLen;
+		procManProcessUpdateThreadsRam(process, procData);
+#ifndef ARDUINO
+		++process->stats.ramGrowths;
+#endif
 		if (kernelFsFileWriteOffset(procData->ramFd, procData->envVarDataLen+ramIndex, data, len)!=len) {
 			kernelLog(LogTypeWarning, kstrP("process %u (%s) tried to write to RAM (0x%04X, offset %u, len %u) had to resize (%u vs %u), but could not write, killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process), addr, ramIndex, len, newRamLen, oldRamLen);
 			goto error;
@@ -1062,8 +1893,9 @@ bool procManProcessMemoryWriteBlock(ProcManProcess *process, ProcManProcessProcD
 		return true;
 
 		error:
-		// Store procdata back as otherwise when we come to kill ramFd will not be saved
+		// Store procdata back as otherwise when we come to kill ramFd will not be saved (and ensure no threads are left using the old ram fd)
 		procManProcessStoreProcData(process, procData); // TODO: Check return
+		procManProcessUpdateThreadsRam(process, procData);
 		return false;
 	}
 }
@@ -1359,17 +2191,157 @@ bool procManProcessExecInstructionAlu(ProcManProcess *process, ProcManProcessPro
 						kernelLog(LogTypeWarning, kstrP("failed during xchg8 instruction execution, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
 						return false;
 					}
-					procData->regs[info->d.alu.opAReg]=memValue;
+					procData->regs[info->d.alu.opAReg]=memValue;
+					return true;
+				} break;
+				case BytecodeInstructionAluExtraTypeClz: {
+					BytecodeWord srcValue=procData->regs[info->d.alu.opAReg];
+					procData->regs[info->d.alu.destReg]=clz16(srcValue);
+					return true;
+				} break;
+			}
+
+			kernelLog(LogTypeWarning, kstrP("unknown alu extra instruction, type %u, process %u (%s), killing\n"), info->d.alu.opBReg, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+			return false;
+		} break;
+		case BytecodeInstructionAluTypeInt32: {
+			// Read 32 bit value pointed to by dest register, and second operand if also 32 bit
+			BytecodeDoubleWord destValue, srcValue=opA;
+			BytecodeWord destAddr=procData->regs[info->d.alu.destReg];
+			if (!procManProcessMemoryReadDoubleWord(process, procData, destAddr, &destValue)) {
+				kernelLog(LogTypeWarning, kstrP("failed during int32 instruction execution (type %u), process %u (%s), killing\n"), info->d.alu.opBReg, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+				return false;
+			}
+			switch((BytecodeInstructionAluInt32Type)info->d.alu.opBReg) {
+				case BytecodeInstructionAluInt32TypeAdd32:
+				case BytecodeInstructionAluInt32TypeSub32:
+				case BytecodeInstructionAluInt32TypeMul32:
+				case BytecodeInstructionAluInt32TypeCmp:
+					if (!procManProcessMemoryReadDoubleWord(process, procData, opA, &srcValue)) {
+						kernelLog(LogTypeWarning, kstrP("failed during int32 instruction execution (type %u), process %u (%s), killing\n"), info->d.alu.opBReg, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+						return false;
+					}
+				break;
+				default:
+				break;
+			}
+
+			// Compute result
+			switch((BytecodeInstructionAluInt32Type)info->d.alu.opBReg) {
+				case BytecodeInstructionAluInt32TypeAdd16:
+				case BytecodeInstructionAluInt32TypeAdd32:
+					destValue+=srcValue;
+				break;
+				case BytecodeInstructionAluInt32TypeSub16:
+				case BytecodeInstructionAluInt32TypeSub32:
+					destValue-=srcValue;
+				break;
+				case BytecodeInstructionAluInt32TypeMul16:
+				case BytecodeInstructionAluInt32TypeMul32:
+					destValue*=srcValue;
+				break;
+				case BytecodeInstructionAluInt32TypeShift: {
+					int16_t shift=(int16_t)opA;
+					if (shift>=0)
+						destValue=(shift<32 ? destValue<<shift : 0);
+					else
+						destValue=(shift>-32 ? destValue>>(-shift) : 0);
+				} break;
+				case BytecodeInstructionAluInt32TypeCmp: {
+					// Result goes into dest register rather than memory
+					BytecodeWord *d=&procData->regs[info->d.alu.destReg];
+					*d=0;
+					*d|=(destValue==srcValue)<<BytecodeInstructionAluCmpBitEqual;
+					*d|=(destValue==0)<<BytecodeInstructionAluCmpBitEqualZero;
+					*d|=(destValue!=srcValue)<<BytecodeInstructionAluCmpBitNotEqual;
+					*d|=(destValue!=0)<<BytecodeInstructionAluCmpBitNotEqualZero;
+					*d|=(destValue<srcValue)<<BytecodeInstructionAluCmpBitLessThan;
+					*d|=(destValue<=srcValue)<<BytecodeInstructionAluCmpBitLessEqual;
+					*d|=(destValue>srcValue)<<BytecodeInstructionAluCmpBitGreaterThan;
+					*d|=(destValue>=srcValue)<<BytecodeInstructionAluCmpBitGreaterEqual;
+					return true;
+				} break;
+				default:
+					kernelLog(LogTypeWarning, kstrP("unknown alu int32 instruction, type %u, process %u (%s), killing\n"), info->d.alu.opBReg, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+					return false;
+				break;
+			}
+
+			// Write result back
+			if (!procManProcessMemoryWriteDoubleWord(process, procData, destAddr, destValue)) {
+				kernelLog(LogTypeWarning, kstrP("failed during int32 instruction execution (type %u), process %u (%s), killing\n"), info->d.alu.opBReg, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+				return false;
+			}
+			return true;
+		} break;
+		case BytecodeInstructionAluTypeMemory: {
+			switch((BytecodeInstructionAluMemoryType)info->d.alu.opBReg) {
+				case BytecodeInstructionAluMemoryTypeLoad8Disp: {
+					uint8_t value;
+					if (!procManProcessMemoryReadByte(process, procData, opA+info->d.alu.displacement, &value)) {
+						kernelLog(LogTypeWarning, kstrP("failed during load8 (displacement) instruction execution, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+						return false;
+					}
+					procData->regs[info->d.alu.destReg]=value;
+					return true;
+				} break;
+				case BytecodeInstructionAluMemoryTypeStore8Disp: {
+					BytecodeWord destAddr=procData->regs[info->d.alu.destReg]+info->d.alu.displacement;
+					if (!procManProcessMemoryWriteByte(process, procData, destAddr, opA)) {
+						kernelLog(LogTypeWarning, kstrP("failed during store8 (displacement) instruction execution, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+						return false;
+					}
+					return true;
+				} break;
+				case BytecodeInstructionAluMemoryTypeLoad16Disp: {
+					if (!procManProcessMemoryReadWord(process, procData, opA+info->d.alu.displacement, &procData->regs[info->d.alu.destReg])) {
+						kernelLog(LogTypeWarning, kstrP("failed during load16 (displacement) instruction execution, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+						return false;
+					}
+					return true;
+				} break;
+				case BytecodeInstructionAluMemoryTypeStore16Disp: {
+					BytecodeWord destAddr=procData->regs[info->d.alu.destReg]+info->d.alu.displacement;
+					if (!procManProcessMemoryWriteWord(process, procData, destAddr, opA)) {
+						kernelLog(LogTypeWarning, kstrP("failed during store16 (displacement) instruction execution, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+						return false;
+					}
 					return true;
 				} break;
-				case BytecodeInstructionAluExtraTypeClz: {
-					BytecodeWord srcValue=procData->regs[info->d.alu.opAReg];
-					procData->regs[info->d.alu.destReg]=clz16(srcValue);
+				case BytecodeInstructionAluMemoryTypeCopyBlock:
+				case BytecodeInstructionAluMemoryTypeFillBlock: {
+					// Process a single chunk
+					BytecodeWord destAddr=procData->regs[info->d.alu.destReg];
+					BytecodeWord len=procData->regs[info->d.alu.lenReg];
+					BytecodeWord chunkSize=MIN(len, procManProcessBlockChunkSize);
+					if (chunkSize==0)
+						return true;
+
+					if ((BytecodeInstructionAluMemoryType)info->d.alu.opBReg==BytecodeInstructionAluMemoryTypeCopyBlock) {
+						if (!procManProcessMemmove(process, procData, destAddr, opA, chunkSize)) {
+							kernelLog(LogTypeWarning, kstrP("failed during copyblock instruction execution, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+							return false;
+						}
+						procData->regs[info->d.alu.opAReg]+=chunkSize;
+					} else {
+						memset(procManScratchBuf256, opA, chunkSize);
+						if (!procManProcessMemoryWriteBlock(process, procData, destAddr, (const uint8_t *)procManScratchBuf256, chunkSize)) {
+							kernelLog(LogTypeWarning, kstrP("failed during fillblock instruction execution, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+							return false;
+						}
+					}
+					procData->regs[info->d.alu.destReg]+=chunkSize;
+					procData->regs[info->d.alu.lenReg]-=chunkSize;
+
+					// More to do? If so rewind so that this instruction is executed again (allowing the process to be interrupted in between chunks)
+					if (procData->regs[info->d.alu.lenReg]>0)
+						procData->regs[BytecodeRegisterIP]-=BytecodeInstructionLength3Byte;
+
 					return true;
 				} break;
 			}
 
-			kernelLog(LogTypeWarning, kstrP("unknown alu extra instruction, type %u, process %u (%s), killing\n"), info->d.alu.opBReg, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+			kernelLog(LogTypeWarning, kstrP("unknown alu memory instruction, type %u, process %u (%s), killing\n"), info->d.alu.opBReg, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
 			return false;
 		} break;
 	}
@@ -1425,6 +2397,12 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 	assert(exitStatus!=NULL);
 
 	uint16_t syscallId=procData->regs[0];
+#ifndef ARDUINO
+	if (syscallId<ProcManSyscallCountsMax)
+		++procManData.syscallCounts[syscallId];
+	++procManData.syscallTotal;
+	++process->stats.syscalls[(syscallId>>8)<ProcManStatsSyscallGroupNB ? (syscallId>>8) : ProcManStatsSyscallGroupNB-1];
+#endif
 	switch(syscallId) {
 		case BytecodeSyscallIdExit:
 			*exitStatus=procData->regs[1];
@@ -1454,6 +2432,48 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 			procManProcessFork(process, procData);
 			return true;
 		break;
+		case BytecodeSyscallIdClone:
+			procManProcessClone(process, procData);
+			return true;
+		break;
+		case BytecodeSyscallIdFutexWait: {
+			BytecodeWord addr=procData->regs[1];
+			uint8_t expectedValue=procData->regs[2];
+
+			// r0 is left as 0 unless the wait is interrupted by a signal
+			procData->regs[0]=0;
+
+			// Only wait if the value is still as expected (otherwise whatever we would be waiting for has already happened)
+			uint8_t value;
+			if (!procManProcessMemoryReadByte(process, procData, addr, &value)) {
+				kernelLog(LogTypeWarning, kstrP("failed during futexwait syscall, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+				return false;
+			}
+			if (value!=expectedValue)
+				return true;
+
+			process->state=ProcManProcessStateWaitingFutex;
+			process->stateData.waitingFutex.addr=addr;
+
+			return true;
+		} break;
+		case BytecodeSyscallIdFutexWake: {
+			BytecodeWord addr=procData->regs[1];
+			BytecodeWord maxCount=procData->regs[2];
+
+			// Wake up to maxCount processes sharing our ram which are waiting on this address, returning how many were woken
+			BytecodeWord count=0;
+			for(ProcManPid waiterPid=0; waiterPid<ProcManPidMax && count<maxCount; ++waiterPid) {
+				ProcManProcess *waiterProcess=procManGetProcessByPid(waiterPid);
+				if (waiterProcess!=NULL && waiterProcess->state==ProcManProcessStateWaitingFutex && waiterProcess->ramOwnerPid==process->ramOwnerPid && waiterProcess->stateData.waitingFutex.addr==addr) {
+					waiterProcess->state=ProcManProcessStateActive;
+					++count;
+				}
+			}
+			procData->regs[0]=count;
+
+			return true;
+		} break;
 		case BytecodeSyscallIdExec:
 			if (!procManProcessExec(process, procData)) {
 				kernelLog(LogTypeWarning, kstrP("failed during exec syscall, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
@@ -1473,7 +2493,8 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 				// Otherwise indicate process is waiting for this pid to die
 				process->state=ProcManProcessStateWaitingWaitpid;
 				process->stateData.waitingWaitpid.pid=waitPid;
-				process->stateData.waitingWaitpid.timeoutTime=(timeout>0 ? ktimeGetMonotonicMs()+timeout*1000llu : 0);
+				if (timeout>0)
+					procManTimerAdd(procManGetPidFromProcess(process), ktimeGetMonotonicMs()+timeout*1000lu);
 			}
 
 			return true;
@@ -1514,6 +2535,10 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 					case ProcManProcessStateWaitingRead32:
 					case ProcManProcessStateWaitingWrite:
 					case ProcManProcessStateWaitingWrite32:
+					case ProcManProcessStateWaitingBlockRead:
+					case ProcManProcessStateWaitingBlockRead32:
+					case ProcManProcessStateWaitingSleep:
+					case ProcManProcessStateWaitingFutex:
 						str="waiting";
 					break;
 					case ProcManProcessStateExiting:
@@ -1536,7 +2561,7 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 				ProcManProcess *qProcess=procManGetProcessByPid(i);
 				uint16_t value;
 				if (qProcess!=NULL)
-					value=qProcess->instructionCounter;
+					value=__atomic_load_n(&qProcess->instructionCounter, __ATOMIC_RELAXED);
 				else
 					value=0;
 				if (!procManProcessMemoryWriteWord(process, procData, bufAddr, value)) {
@@ -1635,6 +2660,16 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 				return true;
 			}
 
+			// Check if device needs to fetch data first
+			BytecodeWord offset=procData->regs[2];
+			if (!kernelFsFileCanReadAt(globalFd, offset)) {
+				// It does - enter waiting state (rather than busy-waiting) so other processes can run in the meantime.
+				process->state=ProcManProcessStateWaitingBlockRead;
+				process->stateData.waitingBlockRead.globalFd=globalFd;
+				process->stateData.waitingBlockRead.offset=offset;
+				return true;
+			}
+
 			// Otherwise read as normal (stopping before we would block)
 			if (!procManProcessRead(process, procData)) {
 				kernelLog(LogTypeWarning, kstrP("failed during read syscall, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
@@ -1724,6 +2759,82 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 
 			return true;
 		} break;
+		case BytecodeSyscallIdDirGetChildNext: {
+			ProcManLocalFd localFd=procData->regs[1];
+			uint16_t bufAddr=procData->regs[2];
+
+			// Get global fd
+			KernelFsFd globalFd=procManProcessGetGlobalFdFromLocal(process, procData, localFd);
+			if (globalFd==KernelFsFdInvalid) {
+				kernelLog(LogTypeWarning, kstrP("failed during dirgetchildnext syscall, local fd %u not open, process %u (%s)\n"), localFd, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+				procData->regs[0]=0;
+				return true;
+			}
+
+			// Get next child using cursor stored with the fd
+			char childPath[KernelFsPathMax];
+			procData->regs[0]=kernelFsDirectoryGetNextChild(globalFd, childPath);
+			if (procData->regs[0] && !procManProcessMemoryWriteStr(process, procData, bufAddr, childPath)) {
+				kernelLog(LogTypeWarning, kstrP("failed during dirgetchildnext syscall, local fd %u, global fd %u process %u (%s), killing\n"), localFd, globalFd, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+				return false;
+			}
+
+			return true;
+		} break;
+		case BytecodeSyscallIdDirGetChildren: {
+			ProcManLocalFd localFd=procData->regs[1];
+			uint16_t bufAddr=procData->regs[2];
+			uint16_t bufLen=procData->regs[3];
+
+			// Get global fd
+			KernelFsFd globalFd=procManProcessGetGlobalFdFromLocal(process, procData, localFd);
+			if (globalFd==KernelFsFdInvalid) {
+				kernelLog(LogTypeWarning, kstrP("failed during dirgetchildren syscall, local fd %u not open, process %u (%s)\n"), localFd, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+				procData->regs[0]=0;
+				return true;
+			}
+
+			// Children are returned as names relative to the directory, so compute how much to strip from the front of each path
+			unsigned dirPathLen=kstrStrlen(kernelFsGetFilePath(globalFd));
+			if (dirPathLen>1)
+				++dirPathLen; // skip '/' separator also (root directory path already ends in one)
+
+			// Write as many child names as fit into the buffer, each null-terminated
+			char childPath[KernelFsPathMax];
+			BytecodeWord count=0;
+			uint16_t bufOffset=0;
+			while(1) {
+				uint16_t cursor=kernelFsDirectoryGetCursor(globalFd);
+				if (!kernelFsDirectoryGetNextChild(globalFd, childPath))
+					break;
+
+				const char *childName=childPath+dirPathLen;
+				uint16_t childNameSize=strlen(childName)+1;
+				if (bufOffset+childNameSize>bufLen) {
+					// Does not fit - rewind so this child is returned by the next call
+					kernelFsDirectorySetCursor(globalFd, cursor);
+
+					// If nothing fit then returning 0 would look like the end of the directory, so indicate the size needed instead
+					if (count==0) {
+						procData->regs[0]=(procManDirGetChildrenBufferTooSmallFlag|childNameSize);
+						return true;
+					}
+					break;
+				}
+
+				if (!procManProcessMemoryWriteStr(process, procData, bufAddr+bufOffset, childName)) {
+					kernelLog(LogTypeWarning, kstrP("failed during dirgetchildren syscall, local fd %u, global fd %u process %u (%s), killing\n"), localFd, globalFd, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+					return false;
+				}
+
+				bufOffset+=childNameSize;
+				++count;
+			}
+
+			procData->regs[0]=count;
+
+			return true;
+		} break;
 		case BytecodeSyscallIdGetPath: {
 			ProcManLocalFd localFd=procData->regs[1];
 			uint16_t bufAddr=procData->regs[2];
@@ -1880,6 +2991,16 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 				return true;
 			}
 
+			// Check if device needs to fetch data first (if offset cannot be read procManProcessRead32 fails below)
+			BytecodeDoubleWord offset;
+			if (procManProcessMemoryReadDoubleWord(process, procData, procData->regs[2], &offset) && !kernelFsFileCanReadAt(globalFd, offset)) {
+				// It does - enter waiting state (rather than busy-waiting) so other processes can run in the meantime.
+				process->state=ProcManProcessStateWaitingBlockRead32;
+				process->stateData.waitingBlockRead.globalFd=globalFd;
+				process->stateData.waitingBlockRead.offset=offset;
+				return true;
+			}
+
 			// Otherwise read as normal (stopping before we would block)
 			if (!procManProcessRead32(process, procData)) {
 				kernelLog(LogTypeWarning, kstrP("failed during read32 syscall, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
@@ -2182,6 +3303,20 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 
 			return true;
 		} break;
+		case BytecodeSyscallIdSleepMs: {
+			BytecodeWord ms=procData->regs[1];
+
+			// r0 is left as 0 unless the sleep is interrupted by a signal
+			procData->regs[0]=0;
+			if (ms==0)
+				return true;
+
+			// Wait until timer wakes us (see procManTickAll)
+			process->state=ProcManProcessStateWaitingSleep;
+			procManTimerAdd(procManGetPidFromProcess(process), ktimeGetMonotonicMs()+ms);
+
+			return true;
+		} break;
 		case BytecodeSyscallIdRegisterSignalHandler: {
 			uint16_t signalId=procData->regs[1];
 			uint16_t handlerAddr=procData->regs[2];
@@ -2765,6 +3900,31 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 
 			return true;
 		} break;
+		case BytecodeSyscallIdHwDeviceDht22Mount: {
+			// Grab arguments
+			HwDeviceId id=procData->regs[1];
+			uint16_t mountPointAddr=procData->regs[2];
+			uint16_t intervalS=procData->regs[3];
+
+			char mountPoint[KernelFsPathMax];
+			if (!procManProcessMemoryReadStr(process, procData, mountPointAddr, mountPoint, KernelFsPathMax)) {
+				kernelLog(LogTypeWarning, kstrP("failed during hwdevicedht22mount syscall, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+				return false;
+			}
+			kernelFsPathNormalise(mountPoint);
+
+			// Attempt to mount
+			procData->regs[0]=hwDeviceDht22Mount(id, mountPoint, intervalS);
+
+			return true;
+		} break;
+		case BytecodeSyscallIdHwDeviceDht22Unmount: {
+			HwDeviceId id=procData->regs[1];
+
+			hwDeviceDht22Unmount(id);
+
+			return true;
+		} break;
 		case ByteCodeSyscallIdInt32Add16: {
 			// Grab arguments
 			BytecodeWord aPtr=procData->regs[1];
@@ -3007,22 +4167,178 @@ bool procManProcessExecSyscall(ProcManProcess *process, ProcManProcessProcData *
 			// Compute result
 			aValue>>=bValue;
 
-			// Write result back into process memory
-			if (!procManProcessMemoryWriteDoubleWord(process, procData, aPtr, aValue)) {
-				kernelLog(LogTypeWarning, kstrP("failed during int32shr syscall, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
-				return false;
-			}
+			// Write result back into process memory
+			if (!procManProcessMemoryWriteDoubleWord(process, procData, aPtr, aValue)) {
+				kernelLog(LogTypeWarning, kstrP("failed during int32shr syscall, process %u (%s), killing\n"), procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+				return false;
+			}
+
+			return true;
+		} break;
+	}
+
+	kernelLog(LogTypeWarning, kstrP("invalid syscall id=%i, process %u (%s), killing\n"), syscallId, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
+	return false;
+}
+
+STATICASSERT(sizeof(ProcManProcessProcData)<KernelFsPathMax); // This is due to using one of the path scratch buffers to hold child's procData temporarily
+void procManProcessFork(ProcManProcess *parent, ProcManProcessProcData *procData) {
+	assert(parent!=NULL);
+	assert(procData!=NULL);
+
+#define scratchPath procManScratchBufPath0
+#define childProcData ((ProcManProcessProcData *)procManScratchBufPath1)
+
+	ProcManPid parentPid=procManGetPidFromProcess(parent);
+
+	kernelLog(LogTypeInfo, kstrP("fork request from process %u\n"), parentPid);
+
+	// Initialise child's proc file (do this now to make error handling simpler)
+	*childProcData=*procData;
+
+	childProcData->ramFd=KernelFsFdInvalid;
+	childProcData->regs[0]=0; // indicate success in the child
+	for(ProcManLocalFd localFd=1; localFd<ProcManMaxFds; ++localFd)
+		childProcData->fds[localFd-1]=KernelFsFdInvalid;
+
+	// Find a PID for the new process
+	ProcManPid childPid=procManFindUnusedPid();
+	if (childPid==ProcManPidMax) {
+		kernelLog(LogTypeWarning, kstrP("could not fork from %u - no spare PIDs\n"), parentPid);
+		goto error;
+	}
+	ProcManProcess *child=&(procManData.processes[childPid]);
+
+	// Clear process struct as required
+	child->state=ProcManProcessStateUnused;
+	child->progmemFd=KernelFsFdInvalid;
+	child->procFd=KernelFsFdInvalid;
+	child->textIndex=ProcManTextIndexInvalid;
+	child->ramOwnerPid=childPid;
+	child->instructionCounter=0;
+#ifndef ARDUINO
+	procManProcessProfileInit(child);
+	memset(&child->stats, 0, sizeof(child->stats));
+#endif
+
+	// Create and open proc file
+	sprintf(scratchPath, "/tmp/proc%u", childPid);
+	if (!kernelFsFileCreateWithSize(scratchPath, sizeof(ProcManProcessProcData))) {
+		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not create child process data file at '%s' of size %u\n"), parentPid, scratchPath, sizeof(procManProcessLoadProcData));
+		goto error;
+	}
+
+	child->procFd=kernelFsFileOpen(scratchPath, KernelFsFdModeRW);
+	if (child->procFd==KernelFsFdInvalid) {
+		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not open child process data file at '%s'\n"), parentPid, scratchPath);
+		goto error;
+	}
+
+	// Attempt to create and open ram file
+	sprintf(scratchPath, "/tmp/ram%u", childPid);
+	uint16_t ramTotalSize=procData->envVarDataLen+procData->ramLen;
+	if (!kernelFsFileCreateWithSize(scratchPath, ramTotalSize)) {
+		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not create child ram data file at '%s' of size %u\n"), parentPid, scratchPath, ramTotalSize);
+		goto error;
+	}
+
+	childProcData->ramFd=kernelFsFileOpen(scratchPath, KernelFsFdModeRW);
+	if (childProcData->ramFd==KernelFsFdInvalid) {
+		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not open child ram data file at '%s'\n"), parentPid, scratchPath);
+		goto error;
+	}
+
+	// Try to use same FD as parent for the program data
+	// but if this fails then try to open again with new global fd.
+	child->state=ProcManProcessStateActive;
+
+	child->progmemFd=kernelFsFileDupeOrOpen(procManData.processes[parentPid].progmemFd);
+	if (child->progmemFd==KernelFsFdInvalid) {
+		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not reopen progmem fd %u\n"), parentPid, procManData.processes[parentPid].progmemFd);
+		goto error;
+	}
+	procManProcessAttachText(child);
+
+	// Duplicate any open file descriptors
+	for(ProcManLocalFd localFd=1; localFd<ProcManMaxFds; ++localFd) {
+		// No file open in this slot?
+		if (procData->fds[localFd-1]==KernelFsFdInvalid)
+			continue;
+
+		// There is a file open here, so try to re-open it in the new process.
+		KStr scratchPathK=kernelFsGetFilePath(procData->fds[localFd-1]);
+		assert(!kstrIsNull(scratchPathK));
+		kstrStrcpy(scratchPath, scratchPathK);
+
+		childProcData->fds[localFd-1]=kernelFsFileDupeOrOpen(procData->fds[localFd-1]);
+		if (childProcData->fds[localFd-1]==KernelFsFdInvalid) {
+			kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not reopen '%s' (local fd %u, original global fd %u)\n"), parentPid, scratchPath, localFd, procData->fds[localFd-1]);
+			goto error;
+		}
+	}
+
+	// Save completed child proc data to disk
+	if (!procManProcessStoreProcData(child, childProcData)) {
+		sprintf(scratchPath, "/tmp/proc%u", childPid);
+		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not save child process data file to '%s'\n"), parentPid, scratchPath);
+		goto error;
+	}
+
+	// Copy parent's ram into child's
+	// Use a scratch buffer to copy up to 256 bytes at a time.
+	KernelFsFileOffset i;
+	for(i=0; i+255<ramTotalSize; i+=256) {
+		if (kernelFsFileReadOffset(procData->ramFd, i, (uint8_t *)procManScratchBuf256, 256)!=256 ||
+		    kernelFsFileWriteOffset(childProcData->ramFd, i, (const uint8_t *)procManScratchBuf256, 256)!=256) {
+			kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not copy parent's RAM into child's (managed %u/%u)\n"), parentPid, i, ramTotalSize);
+			goto error;
+		}
+	}
+	for(; i<ramTotalSize; i++) {
+		uint8_t value;
+		if (kernelFsFileReadOffset(procData->ramFd, i, &value, 1)!=1 ||
+		    kernelFsFileWriteOffset(childProcData->ramFd, i, &value, 1)!=1) {
+			kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not copy parent's RAM into child's (managed %u/%u)\n"), parentPid, i, ramTotalSize);
+			goto error;
+		}
+	}
+
+	// Update parent return value with child's PID
+	procData->regs[0]=childPid;
+
+	kernelLog(LogTypeInfo, kstrP("forked from %u, creating child %u\n"), parentPid, childPid);
+
+	return;
+
+	error:
+	if (childPid!=ProcManPidMax) {
+		for(ProcManLocalFd localFd=1; localFd<ProcManMaxFds; ++localFd)
+			kernelFsFileClose(childProcData->fds[localFd-1]);
+
+		procManProcessDetachText(&procManData.processes[childPid]);
+		kernelFsFileClose(procManData.processes[childPid].progmemFd);
+		procManData.processes[childPid].progmemFd=KernelFsFdInvalid;
+
+		kernelFsFileClose(procManData.processes[childPid].procFd);
+		procManData.processes[childPid].procFd=KernelFsFdInvalid;
+		sprintf(scratchPath, "/tmp/proc%u", childPid);
+		kernelFsFileDelete(scratchPath); // TODO: If we fail to even open the programPath then this may delete a file which has nothing to do with us
 
-			return true;
-		} break;
+		kernelFsFileClose(childProcData->ramFd);
+		sprintf(scratchPath, "/tmp/ram%u", childPid);
+		kernelFsFileDelete(scratchPath); // TODO: If we fail to even open the programPath then this may delete a file which has nothing to do with us
+
+		procManData.processes[childPid].state=ProcManProcessStateUnused;
+		procManData.processes[childPid].instructionCounter=0;
 	}
 
-	kernelLog(LogTypeWarning, kstrP("invalid syscall id=%i, process %u (%s), killing\n"), syscallId, procManGetPidFromProcess(process), procManGetExecPathFromProcess(process));
-	return false;
+	// Indicate error
+	procData->regs[0]=ProcManPidMax;
+#undef scratchPath
+#undef childProcData
 }
 
-STATICASSERT(sizeof(ProcManProcessProcData)<KernelFsPathMax); // This is due to using one of the path scratch buffers to hold child's procData temporarily
-void procManProcessFork(ProcManProcess *parent, ProcManProcessProcData *procData) {
+void procManProcessClone(ProcManProcess *parent, ProcManProcessProcData *procData) {
 	assert(parent!=NULL);
 	assert(procData!=NULL);
 
@@ -3031,20 +4347,24 @@ void procManProcessFork(ProcManProcess *parent, ProcManProcessProcData *procData
 
 	ProcManPid parentPid=procManGetPidFromProcess(parent);
 
-	kernelLog(LogTypeInfo, kstrP("fork request from process %u\n"), parentPid);
+	kernelLog(LogTypeInfo, kstrP("clone request from process %u\n"), parentPid);
 
 	// Initialise child's proc file (do this now to make error handling simpler)
+	// The child shares the parent's ram (and so ram fd) but starts with its own registers.
 	*childProcData=*procData;
 
-	childProcData->ramFd=KernelFsFdInvalid;
-	childProcData->regs[0]=0; // indicate success in the child
+	for(BytecodeRegister reg=0; reg<BytecodeRegisterNB; ++reg)
+		childProcData->regs[reg]=0;
+	childProcData->regs[0]=procData->regs[3];
+	childProcData->regs[BytecodeRegisterSP]=procData->regs[2];
+	childProcData->regs[BytecodeRegisterIP]=procData->regs[1];
 	for(ProcManLocalFd localFd=1; localFd<ProcManMaxFds; ++localFd)
 		childProcData->fds[localFd-1]=KernelFsFdInvalid;
 
 	// Find a PID for the new process
 	ProcManPid childPid=procManFindUnusedPid();
 	if (childPid==ProcManPidMax) {
-		kernelLog(LogTypeWarning, kstrP("could not fork from %u - no spare PIDs\n"), parentPid);
+		kernelLog(LogTypeWarning, kstrP("could not clone from %u - no spare PIDs\n"), parentPid);
 		goto error;
 	}
 	ProcManProcess *child=&(procManData.processes[childPid]);
@@ -3053,62 +4373,45 @@ void procManProcessFork(ProcManProcess *parent, ProcManProcessProcData *procData
 	child->state=ProcManProcessStateUnused;
 	child->progmemFd=KernelFsFdInvalid;
 	child->procFd=KernelFsFdInvalid;
+	child->textIndex=ProcManTextIndexInvalid;
+	child->ramOwnerPid=parent->ramOwnerPid;
 	child->instructionCounter=0;
 #ifndef ARDUINO
-	memset(child->profilingCounts, 0, sizeof(child->profilingCounts[0])*BytecodeMemoryProgmemSize);
+	procManProcessProfileInit(child);
+	memset(&child->stats, 0, sizeof(child->stats));
 #endif
 
 	// Create and open proc file
 	sprintf(scratchPath, "/tmp/proc%u", childPid);
 	if (!kernelFsFileCreateWithSize(scratchPath, sizeof(ProcManProcessProcData))) {
-		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not create child process data file at '%s' of size %u\n"), parentPid, scratchPath, sizeof(procManProcessLoadProcData));
+		kernelLog(LogTypeWarning, kstrP("could not clone from %u - could not create child process data file at '%s' of size %u\n"), parentPid, scratchPath, sizeof(procManProcessLoadProcData));
 		goto error;
 	}
 
 	child->procFd=kernelFsFileOpen(scratchPath, KernelFsFdModeRW);
 	if (child->procFd==KernelFsFdInvalid) {
-		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not open child process data file at '%s'\n"), parentPid, scratchPath);
-		goto error;
-	}
-
-	// Attempt to create and open ram file
-	sprintf(scratchPath, "/tmp/ram%u", childPid);
-	uint16_t ramTotalSize=procData->envVarDataLen+procData->ramLen;
-	if (!kernelFsFileCreateWithSize(scratchPath, ramTotalSize)) {
-		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not create child ram data file at '%s' of size %u\n"), parentPid, scratchPath, ramTotalSize);
-		goto error;
-	}
-
-	childProcData->ramFd=kernelFsFileOpen(scratchPath, KernelFsFdModeRW);
-	if (childProcData->ramFd==KernelFsFdInvalid) {
-		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not open child ram data file at '%s'\n"), parentPid, scratchPath);
+		kernelLog(LogTypeWarning, kstrP("could not clone from %u - could not open child process data file at '%s'\n"), parentPid, scratchPath);
 		goto error;
 	}
 
-	// Try to use same FD as parent for the program data
-	// but if this fails then try to open again with new global fd.
+	// Share parent's program data
 	child->state=ProcManProcessStateActive;
 
-	child->progmemFd=kernelFsFileDupeOrOpen(procManData.processes[parentPid].progmemFd);
+	child->progmemFd=kernelFsFileDupeOrOpen(parent->progmemFd);
 	if (child->progmemFd==KernelFsFdInvalid) {
-		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not reopen progmem fd %u\n"), parentPid, procManData.processes[parentPid].progmemFd);
+		kernelLog(LogTypeWarning, kstrP("could not clone from %u - could not reopen progmem fd %u\n"), parentPid, parent->progmemFd);
 		goto error;
 	}
+	procManProcessAttachText(child);
 
-	// Duplicate any open file descriptors
+	// Duplicate any open file descriptors (as with fork, files opened after this point are not shared)
 	for(ProcManLocalFd localFd=1; localFd<ProcManMaxFds; ++localFd) {
-		// No file open in this slot?
 		if (procData->fds[localFd-1]==KernelFsFdInvalid)
 			continue;
 
-		// There is a file open here, so try to re-open it in the new process.
-		KStr scratchPathK=kernelFsGetFilePath(procData->fds[localFd-1]);
-		assert(!kstrIsNull(scratchPathK));
-		kstrStrcpy(scratchPath, scratchPathK);
-
 		childProcData->fds[localFd-1]=kernelFsFileDupeOrOpen(procData->fds[localFd-1]);
 		if (childProcData->fds[localFd-1]==KernelFsFdInvalid) {
-			kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not reopen '%s' (local fd %u, original global fd %u)\n"), parentPid, scratchPath, localFd, procData->fds[localFd-1]);
+			kernelLog(LogTypeWarning, kstrP("could not clone from %u - could not reopen local fd %u (original global fd %u)\n"), parentPid, localFd, procData->fds[localFd-1]);
 			goto error;
 		}
 	}
@@ -3116,33 +4419,14 @@ void procManProcessFork(ProcManProcess *parent, ProcManProcessProcData *procData
 	// Save completed child proc data to disk
 	if (!procManProcessStoreProcData(child, childProcData)) {
 		sprintf(scratchPath, "/tmp/proc%u", childPid);
-		kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not save child process data file to '%s'\n"), parentPid, scratchPath);
+		kernelLog(LogTypeWarning, kstrP("could not clone from %u - could not save child process data file to '%s'\n"), parentPid, scratchPath);
 		goto error;
 	}
 
-	// Copy parent's ram into child's
-	// Use a scratch buffer to copy up to 256 bytes at a time.
-	KernelFsFileOffset i;
-	for(i=0; i+255<ramTotalSize; i+=256) {
-		if (kernelFsFileReadOffset(procData->ramFd, i, (uint8_t *)procManScratchBuf256, 256)!=256 ||
-		    kernelFsFileWriteOffset(childProcData->ramFd, i, (const uint8_t *)procManScratchBuf256, 256)!=256) {
-			kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not copy parent's RAM into child's (managed %u/%u)\n"), parentPid, i, ramTotalSize);
-			goto error;
-		}
-	}
-	for(; i<ramTotalSize; i++) {
-		uint8_t value;
-		if (kernelFsFileReadOffset(procData->ramFd, i, &value, 1)!=1 ||
-		    kernelFsFileWriteOffset(childProcData->ramFd, i, &value, 1)!=1) {
-			kernelLog(LogTypeWarning, kstrP("could not fork from %u - could not copy parent's RAM into child's (managed %u/%u)\n"), parentPid, i, ramTotalSize);
-			goto error;
-		}
-	}
-
 	// Update parent return value with child's PID
 	procData->regs[0]=childPid;
 
-	kernelLog(LogTypeInfo, kstrP("forked from %u, creating child %u\n"), parentPid, childPid);
+	kernelLog(LogTypeInfo, kstrP("cloned from %u, creating child %u (sharing ram of %u)\n"), parentPid, childPid, child->ramOwnerPid);
 
 	return;
 
@@ -3151,6 +4435,7 @@ void procManProcessFork(ProcManProcess *parent, ProcManProcessProcData *procData
 		for(ProcManLocalFd localFd=1; localFd<ProcManMaxFds; ++localFd)
 			kernelFsFileClose(childProcData->fds[localFd-1]);
 
+		procManProcessDetachText(&procManData.processes[childPid]);
 		kernelFsFileClose(procManData.processes[childPid].progmemFd);
 		procManData.processes[childPid].progmemFd=KernelFsFdInvalid;
 
@@ -3159,11 +4444,8 @@ void procManProcessFork(ProcManProcess *parent, ProcManProcessProcData *procData
 		sprintf(scratchPath, "/tmp/proc%u", childPid);
 		kernelFsFileDelete(scratchPath); // TODO: If we fail to even open the programPath then this may delete a file which has nothing to do with us
 
-		kernelFsFileClose(childProcData->ramFd);
-		sprintf(scratchPath, "/tmp/ram%u", childPid);
-		kernelFsFileDelete(scratchPath); // TODO: If we fail to even open the programPath then this may delete a file which has nothing to do with us
-
 		procManData.processes[childPid].state=ProcManProcessStateUnused;
+		procManData.processes[childPid].ramOwnerPid=childPid;
 		procManData.processes[childPid].instructionCounter=0;
 	}
 
@@ -3288,8 +4570,10 @@ bool procManProcessExecCommon(ProcManProcess *process, ProcManProcessProcData *p
 
 	// Close old fd
 	ProcManPid pid=procManGetPidFromProcess(process);
+	procManProcessDetachText(process);
 	kernelFsFileClose(procManData.processes[pid].progmemFd);
 	procManData.processes[pid].progmemFd=newProgmemFd;
+	procManProcessAttachText(process);
 
 	// Reset instruction pointer
 	procData->regs[BytecodeRegisterIP]=0;
@@ -3312,10 +4596,22 @@ bool procManProcessExecCommon(ProcManProcess *process, ProcManProcessProcData *p
 
 	sprintf(ramPath, "/tmp/ram%u", pid);
 
-	kernelFsFileClose(procData->ramFd);
-	if (!kernelFsFileResize(ramPath, newRamTotalSize)) {
-		kernelLog(LogTypeWarning, kstrP("exec in %u failed - could not resize new processes RAM file at '%s' to %u\n"), procManGetPidFromProcess(process), ramPath, newRamTotalSize);
-		return false;
+	if (procManProcessIsThread(process)) {
+		// The ram file we were using belongs to another process, so leave it alone and create our own
+		if (!kernelFsFileCreateWithSize(ramPath, newRamTotalSize)) {
+			kernelLog(LogTypeWarning, kstrP("exec in %u failed - could not create new processes RAM file at '%s' of size %u\n"), procManGetPidFromProcess(process), ramPath, newRamTotalSize);
+			return false;
+		}
+		process->ramOwnerPid=pid;
+	} else {
+		// Any threads would be left running in ram which no longer belongs to their program, so kill them
+		procManProcessKillThreads(pid);
+
+		kernelFsFileClose(procData->ramFd);
+		if (!kernelFsFileResize(ramPath, newRamTotalSize)) {
+			kernelLog(LogTypeWarning, kstrP("exec in %u failed - could not resize new processes RAM file at '%s' to %u\n"), procManGetPidFromProcess(process), ramPath, newRamTotalSize);
+			return false;
+		}
 	}
 	procData->ramFd=kernelFsFileOpen(ramPath, KernelFsFdModeRW);
 	assert(procData->ramFd!=KernelFsFdInvalid);
@@ -3367,8 +4663,12 @@ KernelFsFd procManProcessLoadProgmemFile(ProcManProcess *process, uint8_t *argc,
 	// Normalise path
 	kernelFsPathNormalise(originalExecPath);
 
-	// If no slashes and asked, Search through PATH for matching executables.
-	if (envPath!=NULL && strchr(originalExecPath, '/')==NULL) {
+	// If no slashes and asked, Search through PATH for matching executables (unless the result of an identical search is cached).
+	if (envPath!=NULL && strchr(originalExecPath, '/')==NULL && !procManExecCacheLookup(argvStart, envPath, originalExecPath)) {
+		uint16_t dirTokens[ProcManExecCacheDirsMax];
+		uint8_t dirCount=0;
+		bool cacheable=true;
+
 		const char *envPathPtr=envPath;
 		while(1) {
 			// End of PATH string?
@@ -3388,6 +4688,13 @@ KernelFsFd procManProcessLoadProgmemFile(ProcManProcess *process, uint8_t *argc,
 			if (strlen(originalExecPath)==0)
 				continue;
 
+			// Record state of directory so any cached result can be invalidated if it changes
+			kernelFsPathNormalise(originalExecPath);
+			if (dirCount<ProcManExecCacheDirsMax)
+				dirTokens[dirCount++]=kernelFsGetDirGenerationToken(originalExecPath);
+			else
+				cacheable=false;
+
 			// Add slash and given name
 			strcat(originalExecPath, "/");
 			strcat(originalExecPath, argvStart);
@@ -3401,6 +4708,9 @@ KernelFsFd procManProcessLoadProgmemFile(ProcManProcess *process, uint8_t *argc,
 			strcpy(originalExecPath, argvStart);
 			kernelFsPathNormalise(originalExecPath);
 		}
+
+		if (cacheable)
+			procManExecCacheAdd(argvStart, envPath, originalExecPath, dirTokens, dirCount);
 	}
 
 	// If no slash at start and asked, make path absolute.
@@ -3492,6 +4802,83 @@ KernelFsFd procManProcessLoadProgmemFile(ProcManProcess *process, uint8_t *argc,
 	return newProgmemFd;
 }
 
+bool procManExecCacheEntryMatches(const ProcManExecCacheEntry *entry, const char *name, const char *envPath) {
+	assert(entry!=NULL);
+	assert(name!=NULL);
+	assert(envPath!=NULL);
+
+	// Unused?
+	if (entry->path[0]=='\0')
+		return false;
+
+	// Compare exec name against basename of the result (which is the name itself if the search failed)
+	const char *basename=strrchr(entry->path, '/');
+	basename=(basename!=NULL ? basename+1 : entry->path);
+	if (strcmp(basename, name)!=0)
+		return false;
+
+	return (strcmp(entry->envPath, envPath)==0);
+}
+
+bool procManExecCacheLookup(const char *name, const char *envPath, char path[KernelFsPathMax]) {
+	assert(name!=NULL);
+	assert(envPath!=NULL);
+	assert(path!=NULL);
+
+	// If devices have been added or removed since the entries were added then they may no longer be correct
+	uint16_t generation=kernelFsGetGeneration();
+	if (generation!=procManData.execCacheGeneration) {
+		for(uint8_t i=0; i<ProcManExecCacheSize; ++i)
+			procManData.execCache[i].path[0]='\0';
+		procManData.execCacheGeneration=generation;
+	}
+
+	// Look for matching entry
+	for(uint8_t i=0; i<ProcManExecCacheSize; ++i) {
+		ProcManExecCacheEntry *entry=&procManData.execCache[i];
+		if (!procManExecCacheEntryMatches(entry, name, envPath))
+			continue;
+
+		// Have any of the directories searched been modified since?
+		uint8_t j;
+		for(j=0; j<entry->dirCount; ++j)
+			if (!kernelFsDirGenerationTokenIsCurrent(entry->dirTokens[j]))
+				break;
+		if (j<entry->dirCount) {
+			entry->path[0]='\0';
+			break;
+		}
+
+		strcpy(path, entry->path);
+		++procManData.execCacheHits;
+		return true;
+	}
+
+	++procManData.execCacheMisses;
+	return false;
+}
+
+void procManExecCacheAdd(const char *name, const char *envPath, const char *path, const uint16_t *dirTokens, uint8_t dirCount) {
+	assert(name!=NULL);
+	assert(envPath!=NULL);
+	assert(path!=NULL);
+	assert(strlen(path)<KernelFsPathMax);
+	assert(dirCount<=ProcManExecCacheDirsMax);
+	assert(dirTokens!=NULL || dirCount==0);
+
+	// PATH too long to store?
+	if (strlen(envPath)>=KernelFsPathMax)
+		return;
+
+	ProcManExecCacheEntry *entry=&procManData.execCache[procManData.execCacheNext];
+	procManData.execCacheNext=(procManData.execCacheNext+1)%ProcManExecCacheSize;
+
+	strcpy(entry->envPath, envPath);
+	strcpy(entry->path, path);
+	memcpy(entry->dirTokens, dirTokens, dirCount*sizeof(uint16_t));
+	entry->dirCount=dirCount;
+}
+
 bool procManProcessMemoryStrlen(ProcManProcess *process, ProcManProcessProcData *procData, BytecodeWord strAddr, BytecodeWord *len) {
 	assert(process!=NULL);
 	assert(procData!=NULL);
@@ -3603,6 +4990,9 @@ bool procManProcessReadCommon(ProcManProcess *process, ProcManProcessProcData *p
 
 	// Update r0 to indicate how many bytes were read
 	procData->regs[0]=i;
+#ifndef ARDUINO
+	process->stats.fdBytesRead[localFd]+=i;
+#endif
 
 	return true;
 }
@@ -3658,6 +5048,9 @@ bool procManProcessWriteCommon(ProcManProcess *process, ProcManProcessProcData *
 
 	// Update r0 to indicate number of bytes written
 	procData->regs[0]=i;
+#ifndef ARDUINO
+	process->stats.fdBytesWritten[localFd]+=i;
+#endif
 
 	return true;
 }
@@ -3751,6 +5144,10 @@ void procManProcessCloseFile(ProcManProcess *process, ProcManProcessProcData *pr
 
 	// Remove from fd table
 	procData->fds[localFd-1]=KernelFsFdInvalid;
+#ifndef ARDUINO
+	process->stats.fdBytesRead[localFd]=0;
+	process->stats.fdBytesWritten[localFd]=0;
+#endif
 }
 
 KernelFsFd procManProcessGetGlobalFdFromLocal(ProcManProcess *process, ProcManProcessProcData *procData, ProcManLocalFd localFd) {
@@ -3800,6 +5197,51 @@ void procManResetInstructionCounters(void) {
 		procManData.processes[i].instructionCounter=0;
 }
 
+void procManProcessAttachText(ProcManProcess *process) {
+	assert(process!=NULL);
+	assert(process->textIndex==ProcManTextIndexInvalid);
+
+	// Can the progmem file be mapped at all? If not reads simply go via the fd
+	KernelFsFileMapping mapping;
+	if (!kernelFsFileGetMapping(process->progmemFd, &mapping))
+		return;
+
+	// Look for another process running the same executable, noting a free slot in case there is none
+	uint8_t freeIndex=ProcManTextIndexInvalid;
+	for(uint8_t i=0; i<ProcManTextMax; ++i) {
+		ProcManText *text=&procManData.texts[i];
+		if (text->refCount==0) {
+			if (freeIndex==ProcManTextIndexInvalid)
+				freeIndex=i;
+			continue;
+		}
+
+		if (kernelFsFileMappingEqual(&text->mapping, &mapping)) {
+			++text->refCount;
+			process->textIndex=i;
+			return;
+		}
+	}
+
+	if (freeIndex==ProcManTextIndexInvalid)
+		return;
+
+	procManData.texts[freeIndex].mapping=mapping;
+	procManData.texts[freeIndex].refCount=1;
+	process->textIndex=freeIndex;
+}
+
+void procManProcessDetachText(ProcManProcess *process) {
+	assert(process!=NULL);
+
+	if (process->textIndex==ProcManTextIndexInvalid)
+		return;
+
+	assert(procManData.texts[process->textIndex].refCount>0);
+	--procManData.texts[process->textIndex].refCount;
+	process->textIndex=ProcManTextIndexInvalid;
+}
+
 void procManProcessDebug(ProcManProcess *process, ProcManProcessProcData *procData) {
 	assert(process!=NULL);
 	assert(procData!=NULL);
@@ -3902,6 +5344,8 @@ bool procManPrefetchDataReadByte(ProcManPrefetchData *pd, ProcManProcess *proces
 
 	// Not already in cache?
 	if (addr<pd->baseAddr || addr>=pd->baseAddr+pd->len) {
+		assert(procManKernelLockIsHeld());
+
 		// Attempt to read largest block we can, but try smaller sizes if this fails.
 		for(pd->len=ProcManPrefetchDataBufferSize; pd->len>0; pd->len/=2)
 			if (procManProcessMemoryReadBlock(process, procData, addr, pd->buffer, pd->len, false))
@@ -3920,6 +5364,149 @@ bool procManPrefetchDataReadByte(ProcManPrefetchData *pd, ProcManProcess *proces
 	return true;
 }
 
+bool procManPrefetchDataCanExecUnlocked(const ProcManPrefetchData *pd, uint16_t addr) {
+	assert(pd!=NULL);
+
+	// Refilling the prefetch buffer needs the lock, so the instruction must already be in it (we assume worst case length)
+	uint32_t bufferEnd=((uint32_t)pd->baseAddr)+pd->len;
+	if (addr<pd->baseAddr || ((uint32_t)addr)+3>bufferEnd)
+		return false;
+
+	BytecodeInstruction3Byte instruction;
+	memcpy(instruction, pd->buffer+(addr-pd->baseAddr), sizeof(instruction));
+	BytecodeInstructionInfo info;
+	bytecodeInstructionParse(&info, instruction);
+
+	// Look for instructions which only touch registers (and cannot fail, which would involve logging)
+	switch(info.type) {
+		case BytecodeInstructionTypeMemory:
+			return (info.d.memory.type==BytecodeInstructionMemoryTypeSet4);
+		break;
+		case BytecodeInstructionTypeAlu:
+			switch(info.d.alu.type) {
+				case BytecodeInstructionAluTypeInc:
+				case BytecodeInstructionAluTypeDec:
+				case BytecodeInstructionAluTypeAdd:
+				case BytecodeInstructionAluTypeSub:
+				case BytecodeInstructionAluTypeMul:
+				case BytecodeInstructionAluTypeXor:
+				case BytecodeInstructionAluTypeOr:
+				case BytecodeInstructionAluTypeAnd:
+				case BytecodeInstructionAluTypeCmp:
+				case BytecodeInstructionAluTypeShiftLeft:
+				case BytecodeInstructionAluTypeShiftRight:
+					return true;
+				break;
+				case BytecodeInstructionAluTypeSkip:
+					// Any instructions which may be skipped must also be in the buffer
+					return (((uint32_t)addr)+3+3*(info.d.alu.opBReg+1u)<=bufferEnd);
+				break;
+				case BytecodeInstructionAluTypeExtra:
+					switch((BytecodeInstructionAluExtraType)info.d.alu.opBReg) {
+						case BytecodeInstructionAluExtraTypeNot:
+						case BytecodeInstructionAluExtraTypeClz:
+							return true;
+						break;
+						default:
+							return false;
+						break;
+					}
+				break;
+				default:
+					return false;
+				break;
+			}
+		break;
+		case BytecodeInstructionTypeMisc:
+			return (info.d.misc.type==BytecodeInstructionMiscTypeNop || info.d.misc.type==BytecodeInstructionMiscTypeSet8 || info.d.misc.type==BytecodeInstructionMiscTypeSet16);
+		break;
+	}
+
+	return false;
+}
+
+#ifndef ARDUINO
+void *procManWorkerThreadMain(void *userData) {
+	uint32_t seenGeneration=0;
+	while(1) {
+		// Wait for next round to start (or to be told to quit)
+		pthread_mutex_lock(&procManData.roundMutex);
+		while(procManData.roundGeneration==seenGeneration && !procManData.workersQuit)
+			pthread_cond_wait(&procManData.roundStartCond, &procManData.roundMutex);
+		seenGeneration=procManData.roundGeneration;
+		bool quit=procManData.workersQuit;
+		pthread_mutex_unlock(&procManData.roundMutex);
+		if (quit)
+			break;
+
+		// Tick processes and then indicate we are done
+		procManWorkersRunRoundTicks();
+
+		pthread_mutex_lock(&procManData.roundMutex);
+		if (--procManData.roundWorkersBusy==0)
+			pthread_cond_signal(&procManData.roundEndCond);
+		pthread_mutex_unlock(&procManData.roundMutex);
+	}
+
+	return NULL;
+}
+
+void procManWorkersRunRound(void) {
+	// Start the other threads
+	pthread_mutex_lock(&procManData.roundMutex);
+	__atomic_store_n(&procManData.roundNextPid, 0, __ATOMIC_RELAXED);
+	procManData.roundWorkersBusy=procManData.workerCount-1;
+	++procManData.roundGeneration;
+	pthread_cond_broadcast(&procManData.roundStartCond);
+	pthread_mutex_unlock(&procManData.roundMutex);
+
+	// Do our share of the work
+	procManWorkersRunRoundTicks();
+
+	// Wait for other threads to finish
+	pthread_mutex_lock(&procManData.roundMutex);
+	while(procManData.roundWorkersBusy>0)
+		pthread_cond_wait(&procManData.roundEndCond, &procManData.roundMutex);
+	pthread_mutex_unlock(&procManData.roundMutex);
+}
+
+void procManWorkersRunRoundTicks(void) {
+	// Each thread claims the next unticked pid until there are none left, so that busy processes naturally spread out across threads
+	ProcManPid pid;
+	while((pid=__atomic_fetch_add(&procManData.roundNextPid, 1, __ATOMIC_RELAXED))<ProcManPidMax) {
+		procManKernelLock();
+		procManProcessTick(pid);
+		procManKernelUnlock();
+	}
+}
+#endif
+
+void procManKernelLock(void) {
+#ifndef ARDUINO
+	if (procManData.workerCount>1 && !procManKernelLockHeld) {
+		pthread_mutex_lock(&procManData.kernelLock);
+		procManKernelLockHeld=true;
+	}
+#endif
+}
+
+void procManKernelUnlock(void) {
+#ifndef ARDUINO
+	if (procManKernelLockHeld) {
+		procManKernelLockHeld=false;
+		pthread_mutex_unlock(&procManData.kernelLock);
+	}
+#endif
+}
+
+bool procManKernelLockIsHeld(void) {
+#ifndef ARDUINO
+	return (procManData.workerCount<=1 || procManKernelLockHeld);
+#else
+	return true;
+#endif
+}
+
 void procManArgvDebug(uint8_t argc, const char *argvStart) {
 	assert(argvStart!=NULL);
 
@@ -3929,3 +5516,99 @@ void procManArgvDebug(uint8_t argc, const char *argvStart) {
 		kernelLog(LogTypeInfo, kstrP("Argv Debug:         arg%u='%s'\n"), i, arg);
 	}
 }
+
+void procManTimerAdd(ProcManPid pid, uint32_t time) {
+	assert(pid<ProcManPidMax);
+	assert(procManData.timerCount<ProcManPidMax);
+
+	// Add to end of heap then restore heap property
+	uint8_t index=procManData.timerCount++;
+	procManData.timerTimes[index]=time;
+	procManData.timerPids[index]=pid;
+	procManTimerSiftUp(index);
+}
+
+void procManTimerRemove(ProcManPid pid) {
+	for(uint8_t i=0; i<procManData.timerCount; ++i)
+		if (procManData.timerPids[i]==pid) {
+			procManTimerRemoveIndex(i);
+			return;
+		}
+}
+
+void procManTimerRemoveIndex(uint8_t index) {
+	assert(index<procManData.timerCount);
+
+	// Move last entry into the gap, then restore heap property (it may need to move either way)
+	--procManData.timerCount;
+	if (index==procManData.timerCount)
+		return;
+
+	procManTimerSwap(index, procManData.timerCount);
+	procManTimerSiftUp(index);
+	procManTimerSiftDown(index);
+}
+
+void procManTimerExpire(ProcManPid pid) {
+	ProcManProcess *process=procManGetProcessByPid(pid);
+	if (process==NULL)
+		return;
+
+	switch(process->state) {
+		case ProcManProcessStateWaitingWaitpid:
+			// Wake process, setting r0 to indicate a timeout occured
+			if (!procManProcessSaveProcDataReg(process, 0, ProcManExitStatusTimeout)) {
+				kernelLog(LogTypeWarning, kstrP("could not wake process %u from waitpid syscall on timeout (could not save r0 proc data)\n"), pid);
+				return;
+			}
+			process->state=ProcManProcessStateActive;
+		break;
+		case ProcManProcessStateWaitingSleep:
+			// Wake process (r0 was set by the syscall)
+			process->state=ProcManProcessStateActive;
+		break;
+		default:
+			// Timers are removed whenever a process is woken early, so this should not happen
+			kernelLog(LogTypeWarning, kstrP("process %u timer expired but process was not waiting for it (state %u)\n"), pid, process->state);
+		break;
+	}
+}
+
+bool procManTimerIsBefore(uint8_t indexA, uint8_t indexB) {
+	return ((int32_t)(procManData.timerTimes[indexA]-procManData.timerTimes[indexB])<0);
+}
+
+void procManTimerSwap(uint8_t indexA, uint8_t indexB) {
+	uint32_t tempTime=procManData.timerTimes[indexA];
+	procManData.timerTimes[indexA]=procManData.timerTimes[indexB];
+	procManData.timerTimes[indexB]=tempTime;
+
+	ProcManPid tempPid=procManData.timerPids[indexA];
+	procManData.timerPids[indexA]=procManData.timerPids[indexB];
+	procManData.timerPids[indexB]=tempPid;
+}
+
+void procManTimerSiftUp(uint8_t index) {
+	while(index>0) {
+		uint8_t parent=(index-1)/2;
+		if (!procManTimerIsBefore(index, parent))
+			break;
+		procManTimerSwap(index, parent);
+		index=parent;
+	}
+}
+
+void procManTimerSiftDown(uint8_t index) {
+	while(1) {
+		uint8_t smallest=index;
+		uint8_t left=2*index+1, right=2*index+2;
+		if (left<procManData.timerCount && procManTimerIsBefore(left, smallest))
+			smallest=left;
+		if (right<procManData.timerCount && procManTimerIsBefore(right, smallest))
+			smallest=right;
+		if (smallest==index)
+			break;
+		procManTimerSwap(index, smallest);
+		index=smallest;
+	}
+}
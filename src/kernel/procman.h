@@ -5,6 +5,7 @@
 
 #include "bytecode.h"
 #include "kernelfs.h"
+#include "ktime.h"
 
 typedef uint8_t ProcManPid;
 #define ProcManPidMax 16
@@ -24,6 +25,34 @@ typedef enum {
 
 typedef struct ProcManProcessProcData ProcManProcessProcData;
 
+#define ProcManSyscallCountsMax 4096 // syscalls with ids at least this are only included in the total (see procManGetSyscallTotal)
+
+#ifndef ARDUINO
+// Per-process performance counters, kept since the process was created (so across exec but not fork).
+// These are PC only as they would use too much RAM on the Arduino. The layout is also what userspace sees when reading /dev/procstats,
+// which holds one of these for each pid (all zeros for unused pids) with each field big-endian (as 32 bit values are in process memory).
+// Fields should only be added to the end, and after the instruction count must all be 32 bit.
+typedef enum {
+	ProcManWaitTypeWaitpid,
+	ProcManWaitTypeRead, // including block device reads
+	ProcManWaitTypeWrite,
+	ProcManWaitTypeSleep,
+	ProcManWaitTypeFutex,
+	ProcManWaitTypeNB,
+} ProcManWaitType;
+
+#define ProcManStatsSyscallGroupNB 9 // upper byte of syscall id (see BytecodeSyscallId), with higher groups counted in the last
+
+typedef struct {
+	uint64_t instructions;
+	uint32_t ticks; // number of scheduler ticks in which the process ran at least one instruction
+	uint32_t syscalls[ProcManStatsSyscallGroupNB];
+	uint32_t fdBytesRead[ProcManMaxFds], fdBytesWritten[ProcManMaxFds]; // indexed by local fd, reset when the fd is closed (entry 0 is unused)
+	uint32_t ramGrowths; // number of times the process' RAM file had to be enlarged
+	uint32_t waitMs[ProcManWaitTypeNB]; // time spent blocked, by type of wait
+} ProcManProcessStats;
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // General functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -32,9 +61,27 @@ void procManInit(void);
 void procManQuit(void);
 
 void procManTickAll(void);
+bool procManGetNextTimerTime(KTime *time); // sets time to the earliest time (monotonic ms) a sleeping or timed waitpid process should wake, returns false if there are no such processes
 
 ProcManPid procManGetProcessCount(void);
 
+uint32_t procManGetExecCacheHits(void); // number of execs which found the result of their PATH search in the cache
+uint32_t procManGetExecCacheMisses(void);
+
+#ifndef ARDUINO
+uint64_t procManGetInstructionTotal(void); // number of instructions executed by all processes since boot
+uint32_t procManGetSyscallCount(uint16_t syscallId); // number of times the given syscall has been made (by any process) since boot
+uint32_t procManGetSyscallTotal(void);
+
+uint32_t procManStatsFsFunctor(KernelFsDeviceFunctorType type, void *userData, uint8_t *data, KernelFsFileOffset len, KernelFsFileOffset addr); // for /dev/procstats
+#define ProcManStatsDevSize (ProcManPidMax*sizeof(ProcManProcessStats))
+
+// Save/restore the process table (see snapshot.h). Registers, memory and local fd tables are kept in files in /tmp, so are covered by /dev/ram, but the global fds they refer to must be restored first (see kernelFsSnapshotLoad).
+// Loading should happen straight after procManInit.
+bool procManSnapshotSave(FILE *file);
+bool procManSnapshotLoad(FILE *file);
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Process functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -52,4 +99,8 @@ bool procManProcessExists(ProcManPid pid);
 
 bool procManProcessGetOpenGlobalFds(ProcManPid pid, KernelFsFd fds[ProcManMaxFds]); // if process is active (in tick loop) this may be out of date
 
+#ifndef ARDUINO
+bool procManProcessGetStats(ProcManPid pid, ProcManProcessStats *stats); // returns false if no such process
+#endif
+
 #endif
@@ -6,5 +6,17 @@
 
 typedef uint32_t ProfileCounter;
 
+// Call stack sampling (see --profile-stacks kernel option).
+// Each sample is the IP plus the call site of each return address found on the stack (there is no frame pointer, so these are found by
+// scanning back from SP for words which point just past a call instruction). Identical stacks are counted together and written on process exit
+// in 'folded' form, one line per stack: addresses in hex from the outermost call site to the sampled IP separated by ';', then a space and the count.
+#define ProfileStackDepthMax 16 // including the sampled IP
+
+typedef struct {
+	uint32_t count; // 0 if unused
+	uint8_t depth;
+	uint16_t addrs[ProfileStackDepthMax]; // sampled IP first, then call sites from innermost outwards
+} ProfileStack;
+
 #endif
 #endif
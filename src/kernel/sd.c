@@ -40,6 +40,7 @@ SdInitResult sdInit(SdCard *card, uint8_t powerPin, uint8_t slaveSelectPin) {
 	card->powerPin=powerPin;
 	card->slaveSelectPin=slaveSelectPin;
 	card->addressMode=SdAddressModeByte;
+	card->readPending=false;
 
 	// Attempt to grab SPI bus lock
 	if (!kernelSpiGrabLockNoSlaveSelect()) {
@@ -307,6 +308,10 @@ void sdQuit(SdCard *card) {
 	if (card->type==SdTypeBadCard)
 		return;
 
+	// Complete any pending read so that the SPI bus lock is released
+	if (card->readPending)
+		sdReadBlockFinish(card);
+
 	// Turn off power pin
 	pinWrite(card->powerPin, false);
 
@@ -315,6 +320,15 @@ void sdQuit(SdCard *card) {
 }
 
 bool sdReadBlock(SdCard *card, uint32_t block, uint8_t *data) {
+	if (!sdReadBlockStart(card, block, data))
+		return false;
+	sdReadBlockFinish(card);
+	return true;
+}
+
+bool sdReadBlockStart(SdCard *card, uint32_t block, uint8_t *data) {
+	assert(!card->readPending);
+
 	uint8_t responseByte;
 
 	// Bad block?
@@ -356,9 +370,35 @@ bool sdReadBlock(SdCard *card, uint32_t block, uint8_t *data) {
 		goto error;
 	}
 
-	// Read data bytes
-	for(unsigned i=0; i<SdBlockSize; ++i)
-		data[i]=spiReadByte(); // Note: we cannot use sdWaitForResponse as we do not want to ignore 0xFF bytes for once
+	// Queue transfer of data bytes (clocking out 0xFF) - the SPI bus lock is held until sdReadBlockFinish.
+	// Note: we cannot use sdWaitForResponse as we do not want to ignore 0xFF bytes for once
+	spiTransferInit(&card->readTransfer, NULL, data, SdBlockSize, 0xFF);
+	if (!spiTransferQueue(&card->readTransfer)) {
+		kernelLog(LogTypeWarning, kstrP("sdReadBlock failed: could not queue SPI transfer (block=%"PRIu32")\n"), block);
+		goto error;
+	}
+	card->readPending=true;
+
+	// Write to log
+	kernelLog(LogTypeInfo, kstrP("sdReadBlock started (block=%"PRIu32")\n"), block);
+
+	return true;
+
+	error:
+	pinWrite(card->slaveSelectPin, true);
+	kernelSpiReleaseLock();
+	return false;
+}
+
+bool sdReadBlockIsComplete(const SdCard *card) {
+	return (!card->readPending || spiTransferIsComplete(&card->readTransfer));
+}
+
+void sdReadBlockFinish(SdCard *card) {
+	assert(card->readPending);
+
+	// Wait for data bytes to arrive
+	spiTransferWait(&card->readTransfer);
 
 	// Read (and ignore) two CRC bytes
 	spiReadByte();
@@ -371,18 +411,12 @@ bool sdReadBlock(SdCard *card, uint32_t block, uint8_t *data) {
 	pinWrite(card->slaveSelectPin, true);
 	kernelSpiReleaseLock();
 
-	// Write to log
-	kernelLog(LogTypeInfo, kstrP("sdReadBlock success (block=%"PRIu32")\n"), block);
-
-	return true;
-
-	error:
-	pinWrite(card->slaveSelectPin, true);
-	kernelSpiReleaseLock();
-	return false;
+	card->readPending=false;
 }
 
 bool sdWriteBlock(SdCard *card, uint32_t block, const uint8_t *data) {
+	assert(!card->readPending);
+
 	uint8_t responseByte;
 
 	// Bad block?
@@ -4,6 +4,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "spi.h"
+
 #define SdBlockSizeBits 9
 #define SdBlockSize (1<<SdBlockSizeBits) // =512
 
@@ -27,20 +29,29 @@ typedef enum {
 } SdAddressMode;
 #define SdAddressModeBits 1
 
-STATICASSERT(SdTypeBits+SdAddressModeBits<=8);
+STATICASSERT(SdTypeBits+SdAddressModeBits+1<=8);
 typedef struct {
 	uint32_t blockCount; // Card size is blockCount*SdBlockSize, allowing up to 2TB. However we only support 4gb due to 32 bit addressing (see hwDeviceSdCardReaderMount).
 	uint8_t type:SdTypeBits;
 	uint8_t addressMode:SdAddressModeBits;
-	uint8_t reserved:(8-SdTypeBits-SdAddressModeBits);
+	uint8_t readPending:1; // set between sdReadBlockStart and sdReadBlockFinish, during which the SPI bus lock is held
+	uint8_t reserved:(8-SdTypeBits-SdAddressModeBits-1);
 	uint8_t powerPin;
 	uint8_t slaveSelectPin;
+	SpiTransfer readTransfer; // data phase of a pending read
 } SdCard;
 
 SdInitResult sdInit(SdCard *card, uint8_t powerPin, uint8_t slaveSelectPin);
 void sdQuit(SdCard *card);
 
 bool sdReadBlock(SdCard *card, uint32_t block, uint8_t *data); // SdBlockSize bytes stored into data. Note that on failure the passed data array may have been clobbered and cannot be trusted.
+
+// Asynchronous version of sdReadBlock: the command is sent immediately but the data bytes are transferred in the background (via SPI interrupts).
+// data must remain valid until sdReadBlockFinish has been called, which must always follow a successful start (it waits if the transfer is not yet complete).
+bool sdReadBlockStart(SdCard *card, uint32_t block, uint8_t *data);
+bool sdReadBlockIsComplete(const SdCard *card); // true if no read is pending or the pending read's data has arrived (so sdReadBlockFinish will not block)
+void sdReadBlockFinish(SdCard *card);
+
 bool sdWriteBlock(SdCard *card, uint32_t block, const uint8_t *data);
 
 #endif
@@ -0,0 +1,64 @@
+#ifndef ARDUINO
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "kernelfs.h"
+#include "snapshot.h"
+
+bool snapshotWrite(FILE *file, const void *data, size_t len) {
+	assert(file!=NULL);
+	assert(data!=NULL || len==0);
+
+	return (fwrite(data, 1, len, file)==len);
+}
+
+bool snapshotRead(FILE *file, void *data, size_t len) {
+	assert(file!=NULL);
+	assert(data!=NULL || len==0);
+
+	return (fread(data, 1, len, file)==len);
+}
+
+bool snapshotWriteKStr(FILE *file, KStr str) {
+	assert(file!=NULL);
+
+	// Write length (with UINT16_MAX indicating a null string), followed by the string itself (without null terminator)
+	if (kstrIsNull(str)) {
+		uint16_t len=UINT16_MAX;
+		return snapshotWrite(file, &len, sizeof(len));
+	}
+
+	char buffer[KernelFsPathMax];
+	uint16_t len=kstrStrlen(str);
+	if (len>=KernelFsPathMax)
+		return false;
+	kstrStrcpy(buffer, str);
+
+	return snapshotWrite(file, &len, sizeof(len)) && snapshotWrite(file, buffer, len);
+}
+
+bool snapshotReadKStr(FILE *file, KStr *str) {
+	assert(file!=NULL);
+	assert(str!=NULL);
+
+	*str=kstrNull();
+
+	uint16_t len;
+	if (!snapshotRead(file, &len, sizeof(len)))
+		return false;
+	if (len==UINT16_MAX)
+		return true;
+	if (len>=KernelFsPathMax)
+		return false;
+
+	char buffer[KernelFsPathMax];
+	if (!snapshotRead(file, buffer, len))
+		return false;
+	buffer[len]='\0';
+
+	*str=kstrC(buffer);
+	return !kstrIsNull(*str);
+}
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef ARDUINO
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "kstr.h"
+
+// Helpers for saving kernel state to a file and restoring it later (see --snapshot-out and --snapshot-in kernel options).
+// Each module with state worth keeping has a pair of fooSnapshotSave/fooSnapshotLoad functions, called in turn by the kernel, which write and read their fields in a fixed order.
+// Pointers are never written as their values differ between runs - strings are written by value, and other pointers are either rebuilt or translated by the module concerned.
+// Snapshots are only expected to be loaded by the same kernel binary which saved them (see kernelSnapshotLoad).
+
+bool snapshotWrite(FILE *file, const void *data, size_t len);
+bool snapshotRead(FILE *file, void *data, size_t len);
+
+bool snapshotWriteKStr(FILE *file, KStr str); // null strings are preserved, but spare bits are not
+bool snapshotReadKStr(FILE *file, KStr *str); // allocates a new heap string, or sets str to null if a null string was written
+
+#endif
+#endif
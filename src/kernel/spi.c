@@ -1,5 +1,58 @@
+#include <assert.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#endif
+
 #include "spi.h"
 
+// Circular queue of asynchronous transfers, the one at the head is in progress
+SpiTransfer *volatile spiTransferQueueData[SpiTransferQueueMax];
+volatile uint8_t spiTransferQueueHead=0;
+volatile uint8_t spiTransferQueueCount=0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef ARDUINO
+void spiTransferBegin(void); // starts the transfer at the head of the queue, should be called with interrupts disabled
+uint8_t spiTransferGetTxByte(const SpiTransfer *transfer);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Public functions
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef ARDUINO
+ISR(SPI_STC_vect) {
+	SpiTransfer *transfer=spiTransferQueueData[spiTransferQueueHead];
+
+	// Store received byte
+	uint8_t value=SPDR;
+	if (transfer->rxData!=NULL)
+		transfer->rxData[transfer->pos]=value;
+	++transfer->pos;
+
+	// More bytes in this transfer?
+	if (transfer->pos<transfer->len) {
+		SPDR=spiTransferGetTxByte(transfer);
+		return;
+	}
+
+	// Transfer complete - remove from queue and start the next one (if any)
+	transfer->state=SpiTransferStateComplete;
+	spiTransferQueueHead=(spiTransferQueueHead+1)%SpiTransferQueueMax;
+	--spiTransferQueueCount;
+	if (spiTransferQueueCount>0)
+		spiTransferBegin();
+	else
+		SPCR&=~(1u<<SPIE); // disable interrupt so that blocking functions can poll SPIF
+}
+#endif
+
 bool spiInit(SpiClockSpeed clockSpeed) {
 	// Reserve the four SPI pins so they are not otherwise used
 	if (!pinGrab(SpiPinMiso) || !pinGrab(SpiPinMosi) || !pinGrab(SpiPinSck) || !pinGrab(SpiPinSlaveSelect))
@@ -45,7 +98,76 @@ bool spiInit(SpiClockSpeed clockSpeed) {
 	return true;
 }
 
+void spiTransferInit(SpiTransfer *transfer, const uint8_t *txData, uint8_t *rxData, uint16_t len, uint8_t fillByte) {
+	assert(transfer!=NULL);
+
+	transfer->txData=txData;
+	transfer->rxData=rxData;
+	transfer->len=len;
+	transfer->fillByte=fillByte;
+	transfer->state=SpiTransferStateIdle;
+	transfer->pos=0;
+}
+
+bool spiTransferQueue(SpiTransfer *transfer) {
+	assert(transfer!=NULL);
+	assert(transfer->state!=SpiTransferStateQueued && transfer->state!=SpiTransferStateInProgress);
+
+	transfer->pos=0;
+
+	// Nothing to do?
+	if (transfer->len==0) {
+		transfer->state=SpiTransferStateComplete;
+		return true;
+	}
+
+#ifdef ARDUINO
+	bool result=false;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		if (spiTransferQueueCount<SpiTransferQueueMax) {
+			spiTransferQueueData[(spiTransferQueueHead+spiTransferQueueCount)%SpiTransferQueueMax]=transfer;
+			transfer->state=SpiTransferStateQueued;
+			if (++spiTransferQueueCount==1)
+				spiTransferBegin();
+			result=true;
+		}
+	}
+	return result;
+#else
+	// No hardware to wait for - complete immediately (reading zeros, as spiTransmitByte does)
+	if (transfer->rxData!=NULL)
+		memset(transfer->rxData, 0, transfer->len);
+	transfer->pos=transfer->len;
+	transfer->state=SpiTransferStateComplete;
+	return true;
+#endif
+}
+
+bool spiTransferIsComplete(const SpiTransfer *transfer) {
+	assert(transfer!=NULL);
+	return (transfer->state==SpiTransferStateComplete);
+}
+
+void spiTransferWait(const SpiTransfer *transfer) {
+	assert(transfer!=NULL);
+	assert(transfer->state!=SpiTransferStateIdle);
+
+	while(!spiTransferIsComplete(transfer))
+		;
+}
+
+bool spiIsBusy(void) {
+	return (spiTransferQueueCount>0);
+}
+
+void spiWaitIdle(void) {
+	while(spiIsBusy())
+		;
+}
+
 uint8_t spiTransmitByte(uint8_t value) {
+	spiWaitIdle();
+
 #ifdef ARDUINO
 	SPDR=value;
 	while(!(SPSR&(1<<SPIF)))
@@ -75,3 +197,23 @@ void spiWriteBlock(const uint8_t *data, size_t len) {
 	for(size_t i=0; i<len; ++i)
 		spiWriteByte(data[i]);
 }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private functions
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef ARDUINO
+void spiTransferBegin(void) {
+	assert(spiTransferQueueCount>0);
+
+	SpiTransfer *transfer=spiTransferQueueData[spiTransferQueueHead];
+	transfer->state=SpiTransferStateInProgress;
+
+	SPCR|=(1u<<SPIE);
+	SPDR=spiTransferGetTxByte(transfer);
+}
+
+uint8_t spiTransferGetTxByte(const SpiTransfer *transfer) {
+	return (transfer->txData!=NULL ? transfer->txData[transfer->pos] : transfer->fillByte);
+}
+#endif
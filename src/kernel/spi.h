@@ -16,6 +16,25 @@
 #define SpiPinSck PinD52
 #define SpiPinSlaveSelect PinD53
 
+// Asynchronous transfers are queued and driven by the SPI transfer complete interrupt (on PC they complete immediately).
+#define SpiTransferQueueMax 4
+
+typedef enum {
+	SpiTransferStateIdle,
+	SpiTransferStateQueued,
+	SpiTransferStateInProgress,
+	SpiTransferStateComplete,
+} SpiTransferState;
+
+typedef struct {
+	const uint8_t *txData; // if NULL then fillByte is sent for each byte instead
+	uint8_t *rxData; // if NULL then received bytes are discarded
+	uint16_t len;
+	uint8_t fillByte;
+	volatile uint8_t state; // see SpiTransferState
+	volatile uint16_t pos; // number of bytes transferred so far
+} SpiTransfer;
+
 typedef enum {
 	SpiClockSpeedDiv4,
 	SpiClockSpeedDiv16,
@@ -26,6 +45,15 @@ typedef enum {
 bool spiInit(SpiClockSpeed clockSpeed);
 
 // Note: the following functions should only be used directly from kernel space if the SPI bus is 'locked' first - see kernelSpiGrabLock.
+// The blocking functions first wait for any queued asynchronous transfers to complete.
+
+void spiTransferInit(SpiTransfer *transfer, const uint8_t *txData, uint8_t *rxData, uint16_t len, uint8_t fillByte);
+bool spiTransferQueue(SpiTransfer *transfer); // returns false if the queue is full. transfer must remain valid until complete.
+bool spiTransferIsComplete(const SpiTransfer *transfer);
+void spiTransferWait(const SpiTransfer *transfer); // blocks until given transfer is complete
+
+bool spiIsBusy(void); // true if any asynchronous transfers are queued or in progress
+void spiWaitIdle(void);
 
 uint8_t spiTransmitByte(uint8_t value);
 
@@ -20,6 +20,7 @@
 #include "log.h"
 #include "pins.h"
 #include "procman.h"
+#include "snapshot.h"
 #include "tty.h"
 
 #ifdef ARDUINO
@@ -38,10 +39,21 @@ volatile uint8_t ttyCircBufActivityCount;
 
 #ifndef ARDUINO
 static struct termios ttyOldConfig;
+
+// PC only: set when a reader finds nothing to read, and cleared when new input arrives (see ttyIsWaitingForInput)
+bool ttyReaderWaiting=false;
+
+// PC only: input can be read from a script file instead of stdin, a line at a time whenever a reader finds nothing to read (see ttyScriptTick)
+FILE *ttyScriptFile=NULL;
+bool ttyScriptDone=false;
+uint16_t ttyScriptLinesFed=0;
+char ttyScriptLastLine[ttyCircBufSize];
 #endif
 
 #ifndef ARDUINO
 void ttySigIntHandler(int sig);
+
+void ttyScriptTick(void);
 #endif
 
 bool ttyHandleByte(uint8_t value);
@@ -85,8 +97,11 @@ bool ttyInit(void) {
     signal(SIGINT, ttySigIntHandler);
 #endif
 
-	// PC only: put terminal 'raw' mode so we can handle things such as ctrl+d ourselves
+	// PC only: put terminal 'raw' mode so we can handle things such as ctrl+d ourselves (unless reading from a script instead)
 #ifndef ARDUINO
+	if (ttyScriptFile!=NULL)
+		return true;
+
 	static struct termios newConfig;
 	tcgetattr(STDIN_FILENO, &ttyOldConfig);
 
@@ -100,35 +115,46 @@ bool ttyInit(void) {
 }
 
 void ttyQuit(void) {
-	// Non-arduino-only: reset terminal settings
+	// Non-arduino-only: reset terminal settings (or close script)
 #ifndef ARDUINO
-	tcsetattr(STDIN_FILENO, TCSANOW, &ttyOldConfig);
+	if (ttyScriptFile!=NULL) {
+		fclose(ttyScriptFile);
+		ttyScriptFile=NULL;
+	} else
+		tcsetattr(STDIN_FILENO, TCSANOW, &ttyOldConfig);
 #endif
 }
 
 void ttyTick(void) {
 	// PC only: check if any data has arrived
 #ifndef ARDUINO
-	// Poll for input events on stdin
-	struct pollfd pollFds[0];
-	memset(pollFds, 0, sizeof(pollFds));
-	pollFds[0].fd=STDIN_FILENO;
-	pollFds[0].events=POLLIN;
-	if (poll(pollFds, 1, 0)>0 && (pollFds[0].revents & POLLIN)) {
-		// Call ioctl to find number of bytes available
-		int available;
-		ioctl(STDIN_FILENO, FIONREAD, &available);
-
-		// Read as many bytes as we can
-		while(available>0) {
-			int value=getchar();
-			if (value==EOF)
-				break;
-
-			if (!ttyHandleByte(value))
-				break;
-
-			--available;
+	// Reading from a script rather than stdin?
+	if (ttyScriptFile!=NULL)
+		ttyScriptTick();
+	else {
+		// Poll for input events on stdin
+		struct pollfd pollFds[1];
+		memset(pollFds, 0, sizeof(pollFds));
+		pollFds[0].fd=STDIN_FILENO;
+		pollFds[0].events=POLLIN;
+		if (poll(pollFds, 1, 0)>0 && (pollFds[0].revents & POLLIN)) {
+			// Call ioctl to find number of bytes available
+			int available;
+			ioctl(STDIN_FILENO, FIONREAD, &available);
+
+			// Read as many bytes as we can
+			if (available>0)
+				ttyReaderWaiting=false;
+			while(available>0) {
+				int value=getchar();
+				if (value==EOF)
+					break;
+
+				if (!ttyHandleByte(value))
+					break;
+
+				--available;
+			}
 		}
 	}
 #endif
@@ -187,11 +213,20 @@ int16_t ttyReadFunctor(void) {
 }
 
 bool ttyCanReadFunctor(void) {
+	bool canRead;
 	if (ttyCircBufActivityCount>0)
-		return true;
-	if (ttyGetBlocking())
-		return false;
-	return !circBufIsEmpty(&ttyCircBuf);
+		canRead=true;
+	else if (ttyGetBlocking())
+		canRead=false;
+	else
+		canRead=!circBufIsEmpty(&ttyCircBuf);
+
+#ifndef ARDUINO
+	if (!canRead)
+		ttyReaderWaiting=true;
+#endif
+
+	return canRead;
 }
 
 KernelFsFileOffset ttyWriteFunctor(const uint8_t *data, KernelFsFileOffset len) {
@@ -234,10 +269,127 @@ void ttySetEcho(bool echo) {
 		ttyFlags&=~TtyFlagEcho;
 }
 
+#ifndef ARDUINO
+bool ttySetScriptPath(const char *path) {
+	assert(path!=NULL);
+
+	FILE *file=fopen(path, "r");
+	if (file==NULL)
+		return false;
+
+	if (ttyScriptFile!=NULL)
+		fclose(ttyScriptFile);
+	ttyScriptFile=file;
+	ttyReaderWaiting=false;
+	ttyScriptDone=false;
+	ttyScriptLinesFed=0;
+	ttyScriptLastLine[0]='\0';
+
+	return true;
+}
+
+bool ttyScriptIsDone(void) {
+	return ttyScriptDone;
+}
+
+uint16_t ttyScriptGetLinesFed(void) {
+	return ttyScriptLinesFed;
+}
+
+const char *ttyScriptGetLastLine(void) {
+	return ttyScriptLastLine;
+}
+
+bool ttyIsWaitingForInput(void) {
+	// Has a reader found nothing to read since input last arrived, with nothing buffered since?
+	if (!ttyReaderWaiting || ttyCircBufActivityCount>0 || !circBufIsEmpty(&ttyCircBuf))
+		return false;
+
+	// If reading from a script, check there are no more lines to feed in (peeking at the next character)
+	if (ttyScriptFile!=NULL) {
+		if (ttyScriptDone)
+			return false;
+		int c=fgetc(ttyScriptFile);
+		if (c!=EOF) {
+			ungetc(c, ttyScriptFile);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool ttySnapshotSave(FILE *file) {
+	assert(file!=NULL);
+
+	// Save echo/blocking flags and any buffered input (pending ctrl+c is not kept)
+	uint8_t flags=(ttyFlags & (TtyFlagEcho|TtyFlagBlocking));
+	uint8_t head=ttyCircBuf.head, tail=ttyCircBuf.tail, activityCount=ttyCircBufActivityCount;
+	return snapshotWrite(file, &flags, sizeof(flags)) &&
+	       snapshotWrite(file, &head, sizeof(head)) &&
+	       snapshotWrite(file, &tail, sizeof(tail)) &&
+	       snapshotWrite(file, &activityCount, sizeof(activityCount)) &&
+	       snapshotWrite(file, (const uint8_t *)ttyCircBufBuffer, ttyCircBufSize);
+}
+
+bool ttySnapshotLoad(FILE *file) {
+	assert(file!=NULL);
+
+	uint8_t flags, head, tail, activityCount;
+	uint8_t buffer[ttyCircBufSize];
+	if (!snapshotRead(file, &flags, sizeof(flags)) ||
+	    !snapshotRead(file, &head, sizeof(head)) ||
+	    !snapshotRead(file, &tail, sizeof(tail)) ||
+	    !snapshotRead(file, &activityCount, sizeof(activityCount)) ||
+	    !snapshotRead(file, buffer, ttyCircBufSize))
+		return false;
+	if (head>=ttyCircBufSize || tail>=ttyCircBufSize)
+		return false;
+
+	ttyFlags=flags;
+	memcpy((uint8_t *)ttyCircBufBuffer, buffer, ttyCircBufSize);
+	ttyCircBuf.head=head;
+	ttyCircBuf.tail=tail;
+	ttyCircBufActivityCount=activityCount;
+
+	return true;
+}
+#endif
+
 #ifndef ARDUINO
 void ttySigIntHandler(int sig) {
 	ttyFlags|=TtyFlagBreak;
 }
+
+void ttyScriptTick(void) {
+	// Only feed the next line once the previous one has been consumed and a reader has since found nothing to read.
+	// This way each command runs to completion (and the shell prints its prompt) before the next is 'typed'.
+	if (ttyScriptDone || !ttyReaderWaiting || ttyCircBufActivityCount>0)
+		return;
+	ttyReaderWaiting=false;
+
+	if (fgets(ttyScriptLastLine, sizeof(ttyScriptLastLine), ttyScriptFile)==NULL) {
+		// End of script - send ctrl+d so that the shell sees EOF and exits
+		ttyScriptDone=true;
+		ttyScriptLastLine[0]='\0';
+		ttyHandleByte(4);
+	} else {
+		// Strip newline, or if the line was too long to fit in the buffer, skip the rest of it
+		size_t len=strcspn(ttyScriptLastLine, "\n");
+		if (ttyScriptLastLine[len]!='\n') {
+			int c;
+			while((c=fgetc(ttyScriptFile))!=EOF && c!='\n')
+				;
+		}
+		ttyScriptLastLine[len]='\0';
+
+		// Feed line into buffer as if typed
+		for(size_t i=0; i<len; ++i)
+			ttyHandleByte(ttyScriptLastLine[i]);
+		ttyHandleByte('\n');
+	}
+	++ttyScriptLinesFed;
+}
 #endif
 
 bool ttyHandleByte(uint8_t value) {
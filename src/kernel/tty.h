@@ -3,6 +3,9 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#ifndef ARDUINO
+#include <stdio.h>
+#endif
 
 #define TtyPinTX0 PinD0
 #define TtyPinRX0 PinD1
@@ -23,5 +26,17 @@ bool ttyGetEcho(void); // If true (which is the default) then echos (writes) any
 void ttySetBlocking(bool blocking);
 void ttySetEcho(bool echo);
 
+#ifndef ARDUINO
+bool ttySetScriptPath(const char *path); // PC only: read input from the given file rather than stdin (call before ttyInit). Each line is fed in once a reader finds nothing left to read, followed by a ctrl+d (EOF) at the end.
+bool ttyScriptIsDone(void); // true once the whole script (including the final ctrl+d) has been fed in
+uint16_t ttyScriptGetLinesFed(void); // includes the final ctrl+d
+const char *ttyScriptGetLastLine(void); // most recently fed line (without newline), empty once done
+
+bool ttyIsWaitingForInput(void); // PC only: true if a reader has found nothing to read since input last arrived, and (if reading from a script) there are no more lines to feed in
+
+bool ttySnapshotSave(FILE *file); // PC only: see snapshot.h
+bool ttySnapshotLoad(FILE *file);
+#endif
+
 
 #endif
\ No newline at end of file
@@ -18,6 +18,9 @@
 #ifndef MIN
 #define MIN(a,b) ((a)<(b) ? (a) : (b))
 #endif
+#ifndef MAX
+#define MAX(a,b) ((a)>(b) ? (a) : (b))
+#endif
 
 #ifndef PRIu64
 #ifdef ARDUINO
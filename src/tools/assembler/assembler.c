@@ -1,11 +1,14 @@
 #include <assert.h>
 #include <ctype.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
+#include <sys/stat.h>
 
 #include "bytecode.h"
 #include "util.h"
@@ -19,6 +22,8 @@ typedef struct {
 	unsigned skipBit;
 	unsigned incDecValue;
 	BytecodeInstructionAluExtraType extraType;
+	BytecodeInstructionAluInt32Type int32Type;
+	BytecodeInstructionAluMemoryType memoryType;
 } AssemblerInstructionAluData;
 
 const AssemblerInstructionAluData assemblerInstructionAluData[]={
@@ -183,8 +188,24 @@ const AssemblerInstructionAluData assemblerInstructionAluData[]={
 	{.type=BytecodeInstructionAluTypeExtra, .str="load16", .ops=1, .extraType=BytecodeInstructionAluExtraTypeLoad16},
 	{.type=BytecodeInstructionAluTypeExtra, .str="push16", .ops=0, .extraType=BytecodeInstructionAluExtraTypePush16},
 	{.type=BytecodeInstructionAluTypeExtra, .str="pop16", .ops=0, .extraType=BytecodeInstructionAluExtraTypePop16},
+	{.type=BytecodeInstructionAluTypeInt32, .str="add32w", .ops=1, .int32Type=BytecodeInstructionAluInt32TypeAdd16},
+	{.type=BytecodeInstructionAluTypeInt32, .str="add32", .ops=1, .int32Type=BytecodeInstructionAluInt32TypeAdd32},
+	{.type=BytecodeInstructionAluTypeInt32, .str="sub32w", .ops=1, .int32Type=BytecodeInstructionAluInt32TypeSub16},
+	{.type=BytecodeInstructionAluTypeInt32, .str="sub32", .ops=1, .int32Type=BytecodeInstructionAluInt32TypeSub32},
+	{.type=BytecodeInstructionAluTypeInt32, .str="mul32w", .ops=1, .int32Type=BytecodeInstructionAluInt32TypeMul16},
+	{.type=BytecodeInstructionAluTypeInt32, .str="mul32", .ops=1, .int32Type=BytecodeInstructionAluInt32TypeMul32},
+	{.type=BytecodeInstructionAluTypeInt32, .str="shift32", .ops=1, .int32Type=BytecodeInstructionAluInt32TypeShift},
+	{.type=BytecodeInstructionAluTypeInt32, .str="cmp32", .ops=1, .int32Type=BytecodeInstructionAluInt32TypeCmp},
+	{.type=BytecodeInstructionAluTypeMemory, .str="load8d", .ops=2, .memoryType=BytecodeInstructionAluMemoryTypeLoad8Disp},
+	{.type=BytecodeInstructionAluTypeMemory, .str="store8d", .ops=2, .memoryType=BytecodeInstructionAluMemoryTypeStore8Disp},
+	{.type=BytecodeInstructionAluTypeMemory, .str="load16d", .ops=2, .memoryType=BytecodeInstructionAluMemoryTypeLoad16Disp},
+	{.type=BytecodeInstructionAluTypeMemory, .str="store16d", .ops=2, .memoryType=BytecodeInstructionAluMemoryTypeStore16Disp},
+	{.type=BytecodeInstructionAluTypeMemory, .str="copyblock", .ops=2, .memoryType=BytecodeInstructionAluMemoryTypeCopyBlock},
+	{.type=BytecodeInstructionAluTypeMemory, .str="fillblock", .ops=2, .memoryType=BytecodeInstructionAluMemoryTypeFillBlock},
 };
 
+char assemblerRegisterNames[BytecodeRegisterNB][3]={"r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7"}; // used when the optimiser needs to rewrite operands
+
 typedef enum {
 	AssemblerInstructionTypeAllocation,
 	AssemblerInstructionTypeDefine,
@@ -222,6 +243,7 @@ typedef struct {
 	uint8_t data[1024]; // TODO: this is pretty wasteful...
 
 	uint16_t pointerLineIndex; // pointer to instruction actually containing data. set to self initially and if not pointing into another define's data
+	uint16_t pointerInstructionIndex; // instruction index of the above, only valid if pointerLineIndex is not our own line
 	uint16_t pointerOffset; // how far into pointed-to-data is our data?
 } AssemblerInstructionDefine;
 
@@ -242,6 +264,9 @@ typedef struct {
 	uint8_t skipBit;
 	uint8_t incDecValue;
 	uint8_t extraType;
+	uint8_t int32Type;
+	uint8_t memoryType;
+	int8_t displacement; // for memory type load/store instructions (in which case opB is NULL)
 } AssemblerInstructionAlu;
 
 typedef struct {
@@ -316,6 +341,28 @@ typedef struct {
 	char *modified;
 } AssemblerLine;
 
+typedef enum {
+	AssemblerSymbolTypeAllocation,
+	AssemblerSymbolTypeDefine,
+	AssemblerSymbolTypeLabel,
+	AssemblerSymbolTypeConst,
+} AssemblerSymbolType;
+
+typedef struct {
+	const char *symbol; // points into owning instruction's modifiedLineCopy
+	AssemblerSymbolType type;
+	uint16_t instructionIndex;
+	int value; // ram/progmem address for allocations, defines and labels (updated whenever offsets are recomputed), or 16 bit value for constants
+} AssemblerSymbol;
+
+typedef struct {
+	int value; // -1 if unknown, otherwise 16 bit value
+	const char *symbol; // if non-NULL then register holds the address of this symbol (which is not known until offsets are computed)
+} AssemblerRegisterState;
+
+#define AssemblerSymbolTableSize (2*AssemblerLinesMax) // must be a power of two, kept at least twice symbolsNext so probe sequences stay short
+#define AssemblerSymbolTableEmpty 0xFFFFFFFFu
+
 // TODO: avoid hardcoded limits
 #define AssemblerIncludeDirMax 32
 #define AssemblerIncludeDirLenMax 1024
@@ -327,6 +374,13 @@ typedef struct {
 	AssemblerInstruction instructions[AssemblerLinesMax];
 	size_t instructionsNext;
 
+	AssemblerSymbol symbols[AssemblerLinesMax];
+	size_t symbolsNext;
+	uint32_t symbolTable[AssemblerSymbolTableSize]; // open addressing hash table of indexes into symbols array (or AssemblerSymbolTableEmpty)
+
+	size_t passInstructionIndex; // instruction currently being generated in a machine code pass
+	uint16_t passSavedBytes; // bytes saved so far in the current pass, progmem symbols defined after passInstructionIndex are adjusted down by this
+
 	uint16_t stackRamOffset;
 
 	char includedPaths[256][1024]; // TODO: Avoid hardcoded limits (or at least check them...)
@@ -338,6 +392,56 @@ typedef struct {
 	size_t assemblerIncludeDirsNext;
 } AssemblerProgram;
 
+typedef struct {
+	char *path;
+	AssemblerLine *lines; // already preprocessed, file fields point to path above
+	size_t linesNext;
+} AssemblerIncludeCacheEntry;
+
+typedef struct {
+	AssemblerIncludeCacheEntry **entries;
+	size_t entriesNext;
+
+	const char *dir; // optional directory to store preprocessed files in between runs (NULL if unused)
+
+	pthread_mutex_t mutex;
+} AssemblerIncludeCache;
+
+AssemblerIncludeCache assemblerIncludeCache={.entries=NULL, .entriesNext=0, .dir=NULL, .mutex=PTHREAD_MUTEX_INITIALIZER};
+
+typedef struct {
+	const char *inputPath, *outputPath;
+	bool result;
+} AssemblerJob;
+
+typedef struct {
+	bool verbose;
+	bool optimise;
+	bool writeMap; // write symbol/line map alongside each output file (with '.map' appended to path)
+
+	char **layoutFunctions; // functions to move together to the end of the code (hottest first), as read from layout file given by --layout
+	size_t layoutFunctionsNext;
+
+	const char *includeDirs[AssemblerIncludeDirMax];
+	size_t includeDirsNext;
+
+	AssemblerJob *jobs;
+	size_t jobsNext, jobsCount;
+	pthread_mutex_t jobsMutex;
+} AssemblerOptions;
+
+bool assemblerAssembleFile(const AssemblerOptions *options, const char *inputPath, const char *outputPath); // returns false on failure
+bool assemblerOptionsReadLayout(AssemblerOptions *options, const char *path); // returns false on failure
+void *assemblerWorkerThread(void *userData); // takes AssemblerOptions pointer and assembles jobs until none left
+
+const AssemblerIncludeCacheEntry *assemblerIncludeCacheGet(const char *path); // reads and preprocesses file if not already cached, returns NULL on failure. thread safe.
+bool assemblerIncludeCacheReadFile(AssemblerIncludeCacheEntry *entry);
+bool assemblerIncludeCacheReadDisk(AssemblerIncludeCacheEntry *entry, const char *cachePath, const struct stat *fileStat);
+void assemblerIncludeCacheWriteDisk(const AssemblerIncludeCacheEntry *entry, const char *cachePath, const struct stat *fileStat);
+void assemblerIncludeCacheFree(void);
+AssemblerIncludeCacheEntry *assemblerIncludeCacheFind(const char *path); // returns NULL if not cached, lock must be held
+void assemblerIncludeCacheEntryFree(AssemblerIncludeCacheEntry *entry);
+
 AssemblerProgram *assemblerProgramNew(void);
 void assemblerProgramFree(AssemblerProgram *program);
 
@@ -345,23 +449,48 @@ void assemblerInsertLine(AssemblerProgram *program, AssemblerLine *line, int off
 bool assemblerInsertLinesFromFile(AssemblerProgram *program, const char *path, int offset);
 void assemblerRemoveLine(AssemblerProgram *program, int offset);
 
-bool assemblerProgramPreprocess(AssemblerProgram *program); // strips comments, whitespace etc. returns true if any changes made
+bool assemblerLinePreprocess(AssemblerLine *assemblerLine); // strips comments, whitespace etc. returns true if any changes made
 bool assemblerProgramLocateInclude(const AssemblerProgram *program, char *destPath, const char *callerPath, const char *srcPath);
-bool assemblerProgramHandleNextInclude(AssemblerProgram *program, bool *change); // returns false on failure
-bool assemblerProgramHandleNextOption(AssemblerProgram *program, bool *change); // returns false on failure
+bool assemblerProgramHandleIncludes(AssemblerProgram *program); // returns false on failure
+void assemblerProgramHandleOptions(AssemblerProgram *program);
 
 bool assemblerProgramParseLines(AssemblerProgram *program); // converts lines to initial instructions, returns false on error
 
+bool assemblerProgramApplyLayout(AssemblerProgram *program, char *const *functions, size_t functionsCount); // moves the given functions (where possible) to be contiguous at the end of the code, in the order given. returns false on failure
+bool assemblerProgramInstructionIsFunction(const AssemblerProgram *program, unsigned instructionIndex); // returns true if instruction is a label which is the target of some call instruction
+
+unsigned assemblerProgramOptimise(AssemblerProgram *program); // single peephole pass over parsed instructions (removing redundant/dead sets, push/pop pairs etc), returns number of changes made
+bool assemblerProgramRegisterIsDead(const AssemblerProgram *program, const bool *removed, unsigned startIndex, BytecodeRegister reg); // returns true if reg is overwritten before being read when executing from startIndex (false if unsure)
+void assemblerProgramUpdateRegisterStates(const AssemblerProgram *program, const AssemblerInstruction *instruction, bool conditional, AssemblerRegisterState *regs); // update regs to reflect executing given instruction
+bool assemblerProgramGetMovSrcValue(const AssemblerProgram *program, const char *src, BytecodeWord *value); // returns true if src is an integer, character or const symbol (i.e. value is known before offsets are computed)
+
+void assemblerInstructionGetRegisterUsage(const AssemblerInstruction *instruction, uint8_t *readMask, uint8_t *writeMask); // bitmasks of registers which may be read/written. labels, calls etc are treated as reading and writing everything.
+bool assemblerInstructionIsSkip(const AssemblerInstruction *instruction);
+bool assemblerInstructionIsAluExtra(const AssemblerInstruction *instruction, BytecodeInstructionAluExtraType extraType);
+void assemblerInstructionSetMov(AssemblerInstruction *instruction, BytecodeRegister destReg, BytecodeRegister srcReg);
+void assemblerInstructionSetIncDec(AssemblerInstruction *instruction, BytecodeRegister destReg, int delta); // delta must be non-zero and in range [-64,64]
+void assemblerInstructionSetAluMemoryDisp(AssemblerInstruction *instruction, BytecodeInstructionAluMemoryType type, BytecodeRegister destReg, BytecodeRegister opAReg, int displacement); // displacement must be in range [-128,127]
+
+void assemblerRegisterStatesReset(AssemblerRegisterState *regs);
+bool assemblerRegisterStateEqual(const AssemblerRegisterState *a, const AssemblerRegisterState *b); // returns false if either is unknown
+
 bool assemblerProgramShiftDefines(AssemblerProgram *program); // moves defines to the end to avoid getting in the way of code, returns true if any changes made
 bool assemblerProgramShrinkDefines(AssemblerProgram *program); // checks if some defines are subsets of others, returns true if any changes made
 
 bool assemblerProgramCalculateInitialMachineCodeLengths(AssemblerProgram *program); // returns false on failure
-void assemblerProgramCalculateMachineCodeOffsets(AssemblerProgram *program);
-bool assemblerProgramGenerateMachineCode(AssemblerProgram *program, bool *changeFlag); // returns false on failure. if a size reduction is found, the relevant machineCodeLen field is updated and we return immedaitely (without computing the machine code for any remaining instructions)
+void assemblerProgramCalculateMachineCodeOffsets(AssemblerProgram *program); // also updates addresses in symbol table
+bool assemblerProgramGenerateMachineCode(AssemblerProgram *program, bool *changeFlag); // returns false on failure. offsets are updated as we go, and if any size reductions are found the relevant machineCodeLen fields are updated and changeFlag is set (machine code is only valid once a pass makes no changes)
 
 void assemblerProgramDebugInstructions(const AssemblerProgram *program);
 
 bool assemblerProgramWriteMachineCode(const AssemblerProgram *program, const char *path); // returns false on failure
+bool assemblerProgramWriteMap(const AssemblerProgram *program, const char *path); // writes text file mapping addresses to functions/labels and source lines (see aosf-profile), returns false on failure
+
+uint32_t assemblerSymbolHash(const char *symbol);
+bool assemblerProgramAddSymbol(AssemblerProgram *program, AssemblerSymbolType type, const char *symbol, uint16_t instructionIndex, int value); // returns false if symbol already exists
+const AssemblerSymbol *assemblerProgramGetSymbol(const AssemblerProgram *program, const char *symbol); // returns NULL if not found
+void assemblerProgramUpdateSymbolInstructionIndexes(AssemblerProgram *program); // call after reordering instructions
+void assemblerProgramUpdateSymbolValues(AssemblerProgram *program); // call after computing offsets
 
 int assemblerGetAllocationSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol); // Returns -1 if symbol not found
 int assemblerGetAllocationSymbolAddr(const AssemblerProgram *program, const char *symbol); // Returns -1 if symbol not found, otherwise result points into RAM memory
@@ -376,10 +505,138 @@ int assemblerGetConstSymbolInstructionIndex(const AssemblerProgram *program, con
 int assemblerGetConstSymbolValue(const AssemblerProgram *program, const char *symbol); // Returns -1 if symbol not found, otherwise contains 16 bit value
 
 BytecodeRegister assemblerRegisterFromStr(const char *str); // Returns BytecodeRegisterNB on failure
+bool assemblerInstructionAluMemoryTypeIsDisp(BytecodeInstructionAluMemoryType type); // true for load/store with displacement (as opposed to block instructions)
 
 bool assemblerProgramAddIncludeDir(AssemblerProgram *program, const char *dir);
 
 int main(int argc, char **argv) {
+	int result=EXIT_FAILURE;
+
+	// Parse arguments
+	AssemblerOptions options;
+	options.verbose=false;
+	options.optimise=false;
+	options.writeMap=false;
+	options.layoutFunctions=NULL;
+	options.layoutFunctionsNext=0;
+	options.includeDirsNext=0;
+	options.jobs=NULL;
+	options.jobsNext=0;
+	options.jobsCount=0;
+	pthread_mutex_init(&options.jobsMutex, NULL);
+
+	long threadCount=sysconf(_SC_NPROCESSORS_ONLN);
+
+	int argi;
+	for(argi=1; argi<argc && argv[argi][0]=='-'; ++argi) {
+		if (strcmp(argv[argi], "--verbose")==0)
+			options.verbose=true;
+		else if (strcmp(argv[argi], "-O")==0)
+			options.optimise=true;
+		else if (strcmp(argv[argi], "--map")==0)
+			options.writeMap=true;
+		else if (strncmp(argv[argi], "--layout=", strlen("--layout="))==0) {
+			if (!assemblerOptionsReadLayout(&options, argv[argi]+strlen("--layout=")))
+				goto done;
+		}
+		else if (strncmp(argv[argi], "-I", 2)==0) {
+			if (options.includeDirsNext<AssemblerIncludeDirMax)
+				options.includeDirs[options.includeDirsNext++]=argv[argi]+2;
+			else
+				printf("warning: too many include dirs, ignoring '%s'\n", argv[argi]);
+		} else if (strncmp(argv[argi], "-j", 2)==0)
+			threadCount=atol(argv[argi]+2);
+		else if (strncmp(argv[argi], "--cachedir=", strlen("--cachedir="))==0)
+			assemblerIncludeCache.dir=argv[argi]+strlen("--cachedir=");
+		else
+			printf("warning: unknown option '%s'\n", argv[argi]);
+	}
+
+	if (argi>=argc || (argc-argi)%2!=0) {
+		printf("Usage: %s [--verbose] [-O] [--map] [--layout=file] [-jthreads] [--cachedir=dir] [-Iincludepath] inputfile outputfile [inputfile outputfile ...]\n", argv[0]);
+		goto done;
+	}
+
+	// Create list of jobs from input/output pairs
+	options.jobsCount=(argc-argi)/2;
+	options.jobs=malloc(sizeof(AssemblerJob)*options.jobsCount);
+	if (options.jobs==NULL) {
+		printf("Could not allocate memory for job list\n");
+		goto done;
+	}
+	for(size_t i=0; i<options.jobsCount; ++i) {
+		options.jobs[i].inputPath=argv[argi+2*i];
+		options.jobs[i].outputPath=argv[argi+2*i+1];
+		options.jobs[i].result=false;
+	}
+
+	// Assemble files, using a pool of threads if we have more than one job.
+	// Verbose output is not thread safe so force a single thread in this case.
+	if (options.verbose || threadCount<1)
+		threadCount=1;
+	if (threadCount>options.jobsCount)
+		threadCount=options.jobsCount;
+
+	if (threadCount==1)
+		assemblerWorkerThread(&options);
+	else {
+		pthread_t threads[threadCount];
+		long threadsNext;
+		for(threadsNext=0; threadsNext<threadCount; ++threadsNext)
+			if (pthread_create(&threads[threadsNext], NULL, &assemblerWorkerThread, &options)!=0)
+				break;
+
+		// If we could not create any threads then simply do the work ourselves
+		if (threadsNext==0)
+			assemblerWorkerThread(&options);
+
+		for(long i=0; i<threadsNext; ++i)
+			pthread_join(threads[i], NULL);
+	}
+
+	// Check for any failures
+	result=EXIT_SUCCESS;
+	for(size_t i=0; i<options.jobsCount; ++i)
+		if (!options.jobs[i].result)
+			result=EXIT_FAILURE;
+
+	// Tidy up
+	done:
+	free(options.jobs);
+	for(size_t i=0; i<options.layoutFunctionsNext; ++i)
+		free(options.layoutFunctions[i]);
+	free(options.layoutFunctions);
+	pthread_mutex_destroy(&options.jobsMutex);
+	assemblerIncludeCacheFree();
+
+	return result;
+}
+
+void *assemblerWorkerThread(void *userData) {
+	AssemblerOptions *options=(AssemblerOptions *)userData;
+
+	while(1) {
+		// Grab next job, if any
+		pthread_mutex_lock(&options->jobsMutex);
+		size_t index=options->jobsNext++;
+		pthread_mutex_unlock(&options->jobsMutex);
+		if (index>=options->jobsCount)
+			break;
+
+		// Assemble
+		AssemblerJob *job=&options->jobs[index];
+		job->result=assemblerAssembleFile(options, job->inputPath, job->outputPath);
+	}
+
+	return NULL;
+}
+
+bool assemblerAssembleFile(const AssemblerOptions *options, const char *inputPath, const char *outputPath) {
+	assert(options!=NULL);
+	assert(inputPath!=NULL);
+	assert(outputPath!=NULL);
+
+	bool result=false;
 	bool change;
 
 	// Create program struct
@@ -387,34 +644,22 @@ int main(int argc, char **argv) {
 	if (program==NULL)
 		goto done;
 
-	// Parse arguments
-	if (argc<3) {
-		printf("Usage: %s [--verbose] [-Iincludepath] inputfile outputfile\n", argv[0]);
-		goto done;
-	}
-
-	bool verbose=false;
-	for(int i=1; i<argc-2; ++i) {
-		if (strcmp(argv[i], "--verbose")==0)
-			verbose=true;
-		else if (strncmp(argv[i], "-I", 2)==0) {
-			char *spacePtr=strchr(argv[i]+2, ' '); // TODO: Support quotes/escape character or similar to allow spaces in names
-			char newDir[AssemblerIncludeDirLenMax];
-			if (spacePtr==NULL)
-				strcpy(newDir, argv[i]+2);
-			else {
-				size_t dirLen=spacePtr-(argv[i]+2);
-				strncpy(newDir, argv[i]+2, dirLen);
-				newDir[dirLen]='\0';
-			}
-			assemblerProgramAddIncludeDir(program, newDir); // TODO: Check return
-		} else
-			printf("warning: unknown option '%s'\n", argv[i]);
+	bool verbose=options->verbose;
+	for(size_t i=0; i<options->includeDirsNext; ++i) {
+		const char *dirArg=options->includeDirs[i];
+		const char *spacePtr=strchr(dirArg, ' '); // TODO: Support quotes/escape character or similar to allow spaces in names
+		char newDir[AssemblerIncludeDirLenMax];
+		if (spacePtr==NULL)
+			strcpy(newDir, dirArg);
+		else {
+			size_t dirLen=spacePtr-dirArg;
+			strncpy(newDir, dirArg, dirLen);
+			newDir[dirLen]='\0';
+		}
+		assemblerProgramAddIncludeDir(program, newDir); // TODO: Check return
 	}
-	const char *inputPath=argv[argc-2];
-	const char *outputPath=argv[argc-1];
 
-	// Read input file line-by-line
+	// Read input file line-by-line (this also strips whitespace, comments, etc)
 	char tempPath[1024]={0}; // TODO: better
 	if (inputPath[0]!='/') {
 		getcwd(tempPath, 1024);
@@ -425,26 +670,12 @@ int main(int argc, char **argv) {
 	if (!assemblerInsertLinesFromFile(program, tempPath, 0))
 		goto done;
 
-	// Preprocess (handle whitespace, includes etc)
-	do {
-		change=false;
-
-		// Preprocess (strip whitespace, comments, etc)
-		while(assemblerProgramPreprocess(program))
-			change=true;
-
-		// Handle an include if any
-		bool includeChange=false;
-		if (!assemblerProgramHandleNextInclude(program, &includeChange))
-			goto done;
-		change|=includeChange;
+	// Handle includes
+	if (!assemblerProgramHandleIncludes(program))
+		goto done;
 
-		// Handle an option if any (such as nostack or noscratch)
-		bool optionChange=false;
-		if (!assemblerProgramHandleNextOption(program, &optionChange))
-			goto done;
-		change|=optionChange;
-	} while(change);
+	// Handle options (such as nostack or noscratch)
+	assemblerProgramHandleOptions(program);
 
 	// Prepend initial 'header' bytes/instructions.
 	const char *autoFile="<auto>";
@@ -506,6 +737,20 @@ int main(int argc, char **argv) {
 	if (!assemblerProgramParseLines(program))
 		goto done;
 
+	// Reorder functions based on profiling data if given
+	if (options->layoutFunctionsNext>0 && !assemblerProgramApplyLayout(program, options->layoutFunctions, options->layoutFunctionsNext))
+		goto done;
+
+	// Optional peephole optimisations (looping as each change may open up further opportunities)
+	if (options->optimise) {
+		size_t instructionsBefore=program->instructionsNext;
+		unsigned changes, totalChanges=0;
+		while((changes=assemblerProgramOptimise(program))>0)
+			totalChanges+=changes;
+		if (verbose)
+			printf("Optimisation: %u changes, %zu instructions removed\n", totalChanges, instructionsBefore-program->instructionsNext);
+	}
+
 	// Move defines to be after everything else
 	while(assemblerProgramShiftDefines(program))
 		;
@@ -518,17 +763,22 @@ int main(int argc, char **argv) {
 	if (!assemblerProgramCalculateInitialMachineCodeLengths(program))
 		goto done;
 
+	// Compute initial offsets for each instruction based on sum of lengths of all previous ones
+	assemblerProgramCalculateMachineCodeOffsets(program);
+
 	// Machine code generation loop
+	struct timespec generateStartTime, generateEndTime;
+	clock_gettime(CLOCK_MONOTONIC, &generateStartTime);
+	unsigned generatePasses=0;
 	do {
-		// (re)-compute offsets for each instruction based on sum of lengths of all previous ones
-		assemblerProgramCalculateMachineCodeOffsets(program);
-
-		// compute machine code, potentially noticing size savings causing us to have to loop
+		// compute machine code (updating offsets as we go), potentially noticing size savings causing us to have to loop
 		if (!assemblerProgramGenerateMachineCode(program, &change))
 			goto done;
+		++generatePasses;
 
 		// If any changes, loop again as we may now be able to make further changes.
 	} while(change);
+	clock_gettime(CLOCK_MONOTONIC, &generateEndTime);
 
 	// Update instruction we created earlier (if we did) to set the stack pointer register (now that we have computed offsets),
 	// and then recompute machine code one last time.
@@ -549,20 +799,77 @@ int main(int argc, char **argv) {
 	assert(!change); // SP is always >=32kb so needs 3 byte set16 instruction regardless
 
 	// Verbose output
-	if (verbose)
+	if (verbose) {
 		assemblerProgramDebugInstructions(program);
 
+		double generateMs=(generateEndTime.tv_sec-generateStartTime.tv_sec)*1000.0+(generateEndTime.tv_nsec-generateStartTime.tv_nsec)/1000000.0;
+		printf("Machine code generation: %u passes, %.3fms\n", generatePasses, generateMs);
+	}
+
 	// Output machine code
 	if (!assemblerProgramWriteMachineCode(program, outputPath)) {
 		printf("Could not write machine code to '%s'\n", outputPath);
 		goto done;
 	}
 
+	// Output map file if needed
+	if (options->writeMap) {
+		char mapPath[1024]; // TODO: better
+		snprintf(mapPath, sizeof(mapPath), "%s.map", outputPath);
+		if (!assemblerProgramWriteMap(program, mapPath)) {
+			printf("Could not write map to '%s'\n", mapPath);
+			goto done;
+		}
+	}
+
+	result=true;
+
 	// Tidy up
 	done:
 	assemblerProgramFree(program);
 
-	return 0;
+	return result;
+}
+
+bool assemblerOptionsReadLayout(AssemblerOptions *options, const char *path) {
+	assert(options!=NULL);
+	assert(path!=NULL);
+
+	FILE *file=fopen(path, "r");
+	if (file==NULL) {
+		printf("Could not open layout file '%s' for reading\n", path);
+		return false;
+	}
+
+	// Each line starts with a function name (anything after this, such as a count, is ignored), with ';' starting a comment
+	char line[1024];
+	while(fgets(line, sizeof(line), file)!=NULL) {
+		char *commentPtr=strchr(line, ';');
+		if (commentPtr!=NULL)
+			*commentPtr='\0';
+
+		char *savePtr;
+		const char *name=strtok_r(line, " \t\r\n", &savePtr);
+		if (name==NULL)
+			continue;
+
+		char **newFunctions=realloc(options->layoutFunctions, sizeof(char *)*(options->layoutFunctionsNext+1));
+		char *newName=malloc(strlen(name)+1);
+		if (newFunctions==NULL || newName==NULL) {
+			if (newFunctions!=NULL)
+				options->layoutFunctions=newFunctions;
+			free(newName);
+			printf("Could not allocate memory for layout file '%s'\n", path);
+			fclose(file);
+			return false;
+		}
+		strcpy(newName, name);
+		options->layoutFunctions=newFunctions;
+		options->layoutFunctions[options->layoutFunctionsNext++]=newName;
+	}
+
+	fclose(file);
+	return true;
 }
 
 AssemblerProgram *assemblerProgramNew(void) {
@@ -574,6 +881,10 @@ AssemblerProgram *assemblerProgramNew(void) {
 
 	program->linesNext=0;
 	program->instructionsNext=0;
+	program->symbolsNext=0;
+	memset(program->symbolTable, 0xFF, sizeof(program->symbolTable));
+	program->passInstructionIndex=0;
+	program->passSavedBytes=0;
 	program->includePathsNext=0;
 	program->noStack=false;
 	program->noScratch=false;
@@ -619,42 +930,35 @@ void assemblerInsertLine(AssemblerProgram *program, AssemblerLine *line, int off
 bool assemblerInsertLinesFromFile(AssemblerProgram *program, const char *path, int offset) {
 	assert(program!=NULL);
 	assert(path!=NULL);
+	assert(offset<=program->linesNext);
 
-	// Open input file
-	FILE *file=fopen(path, "r");
-	if (file==NULL) {
-		printf("Could not open input file '%s' for reading\n", path);
+	// Grab preprocessed lines from cache (reading file if needed)
+	const AssemblerIncludeCacheEntry *entry=assemblerIncludeCacheGet(path);
+	if (entry==NULL)
 		return false;
-	}
 
-	// Read file line-by-line
-	char *line=NULL;
-	size_t lineSize=0;
-	unsigned lineNum=1;
-	while(getline(&line, &lineSize, file)>0) {
-		// Trim trailing newline
-		if (line[strlen(line)-1]=='\n')
-			line[strlen(line)-1]='\0';
+	if (program->linesNext+entry->linesNext>AssemblerLinesMax) {
+		printf("error - too many lines including '%s'\n", path);
+		return false;
+	}
 
-		// Begin creating structure to represent this line
+	// Make space for all lines at once then copy them in
+	memmove(program->lines+offset+entry->linesNext, program->lines+offset, sizeof(AssemblerLine *)*(program->linesNext-offset));
+	for(size_t i=0; i<entry->linesNext; ++i) {
+		const AssemblerLine *cachedLine=&entry->lines[i];
 		AssemblerLine *assemblerLine=malloc(sizeof(AssemblerLine));
 
-		assemblerLine->lineNum=lineNum;
+		assemblerLine->lineNum=cachedLine->lineNum;
 		assemblerLine->file=malloc(strlen(path)+1);
 		strcpy(assemblerLine->file, path);
-		assemblerLine->original=malloc(strlen(line)+1);
-		strcpy(assemblerLine->original, line);
-		assemblerLine->modified=malloc(strlen(line)+1);
-		strcpy(assemblerLine->modified, line);
-
-		assemblerInsertLine(program, assemblerLine, offset++);
+		assemblerLine->original=malloc(strlen(cachedLine->original)+1);
+		strcpy(assemblerLine->original, cachedLine->original);
+		assemblerLine->modified=malloc(strlen(cachedLine->modified)+1);
+		strcpy(assemblerLine->modified, cachedLine->modified);
 
-		// Advance to next line
-		++lineNum;
+		program->lines[offset+i]=assemblerLine;
 	}
-	free(line);
-
-	fclose(file);
+	program->linesNext+=entry->linesNext;
 
 	// Add to include paths array
 	strcpy(program->includedPaths[program->includePathsNext++], path);
@@ -675,18 +979,39 @@ void assemblerRemoveLine(AssemblerProgram *program, int offset) {
 	memmove(program->lines+offset, program->lines+offset+1, sizeof(AssemblerLine *)*((--program->linesNext)-offset));
 }
 
-bool assemblerProgramPreprocess(AssemblerProgram *program) {
-	assert(program!=NULL);
+bool assemblerLinePreprocess(AssemblerLine *assemblerLine) {
+	assert(assemblerLine!=NULL);
 
 	bool change=false;
 
 	// Strip comments and excess white space
-	for(unsigned i=0; i<program->linesNext; ++i) {
-		bool inString;
-		char *c;
-		AssemblerLine *assemblerLine=program->lines[i];
+	bool inString;
+	char *c;
+
+	// Convert all white-space to actual spaces, and strip of comment if any.
+	inString=false;
+	for(c=assemblerLine->modified; *c!='\0'; ++c) {
+		if (inString) {
+			if (*c=='\'')
+				inString=false;
+			else if (*c=='\\')
+				++c; // Skip escaped character
+		} else {
+			if (*c=='\'') {
+				inString=true;
+			} else if (*c==';') {
+				change=true;
+				*c='\0';
+				break;
+			} else if (isspace(*c))
+				*c=' ';
+		}
+	}
 
-		// Convert all white-space to actual spaces, and strip of comment if any.
+	// Replace two or more spaces with a single space (outside of strings)
+	bool localChange;
+	do {
+		localChange=false;
 		inString=false;
 		for(c=assemblerLine->modified; *c!='\0'; ++c) {
 			if (inString) {
@@ -697,51 +1022,27 @@ bool assemblerProgramPreprocess(AssemblerProgram *program) {
 			} else {
 				if (*c=='\'') {
 					inString=true;
-				} else if (*c==';') {
-					change=true;
-					*c='\0';
-					break;
-				} else if (isspace(*c))
-					*c=' ';
-			}
-		}
-
-		// Replace two or more spaces with a single space (outside of strings)
-		bool localChange;
-		do {
-			localChange=false;
-			inString=false;
-			for(c=assemblerLine->modified; *c!='\0'; ++c) {
-				if (inString) {
-					if (*c=='\'')
-						inString=false;
-					else if (*c=='\\')
-						++c; // Skip escaped character
-				} else {
-					if (*c=='\'') {
-						inString=true;
-					} else if (*c==' ') {
-						if (c[1]=='\0')
-							break;
-						else if (c[1]==' ') {
-							memmove(c, c+1, strlen(c+1)+1);
-							localChange=true;
-							change=true;
-						}
+				} else if (*c==' ') {
+					if (c[1]=='\0')
+						break;
+					else if (c[1]==' ') {
+						memmove(c, c+1, strlen(c+1)+1);
+						localChange=true;
+						change=true;
 					}
 				}
 			}
-		} while(localChange);
-
-		// Trim preceeding or trailing white space.
-		if (assemblerLine->modified[0]==' ') {
-			memmove(assemblerLine->modified, assemblerLine->modified+1, strlen(assemblerLine->modified+1)+1);
-			change=true;
-		}
-		if (strlen(assemblerLine->modified)>0 && assemblerLine->modified[strlen(assemblerLine->modified)-1]==' ') {
-			assemblerLine->modified[strlen(assemblerLine->modified)-1]='\0';
-			change=true;
 		}
+	} while(localChange);
+
+	// Trim preceeding or trailing white space.
+	if (assemblerLine->modified[0]==' ') {
+		memmove(assemblerLine->modified, assemblerLine->modified+1, strlen(assemblerLine->modified+1)+1);
+		change=true;
+	}
+	if (strlen(assemblerLine->modified)>0 && assemblerLine->modified[strlen(assemblerLine->modified)-1]==' ') {
+		assemblerLine->modified[strlen(assemblerLine->modified)-1]='\0';
+		change=true;
 	}
 
 	return change;
@@ -792,22 +1093,23 @@ bool assemblerProgramLocateInclude(const AssemblerProgram *program, char *destPa
 	return true;
 }
 
-bool assemblerProgramHandleNextInclude(AssemblerProgram *program, bool *change) {
+bool assemblerProgramHandleIncludes(AssemblerProgram *program) {
 	assert(program!=NULL);
 
-	if (change!=NULL)
-		*change=false;
-
-	// Loop over lines looking for those which start with 'include ' or 'require .
-	for(unsigned line=0; line<program->linesNext; ++line) {
+	// Loop over lines looking for those which start with 'include ' or 'require '.
+	// Included files are inserted in place of the statement, so we continue scanning from the same line to handle any nested includes in order.
+	unsigned line=0;
+	while(line<program->linesNext) {
 		AssemblerLine *assemblerLine=program->lines[line];
 
 		// Check for include or require statement
 		bool isInclude=(strncmp(assemblerLine->modified, "include ", strlen("include "))==0);
 		bool isRequire=(strncmp(assemblerLine->modified, "require ", strlen("require "))==0);
 		bool isRequireEnd=(strncmp(assemblerLine->modified, "requireend ", strlen("requireend "))==0);
-		if (!isInclude && !isRequire && !isRequireEnd)
+		if (!isInclude && !isRequire && !isRequireEnd) {
+			++line;
 			continue;
+		}
 
 		// Extract path
 		char newPath[1024]; // TODO: Avoid hardcoded size
@@ -818,10 +1120,6 @@ bool assemblerProgramHandleNextInclude(AssemblerProgram *program, bool *change)
 		// Remove this line
 		assemblerRemoveLine(program, line);
 
-		// Indicate a change has occured
-		if (change!=NULL)
-			*change=true;
-
 		if (!located)
 			continue;
 
@@ -833,56 +1131,42 @@ bool assemblerProgramHandleNextInclude(AssemblerProgram *program, bool *change)
 					alreadyIncluded=true;
 					break;
 				}
-			if (alreadyIncluded) {
-				--line;
+			if (alreadyIncluded)
 				continue;
-			}
 		}
 
-		// Read line-by-line
+		// Insert lines
 		int offset=(isRequireEnd ? program->linesNext : line);
 		if (!assemblerInsertLinesFromFile(program, newPath, offset))
 			return false;
-
-		// We have handled something - return
-		break;
 	}
 
 	return true;
 }
 
-bool assemblerProgramHandleNextOption(AssemblerProgram *program, bool *change) {
+void assemblerProgramHandleOptions(AssemblerProgram *program) {
 	assert(program!=NULL);
 
-	if (change!=NULL)
-		*change=false;
-
-	// Loop over lines looking for those which start with 'nostack ' or 'noscratch .
-	for(unsigned line=0; line<program->linesNext; ++line) {
+	// Loop over lines looking for those which start with 'nostack' or 'noscratch'.
+	unsigned line=0;
+	while(line<program->linesNext) {
 		AssemblerLine *assemblerLine=program->lines[line];
 
 		// Check for nostack or noscratch statement
 		bool isNoStack=(strncmp(assemblerLine->modified, "nostack", strlen("nostack"))==0);
 		bool isNoScratch=(strncmp(assemblerLine->modified, "noscratch", strlen("noscratch"))==0);
-		if (!isNoStack && !isNoScratch)
+		if (!isNoStack && !isNoScratch) {
+			++line;
 			continue;
-
-		// Remove this line
-		assemblerRemoveLine(program, line);
-
-		// Indicate a change has occured
-		if (change!=NULL)
-			*change=true;
+		}
 
 		// Set relavent flag
 		program->noStack|=isNoStack;
 		program->noScratch|=isNoScratch;
 
-		// We have handled something - return
-		break;
+		// Remove this line
+		assemblerRemoveLine(program, line);
 	}
-
-	return true;
 }
 
 bool assemblerProgramParseLines(AssemblerProgram *program) {
@@ -961,6 +1245,11 @@ bool assemblerProgramParseLines(AssemblerProgram *program) {
 			instruction->d.allocation.symbol=symbol;
 			instruction->d.allocation.len=0;
 			instruction->d.allocation.totalSize=0;
+
+			if (!assemblerProgramAddSymbol(program, AssemblerSymbolTypeAllocation, symbol, program->instructionsNext-1, 0)) {
+				printf("error - duplicate symbol '%s' (%s:%u '%s')\n", symbol, assemblerLine->file, assemblerLine->lineNum, assemblerLine->original);
+				return false;
+			}
 		} else if (strcmp(first, "db")==0 || strcmp(first, "dw")==0) {
 			unsigned membSize=0;
 			switch(first[1]) {
@@ -1087,8 +1376,14 @@ bool assemblerProgramParseLines(AssemblerProgram *program) {
 
 			instruction->d.define.totalSize=instruction->d.define.membSize*instruction->d.define.len;
 			instruction->d.define.pointerLineIndex=instruction->lineIndex;
+			instruction->d.define.pointerInstructionIndex=program->instructionsNext-1;
 			instruction->d.define.pointerOffset=0;
 			instruction->d.define.symbol=symbol;
+
+			if (!assemblerProgramAddSymbol(program, AssemblerSymbolTypeDefine, symbol, program->instructionsNext-1, 0)) {
+				printf("error - duplicate symbol '%s' (%s:%u '%s')\n", symbol, assemblerLine->file, assemblerLine->lineNum, assemblerLine->original);
+				return false;
+			}
 		} else if (strcmp(first, "mov")==0) {
 			char *dest=strtok_r(NULL, " ", &savePtr);
 			if (dest==NULL) {
@@ -1146,6 +1441,11 @@ bool assemblerProgramParseLines(AssemblerProgram *program) {
 			instruction->modifiedLineCopy=lineCopy;
 			instruction->type=AssemblerInstructionTypeLabel;
 			instruction->d.label.symbol=symbol;
+
+			if (!assemblerProgramAddSymbol(program, AssemblerSymbolTypeLabel, symbol, program->instructionsNext-1, 0)) {
+				printf("error - duplicate symbol '%s' (%s:%u '%s')\n", symbol, assemblerLine->file, assemblerLine->lineNum, assemblerLine->original);
+				return false;
+			}
 		} else if (strcmp(first, "syscall")==0) {
 			AssemblerInstruction *instruction=&program->instructions[program->instructionsNext++];
 			instruction->lineIndex=i;
@@ -1341,6 +1641,11 @@ bool assemblerProgramParseLines(AssemblerProgram *program) {
 			instruction->type=AssemblerInstructionTypeConst;
 			instruction->d.constSymbol.symbol=symbol;
 			instruction->d.constSymbol.value=constValue;
+
+			if (!assemblerProgramAddSymbol(program, AssemblerSymbolTypeConst, symbol, program->instructionsNext-1, instruction->d.constSymbol.value)) {
+				printf("error - duplicate symbol '%s' (%s:%u '%s')\n", symbol, assemblerLine->file, assemblerLine->lineNum, assemblerLine->original);
+				return false;
+			}
 		} else if (strcmp(first, "nop")==0) {
 			AssemblerInstruction *instruction=&program->instructions[program->instructionsNext++];
 			instruction->lineIndex=i;
@@ -1390,9 +1695,25 @@ bool assemblerProgramParseLines(AssemblerProgram *program) {
 					instruction->d.alu.incDecValue=assemblerInstructionAluData[j].incDecValue;
 				if (instruction->d.alu.type==BytecodeInstructionAluTypeExtra)
 					instruction->d.alu.extraType=assemblerInstructionAluData[j].extraType;
+				if (instruction->d.alu.type==BytecodeInstructionAluTypeInt32)
+					instruction->d.alu.int32Type=assemblerInstructionAluData[j].int32Type;
 				instruction->d.alu.dest=dest;
 				instruction->d.alu.opA=opA;
 				instruction->d.alu.opB=opB;
+				if (instruction->d.alu.type==BytecodeInstructionAluTypeMemory) {
+					instruction->d.alu.memoryType=assemblerInstructionAluData[j].memoryType;
+					if (assemblerInstructionAluMemoryTypeIsDisp(instruction->d.alu.memoryType)) {
+						// Final operand is a literal displacement rather than a register
+						char *end;
+						long displacement=strtol(opB, &end, 0);
+						if (*end!='\0' || displacement<INT8_MIN || displacement>INT8_MAX) {
+							printf("error - expected displacement in range %i to %i after '%s', instead got '%s' (%s:%u '%s')\n", INT8_MIN, INT8_MAX, opA, opB, assemblerLine->file, assemblerLine->lineNum, assemblerLine->original);
+							return false;
+						}
+						instruction->d.alu.displacement=displacement;
+						instruction->d.alu.opB=NULL;
+					}
+				}
 			} else {
 				printf("error - unknown/unimplemented instruction '%s' (%s:%u '%s')\n", first, assemblerLine->file, assemblerLine->lineNum, assemblerLine->original);
 				free(lineCopy);
@@ -1404,54 +1725,487 @@ bool assemblerProgramParseLines(AssemblerProgram *program) {
 	return true;
 }
 
-bool assemblerProgramShiftDefines(AssemblerProgram *program) {
+bool assemblerProgramApplyLayout(AssemblerProgram *program, char *const *functions, size_t functionsCount) {
 	assert(program!=NULL);
+	assert(functions!=NULL);
+
+	// Code is split into groups of instructions, each starting with a function label.
+	// A group can only be moved if its final instruction is an unconditional jmp or ret (otherwise execution falls through into the next group, and so these are merged),
+	// and if none of its labels have their address taken (signal handlers for example must stay within the first 256 bytes).
+	// The first group (entry code) is never moved.
+	// Moved groups are placed after all other code, hottest first, leaving allocations, defines and consts in place so ram and data layout is unaffected.
+	size_t count=program->instructionsNext;
+	int *groupRank=malloc(sizeof(int)*count); // for each instruction, index into functions array for the group it belongs to (or -1 if not being moved)
+	bool *addressTaken=calloc(count, sizeof(bool));
+	AssemblerInstruction *newInstructions=malloc(sizeof(AssemblerInstruction)*count);
+	if (groupRank==NULL || addressTaken==NULL || newInstructions==NULL) {
+		printf("Could not allocate memory for applying layout\n");
+		free(groupRank);
+		free(addressTaken);
+		free(newInstructions);
+		return false;
+	}
 
-	// Move defines to be after everything else
-	bool anyChange=false;
-	bool change;
-	do {
-		change=false;
-		for(unsigned i=0; i<program->instructionsNext-1; ++i) {
-				AssemblerInstruction *instruction=&program->instructions[i];
-				AssemblerInstruction *nextInstruction=&program->instructions[i+1];
+	// Find labels which have their address taken
+	for(unsigned i=0; i<count; ++i) {
+		const AssemblerInstruction *instruction=&program->instructions[i];
+		int labelIndex;
+		if (instruction->type==AssemblerInstructionTypeMov && (labelIndex=assemblerGetLabelSymbolInstructionIndex(program, instruction->d.mov.src))!=-1)
+			addressTaken[labelIndex]=true;
+	}
 
-				if (instruction->type==AssemblerInstructionTypeDefine && nextInstruction->type!=AssemblerInstructionTypeDefine) {
-					// Swap
-					AssemblerInstruction tempInstruction=*instruction;
-					*instruction=*nextInstruction;
-					*nextInstruction=tempInstruction;
-					change=true;
-				}
+	// Split into groups and decide which to move
+	unsigned groupStart=0;
+	int rank=-1;
+	bool pinned=false, fallsThrough=true;
+	for(unsigned i=0; i<=count; ++i) {
+		const AssemblerInstruction *instruction=(i<count ? &program->instructions[i] : NULL);
+
+		// Start of new group? (or end of program)
+		if (instruction==NULL || (i>0 && !fallsThrough && instruction->type==AssemblerInstructionTypeLabel && assemblerProgramInstructionIsFunction(program, i))) {
+			bool move=(groupStart>0 && rank>=0 && !pinned && !fallsThrough);
+			for(unsigned j=groupStart; j<i; ++j)
+				groupRank[j]=(move ? rank : -1);
+
+			groupStart=i;
+			rank=-1;
+			pinned=false;
+			fallsThrough=true;
 		}
-		anyChange|=change;
-	} while(change);
-	return anyChange;
+		if (instruction==NULL)
+			break;
+
+		switch(instruction->type) {
+			case AssemblerInstructionTypeAllocation:
+			case AssemblerInstructionTypeDefine:
+			case AssemblerInstructionTypeConst:
+				// Not code so cannot affect whether we fall through
+			break;
+			case AssemblerInstructionTypeLabel:
+				for(size_t j=0; j<functionsCount; ++j)
+					if (strcmp(instruction->d.label.symbol, functions[j])==0 && (rank==-1 || j<(size_t)rank))
+						rank=j;
+				pinned|=addressTaken[i];
+			break;
+			case AssemblerInstructionTypeJmp:
+			case AssemblerInstructionTypeRet:
+				fallsThrough=(i>0 && assemblerInstructionIsSkip(&program->instructions[i-1]));
+			break;
+			default:
+				fallsThrough=true;
+			break;
+		}
+	}
+
+	// Create new instruction order - unmoved code and non-code first, then moved groups in order given
+	size_t newNext=0;
+	for(unsigned i=0; i<count; ++i) {
+		AssemblerInstructionType type=program->instructions[i].type;
+		if (groupRank[i]==-1 || type==AssemblerInstructionTypeAllocation || type==AssemblerInstructionTypeDefine || type==AssemblerInstructionTypeConst)
+			newInstructions[newNext++]=program->instructions[i];
+	}
+	for(size_t j=0; j<functionsCount; ++j) {
+		for(unsigned i=0; i<count; ++i) {
+			AssemblerInstructionType type=program->instructions[i].type;
+			if (groupRank[i]==(int)j && type!=AssemblerInstructionTypeAllocation && type!=AssemblerInstructionTypeDefine && type!=AssemblerInstructionTypeConst)
+				newInstructions[newNext++]=program->instructions[i];
+		}
+	}
+	assert(newNext==count);
+
+	memcpy(program->instructions, newInstructions, sizeof(AssemblerInstruction)*count);
+	assemblerProgramUpdateSymbolInstructionIndexes(program);
+
+	free(groupRank);
+	free(addressTaken);
+	free(newInstructions);
+
+	return true;
 }
 
-bool assemblerProgramShrinkDefines(AssemblerProgram *program) {
+bool assemblerProgramInstructionIsFunction(const AssemblerProgram *program, unsigned instructionIndex) {
 	assert(program!=NULL);
+	assert(instructionIndex<program->instructionsNext);
 
-	// Look for defines whoose data is completely found within another
-	bool anyChange=false;
-	bool change;
-	do {
-		change=false;
-		for(unsigned i=0; i<program->instructionsNext-1; ++i) {
-			AssemblerInstruction *instruction=&program->instructions[i];
-			if (instruction->type!=AssemblerInstructionTypeDefine)
-				continue;
-			if (instruction->d.define.pointerLineIndex!=instruction->lineIndex)
-				continue; // already handled
+	const AssemblerInstruction *instruction=&program->instructions[instructionIndex];
+	if (instruction->type!=AssemblerInstructionTypeLabel)
+		return false;
 
-			for(unsigned j=0; j<program->instructionsNext-1; ++j) {
-				if (i==j)
-					continue;
-				AssemblerInstruction *loopInstruction=&program->instructions[j];
-				if (loopInstruction->type!=AssemblerInstructionTypeDefine)
-					continue;
-				if (loopInstruction->d.define.pointerLineIndex!=loopInstruction->lineIndex)
-					continue; // no point using this instruction as if we are a subset of it, we are also a subset of whatever this points to currently
+	for(unsigned i=0; i<program->instructionsNext; ++i)
+		if (program->instructions[i].type==AssemblerInstructionTypeCall && strcmp(program->instructions[i].d.call.label, instruction->d.label.symbol)==0)
+			return true;
+	return false;
+}
+
+unsigned assemblerProgramOptimise(AssemblerProgram *program) {
+	assert(program!=NULL);
+
+	// Instructions are only marked for removal as we go, and then removed in one go at the end
+	bool *removed=calloc(program->instructionsNext, sizeof(bool));
+	if (removed==NULL)
+		return 0;
+
+	// Track what we know about register values as we walk through the instructions.
+	// This is reset whenever we reach anything which could be jumped to, or jumps itself (labels, calls etc).
+	AssemblerRegisterState regs[BytecodeRegisterNB];
+	assemblerRegisterStatesReset(regs);
+
+	unsigned changes=0;
+	for(unsigned i=0; i<program->instructionsNext; ++i) {
+		if (removed[i])
+			continue;
+
+		AssemblerInstruction *instruction=&program->instructions[i];
+		AssemblerInstruction *nextInstruction=(i+1<program->instructionsNext ? &program->instructions[i+1] : NULL);
+
+		// Instructions immediately following a skip are conditional - these are never removed (which would change what the skip skips),
+		// and whatever they write may or may not have happened afterwards.
+		bool conditional=(i>0 && assemblerInstructionIsSkip(&program->instructions[i-1]));
+
+		// Look for push/pop pairs which simply copy a register via the stack
+		if (!conditional && nextInstruction!=NULL) {
+			BytecodeRegister pushReg=BytecodeRegisterNB, popReg=BytecodeRegisterNB;
+			if (assemblerInstructionIsAluExtra(instruction, BytecodeInstructionAluExtraTypePush16) && assemblerInstructionIsAluExtra(nextInstruction, BytecodeInstructionAluExtraTypePop16)) {
+				pushReg=assemblerRegisterFromStr(instruction->d.alu.dest);
+				popReg=assemblerRegisterFromStr(nextInstruction->d.alu.dest);
+			} else if (instruction->type==AssemblerInstructionTypePush8 && nextInstruction->type==AssemblerInstructionTypePop8) {
+				// pop8 clears the upper byte so we can only do this if we know it is already clear
+				pushReg=assemblerRegisterFromStr(instruction->d.push8.src);
+				if (pushReg<BytecodeRegisterSP && regs[pushReg].value>=0 && regs[pushReg].value<256)
+					popReg=assemblerRegisterFromStr(nextInstruction->d.pop8.dest);
+			}
+
+			if (pushReg<BytecodeRegisterSP && popReg<BytecodeRegisterSP) {
+				removed[i]=true;
+				++changes;
+				if (pushReg==popReg) {
+					// Nothing left to do - skip over pop instruction also
+					removed[i+1]=true;
+					++i;
+				} else
+					// Turn pop into mov (which is then handled as normal on the next iteration)
+					assemblerInstructionSetMov(nextInstruction, popReg, pushReg);
+				continue;
+			}
+		}
+
+		// Look for loads immediately after storing to the same address
+		if (!conditional && nextInstruction!=NULL) {
+			BytecodeRegister valueReg=BytecodeRegisterNB, destReg=BytecodeRegisterNB;
+			if (assemblerInstructionIsAluExtra(instruction, BytecodeInstructionAluExtraTypeStore16) && assemblerInstructionIsAluExtra(nextInstruction, BytecodeInstructionAluExtraTypeLoad16) &&
+			    strcmp(instruction->d.alu.dest, nextInstruction->d.alu.opA)==0) {
+				valueReg=assemblerRegisterFromStr(instruction->d.alu.opA);
+				destReg=assemblerRegisterFromStr(nextInstruction->d.alu.dest);
+			} else if (instruction->type==AssemblerInstructionTypeStore8 && nextInstruction->type==AssemblerInstructionTypeLoad8 && strcmp(instruction->d.store8.dest, nextInstruction->d.load8.src)==0) {
+				// load8 clears the upper byte so we can only do this if we know it is already clear
+				valueReg=assemblerRegisterFromStr(instruction->d.store8.src);
+				if (valueReg<BytecodeRegisterSP && regs[valueReg].value>=0 && regs[valueReg].value<256)
+					destReg=assemblerRegisterFromStr(nextInstruction->d.load8.dest);
+			}
+
+			if (valueReg<BytecodeRegisterSP && destReg<BytecodeRegisterSP) {
+				++changes;
+				if (valueReg==destReg)
+					removed[i+1]=true;
+				else
+					assemblerInstructionSetMov(nextInstruction, destReg, valueReg);
+			}
+		}
+
+		// Look for pointer adjustments immediately before a load/store through the same register, which can instead use a displacement.
+		// For loads the adjusted pointer must either be overwritten by the load itself or be dead afterwards, and for stores it must be dead (and not the value being stored).
+		if (!conditional && nextInstruction!=NULL && !removed[i+1] && instruction->type==AssemblerInstructionTypeAlu && (instruction->d.alu.type==BytecodeInstructionAluTypeInc || instruction->d.alu.type==BytecodeInstructionAluTypeDec)) {
+			BytecodeRegister ptrReg=assemblerRegisterFromStr(instruction->d.alu.dest);
+			int delta=(instruction->d.alu.type==BytecodeInstructionAluTypeInc ? instruction->d.alu.incDecValue : -instruction->d.alu.incDecValue);
+
+			BytecodeInstructionAluMemoryType memoryType;
+			BytecodeRegister baseReg=BytecodeRegisterNB, otherReg=BytecodeRegisterNB;
+			bool isLoad=false;
+			if (nextInstruction->type==AssemblerInstructionTypeLoad8) {
+				memoryType=BytecodeInstructionAluMemoryTypeLoad8Disp;
+				baseReg=assemblerRegisterFromStr(nextInstruction->d.load8.src);
+				otherReg=assemblerRegisterFromStr(nextInstruction->d.load8.dest);
+				isLoad=true;
+			} else if (assemblerInstructionIsAluExtra(nextInstruction, BytecodeInstructionAluExtraTypeLoad16)) {
+				memoryType=BytecodeInstructionAluMemoryTypeLoad16Disp;
+				baseReg=assemblerRegisterFromStr(nextInstruction->d.alu.opA);
+				otherReg=assemblerRegisterFromStr(nextInstruction->d.alu.dest);
+				isLoad=true;
+			} else if (nextInstruction->type==AssemblerInstructionTypeStore8) {
+				memoryType=BytecodeInstructionAluMemoryTypeStore8Disp;
+				baseReg=assemblerRegisterFromStr(nextInstruction->d.store8.dest);
+				otherReg=assemblerRegisterFromStr(nextInstruction->d.store8.src);
+			} else if (assemblerInstructionIsAluExtra(nextInstruction, BytecodeInstructionAluExtraTypeStore16)) {
+				memoryType=BytecodeInstructionAluMemoryTypeStore16Disp;
+				baseReg=assemblerRegisterFromStr(nextInstruction->d.alu.dest);
+				otherReg=assemblerRegisterFromStr(nextInstruction->d.alu.opA);
+			}
+
+			if (ptrReg<BytecodeRegisterSP && baseReg==ptrReg && otherReg<BytecodeRegisterNB &&
+			    ((isLoad && otherReg==ptrReg) || (otherReg!=ptrReg && assemblerProgramRegisterIsDead(program, removed, i+2, ptrReg)))) {
+				if (isLoad)
+					assemblerInstructionSetAluMemoryDisp(nextInstruction, memoryType, otherReg, ptrReg, delta);
+				else
+					assemblerInstructionSetAluMemoryDisp(nextInstruction, memoryType, ptrReg, otherReg, delta);
+				removed[i]=true;
+				++changes;
+				continue;
+			}
+		}
+
+		// Look for tail calls - instead of pushing a return address we can jump straight into the function, which then returns to our own caller.
+		// Note: the function will not see its own address in the scratch register but nothing should rely on this.
+		if (!conditional && nextInstruction!=NULL && instruction->type==AssemblerInstructionTypeCall && nextInstruction->type==AssemblerInstructionTypeRet && !program->noStack && !program->noScratch) {
+			const char *label=instruction->d.call.label;
+			instruction->type=AssemblerInstructionTypeJmp;
+			instruction->d.jmp.addr=label;
+			removed[i+1]=true;
+			++changes;
+		}
+
+		// Mov specific optimisations
+		if (instruction->type==AssemblerInstructionTypeMov) {
+			// We never touch the stack or IP registers (which includes the stack setup instruction which is modified later)
+			BytecodeRegister destReg=assemblerRegisterFromStr(instruction->d.mov.dest);
+			if (destReg<BytecodeRegisterSP) {
+				// Determine what we know about the src
+				AssemblerRegisterState srcState={.value=-1, .symbol=NULL};
+				BytecodeRegister srcReg=assemblerRegisterFromStr(instruction->d.mov.src);
+				BytecodeWord srcValue;
+				bool srcValueKnown=false;
+				if (srcReg!=BytecodeRegisterNB) {
+					if (srcReg<BytecodeRegisterSP)
+						srcState=regs[srcReg];
+				} else if (assemblerProgramGetMovSrcValue(program, instruction->d.mov.src, &srcValue)) {
+					srcState.value=srcValue;
+					srcValueKnown=true;
+				} else
+					srcState.symbol=instruction->d.mov.src;
+
+				// Redundant set - register already holds this value
+				if (!conditional && (srcReg==destReg || assemblerRegisterStateEqual(&regs[destReg], &srcState))) {
+					removed[i]=true;
+					++changes;
+					continue;
+				}
+
+				// Dead store - register is overwritten before it is read
+				if (!conditional && assemblerProgramRegisterIsDead(program, removed, i+1, destReg)) {
+					removed[i]=true;
+					++changes;
+					continue;
+				}
+
+				// Shortest form - values which would require a 3 byte set16 may be available in 2 bytes via a register copy or inc/dec.
+				// Note: these are still single instructions so are safe even if conditional.
+				if (srcValueKnown && srcValue>=256) {
+					BytecodeRegister copyReg;
+					for(copyReg=0; copyReg<BytecodeRegisterSP; ++copyReg)
+						if (regs[copyReg].value==srcValue)
+							break;
+
+					int delta=srcValue-regs[destReg].value;
+					if (copyReg<BytecodeRegisterSP) {
+						assemblerInstructionSetMov(instruction, destReg, copyReg);
+						++changes;
+					} else if (regs[destReg].value>=0 && delta!=0 && delta>=-64 && delta<=64) {
+						assemblerInstructionSetIncDec(instruction, destReg, delta);
+						++changes;
+					}
+				}
+			}
+		}
+
+		// Update register states
+		assemblerProgramUpdateRegisterStates(program, instruction, conditional, regs);
+	}
+
+	// Remove marked instructions, keeping symbol table consistent
+	if (changes>0) {
+		unsigned next=0;
+		for(unsigned i=0; i<program->instructionsNext; ++i) {
+			if (removed[i])
+				free(program->instructions[i].modifiedLineCopy);
+			else {
+				if (next!=i)
+					program->instructions[next]=program->instructions[i];
+				++next;
+			}
+		}
+		program->instructionsNext=next;
+
+		assemblerProgramUpdateSymbolInstructionIndexes(program);
+	}
+
+	free(removed);
+
+	return changes;
+}
+
+bool assemblerProgramRegisterIsDead(const AssemblerProgram *program, const bool *removed, unsigned startIndex, BytecodeRegister reg) {
+	assert(program!=NULL);
+	assert(removed!=NULL);
+	assert(reg<BytecodeRegisterNB);
+
+	for(unsigned i=startIndex; i<program->instructionsNext; ++i) {
+		if (removed[i])
+			continue;
+
+		const AssemblerInstruction *instruction=&program->instructions[i];
+		uint8_t readMask, writeMask;
+		assemblerInstructionGetRegisterUsage(instruction, &readMask, &writeMask);
+
+		if (readMask & (1u<<reg))
+			return false;
+		if (assemblerInstructionIsSkip(instruction))
+			return false; // next instruction is conditional so cannot be relied upon to overwrite
+		if (writeMask & (1u<<reg))
+			return true;
+		if (writeMask & (1u<<BytecodeRegisterIP))
+			return false; // jump of some kind
+	}
+
+	return false;
+}
+
+void assemblerProgramUpdateRegisterStates(const AssemblerProgram *program, const AssemblerInstruction *instruction, bool conditional, AssemblerRegisterState *regs) {
+	assert(program!=NULL);
+	assert(instruction!=NULL);
+	assert(regs!=NULL);
+
+	uint8_t readMask, writeMask;
+	assemblerInstructionGetRegisterUsage(instruction, &readMask, &writeMask);
+
+	// Anything which may jump (or be jumped to) invalidates everything
+	if (writeMask & (1u<<BytecodeRegisterIP)) {
+		assemblerRegisterStatesReset(regs);
+		return;
+	}
+
+	// Compute new state for dest register for simple cases (before clearing anything written below)
+	BytecodeRegister destReg=BytecodeRegisterNB;
+	AssemblerRegisterState destState={.value=-1, .symbol=NULL};
+	if (!conditional && instruction->type==AssemblerInstructionTypeMov) {
+		destReg=assemblerRegisterFromStr(instruction->d.mov.dest);
+		BytecodeRegister srcReg=assemblerRegisterFromStr(instruction->d.mov.src);
+		BytecodeWord srcValue;
+		if (srcReg!=BytecodeRegisterNB) {
+			if (srcReg<BytecodeRegisterSP)
+				destState=regs[srcReg];
+		} else if (assemblerProgramGetMovSrcValue(program, instruction->d.mov.src, &srcValue))
+			destState.value=srcValue;
+		else
+			destState.symbol=instruction->d.mov.src;
+	} else if (!conditional && instruction->type==AssemblerInstructionTypeAlu && (instruction->d.alu.type==BytecodeInstructionAluTypeInc || instruction->d.alu.type==BytecodeInstructionAluTypeDec)) {
+		destReg=assemblerRegisterFromStr(instruction->d.alu.dest);
+		if (destReg<BytecodeRegisterSP && regs[destReg].value>=0) {
+			int delta=(instruction->d.alu.type==BytecodeInstructionAluTypeInc ? instruction->d.alu.incDecValue : -instruction->d.alu.incDecValue);
+			destState.value=(BytecodeWord)(regs[destReg].value+delta);
+		}
+	}
+
+	// Clear state for all registers written
+	for(BytecodeRegister reg=0; reg<BytecodeRegisterNB; ++reg)
+		if (writeMask & (1u<<reg))
+			regs[reg]=(AssemblerRegisterState){.value=-1, .symbol=NULL};
+
+	if (destReg<BytecodeRegisterSP)
+		regs[destReg]=destState;
+}
+
+bool assemblerProgramGetMovSrcValue(const AssemblerProgram *program, const char *src, BytecodeWord *value) {
+	assert(program!=NULL);
+	assert(src!=NULL);
+	assert(value!=NULL);
+
+	// Integer
+	if (isdigit(src[0])) {
+		int integer=atoi(src);
+		if (integer>0xFFFF)
+			return false;
+		*value=integer;
+		return true;
+	}
+
+	// Character (badly formed constants are reported later)
+	if (src[0]=='\'') {
+		if (src[1]!='\\' && src[1]!='\0' && src[2]=='\'' && src[3]=='\0') {
+			*value=src[1];
+			return true;
+		}
+		if (src[1]=='\\' && src[2]!='\0' && src[3]=='\'' && src[4]=='\0') {
+			switch(src[2]) {
+				case 'n': *value='\n'; return true; break;
+				case 'r': *value='\r'; return true; break;
+				case 't': *value='\t'; return true; break;
+			}
+		}
+		return false;
+	}
+
+	// Const symbol
+	int constValue=assemblerGetConstSymbolValue(program, src);
+	if (constValue!=-1) {
+		*value=constValue;
+		return true;
+	}
+
+	return false;
+}
+
+bool assemblerProgramShiftDefines(AssemblerProgram *program) {
+	assert(program!=NULL);
+
+	// Move defines to be after everything else
+	bool anyChange=false;
+	bool change;
+	do {
+		change=false;
+		for(unsigned i=0; i<program->instructionsNext-1; ++i) {
+				AssemblerInstruction *instruction=&program->instructions[i];
+				AssemblerInstruction *nextInstruction=&program->instructions[i+1];
+
+				if (instruction->type==AssemblerInstructionTypeDefine && nextInstruction->type!=AssemblerInstructionTypeDefine) {
+					// Swap
+					AssemblerInstruction tempInstruction=*instruction;
+					*instruction=*nextInstruction;
+					*nextInstruction=tempInstruction;
+					change=true;
+				}
+		}
+		anyChange|=change;
+	} while(change);
+
+	// Instructions may have moved so update symbol table to match
+	if (anyChange)
+		assemblerProgramUpdateSymbolInstructionIndexes(program);
+
+	return anyChange;
+}
+
+bool assemblerProgramShrinkDefines(AssemblerProgram *program) {
+	assert(program!=NULL);
+
+	// Look for defines whoose data is completely found within another
+	bool anyChange=false;
+	bool change;
+	do {
+		change=false;
+		for(unsigned i=0; i<program->instructionsNext-1; ++i) {
+			AssemblerInstruction *instruction=&program->instructions[i];
+			if (instruction->type!=AssemblerInstructionTypeDefine)
+				continue;
+			if (instruction->d.define.pointerLineIndex!=instruction->lineIndex)
+				continue; // already handled
+
+			for(unsigned j=0; j<program->instructionsNext-1; ++j) {
+				if (i==j)
+					continue;
+				AssemblerInstruction *loopInstruction=&program->instructions[j];
+				if (loopInstruction->type!=AssemblerInstructionTypeDefine)
+					continue;
+				if (loopInstruction->d.define.pointerLineIndex!=loopInstruction->lineIndex)
+					continue; // no point using this instruction as if we are a subset of it, we are also a subset of whatever this points to currently
 
 				// We have found a pair of defines
 				// Check if the main define's data exists within the loop define's data
@@ -1459,6 +2213,7 @@ bool assemblerProgramShrinkDefines(AssemblerProgram *program) {
 					if (memcmp(instruction->d.define.data, loopInstruction->d.define.data+loopDataI, instruction->d.define.totalSize)==0) {
 						// Match found - update this instruction to simply point into loop instruction
 						instruction->d.define.pointerLineIndex=loopInstruction->lineIndex;
+						instruction->d.define.pointerInstructionIndex=j;
 						instruction->d.define.pointerOffset=loopDataI;
 
 						change=true;
@@ -1574,7 +2329,7 @@ bool assemblerProgramCalculateInitialMachineCodeLengths(AssemblerProgram *progra
 				instruction->machineCodeInstructions=1;
 			break;
 			case AssemblerInstructionTypeAlu:
-				instruction->machineCodeLen=2; // all ALU instructions take 2 bytes
+				instruction->machineCodeLen=(instruction->d.alu.type==BytecodeInstructionAluTypeMemory ? 3 : 2); // all ALU instructions take 2 bytes, except memory ones which have a third for the displacement/length register
 				instruction->machineCodeInstructions=1;
 			break;
 			case AssemblerInstructionTypeJmp:
@@ -1663,6 +2418,9 @@ void assemblerProgramCalculateMachineCodeOffsets(AssemblerProgram *program) {
 
 	// We now know total ram usage by variables so can decide where to place the stack.
 	program->stackRamOffset=nextRamOffset;
+
+	// Update symbol addresses to match
+	assemblerProgramUpdateSymbolValues(program);
 }
 
 bool assemblerProgramGenerateMachineCode(AssemblerProgram *program, bool *changeFlag) {
@@ -1671,10 +2429,22 @@ bool assemblerProgramGenerateMachineCode(AssemblerProgram *program, bool *change
 	if (changeFlag!=NULL)
 		*changeFlag=false;
 
+	program->passSavedBytes=0;
+	unsigned nextMachineCodeOffset=BytecodeMemoryProgmemAddr;
 	for(unsigned i=0; i<program->instructionsNext; ++i) {
 		AssemblerInstruction *instruction=&program->instructions[i];
 		AssemblerLine *line=program->lines[instruction->lineIndex];
 
+		// Update offset to account for any savings made earlier in this pass.
+		// Symbols defined after this instruction still have their old addresses, but lookups adjust these by passSavedBytes.
+		program->passInstructionIndex=i;
+		instruction->machineCodeOffset=nextMachineCodeOffset;
+		if (instruction->type==AssemblerInstructionTypeLabel) {
+			AssemblerSymbol *entry=(AssemblerSymbol *)assemblerProgramGetSymbol(program, instruction->d.label.symbol);
+			assert(entry!=NULL);
+			entry->value=instruction->machineCodeOffset;
+		}
+
 		// Clear machine code array to invalid bytes
 		memset(instruction->machineCode, ByteCodeIllegalInstructionByte, AssemblerInstructionMachineCodeMax);
 
@@ -1771,6 +2541,20 @@ bool assemblerProgramGenerateMachineCode(AssemblerProgram *program, bool *change
 				if (opBReg==BytecodeRegisterNB)
 					opBReg=0;
 
+				// Memory instructions have their own encoding with a third byte
+				if (instruction->d.alu.type==BytecodeInstructionAluTypeMemory) {
+					if (assemblerInstructionAluMemoryTypeIsDisp(instruction->d.alu.memoryType))
+						bytecodeInstructionCreateAluMemoryDisp(instruction->machineCode, instruction->d.alu.memoryType, destReg, opAReg, instruction->d.alu.displacement);
+					else {
+						if (assemblerRegisterFromStr(instruction->d.alu.opB)==BytecodeRegisterNB) {
+							printf("error - expected register (r0-r7) as length, instead got '%s' (%s:%u '%s')\n", instruction->d.alu.opB, line->file, line->lineNum, line->original);
+							return false;
+						}
+						bytecodeInstructionCreateAluMemoryBlock(instruction->machineCode, instruction->d.alu.memoryType, destReg, opAReg, opBReg);
+					}
+					break;
+				}
+
 				// Create instruction
 				if (instruction->d.alu.type==BytecodeInstructionAluTypeSkip) {
 					// Special case to encode literal bit index and skip distance
@@ -1791,7 +2575,9 @@ bool assemblerProgramGenerateMachineCode(AssemblerProgram *program, bool *change
 						destReg=BytecodeRegisterSP;
 					} else if (opBReg==BytecodeInstructionAluExtraTypePop16)
 						opAReg=BytecodeRegisterSP;
-				}
+				} else if (instruction->d.alu.type==BytecodeInstructionAluTypeInt32)
+					// Special case to store type
+					opBReg=instruction->d.alu.int32Type;
 
 				BytecodeInstruction2Byte aluOp=bytecodeInstructionCreateAlu(instruction->d.alu.type, destReg, opAReg, opBReg);
 
@@ -2075,17 +2861,22 @@ bool assemblerProgramGenerateMachineCode(AssemblerProgram *program, bool *change
 
 			// Have we saved space since last iteration?
 			if (actualLen!=instruction->machineCodeLen) {
-				// We have - offsets will need adjusting and code regenerating.
+				// We have - later offsets are adjusted as we continue, but code will need regenerating.
 				assert(actualLen<instruction->machineCodeLen);
+				program->passSavedBytes+=instruction->machineCodeLen-actualLen;
 				instruction->machineCodeLen=actualLen;
-				if (changeFlag!=NULL) {
+				if (changeFlag!=NULL)
 					*changeFlag=true;
-					break;
-				}
 			}
 		}
+
+		nextMachineCodeOffset+=instruction->machineCodeLen;
 	}
 
+	// All offsets are now up to date so resync symbol addresses
+	program->passSavedBytes=0;
+	assemblerProgramUpdateSymbolValues(program);
+
 	return true;
 }
 
@@ -2214,6 +3005,56 @@ void assemblerProgramDebugInstructions(const AssemblerProgram *program) {
 							break;
 						}
 					break;
+					case BytecodeInstructionAluTypeInt32:
+						switch(instruction->d.alu.int32Type) {
+							case BytecodeInstructionAluInt32TypeAdd16:
+								printf("[%s]+=%s (32 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluInt32TypeAdd32:
+								printf("[%s]+=[%s] (32 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluInt32TypeSub16:
+								printf("[%s]-=%s (32 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluInt32TypeSub32:
+								printf("[%s]-=[%s] (32 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluInt32TypeMul16:
+								printf("[%s]*=%s (32 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluInt32TypeMul32:
+								printf("[%s]*=[%s] (32 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluInt32TypeShift:
+								printf("[%s]<<=%s (32 bit, signed shift) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluInt32TypeCmp:
+								printf("%s=cmp([%s],[%s]) (32 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.dest, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+						}
+					break;
+					case BytecodeInstructionAluTypeMemory:
+						switch(instruction->d.alu.memoryType) {
+							case BytecodeInstructionAluMemoryTypeLoad8Disp:
+								printf("%s=[%s%+i] (8 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, instruction->d.alu.displacement, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluMemoryTypeStore8Disp:
+								printf("[%s%+i]=%s (8 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.displacement, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluMemoryTypeLoad16Disp:
+								printf("%s=[%s%+i] (16 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, instruction->d.alu.displacement, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluMemoryTypeStore16Disp:
+								printf("[%s%+i]=%s (16 bit) (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.displacement, instruction->d.alu.opA, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluMemoryTypeCopyBlock:
+								printf("copyblock [%s] [%s] %s (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, instruction->d.alu.opB, line->file, line->lineNum, line->original);
+							break;
+							case BytecodeInstructionAluMemoryTypeFillBlock:
+								printf("fillblock [%s] %s %s (%s:%u '%s')\n", instruction->d.alu.dest, instruction->d.alu.opA, instruction->d.alu.opB, line->file, line->lineNum, line->original);
+							break;
+						}
+					break;
 				}
 			break;
 			case AssemblerInstructionTypeJmp:
@@ -2278,115 +3119,184 @@ bool assemblerProgramWriteMachineCode(const AssemblerProgram *program, const cha
 	return false;
 }
 
-int assemblerGetAllocationSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol) {
+bool assemblerProgramWriteMap(const AssemblerProgram *program, const char *path) {
 	assert(program!=NULL);
-	assert(symbol!=NULL);
+	assert(path!=NULL);
+
+	FILE *file=fopen(path, "w");
+	if (file==NULL) {
+		printf("Could not open map file '%s' for writing\n", path);
+		return false;
+	}
 
-	// Search through instructions looking for this symbol being allocated
+	// Header, then one line per label/instruction in address order:
+	// 'function addr name', 'label addr name' or 'line addr len lineNum file'
+	fprintf(file, "aosf-asm map 1\n");
 	for(unsigned i=0; i<program->instructionsNext; ++i) {
-		const AssemblerInstruction *loopInstruction=&program->instructions[i];
-		if (loopInstruction->type==AssemblerInstructionTypeAllocation && strcmp(loopInstruction->d.allocation.symbol, symbol)==0)
-			return i;
+		const AssemblerInstruction *instruction=&program->instructions[i];
+		const AssemblerLine *line=program->lines[instruction->lineIndex];
+
+		if (instruction->type==AssemblerInstructionTypeLabel)
+			fprintf(file, "%s %u %s\n", (assemblerProgramInstructionIsFunction(program, i) ? "function" : "label"), instruction->machineCodeOffset, instruction->d.label.symbol);
+		else if (instruction->machineCodeLen>0 && instruction->type!=AssemblerInstructionTypeDefine)
+			fprintf(file, "line %u %u %u %s\n", instruction->machineCodeOffset, instruction->machineCodeLen, line->lineNum, line->file);
 	}
 
-	return -1;
+	if (fclose(file)!=0)
+		return false;
+
+	return true;
 }
 
-int assemblerGetAllocationSymbolAddr(const AssemblerProgram *program, const char *symbol) {
-	assert(program!=NULL);
+uint32_t assemblerSymbolHash(const char *symbol) {
 	assert(symbol!=NULL);
 
-	int index=assemblerGetAllocationSymbolInstructionIndex(program, symbol);
-	if (index==-1)
-		return -1;
-
-	return program->instructions[index].d.allocation.ramOffset;
+	// FNV-1a
+	uint32_t hash=2166136261u;
+	for(const char *c=symbol; *c!='\0'; ++c) {
+		hash^=(uint8_t)*c;
+		hash*=16777619u;
+	}
+	return hash;
 }
 
-int assemblerGetDefineSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol) {
+bool assemblerProgramAddSymbol(AssemblerProgram *program, AssemblerSymbolType type, const char *symbol, uint16_t instructionIndex, int value) {
 	assert(program!=NULL);
 	assert(symbol!=NULL);
 
-	// Search through instructions looking for this symbol being defined
-	for(unsigned i=0; i<program->instructionsNext; ++i) {
-		const AssemblerInstruction *loopInstruction=&program->instructions[i];
-		if (loopInstruction->type==AssemblerInstructionTypeDefine && strcmp(loopInstruction->d.define.symbol, symbol)==0)
-			return i;
+	// Find free slot in hash table (or an existing entry with the same name)
+	uint32_t slot=assemblerSymbolHash(symbol)&(AssemblerSymbolTableSize-1);
+	while(program->symbolTable[slot]!=AssemblerSymbolTableEmpty) {
+		if (strcmp(program->symbols[program->symbolTable[slot]].symbol, symbol)==0)
+			return false;
+		slot=(slot+1)&(AssemblerSymbolTableSize-1);
 	}
 
-	return -1;
+	// Add entry
+	AssemblerSymbol *entry=&program->symbols[program->symbolsNext];
+	entry->symbol=symbol;
+	entry->type=type;
+	entry->instructionIndex=instructionIndex;
+	entry->value=value;
+	program->symbolTable[slot]=program->symbolsNext++;
+
+	return true;
 }
 
-int assemblerGetDefineSymbolAddr(const AssemblerProgram *program, const char *symbol) {
+const AssemblerSymbol *assemblerProgramGetSymbol(const AssemblerProgram *program, const char *symbol) {
 	assert(program!=NULL);
 	assert(symbol!=NULL);
 
-	int index=assemblerGetDefineSymbolInstructionIndex(program, symbol);
-	if (index==-1)
-		return -1;
+	// Linear probe from hashed slot until we find a match or an empty slot
+	uint32_t slot=assemblerSymbolHash(symbol)&(AssemblerSymbolTableSize-1);
+	while(program->symbolTable[slot]!=AssemblerSymbolTableEmpty) {
+		const AssemblerSymbol *entry=&program->symbols[program->symbolTable[slot]];
+		if (strcmp(entry->symbol, symbol)==0)
+			return entry;
+		slot=(slot+1)&(AssemblerSymbolTableSize-1);
+	}
+
+	return NULL;
+}
 
-	// If we are not pointing into another define's data, then return our own address
-	if (program->instructions[index].d.define.pointerLineIndex==program->instructions[index].lineIndex)
-		return program->instructions[index].machineCodeOffset;
+void assemblerProgramUpdateSymbolInstructionIndexes(AssemblerProgram *program) {
+	assert(program!=NULL);
 
-	// However if we are pointing into another define, return its address instead (with an offset)
 	for(unsigned i=0; i<program->instructionsNext; ++i) {
-		const AssemblerInstruction *loopInstruction=&program->instructions[i];
-		if (loopInstruction->lineIndex==program->instructions[index].d.define.pointerLineIndex) {
-			return loopInstruction->machineCodeOffset+program->instructions[index].d.define.pointerOffset;
+		const AssemblerInstruction *instruction=&program->instructions[i];
+
+		const char *symbol;
+		switch(instruction->type) {
+			case AssemblerInstructionTypeAllocation: symbol=instruction->d.allocation.symbol; break;
+			case AssemblerInstructionTypeDefine: symbol=instruction->d.define.symbol; break;
+			case AssemblerInstructionTypeLabel: symbol=instruction->d.label.symbol; break;
+			case AssemblerInstructionTypeConst: symbol=instruction->d.constSymbol.symbol; break;
+			default: continue; break;
 		}
+
+		AssemblerSymbol *entry=(AssemblerSymbol *)assemblerProgramGetSymbol(program, symbol);
+		assert(entry!=NULL);
+		entry->instructionIndex=i;
+
+		// Defines are always initially pointing to themselves, so keep this consistent
+		if (instruction->type==AssemblerInstructionTypeDefine && instruction->d.define.pointerLineIndex==instruction->lineIndex)
+			program->instructions[i].d.define.pointerInstructionIndex=i;
 	}
-	return -1; // bad pointer
 }
 
-int assemblerGetLabelSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol) {
+void assemblerProgramUpdateSymbolValues(AssemblerProgram *program) {
 	assert(program!=NULL);
-	assert(symbol!=NULL);
 
-	// Search through instructions looking for this symbol being defined
-	for(unsigned i=0; i<program->instructionsNext; ++i) {
-		const AssemblerInstruction *loopInstruction=&program->instructions[i];
-		if (loopInstruction->type==AssemblerInstructionTypeLabel && strcmp(loopInstruction->d.label.symbol, symbol)==0)
-			return i;
+	for(unsigned i=0; i<program->symbolsNext; ++i) {
+		AssemblerSymbol *entry=&program->symbols[i];
+		const AssemblerInstruction *instruction=&program->instructions[entry->instructionIndex];
+		switch(entry->type) {
+			case AssemblerSymbolTypeAllocation:
+				entry->value=instruction->d.allocation.ramOffset;
+			break;
+			case AssemblerSymbolTypeDefine:
+				// If we are not pointing into another define's data, then use our own address, otherwise use its address instead (with an offset)
+				if (instruction->d.define.pointerLineIndex==instruction->lineIndex)
+					entry->value=instruction->machineCodeOffset;
+				else
+					entry->value=program->instructions[instruction->d.define.pointerInstructionIndex].machineCodeOffset+instruction->d.define.pointerOffset;
+			break;
+			case AssemblerSymbolTypeLabel:
+				entry->value=instruction->machineCodeOffset;
+			break;
+			case AssemblerSymbolTypeConst:
+				// Constant values never change once parsed
+			break;
+		}
 	}
+}
 
-	return -1;
+int assemblerGetAllocationSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol) {
+	const AssemblerSymbol *entry=assemblerProgramGetSymbol(program, symbol);
+	return (entry!=NULL && entry->type==AssemblerSymbolTypeAllocation ? entry->instructionIndex : -1);
 }
 
-int assemblerGetLabelSymbolAddr(const AssemblerProgram *program, const char *symbol) {
-	assert(program!=NULL);
-	assert(symbol!=NULL);
+int assemblerGetAllocationSymbolAddr(const AssemblerProgram *program, const char *symbol) {
+	const AssemblerSymbol *entry=assemblerProgramGetSymbol(program, symbol);
+	return (entry!=NULL && entry->type==AssemblerSymbolTypeAllocation ? entry->value : -1);
+}
 
-	int index=assemblerGetLabelSymbolInstructionIndex(program, symbol);
-	if (index==-1)
+int assemblerGetDefineSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol) {
+	const AssemblerSymbol *entry=assemblerProgramGetSymbol(program, symbol);
+	return (entry!=NULL && entry->type==AssemblerSymbolTypeDefine ? entry->instructionIndex : -1);
+}
+
+int assemblerGetDefineSymbolAddr(const AssemblerProgram *program, const char *symbol) {
+	const AssemblerSymbol *entry=assemblerProgramGetSymbol(program, symbol);
+	if (entry==NULL || entry->type!=AssemblerSymbolTypeDefine)
 		return -1;
 
-	return program->instructions[index].machineCodeOffset;
+	// Adjust for savings made earlier in the current pass, if any
+	return (entry->instructionIndex>program->passInstructionIndex ? entry->value-program->passSavedBytes : entry->value);
 }
 
-int assemblerGetConstSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol) {
-	assert(program!=NULL);
-	assert(symbol!=NULL);
+int assemblerGetLabelSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol) {
+	const AssemblerSymbol *entry=assemblerProgramGetSymbol(program, symbol);
+	return (entry!=NULL && entry->type==AssemblerSymbolTypeLabel ? entry->instructionIndex : -1);
+}
 
-	// Search through instructions looking for this symbol being defined
-	for(unsigned i=0; i<program->instructionsNext; ++i) {
-		const AssemblerInstruction *loopInstruction=&program->instructions[i];
-		if (loopInstruction->type==AssemblerInstructionTypeConst && strcmp(loopInstruction->d.constSymbol.symbol, symbol)==0)
-			return i;
-	}
+int assemblerGetLabelSymbolAddr(const AssemblerProgram *program, const char *symbol) {
+	const AssemblerSymbol *entry=assemblerProgramGetSymbol(program, symbol);
+	if (entry==NULL || entry->type!=AssemblerSymbolTypeLabel)
+		return -1;
 
-	return -1;
+	// Adjust for savings made earlier in the current pass, if any
+	return (entry->instructionIndex>program->passInstructionIndex ? entry->value-program->passSavedBytes : entry->value);
 }
 
-int assemblerGetConstSymbolValue(const AssemblerProgram *program, const char *symbol) {
-	assert(program!=NULL);
-	assert(symbol!=NULL);
-
-	int index=assemblerGetConstSymbolInstructionIndex(program, symbol);
-	if (index==-1)
-		return -1;
+int assemblerGetConstSymbolInstructionIndex(const AssemblerProgram *program, const char *symbol) {
+	const AssemblerSymbol *entry=assemblerProgramGetSymbol(program, symbol);
+	return (entry!=NULL && entry->type==AssemblerSymbolTypeConst ? entry->instructionIndex : -1);
+}
 
-	return program->instructions[index].d.constSymbol.value;
+int assemblerGetConstSymbolValue(const AssemblerProgram *program, const char *symbol) {
+	const AssemblerSymbol *entry=assemblerProgramGetSymbol(program, symbol);
+	return (entry!=NULL && entry->type==AssemblerSymbolTypeConst ? entry->value : -1);
 }
 
 BytecodeRegister assemblerRegisterFromStr(const char *str) {
@@ -2396,9 +3306,486 @@ BytecodeRegister assemblerRegisterFromStr(const char *str) {
 		return str[1]-'0';
 }
 
+bool assemblerInstructionAluMemoryTypeIsDisp(BytecodeInstructionAluMemoryType type) {
+	return (type==BytecodeInstructionAluMemoryTypeLoad8Disp || type==BytecodeInstructionAluMemoryTypeStore8Disp || type==BytecodeInstructionAluMemoryTypeLoad16Disp || type==BytecodeInstructionAluMemoryTypeStore16Disp);
+}
+
+void assemblerInstructionGetRegisterUsage(const AssemblerInstruction *instruction, uint8_t *readMask, uint8_t *writeMask) {
+	assert(instruction!=NULL);
+	assert(readMask!=NULL);
+	assert(writeMask!=NULL);
+
+	// Note: invalid register strings give a mask of 0 - these are reported as errors later.
+	#define REGMASK(str) (assemblerRegisterFromStr(str)<BytecodeRegisterNB ? (1u<<assemblerRegisterFromStr(str)) : 0u)
+	const uint8_t allMask=0xFF, spMask=(1u<<BytecodeRegisterSP), ipMask=(1u<<BytecodeRegisterIP);
+
+	*readMask=0;
+	*writeMask=0;
+	switch(instruction->type) {
+		case AssemblerInstructionTypeAllocation:
+		case AssemblerInstructionTypeDefine:
+		case AssemblerInstructionTypeConst:
+		case AssemblerInstructionTypeClearInstructionCache:
+		case AssemblerInstructionTypeNop:
+		break;
+		case AssemblerInstructionTypeMov:
+			*readMask=REGMASK(instruction->d.mov.src);
+			*writeMask=REGMASK(instruction->d.mov.dest);
+		break;
+		case AssemblerInstructionTypeLabel:
+			// Could be jumped to from anywhere
+			*readMask=allMask;
+			*writeMask=allMask;
+		break;
+		case AssemblerInstructionTypeSyscall:
+			// Arguments are passed in r1 upwards, with only r0 being modified on return
+			*readMask=allMask;
+			*writeMask=(1u<<0);
+		break;
+		case AssemblerInstructionTypeDebug:
+			*readMask=allMask;
+		break;
+		case AssemblerInstructionTypeAlu:
+			switch(instruction->d.alu.type) {
+				case BytecodeInstructionAluTypeInc:
+				case BytecodeInstructionAluTypeDec:
+					*readMask=REGMASK(instruction->d.alu.dest);
+					*writeMask=REGMASK(instruction->d.alu.dest);
+				break;
+				case BytecodeInstructionAluTypeSkip:
+					*readMask=REGMASK(instruction->d.alu.dest);
+				break;
+				case BytecodeInstructionAluTypeExtra:
+					switch(instruction->d.alu.extraType) {
+						case BytecodeInstructionAluExtraTypeNot:
+						case BytecodeInstructionAluExtraTypeLoad16:
+							*readMask=REGMASK(instruction->d.alu.opA);
+							*writeMask=REGMASK(instruction->d.alu.dest);
+						break;
+						case BytecodeInstructionAluExtraTypeStore16:
+							*readMask=REGMASK(instruction->d.alu.dest)|REGMASK(instruction->d.alu.opA);
+						break;
+						case BytecodeInstructionAluExtraTypePush16:
+							*readMask=REGMASK(instruction->d.alu.dest)|spMask;
+							*writeMask=spMask;
+						break;
+						case BytecodeInstructionAluExtraTypePop16:
+							*readMask=spMask;
+							*writeMask=REGMASK(instruction->d.alu.dest)|spMask;
+						break;
+						default:
+							*readMask=allMask;
+							*writeMask=allMask;
+						break;
+					}
+				break;
+				case BytecodeInstructionAluTypeInt32:
+					// Only memory is modified, except for cmp32 which overwrites the dest register with the result
+					*readMask=REGMASK(instruction->d.alu.dest)|REGMASK(instruction->d.alu.opA);
+					if (instruction->d.alu.int32Type==BytecodeInstructionAluInt32TypeCmp)
+						*writeMask=REGMASK(instruction->d.alu.dest);
+				break;
+				case BytecodeInstructionAluTypeMemory:
+					switch(instruction->d.alu.memoryType) {
+						case BytecodeInstructionAluMemoryTypeLoad8Disp:
+						case BytecodeInstructionAluMemoryTypeLoad16Disp:
+							*readMask=REGMASK(instruction->d.alu.opA);
+							*writeMask=REGMASK(instruction->d.alu.dest);
+						break;
+						case BytecodeInstructionAluMemoryTypeStore8Disp:
+						case BytecodeInstructionAluMemoryTypeStore16Disp:
+							*readMask=REGMASK(instruction->d.alu.dest)|REGMASK(instruction->d.alu.opA);
+						break;
+						default:
+							// Block instructions advance all three registers as they go
+							*readMask=REGMASK(instruction->d.alu.dest)|REGMASK(instruction->d.alu.opA)|REGMASK(instruction->d.alu.opB);
+							*writeMask=*readMask;
+						break;
+					}
+				break;
+				default:
+					*readMask=REGMASK(instruction->d.alu.opA)|REGMASK(instruction->d.alu.opB);
+					*writeMask=REGMASK(instruction->d.alu.dest);
+				break;
+			}
+		break;
+		case AssemblerInstructionTypeJmp:
+			*writeMask=ipMask;
+		break;
+		case AssemblerInstructionTypePush8:
+			*readMask=REGMASK(instruction->d.push8.src)|spMask;
+			*writeMask=spMask;
+		break;
+		case AssemblerInstructionTypePop8:
+			*readMask=spMask;
+			*writeMask=REGMASK(instruction->d.pop8.dest)|spMask;
+		break;
+		case AssemblerInstructionTypeCall:
+			// Scratch register is overwritten with the function address before jumping, so is never read by the function
+			*readMask=allMask&~(1u<<BytecodeRegisterS);
+			*writeMask=allMask;
+		break;
+		case AssemblerInstructionTypeRet:
+			*readMask=allMask;
+			*writeMask=allMask;
+		break;
+		case AssemblerInstructionTypeStore8:
+			*readMask=REGMASK(instruction->d.store8.dest)|REGMASK(instruction->d.store8.src);
+		break;
+		case AssemblerInstructionTypeLoad8:
+			*readMask=REGMASK(instruction->d.load8.src);
+			*writeMask=REGMASK(instruction->d.load8.dest);
+		break;
+		case AssemblerInstructionTypeXchg8:
+			*readMask=REGMASK(instruction->d.xchg8.addrReg)|REGMASK(instruction->d.xchg8.srcDestReg);
+			*writeMask=REGMASK(instruction->d.xchg8.srcDestReg);
+		break;
+		case AssemblerInstructionTypeClz:
+			*readMask=REGMASK(instruction->d.clz.srcReg);
+			*writeMask=REGMASK(instruction->d.clz.destReg);
+		break;
+	}
+	#undef REGMASK
+}
+
+bool assemblerInstructionIsSkip(const AssemblerInstruction *instruction) {
+	assert(instruction!=NULL);
+	return (instruction->type==AssemblerInstructionTypeAlu && instruction->d.alu.type==BytecodeInstructionAluTypeSkip);
+}
+
+bool assemblerInstructionIsAluExtra(const AssemblerInstruction *instruction, BytecodeInstructionAluExtraType extraType) {
+	assert(instruction!=NULL);
+	return (instruction->type==AssemblerInstructionTypeAlu && instruction->d.alu.type==BytecodeInstructionAluTypeExtra && instruction->d.alu.extraType==extraType);
+}
+
+void assemblerInstructionSetMov(AssemblerInstruction *instruction, BytecodeRegister destReg, BytecodeRegister srcReg) {
+	assert(instruction!=NULL);
+	assert(destReg<BytecodeRegisterNB);
+	assert(srcReg<BytecodeRegisterNB);
+
+	instruction->type=AssemblerInstructionTypeMov;
+	instruction->d.mov.dest=assemblerRegisterNames[destReg];
+	instruction->d.mov.src=assemblerRegisterNames[srcReg];
+}
+
+void assemblerInstructionSetIncDec(AssemblerInstruction *instruction, BytecodeRegister destReg, int delta) {
+	assert(instruction!=NULL);
+	assert(destReg<BytecodeRegisterNB);
+	assert(delta!=0 && delta>=-64 && delta<=64);
+
+	instruction->type=AssemblerInstructionTypeAlu;
+	instruction->d.alu.type=(delta>0 ? BytecodeInstructionAluTypeInc : BytecodeInstructionAluTypeDec);
+	instruction->d.alu.dest=assemblerRegisterNames[destReg];
+	instruction->d.alu.opA=NULL;
+	instruction->d.alu.opB=NULL;
+	instruction->d.alu.skipBit=0;
+	instruction->d.alu.incDecValue=(delta>0 ? delta : -delta);
+	instruction->d.alu.extraType=0;
+	instruction->d.alu.int32Type=0;
+	instruction->d.alu.memoryType=0;
+	instruction->d.alu.displacement=0;
+}
+
+void assemblerInstructionSetAluMemoryDisp(AssemblerInstruction *instruction, BytecodeInstructionAluMemoryType type, BytecodeRegister destReg, BytecodeRegister opAReg, int displacement) {
+	assert(instruction!=NULL);
+	assert(assemblerInstructionAluMemoryTypeIsDisp(type));
+	assert(destReg<BytecodeRegisterNB);
+	assert(opAReg<BytecodeRegisterNB);
+	assert(displacement>=INT8_MIN && displacement<=INT8_MAX);
+
+	instruction->type=AssemblerInstructionTypeAlu;
+	instruction->d.alu.type=BytecodeInstructionAluTypeMemory;
+	instruction->d.alu.dest=assemblerRegisterNames[destReg];
+	instruction->d.alu.opA=assemblerRegisterNames[opAReg];
+	instruction->d.alu.opB=NULL;
+	instruction->d.alu.skipBit=0;
+	instruction->d.alu.incDecValue=0;
+	instruction->d.alu.extraType=0;
+	instruction->d.alu.int32Type=0;
+	instruction->d.alu.memoryType=type;
+	instruction->d.alu.displacement=displacement;
+}
+
+void assemblerRegisterStatesReset(AssemblerRegisterState *regs) {
+	assert(regs!=NULL);
+
+	for(BytecodeRegister reg=0; reg<BytecodeRegisterNB; ++reg) {
+		regs[reg].value=-1;
+		regs[reg].symbol=NULL;
+	}
+}
+
+bool assemblerRegisterStateEqual(const AssemblerRegisterState *a, const AssemblerRegisterState *b) {
+	assert(a!=NULL);
+	assert(b!=NULL);
+
+	if (a->value>=0 && a->value==b->value)
+		return true;
+	if (a->symbol!=NULL && b->symbol!=NULL && strcmp(a->symbol, b->symbol)==0)
+		return true;
+	return false;
+}
+
 bool assemblerProgramAddIncludeDir(AssemblerProgram *program, const char *dir) {
 	if (program->assemblerIncludeDirsNext>=AssemblerIncludeDirMax)
 		return false;
 	strcpy(program->assemblerIncludeDirs[program->assemblerIncludeDirsNext++], dir);
 	return true;
 }
+
+const AssemblerIncludeCacheEntry *assemblerIncludeCacheGet(const char *path) {
+	assert(path!=NULL);
+
+	// Already cached?
+	pthread_mutex_lock(&assemblerIncludeCache.mutex);
+	AssemblerIncludeCacheEntry *entry=assemblerIncludeCacheFind(path);
+	pthread_mutex_unlock(&assemblerIncludeCache.mutex);
+	if (entry!=NULL)
+		return entry;
+
+	// Create new entry, reading without holding the lock so that other threads are not held up by our I/O
+	entry=malloc(sizeof(AssemblerIncludeCacheEntry));
+	if (entry==NULL)
+		return NULL;
+	entry->path=malloc(strlen(path)+1);
+	if (entry->path==NULL) {
+		free(entry);
+		return NULL;
+	}
+	strcpy(entry->path, path);
+	entry->lines=NULL;
+	entry->linesNext=0;
+
+	// Try on-disk cache first if enabled, falling back to reading the file itself
+	char cachePath[1024];
+	struct stat fileStat;
+	bool useDisk=(assemblerIncludeCache.dir!=NULL && stat(path, &fileStat)==0);
+	if (useDisk)
+		sprintf(cachePath, "%s/%08X.asmcache", assemblerIncludeCache.dir, assemblerSymbolHash(path));
+
+	if (!useDisk || !assemblerIncludeCacheReadDisk(entry, cachePath, &fileStat)) {
+		if (!assemblerIncludeCacheReadFile(entry)) {
+			assemblerIncludeCacheEntryFree(entry);
+			return NULL;
+		}
+
+		if (useDisk)
+			assemblerIncludeCacheWriteDisk(entry, cachePath, &fileStat);
+	}
+
+	// Publish entry, unless another thread read the same file in the meantime (in which case use theirs)
+	pthread_mutex_lock(&assemblerIncludeCache.mutex);
+
+	AssemblerIncludeCacheEntry *existingEntry=assemblerIncludeCacheFind(path);
+	if (existingEntry!=NULL) {
+		assemblerIncludeCacheEntryFree(entry);
+		entry=existingEntry;
+		goto done;
+	}
+
+	AssemblerIncludeCacheEntry **newEntries=realloc(assemblerIncludeCache.entries, sizeof(AssemblerIncludeCacheEntry *)*(assemblerIncludeCache.entriesNext+1));
+	if (newEntries==NULL) {
+		assemblerIncludeCacheEntryFree(entry);
+		entry=NULL;
+		goto done;
+	}
+	assemblerIncludeCache.entries=newEntries;
+	assemblerIncludeCache.entries[assemblerIncludeCache.entriesNext++]=entry;
+
+	done:
+	pthread_mutex_unlock(&assemblerIncludeCache.mutex);
+
+	return entry;
+}
+
+AssemblerIncludeCacheEntry *assemblerIncludeCacheFind(const char *path) {
+	assert(path!=NULL);
+
+	for(size_t i=0; i<assemblerIncludeCache.entriesNext; ++i)
+		if (strcmp(assemblerIncludeCache.entries[i]->path, path)==0)
+			return assemblerIncludeCache.entries[i];
+
+	return NULL;
+}
+
+bool assemblerIncludeCacheReadFile(AssemblerIncludeCacheEntry *entry) {
+	assert(entry!=NULL);
+
+	// Open input file
+	FILE *file=fopen(entry->path, "r");
+	if (file==NULL) {
+		printf("Could not open input file '%s' for reading\n", entry->path);
+		return false;
+	}
+
+	// Read file line-by-line
+	bool result=false;
+	char *line=NULL;
+	size_t lineSize=0;
+	size_t linesSize=0;
+	while(getline(&line, &lineSize, file)>0) {
+		// Trim trailing newline
+		if (line[strlen(line)-1]=='\n')
+			line[strlen(line)-1]='\0';
+
+		// Make space if needed
+		if (entry->linesNext>=linesSize) {
+			size_t newLinesSize=(linesSize>0 ? linesSize*2 : 64);
+			AssemblerLine *newLines=realloc(entry->lines, sizeof(AssemblerLine)*newLinesSize);
+			if (newLines==NULL) {
+				printf("Could not allocate memory reading input file '%s'\n", entry->path);
+				goto done;
+			}
+			entry->lines=newLines;
+			linesSize=newLinesSize;
+		}
+
+		// Create structure to represent this line
+		AssemblerLine *assemblerLine=&entry->lines[entry->linesNext];
+		assemblerLine->lineNum=entry->linesNext+1;
+		assemblerLine->file=entry->path;
+		assemblerLine->original=malloc(strlen(line)+1);
+		assemblerLine->modified=malloc(strlen(line)+1);
+		if (assemblerLine->original==NULL || assemblerLine->modified==NULL) {
+			free(assemblerLine->original);
+			free(assemblerLine->modified);
+			printf("Could not allocate memory reading input file '%s'\n", entry->path);
+			goto done;
+		}
+		strcpy(assemblerLine->original, line);
+		strcpy(assemblerLine->modified, line);
+		++entry->linesNext;
+
+		// Preprocess (strip whitespace, comments, etc)
+		while(assemblerLinePreprocess(assemblerLine))
+			;
+	}
+
+	result=true;
+
+	done:
+	if (!result) {
+		// Discard anything we did manage to read
+		for(size_t i=0; i<entry->linesNext; ++i) {
+			free(entry->lines[i].original);
+			free(entry->lines[i].modified);
+		}
+		free(entry->lines);
+		entry->lines=NULL;
+		entry->linesNext=0;
+	}
+	free(line);
+	fclose(file);
+
+	return result;
+}
+
+bool assemblerIncludeCacheReadDisk(AssemblerIncludeCacheEntry *entry, const char *cachePath, const struct stat *fileStat) {
+	assert(entry!=NULL);
+	assert(cachePath!=NULL);
+	assert(fileStat!=NULL);
+
+	FILE *file=fopen(cachePath, "r");
+	if (file==NULL)
+		return false;
+
+	bool result=false;
+	char *line=NULL;
+	size_t lineSize=0;
+	ssize_t lineLen;
+
+	// Check header matches source file (same path, modification time and size)
+	long long mtimeSec, mtimeNsec, size;
+	size_t linesCount;
+	if (getline(&line, &lineSize, file)<=0 || strcmp(line, "aosf-asm cache 1\n")!=0)
+		goto done;
+	if ((lineLen=getline(&line, &lineSize, file))<=0 || strncmp(line, entry->path, lineLen-1)!=0 || entry->path[lineLen-1]!='\0')
+		goto done;
+	if (fscanf(file, "%lld %lld %lld %zu\n", &mtimeSec, &mtimeNsec, &size, &linesCount)!=4)
+		goto done;
+	if (mtimeSec!=fileStat->st_mtim.tv_sec || mtimeNsec!=fileStat->st_mtim.tv_nsec || size!=fileStat->st_size)
+		goto done;
+
+	// Read original and modified lines in pairs
+	entry->lines=malloc(sizeof(AssemblerLine)*(linesCount>0 ? linesCount : 1));
+	if (entry->lines==NULL)
+		goto done;
+	for(entry->linesNext=0; entry->linesNext<linesCount; ++entry->linesNext) {
+		AssemblerLine *assemblerLine=&entry->lines[entry->linesNext];
+		assemblerLine->lineNum=entry->linesNext+1;
+		assemblerLine->file=entry->path;
+
+		char **strs[2]={&assemblerLine->original, &assemblerLine->modified};
+		for(unsigned j=0; j<2; ++j) {
+			if ((lineLen=getline(&line, &lineSize, file))<=0 || line[lineLen-1]!='\n') {
+				if (j==1)
+					free(assemblerLine->original);
+				goto done;
+			}
+			line[lineLen-1]='\0';
+			*strs[j]=malloc(lineLen);
+			strcpy(*strs[j], line);
+		}
+	}
+
+	result=true;
+
+	done:
+	if (!result) {
+		// Discard anything we did manage to read
+		for(size_t i=0; i<entry->linesNext; ++i) {
+			free(entry->lines[i].original);
+			free(entry->lines[i].modified);
+		}
+		free(entry->lines);
+		entry->lines=NULL;
+		entry->linesNext=0;
+	}
+	free(line);
+	fclose(file);
+
+	return result;
+}
+
+void assemblerIncludeCacheWriteDisk(const AssemblerIncludeCacheEntry *entry, const char *cachePath, const struct stat *fileStat) {
+	assert(entry!=NULL);
+	assert(cachePath!=NULL);
+	assert(fileStat!=NULL);
+
+	// Write to a temporary file first and then rename, so that concurrent assembler processes (or threads) never see partial files
+	char tempPath[1024];
+	sprintf(tempPath, "%s.%i.%lx.tmp", cachePath, (int)getpid(), (unsigned long)pthread_self());
+
+	FILE *file=fopen(tempPath, "w");
+	if (file==NULL) {
+		printf("warning - could not write include cache file '%s'\n", tempPath);
+		return;
+	}
+
+	fprintf(file, "aosf-asm cache 1\n%s\n%lld %lld %lld %zu\n", entry->path, (long long)fileStat->st_mtim.tv_sec, (long long)fileStat->st_mtim.tv_nsec, (long long)fileStat->st_size, entry->linesNext);
+	for(size_t i=0; i<entry->linesNext; ++i)
+		fprintf(file, "%s\n%s\n", entry->lines[i].original, entry->lines[i].modified);
+
+	if (fclose(file)!=0 || rename(tempPath, cachePath)!=0)
+		remove(tempPath);
+}
+
+void assemblerIncludeCacheFree(void) {
+	for(size_t i=0; i<assemblerIncludeCache.entriesNext; ++i)
+		assemblerIncludeCacheEntryFree(assemblerIncludeCache.entries[i]);
+	free(assemblerIncludeCache.entries);
+	assemblerIncludeCache.entries=NULL;
+	assemblerIncludeCache.entriesNext=0;
+}
+
+void assemblerIncludeCacheEntryFree(AssemblerIncludeCacheEntry *entry) {
+	assert(entry!=NULL);
+
+	for(size_t i=0; i<entry->linesNext; ++i) {
+		free(entry->lines[i].original);
+		free(entry->lines[i].modified);
+	}
+	free(entry->lines);
+	free(entry->path);
+	free(entry);
+}
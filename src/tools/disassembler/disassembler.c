@@ -160,6 +160,62 @@ int main(int argc, char **argv) {
 							break;
 						}
 					} break;
+					case BytecodeInstructionAluTypeInt32: {
+						switch((BytecodeInstructionAluInt32Type)info.d.alu.opBReg) {
+							case BytecodeInstructionAluInt32TypeAdd16:
+								disassemblerPrint(addr, instruction, "[r%u]+=r%u (32 bit)", info.d.alu.destReg, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluInt32TypeAdd32:
+								disassemblerPrint(addr, instruction, "[r%u]+=[r%u] (32 bit)", info.d.alu.destReg, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluInt32TypeSub16:
+								disassemblerPrint(addr, instruction, "[r%u]-=r%u (32 bit)", info.d.alu.destReg, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluInt32TypeSub32:
+								disassemblerPrint(addr, instruction, "[r%u]-=[r%u] (32 bit)", info.d.alu.destReg, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluInt32TypeMul16:
+								disassemblerPrint(addr, instruction, "[r%u]*=r%u (32 bit)", info.d.alu.destReg, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluInt32TypeMul32:
+								disassemblerPrint(addr, instruction, "[r%u]*=[r%u] (32 bit)", info.d.alu.destReg, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluInt32TypeShift:
+								disassemblerPrint(addr, instruction, "[r%u]<<=r%u (32 bit, signed shift)", info.d.alu.destReg, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluInt32TypeCmp:
+								disassemblerPrint(addr, instruction, "r%u=cmp([r%u], [r%u]) (32 bit)", info.d.alu.destReg, info.d.alu.destReg, info.d.alu.opAReg);
+							break;
+							default:
+								disassemblerPrint(addr, instruction, "unknown ALU int32 operation (type %u)", info.d.alu.opBReg);
+							break;
+						}
+					} break;
+					case BytecodeInstructionAluTypeMemory: {
+						switch(info.d.alu.opBReg) {
+							case BytecodeInstructionAluMemoryTypeLoad8Disp:
+								disassemblerPrint(addr, instruction, "r%u=[r%u%+d] (8 bit)", info.d.alu.destReg, info.d.alu.opAReg, info.d.alu.displacement);
+							break;
+							case BytecodeInstructionAluMemoryTypeStore8Disp:
+								disassemblerPrint(addr, instruction, "[r%u%+d]=r%u (8 bit)", info.d.alu.destReg, info.d.alu.displacement, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluMemoryTypeLoad16Disp:
+								disassemblerPrint(addr, instruction, "r%u=[r%u%+d] (16 bit)", info.d.alu.destReg, info.d.alu.opAReg, info.d.alu.displacement);
+							break;
+							case BytecodeInstructionAluMemoryTypeStore16Disp:
+								disassemblerPrint(addr, instruction, "[r%u%+d]=r%u (16 bit)", info.d.alu.destReg, info.d.alu.displacement, info.d.alu.opAReg);
+							break;
+							case BytecodeInstructionAluMemoryTypeCopyBlock:
+								disassemblerPrint(addr, instruction, "copyblock [r%u] [r%u] r%u", info.d.alu.destReg, info.d.alu.opAReg, info.d.alu.lenReg);
+							break;
+							case BytecodeInstructionAluMemoryTypeFillBlock:
+								disassemblerPrint(addr, instruction, "fillblock [r%u] r%u r%u", info.d.alu.destReg, info.d.alu.opAReg, info.d.alu.lenReg);
+							break;
+							default:
+								disassemblerPrint(addr, instruction, "unknown ALU memory operation (type %u)", info.d.alu.opBReg);
+							break;
+						}
+					} break;
 					default:
 						disassemblerPrint(addr, instruction, "unknown ALU operation");
 					break;
@@ -16,6 +16,8 @@
 #define FdStdin 1
 #define FdStdout 2
 
+#define EmulatorBlockChunkSize 64 // matches kernel so copyblock/fillblock re-execute the same number of times
+
 typedef struct {
 	int argc;
 
@@ -40,6 +42,7 @@ Process *process=NULL;
 bool infoSyscalls=false;
 bool infoInstructions=false;
 bool infoState=false;
+bool infoCount=false;
 bool slow=false;
 bool passOnExitStatus=false;
 int exitStatus=EXIT_SUCCESS;
@@ -60,7 +63,7 @@ int main(int argc, char **argv) {
 
 	// Parse arguments
 	if (argc<2) {
-		printf("Usage: %s [--infosyscalls] [--infoinstructions] [--infostate] [--slow] [--passonexitstatus] inputfile [inputargs ...]\n", argv[0]);
+		printf("Usage: %s [--infosyscalls] [--infoinstructions] [--infostate] [--infocount] [--slow] [--passonexitstatus] inputfile [inputargs ...]\n", argv[0]);
 		goto done;
 	}
 
@@ -74,6 +77,8 @@ int main(int argc, char **argv) {
 			infoInstructions=true;
 		else if (strcmp(argv[i], "--infostate")==0)
 			infoState=true;
+		else if (strcmp(argv[i], "--infocount")==0)
+			infoCount=true;
 		else if (strcmp(argv[i], "--passonexitstatus")==0)
 			passOnExitStatus=true;
 		else if (strcmp(argv[i], "--slow")==0)
@@ -156,6 +161,9 @@ int main(int argc, char **argv) {
 			processDebug(process);
 	} while(processRunNextInstruction(process));
 
+	if (infoCount)
+		printf("Info: instruction count %u\n", process->instructionCount);
+
 	// Done
 	done:
 	if (inputFile!=NULL && strcmp(inputPath, "-")!=0)
@@ -383,7 +391,161 @@ bool processRunNextInstruction(Process *process) {
 							return false;
 						break;
 					}
-				}
+				} break;
+				case BytecodeInstructionAluTypeInt32: {
+					BytecodeInstructionAluInt32Type int32Type=info.d.alu.opBReg;
+					BytecodeWord destAddr=process->regs[info.d.alu.destReg];
+					if (destAddr>=BytecodeMemoryTotalSize-3) {
+						printf("Error: int32 instruction with dest-ptr partially beyond end of memory (destAddr=%u), exiting\n", destAddr);
+						return false;
+					}
+					BytecodeDoubleWord destValue=(((BytecodeDoubleWord)process->memory[destAddr+0])<<24)|
+					                             (((BytecodeDoubleWord)process->memory[destAddr+1])<<16)|
+					                             (((BytecodeDoubleWord)process->memory[destAddr+2])<<8)|
+					                             (((BytecodeDoubleWord)process->memory[destAddr+3])<<0);
+
+					// Second operand is either a pointer to another 32 bit value or a plain 16 bit value
+					BytecodeDoubleWord srcValue=(BytecodeWord)opA;
+					if (int32Type==BytecodeInstructionAluInt32TypeAdd32 || int32Type==BytecodeInstructionAluInt32TypeSub32 || int32Type==BytecodeInstructionAluInt32TypeMul32 || int32Type==BytecodeInstructionAluInt32TypeCmp) {
+						BytecodeWord srcAddr=opA;
+						if (srcAddr>=BytecodeMemoryTotalSize-3) {
+							printf("Error: int32 instruction with src-ptr partially beyond end of memory (srcAddr=%u), exiting\n", srcAddr);
+							return false;
+						}
+						srcValue=(((BytecodeDoubleWord)process->memory[srcAddr+0])<<24)|
+						         (((BytecodeDoubleWord)process->memory[srcAddr+1])<<16)|
+						         (((BytecodeDoubleWord)process->memory[srcAddr+2])<<8)|
+						         (((BytecodeDoubleWord)process->memory[srcAddr+3])<<0);
+					}
+
+					BytecodeDoubleWord result=destValue;
+					switch(int32Type) {
+						case BytecodeInstructionAluInt32TypeAdd16:
+						case BytecodeInstructionAluInt32TypeAdd32:
+							result=destValue+srcValue;
+						break;
+						case BytecodeInstructionAluInt32TypeSub16:
+						case BytecodeInstructionAluInt32TypeSub32:
+							result=destValue-srcValue;
+						break;
+						case BytecodeInstructionAluInt32TypeMul16:
+						case BytecodeInstructionAluInt32TypeMul32:
+							result=destValue*srcValue;
+						break;
+						case BytecodeInstructionAluInt32TypeShift: {
+							int16_t shift=(int16_t)opA;
+							if (shift>=0)
+								result=(shift<32 ? destValue<<shift : 0);
+							else
+								result=(shift>-32 ? destValue>>(-shift) : 0);
+						} break;
+						case BytecodeInstructionAluInt32TypeCmp: {
+							BytecodeWord *d=&process->regs[info.d.alu.destReg];
+							*d=0;
+							*d|=(destValue==srcValue)<<BytecodeInstructionAluCmpBitEqual;
+							*d|=(destValue==0)<<BytecodeInstructionAluCmpBitEqualZero;
+							*d|=(destValue!=srcValue)<<BytecodeInstructionAluCmpBitNotEqual;
+							*d|=(destValue!=0)<<BytecodeInstructionAluCmpBitNotEqualZero;
+							*d|=(destValue<srcValue)<<BytecodeInstructionAluCmpBitLessThan;
+							*d|=(destValue<=srcValue)<<BytecodeInstructionAluCmpBitLessEqual;
+							*d|=(destValue>srcValue)<<BytecodeInstructionAluCmpBitGreaterThan;
+							*d|=(destValue>=srcValue)<<BytecodeInstructionAluCmpBitGreaterEqual;
+
+							if (infoInstructions)
+								printf("Info: r%i=cmp32(*r%i,*r%i) (=cmp(%u,%u)=%i)\n", info.d.alu.destReg, info.d.alu.destReg, info.d.alu.opAReg, destValue, srcValue, *d);
+						} break;
+						default:
+							printf("Error: Unknown alu int32 instruction with type %i\n", int32Type);
+							return false;
+						break;
+					}
+
+					if (int32Type!=BytecodeInstructionAluInt32TypeCmp) {
+						if (destAddr<BytecodeMemoryRamAddr) {
+							printf("Error: int32 instruction with dest-ptr in read-only region (destAddr=%u), exiting\n", destAddr);
+							return false;
+						}
+						process->memory[destAddr+0]=(result>>24)&255;
+						process->memory[destAddr+1]=(result>>16)&255;
+						process->memory[destAddr+2]=(result>>8)&255;
+						process->memory[destAddr+3]=(result>>0)&255;
+
+						if (infoInstructions)
+							printf("Info: int32 type %i *r%i r%i (=%u op %u=%u)\n", int32Type, info.d.alu.destReg, info.d.alu.opAReg, destValue, srcValue, result);
+					}
+				} break;
+				case BytecodeInstructionAluTypeMemory: {
+					BytecodeInstructionAluMemoryType memoryType=info.d.alu.opBReg;
+					switch(memoryType) {
+						case BytecodeInstructionAluMemoryTypeLoad8Disp: {
+							BytecodeWord srcAddr=opA+info.d.alu.displacement;
+							process->regs[info.d.alu.destReg]=process->memory[srcAddr];
+							if (infoInstructions)
+								printf("Info: r%i=[r%i%+i] (=[%u]=%u)\n", info.d.alu.destReg, info.d.alu.opAReg, info.d.alu.displacement, srcAddr, process->regs[info.d.alu.destReg]);
+						} break;
+						case BytecodeInstructionAluMemoryTypeStore8Disp: {
+							BytecodeWord destAddr=process->regs[info.d.alu.destReg]+info.d.alu.displacement;
+							if (destAddr<BytecodeMemoryRamAddr) {
+								printf("Error: store8 (displacement) with address pointing into read-only region.\n");
+								return false;
+							}
+							process->memory[destAddr]=opA;
+							if (infoInstructions)
+								printf("Info: [r%i%+i]=r%i ([%u]=%u)\n", info.d.alu.destReg, info.d.alu.displacement, info.d.alu.opAReg, destAddr, opA);
+						} break;
+						case BytecodeInstructionAluMemoryTypeLoad16Disp: {
+							BytecodeWord srcAddr=opA+info.d.alu.displacement;
+							process->regs[info.d.alu.destReg]=(((BytecodeWord)process->memory[srcAddr])<<8)|process->memory[(BytecodeWord)(srcAddr+1)];
+							if (infoInstructions)
+								printf("Info: r%i=[r%i%+i] (16 bit) (=[%u]=%u)\n", info.d.alu.destReg, info.d.alu.opAReg, info.d.alu.displacement, srcAddr, process->regs[info.d.alu.destReg]);
+						} break;
+						case BytecodeInstructionAluMemoryTypeStore16Disp: {
+							BytecodeWord destAddr=process->regs[info.d.alu.destReg]+info.d.alu.displacement;
+							if (destAddr<BytecodeMemoryRamAddr) {
+								printf("Error: store16 (displacement) with address pointing into read-only region.\n");
+								return false;
+							}
+							process->memory[destAddr]=(opA>>8);
+							process->memory[(BytecodeWord)(destAddr+1)]=(opA&0xFF);
+							if (infoInstructions)
+								printf("Info: [r%i%+i]=r%i (16 bit) ([%u]=%u)\n", info.d.alu.destReg, info.d.alu.displacement, info.d.alu.opAReg, destAddr, opA);
+						} break;
+						case BytecodeInstructionAluMemoryTypeCopyBlock:
+						case BytecodeInstructionAluMemoryTypeFillBlock: {
+							// Process a single chunk, rewinding to repeat the instruction if more remains (as the kernel does)
+							BytecodeWord destAddr=process->regs[info.d.alu.destReg];
+							BytecodeWord len=process->regs[info.d.alu.lenReg];
+							BytecodeWord chunkSize=(len<EmulatorBlockChunkSize ? len : EmulatorBlockChunkSize);
+							if (chunkSize>0 && (destAddr<BytecodeMemoryRamAddr || destAddr+chunkSize>BytecodeMemoryTotalSize)) {
+								printf("Error: copyblock/fillblock with dest region outside of writable memory (destAddr=%u, len=%u).\n", destAddr, chunkSize);
+								return false;
+							}
+
+							if (memoryType==BytecodeInstructionAluMemoryTypeCopyBlock) {
+								BytecodeWord srcAddr=opA;
+								if (srcAddr+chunkSize>BytecodeMemoryTotalSize) {
+									printf("Error: copyblock with src region beyond end of memory (srcAddr=%u, len=%u).\n", srcAddr, chunkSize);
+									return false;
+								}
+								memmove(process->memory+destAddr, process->memory+srcAddr, chunkSize);
+								process->regs[info.d.alu.opAReg]+=chunkSize;
+							} else
+								memset(process->memory+destAddr, opA, chunkSize);
+							process->regs[info.d.alu.destReg]+=chunkSize;
+							process->regs[info.d.alu.lenReg]-=chunkSize;
+
+							if (process->regs[info.d.alu.lenReg]>0)
+								process->regs[BytecodeRegisterIP]=originalIP;
+
+							if (infoInstructions)
+								printf("Info: %s r%i r%i r%i (chunk of %u bytes at %u, %u remaining)\n", (memoryType==BytecodeInstructionAluMemoryTypeCopyBlock ? "copyblock" : "fillblock"), info.d.alu.destReg, info.d.alu.opAReg, info.d.alu.lenReg, chunkSize, destAddr, process->regs[info.d.alu.lenReg]);
+						} break;
+						default:
+							printf("Error: Unknown alu memory instruction with type %i\n", memoryType);
+							return false;
+						break;
+					}
+				} break;
 			}
 		} break;
 		case BytecodeInstructionTypeMisc:
@@ -510,6 +672,27 @@ bool processRunNextInstruction(Process *process) {
 							// This is not implemented - simply return false
 							process->regs[0]=0;
 						break;
+						case BytecodeSyscallIdClone:
+							if (infoSyscalls)
+								printf("Info: syscall(id=%i [clone] (unimplemented)\n", syscallId);
+
+							// The emulator is single-process so simply return error
+							process->regs[0]=ProcManPidMax;
+						break;
+						case BytecodeSyscallIdFutexWait:
+							if (infoSyscalls)
+								printf("Info: syscall(id=%i [futexwait] (unimplemented)\n", syscallId);
+
+							// No other threads can exist to wake us, so return immediately as if woken
+							process->regs[0]=0;
+						break;
+						case BytecodeSyscallIdFutexWake:
+							if (infoSyscalls)
+								printf("Info: syscall(id=%i [futexwake] (unimplemented)\n", syscallId);
+
+							// No other threads can exist to be woken
+							process->regs[0]=0;
+						break;
 						case BytecodeSyscallIdRead:
 							if (process->regs[1]==FdStdin) {
 								ssize_t result=read(STDIN_FILENO, &process->memory[process->regs[3]], process->regs[4]);
@@ -681,6 +864,16 @@ bool processRunNextInstruction(Process *process) {
 								printf("Info: syscall(id=%i [getpathglobal] (unimplemented)\n", syscallId);
 							process->regs[0]=0;
 						} break;
+						case BytecodeSyscallIdDirGetChildNext:
+							if (infoSyscalls)
+								printf("Info: syscall(id=%i [dirgetchildnext] (unimplemented)\n", syscallId);
+							process->regs[0]=0;
+						break;
+						case BytecodeSyscallIdDirGetChildren:
+							if (infoSyscalls)
+								printf("Info: syscall(id=%i [dirgetchildren] (unimplemented)\n", syscallId);
+							process->regs[0]=0;
+						break;
 						case BytecodeSyscallIdEnvGetPwd:
 							process->regs[0]=process->envVars.pwd;
 							if (infoSyscalls)
@@ -804,6 +997,15 @@ bool processRunNextInstruction(Process *process) {
 							if (infoSyscalls)
 								printf("Info: syscall(id=%i [timetodate32s] (srcTimeS=%u)\n", syscallId, srcTime);
 						} break;
+						case BytecodeSyscallIdSleepMs: {
+							BytecodeWord ms=process->regs[1];
+
+							if (infoSyscalls)
+								printf("Info: syscall(id=%i [sleepms], ms=%u)\n", syscallId, ms);
+
+							usleep(((useconds_t)ms)*1000);
+							process->regs[0]=0;
+						} break;
 						case BytecodeSyscallIdRegisterSignalHandler:
 							if (infoSyscalls)
 								printf("Info: syscall(id=%i [registersignalhandler] (unimplemented)\n", syscallId);
@@ -1055,6 +1257,21 @@ bool processRunNextInstruction(Process *process) {
 							if (infoSyscalls)
 								printf("Info: syscall(id=%i [hwdevicekeypadunmount], id=%u\n", syscallId, id);
 						} break;
+						case BytecodeSyscallIdHwDeviceDht22Mount: {
+							// HW devices are unsupported
+							uint16_t id=process->regs[1];
+							process->regs[0]=0;
+
+							if (infoSyscalls)
+								printf("Info: syscall(id=%i [hwdevicedht22mount], id=%u\n", syscallId, id);
+						} break;
+						case BytecodeSyscallIdHwDeviceDht22Unmount: {
+							// HW devices are unsupported
+							uint16_t id=process->regs[1];
+
+							if (infoSyscalls)
+								printf("Info: syscall(id=%i [hwdevicedht22unmount], id=%u\n", syscallId, id);
+						} break;
 						case ByteCodeSyscallIdInt32Add16: {
 							BytecodeWord aPtr=process->regs[1];
 							BytecodeWord bValue=process->regs[2];
@@ -5,6 +5,7 @@
 #include <string.h>
 
 #include "minifs.h"
+#include "minifscompress.h"
 #include "minifsextra.h"
 
 typedef enum {
@@ -18,10 +19,10 @@ const char *miniFsBuilderFormatOptionStrs[MiniFsBuilderFormatNB]={
 	[MiniFsBuilderFormatFlatFile]="-fflatfile",
 };
 
-bool buildVolumeMin(const char *name, const char *srcDir, const char *destDir, MiniFsBuilderFormat format);
-bool buildVolumeExact(const char *name, uint16_t size, const char *srcDir, const char *destDir, MiniFsBuilderFormat format, bool verbose);
+bool buildVolumeMin(const char *name, const char *srcDir, const char *destDir, MiniFsBuilderFormat format, bool compress);
+bool buildVolumeExact(const char *name, uint16_t size, const char *srcDir, const char *destDir, MiniFsBuilderFormat format, bool compress, bool verbose);
 
-bool miniFsWriteCHeader(const char *name, uint16_t size, const char *destDir, uint8_t *dataArray, bool verbose);
+bool miniFsWriteCHeader(const char *name, uint16_t size, const char *destDir, uint8_t *dataArray, bool compressed, bool verbose);
 bool miniFsWriteFlatFile(const char *name, uint16_t size, const char *destDir, uint8_t *dataArray, bool verbose);
 
 uint16_t readFunctor(uint16_t addr, uint8_t *data, uint16_t len, void *userData);
@@ -30,15 +31,18 @@ uint16_t writeFunctor(uint16_t addr, const uint8_t *data, uint16_t len, void *us
 int main(int argc, char **argv) {
 	// Parse arguments
 	if (argc<4) {
-		printf("usage: %s [--size=SIZE] -fOUTPUTFORMAT srcdir volumename destdir\n", argv[0]);
+		printf("usage: %s [--size=SIZE] [--compress] -fOUTPUTFORMAT srcdir volumename destdir\n", argv[0]);
 		return 0;
 	}
 
 	MiniFsBuilderFormat outputFormat=MiniFsBuilderFormatNB;
 	uint16_t maxSize=0; // 0 means use minimum required
+	bool compress=false;
 	for(int i=1; i<argc-3; ++i) {
 		if (strncmp(argv[i], "--size=", strlen("--size="))==0) {
 			maxSize=atoi(argv[i]+strlen("--size="));
+		} else if (strcmp(argv[i], "--compress")==0) {
+			compress=true;
 		} else {
 			bool found=false;
 			for(unsigned j=0; j<MiniFsBuilderFormatNB; ++j) {
@@ -63,9 +67,9 @@ int main(int argc, char **argv) {
 	// Build volue
 	bool success;
 	if (maxSize==0)
-		success=buildVolumeMin(volumeName, srcDir, destDir, outputFormat);
+		success=buildVolumeMin(volumeName, srcDir, destDir, outputFormat, compress);
 	else
-		success=buildVolumeExact(volumeName, maxSize, srcDir, destDir, outputFormat, true);
+		success=buildVolumeExact(volumeName, maxSize, srcDir, destDir, outputFormat, compress, true);
 
 	if (!success)
 		printf("failed to build volume '%s'\n", volumeName);
@@ -73,37 +77,38 @@ int main(int argc, char **argv) {
 	return 0;
 }
 
-bool buildVolumeMin(const char *name, const char *srcDir, const char *destDir, MiniFsBuilderFormat format) {
+bool buildVolumeMin(const char *name, const char *srcDir, const char *destDir, MiniFsBuilderFormat format, bool compress) {
 	// Loop, trying increasing powers of 2 for max volume size until we succeed (if we do at all).
 	int32_t size; // needs to be 32 bit for loop termination condition to work
 	for(size=MINIFSMINSIZE; size<=MINIFSMAXSIZE; size*=2) {
-		if (buildVolumeExact(name, size, srcDir, destDir, format, false)) {
+		if (buildVolumeExact(name, size, srcDir, destDir, format, compress, false)) {
 			// We have found a size that works, i.e an upper bound.
 
 			// Try to shrink with a binary search
 			uint16_t minGoodSize=size;
 			uint16_t maxBadSize=(size>MINIFSMINSIZE ? size/2 : MINIFSMINSIZE);
-			while(minGoodSize-MINIFSFACTOR>maxBadSize) {
+			while(minGoodSize-1>maxBadSize) { // volume sizes are rounded down to a multiple of the factor by miniFsFormat, so just search to the byte
 				uint16_t trialSize=(maxBadSize+minGoodSize)/2;
-				if (buildVolumeExact(name, trialSize, srcDir, destDir, format, false))
+				if (buildVolumeExact(name, trialSize, srcDir, destDir, format, compress, false))
 					minGoodSize=trialSize;
 				else
 					maxBadSize=trialSize;
 			}
 
 			// Use minimum size found
-			if (buildVolumeExact(name, minGoodSize, srcDir, destDir, format, false))
+			if (buildVolumeExact(name, minGoodSize, srcDir, destDir, format, compress, false))
 				return true;
 		}
 	}
 
 	// We have failed - run final size again but with logging turned on.
-	return buildVolumeExact(name, MINIFSMAXSIZE, srcDir, destDir, format, true);
+	return buildVolumeExact(name, MINIFSMAXSIZE, srcDir, destDir, format, compress, true);
 }
 
-bool buildVolumeExact(const char *name, uint16_t size, const char *srcDir, const char *destDir, MiniFsBuilderFormat format, bool verbose) {
+bool buildVolumeExact(const char *name, uint16_t size, const char *srcDir, const char *destDir, MiniFsBuilderFormat format, bool compress, bool verbose) {
 	MiniFs miniFs;
 	uint8_t *dataArray=malloc(MINIFSMAXSIZE); // TODO: check return
+	uint8_t *compressedArray=NULL;
 
 	// clear data arary (not strictly necessary but might avoid confusion in the future when e.g. stdio functions are in unused part of the stdmath volume)
 	// setting to 0xFF also matches value stored in uninitialised Arduino EEPROM
@@ -133,14 +138,30 @@ bool buildVolumeExact(const char *name, uint16_t size, const char *srcDir, const
 	// unmount to save any changes
 	miniFsUnmount(&miniFs);
 
+	// compress if needed (output then contains the compressed volume instead)
+	uint8_t *outputArray=dataArray;
+	uint16_t outputSize=size;
+	if (compress) {
+		compressedArray=malloc(MINIFSMAXSIZE+1024); // TODO: check return (extra space is for header and index)
+		outputSize=miniFsCompressVolume(dataArray, size, compressedArray, MINIFSMAXSIZE+1024);
+		if (outputSize==0) {
+			if (verbose)
+				printf("could not compress\n");
+			goto error;
+		}
+		outputArray=compressedArray;
+		if (verbose)
+			printf("compressed volume '%s' from %u to %u bytes\n", name, size, outputSize);
+	}
+
 	// create output
 	switch(format) {
 		case MiniFsBuilderFormatCHeader:
-			if (miniFsWriteCHeader(name, size, destDir, dataArray, verbose))
+			if (miniFsWriteCHeader(name, outputSize, destDir, outputArray, compress, verbose))
 				goto success;
 		break;
 		case MiniFsBuilderFormatFlatFile:
-			if (miniFsWriteFlatFile(name, size, destDir, dataArray, verbose))
+			if (miniFsWriteFlatFile(name, outputSize, destDir, outputArray, verbose))
 				goto success;
 		break;
 		case MiniFsBuilderFormatNB:
@@ -150,14 +171,16 @@ bool buildVolumeExact(const char *name, uint16_t size, const char *srcDir, const
 
 	error:
 	free(dataArray);
+	free(compressedArray);
 	return false;
 
 	success:
 	free(dataArray);
+	free(compressedArray);
 	return true;
 }
 
-bool miniFsWriteCHeader(const char *name, uint16_t size, const char *destDir, uint8_t *dataArray, bool verbose) {
+bool miniFsWriteCHeader(const char *name, uint16_t size, const char *destDir, uint8_t *dataArray, bool compressed, bool verbose) {
 	char hFilePath[1024]; // TODO: better
 	sprintf(hFilePath, "%s/progmem%s.h", destDir, name);
 
@@ -174,6 +197,7 @@ bool miniFsWriteCHeader(const char *name, uint16_t size, const char *destDir, ui
 	fprintf(hFile, "#include <stdint.h>\n\n");
 
 	fprintf(hFile, "#define PROGMEM%sDATASIZE %iu\n", name, size);
+	fprintf(hFile, "#define PROGMEM%sCOMPRESSED %i\n", name, compressed);
 	fprintf(hFile, "#ifdef ARDUINO\n");
 	fprintf(hFile, "#include <avr/pgmspace.h>\n");
 	fprintf(hFile, "#define PROGMEM%sDATAPTR ((uint32_t)pgm_get_far_address(progmem%sData))\n", name, name);
@@ -0,0 +1,333 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bytecode.h"
+#include "profile.h"
+
+typedef struct {
+	uint16_t addr;
+	char *name;
+	uint64_t count;
+} ProfilerFunction;
+
+typedef struct {
+	uint16_t addr, len;
+	unsigned lineNum;
+	char *file;
+	uint64_t count;
+} ProfilerLine;
+
+// Global data for ease
+uint64_t profilerCounts[BytecodeMemoryProgmemSize];
+uint64_t profilerTotal=0;
+
+ProfilerFunction *profilerFunctions=NULL;
+size_t profilerFunctionsNext=0;
+
+ProfilerLine *profilerLines=NULL;
+size_t profilerLinesNext=0;
+
+#define ProfilerFoldedLineMax (ProfileStackDepthMax*7+32) // each address is at most '0xffff;', plus a space and the count
+
+bool profilerReadMap(const char *path); // returns false on failure
+bool profilerReadProfile(const char *path); // adds counts from given profile file to running totals, returns false on failure
+bool profilerWriteLayout(const char *path); // returns false on failure
+bool profilerWriteFoldedStacks(const char *path); // symbolises a stack profile file (from the kernel's --profile-stacks option) and writes it to stdout, returns false on failure
+
+const char *profilerGetFunctionName(uint16_t addr); // functions must still be in address order, returns the address in hex if not within a known function (in a static buffer)
+
+void profilerComputeTotals(void);
+
+int profilerFunctionCompareCount(const void *a, const void *b);
+int profilerLineCompareCount(const void *a, const void *b);
+
+int main(int argc, char **argv) {
+	int result=EXIT_FAILURE;
+
+	// Parse arguments
+	const char *layoutPath=NULL;
+	bool folded=false;
+	unsigned functionLimit=20, lineLimit=20;
+	int argi;
+	for(argi=1; argi<argc && strncmp(argv[argi], "--", 2)==0; ++argi) {
+		if (strncmp(argv[argi], "--layout=", strlen("--layout="))==0)
+			layoutPath=argv[argi]+strlen("--layout=");
+		else if (strncmp(argv[argi], "--functions=", strlen("--functions="))==0)
+			functionLimit=atoi(argv[argi]+strlen("--functions="));
+		else if (strncmp(argv[argi], "--lines=", strlen("--lines="))==0)
+			lineLimit=atoi(argv[argi]+strlen("--lines="));
+		else if (strcmp(argv[argi], "--folded")==0)
+			folded=true;
+		else
+			printf("Warning: unknown option '%s'\n", argv[argi]);
+	}
+
+	if (argc-argi<2) {
+		printf("Usage: %s [--functions=n] [--lines=n] [--layout=outputfile] mapfile profilefile [profilefile ...]\n", argv[0]);
+		printf("       %s --folded mapfile stackprofilefile [stackprofilefile ...]\n", argv[0]);
+		printf("Map files are created by passing --map to aosf-asm, profile files by running the kernel with --profile.\n");
+		printf("Layout files can be passed back to aosf-asm via its --layout option.\n");
+		printf("With --folded, stack profile files (from running the kernel with --profile-stacks) are printed with addresses replaced by function names, ready for flame graph tools.\n");
+		goto done;
+	}
+
+	// Symbolising stack profiles only needs the map
+	if (folded) {
+		if (!profilerReadMap(argv[argi]))
+			goto done;
+		for(int i=argi+1; i<argc; ++i)
+			if (!profilerWriteFoldedStacks(argv[i]))
+				goto done;
+		result=EXIT_SUCCESS;
+		goto done;
+	}
+
+	// Read map and profiles (all of which should be for the same executable - counts are summed)
+	if (!profilerReadMap(argv[argi]))
+		goto done;
+
+	for(int i=argi+1; i<argc; ++i)
+		if (!profilerReadProfile(argv[i]))
+			goto done;
+
+	// Attribute counts to functions and lines
+	profilerComputeTotals();
+
+	// Print report
+	printf("Total instructions: %llu (from %i profile(s))\n", (unsigned long long)profilerTotal, argc-argi-1);
+
+	qsort(profilerFunctions, profilerFunctionsNext, sizeof(ProfilerFunction), &profilerFunctionCompareCount);
+	printf("Hot functions:\n");
+	for(size_t i=0; i<profilerFunctionsNext && i<functionLimit; ++i) {
+		const ProfilerFunction *function=&profilerFunctions[i];
+		if (function->count==0)
+			break;
+		printf("	%10llu %5.1f%% %s\n", (unsigned long long)function->count, (100.0*function->count)/profilerTotal, function->name);
+	}
+
+	qsort(profilerLines, profilerLinesNext, sizeof(ProfilerLine), &profilerLineCompareCount);
+	printf("Hot lines:\n");
+	for(size_t i=0; i<profilerLinesNext && i<lineLimit; ++i) {
+		const ProfilerLine *line=&profilerLines[i];
+		if (line->count==0)
+			break;
+		printf("	%10llu %5.1f%% %s:%u\n", (unsigned long long)line->count, (100.0*line->count)/profilerTotal, line->file, line->lineNum);
+	}
+
+	// Write layout file if needed
+	if (layoutPath!=NULL && !profilerWriteLayout(layoutPath))
+		goto done;
+
+	result=EXIT_SUCCESS;
+
+	// Tidy up
+	done:
+	for(size_t i=0; i<profilerFunctionsNext; ++i)
+		free(profilerFunctions[i].name);
+	free(profilerFunctions);
+	for(size_t i=0; i<profilerLinesNext; ++i)
+		free(profilerLines[i].file);
+	free(profilerLines);
+
+	return result;
+}
+
+bool profilerReadMap(const char *path) {
+	assert(path!=NULL);
+
+	FILE *file=fopen(path, "r");
+	if (file==NULL) {
+		printf("Could not open map file '%s' for reading\n", path);
+		return false;
+	}
+
+	char line[2048]; // longest line is a source file path plus a few numbers
+	if (fgets(line, sizeof(line), file)==NULL || strcmp(line, "aosf-asm map 1\n")!=0) {
+		printf("Bad map file '%s' (bad header)\n", path);
+		goto error;
+	}
+
+	// Code before the first function is attributed to the entry point
+	profilerFunctions=malloc(sizeof(ProfilerFunction));
+	if (profilerFunctions==NULL)
+		goto error;
+	profilerFunctions[0].addr=0;
+	profilerFunctions[0].name=strdup("<entry>");
+	profilerFunctions[0].count=0;
+	profilerFunctionsNext=1;
+
+	while(fgets(line, sizeof(line), file)!=NULL) {
+		if (strchr(line, '\n')==NULL && !feof(file)) {
+			printf("Bad map file '%s' (line too long)\n", path);
+			goto error;
+		}
+		line[strcspn(line, "\n")]='\0';
+
+		unsigned addr, len, lineNum;
+		int nameOffset;
+		if (sscanf(line, "function %u %n", &addr, &nameOffset)==1) {
+			ProfilerFunction *newFunctions=realloc(profilerFunctions, sizeof(ProfilerFunction)*(profilerFunctionsNext+1));
+			if (newFunctions==NULL)
+				goto error;
+			profilerFunctions=newFunctions;
+			ProfilerFunction *function=&profilerFunctions[profilerFunctionsNext++];
+			function->addr=addr;
+			function->name=strdup(line+nameOffset);
+			function->count=0;
+		} else if (sscanf(line, "line %u %u %u %n", &addr, &len, &lineNum, &nameOffset)==3) {
+			ProfilerLine *newLines=realloc(profilerLines, sizeof(ProfilerLine)*(profilerLinesNext+1));
+			if (newLines==NULL)
+				goto error;
+			profilerLines=newLines;
+			ProfilerLine *profilerLine=&profilerLines[profilerLinesNext++];
+			profilerLine->addr=addr;
+			profilerLine->len=len;
+			profilerLine->lineNum=lineNum;
+			profilerLine->file=strdup(line+nameOffset);
+			profilerLine->count=0;
+		}
+		// Other lines (such as non-function labels) are ignored
+	}
+
+	fclose(file);
+	return true;
+
+	error:
+	printf("Could not read map file '%s'\n", path);
+	fclose(file);
+	return false;
+}
+
+bool profilerReadProfile(const char *path) {
+	assert(path!=NULL);
+
+	FILE *file=fopen(path, "r");
+	if (file==NULL) {
+		printf("Could not open profile file '%s' for reading\n", path);
+		return false;
+	}
+
+	// File is simply an array of counters indexed by IP
+	ProfileCounter counter;
+	for(unsigned addr=0; addr<BytecodeMemoryProgmemSize && fread(&counter, sizeof(counter), 1, file)==1; ++addr) {
+		profilerCounts[addr]+=counter;
+		profilerTotal+=counter;
+	}
+
+	fclose(file);
+	return true;
+}
+
+bool profilerWriteLayout(const char *path) {
+	assert(path!=NULL);
+
+	FILE *file=fopen(path, "w");
+	if (file==NULL) {
+		printf("Could not open layout file '%s' for writing\n", path);
+		return false;
+	}
+
+	// Functions are already sorted hottest first - write those which were executed at all (the entry code is never moved so is skipped)
+	fprintf(file, "; aosf-profile layout file, pass to aosf-asm via --layout\n");
+	for(size_t i=0; i<profilerFunctionsNext; ++i) {
+		const ProfilerFunction *function=&profilerFunctions[i];
+		if (function->count==0)
+			break;
+		if (strcmp(function->name, "<entry>")==0)
+			continue;
+		fprintf(file, "%s %llu\n", function->name, (unsigned long long)function->count);
+	}
+
+	if (fclose(file)!=0)
+		return false;
+	return true;
+}
+
+bool profilerWriteFoldedStacks(const char *path) {
+	assert(path!=NULL);
+
+	FILE *file=fopen(path, "r");
+	if (file==NULL) {
+		printf("Could not open stack profile file '%s' for reading\n", path);
+		return false;
+	}
+
+	// Each line is a list of addresses separated by ';', then a space and the sample count
+	char line[ProfilerFoldedLineMax];
+	while(fgets(line, sizeof(line), file)!=NULL) {
+		// Line too long to have been written by the kernel?
+		if (strchr(line, '\n')==NULL && !feof(file)) {
+			printf("Bad stack profile file '%s' (line too long)\n", path);
+			fclose(file);
+			return false;
+		}
+
+		char *countStr=strrchr(line, ' ');
+		if (countStr==NULL)
+			continue;
+		*countStr++='\0';
+
+		bool first=true;
+		for(char *frame=strtok(line, ";"); frame!=NULL; frame=strtok(NULL, ";")) {
+			printf("%s%s", (first ? "" : ";"), profilerGetFunctionName(strtoul(frame, NULL, 0)));
+			first=false;
+		}
+		printf(" %s", countStr);
+	}
+
+	fclose(file);
+	return true;
+}
+
+const char *profilerGetFunctionName(uint16_t addr) {
+	// Map file is in address order so each function covers up until the start of the next
+	if (profilerFunctionsNext>0 && addr>=profilerFunctions[0].addr) {
+		size_t i;
+		for(i=0; i+1<profilerFunctionsNext; ++i)
+			if (profilerFunctions[i+1].addr>addr)
+				break;
+		if (profilerFunctions[i].name!=NULL)
+			return profilerFunctions[i].name;
+	}
+
+	// Unknown (before the first function or no map data) - use raw address instead
+	static char hexStr[8];
+	sprintf(hexStr, "0x%04X", addr);
+	return hexStr;
+}
+
+void profilerComputeTotals(void) {
+	// Functions - map file is in address order so each function covers up until the start of the next
+	for(size_t i=0; i<profilerFunctionsNext; ++i) {
+		unsigned endAddr=(i+1<profilerFunctionsNext ? profilerFunctions[i+1].addr : BytecodeMemoryProgmemSize);
+		for(unsigned addr=profilerFunctions[i].addr; addr<endAddr; ++addr)
+			profilerFunctions[i].count+=profilerCounts[addr];
+	}
+
+	// Lines
+	for(size_t i=0; i<profilerLinesNext; ++i) {
+		ProfilerLine *line=&profilerLines[i];
+		for(unsigned addr=line->addr; addr<line->addr+line->len && addr<BytecodeMemoryProgmemSize; ++addr)
+			line->count+=profilerCounts[addr];
+	}
+}
+
+int profilerFunctionCompareCount(const void *a, const void *b) {
+	const ProfilerFunction *functionA=(const ProfilerFunction *)a;
+	const ProfilerFunction *functionB=(const ProfilerFunction *)b;
+	if (functionA->count!=functionB->count)
+		return (functionA->count>functionB->count ? -1 : 1);
+	return (functionA->addr<functionB->addr ? -1 : 1);
+}
+
+int profilerLineCompareCount(const void *a, const void *b) {
+	const ProfilerLine *lineA=(const ProfilerLine *)a;
+	const ProfilerLine *lineB=(const ProfilerLine *)b;
+	if (lineA->count!=lineB->count)
+		return (lineA->count>lineB->count ? -1 : 1);
+	return (lineA->addr<lineB->addr ? -1 : 1);
+}
@@ -0,0 +1,3 @@
+mount fat /media/fat /mnt
+hash /mnt/DATA
+unmount /mnt
@@ -0,0 +1,41 @@
+; forkexec - benchmark workload: repeatedly forks and execs /bin/true, waiting for each run to finish
+
+require lib/sys/sys.s
+
+requireend lib/std/io/fput.s
+requireend lib/std/io/fputdec.s
+requireend lib/std/proc/exit.s
+requireend lib/std/proc/forkexecwait.s
+
+const runCount 16
+
+db truePath '/bin/true', 0
+db doneStr ' runs of /bin/true\n', 0
+
+ab runsLeft 1
+
+; Register simple suicide handler
+require lib/std/proc/suicidehandler.s
+
+mov r0 runsLeft
+mov r1 runCount
+store8 r0 r1
+
+label runLoop
+mov r0 1
+mov r1 truePath
+call forkexecwait
+mov r0 runsLeft
+load8 r1 r0
+dec r1
+store8 r0 r1
+cmp r1 r1 r1
+skipeqz r1
+jmp runLoop
+
+mov r0 runCount
+call putdec
+mov r0 doneStr
+call puts0
+mov r0 0
+call exit
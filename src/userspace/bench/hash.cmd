@@ -0,0 +1 @@
+hash /bin/sh /bin/ls /usr/bin/man
@@ -0,0 +1,132 @@
+; pipe - benchmark workload: a forked child writes a block of data into a pipe while the parent reads it back out
+
+require lib/sys/sys.s
+
+requireend lib/std/io/fput.s
+requireend lib/std/io/fputdec.s
+requireend lib/std/proc/exit.s
+requireend lib/std/proc/waitpid.s
+
+const totalBytes 8192
+const chunkSize 64
+
+db pipeErrorStr 'could not open pipe\n', 0
+db forkErrorStr 'could not fork\n', 0
+db doneStr ' bytes piped\n', 0
+
+ab childPid 1
+ab pipeReadFd 1
+ab pipeWriteFd 1
+ab buf chunkSize
+
+; Register simple suicide handler
+require lib/std/proc/suicidehandler.s
+
+; Create pipe
+mov r0 SyscallIdPipeOpen
+mov r1 pipeReadFd
+mov r2 pipeWriteFd
+syscall
+
+cmp r0 r0 r0
+skipneqz r0
+jmp pipeError
+
+; Fork
+mov r0 SyscallIdFork
+syscall
+mov r1 childPid
+store8 r1 r0
+
+mov r1 PidMax
+cmp r1 r0 r1
+skipneq r1
+jmp forkError
+skipneqz r1
+jmp forkChild
+jmp forkParent
+
+; Child - close read end of pipe then write data into the other end
+label forkChild
+mov r0 SyscallIdClose
+mov r1 pipeReadFd
+load8 r1 r1
+syscall
+mov r0 pipeWriteFd
+load8 r0 r0
+mov r1 SyscallIdWrite
+call transfer
+mov r0 0
+call exit
+
+; Parent - close write end of pipe then read all data back out, before waiting for the child to terminate
+label forkParent
+mov r0 SyscallIdClose
+mov r1 pipeWriteFd
+load8 r1 r1
+syscall
+mov r0 pipeReadFd
+load8 r0 r0
+mov r1 SyscallIdRead
+call transfer
+push16 r0
+mov r0 childPid
+load8 r0 r0
+call waitpid
+pop16 r0
+; Print number of bytes read
+call putdec
+mov r0 doneStr
+call puts0
+mov r0 0
+call exit
+
+; transfer(fd=r0, syscallId=r1) - reads or writes (depending on syscallId) up to totalBytes bytes via buf, a chunk at a time, returning the number of bytes transferred
+label transfer
+mov r2 totalBytes ; bytes left
+label transferLoop
+cmp r3 r2 r2
+skipneqz r3
+jmp transferDone
+; len=min(chunkSize, bytes left)
+mov r4 chunkSize
+cmp r3 r2 r4
+skipge r3
+mov r4 r2
+; read/write chunk, preserving fd, syscall id and bytes left
+push8 r0
+push16 r1
+push16 r2
+mov r2 r0
+mov r0 r1
+mov r1 r2
+mov r2 0
+mov r3 buf
+syscall
+mov r4 r0
+pop16 r2
+pop16 r1
+pop8 r0
+; give up on error
+cmp r3 r4 r4
+skipneqz r3
+jmp transferDone
+sub r2 r2 r4
+jmp transferLoop
+label transferDone
+mov r0 totalBytes
+sub r0 r0 r2
+ret
+
+; Errors
+label pipeError
+mov r0 pipeErrorStr
+call puts0
+mov r0 1
+call exit
+
+label forkError
+mov r0 forkErrorStr
+call puts0
+mov r0 1
+call exit
@@ -0,0 +1,100 @@
+; sort - benchmark workload: insertion sorts an array of pseudo-random words, then checks the result
+
+require lib/sys/sys.s
+
+requireend lib/std/io/fput.s
+requireend lib/std/io/fputdec.s
+requireend lib/std/proc/exit.s
+
+const wordCount 256
+const wordBytes 512
+
+db doneStr ' words sorted\n', 0
+db failStr 'sort failed\n', 0
+
+aw words wordCount
+
+; Register simple suicide handler
+require lib/std/proc/suicidehandler.s
+
+; Fill array from a linear congruential generator (with a fixed seed so that runs are comparable)
+mov r0 words
+mov r1 wordCount
+mov r2 1
+mov r3 25173
+label fillLoop
+mul r2 r2 r3
+mov r4 13849
+add r2 r2 r4
+store16 r0 r2
+inc2 r0
+dec r1
+cmp r4 r1 r1
+skipeqz r4
+jmp fillLoop
+
+; Insertion sort - r0 points to the next word to insert, r1 holds its value, and r2 points to where it may go
+mov r0 words
+inc2 r0
+label outerLoop
+mov r2 words
+mov r3 wordBytes
+add r2 r2 r3
+cmp r4 r0 r2
+skipneq r4
+jmp check
+load16 r1 r0
+mov r2 r0
+label innerLoop
+; reached start of array?
+mov r3 words
+cmp r4 r2 r3
+skipneq r4
+jmp innerDone
+; shift previous word up if it is larger
+mov r3 r2
+dec2 r3
+load16 r3 r3
+cmp r4 r3 r1
+skipgt r4
+jmp innerDone
+store16 r2 r3
+dec2 r2
+jmp innerLoop
+label innerDone
+store16 r2 r1
+inc2 r0
+jmp outerLoop
+
+; Check each word is no larger than the next
+label check
+mov r0 words
+mov r1 words
+mov r2 wordBytes
+add r1 r1 r2
+dec2 r1
+label checkLoop
+cmp r4 r0 r1
+skipneq r4
+jmp success
+load16 r2 r0
+inc2 r0
+load16 r3 r0
+cmp r4 r2 r3
+skiple r4
+jmp failure
+jmp checkLoop
+
+label success
+mov r0 wordCount
+call putdec
+mov r0 doneStr
+call puts0
+mov r0 0
+call exit
+
+label failure
+mov r0 failStr
+call puts0
+mov r0 1
+call exit
@@ -0,0 +1,56 @@
+require lib/sys/sys.s
+
+requireend lib/dht22/dht22.s
+requireend lib/std/io/fput.s
+requireend lib/std/proc/exit.s
+requireend lib/std/str/strtoint.s
+
+db usageStr 'usage: id mountPoint intervalSeconds\n',0
+
+; Grab id arg
+mov r0 SyscallIdArgvN
+mov r1 1
+syscall
+cmp r1 r0 r0
+skipneqz r1
+jmp usage
+
+; Convert id arg to integer
+call strtoint
+push8 r0
+
+; Grab interval arg
+mov r0 SyscallIdArgvN
+mov r1 3
+syscall
+cmp r1 r0 r0
+skipneqz r1
+jmp usage ; id is not popped from stack but no harm
+
+; Convert interval arg to integer
+call strtoint
+push16 r0
+
+; Grab mount point arg
+mov r0 SyscallIdArgvN
+mov r1 2
+syscall
+cmp r1 r0 r0
+skipneqz r1
+jmp usage ; id and interval are not popped from stack but no harm
+
+; Mount
+mov r1 r0
+pop16 r2
+pop8 r0
+call dht22Mount
+
+; Exit
+mov r0 0
+call exit
+
+label usage
+mov r0 usageStr
+call puts0
+mov r0 1
+call exit
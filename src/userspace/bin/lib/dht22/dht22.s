@@ -15,3 +15,20 @@ mov r1 r0
 mov r0 SyscallIdHwDeviceDht22GetHumidity
 syscall
 ret
+
+; dht22Mount (r0=hw device slot, r1=mount point path, r2=sampling interval in seconds (at least 2), returns 1 on success in r0)
+; once mounted, samples can be read from the mount point as 8 byte records: 32 bit real time in seconds, temperature and humidity (as above)
+label dht22Mount
+mov r3 r2
+mov r2 r1
+mov r1 r0
+mov r0 SyscallIdHwDeviceDht22Mount
+syscall
+ret
+
+; dht22Unmount (r0=hw device slot)
+label dht22Unmount
+mov r1 r0
+mov r0 SyscallIdHwDeviceDht22Unmount
+syscall
+ret
@@ -4,15 +4,12 @@ require int32common.s
 label int32SwapEndianness
 ; Swap bytes 0 and 3
 load8 r1 r0
-inc3 r0
-xchg8 r0 r1
-dec3 r0
-store8 r0 r1
+load8d r2 r0 3
+store8d r0 r1 3
+store8 r0 r2
 ; Swap bytes 1 and 2
-inc r0
-load8 r1 r0
-inc r0
-xchg8 r0 r1
-dec r0
-store8 r0 r1
+load8d r1 r0 1
+load8d r2 r0 2
+store8d r0 r1 2
+store8d r0 r2 1
 ret
@@ -21,9 +21,7 @@ cmp r2 r0 r2
 skipeq r2
 ret
 ; upper word is all zeros, use lower word count plus 16
-inc2 r1
-load16 r0 r1
-dec2 r1
+load16d r0 r1 2
 clz r0 r0
 inc16 r0
 ret
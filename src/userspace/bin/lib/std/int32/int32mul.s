@@ -1,5 +1,3 @@
-require ../../sys/syscall.s
-
 requireend int32set.s
 
 ; int32mul1616(dest=r0, opA=r1, opB=r2) - stores product of two 16-bit values into 32 bit dest
@@ -15,16 +13,10 @@ jmp int32mul16 ; this function will return for us
 
 ; int32mul16(dest=r0, opA=r1) - stores product of 32-bit value dest and 16-bit value opA into dest
 label int32mul16
-mov r2 r1
-mov r1 r0
-mov r0 SyscallIdInt32Mul16
-syscall
+mul32w r0 r1
 ret
 
 ; int32mul32(dest=r0, opA=r1) - stores product of two 32-bit values dest and opA into dest
 label int32mul32
-mov r2 r1
-mov r1 r0
-mov r0 SyscallIdInt32Mul32
-syscall
+mul32 r0 r1
 ret
@@ -1,35 +1,98 @@
+require ../../sys/syscall.s
+
 jmp libsysthreadend
 
-; Locks are boolean 'taken' flags (stored in 8 bits), using the xchg8 instruction where necessary to be atomic.
+; Threads are processes created by the clone syscall, which share their creator's RAM (but have their own registers and stack).
+; Note: file descriptors are duplicated when the thread is created, so files opened afterwards are not shared.
+
+label threadcreate ; r0=entry ptr, r1=stack ptr, r2=arg (passed to entry function in r0), returns thread's PID in r0 (or PidMax on failure)
+; setup stack so that returning from the entry function exits the thread
+mov r3 threadexit
+store16 r1 r3
+inc2 r1
+; call clone with r1=entry ptr, r2=stack ptr, r3=arg
+mov r3 r2
+mov r2 r1
+mov r1 r0
+mov r0 SyscallIdClone
+syscall
+ret
+
+label threadexit ; r0=exit status
+mov r1 r0
+mov r0 SyscallIdExit
+syscall
+
+label futexwait ; r0=addr, r1=expected value - waits until woken by futexwake (unless the byte at addr no longer equals the expected value). Returns 0 in r0 (or 1 if interrupted by a signal)
+mov r2 r1
+mov r1 r0
+mov r0 SyscallIdFutexWait
+syscall
+ret
+
+label futexwake ; r0=addr, r1=max count - wakes up to r1 threads waiting on addr, returning the number woken in r0
+mov r2 r1
+mov r1 r0
+mov r0 SyscallIdFutexWake
+syscall
+ret
+
+; Locks are 'taken' flags (stored in 8 bits), using the xchg8 instruction where necessary to be atomic.
+; A lock is 0 if free, 1 if taken, or 2 if taken and other threads may be waiting on it (in which case whoever releases it has to wake one of them).
 ; To setup a lock, reserve a byte in memory and set it to 0 to make it initially unlocked, or to 1 to be initially locked,
 ; then pass its address to the functions below to use it.
 
-label lockwait ; r0=lock ptr, busy-waits trying to grab lock
-push16 r0
+label lockwait ; r0=lock ptr, waits until lock can be grabbed (sleeping rather than busy-waiting while it is taken)
+push16 r2
+; try to take lock uncontended
+mov r1 1
+xchg8 r0 r1
+cmp r1 r1 r1
+skipneqz r1
+jmp lockwaitret
+; otherwise mark the lock as contended and sleep until it is released
 label lockwaitloopstart
-pop16 r0
+mov r1 2
+xchg8 r0 r1
+cmp r1 r1 r1
+skipneqz r1
+jmp lockwaitret
 push16 r0
-call lockwaittry
-cmp r0 r0 r0
-skipneqz r0
+mov r1 2
+call futexwait
+pop16 r0
 jmp lockwaitloopstart
-pop16 r0 ; restore stack
+label lockwaitret
+pop16 r2
 ret
 
-label lockwaittry ; r0=lock ptr, tries to grab lock returning immediately. If lock was taken 1 is returned, otherwise 0.
+label lockwaittry ; r0=lock ptr, tries to grab lock returning immediately. If lock was taken 1 is returned, otherwise 0. Note: only modifies r0 and r1.
 ; swap 1 into lock to either take or preserve taken status
 mov r1 1
 xchg8 r0 r1
-; if lock was free, xchg returns 0, if lock was taken, xchg returns 1,
-; so xor to invert the result ready to return
+; if lock was contended we have just cleared that, so swap it back (this may also grab the lock if it has been released in the meantime)
+skip1 r1
+jmp lockwaittryret
+mov r1 2
+xchg8 r0 r1
+label lockwaittryret
+; lock was free (and is now ours) only if xchg returned 0
+mov r0 0
+cmp r1 r1 r1
+skipneqz r1
 mov r0 1
-xor r0 r1 r0
 ret
 
 label lockpost ; r0=lock ptr, releases lock
-; simply clear lock to 0 in standard way
 mov r1 0
-store8 r0 r1
+xchg8 r0 r1
+; were there possibly other threads waiting? if so wake one of them
+skip1 r1
+ret
+push16 r2
+mov r1 1
+call futexwake
+pop16 r2
 ret
 
 label libsysthreadend
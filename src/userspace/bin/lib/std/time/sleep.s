@@ -3,16 +3,36 @@ require ../../sys/syscall.s
 ; sleep(seconds=r0) - sleep for (at least) given number of seconds
 label sleep
 
-; if seconds is 0, simply return (0 indicates infinite timeout in waitpid)
+; sleep in chunks of at most 60s, as sleepms takes a 16 bit number of milliseconds
+label sleeploop
 cmp r1 r0 r0
 skipneqz r1
 jmp sleepret
 
-; call waitpid on init process (which never dies), but with a timeout of the given number of seconds
-mov r2 r0
-mov r0 SyscallIdWaitPid
-mov r1 0
-syscall
+mov r1 60
+cmp r2 r0 r1
+skipgt r2
+jmp sleeplast
+
+push16 r0
+mov r0 60000
+call sleepms
+pop16 r0
+mov r1 60
+sub r0 r0 r1
+jmp sleeploop
+
+label sleeplast
+mov r1 1000
+mul r0 r0 r1
+call sleepms
 
 label sleepret
 ret
+
+; sleepms(ms=r0) - sleep for (at least) given number of milliseconds, returning 0 in r0 (or 1 if interrupted by a signal)
+label sleepms
+mov r1 r0
+mov r0 SyscallIdSleepMs
+syscall
+ret
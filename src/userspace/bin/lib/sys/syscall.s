@@ -14,6 +14,9 @@ const SyscallIdGetPidRam 11
 const SyscallIdSignal 12
 const SyscallIdGetPidFdN 13
 const SyscallIdExec2 14
+const SyscallIdClone 15
+const SyscallIdFutexWait 16
+const SyscallIdFutexWake 17
 
 const SyscallIdRead 256
 const SyscallIdWrite 257
@@ -35,6 +38,8 @@ const SyscallIdAppend 272
 const SyscallIdFlush 273
 const SyscallIdTryWriteByte 274
 const SyscallIdGetPathGlobal 275
+const SyscallIdDirGetChildNext 276
+const SyscallIdDirGetChildren 277
 
 const SyscallIdEnvGetPwd 514
 const SyscallIdEnvSetPwd 515
@@ -47,6 +52,7 @@ const SyscallIdTimeMonotonic32s 770
 const SyscallIdTimeMonotonic32ms 771
 const SyscallIdTimeReal32s 772
 const SyscallIdTimeToDate32s 773
+const SyscallIdSleepMs 774
 
 const SyscallIdRegisterSignalHandler 1024
 
@@ -78,6 +84,8 @@ const SyscallIdHwDeviceDht22GetTemperature 1797
 const SyscallIdHwDeviceDht22GetHumidity 1798
 const SyscallIdHwDeviceKeypadMount 1799
 const SyscallIdHwDeviceKeypadUnmount 1800
+const SyscallIdHwDeviceDht22Mount 1801
+const SyscallIdHwDeviceDht22Unmount 1802
 
 const SyscallIdInt32Add16 2048
 const SyscallIdInt32Add32 2049
@@ -101,6 +109,9 @@ const SyscallWaitpidStatusNoProcess 65532
 const SyscallWaitpidStatusKilled 65534
 const SyscallWaitpidStatusTimeout 65535
 
+; DirGetChildren special return values (if the flag is set the lower bits give the buffer size needed)
+const SyscallDirGetChildrenBufferTooSmallFlag 32768
+
 ; HW device constants
 const SyscallHwDeviceIdMax 4
 
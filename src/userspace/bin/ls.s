@@ -9,7 +9,9 @@ requireend lib/std/str/strlen.s
 
 ab queryDir PathMax
 ab queryDirFd 1
-ab queryDirLen 1
+
+const childrenBufSize 128 ; must be at least PathMax to guarantee progress
+ab childrenBuf childrenBufSize
 
 ; Register simple suicide handler
 require lib/std/proc/suicidehandler.s
@@ -51,56 +53,51 @@ cmp r0 r0 r0
 skipneqz r0
 jmp error
 
-; Read path back from fd (to handle user passing relative paths for example)
-mov r0 SyscallIdGetPath
-mov r1 queryDirFd
-load8 r1 r1
-mov r2 queryDir
-syscall
-
-; Find queryDir length
-mov r0 queryDir
-call strlen
-mov r1 queryDirLen
-store8 r1 r0
-
-; Loop calling getChildN and printing results
-mov r2 0
-push8 r2
-
+; Loop reading batches of child names and printing them
 label loopStart
-mov r0 SyscallIdDirGetChildN
+mov r0 SyscallIdDirGetChildren
 mov r1 queryDirFd
 load8 r1 r1
-pop8 r2
-mov r3 queryDir
+mov r2 childrenBuf
+mov r3 childrenBufSize
 syscall
-inc r2
 
 ; End of children?
-cmp r0 r0 r0
-skipneqz r0
+cmp r1 r0 r0
+skipneqz r1
 jmp success
 
-push8 r2
-
-; Strip queryDir from front of child path
-mov r0 queryDir
-mov r1 queryDirLen
-load8 r1 r1
-add r0 r0 r1
-
-mov r2 1
-cmp r2 r1 r2
-skiple r2
-inc r0
+; Name too long for buffer?
+mov r1 SyscallDirGetChildrenBufferTooSmallFlag
+cmp r1 r0 r1
+skiplt r1
+jmp error
 
-; Print child path followed by a space
+; Print each name in the batch followed by a space (r0 contains count)
+mov r1 r0
+mov r0 childrenBuf
+label printLoopStart
+push8 r1
+push16 r0
 call puts0
 mov r0 ' '
 call putc0
 
-; Loop again to look for another child
+; Advance to next name
+pop16 r0
+push16 r0
+call strlen
+pop16 r1
+add r0 r0 r1
+inc r0
+pop8 r1
+
+dec r1
+cmp r2 r1 r1
+skipeqz r2
+jmp printLoopStart
+
+; Loop again to look for more children
 jmp loopStart
 
 ; Success - terminate list with newline
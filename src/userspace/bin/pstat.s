@@ -0,0 +1,316 @@
+require lib/sys/sys.s
+
+requireend lib/std/int32/int32fput.s
+requireend lib/std/io/fopen.s
+requireend lib/std/io/fput.s
+requireend lib/std/io/fputdec.s
+requireend lib/std/io/fread.s
+requireend lib/std/proc/exit.s
+requireend lib/std/str/strlen.s
+requireend lib/std/str/strtoint.s
+
+; Layout of the per-pid records in /dev/procstats (all values big-endian)
+const StatsRecordSize 144
+const StatsOffsetInstructions 4 ; lower half of a 64 bit count
+const StatsOffsetTicks 8
+const StatsOffsetSyscalls 12
+const StatsOffsetFdBytesRead 48
+const StatsOffsetFdBytesWritten 84
+const StatsOffsetRamGrowths 120
+const StatsOffsetWaitMs 124
+const StatsSyscallGroupNB 9
+const StatsWaitTypeNB 5
+const StatsFdMax 9
+
+db statsPath '/dev/procstats', 0
+db openErrorStr 'could not open /dev/procstats\n', 0
+db instructionsStr '  instructions(low32) ', 0
+db ticksStr ' ticks ', 0
+db ramGrowthsStr ' ramgrowths ', 0
+db syscallsStr '  syscalls', 0
+db syscallGroupNames 'proc', 0, 'io', 0, 'env', 0, 'time', 0, 'signal', 0, 'misc', 0, 'str', 0, 'hw', 0, 'int32', 0
+db waitMsStr '  waitms', 0
+db waitTypeNames 'waitpid', 0, 'read', 0, 'write', 0, 'sleep', 0, 'futex', 0
+db fdStr '  fd ', 0
+db fdReadStr ' read ', 0
+db fdWrittenStr ' written ', 0
+
+ab statsFd 1
+ab pid 1
+ab pidPath PathMax
+ab record StatsRecordSize
+ab localFd 1
+
+aw fieldsName 1
+aw fieldsOffset 1
+ab fieldsCount 1
+
+; Register simple suicide handler
+require lib/std/proc/suicidehandler.s
+
+; Open stats device
+mov r0 statsPath
+mov r1 FdModeRO
+call fopen
+mov r1 statsFd
+store8 r1 r0
+cmp r1 r0 r0
+skipeqz r1
+jmp opened
+mov r0 openErrorStr
+call puts0
+mov r0 1
+call exit
+label opened
+
+; If a pid was given only show that process
+mov r0 SyscallIdArgvN
+mov r1 1
+mov r3 64
+syscall
+
+cmp r1 r0 r0
+skipneqz r1
+jmp allPids
+
+call strtoint
+call printPid
+jmp done
+
+; Otherwise loop over all pids
+label allPids
+mov r0 0
+label loopStart
+mov r1 PidMax
+cmp r1 r0 r1
+skiplt r1
+jmp done
+
+push8 r0
+call printPid
+pop8 r0
+
+inc r0
+jmp loopStart
+
+; Exit
+label done
+mov r0 0
+call exit
+
+label printPid ; pid=r0 - prints counters for given process (if it exists)
+
+; Store pid
+mov r1 pid
+store8 r1 r0
+
+; Grab exec path (also checking process exists)
+mov r0 SyscallIdGetPidPath
+mov r1 pid
+load8 r1 r1
+mov r2 pidPath
+syscall
+
+cmp r0 r0 r0
+skipneqz r0
+ret
+
+; Read this process' record
+mov r0 statsFd
+load8 r0 r0
+mov r1 pid
+load8 r1 r1
+mov r2 StatsRecordSize
+mul r1 r1 r2
+mov r2 record
+mov r3 StatsRecordSize
+call fread
+
+mov r1 StatsRecordSize
+cmp r1 r0 r1
+skipeq r1
+ret
+
+; Print pid and exec path
+mov r0 pid
+load8 r0 r0
+mov r1 2
+call putdecpad
+mov r0 ' '
+call putc0
+mov r0 pidPath
+call puts0
+mov r0 '\n'
+call putc0
+
+; Print instructions, ticks and ram growths
+mov r0 instructionsStr
+call puts0
+mov r0 record
+mov r1 StatsOffsetInstructions
+add r0 r0 r1
+call int32put0
+
+mov r0 ticksStr
+call puts0
+mov r0 record
+mov r1 StatsOffsetTicks
+add r0 r0 r1
+call int32put0
+
+mov r0 ramGrowthsStr
+call puts0
+mov r0 record
+mov r1 StatsOffsetRamGrowths
+add r0 r0 r1
+call int32put0
+
+mov r0 '\n'
+call putc0
+
+; Print syscall counts by group, and time spent blocked by wait type
+mov r0 syscallsStr
+mov r1 syscallGroupNames
+mov r2 StatsOffsetSyscalls
+mov r3 StatsSyscallGroupNB
+call printFields
+
+mov r0 waitMsStr
+mov r1 waitTypeNames
+mov r2 StatsOffsetWaitMs
+mov r3 StatsWaitTypeNB
+call printFields
+
+; Print bytes read/written for each open fd
+mov r0 1
+label fdLoopStart
+mov r1 StatsFdMax
+cmp r1 r0 r1
+skiplt r1
+ret
+
+push8 r0
+call printFd
+pop8 r0
+
+inc r0
+jmp fdLoopStart
+
+label printFd ; localFd=r0 - prints bytes read/written via given fd of current pid (if open)
+
+; Store local fd
+mov r1 localFd
+store8 r1 r0
+
+; Check if fd is in use
+mov r0 SyscallIdGetPidFdN
+mov r1 pid
+load8 r1 r1
+mov r2 localFd
+load8 r2 r2
+syscall
+
+cmp r0 r0 r0
+skipneqz r0
+ret
+
+; Print fd
+mov r0 fdStr
+call puts0
+mov r0 localFd
+load8 r0 r0
+call putdec
+
+; Print bytes read
+mov r0 fdReadStr
+call puts0
+mov r0 localFd
+load8 r0 r0
+mov r1 4
+mul r0 r0 r1
+mov r1 record
+add r0 r0 r1
+mov r1 StatsOffsetFdBytesRead
+add r0 r0 r1
+call int32put0
+
+; Print bytes written
+mov r0 fdWrittenStr
+call puts0
+mov r0 localFd
+load8 r0 r0
+mov r1 4
+mul r0 r0 r1
+mov r1 record
+add r0 r0 r1
+mov r1 StatsOffsetFdBytesWritten
+add r0 r0 r1
+call int32put0
+
+mov r0 '\n'
+call putc0
+ret
+
+label printFields ; title=r0, names=r1, offset=r2, count=r3 - prints title followed by ' name value' for each of count consecutive 32 bit fields in the record starting at offset, taking names in turn from the list of null-terminated strings at names
+
+; Store arguments
+mov r4 fieldsName
+store16 r4 r1
+mov r4 fieldsOffset
+store16 r4 r2
+mov r4 fieldsCount
+store8 r4 r3
+
+; Print title
+call puts0
+
+; Loop over fields
+label printFieldsLoopStart
+mov r0 fieldsCount
+load8 r0 r0
+cmp r0 r0 r0
+skipneqz r0
+jmp printFieldsLoopEnd
+
+; Print name
+mov r0 ' '
+call putc0
+mov r0 fieldsName
+load16 r0 r0
+call puts0
+mov r0 ' '
+call putc0
+
+; Print value
+mov r0 fieldsOffset
+load16 r0 r0
+mov r1 record
+add r0 r0 r1
+call int32put0
+
+; Advance to next field and name
+mov r0 fieldsName
+load16 r0 r0
+call strlen
+inc r0
+mov r1 fieldsName
+load16 r2 r1
+add r2 r2 r0
+store16 r1 r2
+
+mov r0 fieldsOffset
+load16 r1 r0
+inc4 r1
+store16 r0 r1
+
+mov r0 fieldsCount
+load8 r1 r0
+dec r1
+store8 r0 r1
+
+jmp printFieldsLoopStart
+label printFieldsLoopEnd
+
+mov r0 '\n'
+call putc0
+ret
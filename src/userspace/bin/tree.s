@@ -99,13 +99,12 @@ jmp printDirDone
 
 ; Child loop init
 mov r1 r0 ; fd stored in r1
-mov r2 0 ; child num
 ; r4 still contains parent path length
 
 label printDirChildLoopStart
-; Call getchildn
-mov r0 SyscallIdDirGetChildN
-mov r3 pathBuf
+; Call getchildnext (the fd keeps track of which child is next)
+mov r0 SyscallIdDirGetChildNext
+mov r2 pathBuf
 syscall
 
 ; No child?
@@ -115,16 +114,13 @@ jmp printDirChildLoopEnd
 
 ; Call printDir recursively for child
 push8 r1
-push8 r2
 push8 r4
 mov r0 r4
 call printDir
 pop8 r4
-pop8 r2
 pop8 r1
 
 ; Loop again to try for next child
-inc r2
 jmp printDirChildLoopStart
 label printDirChildLoopEnd
 
@@ -0,0 +1,3 @@
+#!/bin/sh
+watch 0 blinkonce.sh
+exit
@@ -0,0 +1,6 @@
+#!/bin/sh
+setpin D13 1
+sleep 1
+setpin D13 0
+sleep 1
+exit
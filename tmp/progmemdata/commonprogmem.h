@@ -0,0 +1,156 @@
+// NOTE: File auto-generated (see builderprogmem script)
+
+#ifndef COMMONPROGMEM_H
+#define COMMONPROGMEM_H
+
+#include "../../src/kernel/kstr.h"
+
+#include "progmem_bin.h"
+#include "progmem_lib_curses.h"
+#include "progmem_lib_dht22.h"
+#include "progmem_lib_pin.h"
+#include "progmem_lib_spi.h"
+#include "progmem_lib_std_int32.h"
+#include "progmem_lib_std_io.h"
+#include "progmem_lib_std_math.h"
+#include "progmem_lib_std_mem.h"
+#include "progmem_lib_std_proc.h"
+#include "progmem_lib_std_rand.h"
+#include "progmem_lib_std_str.h"
+#include "progmem_lib_std_time.h"
+#include "progmem_lib_sys.h"
+#include "progmem_usr_bin.h"
+#include "progmem_usr_datalogger.h"
+#include "progmem_usr_games.h"
+#include "progmem_usr_man_1.h"
+#include "progmem_usr_man_2.h"
+#include "progmem_usr_man_3.h"
+#include "progmem_usr_man_6.h"
+
+#ifdef ARDUINO
+typedef uint32_t ProgmemDataPtr;
+#else
+typedef uintptr_t ProgmemDataPtr;
+#endif
+
+typedef struct {
+	KStr mountPoint;
+	ProgmemDataPtr dataPtr;
+	uint16_t size;
+	uint8_t compressed; // see minifscompress.h
+} ProgmemEntry;
+
+static ProgmemEntry commonProgmemData[]={
+	{.size=PROGMEM_binDATASIZE, .compressed=PROGMEM_binCOMPRESSED},
+	{.size=PROGMEM_lib_cursesDATASIZE, .compressed=PROGMEM_lib_cursesCOMPRESSED},
+	{.size=PROGMEM_lib_dht22DATASIZE, .compressed=PROGMEM_lib_dht22COMPRESSED},
+	{.size=PROGMEM_lib_pinDATASIZE, .compressed=PROGMEM_lib_pinCOMPRESSED},
+	{.size=PROGMEM_lib_spiDATASIZE, .compressed=PROGMEM_lib_spiCOMPRESSED},
+	{.size=PROGMEM_lib_std_int32DATASIZE, .compressed=PROGMEM_lib_std_int32COMPRESSED},
+	{.size=PROGMEM_lib_std_ioDATASIZE, .compressed=PROGMEM_lib_std_ioCOMPRESSED},
+	{.size=PROGMEM_lib_std_mathDATASIZE, .compressed=PROGMEM_lib_std_mathCOMPRESSED},
+	{.size=PROGMEM_lib_std_memDATASIZE, .compressed=PROGMEM_lib_std_memCOMPRESSED},
+	{.size=PROGMEM_lib_std_procDATASIZE, .compressed=PROGMEM_lib_std_procCOMPRESSED},
+	{.size=PROGMEM_lib_std_randDATASIZE, .compressed=PROGMEM_lib_std_randCOMPRESSED},
+	{.size=PROGMEM_lib_std_strDATASIZE, .compressed=PROGMEM_lib_std_strCOMPRESSED},
+	{.size=PROGMEM_lib_std_timeDATASIZE, .compressed=PROGMEM_lib_std_timeCOMPRESSED},
+	{.size=PROGMEM_lib_sysDATASIZE, .compressed=PROGMEM_lib_sysCOMPRESSED},
+	{.size=PROGMEM_usr_binDATASIZE, .compressed=PROGMEM_usr_binCOMPRESSED},
+	{.size=PROGMEM_usr_dataloggerDATASIZE, .compressed=PROGMEM_usr_dataloggerCOMPRESSED},
+	{.size=PROGMEM_usr_gamesDATASIZE, .compressed=PROGMEM_usr_gamesCOMPRESSED},
+	{.size=PROGMEM_usr_man_1DATASIZE, .compressed=PROGMEM_usr_man_1COMPRESSED},
+	{.size=PROGMEM_usr_man_2DATASIZE, .compressed=PROGMEM_usr_man_2COMPRESSED},
+	{.size=PROGMEM_usr_man_3DATASIZE, .compressed=PROGMEM_usr_man_3COMPRESSED},
+	{.size=PROGMEM_usr_man_6DATASIZE, .compressed=PROGMEM_usr_man_6COMPRESSED},
+};
+
+static unsigned commonProgmemCount=0;
+static void commonProgmemInit(void) {
+	// Note: this function is required because the Arduino data pointers can only be deciphered at run-time.
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/bin");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_binDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/curses");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_cursesDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/dht22");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_dht22DATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/pin");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_pinDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/spi");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_spiDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/std/int32");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_std_int32DATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/std/io");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_std_ioDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/std/math");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_std_mathDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/std/mem");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_std_memDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/std/proc");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_std_procDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/std/rand");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_std_randDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/std/str");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_std_strDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/std/time");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_std_timeDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/lib/sys");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_lib_sysDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/usr/bin");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_usr_binDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/usr/datalogger");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_usr_dataloggerDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/usr/games");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_usr_gamesDATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/usr/man/1");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_usr_man_1DATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/usr/man/2");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_usr_man_2DATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/usr/man/3");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_usr_man_3DATAPTR;
+	commonProgmemCount++;
+
+	commonProgmemData[commonProgmemCount].mountPoint=kstrP("/usr/man/6");
+	commonProgmemData[commonProgmemCount].dataPtr=PROGMEM_usr_man_6DATAPTR;
+	commonProgmemCount++;
+}
+
+#endif
@@ -0,0 +1,711 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_bin_H
+#define PROGMEM_bin_H
+
+#include <stdint.h>
+
+#define PROGMEM_binDATASIZE 11072u
+#define PROGMEM_binCOMPRESSED 0
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_binDATAPTR ((uint32_t)pgm_get_far_address(progmem_binData))
+static const uint8_t progmem_binData[PROGMEM_binDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_binDATAPTR ((uintptr_t)progmem_binData)
+static const uint8_t progmem_binData[PROGMEM_binDATASIZE]={
+#endif
+	0x26,0xAC,0x02,0x0B,0x14,0x18,0x26,0x37,0x38,0x3B,0x3C,0x57,0x59,0x70,0x74,0x83, // &.....&78;<WYpt. END
+	0x86,0x89,0x8C,0x93,0x9A,0x9B,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x02,0x04,0x09,0x72,0x6D,0x00,0x2F,0x2F,0xDE,0x80,0x80,0x83,0x91,0xC1,0xF2,0x40, // ...rm.//.......@ END
+	0xF8,0x58,0xD7,0x23,0xEE,0x40,0xD8,0x80,0x00,0xD5,0x88,0xFB,0x75,0xD8,0x01,0x0B, // .X.#.@......u... END
+	0xD9,0x80,0x00,0xC1,0x80,0xD5,0x84,0xFB,0x75,0xD8,0x01,0xEA,0xD5,0x2F,0xFB,0x75, // ........u..../.u END
+	0x81,0xD5,0x84,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70, // ....u.@.....@..p END
+	0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0x55,0xFB,0x75,0xEF,0x00,0xD8, // ..........U.u... END
+	0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0, // .............@.. END
+	0xEE,0x89,0xEE,0x40,0x82,0xD7,0x65,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80, // ...@..e......r.. END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2, // ...@............ END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xFB,0x83, // ...@.......@.... END
+	0xFB,0x8B,0xDD,0x01,0xD0,0xFB,0x75,0xFA,0x74,0xFB,0x8B,0xD8,0x80,0x40,0xDD,0x01, // ......u.t....@.. END
+	0xD0,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFB,0x83,0xFB,0x8B,0xD1,0x2F,0xDD,0x01,0xC6, // ..u.t.4...../... END
+	0xFB,0x75,0xF2,0x80,0xFA,0x74,0xFA,0x34,0xF8,0x88,0xDF,0x01,0x4E,0xEE,0x80,0xEE, // .u...t.4....N... END
+	0xC9,0xD8,0x02,0x04,0xC1,0xEE,0x40,0xEE,0x12,0xEE,0x89,0xEE,0x5B,0xFB,0x83,0xFB, // ......@.....[... END
+	0x8B,0xFB,0x93,0xEE,0x12,0xD1,0x3A,0xDD,0x01,0xC6,0xFB,0x75,0xEE,0xC0,0xF3,0x1B, // ......:....u.... END
+	0xFA,0xB4,0xFA,0x74,0xFA,0x34,0xF9,0x18,0xDF,0x01,0x47,0xFB,0x9B,0xFB,0x93,0xFB, // ...t.4....G..... END
+	0x83,0xFB,0x8B,0xD8,0x80,0x40,0xE7,0x1A,0xE4,0x04,0xD4,0x00,0x44,0xD8,0x80,0x40, // .....@......D..@ END
+	0xEE,0x52,0xE6,0x9A,0xDD,0x01,0xA2,0xFB,0x75,0xD8,0x80,0x40,0xD9,0x01,0xFA,0xDD, // .R......u..@.... END
+	0x01,0xAE,0xFB,0x75,0xD8,0x80,0x40,0xFA,0x74,0xFB,0x8B,0xDD,0x01,0xAE,0xFB,0x75, // ...u..@.t......u END
+	0xFA,0x74,0xFA,0x34,0xFA,0xB4,0xFA,0xF4,0xFB,0x83,0xFB,0x8B,0xD8,0x01,0x0A,0xD9, // .t.4............ END
+	0x80,0x40,0xC1,0xF3,0x00,0xFA,0x74,0xFA,0x34,0xF9,0x18,0xE1,0xC9,0xD9,0x80,0x40, // .@....t.4......@ END
+	0xDD,0x01,0xD0,0xFB,0x75,0xFB,0xF4,0xEE,0x9B,0xE0,0x80,0xD7,0xC7,0xDD,0x01,0x68, // ....u..........h END
+	0xFB,0x75,0xFB,0xF4,0xDD,0x01,0x68,0xFB,0x75,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8, // .u....h.u.....@. END
+	0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42, // ...............B END
+	0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x01,0x62, // ../............b END
+	0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x01,0xD0,0xFB,0x75,0xFA,0x34,0xFA, // .u.@.4......u.4. END
+	0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x01,0xFC,0xDD,0x01,0xAE,0xFB,0x75,0xFA,0x74,0xFA, // t...........u.t. END
+	0x34,0xDD,0x01,0xAE,0xFB,0x75,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06, // 4....u.......@.. END
+	0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x01,0x55,0xFB,0x75,0xEE,0x80,0xFA, // ..........U.u... END
+	0x74,0xFA,0x34,0xE4,0x02,0xDD,0x01,0xD0,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40, // t.4......u.....@ END
+	0xD8,0x06,0x00,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x01,0x55,0xFB, // ..............U. END
+	0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x01,0xA2,0xFB,0x75,0xFB,0xF4, // u.....t.4....u.. END
+	0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x72,0x6D,0x20,0x50,0x41,0x54,0x48,0x0A,0x00, // usage:.rm.PATH.. END
+	0x2F,0x00,0x2F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // /./............. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x02,0x0D,0x09,0x75,0x6E,0x6D,0x6F,0x75,0x6E,0x74,0x00,0x2F,0x2F,0xDE,0x80,0x80, // ...unmount.//... END
+	0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x23,0xEE,0x40,0xD8,0x80,0x00,0xD5,0x88, // ....@.X.#.@..... END
+	0xFB,0x75,0xD8,0x05,0x02,0xD9,0x80,0x00,0xC1,0x80,0xD5,0x84,0xFB,0x75,0xD8,0x01, // .u...........u.. END
+	0xEA,0xD5,0x2F,0xFB,0x75,0x81,0xD5,0x84,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89, // ../.u....u.@.... END
+	0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0x55, // .@..p..........U END
+	0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB, // .u.............. END
+	0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0x65,0xEE,0x89,0x90,0xC0, // ..@.....@..e.... END
+	0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3, // ..r.....@....... END
+	0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE, // ........@....... END
+	0x40,0x80,0xC1,0xFB,0x83,0xFB,0x8B,0xDD,0x01,0xD0,0xFB,0x75,0xFA,0x74,0xFB,0x8B, // @..........u.t.. END
+	0xD8,0x80,0x40,0xDD,0x01,0xD0,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFB,0x83,0xFB,0x8B, // ..@....u.t.4.... END
+	0xD1,0x2F,0xDD,0x01,0xC6,0xFB,0x75,0xF2,0x80,0xFA,0x74,0xFA,0x34,0xF8,0x88,0xDF, // ./....u...t.4... END
+	0x01,0x4E,0xEE,0x80,0xEE,0xC9,0xD8,0x02,0x04,0xC1,0xEE,0x40,0xEE,0x12,0xEE,0x89, // .N.........@.... END
+	0xEE,0x5B,0xFB,0x83,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD1,0x3A,0xDD,0x01,0xC6,0xFB, // .[.........:.... END
+	0x75,0xEE,0xC0,0xF3,0x1B,0xFA,0xB4,0xFA,0x74,0xFA,0x34,0xF9,0x18,0xDF,0x01,0x47, // u.......t.4....G END
+	0xFB,0x9B,0xFB,0x93,0xFB,0x83,0xFB,0x8B,0xD8,0x80,0x40,0xE7,0x1A,0xE4,0x04,0xD4, // ..........@..... END
+	0x00,0x44,0xD8,0x80,0x40,0xEE,0x52,0xE6,0x9A,0xDD,0x01,0xA2,0xFB,0x75,0xD8,0x80, // .D..@.R......u.. END
+	0x40,0xD9,0x01,0xFE,0xDD,0x01,0xAE,0xFB,0x75,0xD8,0x80,0x40,0xFA,0x74,0xFB,0x8B, // @.......u..@.t.. END
+	0xDD,0x01,0xAE,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFA,0xB4,0xFA,0xF4,0xFB,0x83,0xFB, // ....u.t.4....... END
+	0x8B,0xD8,0x01,0x0A,0xD9,0x80,0x40,0xC1,0xF3,0x00,0xFA,0x74,0xFA,0x34,0xF9,0x18, // ......@....t.4.. END
+	0xE1,0xC9,0xD9,0x80,0x40,0xDD,0x01,0xD0,0xFB,0x75,0xFB,0xF4,0xEE,0x9B,0xE0,0x80, // ....@....u...... END
+	0xD7,0xC7,0xDD,0x01,0x68,0xFB,0x75,0xFB,0xF4,0xDD,0x01,0x68,0xFB,0x75,0xFB,0xF4, // ....h.u....h.u.. END
+	0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xD8,0x02,0x02, // ...@............ END
+	0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B, // ....B../........ END
+	0xFB,0x83,0xDD,0x01,0x62,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x01,0xD0, // ....b.u.@.4..... END
+	0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x02,0x00,0xDD,0x01,0xAE, // .u.4.t.......... END
+	0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x01,0xAE,0xFB,0x75,0xFB,0xF4,0xEE,0xD2,0xEE, // .u.t.4....u..... END
+	0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x01,0x55, // ..@............U END
+	0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x01,0xD0,0xFB,0x75,0xFB, // .u...t.4......u. END
+	0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x00,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE, // ....@........... END
+	0x09,0xDD,0x01,0x55,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x01, // ...U.u.....t.4.. END
+	0xA2,0xFB,0x75,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x75,0x6E,0x6D,0x6F, // ..u..usage:.unmo END
+	0x75,0x6E,0x74,0x20,0x64,0x69,0x72,0x0A,0x00,0x2F,0x00,0x2F,0x00,0xFF,0xFF,0xFF, // unt.dir.././.... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0xE2,0x04,0x73,0x69,0x67,0x6E,0x61,0x6C,0x00,0x2F,0x2F,0xDE,0x80,0x00,0x83, // ...signal.//.... END
+	0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x2E,0xD5,0x91,0xFB,0x75,0x70,0xE1,0x80,0x83, // ...@.X.....up... END
+	0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x2E,0xD5,0x91,0xFB,0x75,0xEE,0x80,0xE3,0x80, // ...@.X.....u.... END
+	0x0E,0x8C,0xC1,0x80,0xD5,0x8D,0xFB,0x75,0xD0,0xBD,0xD5,0x39,0xFB,0x75,0x81,0xD5, // .......u...9.u.. END
+	0x8D,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80, // ..u.@.....@..p.. END
+	0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD5,0xB0,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA, // .........u...... END
+	0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ..........@..... END
+	0x40,0x82,0xD7,0x6E,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE, // @..n......r..... END
+	0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE, // @............... END
+	0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF,0xB0, // @.......@....... END
+	0xF2,0xD3,0xF8,0xF8,0xD7,0xAC,0xB9,0xF2,0xD3,0xF8,0xE8,0xD7,0xAC,0xBA,0xE8,0x4B, // ...............K END
+	0xE4,0x4A,0xE0,0x00,0xD7,0x92,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06, // .J...........@.. END
+	0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x73,0x69, // .......usage:.si END
+	0x67,0x6E,0x61,0x6C,0x20,0x70,0x69,0x64,0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x69, // gnal.pid.signali END
+	0x64,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // d............... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x03,0x76,0x0E,0x72,0x65,0x6D,0x6F,0x75,0x6E,0x74,0x00,0x2F,0x2F,0xDE,0x80,0xC2, // .v.remount.//... END
+	0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xDF,0x01,0x0D,0xFB,0x83,0xD9,0x02,0xE1,0xDD, // ....@.X......... END
+	0x02,0x42,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0x9B,0xFB,0x83,0xD9,0x02, // .B.u.@.4.X...... END
+	0xEE,0xDD,0x02,0x42,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0xA3,0xFB,0x83, // ...B.u.@.4.X.... END
+	0xD9,0x02,0xF7,0xDD,0x02,0x42,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0xAB, // .....B.u.@.4.X.. END
+	0xFB,0x83,0xD9,0x03,0x02,0xDD,0x02,0x42,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58, // .......B.u.@.4.X END
+	0xD7,0xB3,0xFB,0x83,0xD9,0x03,0x0D,0xDD,0x02,0x42,0xFB,0x75,0xF2,0x40,0xFA,0x34, // .........B.u.@.4 END
+	0xF8,0x58,0xD7,0xBB,0xFB,0x83,0xD9,0x03,0x18,0xDD,0x02,0x42,0xFB,0x75,0xF2,0x40, // .X.........B.u.@ END
+	0xFA,0x34,0xF8,0x58,0xD7,0xC3,0xFB,0x83,0xD9,0x03,0x23,0xDD,0x02,0x42,0xFB,0x75, // .4.X......#..B.u END
+	0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0xCB,0xD8,0x03,0x2B,0xDD,0x01,0x1B,0xFB,0x75, // .@.4.X....+....u END
+	0x81,0xDD,0x01,0x70,0xFB,0x75,0xD8,0x80,0x00,0x90,0xFA,0x09,0xD7,0xD2,0xD8,0x80, // ...p.u.......... END
+	0x00,0x91,0xFA,0x09,0xD7,0xD2,0xD8,0x80,0x00,0x92,0xFA,0x09,0xD7,0xD2,0xD8,0x80, // ................ END
+	0x00,0x93,0xFA,0x09,0xD7,0xD2,0xD8,0x80,0x00,0x94,0xFA,0x09,0xD7,0xD2,0xD8,0x80, // ................ END
+	0x00,0x95,0xFA,0x09,0xD7,0xD2,0xD8,0x80,0x00,0x96,0xFA,0x09,0xC0,0x83,0x92,0xC1, // ................ END
+	0xF2,0x40,0xF8,0x58,0xE1,0xF1,0xEE,0x40,0xD8,0x80,0x02,0xDD,0x01,0x74,0xFB,0x75, // .@.X...@.....t.u END
+	0x83,0x93,0xC1,0xF2,0x40,0xF8,0x58,0xE1,0xDE,0xEE,0x40,0xD8,0x80,0x42,0xDD,0x01, // ....@.X...@..B.. END
+	0x74,0xFB,0x75,0xD8,0x05,0x07,0xD9,0x80,0x00,0xFA,0x4A,0xDA,0x80,0x02,0xDB,0x80, // t.u.......J..... END
+	0x42,0xC1,0x80,0xDD,0x01,0x70,0xFB,0x75,0xD8,0x03,0x41,0xDD,0x01,0x1B,0xFB,0x75, // B....p.u..A....u END
+	0x81,0xDD,0x01,0x70,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0, // ...p.u.@.....@.. END
+	0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x02,0x4C,0xFB,0x75,0xEF,0x00, // p..........L.u.. END
+	0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80, // ..............@. END
+	0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1, // ....@.........r. END
+	0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE, // ....@........... END
+	0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xFB, // ....@.......@... END
+	0x83,0xFB,0x8B,0xDD,0x02,0xC7,0xFB,0x75,0xFA,0x74,0xFB,0x8B,0xD8,0x80,0x82,0xDD, // .......u.t...... END
+	0x02,0xC7,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFB,0x83,0xFB,0x8B,0xD1,0x2F,0xDD,0x02, // ...u.t.4...../.. END
+	0xBD,0xFB,0x75,0xF2,0x80,0xFA,0x74,0xFA,0x34,0xF8,0x88,0xDF,0x02,0x3B,0xEE,0x80, // ..u...t.4....;.. END
+	0xEE,0xC9,0xD8,0x02,0x04,0xC1,0xEE,0x40,0xEE,0x12,0xEE,0x89,0xEE,0x5B,0xFB,0x83, // .......@.....[.. END
+	0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD1,0x3A,0xDD,0x02,0xBD,0xFB,0x75,0xEE,0xC0,0xF3, // .......:....u... END
+	0x1B,0xFA,0xB4,0xFA,0x74,0xFA,0x34,0xF9,0x18,0xDF,0x02,0x34,0xFB,0x9B,0xFB,0x93, // ....t.4....4.... END
+	0xFB,0x83,0xFB,0x8B,0xD8,0x80,0x82,0xE7,0x1A,0xE4,0x04,0xD4,0x00,0x44,0xD8,0x80, // .............D.. END
+	0x82,0xEE,0x52,0xE6,0x9A,0xDD,0x02,0x99,0xFB,0x75,0xD8,0x80,0x82,0xD9,0x03,0x67, // ..R......u.....g END
+	0xDD,0x02,0xA5,0xFB,0x75,0xD8,0x80,0x82,0xFA,0x74,0xFB,0x8B,0xDD,0x02,0xA5,0xFB, // ....u....t...... END
+	0x75,0xFA,0x74,0xFA,0x34,0xFA,0xB4,0xFA,0xF4,0xFB,0x83,0xFB,0x8B,0xD8,0x01,0x0A, // u.t.4........... END
+	0xD9,0x80,0x82,0xC1,0xF3,0x00,0xFA,0x74,0xFA,0x34,0xF9,0x18,0xE1,0xC9,0xD9,0x80, // .......t.4...... END
+	0x82,0xDD,0x02,0xC7,0xFB,0x75,0xFB,0xF4,0xEE,0x9B,0xE0,0x80,0xDF,0x01,0xB3,0xDD, // .....u.......... END
+	0x02,0x5F,0xFB,0x75,0xFB,0xF4,0xDD,0x02,0x5F,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE, // ._.u...._.u..... END
+	0x40,0xD8,0x06,0x05,0xC1,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1, // @.........@..... END
+	0xE6,0x03,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F,0xF2, // ...........B../. END
+	0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x02,0x59,0xFB,0x75,0xEE,0x40, // ...........Y.u.@ END
+	0xFA,0x34,0xFB,0x83,0xDD,0x02,0xC7,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83,0xFB, // .4......u.4.t... END
+	0x8B,0xD9,0x03,0x69,0xDD,0x02,0xA5,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x02,0xA5, // ...i....u.t.4... END
+	0xFB,0x75,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4, // .u.......@...... END
+	0xFB,0x83,0xFB,0x8B,0xDD,0x02,0x4C,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4, // ......L.u...t.4. END
+	0x02,0xDD,0x02,0xC7,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x00,0xC1, // .....u.....@.... END
+	0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x02,0x4C,0xFB,0x75,0xEE,0x80,0xE0, // ..........L.u... END
+	0x80,0xFA,0x74,0xFA,0x34,0xDD,0x02,0x99,0xFB,0x75,0xFB,0xF4,0x63,0x75,0x73,0x74, // ..t.4....u..cust END
+	0x6F,0x6D,0x6D,0x69,0x6E,0x69,0x66,0x73,0x00,0x66,0x6C,0x61,0x74,0x66,0x69,0x6C, // omminifs.flatfil END
+	0x65,0x00,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6F,0x6E,0x31,0x00,0x70,0x61,0x72, // e.partition1.par END
+	0x74,0x69,0x74,0x69,0x6F,0x6E,0x32,0x00,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6F, // tition2.partitio END
+	0x6E,0x33,0x00,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6F,0x6E,0x34,0x00,0x63,0x69, // n3.partition4.ci END
+	0x72,0x63,0x62,0x75,0x66,0x00,0x62,0x61,0x64,0x20,0x6E,0x65,0x77,0x54,0x79,0x70, // rcbuf.bad.newTyp END
+	0x65,0x20,0x61,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x0A,0x00,0x75,0x73,0x61,0x67, // e.argument..usag END
+	0x65,0x3A,0x20,0x72,0x65,0x6D,0x6F,0x75,0x6E,0x74,0x20,0x6E,0x65,0x77,0x54,0x79, // e:.remount.newTy END
+	0x70,0x65,0x20,0x6E,0x65,0x77,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x64,0x69,0x72, // pe.newDevice.dir END
+	0x0A,0x00,0x2F,0x00,0x2F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // .././........... END
+	0x04,0x0A,0x11,0x63,0x70,0x00,0x2F,0x2F,0xDE,0x80,0x8A,0xD8,0x04,0x00,0x93,0xAD, // ...cp.//........ END
+	0xC1,0xD7,0x10,0x80,0x91,0xC1,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0xB5,0xEE, // ..........@.X... END
+	0x40,0xD8,0x80,0x00,0xDD,0x02,0xB0,0xFB,0x75,0xD8,0x80,0x00,0x91,0xDD,0x03,0x7E, // @.......u......~ END
+	0xFB,0x75,0xF2,0x40,0xF8,0x58,0xD7,0xC3,0xD9,0x80,0x40,0x48,0xD8,0x01,0x0F,0xD9, // .u.@.X....@H.... END
+	0x80,0x00,0xDA,0x80,0x42,0xC1,0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0xB5,0xEE, // ....B.....@.X... END
+	0x40,0xD8,0x80,0x00,0xDD,0x02,0xB0,0xFB,0x75,0xEE,0x80,0xD8,0x01,0x0E,0xD9,0x80, // @.......u....... END
+	0x00,0xDA,0x80,0x42,0xC1,0xD8,0x80,0x00,0x92,0xDD,0x03,0x7E,0xFB,0x75,0xF2,0x40, // ...B.......~.u.@ END
+	0xF8,0x58,0xD7,0xD1,0xD9,0x80,0x41,0x48,0xD8,0x80,0x42,0x90,0xD5,0xEC,0xFB,0x75, // .X....AH..B....u END
+	0xD8,0x01,0x0C,0xD9,0x80,0x40,0x09,0xDA,0x80,0x42,0xDB,0x80,0x00,0xD4,0x01,0xC1, // .....@...B...... END
+	0xF2,0x00,0xF8,0x18,0xD7,0xAF,0xD8,0x01,0x0D,0xD9,0x80,0x41,0x09,0xDA,0x80,0x42, // ...........A...B END
+	0xDB,0x80,0x00,0xD4,0x01,0xC1,0xF2,0x00,0xF8,0x18,0xD7,0xAF,0xD8,0x80,0x42,0xD5, // ..............B. END
+	0xDF,0xFB,0x75,0xD7,0x7A,0x80,0xDD,0x02,0x2E,0xFB,0x75,0xD8,0x03,0xB6,0xDD,0x01, // ..u.z.....u..... END
+	0xD9,0xFB,0x75,0x81,0xDD,0x02,0x2E,0xFB,0x75,0xD8,0x03,0xCD,0xDD,0x01,0xD9,0xFB, // ..u.....u....... END
+	0x75,0x81,0xDD,0x02,0x2E,0xFB,0x75,0xD8,0x03,0xE4,0xDD,0x01,0xD9,0xFB,0x75,0x81, // u.....u.......u. END
+	0xDD,0x02,0x2E,0xFB,0x75,0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08,0xFB,0xF4,0xFC,0x09, // ....u........... END
+	0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13,0x02, // ................ END
+	0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02,0xFB, // ................ END
+	0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xEE,0x80, // ................ END
+	0xEE,0xC9,0x81,0x90,0xC0,0xFB,0x93,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00, // ............@... END
+	0xD4,0x01,0xC1,0xF8,0x00,0xE1,0xCD,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1, // .......#........ END
+	0xC3,0xE0,0x80,0xE3,0xD7,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0x70,0xE1,0x80, // ......X.4....p.. END
+	0xFB,0x93,0xFB,0x9B,0xD8,0x80,0x46,0xDD,0x01,0x12,0xFB,0x75,0xFA,0xF4,0xFA,0xB4, // ......F....u.... END
+	0xE3,0x80,0x06,0xFB,0x93,0xEE,0xD2,0xEE,0x40,0xD8,0x01,0x0C,0xDA,0x80,0x46,0xD4, // ........@.....F. END
+	0x01,0xC1,0xF8,0x00,0xE1,0xE0,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1,0xD6, // ......#......... END
+	0x71,0xE1,0x80,0xFB,0x93,0xFB,0x9B,0xD8,0x80,0x46,0xD5,0xDF,0xFB,0x75,0xFA,0xF4, // q........F...u.. END
+	0xFA,0xB4,0xE3,0x80,0x0E,0xE3,0xED,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0xEE, // ........X.4..... END
+	0x89,0xEE,0x40,0xD8,0x01,0x00,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00,0xF8, // ..@............. END
+	0x08,0xE1,0xC6,0xE3,0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4,0xEE, // ................ END
+	0x89,0xEE,0x40,0xD8,0x01,0x0C,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00,0xF8, // ..@............. END
+	0x08,0xE1,0xC6,0xE3,0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4,0xEE, // ................ END
+	0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93, // @.....@..p...... END
+	0xEE,0x12,0xDD,0x03,0x9F,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4, // ......u......... END
+	0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1, // .......@.....@.. END
+	0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01, // .......r.....@.. END
+	0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01, // .............@.. END
+	0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06, // .....@.......@.. END
+	0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x03,0x9F,0xFB,0x75,0xEE, // ..............u. END
+	0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x02,0x32,0xFB,0x75,0xFB,0xF4,0xFB,0x83, // ....t.4..2.u.... END
+	0xFB,0x8B,0xDD,0x03,0x9F,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD, // ......u...t.4... END
+	0x02,0x3E,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3, // .>.u.........B.. END
+	0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x02,0x70,0xFB,0x75, // /............p.u END
+	0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x02,0x3E,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB, // .@.4....>.u.4.t. END
+	0x83,0xFB,0x8B,0xD9,0x04,0x00,0xDD,0x02,0x58,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD, // ........X.u.t.4. END
+	0x02,0x58,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x02,0x3E,0xFB,0x75,0xFA, // .X.u........>.u. END
+	0x74,0xFB,0x8B,0xD8,0x80,0x4A,0xDD,0x02,0x3E,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFB, // t....J..>.u.t.4. END
+	0x83,0xFB,0x8B,0xD1,0x2F,0xDD,0x03,0xAC,0xFB,0x75,0xF2,0x80,0xFA,0x74,0xFA,0x34, // ..../....u...t.4 END
+	0xF8,0x88,0xDF,0x03,0x77,0xEE,0x80,0xEE,0xC9,0xD8,0x02,0x04,0xC1,0xEE,0x40,0xEE, // ....w.........@. END
+	0x12,0xEE,0x89,0xEE,0x5B,0xFB,0x83,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD1,0x3A,0xDD, // ....[.........:. END
+	0x03,0xAC,0xFB,0x75,0xEE,0xC0,0xF3,0x1B,0xFA,0xB4,0xFA,0x74,0xFA,0x34,0xF9,0x18, // ...u.......t.4.. END
+	0xDF,0x03,0x70,0xFB,0x9B,0xFB,0x93,0xFB,0x83,0xFB,0x8B,0xD8,0x80,0x4A,0xE7,0x1A, // ..p..........J.. END
+	0xE4,0x04,0xD4,0x00,0x44,0xD8,0x80,0x4A,0xEE,0x52,0xE6,0x9A,0xDD,0x02,0x32,0xFB, // ....D..J.R....2. END
+	0x75,0xD8,0x80,0x4A,0xD9,0x04,0x02,0xDD,0x02,0x58,0xFB,0x75,0xD8,0x80,0x4A,0xFA, // u..J.....X.u..J. END
+	0x74,0xFB,0x8B,0xDD,0x02,0x58,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFA,0xB4,0xFA,0xF4, // t....X.u.t.4.... END
+	0xFB,0x83,0xFB,0x8B,0xD8,0x01,0x0A,0xD9,0x80,0x4A,0xC1,0xF3,0x00,0xFA,0x74,0xFA, // .........J....t. END
+	0x34,0xF9,0x18,0xE1,0xC9,0xD9,0x80,0x4A,0xDD,0x02,0x3E,0xFB,0x75,0xFB,0xF4,0xEE, // 4......J..>.u... END
+	0x9B,0xE0,0x80,0xDF,0x02,0xEF,0xDD,0x02,0x76,0xFB,0x75,0xFB,0xF4,0xDD,0x02,0x76, // ........v.u....v END
+	0xFB,0x75,0xFB,0xF4,0xEE,0xC9,0xEE,0x40,0xEE,0x36,0xD2,0x40,0xE5,0xB2,0x73,0xE1, // .u.....@.6.@..s. END
+	0x80,0xDD,0x02,0xB0,0xFB,0x75,0xE3,0x80,0x16,0xD8,0x01,0x02,0xD1,0x40,0xE6,0x71, // .....u.......@.q END
+	0xC1,0xEF,0x89,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03, // ........@....... END
+	0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x00,0xC1,0xFB,0xF4,0x75,0x73,0x61,0x67, // .....@......usag END
+	0x65,0x3A,0x20,0x63,0x70,0x20,0x53,0x4F,0x55,0x52,0x43,0x45,0x20,0x44,0x45,0x53, // e:.cp.SOURCE.DES END
+	0x54,0x0A,0x00,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x6F,0x70,0x65, // T..could.not.ope END
+	0x6E,0x20,0x73,0x6F,0x75,0x72,0x63,0x65,0x0A,0x00,0x63,0x6F,0x75,0x6C,0x64,0x20, // n.source..could. END
+	0x6E,0x6F,0x74,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x2F,0x6F,0x70,0x65,0x6E,0x20, // not.create/open. END
+	0x64,0x65,0x73,0x74,0x0A,0x00,0x2F,0x00,0x2F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // dest.././....... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x0E,0x01,0x66,0x61,0x6C,0x73,0x65,0x00,0x2F,0x2F,0x80,0x91,0xC1,0xFF,0xFF, // ...false.//..... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0xB6,0x03,0x79,0x65,0x73,0x00,0x2F,0x2F,0xDE,0x80,0x00,0xD8,0x04,0x00,0x93, // ...yes.//....... END
+	0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD0,0xAD, // ...........@.X.. END
+	0xFB,0x83,0xD5,0x28,0xFB,0x75,0x8A,0xD5,0x4E,0xFB,0x75,0xFA,0x34,0xD7,0x19,0xEE, // ...(.u..N.u.4... END
+	0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93, // @.....@..p...... END
+	0xEE,0x12,0xD5,0xA0,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3, // .....u.......... END
+	0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0x5D, // ......@.....@..] END
+	0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01, // ......r.....@... END
+	0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10, // ............@... END
+	0xC1,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB, // ........@....... END
+	0x83,0xFB,0x8B,0xEE,0x09,0xD5,0xA0,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA, // ........u.....t. END
+	0x34,0xD5,0x7C,0xFB,0x75,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1, // 4.|.u.....@..... END
+	0xE6,0x03,0xFB,0xF4,0x79,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ....y........... END
+	0x00,0x18,0x01,0x73,0x68,0x75,0x74,0x64,0x6F,0x77,0x6E,0x00,0x2F,0x2F,0xDE,0x80, // ...shutdown.//.. END
+	0x00,0xD8,0x05,0x00,0xC1,0x80,0x90,0xC1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x06,0xAC,0x1B,0x73,0x68,0x00,0x2F,0x2F,0xDE,0x81,0x4F,0xD7,0x0D,0xDF,0x02,0x49, // ...sh.//..O....I END
+	0xDF,0x02,0x6C,0x90,0xD8,0x81,0x09,0x41,0xD8,0x81,0x0A,0x41,0xD8,0x81,0x08,0xD1, // ..l....A...A.... END
+	0x10,0x41,0xD8,0x04,0x00,0x93,0xA7,0xC1,0xD8,0x04,0x00,0x90,0xAA,0xC1,0x91,0x71, // .A.............q END
+	0xE1,0x80,0x83,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x62,0x91,0xDD,0x04,0x96,0xFB,0x75, // .....@.X.b.....u END
+	0xD9,0x81,0x02,0x48,0x80,0xD9,0x81,0x01,0x48,0xD5,0x7F,0xFB,0x75,0x70,0xE1,0x80, // ...H....H...up.. END
+	0xD8,0x01,0x03,0xD9,0x81,0x02,0x09,0xC1,0xE3,0x80,0x06,0xF2,0x00,0xF8,0x18,0xD7, // ................ END
+	0x73,0xE3,0x80,0x0E,0xE0,0x40,0xD7,0x29,0xE3,0x80,0x0E,0x81,0xD9,0x81,0x02,0x48, // s....@.).......H END
+	0x81,0xD9,0x81,0x01,0x48,0xD5,0x7F,0xFB,0x75,0x80,0xDD,0x04,0x0C,0xFB,0x75,0x81, // ....H...u.....u. END
+	0xDD,0x04,0x0C,0xFB,0x75,0xD8,0x81,0x03,0x90,0xDD,0x02,0xC9,0xFB,0x75,0xD8,0x81, // ....u........u.. END
+	0x01,0x00,0xF2,0x00,0xF8,0x18,0xD7,0xA4,0xDD,0x04,0x88,0xFB,0x75,0xDD,0x03,0xB7, // ............u... END
+	0xFB,0x75,0xD8,0x06,0x5C,0xDD,0x03,0xB7,0xFB,0x75,0xD8,0x81,0x02,0x00,0xD9,0x81, // .u..\....u...... END
+	0x03,0xDA,0x80,0x00,0xD3,0x80,0xDD,0x03,0x24,0xFB,0x75,0xFB,0x83,0xEE,0x40,0xD8, // ........$.u...@. END
+	0x81,0x03,0xDD,0x02,0xC1,0xFB,0x75,0xFA,0x34,0xF2,0x00,0xF8,0x08,0xD7,0xCC,0x81, // ......u.4....... END
+	0xFB,0xF4,0xD8,0x81,0x00,0x91,0x41,0xD8,0x80,0x00,0xDD,0x05,0x61,0xFB,0x75,0xD8, // ......A.....a.u. END
+	0x80,0x00,0xD1,0x23,0xDD,0x05,0x4D,0xFB,0x75,0xF2,0x40,0xF8,0x58,0xD7,0xEB,0x90, // ...#..M.u.@.X... END
+	0x41,0xD8,0x80,0x00,0x00,0xF2,0x00,0xF8,0x18,0xD7,0x88,0xD8,0x81,0x07,0x90,0x41, // A..............A END
+	0xD8,0x80,0x00,0xDD,0x05,0x81,0xFB,0x75,0xF2,0x40,0xF8,0x58,0xE1,0xD6,0xD9,0x80, // .......u.@.X.... END
+	0x00,0xE4,0x01,0xE2,0x00,0x18,0xD1,0x26,0xF2,0x99,0xF8,0x80,0xE1,0xC6,0x90,0x41, // .......&.......A END
+	0xD8,0x81,0x07,0x91,0x41,0xD8,0x80,0x00,0xD1,0x20,0xDD,0x05,0x43,0xFB,0x75,0xF2, // ....A.......C.u. END
+	0x40,0xF8,0x58,0xE1,0xCC,0x90,0x41,0xE0,0x00,0xD9,0x81,0x00,0x11,0xE0,0x80,0x4A, // @.X...A........J END
+	0xE3,0xD9,0xD8,0x80,0x00,0xD9,0x06,0x94,0xDD,0x05,0x57,0xFB,0x75,0xF2,0x00,0xF8, // ..........W.u... END
+	0x08,0xE1,0xC6,0xDD,0x01,0xD2,0xFB,0x75,0xD7,0x88,0xD8,0x80,0x00,0xD9,0x06,0x97, // .......u........ END
+	0xDD,0x05,0x57,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xE1,0xC2,0x80,0xFB,0xF4,0xDD,0x01, // ..W.u........... END
+	0x6F,0xFB,0x75,0xD7,0x88,0x84,0xC1,0xD9,0x81,0x08,0x48,0xD1,0x10,0xF2,0x41,0xF8, // o.u.......H...A. END
+	0x50,0xDF,0x01,0xC8,0xF8,0x58,0xE1,0xC1,0xE1,0xE4,0xD8,0x81,0x00,0x00,0xD9,0x80, // P....X.......... END
+	0x00,0xDD,0x04,0xB7,0xFB,0x75,0xD8,0x06,0x6F,0xDD,0x03,0xB7,0xFB,0x75,0xD8,0x80, // .....u..o....u.. END
+	0x00,0xDD,0x03,0xB7,0xFB,0x75,0x8A,0xDD,0x03,0xDE,0xFB,0x75,0x80,0x91,0xC1,0xD9, // .....u.....u.... END
+	0x81,0x07,0x09,0xF2,0x49,0xF8,0x48,0xE1,0xD2,0xDD,0x05,0x33,0xFB,0x75,0xD0,0x10, // ....I.H....3.u.. END
+	0xD9,0x81,0x08,0x48,0xD8,0x81,0x0A,0xDD,0x05,0x20,0xFB,0x75,0xFB,0xF4,0xD8,0x06, // ...H.......u.... END
+	0x5F,0xDD,0x03,0xB7,0xFB,0x75,0xFB,0xF4,0xD8,0x81,0x00,0x00,0xF2,0x00,0xF8,0x18, // _....u.......... END
+	0xE1,0xD1,0xD8,0x80,0x00,0xE0,0x02,0xDD,0x05,0x81,0xFB,0x75,0xF2,0x00,0xF8,0x18, // ...........u.... END
+	0xE1,0xC1,0xE1,0xCC,0xD8,0x80,0x80,0xD9,0x06,0x9C,0xDD,0x04,0x1C,0xFB,0x75,0xE1, // ..............u. END
+	0xD4,0xD8,0x80,0x80,0xD9,0x80,0x00,0xE0,0x42,0xDD,0x04,0x4E,0xFB,0x75,0xD8,0x80, // ........B..N.u.. END
+	0x80,0xDD,0x04,0x8E,0xFB,0x75,0xD8,0x01,0x09,0xD9,0x80,0x80,0xC1,0xF2,0x00,0xF8, // .....u.......... END
+	0x08,0xE1,0xD7,0xD8,0x06,0x80,0xDD,0x03,0xB7,0xFB,0x75,0xD8,0x80,0x80,0xDD,0x03, // ..........u..... END
+	0xB7,0xFB,0x75,0x8A,0xDD,0x03,0xDE,0xFB,0x75,0xFB,0xF4,0xD8,0x80,0xC0,0xD9,0x80, // ..u.....u....... END
+	0x80,0xDD,0x04,0x1C,0xFB,0x75,0xD8,0x02,0x03,0xD9,0x80,0xC0,0xC1,0xFB,0xF4,0xFB, // .....u.......... END
+	0x83,0xFB,0x8B,0xFB,0xAB,0xD8,0x81,0x09,0xDD,0x05,0x0E,0xFB,0x75,0xF2,0x00,0xF8, // ............u... END
+	0x18,0xE1,0xC6,0xDD,0x02,0x6C,0xFB,0x75,0xD7,0x73,0xFB,0x74,0xFA,0x74,0xFA,0x34, // .....l.u.s.t.t.4 END
+	0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xFB,0x93,0xFB,0xAB,0xD8,0x81,0x0A,0xDD,0x05,0x0E, // ................ END
+	0xFB,0x75,0xF2,0x00,0xF8,0x18,0xE1,0xEF,0xD9,0x81,0x08,0x09,0xD0,0x10,0xF2,0x08, // .u.............. END
+	0xF8,0x10,0xE1,0xDB,0x8C,0xA3,0xC1,0x86,0xA5,0xC1,0xDA,0xFF,0xFB,0xF2,0x82,0xF8, // ................ END
+	0x90,0xE3,0xCB,0xDA,0xFF,0xFF,0xF2,0x82,0xF8,0x80,0xE1,0xCB,0x8A,0xC1,0xE1,0xC7, // ................ END
+	0xD8,0x81,0x0A,0xDD,0x05,0x20,0xFB,0x75,0xFB,0x74,0xFA,0xB4,0xFA,0x74,0xFA,0x34, // .......u.t...t.4 END
+	0xFB,0xF4,0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08,0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xA0, // ................ END
+	0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13,0x02,0xFB,0xF4,0xD3, // ................ END
+	0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02,0xFB,0xF4,0xFA,0x09, // ................ END
+	0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xEE,0x80,0xEE,0xC9,0x81, // ................ END
+	0x90,0xC0,0xFB,0x93,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00,0xD4,0x01,0xC1, // .........@...... END
+	0xF8,0x00,0xE1,0xCD,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1,0xC3,0xE0,0x80, // ....#........... END
+	0xE3,0xD7,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0x70,0xE1,0x80,0xFB,0x93,0xFB, // ...X.4....p..... END
+	0x9B,0xD8,0x81,0x0B,0xDD,0x02,0xEF,0xFB,0x75,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x06, // ........u....... END
+	0xFB,0x93,0xEE,0xD2,0xEE,0x40,0xD8,0x01,0x0C,0xDA,0x81,0x0B,0xD4,0x01,0xC1,0xF8, // .....@.......... END
+	0x00,0xE1,0xE1,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1,0xD7,0x71,0xE1,0x80, // ...#.........q.. END
+	0xFB,0x93,0xFB,0x9B,0xD8,0x81,0x0B,0xDD,0x02,0xBC,0xFB,0x75,0xFA,0xF4,0xFA,0xB4, // ...........u.... END
+	0xE3,0x80,0x0E,0xE3,0xEE,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0xEE,0x89,0xEE, // ......X.4....... END
+	0x40,0xD8,0x01,0x00,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00,0xF8,0x08,0xE1, // @............... END
+	0xC6,0xE3,0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4,0xEE,0x89,0xEE, // ................ END
+	0x40,0xD8,0x01,0x0C,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00,0xF8,0x08,0xE1, // @............... END
+	0xC6,0xE3,0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4,0xEE,0x40,0x80, // ..............@. END
+	0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12, // ....@..p........ END
+	0xDD,0x05,0x81,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80, // ....u........... END
+	0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE, // .....@.....@.... END
+	0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4, // .....r.....@.... END
+	0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1, // ...........@.... END
+	0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1, // ...@.......@.... END
+	0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x05,0x81,0xFB,0x75,0xEE,0x80,0xE0, // ............u... END
+	0x80,0xFA,0x74,0xFA,0x34,0xDD,0x04,0x10,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x8B, // ..t.4....u...... END
+	0xDD,0x05,0x81,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x04,0x1C, // ....u...t.4..... END
+	0xFB,0x75,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB, // .u...B../....... END
+	0x8B,0xFB,0x83,0xDD,0x04,0x88,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x04, // .......u.@.4.... END
+	0x1C,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x06,0xA2,0xDD,0x04, // ..u.4.t......... END
+	0x36,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x04,0x36,0xFB,0x75,0xFB,0xF4,0xD8,0x02, // 6.u.t.4..6.u.... END
+	0x02,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x06,0x08,0xC1,0xFB,0xF4,0xEE,0xC9,0xEE,0x40, // .....@.........@ END
+	0xEE,0x36,0xD2,0x40,0xE5,0xB2,0x73,0xE1,0x80,0xDD,0x05,0x8E,0xFB,0x75,0xE3,0x80, // .6.@..s......u.. END
+	0x16,0xD8,0x01,0x02,0xD1,0x40,0xE6,0x71,0xC1,0xEF,0x89,0xFB,0xF4,0xB1,0xEE,0x89, // .....@.q........ END
+	0xEE,0x40,0x85,0xC1,0xFB,0xF4,0xDF,0x05,0x33,0xDB,0x04,0xD4,0xFA,0x59,0xE0,0x41, // .@......3....Y.A END
+	0xEE,0xD2,0xEE,0x89,0xEE,0x40,0x8F,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0x89, // .....@.....@.... END
+	0xEE,0x40,0xD0,0x10,0xC1,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD0,0x11,0xC1,0xFB,0xF4, // .@........@..... END
+	0xFB,0x93,0x91,0xFA,0x0E,0xF2,0x49,0xF8,0x58,0xE1,0xD4,0x92,0xFA,0x0E,0xF2,0x49, // ......I.X......I END
+	0xF8,0x58,0xE1,0xCB,0xFB,0x83,0x92,0xDD,0x04,0xD8,0xFB,0x75,0xFA,0x34,0xE3,0xD4, // .X.........u.4.. END
+	0xFA,0xB4,0xFB,0xF4,0x91,0xFA,0x0E,0xF8,0x48,0xE1,0xC2,0x92,0xFA,0x0E,0x80,0xF2, // ........H....... END
+	0x49,0xF8,0x58,0x81,0xFB,0xF4,0x90,0xFA,0x0E,0xF8,0x48,0xFB,0xF4,0xFB,0x93,0x91, // I.X.......H..... END
+	0xDD,0x04,0xE1,0xFB,0x75,0xFA,0xB4,0xFB,0xF4,0xEE,0x40,0xA0,0xDB,0xFF,0xFB,0x86, // ....u.....@..... END
+	0xC1,0xF3,0x04,0xF9,0x10,0xE3,0xC7,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x00, // ............@... END
+	0xC1,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x04,0xC1,0xFB,0xF4,0xEE,0x89,0xEE, // ......@......... END
+	0x40,0xD8,0x06,0x05,0xC1,0xFB,0xF4,0xFB,0x83,0xDD,0x05,0x81,0xFB,0x75,0xEE,0x40, // @............u.@ END
+	0xFA,0x34,0xF2,0x89,0xF8,0x98,0xE1,0xCC,0xE4,0x81,0xE2,0x80,0x1A,0xD4,0x0A,0xF3, // .4.............. END
+	0x1C,0xB0,0xF9,0x10,0x53,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1, // ....S.....@..... END
+	0xE6,0x03,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x04,0x1C,0xFB,0x75,0xFA,0x74,0xFB, // ............u.t. END
+	0x8B,0xD8,0x81,0x0F,0xDD,0x04,0x1C,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFB,0x83,0xFB, // ........u.t.4... END
+	0x8B,0xD1,0x2F,0xDD,0x05,0x43,0xFB,0x75,0xF2,0x80,0xFA,0x74,0xFA,0x34,0xF8,0x88, // ../..C.u...t.4.. END
+	0xDF,0x06,0x55,0xEE,0x80,0xEE,0xC9,0xD8,0x02,0x04,0xC1,0xEE,0x40,0xEE,0x12,0xEE, // ..U.........@... END
+	0x89,0xEE,0x5B,0xFB,0x83,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD1,0x3A,0xDD,0x05,0x43, // ..[.........:..C END
+	0xFB,0x75,0xEE,0xC0,0xF3,0x1B,0xFA,0xB4,0xFA,0x74,0xFA,0x34,0xF9,0x18,0xDF,0x06, // .u.......t.4.... END
+	0x4E,0xFB,0x9B,0xFB,0x93,0xFB,0x83,0xFB,0x8B,0xD8,0x81,0x0F,0xE7,0x1A,0xE4,0x04, // N............... END
+	0xD4,0x00,0x44,0xD8,0x81,0x0F,0xEE,0x52,0xE6,0x9A,0xDD,0x04,0x10,0xFB,0x75,0xD8, // ..D....R......u. END
+	0x81,0x0F,0xD9,0x06,0xA4,0xDD,0x04,0x36,0xFB,0x75,0xD8,0x81,0x0F,0xFA,0x74,0xFB, // .......6.u....t. END
+	0x8B,0xDD,0x04,0x36,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFA,0xB4,0xFA,0xF4,0xFB,0x83, // ...6.u.t.4...... END
+	0xFB,0x8B,0xD8,0x01,0x0A,0xD9,0x81,0x0F,0xC1,0xF3,0x00,0xFA,0x74,0xFA,0x34,0xF9, // ............t.4. END
+	0x18,0xE1,0xC9,0xD9,0x81,0x0F,0xDD,0x04,0x1C,0xFB,0x75,0xFB,0xF4,0xEE,0x9B,0xE0, // ..........u..... END
+	0x80,0xDF,0x05,0xCD,0xDD,0x04,0x4E,0xFB,0x75,0xFB,0xF4,0xDD,0x04,0x4E,0xFB,0x75, // ......N.u....N.u END
+	0xFB,0xF4,0x24,0x20,0x00,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x66, // ..$..could.not.f END
+	0x6F,0x72,0x6B,0x0A,0x00,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x65, // ork..could.not.e END
+	0x78,0x65,0x63,0x3A,0x20,0x00,0x6E,0x6F,0x20,0x73,0x75,0x63,0x68,0x20,0x64,0x69, // xec:..no.such.di END
+	0x72,0x65,0x63,0x74,0x6F,0x72,0x79,0x3A,0x20,0x00,0x63,0x64,0x00,0x65,0x78,0x69, // rectory:..cd.exi END
+	0x74,0x00,0x2F,0x68,0x6F,0x6D,0x65,0x00,0x2F,0x00,0x2F,0x00,0xFF,0xFF,0xFF,0xFF, // t./home././..... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x48,0x02,0x6B,0x69,0x6C,0x6C,0x00,0x2F,0x2F,0xDE,0x80,0x00,0x83,0x91,0xD3, // .H.kill.//...... END
+	0x40,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x18,0xD5,0x21,0xFB,0x75,0xEE,0x40,0x8A,0xC1, // @..@.X...!.u.@.. END
+	0x80,0xD5,0x1D,0xFB,0x75,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3, // ....u.@......... END
+	0xF8,0xF8,0xD7,0x3C,0xB9,0xF2,0xD3,0xF8,0xE8,0xD7,0x3C,0xBA,0xE8,0x4B,0xE4,0x4A, // ...<......<..K.J END
+	0xE0,0x00,0xD7,0x22,0xEE,0x09,0xFB,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ..."............ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x05,0x8A,0x17,0x73,0x69,0x7A,0x65,0x00,0x2F,0x2F,0xDE,0x80,0x4C,0xD8,0x04,0x00, // ...size.//..L... END
+	0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7, // ............@.X. END
+	0x3F,0xEE,0x40,0xD8,0x80,0x00,0xDD,0x01,0xF4,0xFB,0x75,0xD8,0x01,0x0F,0xD9,0x80, // ?.@.......u..... END
+	0x00,0xDA,0x80,0x40,0xC1,0xD8,0x80,0x40,0xD5,0x9D,0xFB,0x75,0x8A,0xD5,0x6F,0xFB, // ...@...@...u..o. END
+	0x75,0x80,0xDD,0x01,0xAC,0xFB,0x75,0xD8,0x04,0xD8,0xD5,0x48,0xFB,0x75,0xD7,0x39, // u.....u....H.u.9 END
+	0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB, // .@.....@..p..... END
+	0x93,0xEE,0x12,0xDD,0x02,0x2E,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA, // .......u........ END
+	0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82, // ........@.....@. END
+	0xD7,0x7E,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8, // .~......r.....@. END
+	0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8, // ..............@. END
+	0x01,0x10,0xC1,0xFB,0xF4,0xFB,0x83,0xD9,0x05,0x2A,0xDD,0x02,0x45,0xFB,0x75,0xEE, // .........*..E.u. END
+	0x40,0xFA,0x34,0xF2,0x49,0xF8,0x58,0xD7,0xE9,0xFB,0x83,0xD9,0x05,0x26,0xDD,0x02, // @.4.I.X......&.. END
+	0x45,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xF2,0x49,0xF8,0x58,0xDF,0x01,0x2A,0xFB,0x83, // E.u.@.4.I.X..*.. END
+	0xD9,0x05,0x22,0xDD,0x02,0x45,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xF2,0x49,0xF8,0x58, // .."..E.u.@.4.I.X END
+	0xDF,0x01,0x6B,0xDD,0x02,0x92,0xFB,0x75,0xD8,0x05,0x2F,0xD5,0x48,0xFB,0x75,0xFB, // ..k....u../.H.u. END
+	0xF4,0xFB,0x83,0xD9,0x05,0x2A,0xDA,0x80,0x44,0xDD,0x02,0x70,0xFB,0x75,0xFA,0x34, // .....*..D..p.u.4 END
+	0xDD,0x02,0x92,0xFB,0x75,0xD0,0x2E,0xD5,0x6F,0xFB,0x75,0xD8,0x80,0x44,0xD9,0x04, // ....u...o.u..D.. END
+	0xEE,0xDD,0x02,0x8E,0xFB,0x75,0xD8,0x80,0x44,0xD9,0x05,0x2A,0xDD,0x02,0x63,0xFB, // .....u..D..*..c. END
+	0x75,0xD8,0x80,0x44,0xDD,0x02,0x92,0xFB,0x75,0xD8,0x05,0x34,0xD5,0x48,0xFB,0x75, // u..D....u..4.H.u END
+	0xFB,0xF4,0xFB,0x83,0xD9,0x05,0x26,0xDA,0x80,0x44,0xDD,0x02,0x70,0xFB,0x75,0xFA, // ......&..D..p.u. END
+	0x34,0xDD,0x02,0x92,0xFB,0x75,0xD0,0x2E,0xD5,0x6F,0xFB,0x75,0xD8,0x80,0x44,0xD9, // 4....u...o.u..D. END
+	0x04,0xEE,0xDD,0x02,0x8E,0xFB,0x75,0xD8,0x80,0x44,0xD9,0x05,0x26,0xDD,0x02,0x63, // ......u..D..&..c END
+	0xFB,0x75,0xD8,0x80,0x44,0xDD,0x02,0x92,0xFB,0x75,0xD8,0x05,0x31,0xD5,0x48,0xFB, // .u..D....u..1.H. END
+	0x75,0xFB,0xF4,0xFB,0x83,0xD9,0x05,0x22,0xDA,0x80,0x44,0xDD,0x02,0x70,0xFB,0x75, // u......"..D..p.u END
+	0xFA,0x34,0xDD,0x02,0x92,0xFB,0x75,0xD0,0x2E,0xD5,0x6F,0xFB,0x75,0xD8,0x80,0x44, // .4....u...o.u..D END
+	0xD9,0x04,0xEE,0xDD,0x02,0x8E,0xFB,0x75,0xD8,0x80,0x44,0xD9,0x05,0x22,0xDD,0x02, // .......u..D..".. END
+	0x63,0xFB,0x75,0xD8,0x80,0x44,0xDD,0x02,0x92,0xFB,0x75,0xD8,0x05,0x2E,0xD5,0x48, // c.u..D....u....H END
+	0xFB,0x75,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06, // .u...@.......@.. END
+	0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x02,0x2E,0xFB,0x75,0xEE, // ..............u. END
+	0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x01,0xB0,0xFB,0x75,0xFB,0xF4,0xFB,0x83, // ....t.4....u.... END
+	0xFB,0x8B,0xDD,0x02,0x2E,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD, // ......u...t.4... END
+	0x01,0xBC,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3, // ...u.........B.. END
+	0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x01,0xEE,0xFB,0x75, // /..............u END
+	0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x01,0xBC,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB, // .@.4......u.4.t. END
+	0x83,0xFB,0x8B,0xD9,0x05,0x37,0xDD,0x01,0xD6,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD, // .....7....u.t.4. END
+	0x01,0xD6,0xFB,0x75,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6, // ...u.....@...... END
+	0x03,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x40,0x80,0xFB,0xF4,0xFC,0x0F,0xEE, // ......@..@...... END
+	0x40,0x81,0xF8,0x60,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x68,0x80,0xFB, // @..`......@..h.. END
+	0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x06,0xC1,0xFB,0xF4,0xEE,0xB6,0xE1,0x83,0xDD, // ....@........... END
+	0x02,0x70,0xFB,0x75,0xE3,0x83,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x08, // .p.u.........@.. END
+	0x07,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x93,0xDD,0x02,0xED,0xFB,0x75,0xFA,0x74,0xFA, // ............u.t. END
+	0x34,0xC0,0xFC,0x0C,0xFB,0xF4,0xFC,0x0D,0xFB,0xF4,0x92,0xC0,0xA0,0xC0,0xEE,0xF6, // 4............... END
+	0xD4,0x0C,0xE5,0xB4,0x71,0xE1,0x80,0xFB,0x93,0xFB,0x9B,0xEE,0x40,0xEE,0x1B,0xDD, // ....q.......@... END
+	0x03,0xDD,0xFB,0x75,0xFA,0xB4,0xFA,0x74,0xE3,0x80,0x06,0xD5,0x52,0xFB,0x75,0xD4, // ...u...t....R.u. END
+	0x0C,0xE7,0xB4,0xFB,0xF4,0xFB,0x83,0xD0,0x7B,0xD5,0x6F,0xFB,0x75,0xFA,0x34,0xFB, // ........{.o.u.4. END
+	0x83,0xDD,0x03,0xD3,0xFB,0x75,0xDD,0x03,0x84,0xFB,0x75,0xD0,0x2C,0xD5,0x6F,0xFB, // .....u....u.,.o. END
+	0x75,0xFA,0x34,0xDD,0x03,0xD7,0xFB,0x75,0xDD,0x03,0x84,0xFB,0x75,0xD0,0x7D,0xD5, // u.4....u....u.}. END
+	0x6F,0xFB,0x75,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0, // o.u............. END
+	0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE, // ................ END
+	0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB, // ................ END
+	0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x03,0x74,0xD3, // ...........8..t. END
+	0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8, // d...8.......8... END
+	0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C, // ....8...'......L END
+	0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF, // ..C..........L.. END
+	0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00, // C...d.....L..C.. END
+	0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0, // ......L..C...oA. END
+	0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0, // ..B.....@....@.. END
+	0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B, // ......p..r...... END
+	0xDD,0x03,0x19,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8, // ....u.........I. END
+	0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xD5,0x52,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9, // H.......R.u..... END
+	0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFD,0xFB,0x83,0xD0,0x2D,0xD5,0x6F, // ...A.I.X.....-.o END
+	0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x03,0x84,0xFA,0x02,0xFB,0xF4,0xE0, // .u.4............ END
+	0x01,0xFA,0x02,0xFB,0xF4,0xFB,0x83,0xD8,0x80,0x48,0xDD,0x03,0x13,0xFB,0x75,0xFA, // .........H....u. END
+	0x34,0xFB,0x83,0xD8,0x80,0x48,0xDD,0x04,0xA3,0xFB,0x75,0xE0,0x00,0xEE,0x40,0xFA, // 4....H....u...@. END
+	0x34,0xE4,0x01,0x90,0x41,0xE2,0x00,0xFB,0x83,0xD8,0x80,0x48,0x9A,0xDD,0x02,0x59, // 4...A......H...Y END
+	0xFB,0x75,0xEE,0x40,0xFA,0x34,0xE0,0x6F,0x41,0xE2,0x00,0xFB,0x83,0xD8,0x80,0x48, // .u.@.4.oA......H END
+	0xD9,0x05,0x55,0xDD,0x02,0x3B,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xE3,0xE8, // ..U..;.u.@.4.X.. END
+	0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0x90,0xDD,0x02,0xED,0xFB,0x75,0xFA,0x74,0xFA,0x34, // ...........u.t.4 END
+	0x11,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xE9,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1, // ................ END
+	0xE2,0xFB,0x8B,0xFB,0x83,0x72,0xE1,0x80,0xD9,0x04,0xEE,0xDD,0x02,0x8E,0xFB,0x75, // .....r.........u END
+	0xE3,0x80,0x0E,0xFA,0x34,0xFB,0x83,0xDD,0x04,0x73,0xFB,0x75,0xFA,0x34,0xFA,0x74, // ....4....s.u.4.t END
+	0xE0,0x40,0xE3,0xF3,0xFB,0xF4,0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08,0xFB,0xF4,0xFC, // .@.............. END
+	0x09,0xFB,0xF4,0xEE,0x40,0xFA,0x0A,0xFA,0x07,0xD2,0x10,0xF2,0x82,0xF8,0x80,0xFB, // ....@........... END
+	0xF4,0xFE,0x0A,0x02,0xFA,0x07,0xE0,0x0F,0xFB,0xF4,0xDD,0x04,0x7B,0xFB,0x75,0xD1, // ............{.u. END
+	0x1F,0xF2,0x81,0xF8,0xA8,0xE2,0x00,0xE6,0x08,0xFB,0xF4,0xFB,0x83,0xDD,0x04,0x7B, // ...............{ END
+	0xFB,0x75,0xD9,0x05,0x39,0xE4,0x01,0x10,0xFA,0x34,0x72,0xE1,0x80,0xFB,0x83,0xEE, // .u..9....4r..... END
+	0x12,0xE0,0x00,0xDD,0x04,0xCE,0xFB,0x75,0xFA,0x74,0xDD,0x02,0x4F,0xFB,0x75,0xE3, // .......u.t..O.u. END
+	0x80,0x0E,0xE4,0x01,0xFB,0xF4,0x94,0xE8,0x01,0xD9,0x05,0x5A,0xE4,0x01,0xFB,0xF4, // ...........Z.... END
+	0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x73,0x69,0x7A,0x65,0x20,0x70,0x61,0x74,0x68, // usage:.size.path END
+	0x0A,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00, // .............d.. END
+	0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98, // ....'.......B@.. END
+	0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00,0x3C,0x00,0x00, // ......;......<.. END
+	0x0E,0x10,0x00,0x01,0x51,0x80,0x77,0x35,0x94,0x00,0x00,0x00,0x04,0x00,0x00,0x10, // ....Q.w5........ END
+	0x00,0x00,0x40,0x00,0x00,0x00,0x6B,0x62,0x00,0x6D,0x62,0x00,0x67,0x62,0x00,0x2F, // ..@...kb.mb.gb./ END
+	0x00,0x08,0x08,0x08,0x08,0x08,0x07,0x07,0x07,0x06,0x06,0x06,0x06,0x05,0x05,0x05, // ................ END
+	0x04,0x04,0x04,0x03,0x03,0x03,0x03,0x02,0x02,0x02,0x01,0x01,0x01,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00, // .............d.. END
+	0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98, // ....'.......B@.. END
+	0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ......;......... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0xCC,0x04,0x69,0x6E,0x69,0x74,0x00,0x2F,0x2F,0xDE,0x80,0x00,0xD7,0x13,0x81, // ...init.//...... END
+	0xD1,0xAE,0xD5,0x85,0xFB,0x75,0x80,0xD5,0x4E,0xFB,0x75,0x81,0xC1,0xF2,0x00,0xF8, // .....u..N.u..... END
+	0x08,0xD7,0x49,0xD8,0x04,0x00,0x93,0xA7,0xC1,0xD8,0x01,0x02,0xD1,0x96,0xA1,0xC1, // ..I............. END
+	0xD8,0x01,0x02,0xD1,0x96,0xA2,0xC1,0x81,0xD1,0xA1,0xD5,0x85,0xFB,0x75,0x81,0xD1, // .............u.. END
+	0xBC,0xD5,0x52,0xFB,0x75,0xF2,0x00,0xF8,0x18,0xD7,0x49,0x86,0x90,0xA0,0xC1,0xD7, // ..R.u.....I..... END
+	0x43,0x81,0xD5,0x4E,0xFB,0x75,0xEE,0x40,0x80,0xC1,0x70,0xE1,0x80,0xFB,0x8B,0x84, // C..N.u.@..p..... END
+	0xC1,0xD1,0x10,0xF2,0x41,0xF8,0x50,0xD7,0x7D,0xF2,0x40,0xF8,0x58,0xD7,0x69,0xD7, // ....A.P.}.@.X.i. END
+	0x76,0x85,0xFA,0xB4,0xE3,0x80,0x0E,0xB0,0xC1,0x81,0xD5,0x4E,0xFB,0x75,0xFA,0xB4, // v..........N.u.. END
+	0xE3,0x80,0x0E,0xFB,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0x80,0xFB,0xF4,0xD5,0x52,0xFB, // ..............R. END
+	0x75,0xF2,0x40,0xF8,0x58,0xD7,0x94,0xEE,0x40,0x86,0xA0,0xC1,0xFB,0xF4,0x2F,0x64, // u.@.X...@...../d END
+	0x65,0x76,0x2F,0x74,0x74,0x79,0x53,0x30,0x00,0x2F,0x65,0x74,0x63,0x2F,0x73,0x74, // ev/ttyS0./etc/st END
+	0x61,0x72,0x74,0x75,0x70,0x00,0x2F,0x65,0x74,0x63,0x2F,0x73,0x68,0x75,0x74,0x64, // artup./etc/shutd END
+	0x6F,0x77,0x6E,0x00,0x2F,0x62,0x69,0x6E,0x2F,0x73,0x68,0x00,0xFF,0xFF,0xFF,0xFF, // own./bin/sh..... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x03,0x82,0x0F,0x74,0x72,0x75,0x6E,0x63,0x61,0x74,0x65,0x00,0x2F,0x2F,0xDE,0x80, // ...truncate.//.. END
+	0x48,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x40,0xEE,0x40,0xD8,0x80,0x40,0xD5, // H....@.X.@.@..@. END
+	0x9A,0xFB,0x75,0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x40,0xEE,0x40,0xD8,0x80, // ..u....@.X.@.@.. END
+	0x00,0xDD,0x01,0x7B,0xFB,0x75,0xD8,0x01,0x0E,0xD9,0x80,0x00,0xDA,0x80,0x40,0xC1, // ...{.u........@. END
+	0xF2,0x00,0xF8,0x18,0xD7,0x47,0x80,0xDD,0x01,0x33,0xFB,0x75,0xD8,0x02,0xD8,0xD5, // .....G...3.u.... END
+	0xDE,0xFB,0x75,0x81,0xDD,0x01,0x33,0xFB,0x75,0xFB,0x83,0xD8,0x80,0x44,0xDD,0x02, // ..u...3.u....D.. END
+	0x9D,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xD8,0x80,0x44,0xDD,0x02,0x36,0xFB,0x75,0xE0, // ..u.4....D..6.u. END
+	0x00,0xEE,0x40,0xFA,0x34,0xE4,0x01,0x90,0x41,0xE2,0x00,0xFB,0x83,0xD8,0x80,0x44, // ..@.4...A......D END
+	0x9A,0xDD,0x01,0xE1,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xE0,0x6F,0x41,0xE2,0x00,0xFB, // .....u.@.4.oA... END
+	0x83,0xD8,0x80,0x44,0xD9,0x03,0x49,0xDD,0x02,0xB0,0xFB,0x75,0xF2,0x40,0xFA,0x34, // ...D..I....u.@.4 END
+	0xF8,0x58,0xD7,0x6F,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0x90,0xDD,0x02,0x77,0xFB,0x75, // .X.o.........w.u END
+	0xFA,0x74,0xFA,0x34,0x11,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xD7,0xDC,0xB9,0xF2, // .t.4............ END
+	0xD3,0xF8,0xE8,0xD7,0xDC,0xFB,0x8B,0xFB,0x83,0x72,0xE1,0x80,0xD9,0x02,0xF7,0xDD, // .........r...... END
+	0x02,0x73,0xFB,0x75,0xE3,0x80,0x0E,0xFA,0x34,0xFB,0x83,0xDD,0x01,0xD9,0xFB,0x75, // .s.u....4......u END
+	0xFA,0x34,0xFA,0x74,0xE0,0x40,0xD7,0xA8,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89, // .4.t.@.....@.... END
+	0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x02,0xA3, // .@..p........... END
+	0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB, // .u.............. END
+	0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0, // ..@.....@....... END
+	0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3, // ..r.....@....... END
+	0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE, // ........@....... END
+	0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB, // @.......@....... END
+	0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x02,0xA3,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74, // .........u.....t END
+	0xFA,0x34,0xDD,0x01,0x37,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x02,0xA3, // .4..7.u......... END
+	0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x01,0x43,0xFB,0x75,0xFB, // .u...t.4....C.u. END
+	0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90, // ........B../.... END
+	0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x01,0x75,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB, // ........u.u.@.4. END
+	0x83,0xDD,0x01,0x43,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x03, // ...C.u.4.t...... END
+	0x2B,0xDD,0x01,0x5D,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x01,0x5D,0xFB,0x75,0xFB, // +..].u.t.4..].u. END
+	0xF4,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3,0xF8, // ................ END
+	0xE8,0xE1,0xC8,0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB,0xF4, // .....K.J........ END
+	0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08,0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xEE,0x89,0xEE, // ................ END
+	0x40,0xD8,0x08,0x06,0xC1,0xFB,0xF4,0xEE,0xB6,0xE1,0x83,0xDD,0x01,0xF8,0xFB,0x75, // @..............u END
+	0xE3,0x83,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4, // .........@...... END
+	0xFA,0x02,0xFB,0xF4,0xE0,0x01,0xFA,0x02,0xFB,0xF4,0xEE,0x40,0xFA,0x0A,0xFA,0x07, // ...........@.... END
+	0xD2,0x10,0xF2,0x82,0xF8,0x80,0xFB,0xF4,0xFE,0x0A,0x02,0xFA,0x07,0xE0,0x0F,0xFB, // ................ END
+	0xF4,0xDD,0x02,0x0E,0xFB,0x75,0xD1,0x1F,0xF2,0x81,0xF8,0xA8,0xE2,0x00,0xE6,0x08, // .....u.......... END
+	0xFB,0xF4,0xFB,0x83,0xDD,0x02,0x0E,0xFB,0x75,0xD9,0x03,0x2D,0xE4,0x01,0x10,0xFA, // ........u..-.... END
+	0x34,0x72,0xE1,0x80,0xFB,0x83,0xEE,0x12,0xE0,0x00,0xDD,0x02,0xCE,0xFB,0x75,0xFA, // 4r............u. END
+	0x74,0xDD,0x02,0xC4,0xFB,0x75,0xE3,0x80,0x0E,0xE4,0x01,0xFB,0xF4,0xFB,0x83,0xFB, // t....u.......... END
+	0x93,0xDD,0x02,0x77,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xC0,0xFC,0x0C,0xFB,0xF4,0xFC, // ...w.u.t.4...... END
+	0x0D,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13, // ................ END
+	0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02, // ................ END
+	0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xEE, // ................ END
+	0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xFC,0x0F,0xEE,0x40, // ..@............@ END
+	0x81,0xF8,0x40,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x60,0x80,0xFB,0xF4, // ..@......@..`... END
+	0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x68,0x80,0xFB,0xF4,0x94,0xE8,0x01,0xD9,0x03,0x4E, // ...@..h........N END
+	0xE4,0x01,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x74,0x72,0x75,0x6E,0x63, // ....usage:.trunc END
+	0x61,0x74,0x65,0x20,0x73,0x69,0x7A,0x65,0x20,0x66,0x69,0x6C,0x65,0x0A,0x00,0x00, // ate.size.file... END
+	0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00,0x03,0xE8,0x00, // ..........d..... END
+	0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98,0x96,0x80,0x05, // .'.......B@..... END
+	0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x0E,0x10,0x00, // ...;......<..... END
+	0x01,0x51,0x80,0x77,0x35,0x94,0x00,0x2F,0x00,0x08,0x08,0x08,0x08,0x08,0x07,0x07, // .Q.w5../........ END
+	0x07,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x04,0x04,0x04,0x03,0x03,0x03,0x03,0x02, // ................ END
+	0x02,0x02,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00, // ................ END
+	0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01, // .....d......'... END
+	0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A, // ....B@........;. END
+	0xCA,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x84,0x03,0x73,0x6C,0x65,0x65,0x70,0x00,0x2F,0x2F,0xDE,0x80,0x00,0xD8,0x04, // ...sleep.//..... END
+	0x00,0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58, // .............@.X END
+	0xD7,0x21,0xD5,0x2A,0xFB,0x75,0xD5,0x49,0xFB,0x75,0x80,0xD5,0x26,0xFB,0x75,0xEE, // .!.*.u.I.u..&.u. END
+	0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xD7,0x45,0xB9,0xF2, // @............E.. END
+	0xD3,0xF8,0xE8,0xD7,0x45,0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xD7,0x2B,0xEE,0x09, // ....E..K.J...+.. END
+	0xFB,0xF4,0xF2,0x40,0xF8,0x58,0xD7,0x71,0xD1,0x3C,0xF2,0x81,0xF8,0xB0,0xD7,0x68, // ...@.X.q.<.....h END
+	0xFB,0x83,0xD8,0xEA,0x60,0xD5,0x73,0xFB,0x75,0xFA,0x34,0xD1,0x3C,0xE6,0x01,0xD7, // ....`.s.u.4.<... END
+	0x49,0xD9,0x03,0xE8,0xE8,0x01,0xD5,0x73,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0xD8,0x03, // I......s.u...@.. END
+	0x06,0xC1,0xFB,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x89,0x03,0x70,0x77,0x64,0x00,0x2F,0x2F,0xDE,0x80,0x00,0xD5,0x6B,0xFB,0x75, // ...pwd.//....k.u END
+	0xD5,0x17,0xFB,0x75,0x8A,0xD5,0x3D,0xFB,0x75,0x80,0xD5,0x71,0xFB,0x75,0xEE,0x40, // ...u..=.u..q.u.@ END
+	0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE, // .....@..p....... END
+	0x12,0xD5,0x75,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80, // ..u.u........... END
+	0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0x4C,0xEE, // .....@.....@..L. END
+	0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4, // .....r.....@.... END
+	0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1, // ...........@.... END
+	0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xC0,0xEE,0x40, // .........@.....@ END
+	0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0xAF,0x03,0x65,0x63,0x68,0x6F,0x00,0x2F,0x2F,0xDE,0x80,0x00,0xD8,0x04,0x00, // ...echo.//...... END
+	0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x91,0x81,0xF2,0x88,0xD0,0x20,0x71,0xE1, // ..............q. END
+	0x80,0xF8,0xA9,0xD5,0x68,0xFB,0x75,0xE3,0x80,0x0E,0x83,0xC1,0xF2,0x80,0xF8,0x98, // ....h.u......... END
+	0xD7,0x38,0x71,0xE1,0x80,0xD5,0x42,0xFB,0x75,0xE3,0x80,0x0E,0xE0,0x40,0xD7,0x11, // .8q...B.u....@.. END
+	0x8A,0xD5,0x68,0xFB,0x75,0x80,0xD5,0x96,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89, // ..h.u....u.@.... END
+	0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD5,0x9A,0xFB, // .@..p........... END
+	0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4, // u............... END
+	0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0x77,0xEE,0x89,0x90,0xC0,0xEE, // .@.....@..w..... END
+	0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80, // .r.....@........ END
+	0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40, // .......@.......@ END
+	0x80,0xC1,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xFF, // .....@.......... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x01,0x91,0x07,0x63,0x61,0x74,0x00,0x2F,0x2F,0xDE,0x80,0x45,0xD8,0x04,0x00,0x93, // ...cat.//..E.... END
+	0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x81,0x70,0xE1,0x80,0xD5,0x29,0xFB,0x75,0xE3, // ........p...).u. END
+	0x80,0x06,0xE0,0x00,0xD7,0x11,0x80,0xD5,0xEF,0xFB,0x75,0x81,0xD5,0xEF,0xFB,0x75, // ..........u....u END
+	0xEE,0x40,0x83,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x24,0xFB,0x83,0xD9,0x01,0x86,0xDD, // .@...@.X.$...... END
+	0x01,0x7C,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x48,0xD7,0x4D,0xC0,0x81,0xD9,0x80, // .|.u.@.4.H.M.... END
+	0x40,0x48,0xD7,0x64,0xEE,0x40,0xD8,0x80,0x00,0xDD,0x01,0x42,0xFB,0x75,0xD8,0x01, // @H.d.@.....B.u.. END
+	0x02,0xD9,0x80,0x00,0xA1,0xC1,0xD9,0x80,0x40,0x48,0xC0,0xD8,0x80,0x40,0x00,0xF2, // ........@H...@.. END
+	0x40,0xF8,0x58,0xD7,0x24,0xD8,0x80,0x41,0x90,0xD5,0xC3,0xFB,0x75,0xD8,0x01,0x0C, // @.X.$..A....u... END
+	0xD9,0x80,0x40,0x09,0xDA,0x80,0x41,0xDB,0x80,0x00,0xD4,0x40,0xC1,0xF3,0x00,0xF9, // ..@...A....@.... END
+	0x18,0xD7,0xA7,0xEF,0x00,0x92,0xD8,0x01,0x01,0xDB,0x80,0x00,0xC1,0xF2,0x00,0xF8, // ................ END
+	0x18,0xD7,0xA7,0xD8,0x80,0x41,0xEE,0x64,0xD5,0xBB,0xFB,0x75,0xD7,0x76,0xD8,0x01, // .....A.d...u.v.. END
+	0x03,0xD9,0x80,0x40,0x09,0xA1,0xF2,0x8A,0xF8,0x80,0xC1,0xFB,0xF4,0x91,0xFC,0x08, // ...@............ END
+	0xFB,0xF4,0xFC,0x08,0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02, // ................ END
+	0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB, // ................ END
+	0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4, // ................ END
+	0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xC0,0xEE,0x40,0xD8,0x06, // .......@.....@.. END
+	0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02, // ............@... END
+	0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xD5,0xF3,0xFB,0x75,0xEE,0x80,0xE0, // ............u... END
+	0x80,0xFA,0x74,0xFA,0x34,0xDD,0x01,0x00,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x8B, // ..t.4....u...... END
+	0xD5,0xF3,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x01,0x0C,0xFB, // ...u...t.4...... END
+	0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93, // u.........B../.. END
+	0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x01,0x3C,0xFB,0x75,0xEE,0x40,0xFA, // ..........<.u.@. END
+	0x34,0xFB,0x83,0xDD,0x01,0x0C,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B, // 4......u.4.t.... END
+	0xD9,0x01,0x88,0xDD,0x01,0x25,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x01,0x25,0xFB, // .....%.u.t.4..%. END
+	0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x05,0xC1,0xFB,0xF4,0x2D,0x00,0x2F, // u.....@......-./ END
+	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x01,0x8F,0x07,0x6C,0x73,0x00,0x2F,0x2F,0xDE,0x80,0xC1,0xD8,0x04,0x00,0x93,0xAD, // ...ls.//........ END
+	0xC1,0xD7,0x10,0x80,0x91,0xC1,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x25,0xEE, // ..........@.X.%. END
+	0x40,0xD8,0x80,0x00,0xDD,0x01,0x16,0xFB,0x75,0xD7,0x34,0xDD,0x01,0x4E,0xFB,0x75, // @.......u.4..N.u END
+	0xEE,0x40,0xD8,0x80,0x00,0xDD,0x01,0x60,0xFB,0x75,0xD8,0x01,0x02,0xD9,0x80,0x00, // .@.....`.u...... END
+	0xA1,0xC1,0xD9,0x80,0x40,0x48,0xD8,0x80,0x40,0x00,0xF2,0x00,0xF8,0x18,0xD7,0xA0, // ....@H..@....... END
+	0xD8,0x01,0x15,0xD9,0x80,0x40,0x09,0xDA,0x80,0x41,0xD3,0x80,0xC1,0xF2,0x40,0xF8, // .....@...A....@. END
+	0x58,0xD7,0x96,0xD9,0x80,0x00,0xF2,0x41,0xF8,0x60,0xD7,0xA0,0xEE,0x40,0xD8,0x80, // X......A.`...@.. END
+	0x41,0x71,0xE1,0x80,0xFB,0x83,0xD5,0xA5,0xFB,0x75,0xD0,0x20,0xD5,0xCC,0xFB,0x75, // Aq.......u.....u END
+	0xFA,0x34,0xFB,0x83,0xDD,0x01,0x7A,0xFB,0x75,0xFA,0x74,0xE4,0x01,0xE0,0x00,0xE3, // .4....z.u.t..... END
+	0x80,0x0E,0xE2,0x40,0xF2,0x89,0xF8,0x88,0xD7,0x6B,0xD7,0x4A,0x8A,0xD5,0xCC,0xFB, // ...@.....k.J.... END
+	0x75,0x80,0xD5,0xFA,0xFB,0x75,0x81,0xD5,0xFA,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE, // u....u....u.@... END
+	0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01, // ..@..p.......... END
+	0x7A,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1, // z.u............. END
+	0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xDB,0xEE,0x89,0x90, // ...@.....@...... END
+	0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1, // ...r.....@...... END
+	0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4, // .........@...... END
+	0xEE,0x40,0x80,0xC1,0xFB,0x83,0xFB,0x8B,0xDD,0x01,0x7A,0xFB,0x75,0xEE,0x80,0xFA, // .@........z.u... END
+	0x74,0xFA,0x34,0xE4,0x02,0xDD,0x01,0x60,0xFB,0x75,0xFB,0xF4,0xA0,0x42,0x11,0xD3, // t.4....`.u...B.. END
+	0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE6,0xFB,0x8B,0xFB,0x83,0xDD,0x01,0x4E,0xFB,0x75, // /............N.u END
+	0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x60,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB, // .@.4....`.u.4.t. END
+	0x83,0xFB,0x8B,0xD9,0x01,0x87,0xD5,0xFE,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xD5,0xFE, // .........u.t.4.. END
+	0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40, // .u.............@ END
+	0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x01,0x7A,0xFB, // ..............z. END
+	0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x01,0x54,0xFB,0x75,0xFB,0xF4, // u.....t.4..T.u.. END
+	0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x2F,0x00,0xFF, // ...@........./.. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x0D,0x01,0x74,0x72,0x75,0x65,0x00,0x2F,0x2F,0x80,0x90,0xC1,0xFF,0xFF,0xFF, // ...true.//...... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x03,0x85,0x0F,0x6D,0x6F,0x75,0x6E,0x74,0x00,0x2F,0x2F,0xDE,0x80,0xC2,0x83,0x91, // ...mount.//..... END
+	0xC1,0xF2,0x40,0xF8,0x58,0xDF,0x01,0x25,0xFB,0x83,0xD9,0x02,0xF9,0xDD,0x02,0x5A, // ..@.X..%.......Z END
+	0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0xAB,0xFB,0x83,0xD9,0x03,0x06,0xDD, // .u.@.4.X........ END
+	0x02,0x5A,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0xB3,0xFB,0x83,0xD9,0x03, // .Z.u.@.4.X...... END
+	0x0F,0xDD,0x02,0x5A,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0xBB,0xFB,0x83, // ...Z.u.@.4.X.... END
+	0xD9,0x03,0x1A,0xDD,0x02,0x5A,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0xC3, // .....Z.u.@.4.X.. END
+	0xFB,0x83,0xD9,0x03,0x25,0xDD,0x02,0x5A,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58, // ....%..Z.u.@.4.X END
+	0xD7,0xCB,0xFB,0x83,0xD9,0x03,0x30,0xDD,0x02,0x5A,0xFB,0x75,0xF2,0x40,0xFA,0x34, // ......0..Z.u.@.4 END
+	0xF8,0x58,0xD7,0xD3,0xFB,0x83,0xD9,0x03,0x3B,0xDD,0x02,0x5A,0xFB,0x75,0xF2,0x40, // .X......;..Z.u.@ END
+	0xFA,0x34,0xF8,0x58,0xD7,0xDB,0xFB,0x83,0xD9,0x03,0x43,0xDD,0x02,0x5A,0xFB,0x75, // .4.X......C..Z.u END
+	0xF2,0x00,0xF8,0x18,0xD7,0xE3,0xD8,0x03,0x47,0xDD,0x01,0x33,0xFB,0x75,0x81,0xDD, // ........G..3.u.. END
+	0x01,0x88,0xFB,0x75,0xD8,0x80,0x00,0x90,0xFA,0x09,0xD7,0xEA,0xD8,0x80,0x00,0x91, // ...u............ END
+	0xFA,0x09,0xD7,0xEA,0xD8,0x80,0x00,0x92,0xFA,0x09,0xD7,0xEA,0xD8,0x80,0x00,0x93, // ................ END
+	0xFA,0x09,0xD7,0xEA,0xD8,0x80,0x00,0x94,0xFA,0x09,0xD7,0xEA,0xD8,0x80,0x00,0x95, // ................ END
+	0xFA,0x09,0xD7,0xEA,0xD8,0x80,0x00,0x96,0xFA,0x09,0xD7,0xEA,0xD8,0x80,0x00,0x97, // ................ END
+	0xFA,0x09,0xC0,0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xE1,0xF1,0xEE,0x40,0xD8,0x80, // .......@.X...@.. END
+	0x02,0xDD,0x01,0x8C,0xFB,0x75,0x83,0x93,0xC1,0xF2,0x40,0xF8,0x58,0xE1,0xDE,0xEE, // .....u....@.X... END
+	0x40,0xD8,0x80,0x42,0xDD,0x01,0x8C,0xFB,0x75,0xD8,0x05,0x01,0xD9,0x80,0x00,0xFA, // @..B....u....... END
+	0x4A,0xDA,0x80,0x02,0xDB,0x80,0x42,0xC1,0x80,0xDD,0x01,0x88,0xFB,0x75,0xD8,0x03, // J.....B......u.. END
+	0x5A,0xDD,0x01,0x33,0xFB,0x75,0x81,0xDD,0x01,0x88,0xFB,0x75,0xEE,0x40,0x80,0xC0, // Z..3.u.....u.@.. END
+	0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD, // ...@..p......... END
+	0x02,0x64,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E, // .d.u............ END
+	0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89, // ....@.....@..... END
+	0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01, // ....r.....@..... END
+	0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB, // ..........@..... END
+	0xF4,0xEE,0x40,0x80,0xC1,0xFB,0x83,0xFB,0x8B,0xDD,0x02,0xDF,0xFB,0x75,0xFA,0x74, // ..@..........u.t END
+	0xFB,0x8B,0xD8,0x80,0x82,0xDD,0x02,0xDF,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFB,0x83, // .........u.t.4.. END
+	0xFB,0x8B,0xD1,0x2F,0xDD,0x02,0xD5,0xFB,0x75,0xF2,0x80,0xFA,0x74,0xFA,0x34,0xF8, // .../....u...t.4. END
+	0x88,0xDF,0x02,0x53,0xEE,0x80,0xEE,0xC9,0xD8,0x02,0x04,0xC1,0xEE,0x40,0xEE,0x12, // ...S.........@.. END
+	0xEE,0x89,0xEE,0x5B,0xFB,0x83,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD1,0x3A,0xDD,0x02, // ...[.........:.. END
+	0xD5,0xFB,0x75,0xEE,0xC0,0xF3,0x1B,0xFA,0xB4,0xFA,0x74,0xFA,0x34,0xF9,0x18,0xDF, // ..u.......t.4... END
+	0x02,0x4C,0xFB,0x9B,0xFB,0x93,0xFB,0x83,0xFB,0x8B,0xD8,0x80,0x82,0xE7,0x1A,0xE4, // .L.............. END
+	0x04,0xD4,0x00,0x44,0xD8,0x80,0x82,0xEE,0x52,0xE6,0x9A,0xDD,0x02,0xB1,0xFB,0x75, // ...D....R......u END
+	0xD8,0x80,0x82,0xD9,0x03,0x78,0xDD,0x02,0xBD,0xFB,0x75,0xD8,0x80,0x82,0xFA,0x74, // .....x....u....t END
+	0xFB,0x8B,0xDD,0x02,0xBD,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xFA,0xB4,0xFA,0xF4,0xFB, // ......u.t.4..... END
+	0x83,0xFB,0x8B,0xD8,0x01,0x0A,0xD9,0x80,0x82,0xC1,0xF3,0x00,0xFA,0x74,0xFA,0x34, // .............t.4 END
+	0xF9,0x18,0xE1,0xC9,0xD9,0x80,0x82,0xDD,0x02,0xDF,0xFB,0x75,0xFB,0xF4,0xEE,0x9B, // ...........u.... END
+	0xE0,0x80,0xDF,0x01,0xCB,0xDD,0x02,0x77,0xFB,0x75,0xFB,0xF4,0xDD,0x02,0x77,0xFB, // .......w.u....w. END
+	0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x05,0xC1,0xFB,0xF4,0xEE,0xC0,0xEE, // u.....@......... END
+	0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4, // @............... END
+	0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD, // .B../........... END
+	0x02,0x71,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x02,0xDF,0xFB,0x75,0xFA, // .q.u.@.4......u. END
+	0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x03,0x7A,0xDD,0x02,0xBD,0xFB,0x75,0xFA, // 4.t......z....u. END
+	0x74,0xFA,0x34,0xDD,0x02,0xBD,0xFB,0x75,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40, // t.4....u.......@ END
+	0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x02,0x64,0xFB,0x75,0xEE, // ............d.u. END
+	0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x02,0xDF,0xFB,0x75,0xFB,0xF4,0xEE,0x89, // ..t.4......u.... END
+	0xEE,0x40,0xD8,0x06,0x00,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x02, // .@.............. END
+	0x64,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x02,0xB1,0xFB,0x75, // d.u.....t.4....u END
+	0xFB,0xF4,0x63,0x75,0x73,0x74,0x6F,0x6D,0x6D,0x69,0x6E,0x69,0x66,0x73,0x00,0x66, // ..customminifs.f END
+	0x6C,0x61,0x74,0x66,0x69,0x6C,0x65,0x00,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6F, // latfile.partitio END
+	0x6E,0x31,0x00,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6F,0x6E,0x32,0x00,0x70,0x61, // n1.partition2.pa END
+	0x72,0x74,0x69,0x74,0x69,0x6F,0x6E,0x33,0x00,0x70,0x61,0x72,0x74,0x69,0x74,0x69, // rtition3.partiti END
+	0x6F,0x6E,0x34,0x00,0x63,0x69,0x72,0x63,0x62,0x75,0x66,0x00,0x66,0x61,0x74,0x00, // on4.circbuf.fat. END
+	0x62,0x61,0x64,0x20,0x74,0x79,0x70,0x65,0x20,0x61,0x72,0x67,0x75,0x6D,0x65,0x6E, // bad.type.argumen END
+	0x74,0x0A,0x00,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x6D,0x6F,0x75,0x6E,0x74,0x20, // t..usage:.mount. END
+	0x74,0x79,0x70,0x65,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x64,0x69,0x72,0x0A, // type.device.dir. END
+	0x00,0x2F,0x00,0x2F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ././............ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x95,0x03,0x74,0x74,0x79,0x00,0x2F,0x2F,0xDE,0x80,0x40,0xD8,0x01,0x05,0x92, // ...tty.//..@.... END
+	0xDA,0x80,0x00,0xC1,0xF2,0x00,0xF8,0x08,0xD7,0x18,0x81,0xD5,0x7D,0xFB,0x75,0xD8, // ............}.u. END
+	0x80,0x00,0xD5,0x29,0xFB,0x75,0x8A,0xD5,0x4F,0xFB,0x75,0x80,0xD5,0x7D,0xFB,0x75, // ...).u..O.u..}.u END
+	0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB, // .@.....@..p..... END
+	0x93,0xEE,0x12,0xD5,0x81,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4, // ......u......... END
+	0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7, // .......@.....@.. END
+	0x5E,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01, // ^......r.....@.. END
+	0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01, // .............@.. END
+	0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0, // .....@.....@.... END
+	0xC1,0xE6,0x03,0xFB,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF // ................ END
+};
+#endif
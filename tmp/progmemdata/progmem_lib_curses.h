@@ -0,0 +1,99 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_curses_H
+#define PROGMEM_lib_curses_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_cursesDATASIZE 1281u
+#define PROGMEM_lib_cursesCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_cursesDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_cursesData))
+static const uint8_t progmem_lib_cursesData[PROGMEM_lib_cursesDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_cursesDATAPTR ((uintptr_t)progmem_lib_cursesData)
+static const uint8_t progmem_lib_cursesData[PROGMEM_lib_cursesDATASIZE]={
+#endif
+	0x5A,0x08,0x70,0x00,0x17,0x00,0x7B,0x01,0x08,0x01,0x9C,0x02,0x40,0x02,0xAB,0x03, // Z.p...{.....@... END
+	0x66,0x04,0x0B,0x04,0x9B,0x05,0x01,0x03,0x24,0x86,0x08,0x00,0xF9,0x00,0x19,0x07, // f.......$....... END
+	0xE8,0x7F,0x63,0x75,0x72,0x73,0x65,0x73,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69, // ..curses.s.requi END
+	0x72,0x65,0x20,0x2E,0x2E,0x2F,0x73,0x79,0x73,0x81,0x03,0x02,0x2E,0x73,0x0A,0x84, // re.../sys....s.. END
+	0x14,0x02,0x65,0x6E,0x64,0x82,0x17,0x09,0x74,0x64,0x2F,0x69,0x6F,0x2F,0x66,0x70, // ..end...td/io/fp END
+	0x75,0x74,0x99,0x1B,0x02,0x64,0x65,0x63,0x80,0x3A,0x03,0x0A,0x64,0x62,0x20,0x83, // ut...dec.:..db.. END
+	0x5C,0x0F,0x45,0x73,0x63,0x53,0x65,0x71,0x53,0x74,0x72,0x43,0x6C,0x65,0x61,0x72, // \.EscSeqStrClear END
+	0x53,0x63,0x81,0x4F,0x05,0x20,0x32,0x37,0x2C,0x20,0x27,0x2B,0x5B,0x32,0x4A,0x27, // Sc.O..27,.'+[2J' END
+	0x2C,0x20,0x30,0x0A,0x64,0x62,0x20,0x63,0x75,0x72,0x73,0x65,0x73,0x45,0x73,0x63, // ,.0.db.cursesEsc END
+	0x53,0x65,0x71,0x53,0x74,0x72,0x43,0x6C,0x65,0x61,0x72,0x4C,0x69,0x6E,0x65,0x20, // SeqStrClearLine. END
+	0x32,0x37,0x2C,0x20,0x27,0x5B,0x32,0x4B,0x94,0x28,0x05,0x53,0x65,0x74,0x52,0x67, // 27,.'[2K.(.SetRg END
+	0x62,0x84,0x25,0x04,0x33,0x38,0x3B,0x32,0x3B,0x94,0x51,0x0E,0x52,0x65,0x73,0x65, // b.%.38;2;.Q.Rese END
+	0x74,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x84,0x57,0x01,0x30,0x6D, // tAttributes.W.0m END
+	0x95,0x80,0x80,0x8F,0x05,0x6F,0x72,0x53,0x68,0x6F,0x77,0x84,0x81,0x03,0x3F,0x32, // .....orShow...?2 END
+	0x35,0x68,0x9A,0x2B,0x02,0x48,0x69,0x64,0x85,0xAD,0x80,0x2B,0x00,0x6C,0x82,0xD8, // 5h.+.Hid...+.l.. END
+	0x01,0x0A,0x3B,0x84,0xD8,0x82,0x7D,0x03,0x20,0x2D,0x20,0x63,0x81,0xD7,0x08,0x20, // ..;...}..-.c.... END
+	0x73,0x63,0x72,0x65,0x65,0x6E,0x20,0x61,0x25,0x6E,0x64,0x20,0x73,0x65,0x74,0x20, // screen.a%nd.set. END
+	0x28,0x76,0x69,0x73,0x69,0x62,0x6C,0x65,0x29,0x20,0x63,0x75,0x72,0x73,0x6F,0x72, // (visible).cursor END
+	0x20,0x74,0x6F,0x20,0x28,0x30,0x2C,0x30,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x82, // .to.(0,0).label. END
+	0x15,0x03,0x65,0x73,0x52,0x65,0x80,0x2B,0x03,0x0A,0x63,0x61,0x6C,0x8A,0x10,0x12, // ..esRe.+..cal... END
+	0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x0A,0x6D,0x6F,0x76,0x20,0x72, // Attributes.mov.r END
+	0x30,0x20,0x31,0x89,0x23,0x00,0x43,0x82,0x50,0x03,0x53,0x65,0x74,0x56,0x83,0x62, // 0.1.#.C.P.SetV.b END
+	0x8A,0x1B,0x09,0x6C,0x65,0x61,0x72,0x53,0x63,0x72,0x65,0x65,0x6E,0x85,0x3B,0x00, // ...learScreen.;. END
+	0x30,0x83,0x44,0x00,0x31,0x80,0x08,0x88,0x68,0x80,0x3E,0x06,0x50,0x6F,0x73,0x58, // 0.D.1...h.>.PosX END
+	0x59,0x0A,0x72,0x80,0x80,0x01,0x0A,0x3B,0x90,0x3E,0x89,0xA7,0x90,0x56,0x83,0xC0, // Y.r....;.>...V.. END
+	0x08,0x45,0x73,0x63,0x53,0x65,0x71,0x53,0x74,0x72,0x86,0x78,0x27,0x65,0x6E,0x0A, // .EscSeqStr.x'en. END
+	0x63,0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x73,0x30,0x0A,0x72,0x65,0x74,0x0A,0x0A, // call.puts0.ret.. END
+	0x3B,0x20,0x63,0x75,0x72,0x73,0x65,0x73,0x43,0x6C,0x65,0x61,0x72,0x4C,0x69,0x6E, // ;.cursesClearLin END
+	0x65,0x20,0x2D,0x20,0x63,0x81,0x0B,0x00,0x73,0x81,0x18,0x05,0x72,0x65,0x6E,0x74, // e.-.c...s...rent END
+	0x20,0x6C,0x80,0x15,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x8D,0x2B,0x06,0x0A,0x6D, // .l....label.+..m END
+	0x6F,0x76,0x20,0x72,0x30,0x84,0x42,0x08,0x45,0x73,0x63,0x53,0x65,0x71,0x53,0x74, // ov.r0.B.EscSeqSt END
+	0x72,0x87,0x1F,0x96,0x6D,0x80,0x73,0x13,0x6F,0x72,0x53,0x65,0x74,0x56,0x69,0x73, // r...m.s.orSetVis END
+	0x69,0x62,0x6C,0x65,0x20,0x28,0x72,0x30,0x3D,0x62,0x6F,0x6F,0x80,0x84,0x02,0x6E, // ible.(r0=boo...n END
+	0x20,0x76,0x84,0x13,0x05,0x76,0x61,0x6C,0x75,0x65,0x29,0x8B,0x79,0x8C,0x37,0x03, // .v...value).y.7. END
+	0x0A,0x63,0x6D,0x70,0x81,0x80,0x82,0x02,0x08,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65, // .cmp......skipne END
+	0x71,0x7A,0x81,0x0B,0x00,0x6A,0x80,0x18,0x89,0x6B,0x04,0x48,0x69,0x64,0x65,0x0A, // qz...j...k.Hide. END
+	0x0A,0x6A,0x6D,0x70,0x20,0x63,0x75,0x72,0x73,0x65,0x73,0x43,0x80,0x05,0x0C,0x6F, // .jmp.cursesC...o END
+	0x72,0x53,0x68,0x6F,0x77,0x0A,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x8F,0x17,0x05,0x6D, // rShow..label...m END
+	0x6F,0x76,0x20,0x72,0x30,0x84,0x2F,0x08,0x45,0x73,0x63,0x53,0x65,0x71,0x53,0x74, // ov.r0./.EscSeqSt END
+	0x72,0x88,0x38,0x0D,0x63,0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x73,0x30,0x0A,0x72, // r.8.call.puts0.r END
+	0x65,0x74,0x91,0x47,0x03,0x48,0x69,0x64,0x65,0x9A,0x47,0x82,0x20,0x8D,0x47,0x00, // et.G.Hide.G...G. END
+	0x3B,0x84,0xA3,0x0E,0x52,0x65,0x73,0x65,0x74,0x41,0x74,0x74,0x72,0x69,0x62,0x75, // ;...ResetAttribu END
+	0x74,0x65,0x73,0x8A,0xA7,0x8D,0x1B,0x93,0xAC,0x8D,0x41,0x3B,0x63,0x61,0x6C,0x6C, // tes.......A;call END
+	0x20,0x70,0x75,0x74,0x73,0x30,0x0A,0x72,0x65,0x74,0x0A,0x0A,0x3B,0x20,0x63,0x75, // .puts0.ret..;.cu END
+	0x72,0x73,0x65,0x73,0x53,0x65,0x74,0x45,0x63,0x68,0x6F,0x28,0x76,0x61,0x6C,0x75, // rsesSetEcho(valu END
+	0x65,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x74,0x75,0x72,0x6E,0x73,0x20,0x74,0x65, // e=r0).-.turns.te END
+	0x72,0x6D,0x69,0x6E,0x61,0x6C,0x20,0x65,0x80,0x1F,0x0C,0x20,0x6F,0x6E,0x2F,0x6F, // rminal.e....on/o END
+	0x66,0x66,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x8B,0x3A,0x0B,0x0A,0x6D,0x6F,0x76,0x20, // ff.label.:..mov. END
+	0x72,0x33,0x20,0x72,0x30,0x20,0x3B,0x84,0x26,0x00,0x20,0x82,0x4D,0x83,0x18,0x04, // r3.r0.;.&...M... END
+	0x30,0x20,0x53,0x79,0x73,0x81,0x7D,0x06,0x49,0x64,0x49,0x6F,0x63,0x74,0x6C,0x83, // 0.Sys.}.IdIoctl. END
+	0x2E,0x09,0x31,0x20,0x46,0x64,0x53,0x74,0x64,0x6F,0x75,0x74,0x83,0x3E,0x01,0x32, // ..1.FdStdout.>.2 END
+	0x20,0x81,0x3D,0x02,0x73,0x65,0x74,0x83,0x6D,0x08,0x63,0x6F,0x6D,0x6D,0x61,0x6E, // ..=.set.m.comman END
+	0x64,0x0A,0x73,0x83,0x3A,0x8E,0xB2,0x06,0x50,0x6F,0x73,0x58,0x59,0x28,0x78,0x80, // d.s.:...PosXY(x. END
+	0xAF,0x06,0x2C,0x20,0x79,0x3D,0x72,0x31,0x29,0x8D,0x98,0x82,0x20,0x03,0x0A,0x69, // ..,.y=r1)......i END
+	0x6E,0x63,0x80,0x96,0x82,0x06,0x0A,0x72,0x31,0x0A,0x70,0x75,0x73,0x68,0x38,0x20, // nc.....r1.push8. END
+	0x72,0x30,0x85,0x08,0x04,0x31,0x0A,0x6D,0x6F,0x76,0x80,0x0F,0x0D,0x20,0x32,0x37, // r0...1.mov....27 END
+	0x0A,0x63,0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x63,0x30,0x85,0x14,0x02,0x27,0x5B, // .call.putc0...'[ END
+	0x27,0x89,0x15,0x02,0x70,0x6F,0x70,0x81,0x3B,0x03,0x20,0x3B,0x20,0x79,0x86,0x2C, // '...pop.;..;.y., END
+	0x02,0x64,0x65,0x63,0x86,0x2D,0x00,0x3B,0x94,0x2D,0x00,0x78,0x92,0x2D,0x00,0x48, // .dec.-.;.-.x.-.H END
+	0x8A,0x5B,0x37,0x72,0x65,0x74,0x0A,0x0A,0x3B,0x20,0x63,0x75,0x72,0x73,0x65,0x73, // .[7ret..;.curses END
+	0x53,0x65,0x74,0x43,0x6F,0x6C,0x6F,0x75,0x72,0x28,0x72,0x3D,0x72,0x30,0x2C,0x20, // SetColour(r=r0,. END
+	0x67,0x3D,0x72,0x31,0x2C,0x20,0x62,0x3D,0x72,0x32,0x29,0x20,0x2D,0x20,0x77,0x68, // g=r1,.b=r2).-.wh END
+	0x65,0x72,0x65,0x20,0x72,0x2C,0x67,0x2C,0x62,0x20,0x61,0x80,0x09,0x04,0x69,0x6E, // ere.r,g,b.a...in END
+	0x20,0x74,0x68,0x80,0x10,0x05,0x61,0x6E,0x67,0x65,0x20,0x5B,0x80,0x2E,0x09,0x32, // .th...ange.[...2 END
+	0x35,0x35,0x5D,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x8B,0x4F,0x0A,0x75,0x72,0x0A,0x70, // 55].label.O.ur.p END
+	0x75,0x73,0x68,0x38,0x20,0x72,0x32,0x85,0x08,0x00,0x31,0x85,0x11,0x04,0x30,0x0A, // ush8.r2...1...0. END
+	0x6D,0x6F,0x76,0x80,0x06,0x24,0x20,0x63,0x75,0x72,0x73,0x65,0x73,0x45,0x73,0x63, // mov..$.cursesEsc END
+	0x53,0x65,0x71,0x53,0x74,0x72,0x53,0x65,0x74,0x52,0x67,0x62,0x0A,0x63,0x61,0x6C, // SeqStrSetRgb.cal END
+	0x6C,0x20,0x70,0x75,0x74,0x73,0x30,0x0A,0x70,0x6F,0x70,0x81,0x2F,0x03,0x20,0x3B, // l.puts0.pop./..; END
+	0x20,0x72,0x86,0x16,0x02,0x64,0x65,0x63,0x85,0x3F,0x02,0x27,0x3B,0x27,0x86,0x2D, // .r...dec.?.';'.- END
+	0x00,0x63,0x89,0x2D,0x00,0x67,0xAA,0x2D,0x87,0x72,0x89,0x5B,0x00,0x6D,0x8A,0x5B, // .c.-.g.-.r.[.m.[ END
+	0x05,0x72,0x65,0x74,0x0A,0x0A,0x3B,0x84,0xB1,0x0A,0x47,0x65,0x74,0x43,0x68,0x61, // .ret..;...GetCha END
+	0x72,0x28,0x29,0x20,0x2D,0x82,0xA8,0x12,0x20,0x73,0x69,0x6E,0x67,0x6C,0x65,0x20, // r().-....single. END
+	0x62,0x79,0x74,0x65,0x20,0x69,0x6E,0x74,0x6F,0x20,0x72,0x44,0x30,0x2C,0x20,0x6F, // byte.into.rD0,.o END
+	0x72,0x20,0x32,0x35,0x36,0x20,0x69,0x66,0x20,0x6E,0x6F,0x20,0x64,0x61,0x74,0x61, // r.256.if.no.data END
+	0x20,0x74,0x6F,0x20,0x72,0x65,0x61,0x64,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x63, // .to.read.label.c END
+	0x75,0x72,0x73,0x65,0x73,0x47,0x65,0x74,0x43,0x68,0x61,0x72,0x0A,0x6D,0x6F,0x76, // ursesGetChar.mov END
+	0x20,0x72,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x54,0x72,0x79, // .r0.SyscallIdTry END
+	0x52,0x80,0x2B,0x03,0x42,0x79,0x74,0x65,0x83,0x1B,0x0A,0x31,0x20,0x46,0x64,0x53, // R.+.Byte...1.FdS END
+	0x74,0x64,0x69,0x6E,0x0A,0x73,0x83,0x23,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0x84, // tdin.s.#..ret... END
+	0x00};
+#endif
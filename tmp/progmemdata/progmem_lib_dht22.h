@@ -0,0 +1,71 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_dht22_H
+#define PROGMEM_lib_dht22_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_dht22DATASIZE 834u
+#define PROGMEM_lib_dht22COMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_dht22DATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_dht22Data))
+static const uint8_t progmem_lib_dht22Data[PROGMEM_lib_dht22DATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_dht22DATAPTR ((uintptr_t)progmem_lib_dht22Data)
+static const uint8_t progmem_lib_dht22Data[PROGMEM_lib_dht22DATASIZE]={
+#endif
+	0x5A,0x04,0x60,0x00,0x0F,0x00,0x8D,0x01,0x35,0x02,0x13,0x02,0xF4,0x03,0x42,0x03, // Z.`.....5.....B. END
+	0x23,0x8B,0x10,0x00,0xF9,0x00,0x18,0x03,0xDB,0x7C,0x64,0x68,0x74,0x32,0x32,0x2E, // #........|dht22. END
+	0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x73,0x79,0x73, // s.require.../sys END
+	0x81,0x03,0x2E,0x2E,0x73,0x0A,0x0A,0x3B,0x20,0x54,0x68,0x65,0x73,0x65,0x20,0x66, // ....s..;.These.f END
+	0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x20,0x61,0x73,0x73,0x75,0x6D,0x65,0x20, // unctions.assume. END
+	0x74,0x68,0x65,0x20,0x44,0x48,0x54,0x32,0x32,0x20,0x64,0x65,0x76,0x69,0x63,0x65, // the.DHT22.device END
+	0x20,0x69,0x80,0x1A,0x13,0x6C,0x72,0x65,0x61,0x64,0x79,0x20,0x72,0x65,0x67,0x69, // .i...lready.regi END
+	0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x61,0x74,0x82,0x29,0x07,0x67,0x69,0x76,0x65, // stered.at.).give END
+	0x6E,0x20,0x48,0x57,0x85,0x2C,0x03,0x73,0x6C,0x6F,0x74,0x81,0x5C,0x29,0x64,0x68, // n.HW.,.slot.\)dh END
+	0x74,0x32,0x32,0x47,0x65,0x74,0x54,0x65,0x6D,0x70,0x65,0x72,0x61,0x74,0x75,0x72, // t22GetTemperatur END
+	0x65,0x20,0x28,0x72,0x30,0x3D,0x68,0x77,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20, // e.(r0=hw.device. END
+	0x73,0x6C,0x6F,0x74,0x2C,0x20,0x72,0x65,0x80,0x1A,0x03,0x6E,0x73,0x20,0x74,0x88, // slot,.re...ns.t. END
+	0x27,0x01,0x69,0x6E,0x80,0x23,0x0A,0x67,0x72,0x65,0x65,0x73,0x20,0x43,0x20,0x74, // '.in.#.grees.C.t END
+	0x69,0x6D,0x80,0x07,0x08,0x31,0x30,0x2C,0x20,0x61,0x73,0x20,0x61,0x6E,0x80,0x1C, // im...10,.as.an.. END
+	0x04,0x74,0x65,0x67,0x65,0x72,0x81,0x24,0x09,0x72,0x30,0x29,0x0A,0x6C,0x61,0x62, // .teger.$.r0).lab END
+	0x65,0x6C,0x20,0x90,0x6D,0x06,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x80,0x24,0x83, // el..m..mov.r1.$. END
+	0x09,0x0D,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x48,0x77,0x44, // ..0.SyscallIdHwD END
+	0x82,0x82,0x00,0x44,0x90,0x35,0x00,0x73,0x83,0x24,0x00,0x0A,0x80,0x97,0x02,0x0A, // ...D.5.s.$...... END
+	0x0A,0x3B,0x86,0x58,0x07,0x48,0x75,0x6D,0x69,0x64,0x69,0x74,0x79,0x9A,0xC3,0x00, // .;.X.Humidity... END
+	0x68,0x85,0x24,0x80,0xF1,0x1E,0x63,0x65,0x6E,0x74,0x61,0x67,0x65,0x20,0x74,0x69, // h.$...centage.ti END
+	0x6D,0x65,0x73,0x20,0x31,0x30,0x2C,0x20,0x61,0x73,0x20,0x61,0x6E,0x20,0x69,0x6E, // mes.10,.as.an.in END
+	0x74,0x65,0x67,0x65,0x72,0x80,0x07,0x21,0x20,0x72,0x30,0x29,0x0A,0x6C,0x61,0x62, // teger..!.r0).lab END
+	0x65,0x6C,0x20,0x64,0x68,0x74,0x32,0x32,0x47,0x65,0x74,0x48,0x75,0x6D,0x69,0x64, // el.dht22GetHumid END
+	0x69,0x74,0x79,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x80,0x21,0x83,0x09,0x13,0x30, // ity.mov.r1.!...0 END
+	0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x48,0x77,0x44,0x65,0x76,0x69, // .SyscallIdHwDevi END
+	0x63,0x65,0x44,0x8D,0x32,0x00,0x73,0x83,0x21,0x06,0x0A,0x72,0x65,0x74,0x0A,0x0A, // ceD.2.s.!..ret.. END
+	0x3B,0x83,0x52,0x0D,0x4D,0x6F,0x75,0x6E,0x74,0x20,0x28,0x72,0x30,0x3D,0x68,0x77, // ;.R.Mount.(r0=hw END
+	0x20,0x64,0x82,0x37,0x05,0x20,0x73,0x6C,0x6F,0x74,0x2C,0x80,0x5C,0x01,0x3D,0x6D, // .d.7..slot,.\.=m END
+	0x82,0x1C,0x01,0x70,0x6F,0x80,0x91,0x04,0x20,0x70,0x61,0x74,0x68,0x80,0x14,0x09, // ...po....path... END
+	0x32,0x3D,0x73,0x61,0x6D,0x70,0x6C,0x69,0x6E,0x67,0x82,0xA7,0x03,0x72,0x76,0x61, // 2=sampling...rva END
+	0x6C,0x81,0xA8,0x13,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x20,0x28,0x61,0x74,0x20, // l...seconds.(at. END
+	0x6C,0x65,0x61,0x73,0x74,0x20,0x32,0x29,0x80,0x42,0x04,0x65,0x74,0x75,0x72,0x6E, // least.2).B.eturn END
+	0x80,0xDB,0x01,0x20,0x6F,0x80,0x22,0x05,0x75,0x63,0x63,0x65,0x73,0x73,0x85,0xD6, // ....o.".uccess.. END
+	0x01,0x3B,0x20,0x28,0x6F,0x6E,0x63,0x65,0x20,0x6D,0x6F,0x75,0x6E,0x74,0x65,0x64, // .;.(once.mounted END
+	0x2C,0x20,0x73,0x61,0x6D,0x70,0x6C,0x65,0x73,0x20,0x63,0x61,0x6E,0x20,0x62,0x65, // ,.samples.can.be END
+	0x20,0x72,0x65,0x61,0x64,0x20,0x66,0x72,0x6F,0x6D,0x20,0x74,0x68,0x84,0x25,0x03, // .read.from.th.%. END
+	0x20,0x70,0x6F,0x69,0x80,0x05,0x07,0x61,0x73,0x20,0x38,0x20,0x62,0x79,0x74,0x81, // .poi...as.8.byt. END
+	0x23,0x0C,0x63,0x6F,0x72,0x64,0x73,0x3A,0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x81, // #.cords:.32.bit. END
+	0x33,0x0A,0x6C,0x20,0x74,0x69,0x6D,0x65,0x20,0x69,0x6E,0x20,0x73,0x80,0x1C,0x1E, // 3.l.time.in.s... END
+	0x6E,0x64,0x73,0x2C,0x20,0x74,0x65,0x6D,0x70,0x65,0x72,0x61,0x74,0x75,0x72,0x65, // nds,.temperature END
+	0x20,0x61,0x6E,0x64,0x20,0x68,0x75,0x6D,0x69,0x64,0x69,0x74,0x79,0x20,0x28,0x80, // .and.humidity.(. END
+	0x49,0x12,0x61,0x62,0x6F,0x76,0x65,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x64, // I.above).label.d END
+	0x68,0x74,0x32,0x32,0x4D,0x81,0x90,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20, // ht22M....mov.r3. END
+	0x72,0x32,0x83,0x09,0x03,0x32,0x20,0x72,0x31,0x83,0x13,0x03,0x31,0x20,0x72,0x30, // r2...2.r1...1.r0 END
+	0x83,0x1D,0x13,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x48,0x77, // ...0.SyscallIdHw END
+	0x44,0x65,0x76,0x69,0x63,0x65,0x44,0x87,0x40,0x00,0x73,0x83,0x1B,0x06,0x0A,0x72, // DeviceD.@.s....r END
+	0x65,0x74,0x0A,0x0A,0x3B,0x83,0x5A,0x01,0x55,0x6E,0x83,0xC7,0x06,0x28,0x72,0x30, // et..;.Z.Un...(r0 END
+	0x3D,0x68,0x77,0x20,0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x6C,0x6F,0x74, // =hw.(device.slot END
+	0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x64,0x68,0x74,0x32,0x32,0x55,0x6E,0x6D, // ).label.dht22Unm END
+	0x6F,0x75,0x6E,0x74,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x09, // ount.mov.r1.r0.. END
+	0x0D,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x48,0x77,0x44,0x82, // .0.SyscallIdHwD. END
+	0x3B,0x00,0x44,0x89,0x2E,0x00,0x73,0x83,0x1D,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF, // ;.D...s....ret.. END
+	0x81,0x00};
+#endif
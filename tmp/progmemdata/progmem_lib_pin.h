@@ -0,0 +1,240 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_pin_H
+#define PROGMEM_lib_pin_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_pinDATASIZE 3544u
+#define PROGMEM_lib_pinCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_pinDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_pinData))
+static const uint8_t progmem_lib_pinData[PROGMEM_lib_pinDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_pinDATAPTR ((uintptr_t)progmem_lib_pinData)
+static const uint8_t progmem_lib_pinData[PROGMEM_lib_pinDATASIZE]={
+#endif
+	0x5A,0x12,0x40,0x00,0x2B,0x00,0xA2,0x01,0x94,0x02,0x76,0x02,0xEB,0x03,0xB3,0x04, // Z.@.+.....v..... END
+	0x82,0x05,0x48,0x05,0xD5,0x06,0xA8,0x07,0x72,0x08,0x1D,0x08,0xF9,0x09,0xB1,0x0A, // ..H.....r....... END
+	0x8C,0x0B,0x4E,0x0C,0x0B,0x0C,0xD6,0x0D,0x9E,0x0D,0xD8,0x0A,0x25,0x91,0x04,0x35, // ..N.........%..5 END
+	0x3B,0x40,0x52,0x55,0x6E,0x84,0x00,0xF2,0x00,0x15,0x06,0x08,0x31,0x73,0x74,0x72, // ;@RUn.......1str END
+	0x74,0x6F,0x70,0x69,0x6E,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20, // topin.s.require. END
+	0x80,0x0D,0x05,0x64,0x65,0x66,0x2E,0x73,0x0A,0x84,0x10,0x09,0x65,0x6E,0x64,0x20, // ...def.s....end. END
+	0x2E,0x2E,0x2F,0x73,0x74,0x64,0x80,0x03,0x00,0x72,0x81,0x03,0x04,0x74,0x6F,0x69, // ../std...r...toi END
+	0x6E,0x74,0x80,0x20,0x06,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20,0x85,0x43,0x12,0x41, // nt....const..C.A END
+	0x6E,0x61,0x6C,0x6F,0x67,0x75,0x65,0x43,0x6F,0x75,0x6E,0x74,0x20,0x31,0x36,0x0A, // nalogueCount.16. END
+	0x64,0x62,0x8E,0x1B,0x0C,0x41,0x72,0x72,0x61,0x79,0x20,0x34,0x30,0x2C,0x34,0x31, // db...Array.40,41 END
+	0x2C,0x34,0x52,0x32,0x2C,0x34,0x33,0x2C,0x34,0x34,0x2C,0x34,0x35,0x2C,0x34,0x36, // ,4R2,43,44,45,46 END
+	0x2C,0x34,0x37,0x2C,0x38,0x30,0x2C,0x38,0x31,0x2C,0x38,0x32,0x2C,0x38,0x33,0x2C, // ,47,80,81,82,83, END
+	0x38,0x34,0x2C,0x38,0x35,0x2C,0x38,0x36,0x2C,0x38,0x37,0x20,0x3B,0x20,0x41,0x30, // 84,85,86,87.;.A0 END
+	0x2D,0x41,0x31,0x35,0x0A,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20,0x73,0x74,0x72,0x74, // -A15..const.strt END
+	0x6F,0x70,0x69,0x6E,0x44,0x69,0x67,0x69,0x74,0x61,0x6C,0x43,0x6F,0x75,0x6E,0x74, // opinDigitalCount END
+	0x20,0x35,0x34,0x0A,0x64,0x62,0x8D,0x1A,0x12,0x41,0x72,0x72,0x61,0x79,0x20,0x33, // .54.db...Array.3 END
+	0x32,0x2C,0x33,0x33,0x2C,0x33,0x36,0x2C,0x33,0x37,0x2C,0x35,0x80,0x08,0x0E,0x35, // 2,33,36,37,5...5 END
+	0x2C,0x35,0x39,0x2C,0x36,0x30,0x2C,0x36,0x31,0x2C,0x36,0x32,0x2C,0x31,0x80,0x02, // ,59,60,61,62,1.. END
+	0x0E,0x33,0x2C,0x31,0x34,0x2C,0x31,0x35,0x2C,0x37,0x33,0x2C,0x37,0x32,0x2C,0x35, // .3,14,15,73,72,5 END
+	0x80,0x26,0x05,0x36,0x2C,0x32,0x37,0x2C,0x32,0x80,0x05,0x08,0x35,0x2C,0x32,0x34, // .&.6,27,2...5,24 END
+	0x2C,0x30,0x2C,0x31,0x2C,0x80,0x44,0x06,0x2C,0x34,0x2C,0x35,0x2C,0x36,0x2C,0x80, // ,0,1,.D.,4,5,6,. END
+	0x18,0x05,0x33,0x2C,0x32,0x32,0x2C,0x32,0x80,0x14,0x80,0x19,0x08,0x39,0x2C,0x31, // ..3,22,2.....9,1 END
+	0x38,0x2C,0x31,0x37,0x2C,0x31,0x80,0x60,0x1A,0x31,0x2C,0x35,0x30,0x2C,0x34,0x39, // 8,17,1.`.1,50,49 END
+	0x2C,0x34,0x38,0x2C,0x39,0x35,0x2C,0x39,0x34,0x2C,0x39,0x33,0x2C,0x39,0x32,0x2C, // ,48,95,94,93,92, END
+	0x39,0x31,0x2C,0x39,0x80,0xDC,0x02,0x39,0x2C,0x38,0x80,0x29,0x04,0x31,0x2C,0x31, // 91,9...9,8.).1,1 END
+	0x30,0x2C,0x80,0x0A,0x23,0x20,0x3B,0x20,0x44,0x30,0x2D,0x44,0x35,0x33,0x0A,0x0A, // 0,..#.;.D0-D53.. END
+	0x3B,0x20,0x73,0x74,0x72,0x3D,0x72,0x30,0x2C,0x20,0x72,0x65,0x74,0x75,0x72,0x6E, // ;.str=r0,.return END
+	0x73,0x20,0x69,0x6E,0x74,0x65,0x67,0x65,0x72,0x80,0x0F,0x03,0x73,0x75,0x6C,0x74, // s.integer...sult END
+	0x80,0x0E,0x02,0x20,0x72,0x30,0x80,0x26,0x06,0x61,0x63,0x63,0x65,0x70,0x74,0x73, // ....r0.&.accepts END
+	0x81,0x2E,0x11,0x69,0x6E,0x67,0x73,0x20,0x6F,0x66,0x20,0x74,0x68,0x65,0x20,0x66, // ...ings.of.the.f END
+	0x6F,0x6C,0x6C,0x6F,0x77,0x80,0x11,0x80,0x09,0x03,0x72,0x6D,0x73,0x3A,0x80,0x50, // ollow.....rms:.P END
+	0x04,0x2A,0x20,0x72,0x61,0x77,0x85,0x46,0x14,0x73,0x20,0x28,0x30,0x2D,0x31,0x32, // .*.raw.F.s.(0-12 END
+	0x38,0x20,0x61,0x6C,0x74,0x68,0x6F,0x75,0x67,0x68,0x20,0x6E,0x6F,0x74,0x80,0x0C, // 8.although.not.. END
+	0x07,0x6C,0x20,0x76,0x61,0x6C,0x69,0x64,0x29,0x82,0x2F,0x04,0x41,0x78,0x20,0x28, // .l.valid)./.Ax.( END
+	0x78,0x82,0x69,0x0A,0x61,0x6E,0x67,0x65,0x20,0x5B,0x30,0x2C,0x31,0x35,0x5D,0x83, // x.i.ange.[0,15]. END
+	0x1A,0x00,0x44,0x8E,0x1A,0x01,0x35,0x33,0x80,0x1A,0x04,0x6C,0x61,0x62,0x65,0x6C, // ..D...53...label END
+	0x81,0xBA,0x04,0x74,0x6F,0x70,0x69,0x6E,0x80,0xC5,0x04,0x43,0x68,0x65,0x63,0x6B, // ...topin...Check END
+	0x81,0x83,0x18,0x20,0x61,0x6E,0x61,0x6C,0x6F,0x67,0x75,0x65,0x20,0x70,0x72,0x65, // ....analogue.pre END
+	0x66,0x69,0x78,0x0A,0x6C,0x6F,0x61,0x64,0x38,0x20,0x72,0x31,0x81,0xC6,0x06,0x6D, // fix.load8.r1...m END
+	0x6F,0x76,0x20,0x72,0x32,0x20,0x0C,0x27,0x41,0x27,0x0A,0x63,0x6D,0x70,0x20,0x72, // ov.r2..'A'.cmp.r END
+	0x32,0x20,0x72,0x31,0x80,0x05,0x07,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x81, // 2.r1....skipneq. END
+	0x0A,0x00,0x6A,0x80,0x17,0x13,0x73,0x74,0x72,0x74,0x6F,0x70,0x69,0x6E,0x41,0x6E, // ..j...strtopinAn END
+	0x61,0x6C,0x6F,0x67,0x75,0x65,0x0A,0x6D,0x6F,0x76,0x81,0x2C,0x01,0x27,0x61,0xAC, // alogue.mov.,.'a. END
+	0x37,0x19,0x3B,0x20,0x43,0x68,0x65,0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x64,0x69, // 7.;.Check.for.di END
+	0x67,0x69,0x74,0x61,0x6C,0x20,0x70,0x72,0x65,0x66,0x69,0x78,0x86,0x52,0x00,0x44, // gital.prefix.R.D END
+	0xA3,0x8A,0x00,0x44,0x83,0x3D,0x86,0x89,0x00,0x64,0xAB,0x36,0x0D,0x3B,0x20,0x4F, // ...D.=...d.6.;.O END
+	0x74,0x68,0x65,0x72,0x77,0x69,0x73,0x65,0x20,0x61,0x73,0x1A,0x73,0x75,0x6D,0x65, // therwise.as.sume END
+	0x20,0x72,0x61,0x77,0x20,0x69,0x6E,0x74,0x65,0x67,0x65,0x72,0x0A,0x63,0x61,0x6C, // .raw.integer.cal END
+	0x6C,0x20,0x73,0x74,0x72,0x74,0x6F,0x80,0x11,0x1E,0x0A,0x72,0x65,0x74,0x0A,0x3B, // l.strto....ret.; END
+	0x20,0x54,0x72,0x79,0x20,0x61,0x73,0x20,0x61,0x6E,0x61,0x6C,0x6F,0x67,0x75,0x65, // .Try.as.analogue END
+	0x20,0x70,0x69,0x6E,0x0A,0x6C,0x61,0x62,0x65,0x84,0x28,0x80,0x0E,0x00,0x41,0x84, // .pin.labe.(...A. END
+	0x1A,0x11,0x0A,0x69,0x6E,0x63,0x20,0x72,0x30,0x20,0x3B,0x20,0x73,0x6B,0x69,0x70, // ...inc.r0.;.skip END
+	0x20,0x27,0x41,0x27,0x8C,0x50,0x17,0x3B,0x20,0x43,0x68,0x65,0x63,0x6B,0x20,0x6E, // .'A'.P.;.Check.n END
+	0x75,0x6D,0x20,0x77,0x69,0x74,0x68,0x69,0x6E,0x20,0x76,0x61,0x6C,0x69,0x64,0x80, // um.within.valid. END
+	0x83,0x09,0x6E,0x67,0x65,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x8E,0x56,0x02,0x43, // ..nge.mov.r1.V.C END
+	0x6F,0x75,0x80,0x8C,0x02,0x63,0x6D,0x70,0x81,0x1C,0x80,0x5E,0x02,0x72,0x31,0x0A, // ou...cmp...^.r1. END
+	0x81,0x5F,0x01,0x6C,0x74,0x81,0x09,0x00,0x6A,0x80,0x16,0x85,0x87,0x03,0x42,0x61, // ._.lt...j.....Ba END
+	0x64,0x50,0x80,0x9C,0x04,0x3B,0x20,0x4C,0x6F,0x61,0x81,0x53,0x00,0x77,0x81,0xAB, // dP...;.Loa.S.w.. END
+	0x81,0x6C,0x0D,0x62,0x65,0x72,0x20,0x66,0x72,0x6F,0x6D,0x20,0x61,0x72,0x72,0x61, // .l.ber.from.arra END
+	0x79,0x87,0x67,0x19,0x72,0x74,0x6F,0x70,0x69,0x6E,0x41,0x6E,0x61,0x6C,0x6F,0x67, // y.g.rtopinAnalog END
+	0x75,0x65,0x41,0x72,0x72,0x61,0x79,0x0A,0x61,0x64,0x64,0x20,0x72,0x30,0x82,0x02, // ueArray.add.r0.. END
+	0x06,0x31,0x0A,0x6C,0x6F,0x61,0x64,0x38,0x83,0x0E,0x15,0x0A,0x72,0x65,0x74,0x0A, // .1.load8....ret. END
+	0x3B,0x20,0x54,0x72,0x79,0x20,0x61,0x73,0x20,0x64,0x69,0x67,0x69,0x74,0x61,0x6C, // ;.Try.as.digital END
+	0x20,0x80,0x3E,0x08,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x73,0x74,0x83,0x4D,0x00, // ..>..label.st.M. END
+	0x44,0x83,0x19,0x03,0x0A,0x69,0x6E,0x63,0x81,0x47,0x0D,0x3B,0x20,0x73,0x6B,0x69, // D....inc.G.;.ski END
+	0x70,0x20,0x27,0x44,0x27,0x0A,0x63,0x61,0x6C,0x84,0x26,0x01,0x69,0x6E,0x81,0x4A, // p.'D'.cal.&.in.J END
+	0x14,0x43,0x68,0x65,0x63,0x6B,0x20,0x6E,0x75,0x6D,0x20,0x77,0x69,0x74,0x68,0x69, // .Check.num.withi END
+	0x6E,0x20,0x76,0x61,0x6C,0x69,0x80,0x7C,0x07,0x61,0x6E,0x67,0x65,0x0A,0x6D,0x6F, // n.vali.|.ange.mo END
+	0x76,0x80,0x80,0x8D,0x55,0x02,0x43,0x6F,0x75,0x80,0x3A,0x02,0x63,0x6D,0x70,0x81, // v...U.Cou.:.cmp. END
+	0x1B,0x83,0xA2,0x81,0x5E,0x01,0x6C,0x74,0x81,0xAC,0x00,0x6A,0x80,0x16,0x85,0x85, // ....^.lt...j.... END
+	0x03,0x42,0x61,0x64,0x50,0x80,0x9A,0x02,0x3B,0x20,0x4C,0x80,0xC1,0x80,0x52,0x00, // .BadP...;.L...R. END
+	0x77,0x81,0xA9,0x81,0x6B,0x09,0x62,0x65,0x72,0x20,0x66,0x72,0x6F,0x6D,0x20,0x61, // w...k.ber.from.a END
+	0x80,0xED,0x23,0x79,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x73,0x74,0x72,0x74, // ..#y.mov.r1.strt END
+	0x6F,0x70,0x69,0x6E,0x44,0x69,0x67,0x69,0x74,0x61,0x6C,0x41,0x72,0x72,0x61,0x79, // opinDigitalArray END
+	0x0A,0x61,0x64,0x64,0x20,0x72,0x30,0x82,0x02,0x06,0x31,0x0A,0x6C,0x6F,0x61,0x64, // .add.r0...1.load END
+	0x38,0x83,0x0E,0x19,0x0A,0x72,0x65,0x74,0x0A,0x3B,0x20,0x42,0x61,0x64,0x20,0x76, // 8....ret.;.Bad.v END
+	0x61,0x6C,0x75,0x65,0x20,0x28,0x6F,0x75,0x74,0x20,0x6F,0x66,0x20,0x61,0x81,0x36, // alue.(out.of.a.6 END
+	0x0D,0x20,0x62,0x6F,0x75,0x6E,0x64,0x73,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x86, // ..bounds).label. END
+	0x59,0x80,0x2D,0x02,0x50,0x69,0x6E,0x83,0x6F,0x01,0x30,0x20,0x80,0x0A,0x01,0x49, // Y.-.Pin.o.0....I END
+	0x6E,0x80,0x3C,0x01,0x69,0x64,0x82,0x4C,0x00,0xFF,0x94,0x00,0x02,0x00,0xAC,0x06, // n.<.id.L........ END
+	0x80,0x94,0x11,0x73,0x65,0x74,0x6D,0x6F,0x64,0x65,0x2E,0x73,0x00,0x72,0x65,0x71, // ...setmode.s.req END
+	0x75,0x69,0x72,0x65,0x20,0x80,0xA9,0x04,0x64,0x65,0x66,0x2E,0x73,0x80,0x89,0x83, // uire....def.s... END
+	0x10,0x05,0x2E,0x2E,0x2F,0x73,0x79,0x73,0x81,0x03,0x03,0x63,0x61,0x6C,0x6C,0x80, // ..../sys...call. END
+	0x18,0x84,0x7D,0x87,0x3D,0x01,0x20,0x3B,0x81,0x35,0x06,0x66,0x64,0x3D,0x72,0x30, // ..}.=..;.5.fd=r0 END
+	0x2C,0x20,0x81,0x4E,0x00,0x3D,0x80,0xD4,0x15,0x3B,0x20,0x63,0x61,0x6C,0x6C,0x20, // ,..N.=...;.call. END
+	0x69,0x6F,0x63,0x74,0x6C,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x72,0x31,0x83, // ioctl.mov.r3.r1. END
+	0x09,0x03,0x31,0x20,0x72,0x30,0x83,0x13,0x04,0x30,0x20,0x53,0x79,0x73,0x81,0x28, // ..1.r0...0.Sys.( END
+	0x02,0x49,0x64,0x49,0x87,0x29,0x04,0x32,0x20,0x31,0x0A,0x73,0x83,0x17,0x05,0x0A, // .IdI.).2.1.s.... END
+	0x72,0x65,0x74,0x0A,0xFF,0x90,0x00,0x13,0x00,0x9E,0x05,0x70,0x69,0x6E,0x2E,0x73, // ret........pin.s END
+	0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x65,0x6E,0x64,0x20,0x80,0x10,0x04,0x64, // .requireend....d END
+	0x65,0x66,0x2E,0x73,0x80,0x34,0x89,0x13,0x02,0x67,0x65,0x74,0x8E,0x13,0x02,0x6F, // ef.s.4...get...o END
+	0x70,0x65,0x80,0x3C,0x8C,0x28,0x00,0x73,0x90,0x28,0x80,0x13,0x03,0x6D,0x6F,0x64, // pe.<.(.s.(...mod END
+	0x65,0x8E,0x54,0x04,0x76,0x61,0x6C,0x69,0x64,0x8B,0x6A,0x04,0x73,0x74,0x72,0x74, // e.T.valid.j.strt END
+	0x6F,0x82,0x94,0x80,0xB1,0x16,0x02,0x2E,0x12,0x70,0x69,0x6E,0x67,0x65,0x74,0x2E, // o........pinget. END
+	0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x65,0x6E,0x64,0x20,0x80,0x13,0x06, // s.requireend.... END
+	0x6F,0x70,0x65,0x6E,0x2E,0x73,0x0A,0x8B,0x14,0x06,0x73,0x65,0x74,0x6D,0x6F,0x64, // open.s....setmod END
+	0x65,0x80,0x17,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x81,0x28,0x80,0x3C,0x20,0x20, // e....label.(.<.. END
+	0x3B,0x20,0x6E,0x75,0x6D,0x3D,0x72,0x30,0x2C,0x20,0x72,0x65,0x74,0x75,0x72,0x6E, // ;.num=r0,.return END
+	0x73,0x20,0x62,0x6F,0x6F,0x6C,0x65,0x61,0x6E,0x20,0x6F,0x6E,0x2F,0x6F,0x66,0x66, // s.boolean.on/off END
+	0x80,0x16,0x0C,0x73,0x75,0x6C,0x74,0x20,0x69,0x6E,0x20,0x72,0x30,0x0A,0x3B,0x20, // ...sult.in.r0.;. END
+	0x81,0x5C,0x81,0x64,0x0F,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x66,0x69,0x6C, // .\.d..device.fil END
+	0x65,0x0A,0x63,0x61,0x6C,0x82,0x50,0x81,0x79,0x06,0x0A,0x63,0x6D,0x70,0x20,0x72, // e.cal.P.y..cmp.r END
+	0x31,0x80,0x2D,0x81,0x30,0x07,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x80,0x11, // 1.-.0.skipneqz.. END
+	0x01,0x0A,0x6A,0x80,0x18,0x83,0xB2,0x0A,0x45,0x72,0x72,0x6F,0x72,0x0A,0x70,0x75, // ..j.....Error.pu END
+	0x73,0x68,0x38,0x83,0x55,0x80,0x9D,0x02,0x20,0x74,0x6F,0x80,0x64,0x06,0x70,0x75, // sh8.U....to.d.pu END
+	0x74,0x0A,0x6D,0x6F,0x76,0x81,0x40,0x03,0x50,0x69,0x6E,0x4D,0x80,0xB1,0x00,0x49, // t.mov.@.PinM...I END
+	0x82,0x13,0x85,0x61,0x84,0xC6,0x80,0x88,0x1A,0x72,0x65,0x61,0x64,0x20,0x62,0x79, // ...a.....read.by END
+	0x74,0x65,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C, // te.mov.r0.Syscal END
+	0x6C,0x49,0x64,0x52,0x80,0x19,0x07,0x0A,0x70,0x6F,0x70,0x38,0x20,0x72,0x31,0x83, // lIdR....pop8.r1. END
+	0x1C,0x02,0x32,0x20,0x30,0x83,0x25,0x12,0x33,0x20,0x72,0x36,0x20,0x3B,0x20,0x75, // ..2.0.%.3.r6.;.u END
+	0x73,0x65,0x20,0x73,0x74,0x61,0x63,0x6B,0x20,0x74,0x6F,0x80,0x08,0x0C,0x6F,0x72, // se.stack.to...or END
+	0x65,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x83,0x4E,0x04,0x34,0x20, // e.character.N.4. END
+	0x31,0x0A,0x73,0x83,0x50,0x85,0x42,0x07,0x72,0x30,0x0A,0x3B,0x20,0x63,0x6C,0x6F, // 1.s.P.B.r0.;.clo END
+	0x80,0x3B,0x0D,0x70,0x69,0x6E,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x66,0x69, // .;.pin.device.fi END
+	0x6C,0x8F,0x81,0x00,0x43,0x81,0x25,0x86,0x3F,0x02,0x3B,0x20,0x62,0x80,0xAA,0x81, // l...C.%.?.;.b... END
+	0xAF,0x04,0x3F,0x0A,0x63,0x6D,0x70,0x82,0x4B,0x81,0x02,0x08,0x0A,0x73,0x6B,0x69, // ..?.cmp.K....ski END
+	0x70,0x6E,0x65,0x71,0x7A,0x81,0x0B,0x00,0x6A,0x80,0x18,0x80,0x56,0x07,0x67,0x65, // pneqz...j...V.ge END
+	0x74,0x45,0x72,0x72,0x6F,0x72,0x80,0x6A,0x05,0x72,0x65,0x74,0x75,0x72,0x6E,0x82, // tError.j.return. END
+	0x37,0x83,0xE7,0x03,0x6C,0x6F,0x61,0x64,0x80,0xD3,0x00,0x30,0x80,0xC3,0x02,0x0A, // 7...load...0.... END
+	0x72,0x65,0x1B,0x74,0x0A,0x3B,0x20,0x65,0x72,0x72,0x6F,0x72,0x20,0x63,0x61,0x73, // re.t.;.error.cas END
+	0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x70,0x69,0x6E,0x67,0x65,0x74,0x45,0x81, // e.label.pingetE. END
+	0x16,0x0E,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x30,0x0A,0x72,0x65,0x74,0x0A, // ...mov.r0.0.ret. END
+	0xFF,0x8E,0x00,0x02,0x00,0x52,0x03,0x80,0x2D,0x32,0x64,0x65,0x66,0x2E,0x73,0x00, // .....R..-2def.s. END
+	0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x73,0x79,0x73,0x2F,0x6D, // require.../sys/m END
+	0x65,0x67,0x61,0x32,0x35,0x36,0x30,0x2E,0x73,0x0A,0x0A,0x63,0x6F,0x6E,0x73,0x74, // ega2560.s..const END
+	0x20,0x50,0x69,0x6E,0x4D,0x6F,0x64,0x65,0x49,0x6E,0x70,0x75,0x74,0x80,0x51,0x8A, // .PinModeInput.Q. END
+	0x14,0x02,0x4F,0x75,0x74,0x81,0x15,0x00,0x31,0x8C,0x63,0x02,0x03,0x1B,0x19,0x80, // ..Out...1.c..... END
+	0x8D,0x03,0x6F,0x70,0x65,0x6E,0x8F,0x60,0x80,0x64,0x81,0x5B,0x84,0x76,0x02,0x65, // ..open.`.d.[.v.e END
+	0x6E,0x64,0x82,0x79,0x01,0x74,0x64,0x80,0x03,0x06,0x72,0x2F,0x69,0x6E,0x74,0x74, // nd.y.td...r/intt END
+	0x6F,0x80,0x08,0x80,0x7D,0x93,0x20,0x80,0x24,0x02,0x63,0x70,0x79,0x1A,0x2E,0x73, // o...}...$.cpy..s END
+	0x0A,0x0A,0x64,0x62,0x20,0x70,0x69,0x6E,0x6F,0x70,0x65,0x6E,0x50,0x72,0x65,0x66, // ..db.pinopenPref END
+	0x69,0x78,0x20,0x27,0x2F,0x64,0x65,0x76,0x2F,0x80,0x13,0x08,0x27,0x2C,0x30,0x0A, // ix.'/dev/...',0. END
+	0x63,0x6F,0x6E,0x73,0x74,0x8B,0x20,0x0B,0x4C,0x65,0x6E,0x20,0x38,0x0A,0x0A,0x6C, // const...Len.8..l END
+	0x61,0x62,0x65,0x6C,0x85,0x3A,0x35,0x20,0x3B,0x20,0x6E,0x75,0x6D,0x3D,0x72,0x30, // abel.:5.;.num=r0 END
+	0x2C,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x66,0x64,0x20,0x69,0x6E,0x20, // ,.returns.fd.in. END
+	0x72,0x30,0x20,0x28,0x6F,0x72,0x20,0x30,0x20,0x6F,0x6E,0x20,0x66,0x61,0x69,0x6C, // r0.(or.0.on.fail END
+	0x75,0x72,0x65,0x29,0x0A,0x3B,0x20,0x43,0x6F,0x70,0x79,0x20,0x70,0x83,0x6F,0x13, // ure).;.Copy.p.o. END
+	0x6F,0x6E,0x74,0x6F,0x20,0x73,0x74,0x61,0x63,0x6B,0x0A,0x6D,0x6F,0x76,0x20,0x72, // onto.stack.mov.r END
+	0x31,0x20,0x72,0x36,0x80,0x4F,0x11,0x73,0x61,0x76,0x65,0x20,0x50,0x61,0x74,0x68, // 1.r6.O.save.Path END
+	0x4D,0x61,0x78,0x20,0x62,0x79,0x74,0x65,0x73,0x81,0x43,0x02,0x74,0x68,0x65,0x83, // Max.bytes.C.the. END
+	0x2B,0x05,0x2C,0x20,0x70,0x74,0x72,0x20,0x80,0x39,0x09,0x74,0x68,0x69,0x73,0x20, // +.,.ptr..9.this. END
+	0x73,0x70,0x61,0x63,0x65,0x82,0x6F,0x02,0x31,0x20,0x66,0x80,0x6F,0x02,0x6E,0x6F, // space.o.1.f.o.no END
+	0x77,0x83,0x4C,0x00,0x36,0x85,0x42,0x03,0x0A,0x61,0x64,0x64,0x81,0x58,0x82,0x5E, // w.L.6.B..add.X.^ END
+	0x07,0x0A,0x70,0x75,0x73,0x68,0x38,0x20,0x72,0x2C,0x30,0x20,0x3B,0x20,0x73,0x61, // ..push8.r,0.;.sa END
+	0x76,0x65,0x20,0x70,0x61,0x73,0x73,0x65,0x64,0x20,0x70,0x69,0x6E,0x20,0x6E,0x75, // ve.passed.pin.nu END
+	0x6D,0x62,0x65,0x72,0x20,0x74,0x6F,0x20,0x73,0x74,0x61,0x63,0x6B,0x0A,0x6D,0x6F, // mber.to.stack.mo END
+	0x76,0x20,0x72,0x30,0x20,0x72,0x31,0x80,0x2B,0x80,0x0B,0x80,0x2B,0x00,0x74,0x82, // v.r0.r1.+...+.t. END
+	0x1D,0x02,0x6F,0x75,0x72,0x83,0x21,0x0E,0x20,0x73,0x70,0x61,0x63,0x65,0x20,0x72, // ..our.!..space.r END
+	0x65,0x61,0x64,0x79,0x20,0x66,0x6F,0x81,0x15,0x08,0x72,0x63,0x70,0x79,0x20,0x63, // eady.fo...rcpy.c END
+	0x61,0x6C,0x6C,0x83,0x3D,0x00,0x31,0x81,0x58,0x0A,0x6F,0x70,0x65,0x6E,0x50,0x72, // all.=.1.X.openPr END
+	0x65,0x66,0x69,0x78,0x0A,0x81,0x19,0x84,0x25,0x04,0x0A,0x70,0x6F,0x70,0x38,0x83, // efix....%..pop8. END
+	0x5C,0x80,0x09,0x90,0x87,0x02,0x6F,0x66,0x66,0x84,0x88,0x03,0x3B,0x20,0x41,0x70, // \.....off...;.Ap END
+	0x80,0x43,0x06,0x64,0x20,0x67,0x69,0x76,0x65,0x6E,0x85,0xAB,0x81,0xA8,0x07,0x70, // .C.d.given.....p END
+	0x61,0x74,0x68,0x20,0x62,0x75,0x66,0x85,0xAB,0x00,0x50,0x80,0x0F,0x06,0x4D,0x61, // ath.buf...P...Ma END
+	0x78,0x0A,0x73,0x75,0x62,0x82,0xBA,0x00,0x36,0x80,0xC0,0x83,0xC7,0x00,0x32,0x8B, // x.sub...6.....2. END
+	0x89,0x09,0x4C,0x65,0x6E,0x0A,0x61,0x64,0x64,0x20,0x72,0x30,0x82,0x02,0x04,0x32, // ..Len.add.r0...2 END
+	0x0A,0x6D,0x6F,0x76,0x80,0x06,0x08,0x20,0x30,0x20,0x3B,0x20,0x6E,0x6F,0x20,0x70, // .mov....0.;.no.p END
+	0x80,0x1B,0x20,0x69,0x6E,0x67,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x69,0x6E,0x74,0x74, // ...ing.call.intt END
+	0x6F,0x73,0x74,0x72,0x0A,0x3B,0x20,0x6F,0x70,0x65,0x6E,0x20,0x66,0x69,0x6C,0x65, // ostr.;.open.file END
+	0x20,0x61,0x74,0x20,0x80,0x1C,0x06,0x63,0x75,0x6C,0x61,0x74,0x65,0x64,0x80,0x2F, // .at....culated./ END
+	0x01,0x74,0x68,0x83,0x42,0x04,0x30,0x20,0x53,0x79,0x73,0x81,0x36,0x02,0x49,0x64, // .th.B.0.Sys.6.Id END
+	0x4F,0x80,0x2C,0x83,0x57,0x02,0x31,0x20,0x50,0x80,0x20,0x09,0x4D,0x61,0x78,0x0A, // O.,.W.1.P...Max. END
+	0x73,0x75,0x62,0x20,0x72,0x36,0x82,0x02,0x00,0x31,0x80,0x6A,0x0C,0x72,0x65,0x73, // sub.r6...1.j.res END
+	0x74,0x6F,0x72,0x65,0x20,0x73,0x74,0x61,0x63,0x6B,0x85,0x2B,0x01,0x72,0x36,0x85, // tore.stack.+.r6. END
+	0x8D,0x09,0x46,0x64,0x4D,0x6F,0x64,0x65,0x52,0x57,0x0A,0x73,0x83,0x53,0x05,0x0A, // ..FdModeRW.s.S.. END
+	0x72,0x65,0x74,0x0A,0xFF,0x81,0x00,0x10,0x02,0xAC,0x16,0x70,0x69,0x6E,0x76,0x61, // ret........pinva END
+	0x6C,0x69,0x64,0x2E,0x73,0x00,0x64,0x62,0x20,0x85,0x0D,0x09,0x41,0x72,0x72,0x61, // lid.s.db....Arra END
+	0x79,0x20,0x32,0x35,0x35,0x2C,0x85,0x03,0x05,0x31,0x34,0x33,0x2C,0x35,0x39,0x82, // y.255,...143,59. END
+	0x0E,0x09,0x33,0x39,0x2C,0x31,0x32,0x33,0x2C,0x30,0x2C,0x33,0x03,0x2C,0x32,0x35, // ..39,123,0,3.,25 END
+	0x35,0x81,0x03,0x16,0x20,0x3B,0x20,0x38,0x20,0x70,0x69,0x6E,0x73,0x20,0x70,0x65, // 5....;.8.pins.pe END
+	0x72,0x20,0x62,0x79,0x74,0x65,0x2C,0x20,0x6C,0x6F,0x77,0x80,0x0B,0x82,0x14,0x11, // r.byte,.low..... END
+	0x74,0x6F,0x77,0x61,0x72,0x64,0x73,0x20,0x4C,0x53,0x42,0x0A,0x0A,0x6C,0x61,0x62, // towards.LSB..lab END
+	0x65,0x6C,0x81,0x2C,0x04,0x76,0x61,0x6C,0x69,0x64,0x80,0x39,0x0C,0x6E,0x75,0x6D, // el.,.valid.9.num END
+	0x3D,0x72,0x30,0x2C,0x20,0x72,0x65,0x74,0x75,0x72,0x80,0x42,0x06,0x62,0x6F,0x6F, // =r0,.retur.B.boo END
+	0x6C,0x65,0x61,0x6E,0x80,0x0F,0x05,0x73,0x75,0x6C,0x74,0x20,0x69,0x80,0x09,0x0E, // lean...sult.i... END
+	0x30,0x0A,0x3B,0x20,0x4F,0x75,0x74,0x73,0x69,0x64,0x65,0x20,0x6F,0x66,0x20,0x83, // 0.;.Outside.of.. END
+	0x39,0x08,0x72,0x61,0x6E,0x67,0x65,0x3F,0x20,0x28,0x6F,0x87,0x18,0x13,0x5B,0x30, // 9.range?.(o...[0 END
+	0x2C,0x39,0x35,0x5D,0x29,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x30,0x0A,0x63, // ,95]).mov.r1.0.c END
+	0x6D,0x70,0x81,0x08,0x01,0x72,0x30,0x80,0x0E,0x06,0x0A,0x73,0x6B,0x69,0x70,0x67, // mp...r0....skipg END
+	0x65,0x81,0x09,0x00,0x6A,0x80,0x16,0x85,0x81,0x04,0x46,0x61,0x6C,0x73,0x65,0x85, // e...j.....False. END
+	0x31,0x01,0x39,0x35,0x8F,0x32,0x00,0x6C,0x94,0x32,0x02,0x3B,0x20,0x4E,0x24,0x6F, // 1.95.2.l.2.;.N$o END
+	0x77,0x20,0x6C,0x6F,0x6F,0x6B,0x75,0x70,0x20,0x69,0x6E,0x20,0x61,0x72,0x72,0x61, // w.lookup.in.arra END
+	0x79,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x33,0x20,0x3B,0x20,0x63,0x6F,0x6D, // y.mov.r1.3.;.com END
+	0x70,0x75,0x74,0x65,0x83,0x18,0x80,0x21,0x11,0x64,0x65,0x78,0x20,0x28,0x70,0x69, // pute...!.dex.(pi END
+	0x6E,0x4E,0x75,0x6D,0x2F,0x38,0x29,0x0A,0x73,0x68,0x72,0x81,0x29,0x01,0x72,0x30, // nNum/8).shr.).r0 END
+	0x80,0x2F,0x83,0x36,0x01,0x32,0x20,0x80,0x1D,0x05,0x76,0x61,0x6C,0x69,0x64,0x41, // ./.6.2....validA END
+	0x82,0x32,0x11,0x3B,0x20,0x67,0x72,0x61,0x62,0x20,0x72,0x65,0x6C,0x65,0x76,0x61, // .2.;.grab.releva END
+	0x6E,0x74,0x20,0x62,0x79,0x80,0x4D,0x03,0x66,0x72,0x6F,0x6D,0x84,0x6B,0x02,0x61, // nt.by.M.from.k.a END
+	0x64,0x64,0x82,0x41,0x80,0x44,0x06,0x32,0x0A,0x6C,0x6F,0x61,0x64,0x38,0x83,0x0E, // dd.A.D.2.load8.. END
+	0x85,0x4D,0x00,0x37,0x88,0x84,0x09,0x73,0x68,0x69,0x66,0x74,0x20,0x77,0x69,0x74, // .M.7...shift.wit END
+	0x68,0x80,0xAA,0x82,0x48,0x84,0x8A,0x00,0x25,0x80,0x8A,0x01,0x61,0x6E,0x80,0x48, // h...H...%...an.H END
+	0x00,0x32,0x82,0x8A,0x00,0x32,0x86,0x97,0x81,0x55,0x80,0xC5,0x83,0x38,0x81,0x5D, // .2...2...U...8.] END
+	0x01,0x65,0x64,0x82,0x81,0x85,0xAB,0x02,0x31,0x20,0x3B,0x1D,0x20,0x6D,0x61,0x73, // .ed.....1.;..mas END
+	0x6B,0x20,0x61,0x77,0x61,0x79,0x20,0x6F,0x74,0x68,0x65,0x72,0x20,0x62,0x69,0x74, // k.away.other.bit END
+	0x73,0x20,0x72,0x65,0x61,0x64,0x79,0x20,0x74,0x6F,0x80,0x08,0x11,0x74,0x75,0x72, // s.ready.to...tur END
+	0x6E,0x0A,0x61,0x6E,0x64,0x20,0x72,0x30,0x20,0x72,0x31,0x20,0x72,0x32,0x0A,0x80, // n.and.r0.r1.r2.. END
+	0x13,0x03,0x0A,0x3B,0x20,0x52,0x82,0x19,0x1A,0x20,0x66,0x61,0x6C,0x73,0x65,0x20, // ...;.R....false. END
+	0x63,0x61,0x73,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x70,0x69,0x6E,0x76,0x61, // case.label.pinva END
+	0x6C,0x69,0x64,0x46,0x81,0x18,0x03,0x0A,0x6D,0x6F,0x76,0x81,0x38,0x00,0x30,0x82, // lidF....mov.8.0. END
+	0x34,0x00,0xFF,0x90,0x00,0x02,0x01,0xBA,0x0E,0x80,0x31,0x0D,0x73,0x65,0x74,0x2E, // 4.........1.set. END
+	0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x65,0x80,0x6C,0x80,0x45,0x05,0x6F, // s.requiree.l.E.o END
+	0x70,0x65,0x6E,0x2E,0x73,0x80,0x6D,0x89,0x14,0x80,0x28,0x03,0x6D,0x6F,0x64,0x65, // pen.s.m...(.mode END
+	0x80,0x17,0x87,0x6E,0x80,0x3C,0x0A,0x20,0x3B,0x20,0x6E,0x75,0x6D,0x3D,0x72,0x30, // ...n.<..;.num=r0 END
+	0x2C,0x20,0x80,0x7C,0x06,0x75,0x65,0x3D,0x72,0x31,0x2C,0x20,0x80,0x54,0x00,0x73, // ,..|.ue=r1,..T.s END
+	0x81,0x8E,0x81,0xC7,0x82,0x15,0x80,0xB5,0x04,0x73,0x74,0x6F,0x72,0x65,0x83,0x23, // .........store.# END
+	0x02,0x20,0x6F,0x6E,0x80,0x0E,0x27,0x61,0x63,0x6B,0x0A,0x70,0x75,0x73,0x68,0x38, // ..on..'ack.push8 END
+	0x20,0x72,0x31,0x0A,0x3B,0x20,0x6F,0x70,0x65,0x6E,0x20,0x70,0x69,0x6E,0x20,0x64, // .r1.;.open.pin.d END
+	0x65,0x76,0x69,0x63,0x65,0x20,0x66,0x69,0x6C,0x65,0x0A,0x63,0x61,0x6C,0x6C,0x81, // evice.file.call. END
+	0x14,0x81,0x1C,0x85,0x2C,0x06,0x30,0x20,0x3B,0x20,0x73,0x61,0x76,0x80,0x21,0x06, // ....,.0.;.sav.!. END
+	0x64,0x20,0x6F,0x6E,0x20,0x73,0x74,0x81,0x48,0x80,0x12,0x0F,0x65,0x74,0x20,0x74, // d.on.st.H...et.t END
+	0x6F,0x20,0x6F,0x75,0x74,0x70,0x75,0x74,0x0A,0x6D,0x6F,0x76,0x80,0x56,0x08,0x20, // o.output.mov.V.. END
+	0x50,0x69,0x6E,0x4D,0x6F,0x64,0x65,0x4F,0x83,0x14,0x85,0x4D,0x80,0x2A,0x00,0x6D, // PinModeO...M.*.m END
+	0x80,0x15,0x80,0x74,0x09,0x77,0x72,0x69,0x74,0x65,0x20,0x62,0x79,0x74,0x65,0x83, // ...t.write.byte. END
+	0x31,0x04,0x30,0x20,0x53,0x79,0x73,0x81,0x74,0x02,0x49,0x64,0x57,0x81,0x1A,0x03, // 1.0.Sys.t.IdW... END
+	0x0A,0x70,0x6F,0x70,0x81,0x9F,0x80,0x72,0x80,0x09,0x82,0x71,0x01,0x66,0x66,0x84, // .pop...r...q.ff. END
+	0x72,0x82,0x62,0x09,0x32,0x20,0x30,0x0A,0x64,0x65,0x63,0x20,0x72,0x36,0x80,0x95, // r.b.2.0.dec.r6.. END
+	0x08,0x75,0x73,0x65,0x20,0x76,0x61,0x6C,0x75,0x65,0x87,0x97,0x82,0x87,0x00,0x33, // .use.value.....3 END
+	0x80,0x1E,0x83,0x91,0x04,0x34,0x20,0x31,0x0A,0x73,0x83,0x61,0x00,0x0A,0x28,0x3B, // .....4.1.s.a..(; END
+	0x20,0x63,0x6C,0x6F,0x73,0x65,0x20,0x70,0x69,0x6E,0x20,0x64,0x65,0x76,0x69,0x63, // .close.pin.devic END
+	0x65,0x20,0x66,0x69,0x6C,0x65,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x53,0x79, // e.file.mov.r0.Sy END
+	0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x43,0x81,0x25,0x01,0x0A,0x73,0x83,0x0E,0x05, // scallIdC.%..s... END
+	0x0A,0x72,0x65,0x74,0x0A,0xFF,0x82,0x00};
+#endif
@@ -0,0 +1,116 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_spi_H
+#define PROGMEM_lib_spi_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_spiDATASIZE 1556u
+#define PROGMEM_lib_spiCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_spiDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_spiData))
+static const uint8_t progmem_lib_spiData[PROGMEM_lib_spiDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_spiDATAPTR ((uintptr_t)progmem_lib_spiData)
+static const uint8_t progmem_lib_spiData[PROGMEM_lib_spiDATASIZE]={
+#endif
+	0x5A,0x08,0x50,0x00,0x17,0x00,0x87,0x01,0x2C,0x01,0xD1,0x02,0x92,0x03,0x46,0x04, // Z.P.....,.....F. END
+	0x1C,0x04,0xE8,0x05,0xC5,0x06,0x14,0x03,0x24,0x84,0x08,0x00,0xF9,0x00,0x16,0x07, // ........$....... END
+	0xCB,0x7D,0x73,0x70,0x69,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20, // .}spi.s.require. END
+	0x2E,0x2E,0x2F,0x73,0x79,0x73,0x81,0x03,0x03,0x2E,0x73,0x0A,0x0A,0x84,0x15,0x02, // ../sys....s..... END
+	0x65,0x6E,0x64,0x81,0x18,0x02,0x70,0x69,0x6E,0x81,0x03,0x81,0x18,0x02,0x64,0x62, // end...pin.....db END
+	0x20,0x80,0x37,0x0D,0x44,0x65,0x76,0x50,0x61,0x74,0x68,0x20,0x27,0x2F,0x64,0x65, // ..7.DevPath.'/de END
+	0x76,0x2F,0x80,0x48,0x05,0x27,0x2C,0x30,0x0A,0x0A,0x61,0x82,0x1B,0x03,0x46,0x64, // v/.H.',0..a...Fd END
+	0x20,0x31,0x84,0x0A,0x0A,0x53,0x6C,0x61,0x76,0x65,0x53,0x65,0x6C,0x65,0x63,0x74, // .1...SlaveSelect END
+	0x80,0x13,0x01,0x0A,0x3B,0x88,0x13,0x24,0x6C,0x65,0x63,0x74,0x49,0x6E,0x69,0x74, // ....;..$lectInit END
+	0x20,0x28,0x72,0x30,0x3D,0x70,0x69,0x6E,0x4E,0x75,0x6D,0x29,0x0A,0x6C,0x61,0x62, // .(r0=pinNum).lab END
+	0x65,0x6C,0x20,0x73,0x70,0x69,0x53,0x6C,0x61,0x76,0x65,0x53,0x65,0x85,0x24,0x06, // el.spiSlaveSe.$. END
+	0x0A,0x3B,0x20,0x53,0x65,0x74,0x20,0x80,0x26,0x22,0x20,0x61,0x73,0x20,0x6F,0x75, // .;.Set..&".as.ou END
+	0x74,0x70,0x75,0x74,0x0A,0x70,0x75,0x73,0x68,0x38,0x20,0x72,0x30,0x0A,0x6D,0x6F, // tput.push8.r0.mo END
+	0x76,0x20,0x72,0x31,0x20,0x50,0x69,0x6E,0x4D,0x6F,0x64,0x65,0x4F,0x83,0x1D,0x03, // v.r1.PinModeO... END
+	0x63,0x61,0x6C,0x6C,0x81,0x30,0x01,0x73,0x65,0x80,0x29,0x01,0x6F,0x70,0x82,0x28, // call.0.se.).op.( END
+	0x09,0x3B,0x20,0x45,0x6E,0x73,0x75,0x72,0x65,0x20,0x73,0x81,0x5E,0x0B,0x20,0x69, // .;.Ensure.s.^..i END
+	0x73,0x20,0x64,0x69,0x73,0x61,0x62,0x6C,0x65,0x64,0x83,0x2E,0x8B,0x78,0x00,0x44, // s.disabled...x.D END
+	0x83,0x1B,0x01,0x0A,0x72,0x80,0x41,0x80,0x80,0x8B,0x95,0x01,0x45,0x6E,0x81,0x37, // ....r.A.....En.7 END
+	0x9E,0xBC,0x83,0x26,0x88,0xBE,0x02,0x6C,0x6F,0x77,0x83,0xAF,0x10,0x31,0x20,0x30, // ...&...low...1.0 END
+	0x0A,0x63,0x61,0x6C,0x6C,0x20,0x70,0x69,0x6E,0x73,0x65,0x74,0x0A,0x72,0x80,0x03, // .call.pinset.r.. END
+	0x1C,0x0A,0x3B,0x20,0x73,0x70,0x69,0x53,0x6C,0x61,0x76,0x65,0x53,0x65,0x6C,0x65, // ..;.spiSlaveSele END
+	0x63,0x74,0x44,0x69,0x73,0x61,0x62,0x6C,0x65,0x20,0x28,0x72,0x30,0x3D,0x80,0x27, // ctDisable.(r0=.' END
+	0x09,0x4E,0x75,0x6D,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x93,0x27,0x80,0x3F,0x02, // .Num).label.'.?. END
+	0x53,0x65,0x74,0x81,0x51,0x0D,0x20,0x68,0x69,0x67,0x68,0x0A,0x6D,0x6F,0x76,0x20, // Set.Q..high.mov. END
+	0x72,0x31,0x20,0x31,0x94,0x68,0x03,0x4F,0x70,0x65,0x6E,0x82,0x5A,0x00,0x73,0x87, // r1.1.h.Open.Z.s. END
+	0x71,0x04,0x50,0x69,0x6E,0x2C,0x20,0x80,0x8B,0x1C,0x75,0x72,0x6E,0x73,0x20,0x31, // q.Pin,....urns.1 END
+	0x2F,0x30,0x20,0x66,0x6F,0x72,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x2F,0x66, // /0.for.success/f END
+	0x61,0x69,0x6C,0x75,0x72,0x65,0x20,0x80,0x5F,0x01,0x72,0x30,0x88,0x89,0x81,0x48, // ailure.._.r0...H END
+	0x81,0x7B,0x80,0xB7,0x00,0x20,0x8B,0x4B,0x85,0x82,0x8B,0xD6,0x03,0x0A,0x73,0x74, // .{.....K......st END
+	0x6F,0x29,0x72,0x65,0x38,0x20,0x72,0x31,0x20,0x72,0x30,0x0A,0x3B,0x20,0x41,0x74, // o)re8.r1.r0.;.At END
+	0x74,0x65,0x6D,0x70,0x74,0x20,0x74,0x6F,0x20,0x6F,0x70,0x65,0x6E,0x20,0x27,0x2F, // tempt.to.open.'/ END
+	0x64,0x65,0x76,0x2F,0x73,0x70,0x69,0x27,0x0A,0x6D,0x6F,0x76,0x80,0x23,0x0A,0x20, // dev/spi'.mov.#.. END
+	0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x4F,0x80,0x1F,0x83,0x14,0x01,0x31, // SyscallIdO.....1 END
+	0x20,0x80,0x20,0x06,0x44,0x65,0x76,0x50,0x61,0x74,0x68,0x83,0x26,0x0B,0x32,0x20, // ....DevPath.&.2. END
+	0x46,0x64,0x4D,0x6F,0x64,0x65,0x52,0x57,0x0A,0x73,0x83,0x2F,0x88,0x29,0x05,0x46, // FdModeRW.s./.).F END
+	0x64,0x0A,0x73,0x74,0x6F,0x87,0x75,0x02,0x63,0x6D,0x70,0x81,0x58,0x82,0x02,0x08, // d.sto.u.cmp.X... END
+	0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x81,0x8E,0x00,0x6A,0x80,0x18,0x80, // .skipneqz...j... END
+	0x7A,0x81,0x68,0x06,0x46,0x61,0x69,0x6C,0x75,0x72,0x65,0x80,0xA1,0x0B,0x45,0x6E, // z.h.Failure...En END
+	0x61,0x62,0x6C,0x65,0x20,0x73,0x6C,0x61,0x76,0x65,0x85,0x93,0x80,0x9F,0x00,0x53, // able.slave.....S END
+	0x81,0x0F,0x0A,0x53,0x65,0x6C,0x65,0x63,0x74,0x0A,0x6C,0x6F,0x61,0x64,0x80,0xD2, // ...Select.load.. END
+	0x82,0x4F,0x81,0xAB,0x8C,0x1F,0x83,0x41,0x80,0xEC,0x06,0x49,0x6E,0x64,0x69,0x63, // .O.....A...Indic END
+	0x61,0x74,0x37,0x65,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x0A,0x6D,0x6F,0x76, // at7e.success.mov END
+	0x20,0x72,0x30,0x20,0x31,0x0A,0x72,0x65,0x74,0x0A,0x3B,0x20,0x49,0x6E,0x64,0x69, // .r0.1.ret.;.Indi END
+	0x63,0x61,0x74,0x65,0x20,0x66,0x61,0x69,0x6C,0x75,0x72,0x65,0x0A,0x6C,0x61,0x62, // cate.failure.lab END
+	0x65,0x6C,0x20,0x73,0x70,0x69,0x4F,0x70,0x65,0x6E,0x46,0x84,0x14,0x84,0x34,0x00, // el.spiOpenF...4. END
+	0x30,0x82,0x34,0x80,0x35,0x80,0x1E,0x03,0x43,0x6C,0x6F,0x73,0x88,0x2D,0x83,0x0E, // 0.4.5...Clos.-.. END
+	0x07,0x3B,0x20,0x44,0x69,0x73,0x61,0x62,0x6C,0x80,0x6E,0x02,0x6C,0x61,0x76,0x86, // .;.Disabl.n.lav. END
+	0x37,0x80,0x4D,0x00,0x53,0x81,0x0F,0x0B,0x53,0x65,0x6C,0x65,0x63,0x74,0x0A,0x6C, // 7.M.S...Select.l END
+	0x6F,0x61,0x64,0x38,0x81,0x84,0x05,0x72,0x30,0x0A,0x63,0x61,0x6C,0x82,0x6D,0x88, // oad8...r0.cal.m. END
+	0x1F,0x84,0x42,0x80,0x9C,0x82,0x63,0x06,0x20,0x27,0x2F,0x64,0x65,0x76,0x2F,0x80, // ..B...c..'/dev/. END
+	0x91,0x00,0x27,0x85,0xBC,0x02,0x53,0x79,0x73,0x81,0x37,0x01,0x49,0x64,0x83,0x84, // ..'...Sys.7.Id.. END
+	0x82,0xD2,0x00,0x31,0x81,0xB3,0x01,0x46,0x64,0x85,0x5C,0x00,0x31,0x80,0x11,0x01, // ...1...Fd.\.1... END
+	0x0A,0x73,0x83,0x27,0x80,0xEA,0x1A,0x74,0x0A,0x0A,0x3B,0x20,0x73,0x70,0x69,0x52, // .s.'...t..;.spiR END
+	0x65,0x61,0x64,0x42,0x79,0x74,0x65,0x20,0x28,0x72,0x65,0x74,0x75,0x72,0x6E,0x73, // eadByte.(returns END
+	0x20,0x72,0x80,0x11,0x01,0x20,0x62,0x81,0x12,0x19,0x69,0x6E,0x20,0x72,0x30,0x2C, // .r....b...in.r0, END
+	0x20,0x6F,0x72,0x20,0x32,0x35,0x36,0x20,0x69,0x66,0x20,0x66,0x61,0x69,0x6C,0x65, // .or.256.if.faile END
+	0x64,0x20,0x74,0x6F,0x82,0x24,0x06,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x89,0x45, // d.to.$.).label.E END
+	0x80,0x53,0x08,0x50,0x72,0x65,0x70,0x61,0x72,0x65,0x20,0x66,0x80,0x36,0x82,0x4A, // .S.Prepare.f.6.J END
+	0x0A,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x0A,0x6D,0x6F,0x76,0x80,0x4E,0x01,0x20, // .syscall.mov.N.. END
+	0x53,0x83,0x0E,0x01,0x49,0x64,0x81,0x79,0x83,0x14,0x00,0x31,0x81,0x88,0x07,0x46, // S...Id.y...1...F END
+	0x64,0x0A,0x6C,0x6F,0x61,0x64,0x38,0x81,0x0E,0x01,0x72,0x31,0x83,0x2D,0x14,0x32, // d.load8...r1.-.2 END
+	0x20,0x30,0x20,0x3B,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x20,0x69,0x73,0x20,0x69, // .0.;.offset.is.i END
+	0x67,0x6E,0x6F,0x72,0x80,0x80,0x05,0x61,0x6E,0x79,0x77,0x61,0x79,0x83,0x51,0x03, // gnor...anyway.Q. END
+	0x33,0x20,0x72,0x36,0x80,0x24,0x08,0x75,0x73,0x65,0x20,0x73,0x74,0x61,0x63,0x6B, // 3.r6.$.use.stack END
+	0x81,0x9D,0x01,0x73,0x74,0x80,0x26,0x80,0xC8,0x81,0xD0,0x80,0xAF,0x81,0xCC,0x83, // ...st.&......... END
+	0x7E,0x09,0x34,0x20,0x31,0x3B,0x20,0x64,0x61,0x74,0x61,0x20,0x1D,0x6C,0x65,0x6E, // ~.4.1;.data..len END
+	0x0A,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x0A,0x3B,0x20,0x42,0x61,0x64,0x20,0x72, // .syscall.;.Bad.r END
+	0x65,0x61,0x64,0x3F,0x0A,0x63,0x6D,0x70,0x20,0x72,0x30,0x83,0x02,0x08,0x0A,0x73, // ead?.cmp.r0....s END
+	0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x81,0x0B,0x00,0x6A,0x80,0x18,0x03,0x73,0x70, // kipneqz...j...sp END
+	0x69,0x52,0x80,0x25,0x03,0x42,0x79,0x74,0x65,0x80,0x31,0x81,0x0A,0x80,0x3B,0x03, // iR.%.Byte.1...;. END
+	0x47,0x72,0x61,0x62,0x82,0x3C,0x0B,0x20,0x76,0x61,0x6C,0x75,0x65,0x0A,0x6C,0x6F, // Grab.<..value.lo END
+	0x61,0x64,0x38,0x82,0x43,0x04,0x36,0x0A,0x72,0x65,0x74,0x80,0x5D,0x08,0x45,0x72, // ad8.C.6.ret.].Er END
+	0x72,0x6F,0x72,0x20,0x63,0x61,0x73,0x80,0x1C,0x03,0x61,0x62,0x65,0x6C,0x91,0x47, // ror.cas...abel.G END
+	0x02,0x6D,0x6F,0x76,0x81,0x77,0x01,0x32,0x35,0x83,0x34,0x80,0x93,0x80,0x6C,0x02, // .mov.w.25.4...l. END
+	0x57,0x72,0x69,0x80,0x69,0x80,0x6D,0x04,0x20,0x28,0x72,0x30,0x3D,0x82,0x5E,0x00, // Wri.i.m..(r0=.^. END
+	0x2C,0x80,0xA7,0x0B,0x74,0x75,0x72,0x6E,0x73,0x20,0x31,0x2F,0x30,0x20,0x69,0x6E, // ,...turns.1/0.in END
+	0x81,0xAC,0x00,0x66,0x80,0x5D,0x0F,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x2F,0x66, // ...f.].success/f END
+	0x61,0x69,0x6C,0x75,0x72,0x65,0x29,0x87,0x69,0x86,0x44,0x80,0xE7,0x09,0x50,0x75, // ailure).i.D...Pu END
+	0x73,0x68,0x20,0x67,0x69,0x76,0x65,0x6E,0x22,0x20,0x76,0x61,0x6C,0x75,0x65,0x20, // sh.given".value. END
+	0x6F,0x6E,0x74,0x6F,0x20,0x73,0x74,0x61,0x63,0x6B,0x20,0x73,0x6F,0x20,0x77,0x65, // onto.stack.so.we END
+	0x20,0x68,0x61,0x76,0x65,0x20,0x61,0x20,0x70,0x74,0x72,0x20,0x80,0x19,0x2A,0x69, // .have.a.ptr...*i END
+	0x74,0x0A,0x70,0x75,0x73,0x68,0x38,0x20,0x72,0x30,0x0A,0x3B,0x20,0x50,0x72,0x65, // t.push8.r0.;.Pre END
+	0x70,0x61,0x72,0x65,0x20,0x66,0x6F,0x72,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x73, // pare.for.write.s END
+	0x79,0x73,0x63,0x61,0x6C,0x6C,0x0A,0x6D,0x6F,0x76,0x80,0x22,0x01,0x20,0x53,0x83, // yscall.mov."..S. END
+	0x0E,0x02,0x49,0x64,0x57,0x81,0x1D,0x83,0x15,0x0B,0x31,0x20,0x73,0x70,0x69,0x46, // ..IdW.....1.spiF END
+	0x64,0x0A,0x6C,0x6F,0x61,0x64,0x80,0x47,0x00,0x31,0x80,0x11,0x83,0x2E,0x1D,0x32, // d.load.G.1.....2 END
+	0x20,0x30,0x20,0x3B,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x20,0x69,0x73,0x20,0x69, // .0.;.offset.is.i END
+	0x67,0x6E,0x6F,0x72,0x65,0x64,0x20,0x61,0x6E,0x79,0x77,0x61,0x79,0x83,0x52,0x03, // gnored.anyway.R. END
+	0x33,0x20,0x72,0x36,0x80,0x24,0x07,0x64,0x61,0x74,0x61,0x0A,0x64,0x65,0x63,0x80, // 3.r6.$.data.dec. END
+	0x10,0x83,0x6A,0x02,0x34,0x20,0x31,0x83,0x15,0x04,0x20,0x6C,0x65,0x6E,0x0A,0x85, // ..j.4.1....len.. END
+	0x85,0x05,0x3B,0x20,0x52,0x65,0x73,0x74,0x80,0x44,0x83,0xD1,0x83,0x31,0x02,0x36, // ..;.Rest.D...1.6 END
+	0x0A,0x72,0x80,0x5F,0x06,0x3B,0x20,0x6E,0x6F,0x74,0x65,0x3A,0x81,0xA4,0x05,0x73, // .r._.;.note:...s END
+	0x74,0x69,0x6C,0x6C,0x20,0x26,0x63,0x6F,0x6E,0x74,0x61,0x69,0x6E,0x73,0x20,0x31, // till.&contains.1 END
+	0x20,0x6F,0x72,0x20,0x30,0x20,0x64,0x75,0x65,0x20,0x74,0x6F,0x20,0x77,0x72,0x69, // .or.0.due.to.wri END
+	0x74,0x65,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x2C,0x20,0x73,0x80,0x11,0x21, // te.syscall,.s..! END
+	0x65,0x20,0x63,0x61,0x6E,0x20,0x73,0x69,0x6D,0x70,0x6C,0x79,0x20,0x72,0x65,0x74, // e.can.simply.ret END
+	0x75,0x72,0x6E,0x20,0x69,0x74,0x20,0x75,0x6E,0x63,0x68,0x61,0x6E,0x67,0x65,0x64, // urn.it.unchanged END
+	0x0A,0xFF,0x81,0x00};
+#endif
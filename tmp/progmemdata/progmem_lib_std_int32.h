@@ -0,0 +1,834 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_std_int32_H
+#define PROGMEM_lib_std_int32_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_std_int32DATASIZE 13053u
+#define PROGMEM_lib_std_int32COMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_std_int32DATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_std_int32Data))
+static const uint8_t progmem_lib_std_int32Data[PROGMEM_lib_std_int32DATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_std_int32DATAPTR ((uintptr_t)progmem_lib_std_int32Data)
+static const uint8_t progmem_lib_std_int32Data[PROGMEM_lib_std_int32DATASIZE]={
+#endif
+	0x5A,0x4C,0x00,0x00,0x9D,0x01,0x1A,0x02,0x05,0x02,0xDD,0x03,0xAE,0x04,0x97,0x05, // ZL.............. END
+	0x74,0x06,0x4F,0x06,0xFD,0x07,0x9F,0x08,0x6E,0x08,0xEE,0x09,0x81,0x0A,0x28,0x0A, // t.O.....n.....(. END
+	0xE2,0x0B,0x57,0x0B,0xDC,0x0C,0x5A,0x0C,0xDA,0x0D,0x67,0x0E,0x0C,0x0E,0xE6,0x0F, // ..W...Z...g..... END
+	0xA6,0x10,0x83,0x11,0x5C,0x12,0x37,0x12,0xF4,0x13,0xB5,0x14,0x40,0x14,0xB6,0x14, // ....\.7.....@... END
+	0xF6,0x15,0x8C,0x16,0x50,0x17,0x1A,0x17,0xD3,0x18,0x81,0x19,0x41,0x19,0xE2,0x1A, // ....P.......A... END
+	0x9E,0x1B,0x62,0x1C,0x04,0x1C,0x94,0x1D,0x61,0x1D,0xEF,0x1E,0x78,0x1F,0x07,0x1F, // ..b.....a...x... END
+	0x73,0x1F,0xE6,0x20,0x66,0x21,0x18,0x21,0xE7,0x22,0xA2,0x23,0x3D,0x23,0xF5,0x24, // s...f!.!.".#=#.$ END
+	0xB6,0x25,0x9C,0x26,0x7B,0x27,0x04,0x27,0x96,0x28,0x33,0x28,0xB0,0x29,0x72,0x29, // .%.&{'.'.(3(.)r) END
+	0xF2,0x2A,0xD9,0x2B,0x93,0x2C,0x1B,0x2C,0xD9,0x2D,0x97,0x2E,0x16,0x2E,0xBF,0x2F, // .*.+.,.,.-...../ END
+	0x41,0x2F,0xC9,0x30,0x58,0x30,0xD3,0x31,0x4F,0x32,0x38,0x32,0xFD,0x14,0x35,0x97, // A/.0X0.1O282..5. END
+	0x01,0x11,0x16,0x1D,0x21,0x24,0x26,0x37,0x3C,0x5F,0x62,0x68,0x72,0x77,0x79,0x7C, // ....!$&7<_bhrwy| END
+	0x80,0x93,0x00,0xE8,0x00,0x15,0x07,0xA8,0x10,0x69,0x6E,0x74,0x33,0x32,0x6C,0x6F, // .........int32lo END
+	0x67,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x82,0x12,0x09,0x63, // g.s.require....c END
+	0x6F,0x6D,0x6D,0x6F,0x6E,0x2E,0x73,0x0A,0x0A,0x84,0x16,0x02,0x65,0x6E,0x64,0x84, // ommon.s.....end. END
+	0x19,0x01,0x6D,0x70,0x80,0x16,0x8D,0x15,0x01,0x65,0x78,0x81,0x15,0x22,0x0A,0x3B, // ..mp.....ex..".; END
+	0x20,0x41,0x72,0x72,0x61,0x79,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6F,0x20,0x6C, // .Array.used.to.l END
+	0x6F,0x6F,0x6B,0x75,0x70,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x67,0x75,0x65,0x73, // ookup.first.gues END
+	0x73,0x83,0x15,0x05,0x67,0x31,0x30,0x28,0x78,0x29,0x40,0x20,0x62,0x61,0x73,0x65, // s...g10(x)@.base END
+	0x64,0x20,0x6F,0x6E,0x20,0x63,0x6C,0x7A,0x28,0x78,0x29,0x0A,0x3B,0x20,0x6E,0x6F, // d.on.clz(x).;.no END
+	0x74,0x65,0x3A,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x74,0x77,0x6F,0x20,0x65,0x6E, // te:.first.two.en END
+	0x74,0x72,0x69,0x65,0x73,0x20,0x73,0x68,0x6F,0x75,0x6C,0x64,0x20,0x62,0x65,0x20, // tries.should.be. END
+	0x39,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x6F,0x72,0x79,0x2C,0x80,0x30,0x01,0x62, // 9.in.theory,.0.b END
+	0x75,0x80,0x28,0x04,0x68,0x69,0x73,0x20,0x77,0x82,0x20,0x0D,0x63,0x61,0x75,0x73, // u.(.his.w...caus END
+	0x65,0x20,0x61,0x6E,0x20,0x65,0x72,0x72,0x6F,0x72,0x82,0x5A,0x05,0x61,0x6C,0x6C, // e.an.error.Z.all END
+	0x69,0x6E,0x67,0x80,0x35,0x08,0x74,0x33,0x32,0x65,0x78,0x70,0x31,0x30,0x2E,0x80, // ing.5.t32exp10.. END
+	0x67,0x09,0x68,0x6F,0x77,0x65,0x76,0x65,0x72,0x2C,0x20,0x77,0x80,0x2D,0x06,0x75, // g.however,.w.-.u END
+	0x74,0x6F,0x6D,0x61,0x74,0x69,0x81,0x29,0x14,0x79,0x20,0x63,0x6F,0x72,0x72,0x65, // tomati.).y.corre END
+	0x63,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x75,0x70,0x20,0x74,0x6F,0x80,0x73, // ct.value.up.to.s END
+	0x17,0x61,0x6E,0x79,0x77,0x61,0x79,0x20,0x61,0x73,0x20,0x78,0x3E,0x3D,0x31,0x30, // .anyway.as.x>=10 END
+	0x5E,0x28,0x38,0x2B,0x31,0x29,0x0A,0x64,0x62,0x83,0x56,0x0F,0x6C,0x6F,0x67,0x31, // ^(8+1).db.V.log1 END
+	0x30,0x41,0x72,0x72,0x61,0x79,0x43,0x6C,0x7A,0x74,0x6F,0x4C,0x81,0x0E,0x07,0x47, // 0ArrayClztoL...G END
+	0x75,0x65,0x73,0x73,0x20,0x38,0x2C,0x85,0x01,0x00,0x37,0x82,0x01,0x00,0x36,0x84, // uess.8,...7...6. END
+	0x01,0x00,0x35,0x81,0x01,0x01,0x2C,0x34,0x82,0x01,0x00,0x33,0x84,0x01,0x00,0x32, // ..5...,4...3...2 END
+	0x82,0x01,0x00,0x31,0x82,0x01,0x00,0x30,0x85,0x01,0x1C,0x0A,0x0A,0x3B,0x20,0x69, // ...1...0.....;.i END
+	0x6E,0x74,0x33,0x32,0x63,0x6C,0x7A,0x28,0x78,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20, // nt32clz(x=r0).-. END
+	0x74,0x61,0x6B,0x65,0x73,0x20,0x70,0x6F,0x80,0x18,0x11,0x65,0x72,0x20,0x74,0x6F, // takes.po...er.to END
+	0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x80,0x2E,0x0F, // .32.bit.value... END
+	0x20,0x78,0x2C,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D,0x62, // .x,.returns.numb END
+	0x80,0x24,0x0F,0x6F,0x66,0x20,0x6C,0x65,0x61,0x64,0x69,0x6E,0x67,0x20,0x7A,0x65, // .$.of.leading.ze END
+	0x72,0x6F,0x73,0x81,0x25,0x03,0x72,0x30,0x20,0x28,0x80,0x2C,0x01,0x74,0x68,0x81, // ros.%.r0.(.,.th. END
+	0x33,0x80,0x49,0x80,0x3E,0x0D,0x20,0x5B,0x30,0x2C,0x33,0x32,0x5D,0x29,0x0A,0x6C, // 3.I.>..[0,32]).l END
+	0x61,0x62,0x65,0x6C,0x86,0x79,0x80,0x84,0x05,0x6D,0x6F,0x76,0x65,0x20,0x78,0x81, // abel.y...move.x. END
+	0x8B,0x11,0x6F,0x20,0x72,0x31,0x20,0x73,0x6F,0x20,0x77,0x65,0x20,0x63,0x61,0x6E, // ..o.r1.so.we.can END
+	0x20,0x75,0x73,0x65,0x81,0x49,0x02,0x66,0x6F,0x72,0x84,0x73,0x83,0x86,0x00,0x0A, // .use.I.for.s.... END
+	0x80,0x30,0x81,0x28,0x01,0x72,0x30,0x80,0xC1,0x03,0x74,0x65,0x73,0x74,0x82,0x21, // .0.(.r0...test.! END
+	0x06,0x61,0x6E,0x79,0x20,0x73,0x65,0x74,0x81,0xAD,0x01,0x73,0x20,0x1D,0x69,0x6E, // .any.set...s..in END
+	0x20,0x75,0x70,0x70,0x65,0x72,0x20,0x77,0x6F,0x72,0x64,0x0A,0x6C,0x6F,0x61,0x64, // .upper.word.load END
+	0x31,0x36,0x20,0x72,0x30,0x20,0x72,0x31,0x0A,0x63,0x6C,0x7A,0x82,0x09,0x0E,0x30, // 16.r0.r1.clz...0 END
+	0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x31,0x36,0x0A,0x63,0x6D,0x70,0x81,0x09, // .mov.r2.16.cmp.. END
+	0x81,0x20,0x07,0x32,0x0A,0x73,0x6B,0x69,0x70,0x65,0x71,0x81,0x09,0x04,0x72,0x65, // ...2.skipeq...re END
+	0x74,0x0A,0x3B,0x88,0x48,0x15,0x20,0x69,0x73,0x20,0x61,0x6C,0x6C,0x20,0x7A,0x65, // t.;.H..is.all.ze END
+	0x72,0x6F,0x73,0x2C,0x20,0x75,0x73,0x65,0x20,0x6C,0x6F,0x77,0x85,0x1C,0x09,0x63, // ros,.use.low...c END
+	0x6F,0x75,0x6E,0x74,0x20,0x70,0x6C,0x75,0x73,0x81,0x52,0x83,0x73,0x00,0x64,0x83, // ount.plus.R.s.d. END
+	0x74,0x01,0x20,0x32,0x88,0x76,0x02,0x69,0x6E,0x63,0x82,0x8C,0x82,0x5E,0x80,0x5F, // t..2.v.inc...^._ END
+	0x10,0x69,0x6E,0x74,0x33,0x32,0x6C,0x6F,0x67,0x32,0x28,0x78,0x3D,0x72,0x30,0x29, // .int32log2(x=r0) END
+	0x20,0x2D,0x80,0x76,0x0A,0x75,0x72,0x6E,0x73,0x20,0x66,0x6C,0x6F,0x6F,0x72,0x28, // .-.v.urns.floor( END
+	0x83,0x19,0x01,0x29,0x29,0x80,0x27,0x81,0xC1,0x09,0x28,0x61,0x73,0x20,0x73,0x74, // ...)).'...(as.st END
+	0x61,0x6E,0x64,0x61,0x80,0x8F,0x80,0xD4,0x12,0x62,0x69,0x74,0x20,0x76,0x61,0x6C, // anda.....bit.val END
+	0x75,0x65,0x29,0x2C,0x20,0x77,0x68,0x65,0x72,0x65,0x20,0x78,0x80,0xA6,0x0C,0x20, // ue),.where.x.... END
+	0x61,0x20,0x70,0x6F,0x69,0x6E,0x74,0x65,0x72,0x20,0x74,0x6F,0x80,0x0C,0x21,0x33, // a.pointer.to..!3 END
+	0x32,0x20,0x62,0x69,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x2E,0x20,0x72,0x65,0x74, // 2.bit.value..ret END
+	0x75,0x72,0x6E,0x73,0x20,0x30,0x20,0x66,0x6F,0x72,0x20,0x78,0x3D,0x30,0x20,0x61, // urns.0.for.x=0.a END
+	0x73,0x80,0x31,0x12,0x73,0x70,0x65,0x63,0x69,0x61,0x6C,0x20,0x63,0x61,0x73,0x65, // s.1.special.case END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x80,0x42,0x07,0x33,0x32,0x6C,0x6F,0x67,0x32, // .label..B.32log2 END
+	0x0A,0x3B,0x80,0x16,0x00,0x6C,0x80,0x1B,0x01,0x6C,0x7A,0x81,0x51,0x07,0x67,0x65, // .;...l...lz.Q.ge END
+	0x74,0x20,0x6E,0x75,0x6D,0x62,0x80,0x5F,0x10,0x6F,0x66,0x20,0x6C,0x65,0x61,0x64, // t.numb._.of.lead END
+	0x69,0x6E,0x67,0x20,0x7A,0x65,0x72,0x6F,0x73,0x0A,0x82,0x27,0x82,0x38,0x80,0x2C, // ing.zeros..'.8., END
+	0x80,0x37,0x01,0x69,0x66,0x82,0x62,0x03,0x74,0x68,0x65,0x6E,0x82,0x3E,0x85,0x7D, // .7.if.b.then.>.} END
+	0x04,0x33,0x32,0x2C,0x20,0x73,0x80,0x9C,0x05,0x64,0x6A,0x75,0x73,0x74,0x20,0x80, // .32,.s...djust.. END
+	0x9D,0x80,0xA9,0x01,0x33,0x31,0x81,0xAF,0x04,0x6D,0x61,0x74,0x63,0x68,0x80,0x97, // ....31...match.. END
+	0x00,0x31,0x81,0x97,0x00,0x70,0x80,0xC3,0x82,0x99,0x0E,0x66,0x69,0x63,0x61,0x74, // .1...p.....ficat END
+	0x69,0x6F,0x6E,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x80,0x2B,0x09,0x0A,0x63,0x6D, // ion.mov.r1.+..cm END
+	0x70,0x20,0x72,0x32,0x20,0x72,0x30,0x80,0x0F,0x06,0x0A,0x73,0x6B,0x69,0x70,0x6C, // p.r2.r0....skipl END
+	0x65,0x80,0x0F,0x02,0x0A,0x64,0x65,0x2D,0x63,0x20,0x72,0x30,0x0A,0x3B,0x20,0x73, // e....de-c.r0.;.s END
+	0x75,0x62,0x74,0x72,0x61,0x63,0x74,0x20,0x63,0x6C,0x7A,0x20,0x66,0x72,0x6F,0x6D, // ubtract.clz.from END
+	0x20,0x33,0x31,0x20,0x74,0x6F,0x20,0x67,0x65,0x74,0x20,0x6C,0x6F,0x67,0x32,0x20, // .31.to.get.log2. END
+	0x76,0x61,0x6C,0x75,0x65,0x0A,0x80,0x26,0x80,0x2F,0x02,0x20,0x72,0x31,0x81,0x35, // value..&./..r1.5 END
+	0x03,0x72,0x65,0x74,0x0A,0x80,0x3A,0x04,0x69,0x6E,0x74,0x33,0x32,0x80,0x23,0x0A, // .ret..:.int32.#. END
+	0x31,0x30,0x28,0x78,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x80,0x19,0x0A,0x75,0x72, // 10(x=r0).-....ur END
+	0x6E,0x73,0x20,0x66,0x6C,0x6F,0x6F,0x72,0x28,0x84,0x1B,0x01,0x29,0x29,0x80,0x2A, // ns.floor(...)).* END
+	0x81,0x3D,0x12,0x28,0x61,0x73,0x20,0x73,0x74,0x61,0x6E,0x64,0x61,0x72,0x64,0x20, // .=.(as.standard. END
+	0x31,0x36,0x20,0x62,0x69,0x74,0x83,0x5E,0x11,0x29,0x2C,0x20,0x77,0x68,0x65,0x72, // 16.bit.^.),.wher END
+	0x65,0x20,0x78,0x20,0x69,0x73,0x20,0x61,0x20,0x70,0x6F,0x80,0x5B,0x01,0x65,0x72, // e.x.is.a.po.[.er END
+	0x81,0x87,0x03,0x61,0x20,0x33,0x32,0x87,0x28,0x00,0x2E,0x86,0x61,0x09,0x30,0x20, // ...a.32.(...a.0. END
+	0x66,0x6F,0x72,0x20,0x78,0x3D,0x30,0x20,0x80,0x54,0x13,0x61,0x20,0x73,0x70,0x65, // for.x=0..T.a.spe END
+	0x63,0x69,0x61,0x6C,0x20,0x63,0x61,0x73,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88, // cial.case.label. END
+	0x9E,0x80,0xE6,0x02,0x43,0x61,0x6C,0x80,0x1C,0x80,0xE2,0x80,0x7D,0x05,0x20,0x75, // ....Cal.....}..u END
+	0x73,0x65,0x20,0x69,0x37,0x74,0x20,0x74,0x6F,0x20,0x6C,0x6F,0x6F,0x6B,0x75,0x70, // se.i7t.to.lookup END
+	0x20,0x61,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x67,0x75,0x65,0x73,0x73,0x0A,0x70, // .a.first.guess.p END
+	0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x69,0x6E, // ush16.r0.call.in END
+	0x74,0x33,0x32,0x63,0x6C,0x7A,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x83,0x0F,0x0F, // t32clz.mov.r1... END
+	0x6C,0x6F,0x67,0x31,0x30,0x41,0x72,0x72,0x61,0x79,0x43,0x6C,0x7A,0x74,0x6F,0x4C, // log10ArrayClztoL END
+	0x81,0x0E,0x00,0x47,0x82,0x3D,0x02,0x61,0x64,0x64,0x80,0x3A,0x82,0x02,0x09,0x31, // ...G.=.add.:...1 END
+	0x0A,0x6C,0x6F,0x61,0x64,0x38,0x20,0x72,0x32,0x81,0x4C,0x02,0x70,0x6F,0x70,0x83, // .load8.r2.L.pop. END
+	0x55,0x00,0x3B,0x81,0x10,0x0B,0x6E,0x6F,0x77,0x20,0x63,0x6F,0x6E,0x74,0x61,0x69, // U.;...now.contai END
+	0x6E,0x73,0x89,0x7D,0x02,0x20,0x61,0x74,0x80,0x95,0x80,0x5C,0x03,0x28,0x78,0x29, // ns.}..at...\.(x) END
+	0x2C,0x80,0x2A,0x0E,0x62,0x75,0x74,0x20,0x69,0x74,0x20,0x6D,0x61,0x79,0x20,0x6E, // ,.*.but.it.may.n END
+	0x65,0x65,0x64,0x80,0x8D,0x09,0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x69,0x6E,0x67, // eed...crementing END
+	0x81,0xC1,0x01,0x62,0x65,0x80,0x46,0x04,0x72,0x72,0x65,0x63,0x74,0x80,0x57,0x05, // ...be.F.rrect.W. END
+	0x28,0x77,0x68,0x69,0x6C,0x65,0x81,0x7E,0x02,0x73,0x74,0x69,0x80,0xBA,0x86,0x60, // (while.~.sti...` END
+	0x01,0x78,0x29,0x82,0xD5,0x82,0x8A,0x06,0x3B,0x20,0x70,0x72,0x6F,0x74,0x65,0x1F, // .x).....;.prote. END
+	0x63,0x74,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x67,0x75,0x65,0x73,0x73,0x0A,0x70, // ct.first.guess.p END
+	0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x20,0x3B,0x20,0x70,0x72,0x6F,0x74,0x65, // ush16.r0.;.prote END
+	0x80,0x1F,0x0C,0x78,0x20,0x70,0x6F,0x69,0x6E,0x74,0x65,0x72,0x0A,0x6D,0x6F,0x76, // ...x.pointer.mov END
+	0x81,0x1A,0x05,0x72,0x32,0x0A,0x69,0x6E,0x63,0x80,0x24,0x05,0x0A,0x63,0x61,0x6C, // ...r2.inc.$..cal END
+	0x6C,0x20,0x80,0x1B,0x05,0x33,0x32,0x65,0x78,0x70,0x31,0x81,0x34,0x80,0x39,0x0B, // l....32exp1.4.9. END
+	0x6E,0x6F,0x77,0x20,0x63,0x6F,0x6E,0x74,0x61,0x69,0x6E,0x73,0x85,0x3A,0x07,0x20, // now.contains.:.. END
+	0x74,0x6F,0x20,0x31,0x30,0x5E,0x28,0x88,0x6B,0x08,0x20,0x2B,0x20,0x31,0x29,0x0A, // to.10^(.k..+.1). END
+	0x70,0x6F,0x70,0x81,0x6F,0x00,0x31,0x81,0x3A,0x05,0x65,0x73,0x74,0x6F,0x72,0x65, // pop.o.1.:.estore END
+	0x87,0x6F,0x81,0x59,0x00,0x6F,0x80,0x1B,0x88,0x66,0x00,0x4C,0x80,0xA4,0x04,0x45, // .o.Y.o...f.L...E END
+	0x71,0x75,0x61,0x6C,0x81,0x38,0x00,0x38,0x8B,0x37,0x89,0xC7,0x8F,0x88,0x03,0x31, // qual.8.8.7.....1 END
+	0x20,0x69,0x66,0x89,0xEA,0x06,0x20,0x6E,0x65,0x65,0x64,0x73,0x20,0x1C,0x69,0x6E, // .if....needs..in END
+	0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x69,0x6E,0x67,0x2C,0x20,0x30,0x20,0x69,0x66, // crementing,.0.if END
+	0x20,0x6E,0x6F,0x74,0x0A,0x61,0x64,0x64,0x20,0x72,0x30,0x82,0x02,0x06,0x31,0x0A, // .not.add.r0...1. END
+	0x72,0x65,0x74,0x0A,0xFF,0xD4,0x00,0x18,0x02,0x25,0x05,0x69,0x6E,0x74,0x33,0x32, // ret......%.int32 END
+	0x6D,0x75,0x6C,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x65,0x6E,0x64, // mul.s.requireend END
+	0x20,0x82,0x15,0x07,0x73,0x65,0x74,0x2E,0x73,0x0A,0x0A,0x3B,0x83,0x0D,0x80,0x23, // ....set.s..;...# END
+	0x13,0x31,0x36,0x31,0x36,0x28,0x64,0x65,0x73,0x74,0x3D,0x72,0x30,0x2C,0x20,0x6F, // .1616(dest=r0,.o END
+	0x70,0x41,0x3D,0x72,0x31,0x81,0x07,0x28,0x42,0x3D,0x72,0x32,0x29,0x20,0x2D,0x20, // pA=r1..(B=r2).-. END
+	0x73,0x74,0x6F,0x72,0x65,0x73,0x20,0x70,0x72,0x6F,0x64,0x75,0x63,0x74,0x20,0x6F, // stores.product.o END
+	0x66,0x20,0x74,0x77,0x6F,0x20,0x31,0x36,0x2D,0x62,0x69,0x74,0x20,0x76,0x61,0x6C, // f.two.16-bit.val END
+	0x75,0x80,0x1C,0x80,0x6F,0x04,0x6F,0x20,0x33,0x32,0x20,0x81,0x12,0x00,0x64,0x1D, // u...o.o.32....d. END
+	0x65,0x73,0x74,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x6D, // est.label.int32m END
+	0x75,0x6C,0x31,0x36,0x31,0x36,0x0A,0x3B,0x20,0x53,0x65,0x74,0x20,0x64,0x80,0x1D, // ul1616.;.Set.d.. END
+	0x0D,0x3D,0x6F,0x70,0x41,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x86, // .=opA.push16.r0. END
+	0x09,0x04,0x32,0x0A,0x63,0x61,0x6C,0x84,0x34,0x02,0x73,0x65,0x74,0x80,0x32,0x02, // ..2.cal.4.set.2. END
+	0x70,0x6F,0x70,0x81,0x22,0x00,0x31,0x85,0x08,0x00,0x30,0x80,0x44,0x06,0x43,0x6F, // pop.".1...0.D.Co END
+	0x6D,0x70,0x75,0x74,0x65,0x82,0x48,0x00,0x2A,0x80,0x49,0x04,0x42,0x0A,0x6A,0x6D, // mpute.H.*.I.B.jm END
+	0x70,0x88,0x69,0x12,0x20,0x3B,0x20,0x74,0x68,0x69,0x73,0x20,0x66,0x75,0x6E,0x63, // p.i..;.this.func END
+	0x74,0x69,0x6F,0x6E,0x20,0x77,0x69,0x80,0x54,0x0D,0x72,0x65,0x74,0x75,0x72,0x6E, // tion.wi.T.return END
+	0x20,0x66,0x6F,0x72,0x20,0x75,0x73,0x0A,0x80,0x8B,0x87,0x9A,0x00,0x28,0x82,0x92, // .for.us......(.. END
+	0x03,0x72,0x30,0x2C,0x20,0x80,0x96,0x23,0x3D,0x72,0x31,0x29,0x20,0x2D,0x20,0x73, // .r0,...#=r1).-.s END
+	0x74,0x6F,0x72,0x65,0x73,0x20,0x70,0x72,0x6F,0x64,0x75,0x63,0x74,0x20,0x6F,0x66, // tores.product.of END
+	0x20,0x33,0x32,0x2D,0x62,0x69,0x74,0x20,0x76,0x61,0x6C,0x75,0x83,0x7B,0x06,0x20, // .32-bit.valu.{.. END
+	0x61,0x6E,0x64,0x20,0x31,0x36,0x88,0x15,0x80,0xD5,0x81,0xF1,0x00,0x6F,0x16,0x20, // and.16.......o.. END
+	0x64,0x65,0x73,0x74,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32, // dest.label.int32 END
+	0x6D,0x75,0x6C,0x31,0x36,0x0A,0x80,0x05,0x0F,0x33,0x32,0x77,0x20,0x72,0x30,0x20, // mul16....32w.r0. END
+	0x72,0x31,0x0A,0x72,0x65,0x74,0x0A,0x0A,0x3B,0x86,0x1E,0x02,0x33,0x32,0x28,0x81, // r1.ret..;...32(. END
+	0x34,0x2F,0x3D,0x72,0x30,0x2C,0x20,0x6F,0x70,0x41,0x3D,0x72,0x31,0x29,0x20,0x2D, // 4/=r0,.opA=r1).- END
+	0x20,0x73,0x74,0x6F,0x72,0x65,0x73,0x20,0x70,0x72,0x6F,0x64,0x75,0x63,0x74,0x20, // .stores.product. END
+	0x6F,0x66,0x20,0x74,0x77,0x6F,0x20,0x33,0x32,0x2D,0x62,0x69,0x74,0x20,0x76,0x61, // of.two.32-bit.va END
+	0x6C,0x75,0x80,0x1C,0x81,0x6B,0x03,0x20,0x61,0x6E,0x64,0x81,0x36,0x81,0x6D,0x00, // lu...k..and.6.m. END
+	0x6F,0x91,0x7D,0x01,0x33,0x32,0x83,0x7D,0x88,0x7C,0x00,0xFF,0xD7,0x00,0x0F,0x03, // o.}.32.}.|...... END
+	0x05,0x07,0x69,0x6E,0x74,0x33,0x32,0x73,0x65,0x74,0x2E,0x73,0x00,0x3B,0x20,0x85, // ..int32set.s.;.. END
+	0x0C,0x1C,0x31,0x36,0x28,0x64,0x65,0x73,0x74,0x3D,0x72,0x30,0x2C,0x20,0x73,0x72, // ..16(dest=r0,.sr END
+	0x63,0x3D,0x72,0x31,0x29,0x20,0x2D,0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x20,0x81, // c=r1).-.32.bit.. END
+	0x19,0x08,0x20,0x70,0x74,0x72,0x20,0x3D,0x20,0x31,0x36,0x82,0x11,0x80,0x22,0x0B, // ...ptr.=.16...". END
+	0x20,0x76,0x61,0x6C,0x75,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88,0x46,0x0E,0x0A, // .value.label.F.. END
+	0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x30,0x0A,0x73,0x74,0x6F,0x72,0x65,0x80,0x2F, // mov.r2.0.store./ END
+	0x01,0x72,0x30,0x80,0x0F,0x85,0x0D,0x00,0x64,0x82,0x0E,0x08,0x31,0x20,0x32,0x0A, // .r0.....d...1.2. END
+	0x72,0x65,0x74,0x0A,0x0A,0x87,0x80,0x04,0x55,0x70,0x70,0x65,0x72,0xA5,0x85,0x00, // ret.....Upper... END
+	0x28,0x8D,0x86,0x02,0x29,0x3C,0x3C,0x80,0x7A,0x8B,0x8B,0x84,0x51,0x8A,0x87,0x00, // (...)<<.z...Q... END
+	0x31,0x14,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x30,0x0A,0x73,0x74,0x6F,0x72, // 1..mov.r2.0.stor END
+	0x65,0x31,0x36,0x64,0x20,0x72,0x30,0x81,0x10,0x27,0x32,0x0A,0x72,0x65,0x74,0x0A, // e16d.r0..'2.ret. END
+	0x0A,0x3B,0x20,0x69,0x6E,0x74,0x33,0x32,0x73,0x65,0x74,0x31,0x36,0x73,0x68,0x69, // .;.int32set16shi END
+	0x66,0x74,0x28,0x64,0x65,0x73,0x74,0x3D,0x72,0x30,0x2C,0x20,0x73,0x72,0x63,0x3D, // ft(dest=r0,.src= END
+	0x72,0x31,0x80,0x07,0x81,0x16,0x0A,0x3D,0x72,0x32,0x29,0x20,0x2D,0x20,0x6C,0x69, // r1.....=r2).-.li END
+	0x6B,0x65,0x88,0x31,0x08,0x20,0x62,0x75,0x74,0x20,0x61,0x6C,0x73,0x6F,0x83,0x24, // ke.1..but.also.$ END
+	0x00,0x73,0x81,0x33,0x0B,0x20,0x66,0x69,0x72,0x73,0x74,0x0A,0x6C,0x61,0x62,0x65, // .s.3..first.labe END
+	0x6C,0x8D,0x5C,0x83,0x8D,0x07,0x33,0x20,0x31,0x36,0x0A,0x73,0x75,0x62,0x81,0x09, // l.\...3.16.sub.. END
+	0x81,0x02,0x04,0x32,0x0A,0x73,0x68,0x72,0x82,0x0C,0x00,0x31,0x80,0x1C,0x85,0xA8, // ...2.shr...1.... END
+	0x82,0xA7,0x80,0x0D,0x01,0x68,0x6C,0x85,0x1A,0x80,0x27,0x89,0xC3,0x00,0x33,0x91, // .....hl...'...3. END
+	0xC3,0x01,0x31,0x36,0x8A,0xC0,0x00,0x55,0x0E,0x70,0x70,0x65,0x72,0x3D,0x72,0x31, // ..16...U.pper=r1 END
+	0x2C,0x20,0x73,0x72,0x63,0x4C,0x6F,0x77,0x81,0x0C,0x2F,0x32,0x29,0x20,0x2D,0x20, // ,.srcLow../2).-. END
+	0x73,0x65,0x74,0x73,0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x20,0x64,0x65,0x73,0x74, // sets.32.bit.dest END
+	0x20,0x74,0x6F,0x20,0x28,0x72,0x31,0x3C,0x3C,0x31,0x36,0x29,0x7C,0x72,0x32,0x0A, // .to.(r1<<16)|r2. END
+	0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x80,0x2A,0x11,0x31,0x36, // label.int32.*.16 END
+	0x31,0x36,0x0A,0x73,0x74,0x6F,0x72,0x65,0x31,0x36,0x20,0x72,0x30,0x20,0x72,0x31, // 16.store16.r0.r1 END
+	0x85,0x0D,0x00,0x64,0x82,0x0E,0x09,0x32,0x20,0x32,0x0A,0x72,0x65,0x74,0x0A,0x0A, // ...d...2.2.ret.. END
+	0x3B,0x86,0x32,0x02,0x33,0x32,0x28,0x81,0x57,0x02,0x3D,0x72,0x30,0x82,0x7B,0x80, // ;.2.32(.W.=r0.{. END
+	0x83,0x81,0x76,0x04,0x63,0x6F,0x70,0x69,0x65,0x86,0x78,0x80,0x93,0x02,0x20,0x70, // ..v.copie.x....p END
+	0x6F,0x80,0x64,0x01,0x65,0x64,0x81,0x7F,0x01,0x62,0x79,0x80,0x58,0x81,0x73,0x00, // o.d.ed...by.X.s. END
+	0x6F,0x8A,0x99,0x8C,0x21,0x00,0x30,0x8C,0x9B,0x05,0x33,0x32,0x0A,0x6D,0x6F,0x76, // o...!.0...32.mov END
+	0x81,0x83,0x01,0x34,0x0A,0x80,0x5E,0x05,0x79,0x62,0x6C,0x6F,0x63,0x6B,0x83,0xA4, // ...4..^.yblock.. END
+	0x80,0x98,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xF7,0x00,0x0F,0x01,0x99,0x04,0x69, // ....ret........i END
+	0x6E,0x74,0x33,0x32,0x63,0x6D,0x70,0x2E,0x73,0x00,0x3B,0x20,0x82,0x0C,0x17,0x45, // nt32cmp.s.;....E END
+	0x71,0x75,0x61,0x6C,0x28,0x6F,0x70,0x41,0x3D,0x72,0x30,0x2C,0x20,0x6F,0x70,0x42, // qual(opA=r0,.opB END
+	0x3D,0x72,0x31,0x29,0x20,0x2D,0x20,0x80,0xAB,0x07,0x75,0x72,0x6E,0x73,0x20,0x31, // =r1).-....urns.1 END
+	0x2F,0x30,0x80,0x28,0x08,0x20,0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88,0x34, // /0.(..r0.label.4 END
+	0x00,0x0A,0x80,0x47,0x01,0x33,0x32,0x80,0x19,0x06,0x20,0x72,0x31,0x0A,0x6D,0x6F, // ...G.32....r1.mo END
+	0x76,0x80,0x06,0x81,0x26,0x82,0x09,0x09,0x30,0x20,0x31,0x0A,0x73,0x6B,0x69,0x70, // v...&...0.1.skip END
+	0x65,0x71,0x86,0x1C,0x01,0x30,0x20,0x27,0x30,0x0A,0x72,0x65,0x74,0x0A,0x0A,0x3B, // eq...0.'0.ret..; END
+	0x20,0x69,0x6E,0x74,0x33,0x32,0x4C,0x65,0x73,0x73,0x54,0x68,0x61,0x6E,0x28,0x6F, // .int32LessThan(o END
+	0x70,0x41,0x3D,0x72,0x30,0x2C,0x20,0x6F,0x70,0x42,0x3D,0x72,0x31,0x29,0x20,0x2D, // pA=r0,.opB=r1).- END
+	0x80,0x09,0x01,0x41,0x3C,0x80,0x0D,0x01,0x3F,0x20,0x80,0x2F,0x07,0x75,0x72,0x6E, // ...A<...?../.urn END
+	0x73,0x20,0x31,0x2F,0x30,0x80,0x34,0x08,0x20,0x72,0x30,0x0A,0x6C,0x61,0x62,0x65, // s.1/0.4..r0.labe END
+	0x6C,0x8B,0x40,0x05,0x0A,0x63,0x6D,0x70,0x33,0x32,0x80,0x1C,0x06,0x20,0x72,0x31, // l.@..cmp32....r1 END
+	0x0A,0x6D,0x6F,0x76,0x80,0x06,0x81,0x29,0x82,0x09,0x09,0x30,0x20,0x31,0x0A,0x73, // .mov...)...0.1.s END
+	0x6B,0x69,0x70,0x6C,0x74,0x86,0x1C,0x01,0x30,0x20,0x8F,0x87,0x04,0x45,0x71,0x75, // kiplt...0....Equ END
+	0x61,0x6C,0x94,0x88,0x00,0x3D,0xA3,0x89,0x82,0x42,0x9B,0x8A,0x19,0x31,0x0A,0x73, // al...=...B...1.s END
+	0x6B,0x69,0x70,0x6C,0x65,0x20,0x72,0x31,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20, // kiple.r1.mov.r0. END
+	0x30,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xE3,0x00,0x11,0x01,0x10,0x03,0x69,0x6E,0x74, // 0.ret........int END
+	0x33,0x32,0x73,0x68,0x69,0x66,0x74,0x2E,0x73,0x00,0x3B,0x20,0x82,0x0E,0x00,0x53, // 32shift.s.;....S END
+	0x81,0x0E,0x09,0x4C,0x65,0x66,0x74,0x28,0x72,0x30,0x3D,0x78,0x2C,0x80,0x9D,0x05, // ...Left(r0=x,... END
+	0x3D,0x73,0x29,0x20,0x2D,0x20,0x82,0x26,0x03,0x20,0x78,0x20,0x6C,0x80,0x1A,0x0F, // =s).-..&..x.l... END
+	0x20,0x62,0x79,0x20,0x73,0x20,0x62,0x69,0x74,0x73,0x0A,0x6C,0x61,0x62,0x65,0x6C, // .by.s.bits.label END
+	0x8C,0x39,0x00,0x0A,0x82,0x52,0x01,0x33,0x32,0x81,0xD2,0x80,0xDC,0x81,0xD3,0x00, // .9...R.32....... END
+	0x0A,0x89,0x5D,0x05,0x52,0x69,0x67,0x68,0x74,0x28,0x31,0x72,0x30,0x3D,0x78,0x2C, // ..].Right(1r0=x, END
+	0x20,0x72,0x31,0x3D,0x73,0x29,0x20,0x2D,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x78, // .r1=s).-.shift.x END
+	0x20,0x72,0x69,0x67,0x68,0x74,0x20,0x62,0x79,0x20,0x73,0x20,0x62,0x69,0x74,0x73, // .right.by.s.bits END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x53,0x81,0x22,0x00, // .label.int32S.". END
+	0x52,0x81,0x1F,0x01,0x0A,0x3B,0x83,0x2F,0x01,0x33,0x32,0x83,0x37,0x00,0x73,0x84, // R....;./.32.7.s. END
+	0x36,0x11,0x66,0x6F,0x72,0x20,0x6E,0x65,0x67,0x61,0x74,0x69,0x76,0x65,0x20,0x61, // 6.for.negative.a END
+	0x6D,0x6F,0x75,0x6E,0x80,0x41,0x0B,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x30,0x0A, // moun.A.mov.r2.0. END
+	0x73,0x75,0x62,0x80,0x6E,0x81,0x0B,0x02,0x72,0x31,0x0A,0x85,0x3F,0x01,0x72,0x30, // sub.n...r1..?.r0 END
+	0x81,0x0D,0x04,0x72,0x65,0x74,0x0A,0xFF,0xEC,0x00,0x0F,0x00,0xF0,0x02,0x69,0x6E, // ...ret........in END
+	0x74,0x33,0x32,0x61,0x64,0x64,0x2E,0x73,0x00,0x3B,0x20,0x82,0x0C,0x0C,0x69,0x6E, // t32add.s.;....in END
+	0x63,0x28,0x64,0x65,0x73,0x74,0x3D,0x72,0x30,0x29,0x3D,0x85,0x1E,0x01,0x31,0x36, // c(dest=r0)=...16 END
+	0x82,0x13,0x04,0x2C,0x31,0x29,0x20,0x2D,0x80,0x26,0x07,0x63,0x72,0x65,0x6D,0x65, // ...,1).-.&.creme END
+	0x6E,0x74,0x20,0x81,0x27,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x86,0x3B,0x09,0x0A, // nt..'..label.;.. END
+	0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x31,0x0A,0x80,0x55,0x05,0x33,0x32,0x77,0x20, // mov.r1.1..U.32w. END
+	0x72,0x30,0x80,0x0E,0x05,0x0A,0x72,0x65,0x74,0x0A,0x0A,0x84,0x61,0x87,0x4F,0x80, // r0....ret...a.O. END
+	0x63,0x08,0x2C,0x20,0x73,0x72,0x63,0x3D,0x72,0x31,0x29,0x89,0x47,0x82,0x71,0x9A, // c.,.src=r1).G.q. END
+	0x40,0x01,0x33,0x32,0x87,0x40,0x02,0x6F,0x70,0x41,0x90,0x40,0x01,0x33,0x32,0x83, // @.32.@.opA.@.32. END
+	0x81,0x88,0x80,0x00,0xFF,0x8C,0x00,0x15,0x08,0x0A,0x11,0x69,0x6E,0x74,0x33,0x32, // ...........int32 END
+	0x73,0x74,0x72,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x82,0x12, // str.s.require... END
+	0x09,0x63,0x6F,0x6D,0x6D,0x6F,0x6E,0x2E,0x73,0x0A,0x0A,0x84,0x16,0x02,0x65,0x6E, // .common.s.....en END
+	0x64,0x83,0x19,0x02,0x61,0x64,0x64,0x80,0x16,0x8D,0x15,0x02,0x64,0x69,0x76,0x90, // d...add.....div. END
+	0x15,0x02,0x67,0x65,0x74,0x90,0x2B,0x02,0x6C,0x6F,0x67,0x90,0x41,0x02,0x6D,0x75, // ..get.+.log.A.mu END
+	0x6C,0x90,0x57,0x00,0x73,0x82,0x41,0x05,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x83,0x99, // l.W.s.A..const.. END
+	0x10,0x74,0x6F,0x53,0x74,0x72,0x42,0x75,0x66,0x53,0x69,0x7A,0x65,0x20,0x31,0x32, // .toStrBufSize.12 END
+	0x20,0x3B,0x80,0xB0,0x1D,0x63,0x6C,0x75,0x64,0x65,0x73,0x20,0x73,0x70,0x61,0x63, // .;...cludes.spac END
+	0x65,0x20,0x66,0x6F,0x72,0x20,0x6E,0x75,0x6C,0x6C,0x20,0x74,0x65,0x72,0x6D,0x69, // e.for.null.termi END
+	0x6E,0x61,0x74,0x80,0x0F,0x00,0x61,0x80,0xBD,0x09,0x70,0x6F,0x74,0x65,0x6E,0x74, // nat...a...potent END
+	0x69,0x61,0x6C,0x20,0x80,0x15,0x00,0x75,0x80,0x2D,0x00,0x69,0x18,0x67,0x6E,0x0A, // ial....u.-.i.gn. END
+	0x0A,0x61,0x77,0x20,0x69,0x6E,0x74,0x33,0x32,0x74,0x6F,0x53,0x74,0x72,0x53,0x63, // .aw.int32toStrSc END
+	0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x10,0x04,0x20,0x32,0x0A,0x0A,0x3B,0x88,0x1B, // ratchI....2..;.. END
+	0x16,0x28,0x73,0x74,0x72,0x3D,0x72,0x30,0x2C,0x20,0x78,0x3D,0x72,0x31,0x29,0x20, // .(str=r0,.x=r1). END
+	0x2D,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x80,0x28,0x0B,0x62,0x69,0x74,0x20,0x76, // -.write..(.bit.v END
+	0x61,0x6C,0x75,0x65,0x20,0x70,0x6F,0x80,0x4B,0x09,0x65,0x64,0x20,0x74,0x6F,0x20, // alue.po.K.ed.to. END
+	0x62,0x79,0x20,0x78,0x80,0x59,0x07,0x20,0x64,0x65,0x63,0x69,0x6D,0x61,0x6C,0x81, // by.x.Y..decimal. END
+	0x64,0x07,0x6F,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x80,0x48,0x07,0x20,0x62,0x75, // d.o.given..H..bu END
+	0x66,0x66,0x65,0x72,0x2E,0x84,0x07,0x09,0x20,0x73,0x68,0x6F,0x75,0x6C,0x64,0x20, // ffer.....should. END
+	0x68,0x6F,0x80,0x04,0x07,0x61,0x74,0x20,0x6C,0x65,0x61,0x73,0x74,0x88,0x97,0x06, // ho...at.least... END
+	0x42,0x75,0x66,0x53,0x69,0x7A,0x65,0x80,0x54,0x07,0x74,0x65,0x73,0x0A,0x6C,0x61, // BufSize.T.tes.la END
+	0x62,0x65,0x82,0x50,0x84,0xB5,0x80,0xA6,0x02,0x43,0x6F,0x70,0x83,0x6F,0x80,0x79, // be.P.....Cop.o.y END
+	0x00,0x73,0x83,0xC4,0x81,0xD6,0x1E,0x20,0x73,0x6F,0x20,0x77,0x65,0x20,0x63,0x61, // .s......so.we.ca END
+	0x6E,0x20,0x6D,0x6F,0x64,0x69,0x66,0x79,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20, // n.modify.push16. END
+	0x72,0x30,0x0A,0x6D,0x6F,0x76,0x15,0x20,0x72,0x30,0x20,0x69,0x6E,0x74,0x33,0x32, // r0.mov..r0.int32 END
+	0x74,0x6F,0x53,0x74,0x72,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x10,0x04, // toStrScratchI... END
+	0x0A,0x63,0x61,0x6C,0x6C,0x83,0x1B,0x01,0x73,0x65,0x81,0x0F,0x04,0x70,0x6F,0x70, // .call...se...pop END
+	0x31,0x36,0x80,0x2F,0x24,0x0A,0x3B,0x20,0x43,0x61,0x6C,0x63,0x75,0x6C,0x61,0x74, // 16./$.;.Calculat END
+	0x65,0x20,0x6C,0x6F,0x67,0x31,0x30,0x28,0x78,0x29,0x2B,0x31,0x20,0x74,0x6F,0x20, // e.log10(x)+1.to. END
+	0x67,0x65,0x74,0x20,0x6C,0x65,0x6E,0x67,0x74,0x68,0x80,0x54,0x09,0x20,0x64,0x65, // get.length.T..de END
+	0x63,0x69,0x6D,0x61,0x6C,0x20,0x28,0x82,0x24,0x10,0x20,0x68,0x61,0x6E,0x64,0x6C, // cimal.(.$..handl END
+	0x65,0x73,0x20,0x78,0x3D,0x30,0x20,0x63,0x61,0x73,0x65,0x81,0x22,0x06,0x6F,0x75, // es.x=0.case.".ou END
+	0x72,0x20,0x66,0x61,0x76,0x80,0x06,0x05,0x29,0x0A,0x70,0x75,0x73,0x68,0x83,0x60, // r.fav...).push.` END
+	0x02,0x6D,0x6F,0x76,0xA2,0x97,0x82,0x7C,0x03,0x0A,0x69,0x6E,0x63,0x86,0x34,0x00, // .mov...|..inc.4. END
+	0x31,0x81,0x9F,0x88,0xA8,0x0A,0x4D,0x6F,0x76,0x65,0x20,0x73,0x74,0x72,0x20,0x70, // 1.....Move.str.p END
+	0x6F,0x80,0xE5,0x01,0x65,0x72,0x81,0xA4,0x07,0x74,0x68,0x65,0x20,0x65,0x6E,0x64, // o...er...the.end END
+	0x20,0x80,0x8E,0x01,0x20,0x77,0x13,0x6F,0x72,0x6B,0x20,0x62,0x61,0x63,0x6B,0x77, // .....w.ork.backw END
+	0x61,0x72,0x64,0x73,0x0A,0x61,0x64,0x64,0x20,0x72,0x30,0x82,0x02,0x04,0x31,0x0A, // ards.add.r0...1. END
+	0x3B,0x20,0x41,0x80,0x0E,0x12,0x6E,0x75,0x6C,0x6C,0x20,0x74,0x65,0x72,0x6D,0x69, // ;.A...null.termi END
+	0x6E,0x61,0x74,0x6F,0x72,0x0A,0x6D,0x6F,0x76,0x80,0x1C,0x03,0x20,0x30,0x0A,0x73, // nator.mov....0.s END
+	0x80,0x0D,0x01,0x65,0x38,0x84,0x2B,0x02,0x64,0x65,0x63,0x80,0x38,0x80,0x32,0x22, // ...e8.+.dec.8.2" END
+	0x53,0x74,0x61,0x72,0x74,0x20,0x6F,0x66,0x20,0x64,0x69,0x67,0x69,0x74,0x20,0x70, // Start.of.digit.p END
+	0x72,0x69,0x6E,0x74,0x69,0x6E,0x67,0x20,0x6C,0x6F,0x6F,0x70,0x0A,0x6C,0x61,0x62, // rinting.loop.lab END
+	0x65,0x6C,0x20,0x80,0x11,0x07,0x33,0x32,0x74,0x6F,0x53,0x74,0x72,0x4C,0x80,0x14, // el....32toStrL.. END
+	0x82,0x30,0x80,0x6B,0x17,0x44,0x69,0x76,0x69,0x64,0x65,0x20,0x78,0x20,0x62,0x79, // .0.k.Divide.x.by END
+	0x20,0x31,0x30,0x20,0x77,0x68,0x69,0x6C,0x65,0x20,0x6D,0x61,0x6B,0x81,0x3C,0x03, // .10.while.mak.<. END
+	0x6E,0x6F,0x74,0x65,0x81,0x53,0x14,0x74,0x68,0x65,0x20,0x72,0x65,0x6D,0x61,0x69, // note.S.the.remai END
+	0x6E,0x64,0x65,0x72,0x2E,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x81,0x77,0x82,0x94, // nder..push16.w.. END
+	0x00,0x30,0x88,0x59,0x07,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x6A,0x85, // .0.Y.ScratchI.j. END
+	0xB2,0x04,0x31,0x30,0x0A,0x63,0x61,0x80,0xCC,0x82,0x7F,0x04,0x64,0x69,0x76,0x31, // ..10.ca.....div1 END
+	0x36,0x80,0xCC,0x0C,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x0A,0x70,0x6F,0x70,0x31, // 6...v.r1.r0.pop1 END
+	0x36,0x81,0x08,0x15,0x3B,0x20,0x50,0x72,0x69,0x6E,0x74,0x20,0x64,0x69,0x67,0x69, // 6...;.Print.digi END
+	0x74,0x20,0x74,0x6F,0x20,0x73,0x74,0x72,0x20,0x28,0x81,0x04,0x00,0x70,0x80,0x08, // t.to.str.(...p.. END
+	0x01,0x69,0x6E,0x80,0x2C,0x00,0x2C,0x84,0x1C,0x81,0x0C,0x07,0x31,0x29,0x0A,0x69, // .in.,.,.....1).i END
+	0x6E,0x63,0x34,0x38,0x80,0x46,0x05,0x0A,0x73,0x74,0x6F,0x72,0x65,0x80,0x09,0x00, // nc48.F..store... END
+	0x30,0x81,0x0C,0x02,0x64,0x65,0x63,0x83,0x4E,0x22,0x49,0x66,0x20,0x72,0x65,0x6D, // 0...dec.N"If.rem END
+	0x61,0x69,0x6E,0x69,0x6E,0x67,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x69,0x73,0x20, // aining.value.is. END
+	0x67,0x72,0x65,0x61,0x74,0x65,0x72,0x20,0x74,0x68,0x61,0x6E,0x20,0x80,0x51,0x06, // greater.than..Q. END
+	0x6C,0x6F,0x6F,0x70,0x20,0x61,0x67,0x80,0x26,0x81,0x73,0x00,0x70,0x82,0x82,0x02, // loop.ag.&.s.p... END
+	0x6E,0x65,0x78,0x84,0x87,0x04,0x0A,0x70,0x75,0x73,0x68,0x83,0x9F,0x01,0x6D,0x6F, // nex....push...mo END
+	0x80,0xB2,0x00,0x30,0x80,0x88,0x0F,0x74,0x33,0x32,0x74,0x6F,0x53,0x74,0x72,0x53, // ...0...t32toStrS END
+	0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x10,0x83,0x1D,0x01,0x31,0x20,0x82,0x0C, // cratchI.....1... END
+	0x0A,0x43,0x6F,0x6E,0x73,0x74,0x30,0x0A,0x63,0x61,0x6C,0x6C,0x83,0x2E,0x08,0x45, // .Const0.call...E END
+	0x71,0x75,0x61,0x6C,0x0A,0x63,0x6D,0x70,0x83,0xF3,0x82,0xF6,0x36,0x6F,0x70,0x31, // qual.cmp....6op1 END
+	0x36,0x20,0x72,0x30,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x20,0x72,0x31, // 6.r0.skipneqz.r1 END
+	0x0A,0x6A,0x6D,0x70,0x20,0x69,0x6E,0x74,0x33,0x32,0x74,0x6F,0x53,0x74,0x72,0x4C, // .jmp.int32toStrL END
+	0x6F,0x6F,0x70,0x53,0x74,0x61,0x72,0x74,0x0A,0x3B,0x20,0x44,0x6F,0x6E,0x65,0x0A, // oopStart.;.Done. END
+	0x72,0x65,0x74,0x0A,0x80,0x0B,0x82,0x21,0x03,0x66,0x72,0x6F,0x6D,0x80,0x23,0x26, // ret....!.from.#& END
+	0x28,0x78,0x3D,0x72,0x30,0x2C,0x20,0x73,0x74,0x72,0x3D,0x72,0x31,0x29,0x20,0x2D, // (x=r0,.str=r1).- END
+	0x20,0x61,0x74,0x74,0x65,0x6D,0x70,0x74,0x20,0x74,0x6F,0x20,0x70,0x61,0x72,0x73, // .attempt.to.pars END
+	0x65,0x20,0x67,0x69,0x76,0x65,0x6E,0x81,0x20,0x0B,0x20,0x61,0x73,0x20,0x61,0x20, // e.given....as.a. END
+	0x33,0x32,0x20,0x62,0x69,0x74,0x81,0x65,0x03,0x65,0x67,0x65,0x72,0x81,0x39,0x05, // 32.bit.e.eger.9. END
+	0x6F,0x72,0x65,0x73,0x20,0x30,0x80,0x77,0x12,0x20,0x78,0x20,0x6F,0x6E,0x20,0x66, // ores.0.w..x.on.f END
+	0x61,0x69,0x6C,0x75,0x72,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x8A,0x6B,0x80,0x86, // ailure.label.k.. END
+	0x0B,0x53,0x65,0x74,0x20,0x78,0x3D,0x30,0x0A,0x70,0x75,0x73,0x68,0x83,0xBE,0x85, // .Set.x=0.push... END
+	0x09,0x04,0x31,0x0A,0x6D,0x6F,0x76,0x80,0xC3,0x05,0x20,0x30,0x0A,0x63,0x61,0x6C, // ..1.mov....0.cal END
+	0x84,0x38,0x06,0x73,0x65,0x74,0x31,0x36,0x0A,0x70,0x83,0xEA,0x00,0x31,0x85,0x08, // .8.set16.p...1.. END
+	0x00,0x30,0x80,0xCF,0x01,0x4C,0x6F,0x56,0x6F,0x70,0x20,0x75,0x6E,0x74,0x69,0x6C, // .0...LoVop.until END
+	0x20,0x77,0x65,0x20,0x68,0x69,0x74,0x20,0x61,0x20,0x63,0x68,0x61,0x72,0x61,0x63, // .we.hit.a.charac END
+	0x74,0x65,0x72,0x20,0x6F,0x75,0x74,0x73,0x69,0x64,0x65,0x20,0x6F,0x66,0x20,0x27, // ter.outside.of.' END
+	0x30,0x27,0x2D,0x27,0x39,0x27,0x20,0x72,0x61,0x6E,0x67,0x65,0x0A,0x6C,0x61,0x62, // 0'-'9'.range.lab END
+	0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x66,0x72,0x6F,0x6D,0x53,0x74,0x72,0x4C, // el.int32fromStrL END
+	0x6F,0x6F,0x70,0x53,0x74,0x61,0x72,0x74,0x0A,0x3B,0x20,0x53,0x75,0x62,0x74,0x81, // oopStart.;.Subt. END
+	0x41,0x81,0x34,0x00,0x20,0x81,0x1F,0x82,0x52,0x0B,0x20,0x61,0x6E,0x64,0x20,0x74, // A.4.....R..and.t END
+	0x65,0x73,0x74,0x20,0x69,0x66,0x80,0x3A,0x05,0x20,0x76,0x61,0x6C,0x69,0x64,0x85, // est.if.:..valid. END
+	0x4F,0x0E,0x6F,0x61,0x64,0x38,0x20,0x72,0x32,0x20,0x72,0x31,0x0A,0x64,0x65,0x63, // O.oad8.r2.r1.dec END
+	0x34,0x81,0x0B,0x0C,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x30,0x0A,0x63,0x6D, // 4....mov.r3.0.cm END
+	0x70,0x81,0x08,0x81,0x1E,0x07,0x33,0x0A,0x73,0x6B,0x69,0x70,0x67,0x65,0x81,0x09, // p.....3.skipge.. END
+	0x00,0x6A,0x80,0x16,0x8D,0x82,0x02,0x45,0x6E,0x64,0x85,0x37,0x00,0x39,0x8F,0x37, // .j.....End.7.9.7 END
+	0x00,0x6C,0x90,0x37,0x27,0x74,0x72,0x4C,0x6F,0x6F,0x70,0x45,0x6E,0x64,0x0A,0x3B, // .l.7'trLoopEnd.; END
+	0x20,0x41,0x70,0x70,0x65,0x6E,0x64,0x20,0x74,0x68,0x69,0x73,0x20,0x64,0x69,0x67, // .Append.this.dig END
+	0x69,0x74,0x20,0x74,0x6F,0x20,0x72,0x75,0x6E,0x6E,0x69,0x6E,0x67,0x80,0x0A,0x0C, // it.to.running... END
+	0x74,0x61,0x6C,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x31,0x86,0x09,0x00, // tal.push16.r1... END
+	0x30,0x82,0x13,0x07,0x38,0x20,0x72,0x32,0x0A,0x6D,0x6F,0x76,0x80,0x19,0x14,0x20, // 0...8.r2.mov.... END
+	0x49,0x6E,0x74,0x33,0x32,0x43,0x6F,0x6E,0x73,0x74,0x31,0x45,0x31,0x0A,0x63,0x61, // Int32Const1E1.ca END
+	0x6C,0x6C,0x20,0x69,0x81,0x12,0x08,0x6D,0x75,0x6C,0x33,0x32,0x0A,0x70,0x6F,0x70, // ll.i...mul32.pop END
+	0x80,0x2C,0x80,0x3F,0x01,0x6F,0x70,0x87,0x3E,0x83,0x48,0x87,0x2A,0x04,0x61,0x64, // .,.?.op.>.H.*.ad END
+	0x64,0x31,0x36,0x88,0x22,0x83,0x2B,0x00,0x31,0x80,0xA3,0x81,0xAD,0x81,0x96,0x15, // d16.".+.1....... END
+	0x74,0x72,0x79,0x20,0x6E,0x65,0x78,0x74,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74, // try.next.charact END
+	0x65,0x72,0x0A,0x69,0x6E,0x63,0x81,0x98,0x02,0x6A,0x6D,0x70,0x83,0x6F,0x04,0x66, // er.inc...jmp.o.f END
+	0x72,0x6F,0x6D,0x53,0x83,0xDF,0x09,0x53,0x74,0x61,0x72,0x74,0x0A,0x6C,0x61,0x62, // romS...Start.lab END
+	0x65,0x84,0x8B,0x86,0x1B,0x0A,0x6F,0x70,0x45,0x6E,0x64,0x0A,0x72,0x65,0x74,0x0A, // e.....opEnd.ret. END
+	0xFF,0xF2,0x00,0x26,0x02,0x21,0x05,0x69,0x6E,0x74,0x33,0x32,0x2E,0x73,0x00,0x3B, // ...&.!.int32.s.; END
+	0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x20,0x6F,0x70,0x65,0x72,0x61,0x6E,0x64,0x73, // .32.bit.operands END
+	0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x70,0x6F,0x80,0x23,0x26,0x65,0x72, // .require.po.#&er END
+	0x73,0x20,0x74,0x6F,0x20,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x28,0x6F,0x72, // s.to.4.bytes.(or END
+	0x20,0x32,0x20,0x77,0x6F,0x72,0x64,0x73,0x29,0x2C,0x20,0x77,0x69,0x74,0x68,0x20, // .2.words),.with. END
+	0x66,0x69,0x72,0x73,0x74,0x80,0x14,0x83,0x20,0x0E,0x72,0x65,0x70,0x72,0x65,0x73, // first.....repres END
+	0x65,0x6E,0x74,0x69,0x6E,0x67,0x20,0x75,0x70,0x80,0x53,0x06,0x20,0x68,0x61,0x6C, // enting.up.S..hal END
+	0x66,0x2C,0x20,0x80,0x5A,0x04,0x20,0x73,0x65,0x63,0x6F,0x80,0x06,0x01,0x32,0x20, // f,..Z..seco...2. END
+	0x33,0x62,0x79,0x74,0x65,0x73,0x20,0x72,0x65,0x70,0x72,0x65,0x73,0x65,0x6E,0x74, // 3bytes.represent END
+	0x69,0x6E,0x67,0x20,0x6C,0x6F,0x77,0x65,0x72,0x20,0x68,0x61,0x6C,0x66,0x0A,0x0A, // ing.lower.half.. END
+	0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x69,0x6E,0x74,0x33,0x32,0x63,0x6F,0x6D, // require.int32com END
+	0x6D,0x6F,0x6E,0x2E,0x73,0x86,0x16,0x02,0x65,0x6E,0x64,0x83,0x19,0x02,0x61,0x64, // mon.s...end...ad END
+	0x64,0x80,0x16,0x8D,0x15,0x02,0x63,0x6D,0x70,0x90,0x15,0x02,0x64,0x69,0x76,0x90, // d.....cmp...div. END
+	0x2B,0x80,0x4A,0x06,0x69,0x61,0x6E,0x6E,0x65,0x73,0x73,0x91,0x1C,0x00,0x78,0x91, // +.J.ianness...x. END
+	0x48,0x03,0x66,0x70,0x75,0x74,0x90,0x75,0x01,0x67,0x65,0x91,0x15,0x02,0x6C,0x6F, // H.fput.u.ge...lo END
+	0x67,0x90,0xA1,0x01,0x6D,0x65,0x16,0x6D,0x2E,0x73,0x0A,0x72,0x65,0x71,0x75,0x69, // g...me.m.s.requi END
+	0x72,0x65,0x65,0x6E,0x64,0x20,0x69,0x6E,0x74,0x33,0x32,0x6D,0x6F,0x64,0x91,0x15, // reend.int32mod.. END
+	0x01,0x75,0x6C,0x90,0x2B,0x02,0x73,0x65,0x74,0x91,0x15,0x02,0x68,0x69,0x66,0x92, // .ul.+.set...hif. END
+	0x17,0x01,0x74,0x72,0x91,0x43,0x01,0x75,0x62,0x90,0x85,0x03,0x74,0x69,0x6D,0x65, // ..tr.C.ub...time END
+	0x80,0x9C,0x00,0xFF,0xDB,0x00,0x19,0x11,0x05,0x23,0x69,0x6E,0x74,0x33,0x32,0x74, // .........#int32t END
+	0x69,0x6D,0x65,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E, // ime.s.require... END
+	0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x07,0x63,0x61,0x6C,0x6C,0x2E,0x73, // /...sys...call.s END
+	0x0A,0x0A,0x84,0x1C,0x02,0x65,0x6E,0x64,0x81,0x1F,0x06,0x69,0x6F,0x2F,0x66,0x70, // .....end...io/fp END
+	0x75,0x74,0x80,0x18,0x92,0x17,0x02,0x64,0x65,0x63,0x8C,0x33,0x82,0x67,0x05,0x63, // ut.....dec.3.g.c END
+	0x6F,0x6D,0x6D,0x6F,0x6E,0x8B,0x34,0x83,0x18,0x01,0x6D,0x70,0x90,0x15,0x02,0x64, // ommon.4...mp...d END
+	0x69,0x76,0x90,0x2B,0x01,0x67,0x65,0x8C,0x76,0x82,0xC2,0x00,0x73,0x82,0x15,0x05, // iv.+.ge.v...s... END
+	0x0A,0x63,0x6F,0x6E,0x73,0x74,0x83,0x6C,0x22,0x44,0x61,0x74,0x65,0x53,0x69,0x7A, // .const.l"DateSiz END
+	0x65,0x20,0x37,0x20,0x3B,0x20,0x32,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x66,0x6F, // e.7.;.2.bytes.fo END
+	0x72,0x20,0x79,0x65,0x61,0x72,0x2C,0x20,0x31,0x20,0x65,0x61,0x25,0x63,0x68,0x20, // r.year,.1.ea%ch. END
+	0x66,0x6F,0x72,0x20,0x6F,0x74,0x68,0x65,0x72,0x73,0x0A,0x0A,0x61,0x77,0x20,0x69, // for.others..aw.i END
+	0x6E,0x74,0x33,0x32,0x70,0x75,0x74,0x74,0x69,0x6D,0x65,0x53,0x63,0x72,0x61,0x74, // nt32puttimeScrat END
+	0x63,0x68,0x49,0x81,0x12,0x02,0x41,0x20,0x32,0x99,0x1E,0x00,0x42,0x80,0x1E,0x01, // chI...A.2...B... END
+	0x0A,0x3B,0x83,0x3D,0x01,0x67,0x65,0x82,0x3D,0x20,0x6D,0x6F,0x6E,0x6F,0x74,0x6F, // .;.=.ge.=.monoto END
+	0x6E,0x69,0x63,0x28,0x72,0x30,0x3D,0x64,0x65,0x73,0x74,0x29,0x20,0x2D,0x20,0x73, // nic(r0=dest).-.s END
+	0x74,0x6F,0x72,0x65,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65,0x80,0x77,0x16,0x66,0x20, // tores.numbe.w.f. END
+	0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x20,0x73,0x69,0x6E,0x63,0x65,0x20,0x62,0x6F, // seconds.since.bo END
+	0x6F,0x74,0x69,0x6E,0x67,0x81,0x85,0x10,0x6F,0x20,0x33,0x32,0x20,0x62,0x69,0x74, // oting...o.32.bit END
+	0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x70,0x6F,0x80,0x99,0x02,0x65,0x64,0x20,0x80, // .value.po...ed.. END
+	0x17,0x02,0x62,0x79,0x20,0x81,0x4E,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x93,0x72, // ..by..N..label.r END
+	0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x0B,0x30,0x20, // ..mov.r1.r0...0. END
+	0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x54,0x80,0xD8,0x00,0x4D,0x85,0x9A, // SyscallIdT...M.. END
+	0x59,0x33,0x32,0x73,0x0A,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x0A,0x72,0x65,0x74, // Y32s.syscall.ret END
+	0x0A,0x0A,0x3B,0x20,0x69,0x6E,0x74,0x33,0x32,0x67,0x65,0x74,0x74,0x69,0x6D,0x65, // ..;.int32gettime END
+	0x72,0x65,0x61,0x6C,0x28,0x72,0x30,0x3D,0x64,0x65,0x73,0x74,0x29,0x20,0x2D,0x20, // real(r0=dest).-. END
+	0x73,0x74,0x6F,0x72,0x65,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66, // stores.number.of END
+	0x20,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x20,0x73,0x69,0x6E,0x63,0x65,0x20,0x31, // .seconds.since.1 END
+	0x73,0x74,0x20,0x4A,0x61,0x6E,0x20,0x31,0x39,0x37,0x30,0x81,0x47,0x10,0x6F,0x20, // st.Jan.1970.G.o. END
+	0x33,0x32,0x20,0x62,0x69,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x70,0x6F,0x80, // 32.bit.value.po. END
+	0x5B,0x02,0x65,0x64,0x20,0x80,0x17,0x02,0x62,0x79,0x20,0x81,0x53,0x05,0x0A,0x6C, // [.ed....by..S..l END
+	0x61,0x62,0x65,0x6C,0x8E,0x72,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72, // abel.r..mov.r1.r END
+	0x30,0x83,0x09,0x02,0x30,0x20,0x53,0x83,0xA3,0x02,0x49,0x64,0x54,0x80,0x95,0x00, // 0...0.S...IdT... END
+	0x52,0x80,0x95,0x95,0xB8,0x01,0x70,0x75,0x82,0xB8,0x81,0xB4,0x81,0xC0,0x81,0xB4, // R.....pu........ END
+	0x01,0x70,0x72,0x80,0xD2,0x01,0x73,0x20,0x81,0xCF,0x80,0xDC,0x05,0x20,0x61,0x20, // .pr...s.......a. END
+	0x68,0x75,0x6D,0x80,0xA4,0x80,0xDB,0x01,0x64,0x61,0x36,0x62,0x6C,0x65,0x20,0x66, // hum.....da6ble.f END
+	0x6F,0x72,0x6D,0x61,0x74,0x2C,0x20,0x65,0x2E,0x67,0x2E,0x20,0x35,0x6D,0x33,0x36, // ormat,.e.g..5m36 END
+	0x73,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x70,0x75,0x74, // s.label.int32put END
+	0x74,0x69,0x6D,0x65,0x0A,0x3B,0x20,0x43,0x6F,0x70,0x79,0x20,0x67,0x69,0x76,0x65, // time.;.Copy.give END
+	0x6E,0x20,0x81,0x11,0x10,0x20,0x74,0x6F,0x20,0x73,0x63,0x72,0x61,0x74,0x63,0x68, // n.....to.scratch END
+	0x20,0x76,0x61,0x72,0x69,0x61,0x81,0x4B,0x1B,0x74,0x68,0x61,0x74,0x20,0x77,0x65, // .varia.K.that.we END
+	0x20,0x63,0x61,0x6E,0x20,0x6D,0x6F,0x64,0x69,0x66,0x79,0x0A,0x6D,0x6F,0x76,0x20, // .can.modify.mov. END
+	0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x00,0x30,0x8A,0x56,0x00,0x53,0x83,0x40,0x00, // r1.r0...0.V.S.@. END
+	0x49,0x81,0x69,0x04,0x41,0x0A,0x63,0x61,0x6C,0x84,0x75,0x01,0x73,0x65,0x80,0x7A, // I.i.A.cal.u.se.z END
+	0x00,0x0A,0x81,0x74,0x03,0x68,0x65,0x63,0x6B,0x81,0xA2,0x04,0x20,0x64,0x61,0x79, // ...t.heck....day END
+	0x73,0x9F,0x42,0x84,0x6D,0x82,0x50,0x09,0x43,0x6F,0x6E,0x73,0x74,0x38,0x36,0x34, // s.B.m.P.Const864 END
+	0x30,0x30,0x88,0x59,0x0D,0x4C,0x65,0x73,0x73,0x54,0x68,0x61,0x6E,0x0A,0x63,0x6D, // 00.Y.LessThan.cm END
+	0x70,0x20,0x72,0x02,0x30,0x20,0x72,0x81,0x02,0x07,0x0A,0x73,0x6B,0x69,0x70,0x65, // p.r.0.r....skipe END
+	0x71,0x7A,0x81,0x0A,0x25,0x6A,0x6D,0x70,0x20,0x69,0x6E,0x74,0x33,0x32,0x70,0x75, // qz..%jmp.int32pu END
+	0x74,0x74,0x69,0x6D,0x65,0x4E,0x6F,0x44,0x61,0x79,0x73,0x0A,0x3B,0x20,0x59,0x65, // ttimeNoDays.;.Ye END
+	0x73,0x20,0x77,0x65,0x20,0x68,0x61,0x76,0x65,0x20,0x64,0x80,0x12,0x1C,0x2C,0x20, // s.we.have.d...,. END
+	0x64,0x69,0x76,0x69,0x64,0x65,0x20,0x74,0x6F,0x20,0x66,0x69,0x6E,0x64,0x20,0x68, // divide.to.find.h END
+	0x6F,0x77,0x20,0x6D,0x61,0x6E,0x79,0x0A,0x6D,0x6F,0x76,0x81,0x57,0x89,0x45,0x07, // ow.many.mov.W.E. END
+	0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x58,0x00,0x42,0x83,0x20,0x00,0x31, // ScratchI.X.B...1 END
+	0x96,0x20,0x05,0x41,0x0A,0x63,0x61,0x6C,0x6C,0x83,0x85,0x01,0x73,0x65,0x80,0x8A, // ...A.call...se.. END
+	0x9E,0x51,0x0B,0x20,0x3B,0x20,0x72,0x65,0x73,0x75,0x6C,0x74,0x20,0x77,0x69,0x80, // .Q..;.result.wi. END
+	0x39,0x07,0x62,0x65,0x20,0x73,0x74,0x6F,0x72,0x65,0x80,0x93,0x02,0x65,0x72,0x65, // 9.be.store...ere END
+	0x85,0x6E,0x82,0x7C,0x09,0x43,0x6F,0x6E,0x73,0x74,0x38,0x36,0x34,0x30,0x30,0x81, // .n.|.Const86400. END
+	0xA6,0x17,0x20,0x72,0x32,0x20,0x69,0x6E,0x74,0x33,0x32,0x70,0x75,0x74,0x74,0x69, // ...r2.int32putti END
+	0x6D,0x65,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x12,0x03,0x41,0x20,0x3B, // meScratchI...A.; END
+	0x20,0x84,0x0F,0x21,0x41,0x20,0x67,0x65,0x74,0x73,0x20,0x74,0x68,0x65,0x20,0x72, // ...!A.gets.the.r END
+	0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x69, // emainder.which.i END
+	0x73,0x20,0x75,0x73,0x65,0x64,0x80,0x45,0x08,0x20,0x6E,0x65,0x78,0x74,0x20,0x69, // s.used.E..next.i END
+	0x74,0x65,0x80,0x42,0x07,0x69,0x6F,0x6E,0x0A,0x63,0x61,0x6C,0x6C,0x83,0x5C,0x04, // te.B.ion.call.\. END
+	0x64,0x69,0x76,0x33,0x32,0x80,0x38,0x04,0x0A,0x3B,0x20,0x50,0x72,0x80,0x6E,0x0B, // div32.8..;.Pr.n. END
+	0x20,0x64,0x61,0x79,0x73,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x96,0x7E,0x00,0x42, // .days.mov.r0.~.B END
+	0x88,0x40,0x80,0x7D,0x06,0x4C,0x6F,0x77,0x65,0x72,0x31,0x36,0x83,0x55,0x80,0xAD, // .@.}.Lower16.U.. END
+	0x02,0x64,0x65,0x63,0x85,0x41,0x02,0x27,0x64,0x27,0x86,0x16,0x06,0x63,0x30,0x0A, // .dec.A.'d'...c0. END
+	0x6C,0x61,0x62,0x65,0x84,0x78,0x84,0xD5,0x02,0x4E,0x6F,0x44,0x81,0x70,0x80,0x7E, // labe.x...NoD.p.~ END
+	0x0F,0x43,0x68,0x65,0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x68,0x6F,0x75,0x72,0x73, // .Check.for.hours END
+	0x0A,0x1A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x69,0x6E,0x74,0x33,0x32,0x70,0x75, // ..mov.r0.int32pu END
+	0x74,0x74,0x69,0x6D,0x65,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x12,0x01, // ttimeScratchI... END
+	0x41,0x0A,0x82,0x20,0x01,0x31,0x20,0x82,0x0D,0x0D,0x43,0x6F,0x6E,0x73,0x74,0x33, // A....1....Const3 END
+	0x36,0x30,0x30,0x0A,0x63,0x61,0x6C,0x6C,0x83,0x34,0x0B,0x4C,0x65,0x73,0x73,0x54, // 600.call.4.LessT END
+	0x68,0x61,0x6E,0x0A,0x63,0x6D,0x70,0x81,0x49,0x82,0x02,0x07,0x0A,0x73,0x6B,0x69, // han.cmp.I....ski END
+	0x70,0x65,0x71,0x7A,0x81,0x0A,0x00,0x6A,0x80,0x17,0x89,0x5E,0x13,0x4E,0x6F,0x48, // peqz...j...^.NoH END
+	0x6F,0x75,0x72,0x73,0x0A,0x3B,0x20,0x59,0x65,0x73,0x20,0x77,0x65,0x20,0x68,0x61, // ours.;.Yes.we.ha END
+	0x76,0x80,0x04,0x81,0x13,0x0F,0x2C,0x20,0x64,0x69,0x76,0x69,0x64,0x65,0x20,0x74, // v.....,.divide.t END
+	0x6F,0x20,0x66,0x69,0x6E,0x64,0x80,0x15,0x05,0x77,0x20,0x6D,0x61,0x6E,0x79,0x83, // o.find...w.many. END
+	0x85,0x97,0xA6,0x00,0x42,0x85,0xA6,0x97,0xC7,0x87,0xB1,0x01,0x73,0x65,0x80,0xEB, // ....B.......se.. END
+	0x85,0x51,0x13,0x69,0x6E,0x74,0x33,0x32,0x70,0x75,0x74,0x74,0x69,0x6D,0x65,0x53, // .Q.int32puttimeS END
+	0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x12,0x25,0x42,0x20,0x3B,0x20,0x72,0x65, // cratchI..%B.;.re END
+	0x73,0x75,0x6C,0x74,0x20,0x77,0x69,0x6C,0x6C,0x20,0x62,0x65,0x20,0x73,0x74,0x6F, // sult.will.be.sto END
+	0x72,0x65,0x64,0x20,0x68,0x65,0x72,0x65,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20, // red.here.mov.r1. END
+	0x82,0x2A,0x08,0x43,0x6F,0x6E,0x73,0x74,0x33,0x36,0x30,0x30,0x83,0x15,0x01,0x32, // .*.Const3600...2 END
+	0x20,0x95,0x53,0x00,0x41,0x80,0x53,0x84,0x63,0x09,0x41,0x20,0x67,0x65,0x74,0x73, // ..S.A.S.c.A.gets END
+	0x20,0x74,0x68,0x65,0x80,0x65,0x12,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x20,0x77, // .the.e.mainder.w END
+	0x68,0x69,0x63,0x68,0x20,0x69,0x73,0x20,0x75,0x73,0x80,0x67,0x0A,0x69,0x6E,0x20, // hich.is.us.g.in. END
+	0x6E,0x65,0x78,0x74,0x20,0x69,0x74,0x65,0x80,0x96,0x05,0x69,0x6F,0x6E,0x0A,0x63, // next.ite...ion.c END
+	0x61,0x80,0x88,0x82,0xB0,0x04,0x64,0x69,0x76,0x33,0x32,0x80,0x38,0x04,0x0A,0x3B, // a.....div32.8..; END
+	0x20,0x50,0x72,0x80,0xC2,0x05,0x20,0x68,0x6F,0x75,0x72,0x73,0x83,0x95,0x00,0x30, // .Pr....hours...0 END
+	0x96,0x7F,0x00,0x42,0x88,0x41,0x80,0x7E,0x04,0x4C,0x6F,0x77,0x65,0x72,0x18,0x31, // ...B.A.~.Lower.1 END
+	0x36,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x64,0x65,0x63,0x0A,0x6D,0x6F, // 6.call.putdec.mo END
+	0x76,0x20,0x72,0x30,0x20,0x27,0x68,0x27,0x86,0x16,0x0D,0x63,0x30,0x0A,0x6C,0x61, // v.r0.'h'...c0.la END
+	0x62,0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x80,0x27,0x1F,0x74,0x69,0x6D,0x65, // bel.int32.'.time END
+	0x4E,0x6F,0x48,0x6F,0x75,0x72,0x73,0x0A,0x0A,0x3B,0x20,0x43,0x68,0x65,0x63,0x6B, // NoHours..;.Check END
+	0x20,0x66,0x6F,0x72,0x20,0x6D,0x69,0x6E,0x75,0x74,0x65,0x73,0x85,0x44,0x89,0x2F, // .for.minutes.D./ END
+	0x07,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x42,0x00,0x41,0x83,0x65,0x01, // .ScratchI.B.A.e. END
+	0x31,0x20,0x82,0x0D,0x06,0x43,0x6F,0x6E,0x73,0x74,0x36,0x30,0x83,0x85,0x82,0x62, // 1....Const60...b END
+	0x0B,0x4C,0x65,0x73,0x73,0x54,0x68,0x61,0x6E,0x0A,0x63,0x6D,0x70,0x81,0x8C,0x82, // .LessThan.cmp... END
+	0x02,0x07,0x0A,0x73,0x6B,0x69,0x70,0x65,0x71,0x7A,0x81,0x0A,0x00,0x6A,0x80,0x17, // ...skipeqz...j.. END
+	0x8B,0x8C,0x00,0x4D,0x84,0x79,0x0C,0x3B,0x20,0x59,0x65,0x73,0x20,0x77,0x65,0x20, // ...M.y.;.Yes.we. END
+	0x68,0x61,0x76,0x65,0x85,0x8F,0x18,0x2C,0x20,0x64,0x69,0x76,0x69,0x64,0x65,0x20, // have...,.divide. END
+	0x74,0x6F,0x20,0x66,0x69,0x6E,0x64,0x20,0x68,0x6F,0x77,0x20,0x6D,0x61,0x6E,0x79, // to.find.how.many END
+	0x81,0xED,0x17,0x20,0x72,0x30,0x20,0x69,0x6E,0x74,0x33,0x32,0x70,0x75,0x74,0x74, // ....r0.int32putt END
+	0x69,0x6D,0x65,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x81,0x12,0x07,0x42,0x0A, // imeScratchI...B. END
+	0x6D,0x6F,0x76,0x20,0x72,0x31,0x96,0x20,0x05,0x41,0x0A,0x63,0x61,0x6C,0x6C,0x83, // mov.r1...A.call. END
+	0x3F,0x01,0x73,0x65,0x80,0x44,0x83,0x30,0x98,0x51,0x0B,0x20,0x3B,0x20,0x72,0x65, // ?.se.D.0.Q..;.re END
+	0x73,0x75,0x6C,0x74,0x20,0x77,0x69,0x80,0x39,0x0D,0x62,0x65,0x20,0x73,0x74,0x6F, // sult.wi.9.be.sto END
+	0x72,0x65,0x64,0x20,0x68,0x65,0x72,0x65,0x85,0x6E,0x82,0x7C,0x06,0x43,0x6F,0x6E, // red.here.n.|.Con END
+	0x73,0x74,0x36,0x30,0x83,0x82,0x00,0x32,0x97,0x82,0x80,0x51,0x84,0xB3,0x09,0x41, // st60...2...Q...A END
+	0x20,0x67,0x65,0x74,0x73,0x20,0x74,0x68,0x65,0x80,0x63,0x12,0x6D,0x61,0x69,0x6E, // .gets.the.c.main END
+	0x64,0x65,0x72,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x69,0x73,0x20,0x75,0x73,0x80, // der.which.is.us. END
+	0x65,0x0A,0x69,0x6E,0x20,0x6E,0x65,0x78,0x74,0x20,0x69,0x74,0x65,0x80,0xE6,0x03, // e.in.next.ite... END
+	0x69,0x6F,0x6E,0x0A,0x16,0x63,0x61,0x6C,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x64, // ion..call.int32d END
+	0x69,0x76,0x33,0x32,0x72,0x65,0x6D,0x0A,0x3B,0x20,0x50,0x72,0x80,0x11,0x0E,0x20, // iv32rem.;.Pr.... END
+	0x6D,0x69,0x6E,0x75,0x74,0x65,0x73,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x83,0x24, // minutes.mov.r0.$ END
+	0x0E,0x70,0x75,0x74,0x74,0x69,0x6D,0x65,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49, // .puttimeScratchI END
+	0x81,0x37,0x01,0x42,0x0A,0x87,0x43,0x09,0x67,0x65,0x74,0x4C,0x6F,0x77,0x65,0x72, // .7.B..C.getLower END
+	0x31,0x36,0x83,0x14,0x80,0x2E,0x02,0x64,0x65,0x63,0x85,0x41,0x02,0x27,0x6D,0x27, // 16.....dec.A.'m' END
+	0x86,0x16,0x06,0x63,0x30,0x0A,0x6C,0x61,0x62,0x65,0x84,0x7B,0x84,0x56,0x02,0x4E, // ...c0.labe.{.V.N END
+	0x6F,0x4D,0x84,0x73,0x80,0x84,0x12,0x52,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72, // oM.s...Remainder END
+	0x20,0x69,0x73,0x20,0x73,0x65,0x63,0x6F,0x6E,0x64,0x9E,0x8B,0x00,0x41,0xA7,0x8B, // .is.second...A.. END
+	0x00,0x73,0x83,0x8B,0x21,0x20,0x70,0x75,0x74,0x63,0x30,0x0A,0x72,0x65,0x74,0x0A, // .s..!.putc0.ret. END
+	0x0A,0x3B,0x20,0x69,0x6E,0x74,0x33,0x32,0x74,0x69,0x6D,0x65,0x54,0x6F,0x44,0x61, // .;.int32timeToDa END
+	0x74,0x65,0x28,0x72,0x30,0x3D,0x64,0x80,0x07,0x0F,0x44,0x65,0x73,0x74,0x50,0x74, // te(r0=d...DestPt END
+	0x72,0x2C,0x20,0x72,0x31,0x3D,0x73,0x72,0x63,0x54,0x80,0x20,0x80,0x0E,0x14,0x29, // r,.r1=srcT.....) END
+	0x20,0x2D,0x20,0x64,0x65,0x63,0x6F,0x6D,0x70,0x6F,0x73,0x65,0x20,0x33,0x32,0x20, // .-.decompose.32. END
+	0x62,0x69,0x74,0x20,0x81,0x3C,0x80,0x46,0x01,0x20,0x73,0x80,0x18,0x0E,0x6E,0x64, // bit..<.F..s...nd END
+	0x73,0x20,0x73,0x69,0x6E,0x63,0x65,0x20,0x65,0x70,0x6F,0x63,0x68,0x81,0x5D,0x03, // s.since.epoch.]. END
+	0x6F,0x20,0x61,0x20,0x81,0x51,0x13,0x20,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x77, // o.a..Q..struct.w END
+	0x69,0x74,0x68,0x20,0x79,0x2F,0x6D,0x2F,0x64,0x2F,0x68,0x80,0x05,0x07,0x73,0x2E, // ith.y/m/d/h...s. END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x8D,0x88,0x06,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32, // .label....mov.r2 END
+	0x80,0x7F,0x83,0x09,0x03,0x31,0x20,0x72,0x30,0x83,0x13,0x0A,0x30,0x20,0x53,0x79, // .....1.r0...0.Sy END
+	0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x81,0x96,0x83,0xB7,0x04,0x33,0x32,0x73,0x0A, // scallId.....32s. END
+	0x73,0x83,0x16,0x8A,0xD9,0x81,0xCB,0x06,0x47,0x65,0x74,0x59,0x65,0x61,0x72,0x85, // s.......GetYear. END
+	0xDA,0x2D,0x50,0x74,0x72,0x29,0x20,0x2D,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x73, // .-Ptr).-.returns END
+	0x20,0x79,0x65,0x61,0x72,0x20,0x69,0x6E,0x20,0x72,0x30,0x20,0x66,0x6F,0x72,0x20, // .year.in.r0.for. END
+	0x67,0x69,0x76,0x65,0x6E,0x20,0x64,0x61,0x74,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C, // given.date.label END
+	0x80,0x1A,0x02,0x74,0x33,0x32,0x81,0x0F,0x03,0x47,0x65,0x74,0x59,0x80,0x2B,0x06, // ...t32...GetY.+. END
+	0x0A,0x6C,0x6F,0x61,0x64,0x31,0x36,0x81,0x2F,0x02,0x72,0x30,0x0A,0x80,0x45,0x02, // .load16./.r0..E. END
+	0x0A,0x0A,0x3B,0x8A,0x24,0x08,0x4D,0x6F,0x6E,0x74,0x68,0x28,0x72,0x30,0x3D,0x81, // ..;.$.Month(r0=. END
+	0x44,0x8C,0x6C,0x00,0x6D,0x81,0x1B,0x92,0x6D,0x06,0x20,0x28,0x31,0x2D,0x31,0x32, // D.l.m...m..(1-12 END
+	0x29,0x90,0x74,0x82,0x4F,0x04,0x0A,0x69,0x6E,0x63,0x32,0x81,0x70,0x81,0x7D,0x00, // ).t.O..inc2.p.}. END
+	0x38,0x97,0x7C,0x02,0x44,0x61,0x79,0x94,0x7A,0x02,0x64,0x61,0x79,0x83,0xE6,0x21, // 8.|.Day.z.day..! END
+	0x20,0x66,0x6F,0x72,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x64,0x61,0x74,0x65,0x20, // .for.given.date. END
+	0x28,0x31,0x2D,0x33,0x31,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74, // (1-31).label.int END
+	0x33,0x32,0x81,0x16,0x13,0x47,0x65,0x74,0x44,0x61,0x79,0x0A,0x69,0x6E,0x63,0x33, // 32...GetDay.inc3 END
+	0x20,0x72,0x30,0x0A,0x6C,0x6F,0x61,0x64,0x38,0x80,0x08,0x81,0x0B,0x05,0x72,0x65, // .r0.load8.....re END
+	0x74,0x0A,0x0A,0x3B,0x8A,0x2A,0x07,0x48,0x6F,0x75,0x72,0x28,0x72,0x30,0x3D,0x81, // t..;.*.Hour(r0=. END
+	0x50,0x06,0x50,0x74,0x72,0x29,0x20,0x2D,0x20,0x80,0x25,0x05,0x75,0x72,0x6E,0x73, // P.Ptr).-..%.urns END
+	0x20,0x68,0x80,0x1A,0x80,0x56,0x81,0x3B,0x8D,0x78,0x03,0x30,0x2D,0x32,0x33,0x91, // .h...V.;.x.0-23. END
+	0x78,0x81,0x4D,0x81,0x79,0x00,0x34,0xA0,0x79,0x05,0x4D,0x69,0x6E,0x75,0x74,0x65, // x.M.y.4.y.Minute END
+	0x94,0x7B,0x00,0x6D,0x82,0x1C,0x8C,0x7D,0x18,0x6E,0x20,0x64,0x61,0x74,0x65,0x20, // .{.m...}.n.date. END
+	0x28,0x30,0x2D,0x35,0x39,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74, // (0-59).label.int END
+	0x33,0x32,0x81,0x16,0x16,0x47,0x65,0x74,0x4D,0x69,0x6E,0x75,0x74,0x65,0x0A,0x69, // 32...GetMinute.i END
+	0x6E,0x63,0x35,0x20,0x72,0x30,0x0A,0x6C,0x6F,0x61,0x64,0x38,0x80,0x08,0x81,0x0B, // nc5.r0.load8.... END
+	0x05,0x72,0x65,0x74,0x0A,0x0A,0x3B,0x8A,0x2D,0x09,0x53,0x65,0x63,0x6F,0x6E,0x64, // .ret..;.-.Second END
+	0x28,0x72,0x30,0x3D,0x81,0x55,0x06,0x50,0x74,0x72,0x29,0x20,0x2D,0x20,0x80,0x27, // (r0=.U.Ptr).-..' END
+	0x05,0x75,0x72,0x6E,0x73,0x20,0x73,0x82,0x1C,0x80,0x5D,0x81,0x3F,0x07,0x66,0x6F, // .urns.s...].?.fo END
+	0x72,0x20,0x67,0x69,0x76,0x65,0x9D,0x7F,0x83,0x51,0x81,0x7F,0x00,0x36,0x9D,0x7F, // r.give...Q...6.. END
+	0x01,0x50,0x72,0x80,0xB8,0x89,0x7B,0x8D,0xCE,0x82,0x20,0x80,0xB1,0x82,0x28,0x06, // .Pr...{.......(. END
+	0x20,0x79,0x2F,0x6D,0x2F,0x64,0x0A,0x26,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72, // .y/m/d.&push16.r END
+	0x30,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x64,0x61,0x74,0x65, // 0.call.int32date END
+	0x47,0x65,0x74,0x44,0x61,0x79,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x32,0x83, // GetDay.mov.r1.2. END
+	0x1D,0x08,0x70,0x75,0x74,0x64,0x65,0x63,0x70,0x61,0x64,0x83,0x17,0x04,0x30,0x20, // ..putdecpad...0. END
+	0x27,0x2F,0x27,0x86,0x19,0x05,0x63,0x30,0x0A,0x70,0x6F,0x70,0x83,0x4B,0x98,0x55, // '/'...c0.pop.K.U END
+	0x04,0x4D,0x6F,0x6E,0x74,0x68,0xD0,0x57,0x03,0x59,0x65,0x61,0x72,0x96,0xAE,0x03, // .Month.W.Year... END
+	0x3B,0x20,0x50,0x72,0x80,0xDA,0x05,0x20,0x73,0x70,0x61,0x63,0x65,0x86,0xBC,0x00, // ;.Pr....space... END
+	0x20,0x80,0xBC,0x24,0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x63,0x30,0x0A,0x3B,0x20, // ...$all.putc0.;. END
+	0x50,0x72,0x69,0x6E,0x74,0x20,0x68,0x3A,0x6D,0x3A,0x73,0x0A,0x70,0x6F,0x70,0x31, // Print.h:m:s.pop1 END
+	0x36,0x20,0x72,0x30,0x0A,0x70,0x75,0x73,0x68,0x83,0x09,0x00,0x63,0x81,0x2B,0x80, // 6.r0.push...c.+. END
+	0x21,0x15,0x33,0x32,0x64,0x61,0x74,0x65,0x47,0x65,0x74,0x48,0x6F,0x75,0x72,0x0A, // !.32dateGetHour. END
+	0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x32,0x83,0x1E,0x80,0x4A,0x05,0x64,0x65,0x63, // mov.r1.2...J.dec END
+	0x70,0x61,0x64,0x83,0x17,0x04,0x30,0x20,0x27,0x3A,0x27,0x86,0x19,0x80,0x64,0xA1, // pad...0.':'...d. END
+	0x56,0x05,0x4D,0x69,0x6E,0x75,0x74,0x65,0xB5,0x58,0x8E,0xA5,0x04,0x53,0x65,0x63, // V.Minute.X...Sec END
+	0x6F,0x6E,0x84,0x8F,0x8F,0xA7,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xF7,0x00,0x0F, // on......ret..... END
+	0x01,0x6D,0x03,0x69,0x6E,0x74,0x33,0x32,0x67,0x65,0x74,0x2E,0x73,0x00,0x3B,0x20, // .m.int32get.s.;. END
+	0x85,0x0C,0x19,0x55,0x70,0x70,0x65,0x72,0x31,0x36,0x28,0x73,0x72,0x63,0x3D,0x72, // ...Upper16(src=r END
+	0x30,0x29,0x20,0x2D,0x20,0x70,0x6C,0x61,0x63,0x65,0x73,0x20,0x75,0x81,0x18,0x08, // 0).-.places.u... END
+	0x20,0x68,0x61,0x6C,0x66,0x20,0x6F,0x66,0x20,0x80,0x1E,0x81,0x32,0x03,0x6F,0x20, // .half.of....2.o. END
+	0x72,0x30,0x80,0x22,0x0F,0x6E,0x6F,0x74,0x65,0x3A,0x20,0x61,0x6C,0x73,0x6F,0x20, // r0.".note:.also. END
+	0x65,0x6E,0x73,0x75,0x72,0x80,0x2E,0x03,0x6F,0x6E,0x6C,0x79,0x81,0x1C,0x00,0x69, // ensur...only...i END
+	0x80,0x39,0x04,0x73,0x65,0x64,0x2C,0x20,0x80,0x1B,0x80,0x26,0x08,0x68,0x69,0x6E, // .9.sed,....&.hin END
+	0x67,0x20,0x65,0x6C,0x73,0x65,0x30,0x20,0x6E,0x65,0x65,0x64,0x73,0x20,0x70,0x72, // g.else0.needs.pr END
+	0x6F,0x74,0x65,0x63,0x74,0x69,0x6E,0x67,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69, // otecting.label.i END
+	0x6E,0x74,0x33,0x32,0x67,0x65,0x74,0x55,0x70,0x70,0x65,0x72,0x31,0x36,0x0A,0x6C, // nt32getUpper16.l END
+	0x6F,0x61,0x64,0x31,0x36,0x20,0x72,0x30,0x80,0x02,0x06,0x0A,0x72,0x65,0x74,0x0A, // oad16.r0....ret. END
+	0x0A,0x3B,0x86,0x23,0x02,0x4C,0x6F,0x77,0x81,0x23,0x12,0x28,0x73,0x72,0x63,0x3D, // .;.#.Low.#.(src= END
+	0x72,0x30,0x29,0x20,0x2D,0x20,0x70,0x6C,0x61,0x63,0x65,0x73,0x20,0x6C,0x81,0x18, // r0).-.places.l.. END
+	0x08,0x20,0x68,0x61,0x6C,0x66,0x20,0x6F,0x66,0x20,0x80,0x1E,0x81,0x56,0x00,0x6F, // ..half.of....V.o END
+	0x81,0x44,0x02,0x2D,0x20,0x6E,0x80,0x70,0x0B,0x3A,0x20,0x61,0x6C,0x73,0x6F,0x20, // .D.-.n.p.:.also. END
+	0x65,0x6E,0x73,0x75,0x72,0x80,0x2E,0x03,0x6F,0x6E,0x6C,0x79,0x81,0x61,0x08,0x69, // ensur...only.a.i END
+	0x73,0x20,0x75,0x73,0x65,0x64,0x2C,0x20,0x80,0x1B,0x80,0x26,0x00,0x68,0x80,0x95, // s.used,....&.h.. END
+	0x04,0x20,0x65,0x6C,0x73,0x65,0x9D,0xAB,0x84,0x87,0x04,0x0A,0x69,0x6E,0x63,0x32, // ..else......inc2 END
+	0x81,0xA6,0x8E,0xB3,0x00,0xFF,0x8F,0x00,0x18,0x02,0xB0,0x06,0x69,0x6E,0x74,0x33, // ............int3 END
+	0x32,0x64,0x69,0x76,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E, // 2div.s.require.. END
+	0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x09,0x63,0x61,0x6C,0x6C,0x2E, // ./...sys...call. END
+	0x73,0x0A,0x0A,0x3B,0x20,0x85,0x29,0x22,0x31,0x36,0x28,0x72,0x30,0x3D,0x78,0x2C, // s..;..)"16(r0=x, END
+	0x20,0x72,0x31,0x3D,0x64,0x29,0x20,0x2D,0x20,0x63,0x6F,0x6D,0x70,0x75,0x74,0x65, // .r1=d).-.compute END
+	0x73,0x20,0x78,0x3D,0x78,0x2F,0x64,0x20,0x77,0x68,0x65,0x80,0x44,0x1E,0x78,0x20, // s.x=x/d.whe.D.x. END
+	0x69,0x73,0x20,0x70,0x74,0x72,0x20,0x74,0x6F,0x20,0x33,0x32,0x20,0x62,0x69,0x74, // is.ptr.to.32.bit END
+	0x20,0x76,0x61,0x6C,0x75,0x65,0x2C,0x20,0x61,0x6E,0x64,0x20,0x64,0x81,0x1D,0x01, // .value,.and.d... END
+	0x31,0x36,0x82,0x16,0x80,0x7C,0x03,0x69,0x73,0x6F,0x72,0x80,0x4F,0x04,0x65,0x74, // 16...|.isor.O.et END
+	0x75,0x72,0x6E,0x86,0x17,0x08,0x72,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x80, // urn...remainder. END
+	0x79,0x08,0x20,0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88,0x85,0x06,0x0A,0x6D, // y..r0.label....m END
+	0x6F,0x76,0x20,0x72,0x32,0x80,0x86,0x83,0x09,0x00,0x31,0x81,0x24,0x82,0x13,0x02, // ov.r2.....1.$... END
+	0x30,0x20,0x53,0x83,0xB8,0x02,0x49,0x64,0x49,0x81,0xDE,0x00,0x44,0x82,0x2E,0x84, // 0.S...IdI...D... END
+	0xCC,0x00,0x0A,0x80,0x66,0x85,0xCE,0x12,0x32,0x64,0x69,0x76,0x33,0x32,0x28,0x72, // ....f...2div32(r END
+	0x30,0x3D,0x64,0x65,0x73,0x74,0x2C,0x20,0x72,0x31,0x3D,0x80,0x11,0x07,0x69,0x73, // 0=dest,.r1=...is END
+	0x6F,0x72,0x29,0x20,0x2D,0x20,0x81,0x0A,0x1A,0x64,0x65,0x20,0x33,0x32,0x20,0x62, // or).-....de.32.b END
+	0x69,0x74,0x20,0x71,0x75,0x61,0x6E,0x74,0x69,0x74,0x79,0x20,0x61,0x74,0x20,0x72, // it.quantity.at.r END
+	0x30,0x20,0x62,0x79,0x85,0x18,0x84,0x31,0x82,0x17,0x0B,0x31,0x0A,0x6C,0x61,0x62, // 0.by...1...1.lab END
+	0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x83,0x5C,0x0E,0x0A,0x3B,0x20,0x55,0x73,0x65, // el.int3.\..;.Use END
+	0x20,0x73,0x74,0x61,0x63,0x6B,0x20,0x74,0x6F,0x80,0x08,0x1A,0x6F,0x72,0x65,0x20, // .stack.to...ore. END
+	0x72,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x20,0x77,0x68,0x69,0x63,0x68,0x20, // remainder.which. END
+	0x77,0x65,0x20,0x74,0x68,0x65,0x6E,0x80,0x72,0x13,0x73,0x63,0x61,0x72,0x64,0x0A, // we.then.r.scard. END
+	0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x72,0x36,0x0A,0x69,0x6E,0x63,0x34,0x81,0x07, // mov.r2.r6.inc4.. END
+	0x02,0x63,0x61,0x6C,0x89,0x56,0x80,0x40,0x02,0x0A,0x64,0x65,0x83,0x1A,0x03,0x72, // .cal.V.@..de...r END
+	0x65,0x74,0x0A,0x80,0x66,0x8A,0x1C,0x91,0xD3,0x80,0xDF,0x01,0x32,0x3D,0x86,0x79, // et..f.......2=.y END
+	0x81,0xE1,0x1E,0x64,0x69,0x76,0x69,0x64,0x65,0x20,0x33,0x32,0x20,0x62,0x69,0x74, // ...divide.32.bit END
+	0x20,0x71,0x75,0x61,0x6E,0x74,0x69,0x74,0x79,0x20,0x61,0x74,0x20,0x72,0x30,0x20, // .quantity.at.r0. END
+	0x62,0x79,0x85,0x18,0x81,0x26,0x02,0x73,0x6F,0x72,0x82,0x17,0x28,0x31,0x2C,0x20, // by...&.sor..(1,. END
+	0x73,0x65,0x74,0x74,0x69,0x6E,0x67,0x20,0x72,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65, // setting.remainde END
+	0x72,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73, // r.in.the.process END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x80,0x14,0x02,0x74,0x33,0x32,0x80,0x61,0x01,0x33, // .label...t32.a.3 END
+	0x32,0x80,0x28,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x72,0x32,0x83,0x09, // 2.(..mov.r3.r2.. END
+	0x00,0x32,0x80,0x49,0x83,0x13,0x00,0x31,0x80,0x6B,0x83,0x1D,0x0B,0x30,0x20,0x53, // .2.I...1.k...0.S END
+	0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x49,0x81,0x3B,0x00,0x44,0x81,0x3B,0x01, // yscallIdI.;.D.;. END
+	0x0A,0x73,0x83,0x13,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xCC,0x00,0x1F,0x04,0xE3, // .s....ret....... END
+	0x0A,0x69,0x6E,0x74,0x33,0x32,0x66,0x70,0x75,0x74,0x2E,0x73,0x00,0x72,0x65,0x71, // .int32fput.s.req END
+	0x75,0x69,0x72,0x65,0x65,0x6E,0x64,0x20,0x2E,0x2E,0x2F,0x69,0x6F,0x2F,0x83,0x17, // uireend.../io/.. END
+	0x00,0x0A,0x92,0x17,0x02,0x64,0x65,0x63,0x80,0x1A,0x89,0x1B,0x82,0x4A,0x01,0x67, // .....dec.....J.g END
+	0x65,0x8C,0x31,0x82,0x60,0x02,0x73,0x74,0x72,0x81,0x2C,0x00,0x3B,0x83,0x23,0x80, // e.1.`.str.,.;.#. END
+	0x6D,0x09,0x30,0x28,0x78,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x81,0x73,0x08,0x76, // m.0(x=r0).-..s.v END
+	0x61,0x6C,0x65,0x6E,0x74,0x20,0x74,0x6F,0x83,0x43,0x81,0x8E,0x80,0x20,0x29,0x2C, // alent.to.C....), END
+	0x20,0x73,0x74,0x64,0x6F,0x75,0x74,0x29,0x2C,0x20,0x72,0x65,0x74,0x75,0x72,0x6E, // .stdout),.return END
+	0x73,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x79,0x74,0x65, // s.number.of.byte END
+	0x73,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6E,0x80,0x7A,0x08,0x20,0x72,0x30,0x0A, // s.written.z..r0. END
+	0x6C,0x61,0x62,0x65,0x6C,0x87,0x62,0x80,0x6E,0x03,0x4A,0x75,0x6D,0x70,0x81,0x97, // label.b.n.Jump.. END
+	0x01,0x6F,0x20,0x82,0x53,0x07,0x20,0x76,0x65,0x72,0x73,0x69,0x6F,0x6E,0x81,0x69, // .o..S..version.i END
+	0x03,0x64,0x6F,0x20,0x72,0x39,0x65,0x73,0x74,0x20,0x6F,0x66,0x20,0x74,0x68,0x65, // .do.r9est.of.the END
+	0x20,0x77,0x6F,0x72,0x6B,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x46,0x64,0x53, // .work.mov.r1.FdS END
+	0x74,0x64,0x6F,0x75,0x74,0x20,0x3B,0x20,0x73,0x65,0x74,0x20,0x66,0x64,0x0A,0x6A, // tdout.;.set.fd.j END
+	0x6D,0x70,0x20,0x69,0x6E,0x74,0x33,0x32,0x66,0x70,0x75,0x74,0x30,0x0A,0x0A,0x3B, // mp.int32fput0..; END
+	0x88,0x0D,0x05,0x28,0x78,0x3D,0x72,0x30,0x2C,0x80,0x25,0x13,0x3D,0x72,0x31,0x29, // ...(x=r0,.%.=r1) END
+	0x20,0x2D,0x20,0x65,0x71,0x75,0x69,0x76,0x61,0x6C,0x65,0x6E,0x74,0x20,0x74,0x6F, // .-.equivalent.to END
+	0x87,0x35,0x01,0x28,0x78,0x81,0x23,0x13,0x2C,0x20,0x30,0x29,0x2C,0x20,0x72,0x65, // .5.(x.#.,.0),.re END
+	0x74,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72,0x81,0x82,0x0C,0x62, // turns.number...b END
+	0x79,0x74,0x65,0x73,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6E,0x80,0x6A,0x08,0x20, // ytes.written.j.. END
+	0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x89,0x76,0x82,0x9E,0x02,0x32,0x20,0x30, // r0.label.v...2.0 END
+	0x8B,0x8E,0x8A,0x8D,0x89,0x8C,0x00,0x2C,0x80,0xDB,0x00,0x66,0x80,0xC0,0x02,0x3D, // .......,...f...= END
+	0x72,0x32,0x81,0x97,0x81,0x5C,0x08,0x65,0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x20, // r2...\.e.32.bit. END
+	0x80,0xA0,0x02,0x75,0x65,0x20,0x0F,0x70,0x6F,0x69,0x6E,0x74,0x65,0x64,0x20,0x74, // ...ue..pointed.t END
+	0x6F,0x20,0x62,0x79,0x20,0x78,0x20,0x80,0x0D,0x0C,0x6F,0x20,0x67,0x69,0x76,0x65, // o.by.x....o.give END
+	0x6E,0x20,0x66,0x64,0x20,0x61,0x74,0x84,0x0B,0x15,0x6F,0x66,0x66,0x73,0x65,0x74, // n.fd.at...offset END
+	0x2C,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72, // ,.returns.number END
+	0x80,0x16,0x80,0x35,0x08,0x74,0x65,0x73,0x20,0x77,0x72,0x69,0x74,0x74,0x80,0x33, // ...5.tes.writt.3 END
+	0x0A,0x69,0x6E,0x20,0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x81,0x4A,0x22,0x33, // .in.r0.label.J"3 END
+	0x32,0x66,0x70,0x75,0x74,0x0A,0x3B,0x20,0x52,0x65,0x73,0x65,0x72,0x76,0x65,0x20, // 2fput.;.Reserve. END
+	0x73,0x70,0x61,0x63,0x65,0x20,0x6F,0x6E,0x20,0x73,0x74,0x61,0x63,0x6B,0x20,0x66, // space.on.stack.f END
+	0x6F,0x72,0x80,0x09,0x0F,0x72,0x69,0x6E,0x67,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33, // or...ring.mov.r3 END
+	0x20,0x72,0x36,0x20,0x3B,0x81,0x07,0x05,0x63,0x6F,0x6E,0x74,0x61,0x69,0x80,0x69, // .r6.;...contai.i END
+	0x02,0x70,0x74,0x72,0x81,0x9C,0x08,0x74,0x65,0x6D,0x70,0x6F,0x72,0x61,0x72,0x79, // .ptr...temporary END
+	0x81,0x2F,0x83,0x2C,0x00,0x34,0x83,0x61,0x0F,0x74,0x6F,0x53,0x74,0x72,0x42,0x75, // ./.,.4.a.toStrBu END
+	0x66,0x53,0x69,0x7A,0x65,0x0A,0x61,0x64,0x64,0x81,0x42,0x81,0x02,0x00,0x34,0x80, // fSize.add.B...4. END
+	0x76,0x06,0x43,0x6F,0x6E,0x76,0x65,0x72,0x74,0x80,0xD7,0x80,0xDF,0x84,0x68,0x07, // v.Convert.....h. END
+	0x70,0x75,0x73,0x68,0x38,0x20,0x72,0x31,0x82,0x08,0x00,0x31,0x09,0x36,0x20,0x72, // push8.r1...1.6.r END
+	0x32,0x0A,0x70,0x75,0x73,0x68,0x31,0x80,0x09,0x0A,0x33,0x0A,0x6D,0x6F,0x76,0x20, // 2.push1...3.mov. END
+	0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x00,0x30,0x81,0x13,0x29,0x63,0x61,0x6C,0x6C, // r1.r0...0..)call END
+	0x20,0x69,0x6E,0x74,0x33,0x32,0x74,0x6F,0x53,0x74,0x72,0x0A,0x3B,0x20,0x57,0x72, // .int32toStr.;.Wr END
+	0x69,0x74,0x65,0x20,0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x74,0x6F,0x20,0x66,0x69, // ite.string.to.fi END
+	0x6C,0x65,0x0A,0x70,0x6F,0x70,0x81,0x43,0x80,0x4D,0x83,0x08,0x00,0x31,0x81,0x11, // le.pop.C.M...1.. END
+	0x00,0x38,0x81,0x4A,0x82,0x40,0x04,0x66,0x70,0x75,0x74,0x73,0x80,0x3B,0x05,0x52, // .8.J.@.fputs.;.R END
+	0x65,0x73,0x74,0x6F,0x72,0x81,0x3D,0x02,0x61,0x63,0x6B,0x83,0x6F,0x00,0x34,0x88, // estor.=.ack.o.4. END
+	0x5D,0x0C,0x42,0x75,0x66,0x53,0x69,0x7A,0x65,0x0A,0x73,0x75,0x62,0x20,0x72,0x80, // ].BufSize.sub.r. END
+	0x9C,0x80,0x9F,0x05,0x34,0x0A,0x72,0x65,0x74,0x0A,0x80,0x76,0x82,0x83,0x0E,0x64, // ....4.ret..v...d END
+	0x65,0x62,0x75,0x67,0x28,0x78,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x70,0x80,0x82, // ebug(x=r0).-.p.. END
+	0x08,0x74,0x73,0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x81,0xA4,0x06,0x65,0x67,0x65, // .ts.32.bit...ege END
+	0x72,0x20,0x70,0x6F,0x81,0x09,0x00,0x64,0x81,0x9A,0x03,0x62,0x79,0x20,0x78,0x80, // r.po...d...by.x. END
+	0xBC,0x18,0x20,0x74,0x68,0x65,0x20,0x66,0x6F,0x72,0x6D,0x3A,0x20,0x22,0x7B,0x75, // ...the.form:."{u END
+	0x70,0x70,0x65,0x72,0x2C,0x6C,0x6F,0x77,0x65,0x72,0x7D,0x14,0x22,0x2C,0x20,0x77, // pper,lower}.",.w END
+	0x69,0x74,0x68,0x20,0x75,0x70,0x70,0x65,0x72,0x20,0x61,0x6E,0x64,0x20,0x6C,0x6F, // ith.upper.and.lo END
+	0x77,0x80,0x09,0x10,0x69,0x6E,0x20,0x64,0x65,0x63,0x69,0x6D,0x61,0x6C,0x2E,0x0A, // w...in.decimal.. END
+	0x6C,0x61,0x62,0x65,0x6C,0x80,0x11,0x15,0x74,0x33,0x32,0x64,0x65,0x62,0x75,0x67, // label...t32debug END
+	0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x0A,0x6D,0x6F,0x76,0x80,0x06, // .push16.r0.mov.. END
+	0x12,0x20,0x27,0x7B,0x27,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x63,0x30, // ..'{'.call.putc0 END
+	0x0A,0x70,0x6F,0x70,0x83,0x1E,0x87,0x28,0x82,0x1D,0x82,0x42,0x03,0x67,0x65,0x74, // .pop...(...B.get END
+	0x55,0x81,0x6C,0x01,0x31,0x36,0x86,0x32,0x80,0x69,0x86,0x49,0x00,0x2C,0x93,0x49, // U.l.16.2.i.I.,.I END
+	0x8A,0x3F,0x00,0x4C,0x81,0xA2,0x94,0x3F,0x00,0x7D,0x8A,0x89,0x04,0x72,0x65,0x74, // .?.L...?.}...ret END
+	0x0A,0xFF,0x99,0x00,0x2F,0x02,0x1E,0x05,0x69,0x6E,0x74,0x33,0x32,0x63,0x6F,0x6D, // ..../...int32com END
+	0x6D,0x6F,0x6E,0x2E,0x73,0x00,0x3B,0x20,0x56,0x61,0x72,0x69,0x6F,0x75,0x73,0x20, // mon.s.;.Various. END
+	0x75,0x73,0x65,0x66,0x75,0x6C,0x20,0x63,0x6F,0x6E,0x73,0x74,0x61,0x6E,0x74,0x73, // useful.constants END
+	0x0A,0x64,0x77,0x20,0x49,0x81,0x2B,0x00,0x43,0x81,0x11,0x04,0x30,0x20,0x30,0x2C, // .dw.I.+.C...0.0, END
+	0x30,0x8B,0x12,0x00,0x31,0x80,0x12,0x11,0x31,0x0A,0x0A,0x3B,0x20,0x50,0x6F,0x77, // 0...1...1..;.Pow END
+	0x65,0x72,0x73,0x20,0x6F,0x66,0x20,0x74,0x65,0x6E,0x8C,0x23,0x00,0x45,0x82,0x25, // ers.of.ten.#.E.% END
+	0x8D,0x39,0x01,0x45,0x32,0x82,0x15,0x8E,0x16,0x00,0x33,0x83,0x16,0x07,0x30,0x20, // .9.E2.....3...0. END
+	0x3B,0x20,0x31,0x30,0x5E,0x33,0x8D,0x4B,0x00,0x34,0x84,0x1E,0x8E,0x4E,0x08,0x35, // ;.10^3.K.4...N.5 END
+	0x20,0x31,0x2C,0x33,0x34,0x34,0x36,0x34,0x8D,0x7D,0x08,0x36,0x20,0x31,0x35,0x2C, // .1,34464.}.6.15, END
+	0x31,0x36,0x39,0x36,0x84,0x52,0x1B,0x36,0x0A,0x64,0x77,0x20,0x49,0x6E,0x74,0x33, // 1696.R.6.dw.Int3 END
+	0x32,0x43,0x6F,0x6E,0x73,0x74,0x31,0x45,0x37,0x20,0x31,0x35,0x32,0x2C,0x33,0x38, // 2Const1E7.152,38 END
+	0x35,0x32,0x38,0x8D,0x1A,0x00,0x38,0x81,0x1A,0x06,0x35,0x2C,0x35,0x37,0x36,0x30, // 528...8...5,5760 END
+	0x30,0x8D,0x36,0x00,0x39,0x82,0x1B,0x1C,0x38,0x2C,0x35,0x31,0x37,0x31,0x32,0x20, // 0.6.9...8,51712. END
+	0x3B,0x20,0x31,0x30,0x5E,0x39,0x0A,0x0A,0x3B,0x20,0x54,0x69,0x6D,0x65,0x20,0x76, // ;.10^9..;.Time.v END
+	0x61,0x6C,0x75,0x65,0x73,0x8B,0x69,0x04,0x36,0x30,0x20,0x30,0x2C,0x80,0x04,0x13, // alues.i.60.0,... END
+	0x3B,0x20,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x20,0x70,0x65,0x72,0x20,0x6D,0x69, // ;.seconds.per.mi END
+	0x6E,0x75,0x74,0x65,0x8B,0x93,0x00,0x33,0x80,0x6E,0x80,0x2B,0x82,0x06,0x8B,0x2D, // nute...3.n.+...- END
+	0x03,0x68,0x6F,0x75,0x72,0x8B,0xBF,0x02,0x38,0x36,0x34,0x80,0x2C,0x03,0x31,0x2C, // .hour...864.,.1, END
+	0x32,0x30,0x80,0x09,0x8C,0x5B,0x02,0x64,0x61,0x79,0x81,0x91,0x03,0x4F,0x74,0x68, // 20...[.day...Oth END
+	0x65,0x87,0x35,0x1E,0x43,0x6F,0x6E,0x73,0x74,0x32,0x45,0x39,0x20,0x33,0x30,0x35, // e.5.Const2E9.305 END
+	0x31,0x37,0x2C,0x33,0x37,0x38,0x38,0x38,0x20,0x3B,0x20,0x32,0x2A,0x31,0x30,0x5E, // 17,37888.;.2*10^ END
+	0x39,0x0A,0xFF,0xDE,0x00,0x0F,0x00,0xDB,0x02,0x69,0x6E,0x74,0x33,0x32,0x73,0x75, // 9........int32su END
+	0x62,0x2E,0x73,0x00,0x3B,0x20,0x85,0x0C,0x18,0x31,0x36,0x28,0x64,0x65,0x73,0x74, // b.s.;....16(dest END
+	0x3D,0x72,0x30,0x2C,0x20,0x6F,0x70,0x41,0x3D,0x72,0x31,0x29,0x0A,0x6C,0x61,0x62, // =r0,.opA=r1).lab END
+	0x65,0x6C,0x88,0x21,0x00,0x0A,0x80,0x34,0x0E,0x33,0x32,0x77,0x20,0x72,0x30,0x20, // el.!...4.32w.r0. END
+	0x72,0x31,0x0A,0x72,0x65,0x74,0x0A,0x0A,0x87,0x40,0x01,0x33,0x32,0x8E,0x40,0x0B, // r1.ret...@.32.@. END
+	0x20,0x2D,0x20,0x70,0x65,0x72,0x66,0x6F,0x72,0x6D,0x73,0x20,0x82,0x5C,0x80,0x61, // .-.performs..\.a END
+	0x1A,0x74,0x2D,0x6F,0x70,0x41,0x2C,0x20,0x77,0x68,0x65,0x72,0x65,0x20,0x62,0x6F, // .t-opA,.where.bo END
+	0x74,0x68,0x20,0x61,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x73,0x80,0x09,0x21,0x65, // th.arguments..!e END
+	0x20,0x70,0x6F,0x69,0x6E,0x74,0x65,0x72,0x73,0x20,0x74,0x6F,0x20,0x33,0x32,0x20, // .pointers.to.32. END
+	0x62,0x69,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x0A,0x6C,0x61,0x62,0x65,0x6C, // bit.values.label END
+	0x20,0x80,0x1D,0x07,0x33,0x32,0x73,0x75,0x62,0x33,0x32,0x0A,0x82,0x05,0x0B,0x20, // ....32sub32..... END
+	0x72,0x30,0x20,0x72,0x31,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xA1,0x00,0x02,0x01,0x4C, // r0.r1.ret......L END
+	0x03,0x82,0x42,0x11,0x65,0x6E,0x64,0x69,0x61,0x6E,0x6E,0x65,0x73,0x73,0x2E,0x73, // ..B.endianness.s END
+	0x00,0x72,0x65,0x71,0x75,0x69,0x80,0x8F,0x82,0x5C,0x0A,0x63,0x6F,0x6D,0x6D,0x6F, // .requi...\.commo END
+	0x6E,0x2E,0x73,0x0A,0x0A,0x3B,0x83,0x6D,0x04,0x53,0x77,0x61,0x70,0x45,0x86,0x2E, // n.s..;.m.SwapE.. END
+	0x09,0x28,0x78,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x73,0x80,0x16,0x12,0x20,0x6F, // .(x=r0).-.s....o END
+	0x72,0x64,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x28,0x73, // rder.of.bytes.(s END
+	0x6F,0x83,0x17,0x83,0x0E,0x07,0x30,0x20,0x61,0x6E,0x64,0x20,0x33,0x2C,0x82,0x06, // o.....0.and.3,.. END
+	0x83,0x17,0x29,0x79,0x74,0x65,0x73,0x20,0x31,0x20,0x61,0x6E,0x64,0x20,0x32,0x29, // ..)ytes.1.and.2) END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x53,0x77,0x61,0x70, // .label.int32Swap END
+	0x45,0x6E,0x64,0x69,0x61,0x6E,0x6E,0x65,0x73,0x73,0x0A,0x3B,0x20,0x81,0x10,0x01, // Endianness.;.... END
+	0x20,0x62,0x82,0x2F,0x00,0x30,0x82,0x2F,0x0C,0x33,0x0A,0x6C,0x6F,0x61,0x64,0x38, // .b./.0./.3.load8 END
+	0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x0B,0x03,0x64,0x20,0x72,0x32,0x80,0x0C,0x80, // .r1.r0...d.r2... END
+	0x1A,0x04,0x73,0x74,0x6F,0x72,0x65,0x81,0x0F,0x00,0x30,0x81,0x1F,0x85,0x0F,0x82, // ..store...0..... END
+	0x0E,0x00,0x32,0x8B,0x4C,0x84,0x7C,0x86,0x40,0x81,0x4D,0x01,0x20,0x31,0x8B,0x4F, // ..2.L.|.@.M..1.O END
+	0x00,0x32,0x8C,0x4F,0x8B,0x0F,0x00,0x32,0x80,0x2E,0x04,0x72,0x65,0x74,0x0A,0xFF, // .2.O...2...ret.. END
+	0xB0,0x00,0x15,0x01,0xF4,0x04,0x69,0x6E,0x74,0x33,0x32,0x6D,0x6F,0x64,0x2E,0x73, // ......int32mod.s END
+	0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x82,0x12,0x0A,0x63,0x6F,0x6D,0x6D, // .require....comm END
+	0x6F,0x6E,0x2E,0x73,0x0A,0x0A,0x3B,0x83,0x10,0x80,0x23,0x27,0x33,0x32,0x28,0x78, // on.s..;...#'32(x END
+	0x3D,0x72,0x30,0x2C,0x20,0x79,0x3D,0x72,0x31,0x29,0x20,0x2D,0x20,0x73,0x74,0x6F, // =r0,.y=r1).-.sto END
+	0x72,0x65,0x73,0x20,0x72,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x20,0x6F,0x66, // res.remainder.of END
+	0x20,0x78,0x2F,0x79,0x81,0x41,0x14,0x6F,0x20,0x78,0x20,0x28,0x62,0x6F,0x74,0x68, // .x/y.A.o.x.(both END
+	0x20,0x6F,0x70,0x65,0x72,0x61,0x6E,0x64,0x73,0x20,0x70,0x6F,0x80,0x6C,0x03,0x65, // .operands.po.l.e END
+	0x72,0x73,0x20,0x80,0x1C,0x13,0x33,0x32,0x20,0x62,0x69,0x74,0x20,0x76,0x61,0x6C, // rs....32.bit.val END
+	0x75,0x65,0x73,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88,0x67,0x80,0x74,0x07,0x57, // ues).label.g.t.W END
+	0x65,0x20,0x63,0x6F,0x75,0x6C,0x64,0x80,0x05,0x0C,0x6D,0x70,0x75,0x74,0x65,0x20, // e.could...mpute. END
+	0x76,0x69,0x61,0x20,0x78,0x2D,0x28,0x80,0x5F,0x07,0x29,0x2A,0x78,0x2C,0x20,0x62, // via.x-(._.)*x,.b END
+	0x75,0x74,0x80,0xA9,0x17,0x73,0x74,0x65,0x61,0x64,0x20,0x75,0x73,0x65,0x20,0x64, // ut...stead.use.d END
+	0x69,0x76,0x69,0x73,0x69,0x6F,0x6E,0x20,0x66,0x75,0x6E,0x63,0x74,0x81,0x08,0x09, // ivision.funct... END
+	0x77,0x68,0x69,0x63,0x68,0x20,0x61,0x6C,0x73,0x6F,0x80,0xA1,0x03,0x74,0x75,0x72, // which.also...tur END
+	0x6E,0x88,0xA9,0x80,0xD5,0x02,0x52,0x65,0x73,0x2F,0x65,0x72,0x76,0x65,0x20,0x73, // n.....Res/erve.s END
+	0x70,0x61,0x63,0x65,0x20,0x6F,0x6E,0x20,0x73,0x74,0x61,0x63,0x6B,0x20,0x66,0x6F, // pace.on.stack.fo END
+	0x72,0x20,0x72,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x0A,0x6D,0x6F,0x76,0x20, // r.remainder.mov. END
+	0x72,0x32,0x20,0x72,0x36,0x0A,0x69,0x6E,0x63,0x34,0x81,0x07,0x10,0x3B,0x20,0x43, // r2.r6.inc4...;.C END
+	0x61,0x6C,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x64,0x69,0x76,0x33,0x32,0x80,0x2C, // all.int32div32., END
+	0x11,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x64,0x6F,0x65,0x73,0x20,0x78,0x3D,0x78, // ..which.does.x=x END
+	0x2F,0x79,0x2C,0x80,0x4C,0x04,0x6F,0x72,0x69,0x6E,0x67,0x87,0x4A,0x80,0x61,0x01, // /y,.L.oring.J.a. END
+	0x74,0x6F,0x83,0x63,0x0B,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x0A, // to.c..push16.r0. END
+	0x63,0x8E,0x4B,0x03,0x0A,0x70,0x6F,0x70,0x83,0x1B,0x80,0x69,0x02,0x6F,0x70,0x79, // c.K..pop...i.opy END
+	0x88,0x41,0x80,0x73,0x02,0x6F,0x20,0x78,0x83,0x93,0x00,0x31,0x81,0x93,0x01,0x64, // .A.s.o.x...1...d END
+	0x65,0x81,0x93,0x00,0x31,0x88,0x45,0x01,0x73,0x65,0x80,0x96,0x80,0xA3,0x01,0x52, // e...1.E.se.....R END
+	0x65,0x81,0x80,0x80,0xDC,0x82,0x6F,0x83,0x27,0x06,0x36,0x0A,0x72,0x65,0x74,0x0A, // e.....o.'.6.ret. END
+	0xFF,0x88,0x00,0x15,0x09,0x02,0x13,0x69,0x6E,0x74,0x33,0x32,0x6D,0x65,0x6D,0x2E, // .......int32mem. END
+	0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x82,0x12,0x09,0x63,0x6F,0x6D, // s.require....com END
+	0x6D,0x6F,0x6E,0x2E,0x73,0x0A,0x0A,0x84,0x16,0x02,0x65,0x6E,0x64,0x84,0x19,0x01, // mon.s.....end... END
+	0x6D,0x70,0x80,0x16,0x8D,0x15,0x02,0x64,0x69,0x76,0x90,0x15,0x02,0x6D,0x75,0x6C, // mp.....div...mul END
+	0x90,0x2B,0x03,0x66,0x70,0x75,0x74,0x81,0x59,0x01,0x64,0x77,0x83,0x6B,0x04,0x4D, // .+.fput.Y.dw.k.M END
+	0x65,0x6D,0x50,0x72,0x80,0x88,0x10,0x42,0x79,0x74,0x65,0x73,0x50,0x65,0x72,0x4B, // emPr...BytesPerK END
+	0x62,0x20,0x30,0x2C,0x31,0x30,0x32,0x34,0x96,0x21,0x06,0x4D,0x62,0x20,0x31,0x36, // b.0,1024.!.Mb.16 END
+	0x2C,0x30,0x96,0x41,0x00,0x47,0x81,0x1F,0x02,0x33,0x38,0x34,0x80,0x22,0x02,0x0A, // ,0.A.G...384.".. END
+	0x64,0x62,0x90,0x65,0x05,0x53,0x74,0x72,0x20,0x27,0x62,0x10,0x27,0x2C,0x30,0x0A, // db.e.Str.'b.',0. END
+	0x64,0x62,0x20,0x69,0x6E,0x74,0x33,0x32,0x4D,0x65,0x6D,0x50,0x72,0x80,0x09,0x08, // db.int32MemPr... END
+	0x4B,0x62,0x53,0x74,0x72,0x20,0x27,0x6B,0x62,0x91,0x1C,0x00,0x4D,0x83,0x1C,0x00, // KbStr.'kb...M... END
+	0x6D,0x92,0x1C,0x00,0x47,0x83,0x39,0x00,0x67,0x82,0x39,0x02,0x0A,0x61,0x77,0x8B, // m...G.9.g.9..aw. END
+	0x57,0x0D,0x52,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x20,0x32,0x0A,0x0A,0x3B, // W.Remainder.2..; END
+	0x8B,0x73,0x09,0x28,0x78,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x70,0x81,0x81,0x2C, // .s.(x=r0).-.p.., END
+	0x73,0x20,0x78,0x20,0x61,0x73,0x20,0x68,0x75,0x6D,0x61,0x6E,0x20,0x72,0x65,0x61, // s.x.as.human.rea END
+	0x64,0x61,0x62,0x6C,0x65,0x20,0x6D,0x65,0x6D,0x6F,0x72,0x79,0x20,0x73,0x69,0x7A, // dable.memory.siz END
+	0x65,0x20,0x65,0x2E,0x67,0x2E,0x20,0x78,0x3D,0x32,0x30,0x34,0x38,0x80,0x32,0x0A, // e.e.g..x=2048.2. END
+	0x6F,0x64,0x75,0x63,0x65,0x73,0x20,0x27,0x32,0x2E,0x30,0x80,0xB5,0x80,0x5B,0x10, // oduces.'2.0...[. END
+	0x4E,0x6F,0x74,0x65,0x3A,0x20,0x74,0x68,0x69,0x73,0x20,0x6D,0x6F,0x64,0x69,0x66, // Note:.this.modif END
+	0x69,0x80,0x1D,0x14,0x74,0x68,0x65,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x70,0x61, // i...the.value.pa END
+	0x73,0x73,0x65,0x64,0x20,0x74,0x6F,0x20,0x69,0x11,0x74,0x0A,0x6C,0x61,0x62,0x65, // ssed.to.i.t.labe END
+	0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x4D,0x65,0x6D,0x50,0x72,0x80,0x09,0x0A,0x20, // l.int32MemPr.... END
+	0x3B,0x20,0x74,0x61,0x6B,0x65,0x73,0x20,0x70,0x6F,0x80,0x17,0x11,0x65,0x72,0x20, // ;.takes.po...er. END
+	0x74,0x6F,0x20,0x33,0x32,0x20,0x62,0x69,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x80, // to.32.bit.value. END
+	0x2D,0x0F,0x20,0x72,0x30,0x2C,0x20,0x67,0x69,0x76,0x69,0x6E,0x67,0x20,0x6E,0x75, // -..r0,.giving.nu END
+	0x6D,0x62,0x80,0x24,0x20,0x6F,0x66,0x20,0x62,0x79,0x74,0x65,0x73,0x0A,0x3B,0x20, // mb.$.of.bytes.;. END
+	0x43,0x68,0x65,0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x3E,0x3D,0x31,0x67,0x62,0x0A, // Check.for.>=1gb. END
+	0x70,0x75,0x73,0x68,0x31,0x36,0x80,0x33,0x06,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31, // push16.3..mov.r1 END
+	0x8B,0x6E,0x00,0x42,0x81,0x35,0x08,0x50,0x65,0x72,0x47,0x62,0x0A,0x63,0x61,0x6C, // .n.B.5.PerGb.cal END
+	0x84,0x8B,0x07,0x4C,0x65,0x73,0x73,0x54,0x68,0x61,0x6E,0x85,0x31,0x80,0x3B,0x02, // ...LessThan.1.;. END
+	0x70,0x6F,0x70,0x83,0x44,0x02,0x63,0x6D,0x70,0x82,0x12,0x81,0x02,0x08,0x0A,0x73, // pop.D.cmp......s END
+	0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x81,0x0B,0x00,0x6A,0x80,0x18,0x8A,0xC9,0x80, // kipneqz...j..... END
+	0x52,0x8C,0x8D,0x00,0x6D,0x8B,0x8D,0x0E,0x76,0x20,0x72,0x31,0x20,0x69,0x6E,0x74, // R...m...v.r1.int END
+	0x33,0x32,0x4D,0x65,0x6D,0x50,0x72,0x80,0x09,0x0E,0x42,0x79,0x74,0x65,0x73,0x50, // 32MemPr...BytesP END
+	0x65,0x72,0x4D,0x62,0x0A,0x63,0x61,0x6C,0x6C,0x83,0x1C,0x0A,0x4C,0x65,0x73,0x73, // erMb.call...Less END
+	0x54,0x68,0x61,0x6E,0x0A,0x6D,0x6F,0x82,0x31,0x07,0x72,0x30,0x0A,0x70,0x6F,0x70, // Than.mo.1.r0.pop END
+	0x31,0x36,0x81,0x08,0x02,0x63,0x6D,0x70,0x82,0x12,0x81,0x02,0x08,0x0A,0x73,0x6B, // 16...cmp......sk END
+	0x69,0x70,0x6E,0x65,0x71,0x7A,0x81,0x0B,0x00,0x6A,0x80,0x18,0x8A,0x5A,0x80,0x52, // ipneqz...j...Z.R END
+	0x15,0x3B,0x20,0x43,0x68,0x65,0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x3E,0x3D,0x31, // .;.Check.for.>=1 END
+	0x6B,0x62,0x0A,0x70,0x75,0x73,0x68,0x83,0x48,0x84,0x5B,0x92,0x8D,0x00,0x4B,0xCF, // kb.push.H.[...K. END
+	0x8D,0x80,0x52,0x01,0x3B,0x20,0x31,0x4F,0x74,0x68,0x65,0x72,0x77,0x69,0x73,0x65, // ..R.;.1Otherwise END
+	0x20,0x73,0x69,0x6D,0x70,0x6C,0x79,0x20,0x3C,0x31,0x30,0x32,0x34,0x20,0x62,0x79, // .simply.<1024.by END
+	0x74,0x65,0x73,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x69,0x6E,0x74,0x33,0x32,0x70,0x75, // tes.call.int32pu END
+	0x74,0x30,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x83,0x10,0x04,0x4D,0x65,0x6D,0x50, // t0.mov.r0...MemP END
+	0x72,0x80,0x1A,0x00,0x42,0x81,0x28,0x02,0x53,0x74,0x72,0x83,0x2B,0x80,0x26,0x14, // r...B.(.Str.+.&. END
+	0x73,0x30,0x0A,0x72,0x65,0x74,0x0A,0x3B,0x20,0x47,0x62,0x20,0x63,0x61,0x73,0x65, // s0.ret.;.Gb.case END
+	0x0A,0x6C,0x61,0x62,0x65,0x84,0x45,0x85,0x34,0x08,0x47,0x62,0x0A,0x70,0x75,0x73, // .labe.E.4.Gb.pus END
+	0x68,0x31,0x36,0x80,0x4E,0x83,0x55,0x00,0x31,0x90,0x55,0x02,0x50,0x65,0x72,0x80, // h16.N.U.1.U.Per. END
+	0x28,0x82,0x74,0x00,0x32,0x8B,0x74,0x07,0x52,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65, // (.t.2.t.Remainde END
+	0x84,0x75,0x82,0xA1,0x0B,0x64,0x69,0x76,0x33,0x32,0x72,0x65,0x6D,0x0A,0x70,0x6F, // .u...div32rem.po END
+	0x70,0x83,0x58,0x93,0xBD,0x02,0x27,0x2E,0x27,0x86,0xAB,0x02,0x63,0x30,0x0A,0x10, // p.X...'.'...c0.. END
+	0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x69,0x6E,0x74,0x33,0x32,0x4D,0x65,0x6D,0x50, // mov.r0.int32MemP END
+	0x72,0x80,0x09,0x09,0x52,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x0A,0x82,0x1D, // r...Remainder... END
+	0x02,0x31,0x20,0x49,0x81,0x1D,0x0C,0x43,0x6F,0x6E,0x73,0x74,0x31,0x45,0x31,0x0A, // .1.I...Const1E1. END
+	0x63,0x61,0x6C,0x6C,0x83,0x30,0x04,0x6D,0x75,0x6C,0x33,0x32,0x83,0x24,0x9D,0x42, // call.0.mul32.$.B END
+	0x8A,0x60,0x09,0x42,0x79,0x74,0x65,0x73,0x50,0x65,0x72,0x47,0x62,0x88,0x4C,0x02, // .`.BytesPerGb.L. END
+	0x64,0x69,0x76,0x9E,0x4C,0x87,0x7A,0x03,0x70,0x75,0x74,0x30,0x92,0x79,0x03,0x47, // div.L.z.put0.y.G END
+	0x62,0x53,0x74,0x84,0x28,0x80,0x23,0x14,0x73,0x30,0x0A,0x72,0x65,0x74,0x0A,0x3B, // bSt.(.#.s0.ret.; END
+	0x20,0x4D,0x62,0x20,0x63,0x61,0x73,0x65,0x0A,0x6C,0x61,0x62,0x65,0x84,0xBD,0x82, // .Mb.case.labe... END
+	0xEE,0x16,0x69,0x6E,0x74,0x4D,0x62,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72, // ..intMb.push16.r END
+	0x30,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x80,0x16,0x06,0x33,0x32,0x4D,0x65, // 0.mov.r1....32Me END
+	0x6D,0x50,0x72,0x80,0x20,0x07,0x42,0x79,0x74,0x65,0x73,0x50,0x65,0x72,0x80,0x28, // mPr...BytesPer.( END
+	0x82,0x1E,0x00,0x32,0x8B,0x1E,0x0D,0x52,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72, // ...2...Remainder END
+	0x0A,0x63,0x61,0x6C,0x6C,0x83,0x3A,0x0B,0x64,0x69,0x76,0x33,0x32,0x72,0x65,0x6D, // .call.:.div32rem END
+	0x0A,0x70,0x6F,0x70,0x83,0x58,0x87,0x1B,0x02,0x70,0x75,0x74,0x84,0x67,0x04,0x30, // .pop.X...put.g.0 END
+	0x20,0x27,0x2E,0x27,0x83,0x35,0x80,0x14,0x00,0x63,0x86,0x15,0x94,0x5E,0x84,0x9B, // .'.'.5...c...^.. END
+	0x00,0x49,0x81,0x9B,0x07,0x43,0x6F,0x6E,0x73,0x74,0x31,0x45,0x31,0x88,0x73,0x04, // .I...Const1E1.s. END
+	0x6D,0x75,0x6C,0x33,0x32,0xA3,0x42,0x87,0xDE,0x12,0x69,0x6E,0x74,0x42,0x79,0x74, // mul32.B...intByt END
+	0x65,0x73,0x50,0x65,0x72,0x4D,0x62,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x80,0x12,0x0D, // esPerMb.call.... END
+	0x33,0x32,0x64,0x69,0x76,0x33,0x32,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x83,0x11, // 32div32.mov.r0.. END
+	0x04,0x4D,0x65,0x6D,0x50,0x72,0x80,0x2E,0x08,0x52,0x65,0x6D,0x61,0x69,0x6E,0x64, // .MemPr...Remaind END
+	0x65,0x72,0x88,0x2D,0x03,0x70,0x75,0x74,0x30,0x92,0x2C,0x03,0x4D,0x62,0x53,0x74, // er.-.put0.,.MbSt END
+	0x84,0x28,0x80,0x23,0x14,0x73,0x30,0x0A,0x72,0x65,0x74,0x0A,0x3B,0x20,0x4B,0x62, // .(.#.s0.ret.;.Kb END
+	0x20,0x63,0x61,0x73,0x65,0x0A,0x6C,0x61,0x62,0x65,0x84,0x70,0x85,0x5E,0x08,0x4B, // .case.labe.p.^.K END
+	0x62,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x80,0x78,0x83,0x7F,0x00,0x31,0x8B,0x7F, // b.push16.x...1.. END
+	0x85,0xAE,0x80,0x28,0x82,0x9E,0x00,0x32,0x9F,0x9E,0x82,0xCC,0x06,0x72,0x65,0x6D, // ...(...2.....rem END
+	0x0A,0x70,0x6F,0x70,0x83,0x58,0x86,0xE8,0x15,0x32,0x70,0x75,0x74,0x30,0x0A,0x6D, // .pop.X...2put0.m END
+	0x6F,0x76,0x20,0x72,0x30,0x20,0x27,0x2E,0x27,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x80, // ov.r0.'.'.call.. END
+	0x14,0x00,0x63,0x86,0x15,0x09,0x69,0x6E,0x74,0x33,0x32,0x4D,0x65,0x6D,0x50,0x72, // ..c...int32MemPr END
+	0x80,0x09,0x08,0x52,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x83,0x33,0x02,0x31, // ...Remainder.3.1 END
+	0x20,0x49,0x81,0x1D,0x07,0x43,0x6F,0x6E,0x73,0x74,0x31,0x45,0x31,0x83,0x3D,0x82, // .I...Const1E1.=. END
+	0x30,0x04,0x6D,0x75,0x6C,0x33,0x32,0xA3,0x42,0x8A,0x60,0x09,0x42,0x79,0x74,0x65, // 0.mul32.B.`.Byte END
+	0x73,0x50,0x65,0x72,0x4B,0x62,0x88,0x4C,0x02,0x64,0x69,0x76,0x9E,0x4C,0x87,0x7A, // sPerKb.L.div.L.z END
+	0x89,0xD2,0x8A,0xBC,0x03,0x4B,0x62,0x53,0x74,0x84,0x28,0x80,0xF6,0x04,0x73,0x30, // .....KbSt.(...s0 END
+	0x0A,0x72,0x65,0x02,0x74,0x0A,0xFF,0xFA,0x00,0x15,0x02,0x5B,0x05,0x69,0x6E,0x74, // .re.t......[.int END
+	0x33,0x32,0x65,0x78,0x70,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20, // 32exp.s.require. END
+	0x82,0x12,0x09,0x63,0x6F,0x6D,0x6D,0x6F,0x6E,0x2E,0x73,0x0A,0x0A,0x84,0x16,0x02, // ...common.s..... END
+	0x65,0x6E,0x64,0x84,0x19,0x00,0x6D,0x80,0x2C,0x0F,0x0A,0x0A,0x3B,0x20,0x61,0x72, // end...m.,...;.ar END
+	0x72,0x61,0x79,0x20,0x6F,0x66,0x20,0x70,0x72,0x65,0x80,0x2E,0x2B,0x70,0x75,0x74, // ray.of.pre..+put END
+	0x65,0x64,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x20,0x66,0x6F,0x72,0x20,0x31,0x30, // ed.values.for.10 END
+	0x5E,0x6E,0x2C,0x20,0x65,0x61,0x63,0x68,0x20,0x70,0x61,0x69,0x72,0x20,0x75,0x73, // ^n,.each.pair.us END
+	0x69,0x6E,0x67,0x20,0x34,0x20,0x62,0x79,0x74,0x80,0x21,0x00,0x61,0x80,0x4F,0x10, // ing.4.byt.!.a.O. END
+	0x72,0x65,0x70,0x72,0x65,0x73,0x65,0x6E,0x74,0x69,0x6E,0x67,0x20,0x6F,0x6E,0x65, // representing.one END
+	0x20,0x80,0x0A,0x19,0x72,0x79,0x0A,0x64,0x77,0x20,0x49,0x6E,0x74,0x33,0x32,0x45, // ....ry.dw.Int32E END
+	0x78,0x70,0x31,0x30,0x41,0x72,0x72,0x61,0x79,0x20,0x30,0x2C,0x31,0x2C,0x80,0x03, // xp10Array.0,1,.. END
+	0x00,0x30,0x82,0x04,0x84,0x05,0x85,0x06,0x81,0x1B,0x0C,0x33,0x34,0x34,0x36,0x34, // .0.........34464 END
+	0x2C,0x31,0x35,0x2C,0x31,0x36,0x39,0x36,0x80,0x2C,0x07,0x35,0x32,0x2C,0x33,0x38, // ,15,1696.,.52,38 END
+	0x35,0x32,0x38,0x81,0x09,0x04,0x35,0x2C,0x35,0x37,0x36,0x81,0x25,0x80,0x0A,0x0B, // 528...5,576.%... END
+	0x38,0x2C,0x35,0x31,0x37,0x31,0x32,0x0A,0x0A,0x3B,0x20,0x69,0x81,0x62,0x00,0x65, // 8,51712..;.i.b.e END
+	0x81,0x62,0x38,0x28,0x6E,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x63,0x6F,0x6D,0x70, // .b8(n=r0).-.comp END
+	0x75,0x74,0x65,0x73,0x20,0x31,0x30,0x5E,0x6E,0x20,0x77,0x68,0x65,0x72,0x65,0x20, // utes.10^n.where. END
+	0x6E,0x20,0x69,0x73,0x20,0x61,0x20,0x73,0x74,0x61,0x6E,0x64,0x61,0x72,0x64,0x20, // n.is.a.standard. END
+	0x31,0x36,0x20,0x62,0x69,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x80,0x43,0x11,0x20, // 16.bit.value.C.. END
+	0x74,0x68,0x65,0x20,0x72,0x61,0x6E,0x67,0x65,0x20,0x5B,0x30,0x2C,0x39,0x5D,0x2C, // the.range.[0,9], END
+	0x20,0x80,0x27,0x04,0x20,0x70,0x6C,0x61,0x63,0x80,0x46,0x00,0x61,0x80,0x51,0x05, // ..'..plac.F.a.Q. END
+	0x6E,0x73,0x74,0x20,0x70,0x6F,0x80,0x6C,0x04,0x65,0x72,0x20,0x74,0x6F,0x83,0x2E, // nst.po.l.er.to.. END
+	0x04,0x65,0x73,0x75,0x6C,0x74,0x80,0x80,0x17,0x20,0x72,0x30,0x2E,0x20,0x69,0x74, // .esult....r0..it END
+	0x20,0x69,0x73,0x20,0x61,0x6E,0x20,0x65,0x72,0x72,0x6F,0x72,0x20,0x69,0x66,0x20, // .is.an.error.if. END
+	0x6E,0x81,0x10,0x01,0x6E,0x6F,0x80,0x17,0x16,0x6E,0x20,0x74,0x68,0x65,0x20,0x67, // n...no...n.the.g END
+	0x69,0x76,0x65,0x6E,0x20,0x72,0x61,0x6E,0x67,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C, // iven.range.label END
+	0x80,0x18,0x12,0x74,0x33,0x32,0x65,0x78,0x70,0x31,0x30,0x0A,0x3B,0x20,0x6D,0x75, // ...t32exp10.;.mu END
+	0x6C,0x74,0x69,0x70,0x6C,0x79,0x80,0x37,0x11,0x62,0x79,0x20,0x34,0x20,0x61,0x73, // ltiply.7.by.4.as END
+	0x20,0x65,0x61,0x63,0x68,0x20,0x65,0x6E,0x74,0x72,0x79,0x81,0x43,0x0D,0x6F,0x75, // .each.entry.C.ou END
+	0x72,0x20,0x61,0x72,0x72,0x61,0x79,0x20,0x75,0x73,0x65,0x73,0x80,0x21,0x0E,0x62, // r.array.uses.!.b END
+	0x79,0x74,0x65,0x73,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x34,0x0A,0x80,0x40, // ytes.mov.r1.4..@ END
+	0x80,0x89,0x82,0x02,0x00,0x31,0x80,0x4F,0x0B,0x63,0x61,0x6C,0x63,0x75,0x6C,0x61, // .....1.O.calcula END
+	0x74,0x65,0x20,0x70,0x6F,0x80,0x68,0x00,0x65,0x80,0x93,0x02,0x6E,0x74,0x6F,0x83, // te.po.h.e...nto. END
+	0x41,0x85,0x34,0x00,0x49,0x81,0x80,0x00,0x45,0x81,0x80,0x00,0x41,0x82,0x16,0x02, // A.4.I...E...A... END
+	0x61,0x64,0x64,0x87,0x42,0x04,0x72,0x65,0x74,0x0A,0xFF,0xA1,0x00};
+#endif
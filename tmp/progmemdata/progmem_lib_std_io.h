@@ -0,0 +1,506 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_std_io_H
+#define PROGMEM_lib_std_io_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_std_ioDATASIZE 7804u
+#define PROGMEM_lib_std_ioCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_std_ioDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_std_ioData))
+static const uint8_t progmem_lib_std_ioData[PROGMEM_lib_std_ioDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_std_ioDATAPTR ((uintptr_t)progmem_lib_std_ioData)
+static const uint8_t progmem_lib_std_ioData[PROGMEM_lib_std_ioDATASIZE]={
+#endif
+	0x5A,0x27,0xC0,0x00,0x55,0x00,0xC5,0x01,0x89,0x02,0x43,0x02,0xE9,0x03,0x81,0x04, // Z'..U.....C..... END
+	0x66,0x05,0x1F,0x05,0xD9,0x06,0xB2,0x07,0x76,0x08,0x2E,0x08,0xC6,0x09,0xB0,0x0A, // f.......v....... END
+	0x66,0x0B,0x3B,0x0C,0x21,0x0C,0xD2,0x0D,0x96,0x0D,0xFF,0x0E,0xA6,0x0F,0x4E,0x0F, // f.;.!.........N. END
+	0xF4,0x10,0xC9,0x11,0xB9,0x12,0x66,0x13,0x49,0x14,0x26,0x15,0x15,0x15,0xF8,0x16, // ......f.I.&..... END
+	0xB8,0x17,0xA1,0x18,0x7E,0x19,0x59,0x1A,0x36,0x1B,0x03,0x1B,0xCD,0x1C,0x54,0x1D, // ....~.Y.6.....T. END
+	0x15,0x1D,0xE4,0x1E,0x7C,0x0C,0x26,0x9E,0x02,0x0F,0x25,0x29,0x3F,0x42,0x56,0x90, // ....|.&...%)?BV. END
+	0x93,0x9B,0x00,0xF0,0x00,0x15,0x03,0x0B,0x0D,0x66,0x70,0x75,0x74,0x74,0x69,0x6D, // .........fputtim END
+	0x65,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x81,0x12,0x02,0x2E, // e.s.require..... END
+	0x73,0x0A,0x89,0x0E,0x02,0x64,0x65,0x63,0x80,0x11,0x02,0x0A,0x3B,0x20,0x84,0x2D, // s....dec....;..- END
+	0x00,0x28,0x81,0x32,0x09,0x3D,0x72,0x30,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x85, // .(.2.=r0).label. END
+	0x16,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x0D,0x30, // ...mov.r1.r0...0 END
+	0x20,0x46,0x64,0x53,0x74,0x64,0x6F,0x75,0x74,0x0A,0x6A,0x6D,0x70,0x82,0x58,0x82, // .FdStdout.jmp.X. END
+	0x26,0x80,0x48,0x82,0x77,0x0B,0x69,0x6D,0x65,0x28,0x66,0x64,0x3D,0x72,0x30,0x2C, // &.H.w.ime(fd=r0, END
+	0x20,0x74,0x80,0x0B,0x0E,0x3D,0x72,0x31,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20, // .t...=r1).label. END
+	0x66,0x70,0x75,0x74,0x81,0x12,0x2A,0x0A,0x0A,0x3B,0x20,0x44,0x69,0x76,0x69,0x64, // fput..*..;.Divid END
+	0x65,0x20,0x62,0x79,0x20,0x33,0x36,0x30,0x30,0x20,0x74,0x6F,0x20,0x74,0x65,0x73, // e.by.3600.to.tes END
+	0x74,0x20,0x66,0x6F,0x72,0x20,0x68,0x6F,0x75,0x72,0x73,0x0A,0x6D,0x6F,0x76,0x20, // t.for.hours.mov. END
+	0x72,0x32,0x82,0x1D,0x02,0x0A,0x64,0x69,0x82,0x0B,0x01,0x72,0x31,0x80,0x11,0x07, // r2....di...r1... END
+	0x0A,0x0A,0x63,0x6D,0x70,0x20,0x72,0x33,0x82,0x10,0x09,0x32,0x0A,0x73,0x6B,0x69, // ..cmp.r3...2.ski END
+	0x70,0x6E,0x65,0x71,0x7A,0x80,0x11,0x01,0x0A,0x6A,0x80,0x18,0x03,0x6D,0x69,0x6E, // pneqz....j...min END
+	0x75,0x80,0x49,0x07,0x0A,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x81,0x30,0x85,0x09, // u.I...push16.0.. END
+	0x00,0x31,0x82,0x13,0x04,0x38,0x20,0x72,0x30,0x0A,0x83,0x5D,0x82,0x4E,0x02,0x63, // .1...8.r0..].N.c END
+	0x61,0x6C,0x83,0x99,0x02,0x64,0x65,0x63,0x80,0x35,0x01,0x6F,0x70,0x82,0x20,0x86, // al...dec.5.op... END
+	0x29,0x84,0x28,0x02,0x27,0x68,0x27,0x87,0x29,0x00,0x63,0x80,0x40,0x86,0x28,0x01, // ).(.'h'.).c.@.(. END
+	0x6F,0x70,0x84,0x5B,0x83,0x08,0x01,0x32,0x0A,0x12,0x0A,0x6D,0x6F,0x76,0x20,0x72, // op.[...2...mov.r END
+	0x33,0x20,0x33,0x36,0x30,0x30,0x0A,0x6D,0x75,0x6C,0x20,0x72,0x32,0x82,0x02,0x07, // 3.3600.mul.r2... END
+	0x33,0x0A,0x73,0x75,0x62,0x20,0x72,0x31,0x82,0x02,0x21,0x32,0x0A,0x0A,0x3B,0x20, // 3.sub.r1..!2..;. END
+	0x44,0x69,0x76,0x69,0x64,0x65,0x20,0x62,0x79,0x20,0x36,0x30,0x20,0x74,0x6F,0x20, // Divide.by.60.to. END
+	0x74,0x65,0x73,0x74,0x20,0x66,0x6F,0x72,0x20,0x6D,0x69,0x6E,0x75,0x80,0x0C,0x05, // test.for.minu... END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x86,0x0D,0x83,0x58,0x00,0x32,0x80,0x2C,0x02,0x0A, // .label...X.2.,.. END
+	0x64,0x69,0x82,0x09,0x84,0x49,0x02,0x63,0x6D,0x70,0x81,0x70,0x82,0x67,0x08,0x0A, // di...I.cmp.p.g.. END
+	0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x81,0x70,0x00,0x6A,0x80,0x18,0x05,0x73, // skipneqz.p.j...s END
+	0x65,0x63,0x6F,0x6E,0x64,0x80,0x3D,0x05,0x70,0x75,0x73,0x68,0x31,0x36,0x81,0x7A, // econd.=.push16.z END
+	0x85,0x09,0x00,0x31,0x82,0x13,0x03,0x38,0x20,0x72,0x30,0x84,0x5B,0x82,0x98,0x0B, // ...1...8.r0.[... END
+	0x63,0x61,0x6C,0x6C,0x20,0x66,0x70,0x75,0x74,0x64,0x65,0x63,0x80,0x35,0x01,0x6F, // call.fputdec.5.o END
+	0x70,0x82,0x20,0x86,0x29,0x84,0x28,0x02,0x27,0x6D,0x27,0x87,0x29,0x00,0x63,0x80, // p...).(.'m'.).c. END
+	0x40,0x86,0x28,0x08,0x6F,0x70,0x31,0x36,0x20,0x72,0x31,0x0A,0x70,0x83,0x08,0x0F, // @.(.op16.r1.p... END
+	0x32,0x0A,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x36,0x30,0x0A,0x6D,0x75,0x6C, // 2..mov.r3.60.mul END
+	0x80,0x11,0x82,0x02,0x04,0x33,0x0A,0x73,0x75,0x62,0x80,0x27,0x82,0x02,0x80,0x24, // .....3.sub.'...$ END
+	0x10,0x3B,0x20,0x53,0x65,0x63,0x6F,0x6E,0x64,0x73,0x0A,0x6C,0x61,0x62,0x65,0x6C, // .;.Seconds.label END
+	0x20,0x73,0x84,0x0D,0x16,0x70,0x75,0x73,0x68,0x38,0x20,0x72,0x30,0x0A,0x0A,0x63, // .s...push8.r0..c END
+	0x61,0x6C,0x6C,0x20,0x66,0x70,0x75,0x74,0x64,0x65,0x63,0x0A,0x81,0x5E,0x82,0x16, // all.fputdec..^.. END
+	0x82,0x5C,0x04,0x31,0x20,0x27,0x73,0x27,0x87,0x20,0x00,0x63,0x80,0x2D,0x04,0x72, // .\.1.'s'...c.-.r END
+	0x65,0x74,0x0A,0xFF,0xB1,0x00,0x02,0x05,0x7B,0x16,0x81,0x64,0x10,0x2E,0x73,0x00, // et......{..d..s. END
+	0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x65,0x6E,0x64,0x20,0x2E,0x2E,0x2F,0x80,0x02, // requireend.../.. END
+	0x02,0x73,0x79,0x73,0x81,0x03,0x01,0x2E,0x73,0x80,0x5D,0x89,0x1A,0x02,0x73,0x74, // .sys....s.]...st END
+	0x72,0x81,0x03,0x02,0x6C,0x65,0x6E,0x80,0x1A,0x14,0x0A,0x3B,0x20,0x70,0x75,0x74, // r...len....;.put END
+	0x73,0x30,0x28,0x73,0x74,0x72,0x41,0x64,0x64,0x72,0x3D,0x72,0x30,0x29,0x3D,0x81, // s0(strAddr=r0)=. END
+	0x11,0x03,0x28,0x30,0x2C,0x20,0x84,0x13,0x2E,0x29,0x20,0x2D,0x20,0x72,0x65,0x74, // ..(0,....).-.ret END
+	0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62, // urns.number.of.b END
+	0x79,0x74,0x65,0x73,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6E,0x20,0x69,0x6E,0x20, // ytes.written.in. END
+	0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x83,0x50,0x06,0x0A,0x6D,0x6F,0x76,0x20, // r0.label.P..mov. END
+	0x72,0x31,0x81,0x15,0x82,0x09,0x06,0x30,0x20,0x30,0x0A,0x6A,0x6D,0x70,0x82,0x6D, // r1.....0.0.jmp.m END
+	0x00,0x0A,0x84,0x75,0x06,0x28,0x6F,0x66,0x66,0x73,0x65,0x74,0x80,0x73,0x86,0x6B, // ...u.(offset.s.k END
+	0x05,0x3D,0x72,0x31,0x29,0x3D,0x66,0x82,0x80,0x04,0x73,0x74,0x64,0x69,0x6F,0xBA, // .=r1)=f...stdio. END
+	0x84,0x83,0x83,0x00,0x32,0x80,0x86,0x8F,0x8D,0x06,0x46,0x64,0x53,0x74,0x64,0x6F, // ....2.....FdStdo END
+	0x75,0x0D,0x74,0x0A,0x6A,0x6D,0x70,0x20,0x66,0x70,0x75,0x74,0x73,0x0A,0x0A,0x3B, // u.t.jmp.fputs..; END
+	0x83,0x08,0x2E,0x28,0x66,0x64,0x3D,0x72,0x30,0x2C,0x20,0x6F,0x66,0x66,0x73,0x65, // ...(fd=r0,.offse END
+	0x74,0x3D,0x72,0x31,0x2C,0x20,0x73,0x74,0x72,0x41,0x64,0x64,0x72,0x3D,0x72,0x32, // t=r1,.strAddr=r2 END
+	0x29,0x20,0x2D,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D,0x62, // ).-.returns.numb END
+	0x65,0x72,0x80,0x27,0x13,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x77,0x72,0x69,0x74, // er.'..bytes.writ END
+	0x74,0x65,0x6E,0x20,0x69,0x6E,0x20,0x72,0x30,0x80,0x4D,0x01,0x75,0x73,0x80,0x14, // ten.in.r0.M.us.. END
+	0x80,0x3A,0x00,0x6C,0x80,0x13,0x12,0x73,0x6F,0x20,0x77,0x65,0x20,0x63,0x61,0x6E, // .:.l...so.we.can END
+	0x20,0x64,0x6F,0x20,0x61,0x63,0x74,0x75,0x61,0x6C,0x82,0x2F,0x05,0x65,0x20,0x6C, // .do.actual./.e.l END
+	0x6F,0x6F,0x70,0x81,0x32,0x10,0x6B,0x65,0x72,0x6E,0x65,0x6C,0x20,0x73,0x70,0x61, // oop.2.kernel.spa END
+	0x63,0x65,0x20,0x28,0x76,0x69,0x61,0x84,0x1F,0x08,0x73,0x79,0x73,0x63,0x61,0x6C, // ce.(via...syscal END
+	0x6C,0x29,0x2C,0x80,0x9F,0x03,0x72,0x61,0x74,0x68,0x80,0x71,0x01,0x74,0x68,0x80, // l),...rath.q.th. END
+	0x47,0x81,0x6D,0x04,0x69,0x6E,0x67,0x20,0x61,0x82,0x7D,0x02,0x20,0x61,0x74,0x80, // G.m.ing.a.}..at. END
+	0x09,0x07,0x74,0x69,0x6D,0x65,0x0A,0x6C,0x61,0x62,0x80,0x47,0x83,0xD3,0x04,0x70, // ..time.lab.G...p END
+	0x75,0x73,0x68,0x38,0x81,0x8D,0x81,0x08,0x04,0x31,0x36,0x20,0x72,0x31,0x86,0x09, // ush8.....16.r1.. END
+	0x04,0x32,0x0A,0x6D,0x6F,0x76,0x18,0x20,0x72,0x30,0x20,0x72,0x32,0x0A,0x63,0x61, // .2.mov..r0.r2.ca END
+	0x6C,0x6C,0x20,0x73,0x74,0x72,0x6C,0x65,0x6E,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x34, // ll.strlen.mov.r4 END
+	0x81,0x18,0x00,0x3B,0x81,0x12,0x03,0x69,0x6E,0x67,0x20,0x86,0x16,0x04,0x30,0x20, // ...;...ing....0. END
+	0x53,0x79,0x73,0x81,0x2C,0x0F,0x49,0x64,0x57,0x72,0x69,0x74,0x65,0x0A,0x70,0x6F, // Sys.,.IdWrite.po END
+	0x70,0x31,0x36,0x20,0x72,0x33,0x83,0x2B,0x85,0x0E,0x00,0x32,0x80,0x3A,0x05,0x6F, // p16.r3.+...2.:.o END
+	0x66,0x66,0x73,0x65,0x74,0x81,0x20,0x03,0x38,0x20,0x72,0x31,0x80,0x4B,0x03,0x66, // ffset...8.r1.K.f END
+	0x64,0x0A,0x73,0x83,0x3C,0x01,0x0A,0x72,0x80,0x18,0x0E,0x0A,0x3B,0x20,0x70,0x75, // d.s.<..r....;.pu END
+	0x74,0x63,0x30,0x28,0x63,0x3D,0x72,0x30,0x29,0x3D,0x81,0x0B,0x0B,0x28,0x30,0x2C, // tc0(c=r0)=...(0, END
+	0x20,0x63,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x83,0x1C,0x83,0x8C,0x00,0x31,0x80, // .c).label.....1. END
+	0xA5,0x85,0x7F,0x04,0x30,0x0A,0x6A,0x6D,0x70,0x82,0x39,0x85,0x41,0x00,0x28,0x83, // ....0.jmp.9.A.(. END
+	0x69,0x80,0x45,0x80,0x3D,0x05,0x3D,0x72,0x31,0x29,0x3D,0x66,0x82,0x4C,0x05,0x73, // i.E.=.=r1)=f.L.s END
+	0x74,0x64,0x69,0x6F,0x2C,0x84,0x87,0x8C,0x58,0x83,0xE4,0x02,0x32,0x20,0x72,0x0A, // tdio,...X...2.r. END
+	0x31,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x16,0x30,0x20, // 1.mov.r1.r0...0. END
+	0x46,0x64,0x53,0x74,0x64,0x6F,0x75,0x74,0x0A,0x6A,0x6D,0x70,0x20,0x66,0x70,0x75, // FdStdout.jmp.fpu END
+	0x74,0x63,0x0A,0x0A,0x3B,0x83,0x08,0x0E,0x30,0x28,0x66,0x64,0x3D,0x72,0x30,0x2C, // tc..;...0(fd=r0, END
+	0x20,0x63,0x3D,0x72,0x31,0x29,0x3D,0x82,0x1C,0x80,0x12,0x01,0x2C,0x20,0x81,0x12, // .c=r1)=.....,... END
+	0x06,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x84,0x29,0x83,0x57,0x00,0x32,0x80,0x5A, // .).label.).W.2.Z END
+	0x85,0x61,0x00,0x30,0x90,0x50,0x85,0x4F,0x05,0x6F,0x66,0x66,0x73,0x65,0x74,0x80, // .a.0.P.O.offset. END
+	0x54,0x82,0x5A,0x00,0x32,0x8A,0x4A,0x80,0x7C,0x17,0x73,0x74,0x6F,0x72,0x65,0x20, // T.Z.2.J.|.store. END
+	0x67,0x69,0x76,0x65,0x6E,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20, // given.character. END
+	0x6F,0x6E,0x80,0x18,0x1B,0x61,0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x77,0x72,0x69, // on...ack.for.wri END
+	0x74,0x65,0x20,0x63,0x61,0x6C,0x6C,0x20,0x74,0x6F,0x20,0x61,0x63,0x63,0x65,0x73, // te.call.to.acces END
+	0x73,0x83,0xDB,0x09,0x33,0x20,0x72,0x36,0x0A,0x70,0x75,0x73,0x68,0x38,0x80,0x8F, // s...3.r6.push8.. END
+	0x81,0x4C,0x01,0x79,0x73,0x82,0x26,0x82,0x31,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72, // .L.ys.&.1..mov.r END
+	0x32,0x20,0x72,0x31,0x83,0x09,0x03,0x31,0x20,0x72,0x30,0x83,0x13,0x0F,0x30,0x20, // 2.r1...1.r0...0. END
+	0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x57,0x72,0x69,0x74,0x65,0x83,0x29, // SyscallIdWrite.) END
+	0x04,0x34,0x20,0x31,0x0A,0x73,0x83,0x17,0x1B,0x0A,0x3B,0x20,0x72,0x65,0x73,0x74, // .4.1.s....;.rest END
+	0x6F,0x72,0x65,0x20,0x73,0x74,0x61,0x63,0x6B,0x0A,0x64,0x65,0x63,0x20,0x72,0x36, // ore.stack.dec.r6 END
+	0x0A,0x72,0x65,0x74,0x0A,0x80,0x1B,0x1A,0x66,0x70,0x75,0x74,0x61,0x70,0x70,0x65, // .ret....fputappe END
+	0x6E,0x64,0x28,0x70,0x61,0x74,0x68,0x3D,0x72,0x30,0x2C,0x20,0x64,0x61,0x74,0x61, // nd(path=r0,.data END
+	0x3D,0x72,0x31,0x83,0x08,0x09,0x4C,0x65,0x6E,0x3D,0x72,0x32,0x29,0x20,0x2D,0x20, // =r1...Len=r2).-. END
+	0x83,0x26,0x05,0x20,0x67,0x69,0x76,0x65,0x6E,0x82,0x23,0x0B,0x20,0x74,0x6F,0x20, // .&..given.#..to. END
+	0x66,0x69,0x6C,0x65,0x20,0x61,0x74,0x20,0x81,0x3C,0x00,0x2C,0x81,0x69,0x05,0x69, // file.at..<.,.i.i END
+	0x7A,0x65,0x73,0x20,0x61,0x80,0x27,0x00,0x77,0x81,0x8E,0x00,0x73,0x82,0x4C,0x81, // zes.a.'.w...s.L. END
+	0x18,0x0D,0x74,0x75,0x72,0x6E,0x69,0x6E,0x67,0x20,0x31,0x2F,0x30,0x20,0x69,0x6E, // ..turning.1/0.in END
+	0x81,0xB8,0x18,0x66,0x6F,0x72,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x2F,0x66, // ...for.success/f END
+	0x61,0x69,0x6C,0x75,0x72,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88,0x94,0x83,0xF8, // ailure.label.... END
+	0x00,0x33,0x06,0x20,0x72,0x32,0x0A,0x6D,0x6F,0x76,0x80,0x06,0x02,0x20,0x72,0x31, // .3..r2.mov....r1 END
+	0x83,0x09,0x03,0x31,0x20,0x72,0x30,0x83,0x13,0x12,0x30,0x20,0x53,0x79,0x73,0x63, // ...1.r0...0.Sysc END
+	0x61,0x6C,0x6C,0x49,0x64,0x41,0x70,0x70,0x65,0x6E,0x64,0x0A,0x73,0x83,0x0F,0x05, // allIdAppend.s... END
+	0x0A,0x72,0x65,0x74,0x0A,0xFF,0x81,0x00,0x04,0x00,0xCD,0x04,0x66,0x6F,0x80,0x1A, // .ret........fo.. END
+	0x0D,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80, // ..s.require.../. END
+	0x02,0x80,0x29,0x81,0x03,0x81,0x3D,0x08,0x2E,0x73,0x0A,0x0A,0x3B,0x20,0x66,0x64, // ..)...=..s..;.fd END
+	0x3D,0x82,0x29,0x1A,0x28,0x70,0x61,0x74,0x68,0x3D,0x72,0x30,0x2C,0x20,0x6D,0x6F, // =.).(path=r0,.mo END
+	0x64,0x65,0x3D,0x72,0x31,0x29,0x20,0x2D,0x20,0x70,0x6C,0x61,0x63,0x65,0x73,0x80, // de=r1).-.places. END
+	0x23,0x02,0x20,0x69,0x6E,0x80,0x7E,0x01,0x2C,0x20,0x80,0x60,0x23,0x75,0x72,0x6E, // #..in.~.,..`#urn END
+	0x73,0x20,0x46,0x64,0x49,0x6E,0x76,0x61,0x6C,0x69,0x64,0x20,0x28,0x30,0x29,0x20, // s.FdInvalid.(0). END
+	0x6F,0x6E,0x20,0x66,0x61,0x69,0x6C,0x75,0x72,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C, // on.failure.label END
+	0x20,0x82,0x7B,0x80,0x5C,0x03,0x55,0x73,0x65,0x20,0x81,0x86,0x00,0x20,0x85,0xA0, // ..{.\.Use....... END
+	0xA1,0xD3,0x00,0x4F,0x80,0xD2,0x0D,0x0A,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x0A, // ...O....syscall. END
+	0x72,0x65,0x74,0x0A,0xFF,0xAF,0x00,0x14,0x05,0x7B,0x16,0x66,0x70,0x75,0x74,0x64, // ret......{.fputd END
+	0x65,0x63,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x81,0x11,0x01, // ec.s.require.... END
+	0x2E,0x73,0x80,0x52,0x83,0x0E,0x0B,0x2E,0x2E,0x2F,0x73,0x74,0x72,0x2F,0x69,0x6E, // .s.R...../str/in END
+	0x74,0x74,0x6F,0x80,0x08,0x80,0x19,0x02,0x0A,0x3B,0x20,0x83,0x34,0x09,0x70,0x61, // tto......;..4.pa END
+	0x64,0x28,0x78,0x3D,0x72,0x30,0x2C,0x20,0x80,0x09,0x09,0x4C,0x65,0x6E,0x3D,0x72, // d(x=r0,....Len=r END
+	0x31,0x29,0x20,0x2D,0x20,0x80,0x8C,0x27,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D, // 1).-...'urns.num END
+	0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x77,0x72,0x69, // ber.of.bytes.wri END
+	0x74,0x74,0x65,0x6E,0x20,0x69,0x6E,0x20,0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C, // tten.in.r0.label END
+	0x87,0x48,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x72,0x31,0x83,0x09,0x00, // .H..mov.r2.r1... END
+	0x31,0x81,0x23,0x82,0x13,0x0D,0x30,0x20,0x46,0x64,0x53,0x74,0x64,0x6F,0x75,0x74, // 1.#...0.FdStdout END
+	0x0A,0x6A,0x6D,0x70,0x82,0x9E,0x80,0xB0,0x04,0x63,0x6F,0x6D,0x6D,0x6F,0x3E,0x6E, // .jmp.....commo>n END
+	0x0A,0x0A,0x3B,0x20,0x70,0x75,0x74,0x64,0x65,0x63,0x28,0x78,0x3D,0x72,0x30,0x29, // ..;.putdec(x=r0) END
+	0x20,0x2D,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65, // .-.returns.numbe END
+	0x72,0x20,0x6F,0x66,0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x77,0x72,0x69,0x74,0x74, // r.of.bytes.writt END
+	0x65,0x6E,0x20,0x69,0x6E,0x20,0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x84,0x3A, // en.in.r0.label.: END
+	0x06,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x81,0x16,0x82,0x09,0x0F,0x30,0x20,0x46, // ..mov.r1.....0.F END
+	0x64,0x53,0x74,0x64,0x6F,0x75,0x74,0x0A,0x6A,0x6D,0x70,0x20,0x66,0x84,0x25,0x80, // dStdout.jmp.f.%. END
+	0x6A,0x84,0x0A,0x02,0x28,0x66,0x64,0x80,0x6C,0x01,0x2C,0x20,0x80,0x72,0x00,0x31, // j...(fd.l.,..r.1 END
+	0xAD,0x72,0x85,0x4D,0x82,0x73,0x02,0x32,0x20,0x30,0x89,0x62,0x04,0x63,0x6F,0x6D, // .r.M.s.2.0.b.com END
+	0x6D,0x6F,0x82,0xD3,0x8A,0x10,0x89,0x6E,0x0A,0x2C,0x20,0x70,0x61,0x64,0x4C,0x65, // mo.....n.,.padLe END
+	0x6E,0x3D,0x72,0x32,0x80,0xEC,0x10,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x78,0x20, // n=r2....write.x. END
+	0x69,0x6E,0x20,0x61,0x73,0x63,0x69,0x69,0x80,0x05,0x39,0x20,0x61,0x20,0x64,0x65, // in.ascii..9.a.de END
+	0x63,0x69,0x6D,0x61,0x6C,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x74,0x6F,0x20,0x67, // cimal.value.to.g END
+	0x69,0x76,0x65,0x6E,0x20,0x66,0x64,0x2C,0x20,0x6F,0x70,0x74,0x69,0x6F,0x6E,0x61, // iven.fd,.optiona END
+	0x6C,0x6C,0x79,0x20,0x70,0x61,0x64,0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68,0x20, // lly.padded.with. END
+	0x7A,0x65,0x72,0x6F,0x73,0x87,0x29,0x1E,0x6C,0x65,0x6E,0x67,0x74,0x68,0x2C,0x20, // zeros.).length,. END
+	0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72,0x20,0x6F, // returns.number.o END
+	0x66,0x20,0x62,0x79,0x74,0x65,0x73,0x82,0x76,0x00,0x74,0x80,0x51,0x80,0x76,0x0C, // f.bytes.v.t.Q.v. END
+	0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x66,0x70,0x75,0x74,0x80,0x78,0x07, // r0.label.fput.x. END
+	0x63,0x6F,0x6D,0x6D,0x6F,0x6E,0x0A,0x3B,0x80,0x3B,0x06,0x73,0x65,0x72,0x76,0x65, // common.;.;.serve END
+	0x20,0x36,0x84,0x33,0x80,0x3C,0x04,0x73,0x74,0x61,0x63,0x6B,0x81,0x8F,0x03,0x73, // .6.3.<.stack...s END
+	0x74,0x6F,0x72,0x80,0x98,0x07,0x65,0x6D,0x70,0x6F,0x72,0x61,0x72,0x79,0x80,0x18, // tor...emporary.. END
+	0x12,0x72,0x69,0x6E,0x67,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x72,0x36,0x0A, // .ring.mov.r3.r6. END
+	0x69,0x6E,0x63,0x36,0x81,0x07,0x08,0x3B,0x20,0x63,0x6F,0x6E,0x76,0x65,0x72,0x74, // inc6...;.convert END
+	0x80,0xE3,0x80,0xC7,0x00,0x61,0x85,0x29,0x06,0x70,0x75,0x73,0x68,0x38,0x20,0x72, // .....a.).push8.r END
+	0x16,0x30,0x20,0x3B,0x20,0x70,0x72,0x6F,0x74,0x65,0x63,0x74,0x20,0x66,0x64,0x0A, // .0.;.protect.fd. END
+	0x70,0x75,0x73,0x68,0x38,0x20,0x72,0x32,0x88,0x15,0x05,0x70,0x61,0x64,0x4C,0x65, // push8.r2...padLe END
+	0x6E,0x82,0x19,0x04,0x31,0x36,0x20,0x72,0x33,0x88,0x30,0x0E,0x73,0x74,0x72,0x20, // n...16.r3.0.str. END
+	0x61,0x64,0x64,0x72,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x80,0x1C,0x0A,0x0A,0x63, // addr.mov.r0....c END
+	0x61,0x6C,0x6C,0x20,0x69,0x6E,0x74,0x74,0x6F,0x80,0x1C,0x00,0x0A,0x81,0x5B,0x80, // all.intto.....[. END
+	0x0C,0x81,0x28,0x06,0x69,0x6E,0x67,0x0A,0x70,0x6F,0x70,0x81,0x42,0x81,0x5D,0x06, // ..(.ing.pop.B.]. END
+	0x72,0x65,0x73,0x74,0x6F,0x72,0x65,0x87,0x42,0x80,0x1B,0x80,0x78,0x00,0x31,0x88, // restore.B...x.1. END
+	0x1A,0x84,0x78,0x82,0x5B,0x06,0x33,0x20,0x35,0x0A,0x73,0x75,0x62,0x81,0x7E,0x81, // ..x.[.3.5.sub.~. END
+	0x02,0x04,0x31,0x0A,0x63,0x6D,0x70,0x81,0x2D,0x82,0x02,0x07,0x0A,0x73,0x6B,0x69, // ..1.cmp.-....ski END
+	0x70,0x65,0x71,0x7A,0x83,0x3E,0x01,0x69,0x66,0x84,0xB2,0x09,0x3D,0x30,0x20,0x74, // peqz.>.if...=0.t END
+	0x68,0x65,0x6E,0x20,0x6E,0x6F,0x81,0xC3,0x00,0x64,0x81,0x80,0x80,0xAC,0x81,0xDC, // hen.no...d...... END
+	0x81,0x02,0x00,0x33,0x83,0xB4,0x23,0x31,0x20,0x30,0x0A,0x70,0x6F,0x70,0x38,0x20, // ...3..#1.0.pop8. END
+	0x72,0x30,0x20,0x3B,0x20,0x72,0x65,0x73,0x74,0x6F,0x72,0x65,0x20,0x66,0x64,0x0A, // r0.;.restore.fd. END
+	0x63,0x61,0x6C,0x6C,0x20,0x66,0x70,0x75,0x74,0x73,0x0A,0x87,0x17,0x11,0x73,0x74, // call.fputs....st END
+	0x61,0x63,0x6B,0x0A,0x64,0x65,0x63,0x36,0x20,0x72,0x36,0x0A,0x72,0x65,0x74,0x0A, // ack.dec6.r6.ret. END
+	0x80,0x1C,0x80,0x23,0x80,0x11,0x0E,0x73,0x69,0x67,0x6E,0x65,0x64,0x28,0x78,0x3D, // ...#...signed(x= END
+	0x72,0x30,0x29,0x20,0x2D,0x20,0x83,0x0E,0x11,0x20,0x31,0x36,0x20,0x62,0x69,0x74, // r0).-.....16.bit END
+	0x20,0x76,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x6F,0x66,0x84,0x2D,0x05,0x0A,0x6C, // .version.of.-..l END
+	0x61,0x62,0x65,0x6C,0x8A,0x3A,0x80,0x66,0x0E,0x50,0x6F,0x73,0x69,0x74,0x69,0x76, // abel.:.f.Positiv END
+	0x65,0x20,0x28,0x75,0x70,0x70,0x65,0x72,0x82,0x3A,0x13,0x30,0x29,0x3F,0x0A,0x6D, // e.(upper.:.0)?.m END
+	0x6F,0x76,0x20,0x72,0x31,0x20,0x33,0x32,0x37,0x36,0x38,0x0A,0x61,0x6E,0x64,0x81, // ov.r1.32768.and. END
+	0x0C,0x80,0xAF,0x05,0x72,0x31,0x0A,0x63,0x6D,0x70,0x82,0x0C,0x81,0x02,0x08,0x0A, // ....r1.cmp...... END
+	0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x81,0x18,0x00,0x6A,0x80,0x18,0x83,0x98, // skipneqz...j.... END
+	0x08,0x3B,0x20,0x74,0x68,0x69,0x73,0x20,0x77,0x69,0x80,0xCF,0x80,0xB1,0x07,0x75, // .;.this.wi.....u END
+	0x72,0x6E,0x20,0x66,0x72,0x6F,0x6D,0x83,0x15,0x00,0x66,0x3A,0x75,0x6E,0x63,0x74, // rn.from...f:unct END
+	0x69,0x6F,0x6E,0x20,0x61,0x73,0x20,0x77,0x65,0x6C,0x6C,0x0A,0x3B,0x20,0x4E,0x65, // ion.as.well.;.Ne END
+	0x67,0x61,0x74,0x69,0x76,0x65,0x20,0x2D,0x20,0x70,0x72,0x69,0x6E,0x74,0x20,0x6D, // gative.-.print.m END
+	0x69,0x6E,0x75,0x73,0x20,0x73,0x69,0x67,0x6E,0x0A,0x70,0x75,0x73,0x68,0x31,0x36, // inus.sign.push16 END
+	0x20,0x72,0x30,0x0A,0x6D,0x6F,0x76,0x80,0x06,0x12,0x20,0x27,0x2D,0x27,0x0A,0x63, // .r0.mov....'-'.c END
+	0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x63,0x30,0x0A,0x70,0x6F,0x70,0x83,0x1E,0x12, // all.putc0.pop... END
+	0x3B,0x20,0x49,0x6E,0x76,0x65,0x72,0x74,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72,0x0A, // ;.Invert.number. END
+	0x6E,0x6F,0x74,0x81,0x2E,0x80,0x38,0x02,0x69,0x6E,0x63,0x83,0x20,0x0B,0x55,0x73, // not...8.inc...Us END
+	0x65,0x20,0x73,0x74,0x61,0x6E,0x64,0x61,0x72,0x64,0x81,0x3E,0x05,0x64,0x65,0x63, // e.standard.>.dec END
+	0x20,0x74,0x6F,0x84,0x73,0x0D,0x72,0x65,0x6D,0x61,0x69,0x6E,0x69,0x6E,0x67,0x20, // .to.s.remaining. END
+	0x70,0x6F,0x73,0x69,0x82,0x8E,0x08,0x76,0x61,0x6C,0x75,0x65,0x0A,0x6A,0x6D,0x70, // posi...value.jmp END
+	0x84,0x2C,0x01,0x0A,0xFF,0x81,0x00,0x16,0x00,0x89,0x03,0x66,0x63,0x6C,0x6F,0x73, // .,.........fclos END
+	0x65,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80, // e.s.require.../. END
+	0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x81,0x9D,0x02,0x2E,0x73,0x0A,0x80,0xD8,0x83, // ..sys......s.... END
+	0x27,0x0E,0x28,0x66,0x64,0x3D,0x72,0x30,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20, // '.(fd=r0).label. END
+	0x66,0x0E,0x63,0x6C,0x6F,0x73,0x65,0x0A,0x3B,0x20,0x49,0x6E,0x76,0x6F,0x6B,0x65, // f.close.;.Invoke END
+	0x20,0x82,0x0E,0x11,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x0A,0x6D,0x6F,0x76, // .....syscall.mov END
+	0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x02,0x30,0x20,0x53,0x83,0x18,0x02,0x49, // .r1.r0...0.S...I END
+	0x64,0x43,0x82,0x36,0x85,0x27,0x04,0x72,0x65,0x74,0x0A,0xFF,0xB3,0x00,0x14,0x04, // dC.6.'.ret...... END
+	0xCA,0x14,0x66,0x70,0x75,0x74,0x68,0x65,0x78,0x2E,0x73,0x00,0x72,0x65,0x71,0x75, // ..fputhex.s.requ END
+	0x69,0x72,0x65,0x20,0x81,0x11,0x02,0x2E,0x73,0x0A,0x80,0x96,0x83,0x1A,0x2A,0x31, // ire.....s.....*1 END
+	0x36,0x28,0x78,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x74,0x61,0x6B,0x65,0x73,0x20, // 6(x=r0).-.takes. END
+	0x31,0x36,0x20,0x62,0x69,0x74,0x20,0x75,0x6E,0x73,0x69,0x67,0x6E,0x65,0x64,0x20, // 16.bit.unsigned. END
+	0x69,0x6E,0x74,0x20,0x61,0x6E,0x64,0x20,0x70,0x72,0x80,0x09,0x06,0x73,0x20,0x61, // int.and.pr...s.a END
+	0x73,0x20,0x34,0x20,0x80,0x52,0x04,0x20,0x64,0x69,0x67,0x69,0x80,0x0F,0x0E,0x74, // s.4..R..digi...t END
+	0x6F,0x20,0x73,0x74,0x64,0x6F,0x75,0x74,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x86,0x55, // o.stdout.label.U END
+	0x80,0xE0,0x09,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x0A,0x6D,0x6F,0x80,0x09,0x1A, // ...v.r1.r0.mo... END
+	0x30,0x20,0x46,0x64,0x53,0x74,0x64,0x6F,0x75,0x74,0x0A,0x6A,0x6D,0x70,0x20,0x66, // 0.FdStdout.jmp.f END
+	0x70,0x75,0x74,0x68,0x65,0x78,0x31,0x36,0x0A,0x0A,0x3B,0x87,0x0C,0x2F,0x28,0x66, // puthex16..;../(f END
+	0x64,0x3D,0x72,0x30,0x2C,0x20,0x78,0x3D,0x72,0x31,0x29,0x20,0x2D,0x20,0x74,0x61, // d=r0,.x=r1).-.ta END
+	0x6B,0x65,0x73,0x20,0x31,0x36,0x20,0x62,0x69,0x74,0x20,0x75,0x6E,0x73,0x69,0x67, // kes.16.bit.unsig END
+	0x6E,0x65,0x64,0x20,0x69,0x6E,0x74,0x20,0x61,0x6E,0x64,0x20,0x70,0x72,0x80,0x09, // ned.int.and.pr.. END
+	0x06,0x73,0x20,0x61,0x73,0x20,0x34,0x20,0x80,0x4B,0x04,0x20,0x64,0x69,0x67,0x69, // .s.as.4..K..digi END
+	0x80,0x0F,0x10,0x74,0x6F,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x66,0x64,0x0A,0x6C, // ...to.given.fd.l END
+	0x61,0x62,0x65,0x6C,0x88,0x6C,0x00,0x3B,0x83,0x24,0x07,0x20,0x31,0x0A,0x70,0x75, // abel.l.;.$..1.pu END
+	0x73,0x68,0x38,0x81,0x9D,0x81,0x08,0x80,0x61,0x01,0x72,0x31,0x83,0xA7,0x07,0x32, // sh8.....a.r1...2 END
+	0x20,0x31,0x32,0x0A,0x73,0x68,0x72,0x82,0xBB,0x80,0xBE,0x04,0x32,0x0A,0x63,0x61, // .12.shr.....2.ca END
+	0x6C,0x86,0x42,0x82,0x62,0x03,0x0A,0x70,0x6F,0x70,0x83,0x31,0x80,0x08,0x82,0x43, // l.B.b..pop.1...C END
+	0x85,0x56,0x00,0x32,0x8A,0x56,0x12,0x68,0x31,0x36,0x20,0x72,0x31,0x0A,0x6D,0x6F, // .V.2.V.h16.r1.mo END
+	0x76,0x20,0x72,0x32,0x20,0x38,0x0A,0x73,0x68,0x72,0x80,0x0F,0x82,0x02,0x00,0x32, // v.r2.8.shr.....2 END
+	0x85,0x15,0x05,0x31,0x35,0x0A,0x61,0x6E,0x64,0x87,0x16,0x14,0x63,0x61,0x6C,0x6C, // ...15.and...call END
+	0x20,0x66,0x70,0x75,0x74,0x68,0x65,0x78,0x64,0x69,0x67,0x69,0x74,0x0A,0x70,0x6F, // .fputhexdigit.po END
+	0x70,0x83,0x47,0x80,0x08,0x06,0x38,0x20,0x72,0x30,0x0A,0x3B,0x20,0x82,0x18,0x06, // p.G...8.r0.;.... END
+	0x20,0x33,0x0A,0x70,0x75,0x73,0x68,0x82,0x12,0x81,0x08,0x8A,0x6C,0x00,0x34,0xCD, // .3.push.....l.4. END
+	0x6C,0x00,0x34,0xA7,0xB0,0x03,0x72,0x65,0x74,0x0A,0x80,0xA4,0x01,0x70,0x75,0x2C, // l.4...ret....pu, END
+	0x74,0x68,0x65,0x78,0x38,0x28,0x78,0x3D,0x72,0x30,0x29,0x20,0x2D,0x20,0x74,0x61, // thex8(x=r0).-.ta END
+	0x6B,0x65,0x73,0x20,0x38,0x20,0x62,0x69,0x74,0x20,0x75,0x6E,0x73,0x69,0x67,0x6E, // kes.8.bit.unsign END
+	0x65,0x64,0x20,0x69,0x6E,0x74,0x20,0x61,0x6E,0x64,0x20,0x70,0x72,0x80,0x09,0x06, // ed.int.and.pr... END
+	0x73,0x20,0x61,0x73,0x20,0x32,0x20,0x80,0x35,0x04,0x20,0x64,0x69,0x67,0x69,0x80, // s.as.2..5..digi. END
+	0x0F,0x11,0x74,0x6F,0x20,0x73,0x74,0x64,0x6F,0x75,0x74,0x0A,0x6C,0x61,0x62,0x65, // ..to.stdout.labe END
+	0x6C,0x20,0x70,0x75,0x82,0x53,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72, // l.pu.S..mov.r1.r END
+	0x30,0x83,0x09,0x04,0x30,0x20,0x46,0x64,0x53,0x83,0x27,0x04,0x6A,0x6D,0x70,0x20, // 0...0.FdS.'.jmp. END
+	0x66,0x85,0x26,0x01,0x0A,0x3B,0x86,0x0B,0x02,0x28,0x66,0x64,0x80,0x87,0x01,0x2C, // f.&..;...(fd..., END
+	0x20,0x80,0x8D,0x00,0x31,0xB8,0x8D,0x07,0x67,0x69,0x76,0x65,0x6E,0x20,0x66,0x64, // ....1...given.fd END
+	0x84,0x8F,0x86,0x69,0x00,0x3B,0x83,0xB1,0x07,0x20,0x31,0x0A,0x70,0x75,0x73,0x68, // ...i.;....1.push END
+	0x38,0x81,0x99,0x01,0x70,0x75,0x12,0x73,0x68,0x38,0x20,0x72,0x31,0x0A,0x6D,0x6F, // 8...pu.sh8.r1.mo END
+	0x76,0x20,0x72,0x32,0x20,0x34,0x0A,0x73,0x68,0x72,0x80,0x0F,0x82,0x02,0x00,0x32, // v.r2.4.shr.....2 END
+	0x85,0x15,0x05,0x31,0x35,0x0A,0x61,0x6E,0x64,0x87,0x16,0x14,0x63,0x61,0x6C,0x6C, // ...15.and...call END
+	0x20,0x66,0x70,0x75,0x74,0x68,0x65,0x78,0x64,0x69,0x67,0x69,0x74,0x0A,0x70,0x6F, // .fputhexdigit.po END
+	0x70,0x82,0x46,0x83,0x07,0x03,0x30,0x0A,0x3B,0x20,0x82,0x17,0x00,0x20,0xA8,0x42, // p.F...0.;......B END
+	0x03,0x72,0x65,0x74,0x0A,0x80,0x37,0x89,0x56,0x07,0x28,0x66,0x64,0x3D,0x72,0x30, // .ret..7.V.(fd=r0 END
+	0x2C,0x20,0x80,0x05,0x0D,0x31,0x29,0x20,0x2D,0x20,0x74,0x61,0x6B,0x65,0x73,0x20, // ,....1).-.takes. END
+	0x34,0x20,0x62,0x80,0x59,0x05,0x76,0x61,0x6C,0x75,0x65,0x20,0x81,0x96,0x09,0x70, // 4.b.Y.value....p END
+	0x72,0x69,0x6E,0x74,0x73,0x20,0x61,0x73,0x20,0x80,0x8E,0x1A,0x20,0x63,0x68,0x61, // rints.as.....cha END
+	0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x74,0x6F,0x20,0x67,0x69,0x76,0x65,0x6E,0x20, // racter.to.given. END
+	0x66,0x64,0x0A,0x6C,0x61,0x62,0x65,0x8C,0xB2,0x82,0xF1,0x01,0x33,0x20,0x0B,0x31, // fd.labe.....3..1 END
+	0x30,0x0A,0x63,0x6D,0x70,0x20,0x72,0x33,0x20,0x72,0x31,0x80,0x05,0x0E,0x0A,0x6D, // 0.cmp.r3.r1....m END
+	0x6F,0x76,0x20,0x72,0x32,0x20,0x27,0x30,0x27,0x0A,0x61,0x64,0x64,0x82,0x14,0x80, // ov.r2.'0'.add... END
+	0x17,0x07,0x32,0x0A,0x73,0x6B,0x69,0x70,0x6C,0x74,0x81,0x21,0x03,0x69,0x6E,0x63, // ..2.skiplt.!.inc END
+	0x37,0x80,0x2C,0x11,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x66,0x70,0x75,0x74,0x63,0x30, // 7.,..call.fputc0 END
+	0x0A,0x72,0x65,0x74,0x0A,0xFF,0xB2,0x00,0x14,0x0E,0x71,0x3A,0x66,0x67,0x65,0x74, // .ret......q:fget END
+	0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02, // .s.require.../.. END
+	0x02,0x73,0x79,0x73,0x81,0x03,0x81,0x64,0x02,0x2E,0x73,0x0A,0x80,0x60,0x82,0x1C, // .sys...d..s..`.. END
+	0x02,0x65,0x6E,0x64,0x81,0x1F,0x04,0x69,0x6E,0x74,0x33,0x32,0x83,0x05,0x80,0xA4, // .end...int32.... END
+	0x80,0x1F,0x96,0x1E,0x00,0x73,0x81,0x5A,0x04,0x0A,0x0A,0x61,0x77,0x20,0x81,0x65, // .....s.Z...aw..e END
+	0x12,0x73,0x33,0x32,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x6E,0x74,0x20,0x32, // .s32ScratchInt.2 END
+	0x0A,0x0A,0x3B,0x20,0x18,0x72,0x3D,0x67,0x65,0x74,0x73,0x30,0x28,0x62,0x75,0x66, // ..;..r=gets0(buf END
+	0x3D,0x72,0x30,0x2C,0x20,0x6C,0x65,0x6E,0x3D,0x72,0x31,0x29,0x3D,0x66,0x81,0x16, // =r0,.len=r1)=f.. END
+	0x07,0x28,0x73,0x74,0x64,0x69,0x6E,0x2C,0x20,0x80,0x17,0x80,0x1F,0x82,0x1C,0x07, // .(stdin,........ END
+	0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x82,0x35,0x18,0x0A,0x3B,0x20,0x50,0x72, // ).label..5..;.Pr END
+	0x65,0x70,0x61,0x72,0x65,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x73,0x20, // epare.registers. END
+	0x66,0x6F,0x72,0x20,0x82,0x3D,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x72, // for..=..mov.r2.r END
+	0x30,0x83,0x09,0x03,0x33,0x20,0x72,0x31,0x83,0x13,0x04,0x30,0x20,0x46,0x64,0x53, // 0...3.r1...0.FdS END
+	0x81,0x5A,0x83,0x22,0x01,0x31,0x20,0x81,0x49,0x06,0x4A,0x75,0x6D,0x70,0x20,0x74, // .Z.".1..I.Jump.t END
+	0x6F,0x83,0x3B,0x81,0x08,0x14,0x64,0x6F,0x20,0x6D,0x6F,0x73,0x74,0x20,0x6F,0x66, // o.;...do.most.of END
+	0x20,0x74,0x68,0x65,0x20,0x77,0x6F,0x72,0x6B,0x0A,0x6A,0x80,0x23,0x83,0x20,0x00, // .the.work.j.#... END
+	0x3B,0x80,0x72,0x03,0x74,0x20,0x69,0x6E,0x84,0x2F,0x03,0x77,0x69,0x6C,0x6C,0x81, // ;.r.t.in./.will. END
+	0x11,0x10,0x75,0x72,0x6E,0x20,0x75,0x73,0x20,0x63,0x6F,0x72,0x72,0x65,0x63,0x74, // ..urn.us.correct END
+	0x6C,0x79,0x0A,0x80,0xA3,0x00,0x72,0x84,0xCD,0x01,0x66,0x64,0x82,0xE2,0x05,0x6F, // ly....r...fd...o END
+	0x66,0x66,0x73,0x65,0x74,0x80,0xE5,0x81,0xD5,0x5D,0x66,0x3D,0x72,0x32,0x2C,0x20, // ffset....]f=r2,. END
+	0x6C,0x65,0x6E,0x3D,0x72,0x33,0x29,0x20,0x72,0x65,0x61,0x64,0x73,0x20,0x75,0x70, // len=r3).reads.up END
+	0x20,0x74,0x6F,0x20,0x61,0x6E,0x64,0x20,0x69,0x6E,0x63,0x6C,0x75,0x64,0x69,0x6E, // .to.and.includin END
+	0x67,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x6E,0x65,0x77,0x6C,0x69,0x6E,0x65,0x2C, // g.first.newline, END
+	0x20,0x61,0x6C,0x77,0x61,0x79,0x73,0x20,0x6E,0x75,0x6C,0x6C,0x2D,0x74,0x65,0x72, // .always.null-ter END
+	0x6D,0x69,0x6E,0x61,0x74,0x65,0x73,0x20,0x62,0x75,0x66,0x20,0x28,0x70,0x6F,0x74, // minates.buf.(pot END
+	0x65,0x6E,0x74,0x69,0x61,0x6C,0x6C,0x79,0x81,0x47,0x03,0x62,0x65,0x20,0x30,0x81, // entially.G.be.0. END
+	0x60,0x0F,0x67,0x74,0x68,0x20,0x69,0x66,0x20,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E, // `.gth.if.could.n END
+	0x6F,0x74,0x82,0x6C,0x01,0x29,0x2C,0x80,0x73,0x03,0x74,0x75,0x72,0x6E,0x81,0x4B, // ot.l.),.s.turn.K END
+	0x09,0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x62,0x79,0x81,0x4B,0x81,0x8B,0x04, // .mber.of.by.K... END
+	0x20,0x66,0x72,0x6F,0x6D,0x80,0x7B,0x11,0x6C,0x65,0x0A,0x3B,0x20,0x54,0x4F,0x44, // .from.{.le.;.TOD END
+	0x4F,0x3A,0x20,0x53,0x75,0x70,0x70,0x6F,0x72,0x74,0x85,0x51,0x04,0x6C,0x69,0x6D, // O:.Support.Q.lim END
+	0x69,0x74,0x83,0x26,0x0D,0x72,0x33,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x66,0x67, // it.&.r3.label.fg END
+	0x65,0x74,0x73,0x80,0x30,0x01,0x49,0x6E,0x80,0x1A,0x0F,0x2D,0x20,0x6D,0x6F,0x76, // ets.0.In...-.mov END
+	0x65,0x20,0x73,0x6F,0x6D,0x65,0x20,0x76,0x61,0x6C,0x75,0x80,0xA5,0x03,0x61,0x72, // e.some.valu...ar END
+	0x6F,0x75,0x80,0xDC,0x80,0xE3,0x01,0x6D,0x61,0x2E,0x74,0x63,0x68,0x20,0x72,0x65, // ou.....ma.tch.re END
+	0x61,0x64,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x20,0x62,0x65,0x74,0x74,0x65, // ad.syscall.bette END
+	0x72,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x32,0x20,0x3B,0x20,0x73,0x61, // r.push16.r2.;.sa END
+	0x76,0x65,0x20,0x69,0x6E,0x69,0x74,0x69,0x61,0x80,0x1F,0x09,0x75,0x66,0x66,0x65, // ve.initia...uffe END
+	0x72,0x20,0x70,0x6F,0x69,0x6E,0x80,0x27,0x0B,0x20,0x66,0x6F,0x72,0x20,0x6C,0x65, // r.poin.'..for.le END
+	0x6E,0x67,0x74,0x68,0x20,0x80,0x3E,0x08,0x63,0x75,0x6C,0x61,0x74,0x69,0x6F,0x6E, // ngth..>.culation END
+	0x20,0x80,0x06,0x80,0x44,0x05,0x6D,0x6F,0x76,0x20,0x72,0x33,0x83,0x44,0x80,0x0B, // ....D.mov.r3.D.. END
+	0x00,0x65,0x85,0x3C,0x80,0x3A,0x00,0x6F,0x81,0x18,0x81,0x3C,0x89,0x7C,0x83,0x30, // .e.<.:.o...<.|.0 END
+	0x03,0x32,0x20,0x72,0x31,0x85,0x30,0x05,0x6F,0x66,0x66,0x73,0x65,0x74,0x84,0x30, // .2.r1.0.offset.0 END
+	0x00,0x32,0x94,0x30,0x03,0x31,0x20,0x72,0x30,0x85,0x61,0x01,0x66,0x64,0x84,0x5D, // .2.0.1.r0.a.fd.] END
+	0x00,0x31,0x8F,0x5D,0x06,0x3B,0x20,0x53,0x74,0x61,0x72,0x74,0x80,0x54,0x82,0xF2, // .1.].;.Start.T.. END
+	0x04,0x69,0x6E,0x67,0x20,0x6C,0x0F,0x6F,0x6F,0x70,0x0A,0x6C,0x61,0x62,0x65,0x6C, // .ing.l.oop.label END
+	0x20,0x66,0x67,0x65,0x74,0x73,0x4C,0x80,0x0F,0x24,0x53,0x74,0x61,0x72,0x74,0x0A, // .fgetsL..$Start. END
+	0x3B,0x20,0x52,0x65,0x61,0x64,0x20,0x73,0x69,0x6E,0x67,0x6C,0x65,0x20,0x63,0x68, // ;.Read.single.ch END
+	0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x69,0x6E,0x74,0x6F,0x20,0x75,0x73,0x80, // aracter.into.us. END
+	0x09,0x1F,0x70,0x72,0x6F,0x76,0x69,0x64,0x65,0x64,0x20,0x62,0x75,0x66,0x66,0x65, // ..provided.buffe END
+	0x72,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C, // r.mov.r0.Syscall END
+	0x49,0x64,0x81,0x3F,0x83,0x14,0x04,0x34,0x20,0x31,0x0A,0x73,0x83,0x16,0x80,0x57, // Id.?...4.1.s...W END
+	0x16,0x43,0x68,0x65,0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x66,0x61,0x69,0x6C,0x75, // .Check.for.failu END
+	0x72,0x65,0x20,0x28,0x6E,0x6F,0x74,0x65,0x81,0x3B,0x0D,0x63,0x61,0x6E,0x20,0x6F, // re.(note.;.can.o END
+	0x6E,0x6C,0x79,0x20,0x62,0x65,0x20,0x30,0x20,0x80,0x21,0x03,0x31,0x20,0x73,0x6F, // nly.be.0..!.1.so END
+	0x82,0x15,0x03,0x73,0x69,0x6D,0x70,0x80,0x17,0x18,0x69,0x6E,0x73,0x70,0x65,0x63, // ...simp...inspec END
+	0x74,0x20,0x6C,0x6F,0x77,0x65,0x73,0x74,0x20,0x62,0x69,0x74,0x29,0x0A,0x73,0x6B, // t.lowest.bit).sk END
+	0x69,0x70,0x30,0x80,0x79,0x03,0x0A,0x6A,0x6D,0x70,0x87,0xC5,0x02,0x45,0x6E,0x64, // ip0.y..jmp...End END
+	0x8A,0x6B,0x0C,0x6E,0x65,0x77,0x6C,0x69,0x6E,0x65,0x0A,0x6C,0x6F,0x61,0x64,0x38, // .k.newline.load8 END
+	0x81,0x92,0x05,0x72,0x33,0x0A,0x69,0x6E,0x63,0x13,0x20,0x72,0x33,0x20,0x3B,0x20, // ...r3.inc..r3.;. END
+	0x77,0x65,0x20,0x63,0x61,0x6E,0x20,0x61,0x64,0x76,0x61,0x6E,0x63,0x65,0x81,0x13, // we.can.advance.. END
+	0x05,0x6E,0x6F,0x77,0x20,0x61,0x73,0x81,0x18,0x1B,0x77,0x69,0x6C,0x6C,0x20,0x6E, // .now.as...will.n END
+	0x65,0x65,0x64,0x20,0x74,0x6F,0x20,0x64,0x6F,0x20,0x69,0x74,0x20,0x69,0x6E,0x20, // eed.to.do.it.in. END
+	0x65,0x69,0x74,0x68,0x65,0x72,0x80,0x35,0x11,0x73,0x65,0x0A,0x6D,0x6F,0x76,0x20, // either.5.se.mov. END
+	0x72,0x30,0x20,0x27,0x5C,0x6E,0x27,0x0A,0x63,0x6D,0x70,0x81,0x0B,0x01,0x72,0x34, // r0.'\n'.cmp...r4 END
+	0x80,0x11,0x07,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x81,0x0A,0x00,0x6A,0x80, // ....skipneq...j. END
+	0x17,0x10,0x66,0x67,0x65,0x74,0x73,0x4C,0x6F,0x6F,0x70,0x45,0x6E,0x64,0x0A,0x3B, // ..fgetsLoopEnd.; END
+	0x20,0x4E,0x6F,0x80,0x56,0x11,0x77,0x6C,0x69,0x6E,0x65,0x2C,0x20,0x70,0x72,0x65, // .No.V.wline,.pre END
+	0x70,0x61,0x72,0x65,0x20,0x66,0x6F,0x72,0x80,0x6B,0x00,0x78,0x80,0x62,0x0E,0x74, // pare.for.k.x.b.t END
+	0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x0A,0x69,0x6E,0x63,0x20,0x72,0x32,0x80,0xA4, // eration.inc.r2.. END
+	0x82,0x08,0x09,0x65,0x61,0x64,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x8B,0x52,0x04, // ...ead.offset.R. END
+	0x53,0x74,0x61,0x72,0x74,0x80,0x54,0x80,0x5A,0x80,0x1F,0x82,0x27,0x04,0x69,0x6E, // Start.T.Z...'.in END
+	0x67,0x20,0x6C,0x80,0x6D,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x8D,0x7D,0x06,0x41, // g.l.m..label.}.A END
+	0x64,0x64,0x20,0x6E,0x75,0x6C,0x16,0x6C,0x20,0x74,0x65,0x72,0x6D,0x69,0x6E,0x61, // dd.nul.l.termina END
+	0x74,0x6F,0x72,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x30,0x0A,0x73,0x80,0x0D, // tor.mov.r0.0.s.. END
+	0x04,0x65,0x38,0x20,0x72,0x33,0x80,0x0E,0x1B,0x0A,0x3B,0x20,0x52,0x65,0x74,0x75, // .e8.r3....;.Retu END
+	0x72,0x6E,0x20,0x6C,0x65,0x6E,0x67,0x74,0x68,0x0A,0x70,0x6F,0x70,0x31,0x36,0x20, // rn.length.pop16. END
+	0x72,0x34,0x20,0x3B,0x20,0x80,0x0A,0x04,0x20,0x6F,0x72,0x69,0x67,0x80,0x3F,0x07, // r4.;.....orig.?. END
+	0x6C,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x80,0x13,0x01,0x69,0x6E,0x80,0x53,0x0E, // l.buffer...in.S. END
+	0x20,0x66,0x72,0x6F,0x6D,0x20,0x73,0x74,0x61,0x63,0x6B,0x0A,0x73,0x75,0x62,0x81, // .from.stack.sub. END
+	0x57,0x81,0x4E,0x81,0x35,0x80,0x0E,0x04,0x74,0x72,0x61,0x63,0x74,0x87,0x3A,0x82, // W.N.5...tract.:. END
+	0x2B,0x0B,0x63,0x75,0x72,0x72,0x65,0x6E,0x74,0x0A,0x72,0x65,0x74,0x0A,0x80,0x74, // +.current.ret..t END
+	0x1D,0x72,0x3D,0x66,0x67,0x65,0x74,0x73,0x33,0x32,0x28,0x66,0x64,0x3D,0x72,0x30, // .r=fgets32(fd=r0 END
+	0x2C,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x50,0x74,0x72,0x3D,0x72,0x31,0x2C,0x81, // ,.offsetPtr=r1,. END
+	0x6D,0x03,0x3D,0x72,0x32,0x2C,0x81,0x94,0x3B,0x3D,0x72,0x33,0x29,0x20,0x72,0x65, // m.=r2,..;=r3).re END
+	0x61,0x64,0x73,0x20,0x75,0x70,0x20,0x74,0x6F,0x20,0x61,0x6E,0x64,0x20,0x69,0x6E, // ads.up.to.and.in END
+	0x63,0x6C,0x75,0x64,0x69,0x6E,0x67,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x6E,0x65, // cluding.first.ne END
+	0x77,0x6C,0x69,0x6E,0x65,0x2C,0x20,0x61,0x6C,0x77,0x61,0x79,0x73,0x20,0x6E,0x75, // wline,.always.nu END
+	0x6C,0x6C,0x2D,0x74,0x65,0x3B,0x72,0x6D,0x69,0x6E,0x61,0x74,0x65,0x73,0x20,0x62, // ll-te;rminates.b END
+	0x75,0x66,0x20,0x28,0x70,0x6F,0x74,0x65,0x6E,0x74,0x69,0x61,0x6C,0x6C,0x79,0x20, // uf.(potentially. END
+	0x74,0x6F,0x20,0x62,0x65,0x20,0x30,0x20,0x6C,0x65,0x6E,0x67,0x74,0x68,0x20,0x69, // to.be.0.length.i END
+	0x66,0x20,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x72,0x65,0x61,0x64, // f.could.not.read END
+	0x29,0x2C,0x80,0x06,0x11,0x74,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65, // ),...turns.numbe END
+	0x72,0x20,0x6F,0x66,0x20,0x62,0x79,0x81,0x4B,0x81,0x1E,0x19,0x20,0x66,0x72,0x6F, // r.of.by.K....fro END
+	0x6D,0x20,0x66,0x69,0x6C,0x65,0x0A,0x3B,0x20,0x54,0x4F,0x44,0x4F,0x3A,0x20,0x53, // m.file.;.TODO:.S END
+	0x75,0x70,0x70,0x6F,0x72,0x74,0x85,0x51,0x04,0x6C,0x69,0x6D,0x69,0x74,0x83,0x26, // upport.Q.limit.& END
+	0x0F,0x72,0x33,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x66,0x67,0x65,0x74,0x73,0x33, // .r3.label.fgets3 END
+	0x32,0x80,0x32,0x01,0x49,0x6E,0x80,0x1C,0x00,0x2D,0x80,0x73,0x01,0x70,0x79,0x80, // 2.2.In...-.s.py. END
+	0x58,0x0C,0x66,0x73,0x65,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x69,0x6E,0x80, // X.fset.value.in. END
+	0x99,0x05,0x73,0x63,0x72,0x61,0x74,0x63,0x80,0x95,0x0A,0x6E,0x74,0x0A,0x70,0x75, // ..scratc...nt.pu END
+	0x73,0x68,0x38,0x20,0x72,0x30,0x82,0x08,0x04,0x31,0x36,0x20,0x72,0x32,0x86,0x09, // sh8.r0...16.r2.. END
+	0x04,0x33,0x0A,0x6D,0x6F,0x76,0x80,0x1A,0x85,0x57,0x00,0x53,0x83,0x36,0x00,0x49, // .3.mov...W.S.6.I END
+	0x80,0x35,0x00,0x63,0x80,0xE4,0x80,0x4B,0x04,0x74,0x33,0x32,0x73,0x65,0x80,0x04, // .5.c...K.t32se.. END
+	0x08,0x0A,0x70,0x6F,0x70,0x31,0x36,0x20,0x72,0x33,0x85,0x08,0x82,0x11,0x46,0x38, // ..pop16.r3....F8 END
+	0x20,0x72,0x30,0x0A,0x3B,0x20,0x49,0x6E,0x69,0x74,0x20,0x2D,0x20,0x6D,0x6F,0x76, // .r0.;.Init.-.mov END
+	0x65,0x20,0x73,0x6F,0x6D,0x65,0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x20,0x61,0x72, // e.some.values.ar END
+	0x6F,0x75,0x6E,0x64,0x20,0x74,0x6F,0x20,0x6D,0x61,0x74,0x63,0x68,0x20,0x72,0x65, // ound.to.match.re END
+	0x61,0x64,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x20,0x62,0x65,0x74,0x74,0x65, // ad.syscall.bette END
+	0x72,0x0A,0x70,0x75,0x73,0x68,0x82,0x4F,0x04,0x20,0x3B,0x20,0x73,0x61,0x80,0x40, // r.push.O..;.sa.@ END
+	0x00,0x69,0x80,0x4C,0x01,0x69,0x61,0x80,0x1F,0x09,0x75,0x66,0x66,0x65,0x72,0x20, // .i.L.ia...uffer. END
+	0x70,0x6F,0x69,0x6E,0x80,0x27,0x0B,0x20,0x66,0x6F,0x72,0x20,0x6C,0x65,0x6E,0x67, // poin.'..for.leng END
+	0x74,0x68,0x20,0x80,0x3E,0x08,0x63,0x75,0x6C,0x61,0x74,0x69,0x6F,0x6E,0x20,0x80, // th..>.culation.. END
+	0x06,0x80,0x44,0x80,0x79,0x80,0x9A,0x83,0x44,0x82,0x85,0x84,0x3C,0x80,0x3A,0x00, // ..D.y...D...<.:. END
+	0x6F,0x81,0x18,0x81,0x3C,0x89,0x7C,0x83,0x30,0x00,0x31,0x80,0xBD,0x85,0x30,0x01, // o...<.|.0.1...0. END
+	0x66,0x64,0x84,0x2C,0x00,0x31,0x8B,0x2C,0x29,0x61,0x6C,0x6C,0x0A,0x3B,0x20,0x53, // fd.,.1.,)all.;.S END
+	0x74,0x61,0x72,0x74,0x20,0x6F,0x66,0x20,0x72,0x65,0x61,0x64,0x69,0x6E,0x67,0x20, // tart.of.reading. END
+	0x6C,0x6F,0x6F,0x70,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x66,0x67,0x65,0x74,0x73, // loop.label.fgets END
+	0x33,0x32,0x4C,0x80,0x11,0x82,0x26,0x80,0x2E,0x00,0x52,0x80,0x25,0x01,0x20,0x73, // 32L...&...R.%..s END
+	0x80,0x27,0x13,0x6C,0x65,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20, // .'.le.character. END
+	0x69,0x6E,0x74,0x6F,0x20,0x75,0x73,0x80,0x09,0x1A,0x70,0x72,0x6F,0x76,0x69,0x64, // into.us...provid END
+	0x65,0x64,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30, // ed.buffer.mov.r0 END
+	0x20,0x53,0x79,0x73,0x63,0x80,0x6F,0x01,0x49,0x64,0x81,0x3F,0x01,0x33,0x32,0x83, // .Sysc.o.Id.?.32. END
+	0x16,0x00,0x32,0x85,0x60,0x09,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x49,0x6E,0x74, // ..2.`.ScratchInt END
+	0x83,0x2F,0x04,0x34,0x20,0x31,0x0A,0x73,0x83,0x31,0x80,0xA1,0x16,0x43,0x68,0x65, // ./.4.1.s.1...Che END
+	0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x66,0x61,0x69,0x6C,0x75,0x72,0x65,0x20,0x28, // ck.for.failure.( END
+	0x6E,0x6F,0x74,0x65,0x81,0x56,0x0D,0x63,0x61,0x6E,0x20,0x6F,0x6E,0x6C,0x79,0x20, // note.V.can.only. END
+	0x62,0x65,0x20,0x30,0x20,0x80,0x21,0x03,0x31,0x20,0x73,0x6F,0x82,0x15,0x03,0x73, // be.0..!.1.so...s END
+	0x69,0x6D,0x70,0x80,0x17,0x06,0x69,0x6E,0x73,0x70,0x65,0x63,0x74,0x80,0xD4,0x0E, // imp...inspect... END
+	0x77,0x65,0x73,0x74,0x20,0x62,0x69,0x74,0x29,0x0A,0x73,0x6B,0x69,0x70,0x30,0x80, // west.bit).skip0. END
+	0x94,0x36,0x0A,0x6A,0x6D,0x70,0x20,0x66,0x67,0x65,0x74,0x73,0x33,0x32,0x4C,0x6F, // .6.jmp.fgets32Lo END
+	0x6F,0x70,0x45,0x6E,0x64,0x0A,0x3B,0x20,0x43,0x68,0x65,0x63,0x6B,0x20,0x66,0x6F, // opEnd.;.Check.fo END
+	0x72,0x20,0x6E,0x65,0x77,0x6C,0x69,0x6E,0x65,0x0A,0x6C,0x6F,0x61,0x64,0x38,0x20, // r.newline.load8. END
+	0x72,0x34,0x20,0x72,0x33,0x0A,0x69,0x6E,0x63,0x80,0x06,0x10,0x20,0x3B,0x20,0x77, // r4.r3.inc....;.w END
+	0x65,0x20,0x63,0x61,0x6E,0x20,0x61,0x64,0x76,0x61,0x6E,0x63,0x65,0x81,0x13,0x05, // e.can.advance... END
+	0x6E,0x6F,0x77,0x20,0x61,0x73,0x81,0x18,0x03,0x77,0x69,0x6C,0x6C,0x80,0x3D,0x14, // now.as...will.=. END
+	0x65,0x64,0x20,0x74,0x6F,0x20,0x64,0x6F,0x20,0x69,0x74,0x20,0x69,0x6E,0x20,0x65, // ed.to.do.it.in.e END
+	0x69,0x74,0x68,0x65,0x72,0x80,0x35,0x0F,0x73,0x65,0x0A,0x6D,0x6F,0x76,0x20,0x72, // ither.5.se.mov.r END
+	0x30,0x20,0x27,0x5C,0x6E,0x27,0x0A,0x63,0x80,0x85,0x80,0x0B,0x81,0x5F,0x08,0x30, // 0.'\n'.c....._.0 END
+	0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x81,0x0A,0x92,0x9D,0x01,0x4E,0x6F,0x85, // .skipneq.....No. END
+	0x96,0x08,0x2C,0x20,0x70,0x72,0x65,0x70,0x61,0x72,0x65,0x84,0xAB,0x00,0x78,0x80, // ..,.prepare...x. END
+	0x64,0x0A,0x74,0x65,0x72,0x61,0x74,0x69,0x6F,0x6E,0x20,0x62,0x79,0x80,0x71,0x15, // d.teration.by.q. END
+	0x63,0x72,0x65,0x6D,0x65,0x6E,0x74,0x69,0x6E,0x67,0x20,0x6F,0x66,0x66,0x73,0x65, // crementing.offse END
+	0x74,0x0A,0x70,0x75,0x73,0x68,0x80,0xC9,0x00,0x31,0x82,0x08,0x00,0x31,0x09,0x36, // t.push...1...1.6 END
+	0x20,0x72,0x32,0x0A,0x70,0x75,0x73,0x68,0x31,0x80,0x09,0x2B,0x33,0x0A,0x6D,0x6F, // .r2.push1..+3.mo END
+	0x76,0x20,0x72,0x30,0x20,0x66,0x67,0x65,0x74,0x73,0x33,0x32,0x53,0x63,0x72,0x61, // v.r0.fgets32Scra END
+	0x74,0x63,0x68,0x49,0x6E,0x74,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x69,0x6E,0x74,0x33, // tchInt.call.int3 END
+	0x32,0x69,0x6E,0x63,0x0A,0x70,0x6F,0x70,0x83,0x2F,0x84,0x08,0x80,0x42,0x09,0x6F, // 2inc.pop./...B.o END
+	0x70,0x38,0x20,0x72,0x31,0x0A,0x6A,0x6D,0x70,0x85,0x3D,0x1B,0x4C,0x6F,0x6F,0x70, // p8.r1.jmp.=.Loop END
+	0x53,0x74,0x61,0x72,0x74,0x0A,0x3B,0x20,0x45,0x6E,0x64,0x20,0x6F,0x66,0x20,0x72, // Start.;.End.of.r END
+	0x65,0x61,0x64,0x69,0x6E,0x67,0x20,0x6C,0x80,0x1A,0x05,0x0A,0x6C,0x61,0x62,0x65, // eading.l....labe END
+	0x6C,0x89,0x2C,0x80,0x24,0x80,0x2A,0x05,0x41,0x64,0x64,0x20,0x6E,0x75,0x80,0x6D, // l.,.$.*.Add.nu.m END
+	0x09,0x74,0x65,0x72,0x6D,0x69,0x6E,0x61,0x74,0x6F,0x72,0x85,0x96,0x02,0x30,0x0A, // .terminator...0. END
+	0x73,0x80,0x0D,0x00,0x65,0x80,0x68,0x00,0x33,0x80,0xA5,0x80,0x56,0x0C,0x52,0x65, // s...e.h.3...V.Re END
+	0x74,0x75,0x72,0x6E,0x20,0x6C,0x65,0x6E,0x67,0x74,0x68,0x85,0x95,0x03,0x34,0x20, // turn.length...4. END
+	0x3B,0x20,0x80,0xA0,0x04,0x20,0x6F,0x72,0x69,0x67,0x80,0x3F,0x07,0x6C,0x20,0x62, // ;.....orig.?.l.b END
+	0x75,0x66,0x66,0x65,0x72,0x80,0x13,0x80,0xBF,0x80,0x07,0x0C,0x66,0x72,0x6F,0x6D, // uffer.......from END
+	0x20,0x73,0x74,0x61,0x63,0x6B,0x0A,0x73,0x75,0x31,0x62,0x20,0x72,0x30,0x20,0x72, // .stack.su1b.r0.r END
+	0x33,0x20,0x72,0x34,0x20,0x3B,0x20,0x73,0x75,0x62,0x74,0x72,0x61,0x63,0x74,0x20, // 3.r4.;.subtract. END
+	0x6F,0x72,0x69,0x67,0x69,0x6E,0x61,0x6C,0x20,0x66,0x72,0x6F,0x6D,0x20,0x63,0x75, // original.from.cu END
+	0x72,0x72,0x65,0x6E,0x74,0x0A,0x72,0x65,0x74,0x0A,0x0A,0x3B,0x80,0x30,0x19,0x3D, // rrent.ret..;.0.= END
+	0x66,0x67,0x65,0x74,0x63,0x28,0x66,0x64,0x3D,0x72,0x30,0x2C,0x20,0x6F,0x66,0x66, // fgetc(fd=r0,.off END
+	0x73,0x65,0x74,0x3D,0x72,0x31,0x29,0x2C,0x20,0x80,0x22,0x17,0x75,0x72,0x6E,0x73, // set=r1),..".urns END
+	0x20,0x32,0x35,0x36,0x20,0x6F,0x6E,0x20,0x66,0x61,0x69,0x6C,0x75,0x72,0x65,0x0A, // .256.on.failure. END
+	0x6C,0x61,0x62,0x65,0x80,0x4C,0x81,0x35,0x81,0x40,0x0D,0x65,0x61,0x64,0x20,0x73, // labe.L.5.@.ead.s END
+	0x69,0x6E,0x67,0x6C,0x65,0x20,0x63,0x68,0x61,0x81,0x71,0x01,0x65,0x72,0x80,0x2E, // ingle.cha.q.er.. END
+	0x11,0x74,0x6F,0x20,0x73,0x74,0x61,0x63,0x6B,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32, // .to.stack.mov.r2 END
+	0x20,0x72,0x31,0x83,0x09,0x00,0x31,0x80,0xA3,0x83,0x13,0x0B,0x30,0x20,0x53,0x79, // .r1...1.....0.Sy END
+	0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x52,0x80,0x44,0x83,0x28,0x80,0xBC,0x04,0x36, // scallIdR.D.(...6 END
+	0x0A,0x69,0x6E,0x63,0x81,0x06,0x82,0x39,0x04,0x34,0x20,0x31,0x0A,0x73,0x83,0x27, // .inc...9.4.1.s.' END
+	0x80,0xAE,0x08,0x63,0x68,0x65,0x63,0x6B,0x20,0x66,0x6F,0x72,0x86,0x8D,0x02,0x63, // ...check.for...c END
+	0x6D,0x70,0x82,0xF5,0x81,0x02,0x29,0x0A,0x73,0x6B,0x69,0x70,0x65,0x71,0x7A,0x20, // mp....).skipeqz. END
+	0x72,0x30,0x0A,0x6A,0x6D,0x70,0x20,0x66,0x67,0x65,0x74,0x63,0x44,0x6F,0x6E,0x65, // r0.jmp.fgetcDone END
+	0x0A,0x3B,0x20,0x66,0x61,0x69,0x6C,0x65,0x64,0x0A,0x64,0x65,0x63,0x20,0x72,0x36, // .;.failed.dec.r6 END
+	0x20,0x80,0x0F,0x0B,0x69,0x78,0x20,0x73,0x74,0x61,0x63,0x6B,0x0A,0x6D,0x6F,0x76, // ....ix.stack.mov END
+	0x80,0x30,0x07,0x20,0x32,0x35,0x36,0x0A,0x72,0x65,0x74,0x80,0x2A,0x0C,0x73,0x75, // .0..256.ret.*.su END
+	0x63,0x63,0x65,0x73,0x73,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88,0x44,0x03,0x70,0x6F, // ccess.label.D.po END
+	0x70,0x38,0x81,0x29,0x01,0x3B,0x20,0x80,0x09,0x12,0x20,0x72,0x65,0x61,0x64,0x20, // p8.).;.....read. END
+	0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x6F,0x66,0x66,0x84,0x4F,0x81, // character.off.O. END
+	0x44,0x80,0x70,0x02,0x72,0x30,0x3D,0x82,0x7F,0x08,0x33,0x32,0x28,0x66,0x64,0x3D, // D.p.r0=...32(fd= END
+	0x72,0x30,0x2C,0x81,0x22,0x0A,0x73,0x65,0x74,0x50,0x74,0x72,0x3D,0x72,0x31,0x29, // r0,.".setPtr=r1) END
+	0x2C,0x80,0x40,0x04,0x74,0x75,0x72,0x6E,0x73,0x81,0x78,0x02,0x20,0x6F,0x6E,0x82, // ,.@.turns.x..on. END
+	0xA0,0x02,0x75,0x72,0x65,0x89,0x75,0x01,0x33,0x32,0x81,0x47,0x81,0x67,0x05,0x73, // ..ure.u.32.G.g.s END
+	0x69,0x6E,0x67,0x6C,0x65,0x89,0x6E,0x02,0x6E,0x74,0x6F,0x89,0xBF,0x04,0x32,0x20, // ingle.n.nto...2. END
+	0x72,0x31,0x0A,0x09,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x0A,0x82,0x09, // r1..mov.r1.r0... END
+	0x10,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x52,0x65,0x61,0x64, // .0.SyscallIdRead END
+	0x33,0x32,0x83,0x16,0x07,0x33,0x20,0x72,0x36,0x0A,0x69,0x6E,0x63,0x81,0x06,0x82, // 32...3.r6.inc... END
+	0x31,0x04,0x34,0x20,0x31,0x0A,0x73,0x83,0x29,0x17,0x0A,0x3B,0x20,0x63,0x68,0x65, // 1.4.1.s.)..;.che END
+	0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x66,0x61,0x69,0x6C,0x75,0x72,0x65,0x0A,0x63, // ck.for.failure.c END
+	0x6D,0x70,0x81,0x4C,0x82,0x02,0x07,0x0A,0x73,0x6B,0x69,0x70,0x65,0x71,0x7A,0x81, // mp.L....skipeqz. END
+	0x64,0x00,0x6A,0x80,0x17,0x0A,0x66,0x67,0x65,0x74,0x63,0x33,0x32,0x44,0x6F,0x6E, // d.j...fgetc32Don END
+	0x65,0x80,0x3B,0x81,0x31,0x04,0x65,0x64,0x0A,0x64,0x65,0x81,0x5C,0x00,0x20,0x80, // e.;.1.ed.de.\... END
+	0x0F,0x07,0x69,0x78,0x20,0x73,0x74,0x61,0x63,0x6B,0x85,0x90,0x06,0x32,0x35,0x36, // ..ix.stack...256 END
+	0x0A,0x72,0x65,0x74,0x80,0x66,0x0C,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x0A,0x6C, // .ret.f.success.l END
+	0x61,0x62,0x65,0x6C,0x8A,0x46,0x03,0x70,0x6F,0x70,0x38,0x81,0xBC,0x01,0x3B,0x20, // abel.F.pop8...;. END
+	0x80,0x09,0x01,0x20,0x72,0x80,0xB9,0x80,0x93,0x0A,0x61,0x72,0x61,0x63,0x74,0x65, // ....r.....aracte END
+	0x72,0x20,0x6F,0x66,0x66,0x84,0x51,0x81,0x46,0x00,0xFF,0x8B,0x00,0x18,0x00,0x9F, // r.off.Q.F....... END
+	0x03,0x69,0x6F,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x66,0x63, // .io.s.require.fc END
+	0x6C,0x6F,0x73,0x65,0x2E,0x73,0x0A,0x86,0x10,0x04,0x66,0x6C,0x75,0x73,0x68,0x89, // lose.s....flush. END
+	0x10,0x02,0x67,0x65,0x74,0x89,0x1F,0x03,0x6F,0x70,0x65,0x6E,0x89,0x2F,0x01,0x70, // ..get...open./.p END
+	0x75,0x8A,0x1E,0x80,0x0E,0x02,0x64,0x65,0x63,0x8C,0x20,0x02,0x68,0x65,0x78,0x8C, // u.....dec...hex. END
+	0x32,0x02,0x74,0x69,0x6D,0x8A,0x75,0x03,0x72,0x65,0x61,0x64,0x80,0x85,0x00,0xFF, // 2.tim.u.read.... END
+	0x9D,0x00,0x02,0x01,0xEF,0x08,0x84,0x2B,0x86,0xC2,0x02,0x2E,0x2E,0x2F,0x80,0x02, // .......+...../.. END
+	0x02,0x73,0x79,0x73,0x81,0x03,0x03,0x63,0x61,0x6C,0x6C,0x80,0xCD,0x02,0x0A,0x3B, // .sys...call....; END
+	0x20,0x81,0x51,0x05,0x43,0x6F,0x75,0x6E,0x74,0x3D,0x82,0x5C,0x06,0x28,0x66,0x64, // ..Q.Count=.\.(fd END
+	0x3D,0x72,0x30,0x2C,0x12,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x3D,0x72,0x31,0x2C, // =r0,..offset=r1, END
+	0x20,0x64,0x61,0x74,0x61,0x3D,0x72,0x32,0x83,0x08,0x16,0x4C,0x65,0x6E,0x3D,0x72, // .data=r2...Len=r END
+	0x33,0x29,0x20,0x2D,0x20,0x70,0x6C,0x61,0x63,0x65,0x73,0x20,0x6E,0x75,0x6D,0x62, // 3).-.places.numb END
+	0x65,0x72,0x80,0x2F,0x03,0x20,0x62,0x79,0x74,0x80,0x0F,0x13,0x72,0x65,0x61,0x64, // er./..byt...read END
+	0x20,0x69,0x6E,0x74,0x6F,0x20,0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x66, // .into.r0.label.f END
+	0x81,0x13,0x05,0x0A,0x3B,0x20,0x55,0x73,0x65,0x83,0x1E,0x10,0x73,0x79,0x73,0x63, // ....;.Use...sysc END
+	0x61,0x6C,0x6C,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x34,0x20,0x72,0x33,0x83,0x09,0x03, // all.mov.r4.r3... END
+	0x33,0x20,0x72,0x32,0x83,0x13,0x03,0x32,0x20,0x72,0x31,0x83,0x1D,0x00,0x31,0x81, // 3.r2...2.r1...1. END
+	0x46,0x82,0x27,0x02,0x30,0x20,0x53,0x83,0x36,0x02,0x49,0x64,0x52,0x81,0x4F,0x85, // F.'.0.S.6.IdR.O. END
+	0x44,0x03,0x72,0x65,0x74,0x0A,0x80,0x5C,0x81,0x77,0x05,0x43,0x6F,0x75,0x6E,0x74, // D.ret..\.w.Count END
+	0x3D,0x82,0x6E,0x08,0x33,0x32,0x28,0x66,0x64,0x3D,0x72,0x30,0x2C,0x84,0xC9,0x02, // =.n.32(fd=r0,... END
+	0x50,0x74,0x72,0x95,0xCC,0x80,0xCB,0x06,0x76,0x65,0x72,0x73,0x69,0x6F,0x6E,0x81, // Ptr.....version. END
+	0xC5,0x82,0xAC,0x00,0x20,0x29,0x77,0x69,0x74,0x68,0x20,0x33,0x32,0x20,0x62,0x69, // .....)with.32.bi END
+	0x74,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x20,0x61,0x72,0x67,0x75,0x6D,0x65,0x6E, // t.offset.argumen END
+	0x74,0x2C,0x20,0x70,0x6C,0x61,0x63,0x65,0x73,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72, // t,.places.number END
+	0x80,0x1E,0x03,0x20,0x62,0x79,0x74,0x80,0x0F,0x13,0x72,0x65,0x61,0x64,0x20,0x69, // ....byt...read.i END
+	0x6E,0x74,0x6F,0x20,0x72,0x30,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x66,0x81,0x13, // nto.r0.label.f.. END
+	0x07,0x33,0x32,0x0A,0x3B,0x20,0x55,0x73,0x65,0x82,0x20,0x80,0x53,0x10,0x73,0x79, // .32.;.Use...S.sy END
+	0x73,0x63,0x61,0x6C,0x6C,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x34,0x20,0x72,0x33,0x83, // scall.mov.r4.r3. END
+	0x09,0x03,0x33,0x20,0x72,0x32,0x83,0x13,0x03,0x32,0x20,0x72,0x31,0x83,0x1D,0x00, // ..3.r2...2.r1... END
+	0x31,0x81,0x4A,0x82,0x27,0x02,0x30,0x20,0x53,0x83,0x36,0x02,0x49,0x64,0x52,0x83, // 1.J.'.0.S.6.IdR. END
+	0x53,0x85,0x46,0x04,0x72,0x65,0x74,0x0A,0xFF,0x8D,0x00,0x16,0x00,0xE9,0x04,0x66, // S.F.ret........f END
+	0x66,0x6C,0x75,0x73,0x68,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20, // flush.s.require. END
+	0x2E,0x2E,0x2F,0x80,0x02,0x80,0x7D,0x81,0x03,0x81,0x81,0x02,0x2E,0x73,0x0A,0x80, // ../...}......s.. END
+	0x99,0x06,0x72,0x65,0x73,0x75,0x6C,0x74,0x3D,0x83,0x2E,0x07,0x28,0x70,0x61,0x74, // ..result=...(pat END
+	0x68,0x3D,0x72,0x30,0x14,0x29,0x20,0x2D,0x20,0x66,0x6C,0x75,0x73,0x68,0x65,0x73, // h=r0.).-.flushes END
+	0x20,0x61,0x6E,0x79,0x20,0x63,0x68,0x61,0x6E,0x67,0x80,0x0B,0x4A,0x74,0x6F,0x20, // .any.chang..Jto. END
+	0x66,0x69,0x6C,0x65,0x2F,0x64,0x69,0x72,0x65,0x63,0x74,0x6F,0x72,0x79,0x20,0x61, // file/directory.a END
+	0x74,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x70,0x61,0x74,0x68,0x2C,0x20,0x72,0x65, // t.given.path,.re END
+	0x74,0x75,0x72,0x6E,0x69,0x6E,0x67,0x20,0x31,0x2F,0x30,0x20,0x69,0x6E,0x20,0x72, // turning.1/0.in.r END
+	0x30,0x20,0x66,0x6F,0x72,0x20,0x74,0x72,0x75,0x65,0x2F,0x66,0x61,0x6C,0x73,0x65, // 0.for.true/false END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x66,0x82,0x5E,0x05,0x0A,0x3B,0x20,0x55,0x73, // .label.f.^..;.Us END
+	0x65,0x83,0x6A,0x0E,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x0A,0x6D,0x6F,0x76, // e.j..syscall.mov END
+	0x20,0x72,0x31,0x80,0x39,0x83,0x09,0x02,0x30,0x20,0x53,0x83,0x18,0x02,0x49,0x64, // .r1.9...0.S...Id END
+	0x46,0x82,0x33,0x85,0x27,0x80,0x6B,0x01,0x0A,0xFF,0x93,0x00};
+#endif
@@ -0,0 +1,49 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_std_math_H
+#define PROGMEM_lib_std_math_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_std_mathDATASIZE 484u
+#define PROGMEM_lib_std_mathCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_std_mathDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_std_mathData))
+static const uint8_t progmem_lib_std_mathData[PROGMEM_lib_std_mathDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_std_mathDATAPTR ((uintptr_t)progmem_lib_std_mathData)
+static const uint8_t progmem_lib_std_mathData[PROGMEM_lib_std_mathDATASIZE]={
+#endif
+	0x5A,0x02,0xA0,0x00,0x0B,0x00,0x7C,0x01,0x5E,0x01,0xE4,0x06,0x22,0xA7,0x20,0x2D, // Z.....|.^..."..- END
+	0x79,0x8E,0x00,0xF7,0x00,0x16,0x34,0x0D,0x6D,0x61,0x74,0x68,0x2E,0x73,0x00,0x72, // y.....4.math.s.r END
+	0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x61,0x62,0x73,0x2E,0x73,0x0A,0x85,0x0D,0x02, // equire.abs.s.... END
+	0x6C,0x6F,0x67,0x88,0x0D,0x02,0x6D,0x6F,0x64,0x80,0x1B,0x02,0x01,0x2F,0x4C,0x82, // log...mod..../L. END
+	0x16,0x05,0x00,0x3B,0x20,0x72,0x30,0x3D,0x80,0x21,0x15,0x32,0x28,0x72,0x30,0x29, // ...;.r0=.!.2(r0) END
+	0x20,0x2D,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x66,0x6C,0x6F,0x6F,0x72, // .-.returns.floor END
+	0x28,0x85,0x18,0x01,0x29,0x2C,0x84,0x18,0x08,0x69,0x6E,0x67,0x20,0x30,0x20,0x66, // (...),...ing.0.f END
+	0x6F,0x72,0x81,0x36,0x06,0x30,0x20,0x61,0x73,0x20,0x61,0x20,0x3D,0x73,0x70,0x65, // or.6.0.as.a.=spe END
+	0x63,0x69,0x61,0x6C,0x20,0x63,0x61,0x73,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20, // cial.case.label. END
+	0x6C,0x6F,0x67,0x32,0x0A,0x3B,0x20,0x43,0x6F,0x75,0x6E,0x74,0x20,0x6E,0x75,0x6D, // log2.;.Count.num END
+	0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x6C,0x65,0x61,0x64,0x69,0x6E,0x67,0x20,0x7A, // ber.of.leading.z END
+	0x65,0x72,0x6F,0x73,0x0A,0x63,0x6C,0x7A,0x20,0x72,0x30,0x80,0x26,0x01,0x49,0x66, // eros.clz.r0.&.If END
+	0x80,0x07,0x07,0x3D,0x30,0x20,0x74,0x68,0x65,0x6E,0x20,0x82,0x15,0x13,0x65,0x74, // ...=0.then....et END
+	0x75,0x72,0x6E,0x73,0x20,0x31,0x36,0x20,0x73,0x6F,0x20,0x64,0x65,0x63,0x72,0x65, // urns.16.so.decre END
+	0x6D,0x65,0x80,0x49,0x0A,0x69,0x74,0x20,0x74,0x6F,0x20,0x6D,0x61,0x74,0x63,0x68, // me.I.it.to.match END
+	0x81,0x31,0x00,0x31,0x83,0x72,0x0F,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x31,0x35, // .1.1.r.mov.r1.15 END
+	0x0A,0x63,0x6D,0x70,0x20,0x72,0x32,0x80,0x54,0x80,0x0F,0x06,0x0A,0x73,0x6B,0x69, // .cmp.r2.T....ski END
+	0x70,0x6C,0x65,0x80,0x0F,0x00,0x0A,0x80,0x40,0x83,0x68,0x07,0x53,0x75,0x62,0x74, // ple.....@.h.Subt END
+	0x72,0x61,0x63,0x74,0x82,0x64,0x03,0x66,0x72,0x6F,0x6D,0x80,0x34,0x81,0x51,0x02, // ract.d.from.4.Q. END
+	0x67,0x65,0x74,0x82,0xB2,0x80,0x78,0x07,0x73,0x75,0x6C,0x74,0x0A,0x73,0x75,0x62, // get...x.sult.sub END
+	0x83,0x44,0x81,0x9F,0x80,0x8C,0x0B,0x0A,0xFF,0x00,0x51,0x15,0x61,0x62,0x73,0x2E, // .D........Q.abs. END
+	0x73,0x00,0x3B,0x81,0xAA,0x80,0x0A,0x03,0x28,0x72,0x30,0x29,0x84,0xEC,0x15,0x61, // s.;.....(r0)...a END
+	0x62,0x73,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x30,0x0A,0x63,0x6D,0x70,0x20, // bs.mov.r2.0.cmp. END
+	0x72,0x31,0x20,0x72,0x30,0x80,0x0E,0x06,0x0A,0x73,0x6B,0x69,0x70,0x67,0x65,0x80, // r1.r0....skipge. END
+	0x0F,0x03,0x0A,0x73,0x75,0x62,0x83,0x13,0x80,0x19,0x11,0x0A,0x72,0x65,0x74,0x0A, // ...sub......ret. END
+	0xFF,0xFF,0xFF,0x00,0x66,0x1A,0x6D,0x6F,0x64,0x2E,0x73,0x00,0x3B,0x80,0x2E,0x00, // ....f.mod.s.;... END
+	0x3D,0x80,0x0A,0x00,0x28,0x80,0x06,0x01,0x6E,0x2C,0x80,0x3E,0x1C,0x3D,0x64,0x29, // =...(...n,.>.=d) END
+	0x20,0x2D,0x20,0x72,0x65,0x6D,0x61,0x69,0x6E,0x64,0x65,0x72,0x20,0x6F,0x66,0x20, // .-.remainder.of. END
+	0x6E,0x2F,0x64,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x80,0x33,0x02,0x0A,0x64,0x69, // n/d.label..3..di END
+	0x82,0x6E,0x81,0x65,0x04,0x31,0x0A,0x6D,0x75,0x6C,0x82,0x58,0x80,0x5B,0x87,0x68, // .n.e.1.mul.X.[.h END
+	0x82,0x7F,0x83,0x68};
+#endif
@@ -0,0 +1,75 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_std_mem_H
+#define PROGMEM_lib_std_mem_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_std_memDATASIZE 910u
+#define PROGMEM_lib_std_memCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_std_memDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_std_memData))
+static const uint8_t progmem_lib_std_memData[PROGMEM_lib_std_memDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_std_memDATAPTR ((uintptr_t)progmem_lib_std_memData)
+static const uint8_t progmem_lib_std_memData[PROGMEM_lib_std_memDATASIZE]={
+#endif
+	0x5A,0x04,0xD8,0x00,0x0F,0x00,0x87,0x01,0x60,0x02,0x2B,0x02,0xDE,0x03,0x8E,0x06, // Z.......`.+..... END
+	0x23,0x9A,0x10,0x28,0x7C,0x84,0x00,0xF7,0x00,0x16,0xBB,0x18,0x6D,0x65,0x6D,0x6D, // #..(|.......memm END
+	0x6F,0x76,0x65,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E, // ove.s.require... END
+	0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x09,0x63,0x61,0x6C,0x6C,0x2E,0x73, // /...sys...call.s END
+	0x0A,0x0A,0x3B,0x20,0x84,0x28,0x10,0x28,0x64,0x65,0x73,0x74,0x41,0x64,0x64,0x72, // ..;..(.(destAddr END
+	0x3D,0x72,0x30,0x2C,0x20,0x73,0x72,0x63,0x83,0x0B,0x00,0x31,0x80,0x0B,0x0C,0x69, // =r0,.src...1...i END
+	0x7A,0x65,0x3D,0x72,0x32,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x85,0x2F,0x80,0x39, // ze=r2).label./.9 END
+	0x0A,0x73,0x69,0x6D,0x70,0x6C,0x79,0x20,0x75,0x73,0x65,0x20,0x84,0x51,0x00,0x0A, // .simply.use..Q.. END
+	0x80,0x72,0x03,0x20,0x72,0x33,0x20,0x0B,0x72,0x32,0x0A,0x6D,0x6F,0x76,0x20,0x72, // .r..r3..r2.mov.r END
+	0x32,0x20,0x72,0x31,0x83,0x09,0x03,0x31,0x20,0x72,0x30,0x83,0x13,0x13,0x30,0x20, // 2.r1...1.r0...0. END
+	0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x4D,0x65,0x6D,0x4D,0x6F,0x76,0x65, // SyscallIdMemMove END
+	0x0A,0x73,0x83,0x10,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0x81,0x00,0x28,0x02,0x9C, // .s....ret....(.. END
+	0x54,0x6D,0x65,0x6D,0x70,0x72,0x69,0x6E,0x74,0x2E,0x73,0x00,0x72,0x65,0x71,0x75, // Tmemprint.s.requ END
+	0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x69,0x6F,0x2F,0x66,0x70,0x75,0x74,0x64,0x65, // ire.../io/fputde END
+	0x63,0x2E,0x73,0x0A,0x0A,0x3B,0x20,0x85,0x25,0x0B,0x28,0x72,0x30,0x3D,0x73,0x69, // c.s..;..%.(r0=si END
+	0x7A,0x65,0x29,0x20,0x2D,0x20,0x82,0x36,0x01,0x73,0x20,0x81,0x0E,0x27,0x20,0x69, // ze).-..6.s...'.i END
+	0x6E,0x20,0x62,0x79,0x74,0x65,0x73,0x2C,0x20,0x66,0x6F,0x72,0x6D,0x61,0x74,0x74, // n.bytes,.formatt END
+	0x65,0x64,0x20,0x74,0x6F,0x20,0x61,0x20,0x68,0x75,0x6D,0x61,0x6E,0x20,0x72,0x65, // ed.to.a.human.re END
+	0x61,0x64,0x61,0x62,0x6C,0x65,0x82,0x1D,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x86, // adable....label. END
+	0x52,0x81,0x5E,0x09,0x57,0x65,0x20,0x6F,0x6E,0x6C,0x79,0x20,0x6E,0x65,0x83,0x37, // R.^.We.only.ne.7 END
+	0x10,0x77,0x6F,0x72,0x72,0x79,0x20,0x61,0x62,0x6F,0x75,0x74,0x20,0x6B,0x62,0x20, // .worry.about.kb. END
+	0x6F,0x72,0x83,0x5D,0x85,0xE2,0x08,0x31,0x30,0x32,0x34,0x0A,0x63,0x6D,0x70,0x20, // or.]...1024.cmp. END
+	0x0E,0x72,0x31,0x20,0x72,0x30,0x20,0x72,0x31,0x0A,0x73,0x6B,0x69,0x70,0x67,0x65, // .r1.r0.r1.skipge END
+	0x81,0x09,0x15,0x6A,0x6D,0x70,0x20,0x6D,0x65,0x6D,0x70,0x72,0x69,0x6E,0x74,0x62, // ...jmp.memprintb END
+	0x79,0x74,0x65,0x73,0x0A,0x0A,0x3B,0x20,0x50,0x81,0x0D,0x1B,0x20,0x66,0x69,0x72, // ytes..;.P....fir END
+	0x73,0x74,0x20,0x28,0x6F,0x6E,0x65,0x73,0x29,0x20,0x64,0x69,0x67,0x69,0x74,0x20, // st.(ones).digit. END
+	0x6F,0x66,0x20,0x6B,0x62,0x20,0x62,0x79,0x80,0x0E,0x0A,0x76,0x69,0x64,0x69,0x6E, // of.kb.by...vidin END
+	0x67,0x20,0x73,0x69,0x7A,0x65,0x81,0x10,0x0A,0x31,0x30,0x32,0x34,0x0A,0x70,0x75, // g.size...1024.pu END
+	0x73,0x68,0x31,0x36,0x80,0x63,0x03,0x0A,0x6D,0x6F,0x76,0x80,0x67,0x83,0x15,0x80, // sh16.c..mov.g... END
+	0x2B,0x82,0x76,0x82,0x79,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x64,0x65, // +.v.y.call.putde END
+	0x63,0x83,0x24,0x04,0x30,0x20,0x27,0x2E,0x27,0x86,0x16,0x05,0x63,0x30,0x0A,0x70, // c.$.0.'.'...c0.p END
+	0x6F,0x70,0x83,0x43,0x80,0x88,0x06,0x4E,0x6F,0x77,0x20,0x63,0x6F,0x6D,0x80,0x2F, // op.C...Now.com./ END
+	0x08,0x65,0x20,0x74,0x65,0x6E,0x74,0x68,0x73,0x2D,0x82,0x88,0x83,0x5F,0x00,0x32, // .e.tenths-..._.2 END
+	0x88,0x5F,0x83,0xD9,0x04,0x32,0x0A,0x6D,0x75,0x6C,0x82,0x0C,0x80,0xE9,0x04,0x32, // ._...2.mul.....2 END
+	0x0A,0x73,0x75,0x62,0x86,0x79,0x03,0x20,0x3B,0x20,0x72,0x19,0x30,0x20,0x6E,0x6F, // .sub.y..;.r.0.no END
+	0x77,0x20,0x63,0x6F,0x6E,0x74,0x61,0x69,0x6E,0x73,0x20,0x73,0x69,0x7A,0x65,0x2D, // w.contains.size- END
+	0x66,0x6C,0x6F,0x6F,0x72,0x28,0x81,0x0A,0x06,0x2F,0x31,0x30,0x32,0x34,0x29,0x2A, // floor(.../1024)* END
+	0x81,0x15,0x00,0x3C,0x81,0x0A,0x11,0x0A,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20, // ...<.....mov.r1. END
+	0x31,0x30,0x0A,0x6D,0x75,0x6C,0x20,0x72,0x30,0x82,0x02,0x03,0x31,0x0A,0x64,0x69, // 10.mul.r0...1.di END
+	0x80,0x16,0x83,0x0C,0x0C,0x32,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x70,0x75,0x74,0x64, // .....2.call.putd END
+	0x65,0x63,0x84,0x30,0x04,0x30,0x20,0x27,0x6B,0x27,0x86,0x17,0x00,0x63,0x80,0x3C, // ec.0.0.'k'...c.< END
+	0x84,0x15,0x00,0x62,0x8A,0x15,0x1D,0x0A,0x72,0x65,0x74,0x0A,0x0A,0x3B,0x20,0x50, // ...b....ret..;.P END
+	0x72,0x69,0x6E,0x74,0x20,0x62,0x79,0x74,0x65,0x73,0x0A,0x6C,0x61,0x62,0x65,0x6C, // rint.bytes.label END
+	0x20,0x6D,0x65,0x6D,0x70,0x81,0x14,0x83,0x13,0x89,0x60,0x98,0x49,0x00,0xFF,0x80, // .memp.....`.I... END
+	0x00,0x02,0x00,0x3F,0x08,0x80,0x3B,0x09,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69, // ...?..;..s.requi END
+	0x72,0x65,0x81,0x49,0x04,0x63,0x6D,0x70,0x2E,0x73,0x80,0x6B,0x81,0x10,0x11,0x65, // re.I.cmp.s.k...e END
+	0x20,0x6D,0x65,0x6D,0x6D,0x6F,0x76,0x65,0x2E,0x73,0x0A,0x72,0x65,0x71,0x75,0x69, // .memmove.s.requi END
+	0x72,0x82,0x11,0x04,0x70,0x72,0x69,0x6E,0x74,0x80,0x12,0x03,0xFF,0x00,0xB4,0x17, // r...print....... END
+	0x80,0x20,0x05,0x63,0x6D,0x70,0x2E,0x73,0x00,0x85,0x1F,0x02,0x2E,0x2E,0x2F,0x80, // ...cmp.s....../. END
+	0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x03,0x63,0x61,0x6C,0x6C,0x80,0x3B,0x01,0x0A, // ..sys...call.;.. END
+	0x3B,0x81,0x48,0x80,0x27,0x0D,0x28,0x70,0x31,0x41,0x64,0x64,0x72,0x3D,0x72,0x30, // ;.H.'.(p1Addr=r0 END
+	0x2C,0x20,0x70,0x32,0x83,0x0A,0x10,0x31,0x2C,0x20,0x73,0x69,0x7A,0x65,0x3D,0x72, // ,.p2...1,.size=r END
+	0x32,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x84,0x2B,0x80,0x34,0x0A,0x73,0x69,0x6D, // 2).label.+.4.sim END
+	0x70,0x6C,0x79,0x20,0x75,0x73,0x65,0x20,0x84,0x4C,0x00,0x0A,0x80,0x8D,0x05,0x20, // ply.use..L...... END
+	0x72,0x33,0x20,0x72,0x32,0x83,0x09,0x03,0x32,0x20,0x72,0x31,0x83,0x13,0x03,0x31, // r3.r2...2.r1...1 END
+	0x20,0x72,0x30,0x83,0x1D,0x02,0x30,0x20,0x53,0x83,0x79,0x05,0x49,0x64,0x4D,0x65, // .r0...0.S.y.IdMe END
+	0x6D,0x43,0x80,0x49,0x85,0x3C,0x04,0x72,0x65,0x74,0x0A,0xFF,0x80,0x00};
+#endif
@@ -0,0 +1,540 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_std_proc_H
+#define PROGMEM_lib_std_proc_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_std_procDATASIZE 8346u
+#define PROGMEM_lib_std_procCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_std_procDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_std_procData))
+static const uint8_t progmem_lib_std_procData[PROGMEM_lib_std_procDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_std_procDATAPTR ((uintptr_t)progmem_lib_std_procData)
+static const uint8_t progmem_lib_std_procData[PROGMEM_lib_std_procDATASIZE]={
+#endif
+	0x5A,0x2A,0x40,0x00,0x5B,0x00,0xDE,0x01,0x7F,0x02,0x4A,0x03,0x1C,0x03,0xF5,0x04, // Z*@.[.....J..... END
+	0xCF,0x05,0x80,0x06,0x57,0x07,0x43,0x08,0x25,0x09,0x0B,0x09,0xC4,0x0A,0xA3,0x0B, // ....W.C.%....... END
+	0x82,0x0C,0x59,0x0C,0xD4,0x0D,0x4A,0x0E,0x2B,0x0E,0xD4,0x0F,0xAB,0x10,0x72,0x11, // ..Y...J.+.....r. END
+	0x42,0x12,0x28,0x12,0xE9,0x13,0xA4,0x14,0x74,0x15,0x09,0x15,0xD8,0x16,0xAB,0x17, // B.(.....t....... END
+	0x49,0x18,0x31,0x19,0x13,0x19,0xC8,0x1A,0x8B,0x1B,0x45,0x1C,0x1D,0x1C,0xE7,0x1D, // I.1.......E..... END
+	0x94,0x1E,0x43,0x1E,0xF6,0x1F,0xD2,0x20,0x77,0x20,0x9A,0x0F,0x26,0xA8,0x02,0x04, // ..C.....w...&... END
+	0x08,0x10,0x3D,0x41,0x6C,0x78,0x82,0x85,0x8B,0x99,0xA0,0x00,0xEE,0x00,0x13,0x7E, // ..=Alx.........~ END
+	0x02,0x65,0x78,0x69,0x74,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20, // .exit.s.require. END
+	0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x09,0x63,0x61,0x6C,0x6C, // ../...sys...call END
+	0x2E,0x73,0x0A,0x0A,0x3B,0x20,0x81,0x25,0x23,0x20,0x28,0x72,0x30,0x3D,0x73,0x74, // .s..;..%#.(r0=st END
+	0x61,0x74,0x75,0x73,0x29,0x20,0x2D,0x20,0x64,0x6F,0x65,0x73,0x20,0x6E,0x6F,0x74, // atus).-.does.not END
+	0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x82,0x28,0x09, // .return.label.(. END
+	0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x02,0x30,0x20,0x53, // .mov.r1.r0...0.S END
+	0x83,0x4B,0x02,0x49,0x64,0x45,0x81,0x1E,0x84,0x59,0x02,0x0A,0xFF,0xFF,0x1D,0x00, // .K.IdE...Y...... END
+	0xC7,0x04,0x70,0x61,0x74,0x68,0x6E,0x6F,0x72,0x6D,0x61,0x6C,0x69,0x73,0x65,0x2E, // ..pathnormalise. END
+	0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02, // s.require.../... END
+	0x73,0x79,0x73,0x81,0x03,0x09,0x63,0x61,0x6C,0x6C,0x2E,0x73,0x0A,0x0A,0x3B,0x20, // sys...call.s..;. END
+	0x8A,0x2E,0x15,0x28,0x72,0x30,0x3D,0x61,0x64,0x64,0x72,0x29,0x20,0x2D,0x20,0x73, // ...(r0=addr).-.s END
+	0x69,0x6D,0x70,0x6C,0x69,0x66,0x69,0x65,0x73,0x82,0x23,0x16,0x20,0x28,0x65,0x2E, // implifies.#..(e. END
+	0x67,0x2E,0x20,0x63,0x6F,0x6E,0x76,0x65,0x72,0x74,0x69,0x6E,0x67,0x20,0x27,0x2F, // g..converting.'/ END
+	0x62,0x69,0x6E,0x81,0x53,0x03,0x27,0x20,0x74,0x6F,0x80,0x0D,0x07,0x27,0x29,0x0A, // bin.S.'.to...'). END
+	0x6C,0x61,0x62,0x65,0x6C,0x8B,0x52,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20, // label.R..mov.r1. END
+	0x72,0x30,0x83,0x09,0x02,0x30,0x20,0x53,0x83,0x7E,0x02,0x49,0x64,0x50,0x80,0xA9, // r0...0.S.~.IdP.. END
+	0x00,0x4E,0x86,0x27,0x84,0x95,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xB5,0x00,0x17, // .N.'....ret..... END
+	0x01,0xFA,0x08,0x77,0x61,0x69,0x74,0x70,0x69,0x64,0x2E,0x73,0x00,0x72,0x65,0x71, // ...waitpid.s.req END
+	0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03, // uire.../...sys.. END
+	0x0D,0x63,0x61,0x6C,0x6C,0x2E,0x73,0x0A,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x84, // .call.s..label.. END
+	0x2C,0x08,0x20,0x3B,0x20,0x74,0x61,0x6B,0x65,0x73,0x20,0x81,0x0B,0x08,0x69,0x6E, // ,..;.takes....in END
+	0x20,0x72,0x30,0x2C,0x20,0x75,0x73,0x80,0x0F,0x15,0x69,0x6E,0x66,0x69,0x6E,0x69, // .r0,.us...infini END
+	0x74,0x65,0x20,0x74,0x69,0x6D,0x65,0x6F,0x75,0x74,0x20,0x61,0x6E,0x64,0x20,0x68, // te.timeout.and.h END
+	0x80,0x04,0x00,0x6C,0x80,0x2C,0x85,0x3C,0x04,0x62,0x65,0x69,0x6E,0x67,0x80,0x36, // ...l.,.<.being.6 END
+	0x16,0x74,0x65,0x72,0x72,0x75,0x70,0x74,0x65,0x64,0x0A,0x3B,0x20,0x73,0x65,0x74, // .terrupted.;.set END
+	0x75,0x70,0x20,0x72,0x65,0x67,0x69,0x73,0x80,0x16,0x04,0x73,0x20,0x66,0x6F,0x72, // up.regis...s.for END
+	0x86,0x6C,0x84,0x85,0x06,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x80,0x6C,0x80,0x7E, // .l....mov.r1.l.~ END
+	0x09,0x63,0x68,0x69,0x6C,0x64,0x73,0x20,0x50,0x49,0x44,0x83,0x16,0x01,0x32,0x20, // .childs.PID...2. END
+	0x81,0x15,0x8D,0x7E,0x83,0x32,0x02,0x33,0x20,0x53,0x83,0xC7,0x00,0x57,0x83,0xEA, // ...~.2.3.S...W.. END
+	0x06,0x53,0x74,0x61,0x74,0x75,0x73,0x49,0x81,0x7F,0x24,0x72,0x75,0x70,0x74,0x65, // .StatusI..$rupte END
+	0x64,0x0A,0x3B,0x20,0x6C,0x6F,0x6F,0x70,0x20,0x61,0x73,0x20,0x77,0x61,0x69,0x74, // d.;.loop.as.wait END
+	0x70,0x69,0x64,0x20,0x6D,0x61,0x79,0x20,0x62,0x65,0x20,0x69,0x6E,0x74,0x65,0x72, // pid.may.be.inter END
+	0x83,0x24,0x11,0x20,0x62,0x79,0x20,0x61,0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x0A, // .$..by.a.signal. END
+	0x6C,0x61,0x62,0x65,0x6C,0x85,0x2C,0x00,0x4C,0x80,0x3B,0x11,0x0A,0x6D,0x6F,0x76, // label.,.L.;..mov END
+	0x20,0x72,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x57,0x80,0x48, // .r0.SyscallIdW.H END
+	0x00,0x50,0x80,0x48,0x00,0x3B,0x81,0x55,0x04,0x74,0x68,0x65,0x20,0x73,0x83,0x19, // .P.H.;.U.the.s.. END
+	0x06,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x83,0x13,0x05,0x72,0x65,0x73,0x75,0x6C, // ..return...resul END
+	0x74,0x80,0x65,0x81,0x3A,0x0A,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x77,0x65,0x20,0x6E, // t.e.:.also,.we.n END
+	0x65,0x80,0x6D,0x01,0x74,0x6F,0x81,0x1D,0x01,0x65,0x74,0x80,0x3B,0x08,0x69,0x73, // e.m.to...et.;.is END
+	0x20,0x65,0x61,0x63,0x68,0x20,0x69,0x80,0x8B,0x05,0x61,0x74,0x69,0x6F,0x6E,0x0A, // .each.i...ation. END
+	0x84,0x4B,0x06,0x0A,0x63,0x6D,0x70,0x20,0x72,0x34,0x81,0x77,0x09,0x72,0x34,0x0A, // .K..cmp.r4.w.r4. END
+	0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x81,0x10,0x00,0x3B,0x89,0xB8,0x02,0x3F,0x0A, // skipneq...;...?. END
+	0x6A,0x80,0x26,0x89,0xAB,0x80,0x82,0x01,0x0A,0xFF,0x82,0x00,0x16,0x0B,0x17,0x2D, // j.&............- END
+	0x74,0x68,0x72,0x65,0x61,0x64,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65, // thread.s.require END
+	0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x0E,0x63,0x61,0x6C, // .../...sys...cal END
+	0x6C,0x2E,0x73,0x0A,0x0A,0x6A,0x6D,0x70,0x20,0x6C,0x69,0x62,0x80,0x15,0x83,0x2F, // l.s..jmp.lib.../ END
+	0x07,0x65,0x6E,0x64,0x0A,0x0A,0x3B,0x20,0x54,0x82,0x3C,0x02,0x73,0x20,0x61,0x80, // .end..;.T.<.s.a. END
+	0x37,0x0A,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x65,0x73,0x20,0x63,0x80,0x51,0x10, // 7.processes.c.Q. END
+	0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x63,0x6C,0x6F,0x6E,0x65, // ted.by.the.clone END
+	0x20,0x84,0x4C,0x09,0x2C,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x73,0x68,0x81,0x33, // ..L.,.which.sh.3 END
+	0x80,0x1E,0x01,0x69,0x72,0x83,0x2F,0x10,0x6F,0x72,0x27,0x73,0x20,0x52,0x41,0x4D, // ...ir./.or's.RAM END
+	0x20,0x28,0x62,0x75,0x74,0x20,0x68,0x61,0x76,0x85,0x1D,0x0B,0x6F,0x77,0x6E,0x20, // .(but.hav...own. END
+	0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x80,0x69,0x09,0x6E,0x64,0x20,0x73,0x74, // register.i.nd.st END
+	0x61,0x63,0x6B,0x29,0x2E,0x80,0x7F,0x11,0x4E,0x6F,0x74,0x65,0x3A,0x20,0x66,0x69, // ack)....Note:.fi END
+	0x6C,0x65,0x20,0x64,0x65,0x73,0x63,0x72,0x69,0x70,0x80,0x47,0x83,0x8E,0x05,0x64, // le.descrip.G...d END
+	0x75,0x70,0x6C,0x69,0x63,0x82,0x87,0x03,0x77,0x68,0x65,0x6E,0x82,0x89,0x83,0xEB, // uplic...when.... END
+	0x01,0x20,0x69,0x86,0xA2,0x26,0x2C,0x20,0x73,0x6F,0x20,0x66,0x69,0x6C,0x65,0x73, // ..i..&,.so.files END
+	0x20,0x6F,0x70,0x65,0x6E,0x65,0x64,0x20,0x61,0x66,0x74,0x65,0x72,0x77,0x61,0x72, // .opened.afterwar END
+	0x64,0x73,0x20,0x61,0x72,0x65,0x20,0x6E,0x6F,0x74,0x20,0x73,0x68,0x80,0x09,0x10, // ds.are.not.sh... END
+	0x64,0x2E,0x0A,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x74,0x68,0x72,0x65,0x61,0x64, // d...label.thread END
+	0x63,0x80,0x04,0x1A,0x74,0x65,0x20,0x3B,0x20,0x72,0x30,0x3D,0x65,0x6E,0x74,0x72, // c...te.;.r0=entr END
+	0x79,0x20,0x70,0x74,0x72,0x2C,0x20,0x72,0x31,0x3D,0x73,0x74,0x61,0x63,0x6B,0x84, // y.ptr,.r1=stack. END
+	0x0D,0x0A,0x32,0x3D,0x61,0x72,0x67,0x20,0x28,0x70,0x61,0x73,0x73,0x80,0x5B,0x02, // ..2=arg.(pass.[. END
+	0x74,0x6F,0x20,0x83,0x2A,0x0A,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x20,0x69, // to..*.function.i END
+	0x6E,0x80,0x3F,0x00,0x29,0x80,0x36,0x05,0x65,0x74,0x75,0x72,0x6E,0x73,0x84,0x5B, // n.?.).6.eturns.[ END
+	0x05,0x27,0x73,0x20,0x50,0x49,0x44,0x83,0x1C,0x0B,0x20,0x28,0x6F,0x72,0x20,0x50, // .'s.PID....(or.P END
+	0x69,0x64,0x4D,0x61,0x78,0x20,0x80,0x30,0x0B,0x66,0x61,0x69,0x6C,0x75,0x72,0x65, // idMax..0.failure END
+	0x29,0x0A,0x3B,0x20,0x73,0x80,0x33,0x01,0x70,0x20,0x83,0x6D,0x80,0xC5,0x03,0x74, // ).;.s.3.p..m...t END
+	0x68,0x61,0x74,0x84,0x47,0x07,0x69,0x6E,0x67,0x20,0x66,0x72,0x6F,0x6D,0x80,0xAA, // hat.G.ing.from.. END
+	0x00,0x65,0x8D,0x71,0x03,0x65,0x78,0x69,0x74,0x81,0x67,0x00,0x65,0x82,0xC7,0x1E, // .e.q.exit.g.e... END
+	0x61,0x64,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x74,0x68,0x72,0x65,0x61,0x64, // ad.mov.r3.thread END
+	0x65,0x78,0x69,0x74,0x0A,0x73,0x74,0x6F,0x72,0x65,0x31,0x36,0x20,0x72,0x31,0x80, // exit.store16.r1. END
+	0x18,0x04,0x0A,0x69,0x6E,0x63,0x32,0x80,0x0A,0x11,0x0A,0x3B,0x20,0x63,0x61,0x6C, // ...inc2....;.cal END
+	0x6C,0x20,0x63,0x6C,0x6F,0x6E,0x65,0x20,0x77,0x69,0x74,0x68,0x80,0x1F,0x13,0x3D, // l.clone.with...= END
+	0x65,0x6E,0x74,0x72,0x79,0x20,0x70,0x74,0x72,0x2C,0x20,0x72,0x32,0x3D,0x73,0x74, // entry.ptr,.r2=st END
+	0x61,0x63,0x6B,0x84,0x0D,0x04,0x33,0x3D,0x61,0x72,0x67,0x85,0x5C,0x01,0x72,0x32, // ack...3=arg.\.r2 END
+	0x83,0x66,0x82,0x48,0x82,0x70,0x80,0x5A,0x00,0x30,0x83,0x7A,0x04,0x30,0x20,0x53, // .f.H.p.Z.0.z.0.S END
+	0x79,0x73,0x81,0x5A,0x02,0x49,0x64,0x43,0x81,0x5B,0x01,0x0A,0x73,0x83,0x0E,0x0A, // ys.Z.IdC.[..s... END
+	0x0A,0x72,0x65,0x74,0x0A,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88,0x9C,0x01,0x20,0x3B, // .ret..label....; END
+	0x80,0x38,0x00,0x3D,0x82,0x09,0x80,0x6D,0x02,0x74,0x75,0x73,0x98,0x4E,0x00,0x45, // .8.=...m.tus.N.E END
+	0x82,0xCC,0x84,0x4D,0x84,0x49,0x06,0x66,0x75,0x74,0x65,0x78,0x77,0x61,0x85,0x48, // ...M.I.futexwa.H END
+	0x43,0x61,0x64,0x64,0x72,0x2C,0x20,0x72,0x31,0x3D,0x65,0x78,0x70,0x65,0x63,0x74, // Caddr,.r1=expect END
+	0x65,0x64,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x2D,0x20,0x77,0x61,0x69,0x74,0x73, // ed.value.-.waits END
+	0x20,0x75,0x6E,0x74,0x69,0x6C,0x20,0x77,0x6F,0x6B,0x65,0x6E,0x20,0x62,0x79,0x20, // .until.woken.by. END
+	0x66,0x75,0x74,0x65,0x78,0x77,0x61,0x6B,0x65,0x20,0x28,0x75,0x6E,0x6C,0x65,0x73, // futexwake.(unles END
+	0x73,0x20,0x74,0x68,0x65,0x80,0x18,0x05,0x74,0x65,0x20,0x61,0x74,0x20,0x81,0x4C, // s.the...te.at..L END
+	0x0F,0x20,0x6E,0x6F,0x20,0x6C,0x6F,0x6E,0x67,0x65,0x72,0x20,0x65,0x71,0x75,0x61, // ..no.longer.equa END
+	0x6C,0x83,0x21,0x8B,0x5D,0x1A,0x29,0x2E,0x20,0x52,0x65,0x74,0x75,0x72,0x6E,0x73, // l.!.].)..Returns END
+	0x20,0x30,0x20,0x69,0x6E,0x20,0x72,0x30,0x20,0x28,0x6F,0x72,0x20,0x31,0x20,0x69, // .0.in.r0.(or.1.i END
+	0x66,0x80,0x0E,0x05,0x74,0x65,0x72,0x72,0x75,0x70,0x81,0x8A,0x80,0x70,0x0F,0x61, // f...terrup...p.a END
+	0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x29,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x80, // .signal).mov.r2. END
+	0xAA,0x83,0x09,0x00,0x31,0x80,0x35,0x83,0x13,0x0B,0x30,0x20,0x53,0x79,0x73,0x63, // ....1.5...0.Sysc END
+	0x61,0x6C,0x6C,0x49,0x64,0x46,0x81,0x9E,0x00,0x57,0x80,0xB8,0x01,0x0A,0x73,0x83, // allIdF...W....s. END
+	0x12,0x0A,0x0A,0x72,0x65,0x74,0x0A,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x88,0xBB,0x00, // ...ret..label... END
+	0x3B,0x80,0x71,0x00,0x3D,0x83,0xF9,0x24,0x72,0x31,0x3D,0x6D,0x61,0x78,0x20,0x63, // ;.q.=..$r1=max.c END
+	0x6F,0x75,0x6E,0x74,0x20,0x2D,0x20,0x77,0x61,0x6B,0x65,0x73,0x20,0x75,0x70,0x20, // ount.-.wakes.up. END
+	0x74,0x6F,0x20,0x72,0x31,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x80,0x16,0x14, // to.r1.threads... END
+	0x69,0x74,0x69,0x6E,0x67,0x20,0x6F,0x6E,0x20,0x61,0x64,0x64,0x72,0x2C,0x20,0x72, // iting.on.addr,.r END
+	0x65,0x74,0x75,0x72,0x6E,0x81,0x12,0x1C,0x74,0x68,0x65,0x20,0x6E,0x75,0x6D,0x62, // eturn...the.numb END
+	0x65,0x72,0x20,0x77,0x6F,0x6B,0x65,0x6E,0x20,0x69,0x6E,0x20,0x72,0x30,0x0A,0x6D, // er.woken.in.r0.m END
+	0x6F,0x76,0x20,0x72,0x32,0x80,0x43,0x83,0x09,0x00,0x31,0x86,0x13,0x10,0x30,0x20, // ov.r2.C...1...0. END
+	0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x46,0x75,0x74,0x65,0x78,0x57,0x80, // SyscallIdFutexW. END
+	0x71,0x01,0x0A,0x73,0x83,0x12,0x00,0x0A,0x80,0x56,0x0F,0x0A,0x0A,0x3B,0x20,0x4C, // q..s.....V...;.L END
+	0x6F,0x63,0x6B,0x73,0x20,0x61,0x72,0x65,0x20,0x27,0x74,0x80,0x90,0x0F,0x6E,0x27, // ocks.are.'t...n' END
+	0x20,0x66,0x6C,0x61,0x67,0x73,0x20,0x28,0x73,0x74,0x6F,0x72,0x65,0x64,0x81,0x62, // .flags.(stored.b END
+	0x0A,0x38,0x20,0x62,0x69,0x74,0x73,0x29,0x2C,0x20,0x75,0x73,0x85,0x85,0x04,0x78, // .8.bits),.us...x END
+	0x63,0x68,0x67,0x38,0x80,0x7E,0x06,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x80,0xAB, // chg8.~.structi.. END
+	0x02,0x77,0x68,0x65,0x80,0x43,0x08,0x6E,0x65,0x63,0x65,0x73,0x73,0x61,0x72,0x79, // .whe.C.necessary END
+	0x81,0xD4,0x09,0x62,0x65,0x20,0x61,0x74,0x6F,0x6D,0x69,0x63,0x2E,0x80,0x67,0x02, // ...be.atomic..g. END
+	0x41,0x20,0x6C,0x12,0x6F,0x63,0x6B,0x20,0x69,0x73,0x20,0x30,0x20,0x69,0x66,0x20, // A.l.ock.is.0.if. END
+	0x66,0x72,0x65,0x65,0x2C,0x20,0x31,0x81,0x0A,0x0A,0x74,0x61,0x6B,0x65,0x6E,0x2C, // free,.1...taken, END
+	0x20,0x6F,0x72,0x20,0x32,0x86,0x0E,0x34,0x20,0x61,0x6E,0x64,0x20,0x6F,0x74,0x68, // .or.2..4.and.oth END
+	0x65,0x72,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x20,0x6D,0x61,0x79,0x20,0x62, // er.threads.may.b END
+	0x65,0x20,0x77,0x61,0x69,0x74,0x69,0x6E,0x67,0x20,0x6F,0x6E,0x20,0x69,0x74,0x20, // e.waiting.on.it. END
+	0x28,0x69,0x6E,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x63,0x61,0x73,0x80,0x1C,0x03, // (in.which.cas... END
+	0x68,0x6F,0x65,0x76,0x80,0x33,0x03,0x72,0x65,0x6C,0x65,0x80,0x0F,0x00,0x73,0x81, // hoev.3.rele...s. END
+	0x22,0x05,0x68,0x61,0x73,0x20,0x74,0x6F,0x80,0x37,0x01,0x6B,0x65,0x80,0x34,0x80, // ".has.to.7.ke.4. END
+	0x03,0x80,0x71,0x13,0x68,0x65,0x6D,0x29,0x2E,0x0A,0x3B,0x20,0x54,0x6F,0x20,0x73, // ..q.hem)..;.To.s END
+	0x65,0x74,0x75,0x70,0x20,0x61,0x20,0x6C,0x80,0x9D,0x00,0x2C,0x80,0x38,0x04,0x73, // etup.a.l...,.8.s END
+	0x65,0x72,0x76,0x65,0x80,0x0F,0x04,0x62,0x79,0x74,0x65,0x20,0x80,0x5D,0x05,0x6D, // erve...byte..].m END
+	0x65,0x6D,0x6F,0x72,0x79,0x82,0x8F,0x80,0x2A,0x81,0x73,0x80,0x4C,0x00,0x30,0x81, // emory...*.s.L.0. END
+	0x51,0x00,0x6D,0x81,0x51,0x80,0x83,0x01,0x69,0x6E,0x80,0x91,0x06,0x61,0x6C,0x6C, // Q.m.Q...in...all END
+	0x79,0x20,0x75,0x6E,0x81,0x45,0x01,0x65,0x64,0x82,0xCC,0x80,0x73,0x00,0x31,0x81, // y.un.E.ed...s.1. END
+	0x78,0x80,0xB3,0x84,0x21,0x1F,0x6C,0x79,0x20,0x6C,0x6F,0x63,0x6B,0x65,0x64,0x2C, // x...!.ly.locked, END
+	0x0A,0x3B,0x20,0x74,0x68,0x65,0x6E,0x20,0x70,0x61,0x73,0x73,0x20,0x69,0x74,0x73, // .;.then.pass.its END
+	0x20,0x61,0x64,0x64,0x72,0x65,0x80,0x0B,0x01,0x74,0x6F,0x81,0x18,0x0F,0x20,0x66, // .addre...to....f END
+	0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x73,0x20,0x62,0x65,0x6C,0x6F,0x77,0x81,0x16, // unctions.below.. END
+	0x02,0x75,0x73,0x65,0x80,0x29,0x04,0x2E,0x0A,0x0A,0x6C,0x61,0x80,0x13,0x82,0x48, // .use.)....la...H END
+	0x09,0x77,0x61,0x69,0x74,0x20,0x3B,0x20,0x72,0x30,0x3D,0x81,0x56,0x05,0x20,0x70, // .wait.;.r0=.V..p END
+	0x74,0x72,0x2C,0x20,0x81,0x13,0x05,0x73,0x20,0x75,0x6E,0x74,0x69,0x83,0x23,0x03, // tr,....s.unti.#. END
+	0x20,0x63,0x61,0x6E,0x80,0x44,0x14,0x20,0x67,0x72,0x61,0x62,0x62,0x65,0x64,0x20, // .can.D..grabbed. END
+	0x28,0x73,0x6C,0x65,0x65,0x70,0x69,0x6E,0x67,0x20,0x72,0x61,0x80,0x82,0x00,0x72, // (sleeping.ra...r END
+	0x80,0x87,0x81,0x20,0x03,0x75,0x73,0x79,0x2D,0x81,0x4E,0x81,0x18,0x03,0x77,0x68, // .....usy-.N...wh END
+	0x69,0x6C,0x81,0x6B,0x01,0x20,0x69,0x80,0x8F,0x0E,0x61,0x6B,0x65,0x6E,0x29,0x0A, // il.k..i...aken). END
+	0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x32,0x81,0xB8,0x01,0x72,0x79,0x82,0xA6, // push16.r2...ry.. END
+	0x80,0x19,0x83,0x61,0x80,0xAB,0x16,0x6F,0x6E,0x74,0x65,0x6E,0x64,0x65,0x64,0x0A, // ...a...ontended. END
+	0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x31,0x0A,0x78,0x63,0x68,0x67,0x38,0x80,0x9A, // mov.r1.1.xchg8.. END
+	0x80,0x0D,0x03,0x0A,0x63,0x6D,0x70,0x81,0x14,0x00,0x72,0x0C,0x31,0x20,0x72,0x31, // ....cmp...r.1.r1 END
+	0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x81,0x0B,0x20,0x6A,0x6D,0x70,0x20, // .skipneqz...jmp. END
+	0x6C,0x6F,0x63,0x6B,0x77,0x61,0x69,0x74,0x72,0x65,0x74,0x0A,0x3B,0x20,0x6F,0x74, // lockwaitret.;.ot END
+	0x68,0x65,0x72,0x77,0x69,0x73,0x65,0x20,0x6D,0x61,0x72,0x6B,0x20,0x80,0x0D,0x82, // herwise.mark.... END
+	0x20,0x31,0x20,0x61,0x73,0x20,0x63,0x6F,0x6E,0x74,0x65,0x6E,0x64,0x65,0x64,0x20, // .1.as.contended. END
+	0x61,0x6E,0x64,0x20,0x73,0x6C,0x65,0x65,0x70,0x20,0x75,0x6E,0x74,0x69,0x6C,0x20, // and.sleep.until. END
+	0x69,0x74,0x20,0x69,0x73,0x20,0x72,0x65,0x6C,0x65,0x61,0x73,0x65,0x64,0x0A,0x6C, // it.is.released.l END
+	0x61,0x62,0x65,0x6C,0x86,0x57,0x0C,0x6C,0x6F,0x6F,0x70,0x73,0x74,0x61,0x72,0x74, // abel.W.loopstart END
+	0x0A,0x6D,0x6F,0x76,0x80,0x80,0x0A,0x20,0x32,0x0A,0x78,0x63,0x68,0x67,0x38,0x20, // .mov....2.xchg8. END
+	0x72,0x30,0x81,0x8E,0x00,0x63,0x80,0x82,0x80,0x14,0x82,0x02,0x9A,0x9B,0x05,0x70, // r0...c.........p END
+	0x75,0x73,0x68,0x31,0x36,0x80,0x35,0x87,0x47,0x09,0x63,0x61,0x6C,0x6C,0x20,0x66, // ush16.5.G.call.f END
+	0x75,0x74,0x65,0x78,0x81,0xC0,0x03,0x0A,0x70,0x6F,0x70,0x83,0x20,0x89,0xD6,0x87, // utex....pop..... END
+	0x7E,0x01,0x6C,0x61,0x18,0x62,0x65,0x6C,0x20,0x6C,0x6F,0x63,0x6B,0x77,0x61,0x69, // ~.la.bel.lockwai END
+	0x74,0x72,0x65,0x74,0x0A,0x70,0x6F,0x70,0x31,0x36,0x20,0x72,0x32,0x0A,0x81,0x0C, // tret.pop16.r2... END
+	0x02,0x0A,0x6C,0x61,0x89,0x1F,0x08,0x74,0x72,0x79,0x20,0x3B,0x20,0x72,0x30,0x3D, // ..la...try.;.r0= END
+	0x81,0x30,0x12,0x20,0x70,0x74,0x72,0x2C,0x20,0x74,0x72,0x69,0x65,0x73,0x20,0x74, // .0..ptr,.tries.t END
+	0x6F,0x20,0x67,0x72,0x61,0x62,0x82,0x48,0x00,0x20,0x80,0x45,0x15,0x75,0x72,0x6E, // o.grab.H...E.urn END
+	0x69,0x6E,0x67,0x20,0x69,0x6D,0x6D,0x65,0x64,0x69,0x61,0x74,0x65,0x6C,0x79,0x2E, // ing.immediately. END
+	0x20,0x49,0x66,0x83,0x1E,0x01,0x77,0x61,0x80,0x2F,0x08,0x61,0x6B,0x65,0x6E,0x20, // .If...wa./.aken. END
+	0x31,0x20,0x69,0x73,0x84,0x2D,0x20,0x65,0x64,0x2C,0x20,0x6F,0x74,0x68,0x65,0x72, // 1.is.-.ed,.other END
+	0x77,0x69,0x73,0x65,0x20,0x30,0x2E,0x20,0x4E,0x6F,0x74,0x65,0x3A,0x20,0x6F,0x6E, // wise.0..Note:.on END
+	0x6C,0x79,0x20,0x6D,0x6F,0x64,0x69,0x66,0x81,0x65,0x10,0x72,0x30,0x20,0x61,0x6E, // ly.modif.e.r0.an END
+	0x64,0x20,0x72,0x31,0x2E,0x0A,0x3B,0x20,0x73,0x77,0x61,0x70,0x81,0x41,0x00,0x6E, // d.r1..;.swap.A.n END
+	0x80,0x7B,0x82,0x8E,0x80,0x83,0x01,0x65,0x69,0x81,0x42,0x82,0x5D,0x0B,0x20,0x6F, // .{.....ei.B.]..o END
+	0x72,0x20,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x84,0x6E,0x09,0x73,0x74,0x61, // r.preserve.n.sta END
+	0x74,0x75,0x73,0x0A,0x6D,0x6F,0x76,0x80,0x42,0x08,0x20,0x31,0x0A,0x78,0x63,0x68, // tus.mov.B..1.xch END
+	0x67,0x38,0x20,0x2F,0x72,0x30,0x20,0x72,0x31,0x0A,0x3B,0x20,0x69,0x66,0x20,0x6C, // g8./r0.r1.;.if.l END
+	0x6F,0x63,0x6B,0x20,0x77,0x61,0x73,0x20,0x63,0x6F,0x6E,0x74,0x65,0x6E,0x64,0x65, // ock.was.contende END
+	0x64,0x20,0x77,0x65,0x20,0x68,0x61,0x76,0x65,0x20,0x6A,0x75,0x73,0x74,0x20,0x63, // d.we.have.just.c END
+	0x6C,0x65,0x61,0x72,0x80,0x14,0x12,0x74,0x68,0x61,0x74,0x2C,0x20,0x73,0x6F,0x20, // lear...that,.so. END
+	0x73,0x77,0x61,0x70,0x20,0x69,0x74,0x20,0x62,0x61,0x80,0x38,0x0B,0x28,0x74,0x68, // swap.it.ba.8.(th END
+	0x69,0x73,0x20,0x6D,0x61,0x79,0x20,0x61,0x6C,0x80,0x1B,0x03,0x67,0x72,0x61,0x62, // is.may.al...grab END
+	0x80,0x29,0x00,0x65,0x83,0x55,0x80,0x5D,0x80,0x27,0x00,0x68,0x80,0x5B,0x06,0x62, // .).e.U.].'.h.[.b END
+	0x65,0x65,0x6E,0x20,0x72,0x65,0x80,0x4A,0x00,0x73,0x80,0x5F,0x01,0x69,0x6E,0x82, // een.re.J.s._.in. END
+	0x23,0x0E,0x6D,0x65,0x61,0x6E,0x74,0x69,0x6D,0x65,0x29,0x0A,0x73,0x6B,0x69,0x70, // #.meantime).skip END
+	0x31,0x81,0x91,0x02,0x6A,0x6D,0x70,0x82,0x90,0x0D,0x77,0x61,0x69,0x74,0x74,0x72, // 1...jmp...waittr END
+	0x79,0x72,0x65,0x74,0x0A,0x6D,0x6F,0x76,0x80,0xAB,0x08,0x20,0x32,0x0A,0x78,0x63, // yret.mov....2.xc END
+	0x68,0x67,0x38,0x20,0x83,0xB9,0x04,0x6C,0x61,0x62,0x65,0x6C,0x8D,0x29,0x00,0x3B, // hg8....label.).; END
+	0x87,0xCB,0x07,0x66,0x72,0x65,0x65,0x20,0x28,0x61,0x6E,0x80,0x6B,0x0F,0x73,0x20, // ...free.(an.k.s. END
+	0x6E,0x6F,0x77,0x20,0x6F,0x75,0x72,0x73,0x29,0x20,0x6F,0x6E,0x6C,0x79,0x81,0xF3, // now.ours).only.. END
+	0x00,0x78,0x14,0x63,0x68,0x67,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x65,0x64,0x20, // .x.chg.returned. END
+	0x30,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x80,0x08,0x05,0x63,0x6D,0x70,0x20,0x72, // 0.mov.r0...cmp.r END
+	0x31,0x83,0x02,0x08,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x81,0x0B,0x84, // 1....skipneqz... END
+	0x21,0x01,0x31,0x0A,0x80,0x35,0x11,0x0A,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x6C, // !.1..5...label.l END
+	0x6F,0x63,0x6B,0x70,0x6F,0x73,0x74,0x20,0x3B,0x80,0x3C,0x00,0x3D,0x81,0x0D,0x04, // ockpost.;.<.=... END
+	0x20,0x70,0x74,0x72,0x2C,0x80,0x58,0x05,0x6C,0x65,0x61,0x73,0x65,0x73,0x82,0x20, // .ptr,.X.leases.. END
+	0x83,0x5B,0x00,0x31,0x80,0x64,0x00,0x78,0x80,0x74,0x00,0x38,0x81,0x66,0x80,0x5A, // .[.1.d.x.t.8.f.Z END
+	0x08,0x3B,0x20,0x77,0x65,0x72,0x65,0x20,0x74,0x68,0x81,0x05,0x80,0x43,0x06,0x73, // .;.were.th...C.s END
+	0x69,0x62,0x6C,0x79,0x20,0x6F,0x81,0x0F,0x80,0x14,0x13,0x72,0x65,0x61,0x64,0x73, // ibly.o.....reads END
+	0x20,0x77,0x61,0x69,0x74,0x69,0x6E,0x67,0x3F,0x20,0x69,0x66,0x20,0x73,0x6F,0x80, // .waiting?.if.so. END
+	0x0E,0x04,0x6B,0x65,0x20,0x6F,0x6E,0x80,0x03,0x00,0x66,0x81,0x37,0x00,0x6D,0x82, // ..ke.on...f.7.m. END
+	0x9E,0x82,0xA7,0x81,0x92,0x08,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x32,0x85, // ......push16.r2. END
+	0x6F,0x0B,0x31,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x66,0x75,0x74,0x65,0x78,0x81,0x3A, // o.1.call.futex.: END
+	0x03,0x0A,0x70,0x6F,0x70,0x83,0x20,0x81,0xC1,0x17,0x0A,0x6C,0x61,0x62,0x65,0x6C, // ..pop......label END
+	0x20,0x6C,0x69,0x62,0x73,0x79,0x73,0x74,0x68,0x72,0x65,0x61,0x64,0x65,0x6E,0x64, // .libsysthreadend END
+	0x0A,0xFF,0xA5,0x00,0x18,0x00,0xC9,0x04,0x70,0x72,0x6F,0x63,0x2E,0x73,0x00,0x72, // ........proc.s.r END
+	0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x65,0x78,0x69,0x74,0x2E,0x73,0x0A,0x85,0x0E, // equire.exit.s... END
+	0x06,0x66,0x6F,0x72,0x6B,0x65,0x78,0x65,0x80,0x21,0x8E,0x12,0x01,0x77,0x61,0x8A, // .forkexe.!...wa. END
+	0x29,0x09,0x67,0x65,0x74,0x61,0x62,0x73,0x70,0x61,0x74,0x68,0x8B,0x14,0x02,0x70, // ).getabspath...p END
+	0x77,0x64,0x88,0x4F,0x03,0x6F,0x70,0x65,0x6E,0x8C,0x23,0x81,0x32,0x08,0x6E,0x6F, // wd.O.open.#.2.no END
+	0x72,0x6D,0x61,0x6C,0x69,0x73,0x65,0x88,0x7A,0x01,0x72,0x75,0x8D,0x29,0x83,0xE0, // rmalise.z.ru.).. END
+	0x88,0x9D,0x00,0x77,0x09,0x61,0x69,0x74,0x70,0x69,0x64,0x2E,0x73,0x0A,0xFF,0xB3, // ...w.aitpid.s... END
+	0x00,0x17,0x0A,0x96,0x2B,0x67,0x65,0x74,0x70,0x61,0x74,0x68,0x2E,0x73,0x00,0x72, // ....+getpath.s.r END
+	0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73, // equire.../...sys END
+	0x81,0x03,0x80,0x5B,0x00,0x0A,0x84,0x18,0x02,0x65,0x6E,0x64,0x81,0x1B,0x04,0x70, // ...[.....end...p END
+	0x72,0x6F,0x63,0x2F,0x80,0x35,0x02,0x61,0x62,0x73,0x83,0x38,0x8C,0x1F,0x02,0x6D, // roc/.5.abs.8...m END
+	0x65,0x6D,0x81,0x03,0x03,0x6D,0x6F,0x76,0x65,0x8E,0x1B,0x02,0x73,0x74,0x72,0x81, // em...move...str. END
+	0x03,0x02,0x63,0x61,0x74,0x96,0x1A,0x01,0x68,0x72,0x96,0x35,0x01,0x70,0x79,0x81, // ..cat...hr.5.py. END
+	0x8D,0x02,0x61,0x62,0x20,0x84,0xB3,0x01,0x53,0x63,0x17,0x72,0x61,0x74,0x63,0x68, // ..ab....Sc.ratch END
+	0x42,0x75,0x66,0x20,0x50,0x61,0x74,0x68,0x4D,0x61,0x78,0x0A,0x64,0x62,0x20,0x67, // Buf.PathMax.db.g END
+	0x65,0x74,0x70,0x80,0x0D,0x11,0x53,0x6C,0x61,0x73,0x68,0x53,0x74,0x72,0x20,0x27, // etp...SlashStr.' END
+	0x2F,0x27,0x2C,0x20,0x30,0x0A,0x0A,0x3B,0x85,0x19,0x08,0x28,0x72,0x30,0x3D,0x64, // /',.0..;...(r0=d END
+	0x65,0x73,0x74,0x20,0x81,0x26,0x07,0x2C,0x20,0x72,0x31,0x3D,0x73,0x72,0x63,0x82, // est..&.,.r1=src. END
+	0x0C,0x0D,0x29,0x20,0x2D,0x20,0x69,0x6E,0x74,0x65,0x72,0x70,0x72,0x65,0x74,0x73, // ..).-.interprets END
+	0x82,0x1F,0x12,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x20,0x73,0x68,0x65,0x6C,0x6C, // ....as.the.shell END
+	0x20,0x77,0x6F,0x75,0x6C,0x64,0x80,0x24,0x07,0x63,0x68,0x65,0x63,0x6B,0x69,0x6E, // .would.$.checkin END
+	0x67,0x80,0x2D,0x08,0x20,0x50,0x41,0x54,0x48,0x20,0x66,0x69,0x72,0x80,0x50,0x01, // g.-..PATH.fir.P. END
+	0x69,0x66,0x83,0x33,0x00,0x68,0x80,0x34,0x03,0x6E,0x6F,0x20,0x73,0x81,0x82,0x04, // if.3.h.4.no.s... END
+	0x65,0x73,0x2C,0x20,0x6F,0x80,0x41,0x07,0x72,0x77,0x69,0x73,0x65,0x20,0x6D,0x61, // es,.o.A.rwise.ma END
+	0x82,0x36,0x07,0x61,0x62,0x73,0x6F,0x6C,0x75,0x74,0x65,0x81,0x31,0x09,0x6E,0x65, // .6.absolute.1.ne END
+	0x65,0x64,0x65,0x64,0x20,0x62,0x79,0x20,0x80,0x75,0x80,0x78,0x01,0x6E,0x64,0x81, // eded.by..u.x.nd. END
+	0x58,0x08,0x70,0x77,0x64,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x85,0xCF,0x80,0xBF,0x04, // X.pwd.label..... END
+	0x43,0x6F,0x70,0x79,0x20,0x85,0xAB,0x81,0xA8,0x00,0x6F,0x24,0x20,0x64,0x65,0x73, // Copy......o$.des END
+	0x74,0x20,0x61,0x6E,0x64,0x20,0x67,0x65,0x74,0x70,0x61,0x74,0x68,0x53,0x63,0x72, // t.and.getpathScr END
+	0x61,0x74,0x63,0x68,0x42,0x75,0x66,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72, // atchBuf.push16.r END
+	0x30,0x86,0x09,0x10,0x31,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x73,0x74,0x72,0x63,0x70, // 0...1.call.strcp END
+	0x79,0x0A,0x70,0x6F,0x70,0x83,0x14,0x87,0x1E,0x02,0x6D,0x6F,0x76,0x80,0x2F,0x90, // y.pop.....mov./. END
+	0x4B,0x93,0x37,0x83,0x40,0x10,0x30,0x0A,0x3B,0x20,0x43,0x68,0x65,0x63,0x6B,0x20, // K.7.@.0.;.Check. END
+	0x69,0x66,0x20,0x74,0x68,0x65,0x20,0x81,0x87,0x14,0x20,0x63,0x6F,0x6E,0x74,0x61, // if.the.....conta END
+	0x69,0x6E,0x73,0x20,0x6E,0x6F,0x20,0x73,0x6C,0x61,0x73,0x68,0x65,0x73,0x2C,0x92, // ins.no.slashes,. END
+	0x92,0x82,0x73,0x04,0x31,0x20,0x27,0x2F,0x27,0x87,0x9D,0x01,0x68,0x72,0x80,0x53, // ..s.1.'/'...hr.S END
+	0x00,0x49,0x81,0x4D,0x02,0x69,0x73,0x20,0x80,0x02,0x07,0x74,0x72,0x75,0x65,0x2C, // .I.M.is....true, END
+	0x20,0x77,0x65,0x80,0x08,0x04,0x79,0x20,0x66,0x69,0x72,0x80,0xF3,0x05,0x6C,0x6F, // .we...y.fir...lo END
+	0x6F,0x6B,0x69,0x6E,0x20,0x67,0x20,0x69,0x6E,0x20,0x50,0x41,0x54,0x48,0x20,0x66, // okin.g.in.PATH.f END
+	0x6F,0x72,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x6C,0x65,0x2E,0x0A,0x63,0x6D,0x70, // or.the.file..cmp END
+	0x20,0x72,0x32,0x20,0x72,0x30,0x80,0x02,0x08,0x0A,0x70,0x6F,0x70,0x31,0x36,0x20, // .r2.r0....pop16. END
+	0x72,0x31,0x85,0x08,0x08,0x30,0x0A,0x73,0x6B,0x69,0x70,0x65,0x71,0x7A,0x80,0x22, // r1...0.skipeqz." END
+	0x01,0x0A,0x6A,0x80,0x29,0x2D,0x67,0x65,0x74,0x70,0x61,0x74,0x68,0x4D,0x61,0x6B, // ..j.)-getpathMak END
+	0x65,0x41,0x62,0x73,0x6F,0x6C,0x75,0x74,0x65,0x4E,0x6F,0x53,0x74,0x61,0x63,0x6B, // eAbsoluteNoStack END
+	0x52,0x65,0x73,0x74,0x6F,0x72,0x65,0x0A,0x3B,0x20,0x4E,0x6F,0x20,0x73,0x6C,0x61, // Restore.;.No.sla END
+	0x73,0x68,0x65,0x73,0x80,0x6A,0x03,0x75,0x6E,0x64,0x2C,0x80,0x13,0x03,0x6C,0x6F, // shes.j.und,...lo END
+	0x6F,0x6B,0x82,0x78,0x04,0x64,0x69,0x72,0x65,0x63,0x80,0x28,0x00,0x69,0x80,0x1D, // ok.x.direc.(.i.. END
+	0x85,0x90,0x17,0x65,0x6E,0x76,0x69,0x72,0x6F,0x6E,0x6D,0x65,0x6E,0x74,0x20,0x76, // ...environment.v END
+	0x61,0x72,0x69,0x61,0x62,0x6C,0x65,0x0A,0x6D,0x6F,0x76,0x83,0x97,0x83,0x09,0x00, // ariable.mov..... END
+	0x33,0x81,0x95,0x82,0x13,0x11,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49, // 3.....0.SyscallI END
+	0x64,0x45,0x6E,0x76,0x47,0x65,0x74,0x50,0x80,0x90,0x01,0x0A,0x73,0x83,0x13,0x83, // dEnvGetP....s... END
+	0x36,0x00,0x31,0x86,0x36,0x80,0xD5,0x00,0x32,0x83,0x4A,0x18,0x32,0x20,0x72,0x31, // 6.1.6...2.J.2.r1 END
+	0x20,0x3B,0x20,0x50,0x41,0x54,0x48,0x20,0x6E,0x6F,0x77,0x20,0x69,0x6E,0x20,0x72, // .;.PATH.now.in.r END
+	0x32,0x0A,0x6D,0x6F,0x76,0x81,0x17,0x0F,0x72,0x33,0x0A,0x6C,0x61,0x62,0x65,0x6C, // 2.mov...r3.label END
+	0x20,0x67,0x65,0x74,0x70,0x61,0x74,0x68,0x81,0x25,0x19,0x4C,0x6F,0x6F,0x70,0x53, // .getpath.%.LoopS END
+	0x74,0x61,0x72,0x74,0x0A,0x3B,0x20,0x6C,0x6F,0x6F,0x6B,0x20,0x66,0x6F,0x72,0x20, // tart.;.look.for. END
+	0x63,0x6F,0x6C,0x6F,0x6E,0x80,0x3B,0x0F,0x64,0x69,0x63,0x61,0x74,0x69,0x6E,0x67, // colon.;.dicating END
+	0x20,0x65,0x6E,0x64,0x20,0x6F,0x66,0x20,0x81,0x34,0x0D,0x20,0x64,0x69,0x72,0x0A, // .end.of..4..dir. END
+	0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x86,0x09,0x00,0x31,0x86,0x13,0x84, // push16.r0...1... END
+	0x6E,0x00,0x30,0x88,0x78,0x0E,0x27,0x3A,0x27,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x73, // n.0.x.':'.call.s END
+	0x74,0x72,0x63,0x68,0x72,0x83,0x8F,0x00,0x33,0x81,0x23,0x00,0x3B,0x81,0x07,0x81, // trchr...3.#.;... END
+	0xA8,0x13,0x70,0x6F,0x69,0x6E,0x74,0x73,0x20,0x74,0x6F,0x20,0x66,0x69,0x72,0x73, // ..points.to.firs END
+	0x74,0x2F,0x6E,0x65,0x78,0x74,0x86,0x87,0x82,0xCF,0x06,0x0A,0x63,0x6D,0x70,0x20, // t/next......cmp. END
+	0x72,0x34,0x82,0x38,0x04,0x33,0x0A,0x70,0x6F,0x70,0x83,0x6C,0x84,0x08,0x80,0x7F, // r4.8.3.pop.l.... END
+	0x81,0x11,0x5C,0x20,0x72,0x30,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x20, // ..\.r0.skipneqz. END
+	0x72,0x34,0x0A,0x6A,0x6D,0x70,0x20,0x67,0x65,0x74,0x70,0x61,0x74,0x68,0x4D,0x61, // r4.jmp.getpathMa END
+	0x6B,0x65,0x41,0x62,0x73,0x6F,0x6C,0x75,0x74,0x65,0x53,0x74,0x61,0x63,0x6B,0x52, // keAbsoluteStackR END
+	0x65,0x73,0x74,0x6F,0x72,0x65,0x20,0x3B,0x20,0x6E,0x6F,0x20,0x63,0x6F,0x6C,0x6F, // estore.;.no.colo END
+	0x6E,0x20,0x66,0x6F,0x75,0x6E,0x64,0x20,0x73,0x6F,0x20,0x77,0x65,0x20,0x68,0x61, // n.found.so.we.ha END
+	0x76,0x65,0x20,0x72,0x65,0x61,0x63,0x68,0x65,0x64,0x20,0x74,0x68,0x65,0x20,0x65, // ve.reached.the.e END
+	0x80,0x1A,0x01,0x6F,0x66,0x82,0x0A,0x09,0x50,0x41,0x54,0x48,0x20,0x64,0x69,0x72, // ...of...PATH.dir END
+	0x65,0x63,0x80,0x41,0x07,0x79,0x20,0x6C,0x69,0x73,0x74,0x0A,0x3B,0x8A,0x43,0x02, // ec.A.y.list.;.C. END
+	0x2D,0x20,0x63,0x80,0x3B,0x01,0x74,0x65,0x80,0x58,0x03,0x6D,0x62,0x69,0x6E,0x80, // -.c.;.te.X.mbin. END
+	0x42,0x0A,0x73,0x74,0x72,0x69,0x6E,0x67,0x20,0x66,0x72,0x6F,0x6D,0x86,0x3F,0x01, // B.string.from.?. END
+	0x20,0x61,0x81,0x6E,0x01,0x72,0x63,0x84,0x1C,0x09,0x0A,0x70,0x75,0x73,0x68,0x31, // .a.n.rc....push1 END
+	0x36,0x20,0x72,0x33,0x86,0x09,0x00,0x32,0x86,0x13,0x00,0x30,0x86,0x1D,0x00,0x31, // 6.r3...2...0...1 END
+	0x80,0x6B,0x0A,0x61,0x64,0x64,0x20,0x63,0x75,0x72,0x72,0x65,0x6E,0x74,0x88,0x88, // .k.add.current.. END
+	0x00,0x66,0x51,0x72,0x6F,0x6D,0x20,0x50,0x41,0x54,0x48,0x20,0x28,0x72,0x32,0x20, // .fQrom.PATH.(r2. END
+	0x63,0x6F,0x6E,0x74,0x61,0x69,0x6E,0x73,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x6F, // contains.start.o END
+	0x66,0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x6F,0x72,0x79,0x20,0x65,0x6E,0x74,0x72, // f.directory.entr END
+	0x79,0x2C,0x20,0x77,0x68,0x69,0x6C,0x65,0x20,0x72,0x33,0x20,0x70,0x6F,0x69,0x6E, // y,.while.r3.poin END
+	0x74,0x73,0x20,0x74,0x6F,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x72,0x6D,0x69,0x6E, // ts.to.the.termin END
+	0x61,0x74,0x69,0x6E,0x67,0x80,0x45,0x02,0x6C,0x6F,0x6E,0x81,0x28,0x13,0x63,0x68, // ating.E.lon.(.ch END
+	0x20,0x69,0x73,0x20,0x69,0x6D,0x6D,0x65,0x64,0x69,0x61,0x74,0x65,0x6C,0x79,0x20, // .is.immediately. END
+	0x61,0x66,0x80,0x28,0x20,0x29,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x67,0x65, // af.(.).mov.r0.ge END
+	0x74,0x70,0x61,0x74,0x68,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x42,0x75,0x66,0x0A, // tpathScratchBuf. END
+	0x73,0x75,0x62,0x20,0x72,0x34,0x81,0x5E,0x80,0x8D,0x00,0x3B,0x80,0x8F,0x0B,0x6D, // sub.r4.^...;...m END
+	0x70,0x75,0x74,0x65,0x20,0x6C,0x65,0x6E,0x67,0x74,0x68,0x81,0x8F,0x82,0xAA,0x81, // pute.length..... END
+	0x25,0x00,0x70,0x80,0xA0,0x03,0x0A,0x61,0x64,0x64,0x81,0x47,0x81,0x02,0x00,0x34, // %.p....add.G...4 END
+	0x83,0x54,0x04,0x34,0x20,0x30,0x0A,0x73,0x80,0xAF,0x01,0x65,0x38,0x83,0x15,0x80, // .T.4.0.s...e8... END
+	0x44,0x82,0x0E,0x07,0x20,0x6E,0x75,0x6C,0x6C,0x20,0x62,0x79,0x80,0x4C,0x04,0x72, // D....null.by.L.r END
+	0x65,0x61,0x64,0x79,0x82,0xB7,0x81,0xB3,0x27,0x6E,0x61,0x74,0x65,0x20,0x6E,0x65, // eady....'nate.ne END
+	0x77,0x20,0x73,0x74,0x72,0x69,0x6E,0x67,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20, // w.string.mov.r0. END
+	0x67,0x65,0x74,0x70,0x61,0x74,0x68,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x42,0x75, // getpathScratchBu END
+	0x66,0x83,0x18,0x07,0x31,0x20,0x72,0x32,0x0A,0x73,0x75,0x62,0x80,0x06,0x02,0x20, // f...1.r2.sub.... END
+	0x72,0x33,0x81,0x05,0x09,0x3B,0x20,0x72,0x65,0x63,0x61,0x6C,0x63,0x75,0x6C,0x81, // r3...;.recalcul. END
+	0x48,0x13,0x6C,0x65,0x6E,0x67,0x74,0x68,0x20,0x6F,0x66,0x20,0x50,0x41,0x54,0x48, // H.length.of.PATH END
+	0x20,0x70,0x61,0x72,0x74,0x0A,0x80,0x1D,0x04,0x6C,0x20,0x6D,0x65,0x6D,0x80,0x59, // .part....l.mem.Y END
+	0x00,0x65,0x80,0x2E,0x0B,0x63,0x6F,0x70,0x79,0x20,0x63,0x75,0x72,0x72,0x65,0x6E, // .e...copy.curren END
+	0x74,0x82,0x20,0x86,0x2D,0x01,0x74,0x6F,0x80,0x84,0x84,0x10,0x00,0x73,0x83,0x78, // t...-.to.....s.x END
+	0x09,0x20,0x62,0x75,0x66,0x2C,0x20,0x69,0x67,0x6E,0x6F,0x81,0x9C,0x05,0x20,0x74, // ..buf,.igno....t END
+	0x65,0x72,0x6D,0x69,0x80,0xB1,0x81,0x0B,0x0F,0x63,0x6F,0x6C,0x6F,0x6E,0x0A,0x3B, // ermi.....colon.; END
+	0x20,0x61,0x64,0x64,0x20,0x6A,0x6F,0x69,0x6E,0x81,0x1F,0x04,0x73,0x6C,0x61,0x73, // .add.join...slas END
+	0x68,0x9E,0xC2,0x85,0xDB,0x81,0x2C,0x00,0x53,0x35,0x74,0x72,0x0A,0x63,0x61,0x6C, // h.....,.S5tr.cal END
+	0x6C,0x20,0x73,0x74,0x72,0x63,0x61,0x74,0x0A,0x3B,0x20,0x61,0x64,0x64,0x20,0x75, // l.strcat.;.add.u END
+	0x73,0x65,0x72,0x20,0x70,0x72,0x6F,0x76,0x69,0x64,0x65,0x64,0x20,0x73,0x72,0x63, // ser.provided.src END
+	0x20,0x70,0x61,0x74,0x68,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x67,0x65,0x74, // .path.mov.r0.get END
+	0x81,0x0E,0x17,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x42,0x75,0x66,0x0A,0x70,0x6F, // ...ScratchBuf.po END
+	0x70,0x31,0x36,0x20,0x72,0x31,0x0A,0x70,0x75,0x73,0x68,0x83,0x09,0x8B,0x54,0x06, // p16.r1.push...T. END
+	0x72,0x65,0x73,0x74,0x6F,0x72,0x65,0x80,0x07,0x09,0x67,0x69,0x73,0x74,0x65,0x72, // restore...gister END
+	0x73,0x20,0x61,0x6E,0x80,0x58,0x03,0x74,0x61,0x63,0x6B,0x88,0x3C,0x83,0x45,0x00, // s.an.X.tack.<.E. END
+	0x30,0x85,0x4E,0x00,0x32,0x85,0x57,0x00,0x33,0x80,0x96,0x00,0x74,0x80,0x41,0x09, // 0.N.2.W.3...t.A. END
+	0x20,0x69,0x66,0x20,0x63,0x6F,0x6D,0x62,0x69,0x6E,0x80,0x95,0x81,0x91,0x02,0x20, // .if.combin...... END
+	0x65,0x78,0x80,0x4E,0x00,0x73,0x86,0x76,0x80,0x3A,0x86,0x80,0x84,0xAC,0x02,0x53, // ex.N.s.v.:.....S END
+	0x79,0x73,0x81,0xDF,0x06,0x49,0x64,0x46,0x69,0x6C,0x65,0x45,0x83,0x2E,0x82,0xC7, // ys...IdFileE.... END
+	0x00,0x31,0x83,0xC7,0x1D,0x74,0x68,0x53,0x63,0x72,0x61,0x74,0x63,0x68,0x42,0x75, // .1...thScratchBu END
+	0x66,0x0A,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x0A,0x63,0x6D,0x70,0x20,0x72,0x34, // f.syscall.cmp.r4 END
+	0x20,0x72,0x30,0x80,0x02,0x08,0x0A,0x70,0x6F,0x70,0x31,0x36,0x20,0x72,0x31,0x85, // .r0....pop16.r1. END
+	0x08,0x09,0x30,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x80,0x23,0x01,0x0A, // ..0.skipneqz.#.. END
+	0x6A,0x80,0x2A,0x28,0x67,0x65,0x74,0x70,0x61,0x74,0x68,0x50,0x41,0x54,0x48,0x4C, // j.*(getpathPATHL END
+	0x6F,0x6F,0x70,0x43,0x6F,0x6E,0x74,0x69,0x6E,0x75,0x65,0x0A,0x3B,0x20,0x69,0x74, // oopContinue.;.it END
+	0x20,0x64,0x6F,0x65,0x73,0x20,0x2D,0x20,0x63,0x6F,0x70,0x79,0x20,0x81,0x25,0x09, // .does.-.copy..%. END
+	0x20,0x69,0x6E,0x74,0x6F,0x20,0x64,0x65,0x73,0x74,0x80,0x09,0x81,0x5F,0x02,0x6D, // .into.dest..._.m END
+	0x6F,0x76,0x80,0x5D,0x85,0x44,0x88,0x8D,0x81,0x8A,0x0A,0x20,0x73,0x74,0x72,0x63, // ov.].D......strc END
+	0x70,0x79,0x0A,0x72,0x65,0x74,0x88,0x4E,0x02,0x6E,0x6F,0x74,0x80,0x52,0x0B,0x75, // py.ret.N.not.R.u END
+	0x70,0x64,0x61,0x74,0x65,0x20,0x6F,0x66,0x66,0x73,0x65,0x83,0x4C,0x14,0x32,0x20, // pdate.offse.L.2. END
+	0x66,0x6F,0x72,0x20,0x6E,0x65,0x78,0x74,0x20,0x74,0x69,0x6D,0x65,0x20,0x61,0x6E, // for.next.time.an END
+	0x64,0x20,0x6C,0x80,0x91,0x0B,0x20,0x61,0x67,0x61,0x69,0x6E,0x0A,0x6C,0x61,0x62, // d.l....again.lab END
+	0x65,0x6C,0x8C,0xAD,0x16,0x70,0x43,0x6F,0x6E,0x74,0x69,0x6E,0x75,0x65,0x0A,0x6D, // el...pContinue.m END
+	0x6F,0x76,0x20,0x72,0x32,0x20,0x72,0x33,0x0A,0x69,0x6E,0x63,0x80,0x09,0x34,0x0A, // ov.r2.r3.inc..4. END
+	0x6A,0x6D,0x70,0x20,0x67,0x65,0x74,0x70,0x61,0x74,0x68,0x50,0x41,0x54,0x48,0x4C, // jmp.getpathPATHL END
+	0x6F,0x6F,0x70,0x53,0x74,0x61,0x72,0x74,0x0A,0x3B,0x20,0x4F,0x74,0x68,0x65,0x72, // oopStart.;.Other END
+	0x77,0x69,0x73,0x65,0x20,0x6D,0x61,0x6B,0x65,0x20,0x73,0x75,0x72,0x65,0x20,0x64, // wise.make.sure.d END
+	0x65,0x73,0x74,0x20,0x81,0x2C,0x11,0x20,0x69,0x73,0x20,0x61,0x62,0x73,0x6F,0x6C, // est..,..is.absol END
+	0x75,0x74,0x65,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x85,0x46,0x00,0x4D,0x80,0x2C,0x00, // ute.label.F.M.,. END
+	0x41,0x84,0x19,0x80,0x4A,0x02,0x63,0x6B,0x52,0x80,0x33,0x06,0x6F,0x72,0x65,0x0A, // A...J.ckR.3.ore. END
+	0x63,0x61,0x6C,0x82,0x24,0x80,0x36,0x81,0x6E,0x03,0x0A,0x72,0x65,0x74,0x97,0x39, // cal.$.6.n..ret.9 END
+	0x01,0x4E,0x6F,0x9E,0x3B,0x00,0xFF,0xA6,0x00,0x1D,0x02,0xC6,0x0C,0x67,0x65,0x74, // .No.;........get END
+	0x61,0x62,0x73,0x70,0x61,0x74,0x68,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72, // abspath.s.requir END
+	0x65,0x20,0x2E,0x2E,0x2F,0x73,0x74,0x72,0x81,0x03,0x05,0x63,0x61,0x74,0x2E,0x73, // e.../str...cat.s END
+	0x0A,0x90,0x17,0x01,0x70,0x79,0x88,0x17,0x80,0x44,0x02,0x70,0x77,0x64,0x80,0x28, // ....py...D.pwd.( END
+	0x1C,0x0A,0x64,0x62,0x20,0x6C,0x69,0x62,0x70,0x72,0x6F,0x63,0x53,0x6C,0x61,0x73, // ..db.libprocSlas END
+	0x68,0x53,0x74,0x72,0x20,0x27,0x2F,0x27,0x2C,0x20,0x30,0x0A,0x0A,0x3B,0x81,0x26, // hStr.'/',.0..;.& END
+	0x84,0x6B,0x15,0x28,0x72,0x30,0x3D,0x64,0x65,0x73,0x74,0x20,0x61,0x64,0x64,0x72, // .k.(r0=dest.addr END
+	0x2C,0x20,0x72,0x31,0x3D,0x73,0x72,0x63,0x20,0x81,0x85,0x82,0x11,0x0C,0x29,0x20, // ,.r1=src......). END
+	0x2D,0x20,0x63,0x68,0x65,0x63,0x6B,0x73,0x20,0x69,0x66,0x83,0x16,0x02,0x69,0x73, // -.checks.if...is END
+	0x20,0x80,0xA7,0x09,0x6F,0x6C,0x75,0x74,0x65,0x2C,0x20,0x61,0x6E,0x64,0x81,0x18, // ....olute,.and.. END
+	0x07,0x6E,0x6F,0x74,0x20,0x6D,0x61,0x6B,0x65,0x80,0x25,0x09,0x74,0x20,0x73,0x6F, // .not.make.%.t.so END
+	0x2C,0x20,0x73,0x74,0x6F,0x72,0x80,0x0D,0x80,0x03,0x06,0x75,0x6C,0x74,0x20,0x69, // ,.stor.....ult.i END
+	0x6E,0x20,0x86,0x63,0x10,0x20,0x65,0x69,0x74,0x68,0x65,0x72,0x20,0x77,0x61,0x79, // n..c..either.way END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x82,0x8C,0x2F,0x62,0x73,0x70,0x61,0x74,0x68,0x0A, // .label../bspath. END
+	0x0A,0x3B,0x20,0x53,0x65,0x74,0x20,0x72,0x30,0x20,0x74,0x6F,0x20,0x65,0x6D,0x70, // .;.Set.r0.to.emp END
+	0x74,0x79,0x20,0x73,0x74,0x72,0x69,0x6E,0x67,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32, // ty.string.mov.r2 END
+	0x20,0x30,0x0A,0x73,0x74,0x6F,0x72,0x65,0x38,0x81,0x22,0x01,0x72,0x32,0x81,0x2F, // .0.store8.".r2./ END
+	0x07,0x54,0x65,0x73,0x74,0x20,0x66,0x69,0x72,0x80,0x05,0x10,0x63,0x68,0x61,0x72, // .Test.fir...char END
+	0x20,0x66,0x6F,0x72,0x20,0x27,0x2F,0x27,0x0A,0x6C,0x6F,0x61,0x64,0x80,0x26,0x03, // .for.'/'.load.&. END
+	0x32,0x20,0x72,0x31,0x83,0x3C,0x00,0x33,0x82,0x16,0x02,0x63,0x6D,0x70,0x82,0x14, // 2.r1.<.3...cmp.. END
+	0x80,0x17,0x08,0x33,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x81,0x49,0x00,0x6A, // ...3.skipneq.I.j END
+	0x80,0x17,0x03,0x67,0x65,0x74,0x61,0x83,0x88,0x13,0x6E,0x65,0x78,0x74,0x20,0x3B, // ...geta...next.; END
+	0x20,0x61,0x6C,0x72,0x65,0x61,0x64,0x79,0x20,0x68,0x61,0x73,0x20,0x61,0x81,0x55, // .already.has.a.U END
+	0x09,0x2C,0x20,0x63,0x6F,0x6E,0x74,0x69,0x6E,0x75,0x65,0x81,0xAA,0x0D,0x41,0x64, // .,.continue...Ad END
+	0x64,0x20,0x70,0x77,0x64,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x81,0x68,0x85,0x09, // d.pwd.push16.h.. END
+	0x05,0x30,0x0A,0x63,0x61,0x6C,0x6C,0x81,0x50,0x81,0x1F,0x82,0xBB,0x00,0x31,0x81, // .0.call.P.....1. END
+	0x15,0x02,0x70,0x6F,0x70,0x83,0x1E,0x8C,0x28,0x00,0x73,0x0D,0x74,0x72,0x63,0x70, // ..pop...(.s.trcp END
+	0x79,0x0A,0x70,0x6F,0x70,0x31,0x36,0x20,0x72,0x30,0x85,0x08,0x10,0x31,0x0A,0x0A, // y.pop16.r0...1.. END
+	0x3B,0x20,0x41,0x64,0x64,0x20,0x27,0x2F,0x27,0x0A,0x70,0x75,0x73,0x68,0x84,0x1D, // ;.Add.'/'.push.. END
+	0x84,0x09,0x04,0x31,0x0A,0x6D,0x6F,0x76,0x80,0x25,0x16,0x20,0x6C,0x69,0x62,0x70, // ...1.mov.%..libp END
+	0x72,0x6F,0x63,0x53,0x6C,0x61,0x73,0x68,0x53,0x74,0x72,0x0A,0x63,0x61,0x6C,0x6C, // rocSlashStr.call END
+	0x20,0x73,0x80,0x53,0x01,0x61,0x74,0x87,0x4A,0x86,0x5C,0x14,0x0A,0x6C,0x61,0x62, // .s.S.at.J.\..lab END
+	0x65,0x6C,0x20,0x67,0x65,0x74,0x61,0x62,0x73,0x70,0x61,0x74,0x68,0x6E,0x65,0x78, // el.getabspathnex END
+	0x74,0x84,0x68,0x02,0x73,0x72,0x63,0x81,0x38,0x12,0x69,0x6E,0x67,0x20,0x74,0x6F, // t.h.src.8.ing.to END
+	0x20,0x64,0x65,0x73,0x74,0x20,0x28,0x72,0x30,0x20,0x61,0x6E,0x64,0x81,0x67,0x0D, // .dest.(r0.and.g. END
+	0x61,0x6C,0x72,0x65,0x61,0x64,0x79,0x20,0x73,0x65,0x74,0x75,0x70,0x29,0x8A,0x66, // already.setup).f END
+	0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xB6,0x00,0x18,0x02,0x5D,0x0A,0x6F,0x70,0x65, // ..ret......].ope END
+	0x6E,0x70,0x61,0x74,0x68,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20, // npath.s.require. END
+	0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x03,0x2E,0x73,0x0A,0x0A, // ../...sys....s.. END
+	0x84,0x18,0x02,0x65,0x6E,0x64,0x81,0x1B,0x07,0x70,0x72,0x6F,0x63,0x2F,0x67,0x65, // ...end...proc/ge END
+	0x74,0x83,0x35,0x03,0x0A,0x0A,0x3B,0x20,0x85,0x43,0x03,0x28,0x72,0x30,0x3D,0x81, // t.5...;..C.(r0=. END
+	0x4B,0x0B,0x2C,0x20,0x72,0x31,0x3D,0x6D,0x6F,0x64,0x65,0x29,0x20,0x2D,0x82,0x1C, // K.,.r1=mode).-.. END
+	0x01,0x73,0x20,0x81,0x62,0x12,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x20,0x73,0x68, // .s..b..as.the.sh END
+	0x65,0x6C,0x6C,0x20,0x77,0x6F,0x75,0x6C,0x64,0x80,0x1F,0x18,0x63,0x68,0x65,0x63, // ell.would...chec END
+	0x6B,0x69,0x6E,0x67,0x20,0x69,0x6E,0x20,0x50,0x41,0x54,0x48,0x20,0x66,0x69,0x72, // king.in.PATH.fir END
+	0x73,0x74,0x20,0x69,0x66,0x83,0x33,0x00,0x68,0x80,0x34,0x05,0x6E,0x6F,0x20,0x73, // st.if.3.h.4.no.s END
+	0x6C,0x61,0x80,0x36,0x03,0x73,0x2C,0x20,0x6F,0x80,0x41,0x07,0x72,0x77,0x69,0x73, // la.6.s,.o.A.rwis END
+	0x65,0x20,0x6D,0x61,0x82,0x36,0x07,0x61,0x62,0x73,0x6F,0x6C,0x75,0x74,0x65,0x81, // e.ma.6.absolute. END
+	0x31,0x0C,0x6E,0x65,0x65,0x64,0x65,0x64,0x20,0x62,0x79,0x20,0x70,0x72,0x65,0x80, // 1.needed.by.pre. END
+	0x02,0x01,0x6E,0x64,0x81,0x58,0x09,0x70,0x77,0x64,0x2E,0x20,0x72,0x65,0x74,0x75, // ..nd.X.pwd..retu END
+	0x72,0x80,0x88,0x0C,0x66,0x64,0x20,0x6F,0x6E,0x20,0x73,0x75,0x63,0x63,0x65,0x73, // r...fd.on.succes END
+	0x73,0x30,0x20,0x28,0x30,0x2F,0x69,0x6E,0x76,0x61,0x6C,0x69,0x64,0x20,0x6F,0x6E, // s0.(0/invalid.on END
+	0x20,0x66,0x61,0x69,0x6C,0x75,0x72,0x65,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20, // .failure).label. END
+	0x6F,0x70,0x65,0x6E,0x70,0x61,0x74,0x68,0x0A,0x3B,0x20,0x43,0x6F,0x6E,0x76,0x65, // openpath.;.Conve END
+	0x72,0x74,0x20,0x81,0x0E,0x18,0x20,0x61,0x73,0x20,0x73,0x68,0x65,0x6C,0x6C,0x20, // rt.....as.shell. END
+	0x77,0x6F,0x75,0x6C,0x64,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x72,0x31,0x83, // would.mov.r3.r1. END
+	0x09,0x03,0x31,0x20,0x72,0x30,0x83,0x13,0x12,0x30,0x20,0x72,0x36,0x20,0x3B,0x20, // ..1.r0...0.r6.;. END
+	0x75,0x73,0x65,0x20,0x73,0x74,0x61,0x63,0x6B,0x20,0x74,0x6F,0x80,0x08,0x01,0x6F, // use.stack.to...o END
+	0x72,0x81,0x0E,0x08,0x72,0x69,0x6E,0x67,0x20,0x63,0x6F,0x70,0x79,0x83,0x3E,0x02, // r...ring.copy.>. END
+	0x32,0x20,0x50,0x80,0x68,0x06,0x4D,0x61,0x78,0x0A,0x61,0x64,0x64,0x81,0x36,0x81, // 2.P.h.Max.add.6. END
+	0x02,0x06,0x32,0x0A,0x70,0x75,0x73,0x68,0x38,0x81,0x5C,0x0F,0x3B,0x20,0x70,0x72, // ..2.push8.\.;.pr END
+	0x6F,0x74,0x65,0x63,0x74,0x20,0x6D,0x6F,0x64,0x65,0x20,0x28,0x80,0x25,0x01,0x65, // otect.mode.(.%.e END
+	0x64,0x83,0x4F,0x81,0x58,0x04,0x61,0x66,0x74,0x65,0x72,0x82,0x9C,0x03,0x29,0x0A, // d.O.X.after...). END
+	0x63,0x61,0x80,0x99,0x02,0x67,0x65,0x74,0x82,0xB9,0x02,0x70,0x6F,0x70,0x80,0x3F, // ca...get...pop.? END
+	0x00,0x32,0x80,0x85,0x01,0x72,0x65,0x83,0x7A,0x81,0x3F,0x80,0xD0,0x02,0x54,0x72, // .2...re.z.?...Tr END
+	0x79,0x80,0x8E,0x16,0x20,0x6F,0x70,0x65,0x6E,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30, // y....open.mov.r0 END
+	0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x4F,0x86,0x14,0x0C,0x31,0x20, // .SyscallIdO...1. END
+	0x50,0x61,0x74,0x68,0x4D,0x61,0x78,0x0A,0x73,0x75,0x62,0x81,0x0E,0x01,0x72,0x36, // PathMax.sub...r6 END
+	0x80,0x14,0x01,0x0A,0x73,0x83,0x29,0x0F,0x0A,0x3B,0x20,0x52,0x65,0x73,0x74,0x6F, // ....s.)..;.Resto END
+	0x72,0x65,0x20,0x73,0x74,0x61,0x63,0x6B,0x83,0x48,0x82,0x21,0x04,0x72,0x65,0x74, // re.stack.H.!.ret END
+	0x0A,0xFF,0x9F,0x00,0x10,0x00,0x8D,0x03,0x67,0x65,0x74,0x70,0x77,0x64,0x2E,0x73, // ........getpwd.s END
+	0x00,0x72,0x65,0x71,0x75,0x69,0x80,0x4A,0x02,0x2E,0x2E,0x2F,0x80,0x02,0x80,0x62, // .requi.J.../...b END
+	0x81,0x03,0x81,0x90,0x02,0x2E,0x73,0x0A,0x80,0x69,0x83,0x27,0x04,0x28,0x29,0x20, // ......s..i.'.(). END
+	0x2D,0x20,0x80,0x5C,0x0F,0x75,0x72,0x6E,0x73,0x20,0x70,0x6F,0x69,0x6E,0x74,0x65, // -..\.urns.pointe END
+	0x72,0x20,0x74,0x6F,0x20,0x80,0x42,0x80,0x83,0x06,0x72,0x69,0x6E,0x67,0x20,0x69, // r.to..B...ring.i END
+	0x6E,0x80,0xCC,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x84,0x34,0x8E,0xE0,0x08,0x45, // n....label.4...E END
+	0x6E,0x76,0x47,0x65,0x74,0x50,0x77,0x64,0x0D,0x0A,0x73,0x79,0x73,0x63,0x61,0x6C, // nvGetPwd..syscal END
+	0x6C,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xAF,0x00,0x17,0x01,0x55,0x06,0x72,0x75,0x6E, // l.ret......U.run END
+	0x70,0x61,0x74,0x68,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E, // path.s.require.. END
+	0x2E,0x2F,0x80,0x02,0x80,0x59,0x81,0x03,0x81,0x5D,0x05,0x2E,0x73,0x0A,0x0A,0x3B, // ./...Y...]..s..; END
+	0x20,0x84,0x28,0x0B,0x28,0x72,0x30,0x3D,0x61,0x72,0x67,0x63,0x2C,0x20,0x72,0x31, // ..(.(r0=argc,.r1 END
+	0x81,0x08,0x29,0x76,0x29,0x20,0x2D,0x20,0x65,0x78,0x65,0x63,0x75,0x74,0x65,0x73, // ..)v).-.executes END
+	0x20,0x61,0x20,0x70,0x72,0x6F,0x67,0x72,0x61,0x6D,0x20,0x61,0x73,0x20,0x74,0x68, // .a.program.as.th END
+	0x65,0x20,0x73,0x68,0x65,0x6C,0x6C,0x20,0x77,0x6F,0x75,0x6C,0x64,0x80,0x27,0x19, // e.shell.would.'. END
+	0x63,0x68,0x65,0x63,0x6B,0x69,0x6E,0x67,0x20,0x69,0x6E,0x20,0x50,0x41,0x54,0x48, // checking.in.PATH END
+	0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x69,0x66,0x20,0x81,0x83,0x01,0x20,0x68,0x80, // .first.if.....h. END
+	0x34,0x05,0x6E,0x6F,0x20,0x73,0x6C,0x61,0x80,0x36,0x03,0x73,0x2C,0x20,0x6F,0x80, // 4.no.sla.6.s,.o. END
+	0x41,0x07,0x72,0x77,0x69,0x73,0x65,0x20,0x6D,0x61,0x82,0x36,0x04,0x61,0x62,0x73, // A.rwise.ma.6.abs END
+	0x6F,0x6C,0x80,0x68,0x81,0x31,0x03,0x6E,0x65,0x65,0x64,0x08,0x65,0x64,0x20,0x62, // ol.h.1.need.ed.b END
+	0x79,0x20,0x70,0x72,0x65,0x80,0x02,0x45,0x6E,0x64,0x69,0x6E,0x67,0x20,0x70,0x77, // y.pre..Ending.pw END
+	0x64,0x2E,0x20,0x6F,0x6E,0x20,0x73,0x75,0x63,0x65,0x73,0x73,0x20,0x64,0x6F,0x65, // d..on.sucess.doe END
+	0x73,0x20,0x6E,0x6F,0x74,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x0A,0x6C,0x61,0x62, // s.not.return.lab END
+	0x65,0x6C,0x20,0x72,0x75,0x6E,0x70,0x61,0x74,0x68,0x0A,0x6D,0x6F,0x76,0x20,0x72, // el.runpath.mov.r END
+	0x33,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x45,0x78,0x65,0x63,0x50,0x80,0x16, // 3.SyscallExecP.. END
+	0x08,0x46,0x6C,0x61,0x67,0x53,0x65,0x61,0x72,0x63,0x84,0x20,0x03,0x32,0x20,0x72, // .FlagSearc...2.r END
+	0x31,0x83,0x2A,0x03,0x31,0x20,0x72,0x30,0x83,0x34,0x00,0x30,0x85,0x34,0x01,0x49, // 1.*.1.r0.4.0.4.I END
+	0x64,0x81,0x36,0x01,0x0A,0x73,0x83,0x42,0x00,0x0A,0x80,0x66,0x01,0x0A,0xFF,0xA7, // d.6..s.B...f.... END
+	0x00,0x07,0x03,0x46,0x0E,0x66,0x6F,0x72,0x6B,0x65,0x80,0x79,0x0D,0x2E,0x73,0x00, // ...F.forke.y..s. END
+	0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x80,0x52,0x81, // require.../...R. END
+	0x03,0x02,0x2E,0x73,0x0A,0x84,0xB5,0x85,0x29,0x05,0x20,0x3B,0x20,0x74,0x61,0x6B, // ...s....)..;.tak END
+	0x80,0xD7,0x01,0x61,0x72,0x17,0x67,0x63,0x20,0x69,0x6E,0x20,0x72,0x30,0x20,0x61, // ...ar.gc.in.r0.a END
+	0x6E,0x64,0x20,0x61,0x72,0x67,0x76,0x20,0x73,0x74,0x72,0x69,0x6E,0x67,0x82,0x15, // nd.argv.string.. END
+	0x07,0x31,0x20,0x74,0x6F,0x20,0x65,0x78,0x65,0x82,0x23,0x10,0x61,0x20,0x66,0x6F, // .1.to.exe.#.a.fo END
+	0x72,0x6B,0x65,0x64,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x2C,0x82,0x32,0x11, // rked.process,.2. END
+	0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x63,0x68,0x69,0x6C,0x64,0x73,0x20,0x50, // returns.childs.P END
+	0x49,0x44,0x84,0x4F,0x00,0x28,0x80,0x56,0x22,0x74,0x68,0x65,0x20,0x70,0x61,0x72, // ID.O.(.V"the.par END
+	0x65,0x6E,0x74,0x29,0x2C,0x20,0x6F,0x72,0x20,0x30,0x20,0x6F,0x6E,0x20,0x66,0x61, // ent),.or.0.on.fa END
+	0x69,0x6C,0x75,0x72,0x65,0x0A,0x3B,0x20,0x73,0x61,0x76,0x65,0x81,0x73,0x00,0x63, // ilure.;.save.s.c END
+	0x86,0x7C,0x05,0x0A,0x70,0x75,0x73,0x68,0x38,0x80,0x8E,0x82,0x08,0x01,0x31,0x36, // .|..push8.....16 END
+	0x80,0x82,0x80,0x27,0x03,0x63,0x61,0x6C,0x6C,0x82,0x7C,0x03,0x0A,0x6D,0x6F,0x76, // ...'.call.|..mov END
+	0x81,0xAB,0x02,0x53,0x79,0x73,0x81,0x13,0x02,0x49,0x64,0x46,0x81,0x14,0x00,0x73, // ...Sys...IdF...s END
+	0x83,0x0D,0x83,0x1C,0x0B,0x31,0x20,0x50,0x69,0x64,0x4D,0x61,0x78,0x0A,0x63,0x6D, // .....1.PidMax.cm END
+	0x70,0x81,0xC0,0x80,0xD9,0x80,0x43,0x06,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x81, // p.....C.skipneq. END
+	0x4E,0x00,0x6A,0x80,0x17,0x82,0xC8,0x80,0xD6,0x02,0x65,0x72,0x72,0x0B,0x6F,0x72, // N.j.......err.or END
+	0x0A,0x63,0x6D,0x70,0x20,0x72,0x31,0x20,0x72,0x30,0x80,0x02,0x08,0x0A,0x73,0x6B, // .cmp.r1.r0....sk END
+	0x69,0x70,0x6E,0x65,0x71,0x7A,0x80,0x11,0x01,0x0A,0x6A,0x80,0x18,0x0C,0x66,0x6F, // ipneqz....j...fo END
+	0x72,0x6B,0x65,0x78,0x65,0x63,0x63,0x68,0x69,0x6C,0x64,0x8A,0x11,0x09,0x73,0x75, // rkexecchild...su END
+	0x63,0x63,0x65,0x73,0x73,0x0A,0x3B,0x20,0x82,0x1B,0x02,0x20,0x2D,0x20,0x81,0x27, // ccess.;.....-..' END
+	0x12,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x70,0x72,0x6F,0x67,0x72,0x61,0x6D,0x20, // ..given.program. END
+	0x77,0x69,0x74,0x68,0x84,0x12,0x09,0x61,0x72,0x67,0x73,0x0A,0x6C,0x61,0x62,0x65, // with...args.labe END
+	0x6C,0x8C,0x54,0x02,0x6D,0x6F,0x76,0x81,0x7C,0x09,0x53,0x79,0x73,0x63,0x61,0x6C, // l.T.mov.|.Syscal END
+	0x6C,0x49,0x64,0x45,0x80,0x6E,0x08,0x0A,0x70,0x6F,0x70,0x31,0x36,0x20,0x72,0x32, // lIdE.n..pop16.r2 END
+	0x81,0x08,0x00,0x38,0x81,0x8C,0x82,0x25,0x00,0x33,0x85,0x25,0x81,0x23,0x10,0x50, // ...8...%.3.%.#.P END
+	0x61,0x74,0x68,0x46,0x6C,0x61,0x67,0x4C,0x69,0x74,0x65,0x72,0x61,0x6C,0x0A,0x73, // athFlagLiteral.s END
+	0x83,0x40,0x80,0x90,0x82,0x88,0x0B,0x6F,0x6E,0x6C,0x79,0x20,0x72,0x65,0x74,0x75, // .@.....only.retu END
+	0x72,0x6E,0x73,0x80,0x0C,0x07,0x20,0x66,0x61,0x69,0x6C,0x75,0x72,0x65,0x85,0x6E, // rns....failure.n END
+	0x01,0x31,0x0A,0x81,0x6D,0x00,0x20,0x2F,0x65,0x78,0x69,0x74,0x0A,0x3B,0x20,0x73, // .1..m../exit.;.s END
+	0x75,0x63,0x63,0x65,0x73,0x73,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x70,0x61, // uccess.in.the.pa END
+	0x72,0x65,0x6E,0x74,0x20,0x2D,0x20,0x72,0x65,0x73,0x74,0x6F,0x72,0x65,0x20,0x73, // rent.-.restore.s END
+	0x74,0x61,0x63,0x6B,0x20,0x61,0x6E,0x64,0x80,0x11,0x03,0x74,0x75,0x72,0x6E,0x86, // tack.and...turn. END
+	0x30,0x34,0x28,0x72,0x30,0x20,0x61,0x6C,0x72,0x65,0x61,0x64,0x79,0x20,0x63,0x6F, // 04(r0.already.co END
+	0x6E,0x74,0x61,0x69,0x6E,0x73,0x20,0x50,0x49,0x44,0x20,0x6F,0x66,0x20,0x6E,0x65, // ntains.PID.of.ne END
+	0x77,0x20,0x63,0x68,0x69,0x6C,0x64,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x66, // w.child).label.f END
+	0x6F,0x72,0x6B,0x65,0x78,0x65,0x63,0x84,0x6D,0x08,0x0A,0x70,0x6F,0x70,0x31,0x36, // orkexec.m..pop16 END
+	0x20,0x72,0x32,0x81,0x08,0x04,0x38,0x20,0x72,0x31,0x0A,0x80,0x5C,0x00,0x0A,0x80, // .r2...8.r1..\... END
+	0x8D,0x04,0x65,0x72,0x72,0x6F,0x72,0x82,0x2D,0x02,0x69,0x6E,0x67,0xA7,0x93,0x06, // ..error.-.ing... END
+	0x66,0x61,0x69,0x6C,0x75,0x72,0x65,0x8C,0x6C,0x82,0x4C,0x8F,0x6A,0x03,0x6D,0x6F, // failure.l.L.j.mo END
+	0x76,0x20,0x80,0xBB,0x06,0x30,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xB6,0x00,0x1C,0x01, // v....0.ret...... END
+	0xB0,0x07,0x66,0x6F,0x72,0x6B,0x65,0x78,0x65,0x63,0x77,0x61,0x69,0x74,0x2E,0x73, // ..forkexecwait.s END
+	0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73, // .require.../...s END
+	0x79,0x73,0x81,0x03,0x05,0x63,0x61,0x6C,0x6C,0x2E,0x73,0x80,0x6B,0x82,0x1B,0x03, // ys...call.s.k... END
+	0x65,0x6E,0x64,0x20,0x85,0x35,0x80,0x15,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x86, // end..5....label. END
+	0x11,0x81,0x47,0x14,0x20,0x3B,0x20,0x74,0x61,0x6B,0x65,0x73,0x20,0x61,0x72,0x67, // ..G..;.takes.arg END
+	0x63,0x20,0x69,0x6E,0x20,0x72,0x30,0x20,0x61,0x80,0x35,0x80,0x0E,0x00,0x76,0x82, // c.in.r0.a.5...v. END
+	0x0E,0x04,0x31,0x20,0x74,0x6F,0x20,0x81,0x75,0x81,0x1C,0x00,0x61,0x83,0x4D,0x0A, // ..1.to..u...a.M. END
+	0x64,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x2C,0x20,0x81,0x8B,0x09,0x69,0x6E, // d.process,....in END
+	0x67,0x20,0x75,0x6E,0x74,0x69,0x6C,0x20,0x80,0x4F,0x06,0x63,0x6F,0x6D,0x70,0x6C, // g.until..O.compl END
+	0x65,0x74,0x80,0x51,0x01,0x62,0x65,0x80,0xB0,0x01,0x65,0x20,0x80,0xF6,0x03,0x75, // et.Q.be...e....u END
+	0x72,0x6E,0x69,0x28,0x6E,0x67,0x20,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x70,0x61, // rni(ng.in.the.pa END
+	0x72,0x65,0x6E,0x74,0x0A,0x3B,0x20,0x63,0x61,0x6C,0x6C,0x20,0x66,0x6F,0x72,0x6B, // rent.;.call.fork END
+	0x65,0x78,0x65,0x63,0x20,0x74,0x6F,0x20,0x73,0x74,0x61,0x72,0x74,0x82,0x23,0x05, // exec.to.start.#. END
+	0x63,0x68,0x69,0x6C,0x64,0x0A,0x8A,0x20,0x81,0x30,0x03,0x68,0x65,0x63,0x6B,0x81, // child....0.heck. END
+	0x31,0x03,0x20,0x62,0x61,0x64,0x82,0x39,0x09,0x0A,0x63,0x6D,0x70,0x20,0x72,0x31, // 1..bad.9..cmp.r1 END
+	0x20,0x72,0x30,0x80,0x02,0x08,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x80, // .r0....skipneqz. END
+	0x11,0x01,0x0A,0x6A,0x80,0x18,0x85,0x5B,0x05,0x77,0x61,0x69,0x74,0x72,0x65,0x81, // ...j...[.waitre. END
+	0x72,0x81,0x09,0x82,0x40,0x82,0x60,0x81,0x73,0x06,0x64,0x69,0x65,0x0A,0x6D,0x6F, // r...@.`.s.die.mo END
+	0x76,0x83,0x44,0x83,0x09,0x04,0x30,0x20,0x53,0x79,0x73,0x81,0x9C,0x02,0x49,0x64, // v.D...0.Sys...Id END
+	0x57,0x80,0x39,0x02,0x50,0x69,0x64,0x83,0x21,0x01,0x32,0x20,0x80,0x62,0x83,0x19, // W.9.Pid.!.2..b.. END
+	0x80,0xBD,0x08,0x64,0x6F,0x6E,0x65,0x0A,0x6C,0x61,0x62,0x65,0x87,0xC3,0x85,0x67, // ...done.labe...g END
+	0x81,0x6B,0x00,0xFF,0x8C,0x00,0x21,0x02,0x1F,0x09,0x73,0x75,0x69,0x63,0x69,0x64, // .k....!...suicid END
+	0x65,0x68,0x61,0x6E,0x64,0x6C,0x65,0x72,0x2E,0x73,0x00,0x3B,0x20,0x74,0x68,0x69, // ehandler.s.;.thi END
+	0x73,0x20,0x6D,0x6F,0x64,0x75,0x6C,0x65,0x20,0x80,0x09,0x1A,0x75,0x73,0x65,0x64, // s.module....used END
+	0x20,0x74,0x6F,0x20,0x65,0x61,0x73,0x69,0x6C,0x79,0x20,0x72,0x65,0x67,0x69,0x73, // .to.easily.regis END
+	0x74,0x65,0x72,0x20,0x61,0x20,0x62,0x80,0x11,0x01,0x63,0x20,0x84,0x41,0x00,0x20, // ter.a.b...c..A.. END
+	0x84,0x42,0x08,0x20,0x66,0x6F,0x72,0x20,0x73,0x69,0x6D,0x70,0x80,0x3D,0x09,0x70, // .B..for.simp.=.p END
+	0x72,0x6F,0x67,0x72,0x61,0x6D,0x73,0x0A,0x3B,0x86,0x0A,0x80,0x4E,0x16,0x69,0x6E, // rograms.;...N.in END
+	0x67,0x20,0x69,0x74,0x20,0x73,0x68,0x6F,0x75,0x6C,0x64,0x20,0x27,0x72,0x65,0x71, // g.it.should.'req END
+	0x75,0x69,0x72,0x65,0x27,0x81,0x13,0x08,0x61,0x73,0x20,0x6F,0x6E,0x65,0x20,0x6F, // uire'...as.one.o END
+	0x66,0x80,0x84,0x1C,0x65,0x20,0x76,0x65,0x72,0x79,0x20,0x66,0x69,0x72,0x73,0x74, // f...e.very.first END
+	0x20,0x69,0x6E,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6F,0x6E,0x73,0x20,0x28,0x77, // .instructions.(w END
+	0x69,0x80,0xA3,0x00,0x6E,0x84,0x1A,0x0B,0x32,0x35,0x36,0x20,0x62,0x79,0x74,0x65, // i...n...256.byte END
+	0x73,0x29,0x0A,0x0A,0x84,0x4B,0x03,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79, // s)...K..../...sy END
+	0x73,0x81,0x03,0x02,0x2E,0x73,0x0A,0x80,0x80,0x86,0xB7,0x84,0xEA,0x03,0x0A,0x6D, // s....s.........m END
+	0x6F,0x76,0x29,0x20,0x72,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64, // ov).r0.SyscallId END
+	0x52,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x53,0x69,0x67,0x6E,0x61,0x6C,0x48,0x61, // RegisterSignalHa END
+	0x6E,0x64,0x6C,0x65,0x72,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x83,0x14,0x08, // ndler.mov.r1.... END
+	0x49,0x64,0x53,0x75,0x69,0x63,0x69,0x64,0x65,0x83,0x16,0x02,0x32,0x20,0x73,0x83, // IdSuicide...2.s. END
+	0x0E,0x84,0x2C,0x06,0x53,0x74,0x61,0x72,0x74,0x0A,0x73,0x83,0x50,0x0E,0x0A,0x0A, // ..,.Start.s.P... END
+	0x3B,0x20,0x6A,0x75,0x6D,0x70,0x20,0x70,0x61,0x73,0x74,0x20,0x68,0x84,0x4E,0x00, // ;.jump.past.h.N. END
+	0x6A,0x80,0x10,0x8B,0x34,0x02,0x45,0x6E,0x64,0x81,0x2A,0x84,0x20,0x0C,0x20,0x2D, // j...4.End.*....- END
+	0x20,0x65,0x78,0x69,0x74,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x92,0x5E,0x82,0x90,0x88, // .exit.label.^... END
+	0xB6,0x00,0x45,0x81,0x2E,0x84,0xA5,0x00,0x31,0x89,0x7C,0x01,0x70,0x6F,0x87,0x77, // ..E.....1.|.po.w END
+	0x80,0x56,0x07,0x63,0x6F,0x6E,0x74,0x69,0x6E,0x75,0x65,0x80,0x5F,0x02,0x65,0x63, // .V.continue._.ec END
+	0x75,0x80,0x0A,0x02,0x67,0x20,0x70,0x1F,0x72,0x6F,0x67,0x72,0x61,0x6D,0x0A,0x6C, // u...g.p.rogram.l END
+	0x61,0x62,0x65,0x6C,0x20,0x73,0x75,0x69,0x63,0x69,0x64,0x65,0x48,0x61,0x6E,0x64, // abel.suicideHand END
+	0x6C,0x65,0x72,0x45,0x6E,0x64,0x0A,0xFF,0x9D,0x00};
+#endif
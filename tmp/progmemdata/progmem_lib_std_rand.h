@@ -0,0 +1,72 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_std_rand_H
+#define PROGMEM_lib_std_rand_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_std_randDATASIZE 863u
+#define PROGMEM_lib_std_randCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_std_randDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_std_randData))
+static const uint8_t progmem_lib_std_randData[PROGMEM_lib_std_randDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_std_randDATAPTR ((uintptr_t)progmem_lib_std_randData)
+static const uint8_t progmem_lib_std_randData[PROGMEM_lib_std_randDATASIZE]={
+#endif
+	0x5A,0x04,0x70,0x00,0x0F,0x00,0x83,0x01,0x57,0x02,0x24,0x02,0xF7,0x03,0x5F,0x03, // Z.p.....W.$..._. END
+	0x23,0x8D,0x10,0x00,0xF9,0x00,0x14,0x03,0xED,0x7E,0x72,0x61,0x6E,0x64,0x2E,0x73, // #........~rand.s END
+	0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73, // .require.../...s END
+	0x79,0x73,0x81,0x03,0x03,0x2E,0x73,0x0A,0x0A,0x84,0x18,0x02,0x65,0x6E,0x64,0x81, // ys....s.....end. END
+	0x1B,0x06,0x69,0x6F,0x2F,0x66,0x67,0x65,0x74,0x80,0x18,0x8B,0x17,0x06,0x6D,0x61, // ..io/fget.....ma END
+	0x74,0x68,0x2F,0x6D,0x6F,0x80,0x49,0x04,0x0A,0x0A,0x64,0x62,0x20,0x81,0x54,0x05, // th/mo.I...db..T. END
+	0x38,0x44,0x65,0x76,0x55,0x52,0x80,0x5D,0x02,0x6F,0x6D,0x50,0x80,0x1D,0x07,0x20, // 8DevUR.].omP.... END
+	0x27,0x2F,0x64,0x65,0x76,0x2F,0x75,0x81,0x6F,0x08,0x6F,0x6D,0x27,0x2C,0x30,0x0A, // '/dev/u.o.om',0. END
+	0x0A,0x6C,0x61,0x12,0x62,0x65,0x6C,0x20,0x72,0x61,0x6E,0x64,0x38,0x20,0x3B,0x20, // .la.bel.rand8.;. END
+	0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x82,0x0F,0x21,0x6F,0x6D,0x20,0x38,0x2D,0x62, // returns..!om.8-b END
+	0x69,0x74,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x69,0x6E,0x20,0x72,0x30,0x0A,0x3B, // it.value.in.r0.; END
+	0x20,0x4F,0x70,0x65,0x6E,0x20,0x2F,0x64,0x65,0x76,0x2F,0x75,0x83,0x25,0x03,0x0A, // .Open./dev/u.%.. END
+	0x6D,0x6F,0x76,0x80,0x1A,0x09,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64, // mov....SyscallId END
+	0x81,0x21,0x83,0x14,0x00,0x31,0x83,0x58,0x04,0x44,0x65,0x76,0x55,0x52,0x82,0x51, // .!...1.X.DevUR.Q END
+	0x03,0x50,0x61,0x74,0x68,0x83,0x2F,0x0B,0x32,0x20,0x46,0x64,0x4D,0x6F,0x64,0x65, // .Path./.2.FdMode END
+	0x52,0x4F,0x0A,0x73,0x83,0x38,0x03,0x0A,0x63,0x6D,0x70,0x82,0x32,0x00,0x30,0x81, // RO.s.8..cmp.2.0. END
+	0x68,0x07,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x80,0x44,0x01,0x0A,0x6A,0x81, // h.skipneqz.D..j. END
+	0x18,0x81,0xA1,0x01,0x42,0x61,0x83,0x5C,0x17,0x3B,0x20,0x52,0x65,0x61,0x64,0x20, // ....Ba.\.;.Read. END
+	0x61,0x20,0x73,0x69,0x6E,0x67,0x6C,0x65,0x20,0x62,0x79,0x74,0x65,0x20,0x28,0x38, // a.single.byte.(8 END
+	0x20,0x80,0xAD,0x07,0x73,0x29,0x0A,0x70,0x75,0x73,0x68,0x38,0x81,0xAC,0x84,0x83, // ....s).push8.... END
+	0x01,0x30,0x0A,0x81,0x97,0x05,0x20,0x66,0x67,0x65,0x74,0x63,0x85,0x7C,0x82,0xCA, // .0.....fgetc.|.. END
+	0x05,0x43,0x6C,0x6F,0x73,0x65,0x20,0x23,0x66,0x69,0x6C,0x65,0x0A,0x6D,0x6F,0x76, // .Close.#file.mov END
+	0x20,0x72,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x43,0x6C,0x6F, // .r0.SyscallIdClo END
+	0x73,0x65,0x0A,0x70,0x6F,0x70,0x38,0x20,0x72,0x31,0x0A,0x73,0x83,0x16,0x16,0x0A, // se.pop8.r1.s.... END
+	0x3B,0x20,0x4D,0x6F,0x76,0x65,0x20,0x72,0x65,0x61,0x64,0x20,0x76,0x61,0x6C,0x75, // ;.Move.read.valu END
+	0x65,0x20,0x69,0x6E,0x74,0x6F,0x81,0x38,0x81,0x05,0x04,0x65,0x74,0x75,0x72,0x6E, // e.into.8...eturn END
+	0x80,0x23,0x13,0x41,0x6C,0x73,0x6F,0x20,0x41,0x4E,0x44,0x20,0x69,0x74,0x20,0x77, // .#.Also.AND.it.w END
+	0x69,0x74,0x68,0x20,0x32,0x35,0x35,0x80,0x28,0x0A,0x20,0x63,0x61,0x73,0x65,0x20, // ith.255.(..case. END
+	0x66,0x67,0x65,0x74,0x63,0x84,0x2B,0x05,0x65,0x64,0x20,0x45,0x4F,0x46,0x85,0x7B, // fgetc.+.ed.EOF.{ END
+	0x01,0x72,0x32,0x83,0x85,0x00,0x31,0x81,0x2F,0x03,0x0A,0x61,0x6E,0x64,0x82,0x14, // .r2...1./..and.. END
+	0x80,0x17,0x01,0x31,0x0A,0x80,0x5A,0x80,0x7B,0x04,0x45,0x72,0x72,0x6F,0x72,0x82, // ...1..Z.{.Error. END
+	0x45,0x07,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x72,0x80,0x24,0x07,0x38,0x42,0x61, // E..label.r.$.8Ba END
+	0x64,0x4F,0x70,0x65,0x6E,0x85,0xC1,0x00,0x30,0x82,0x2C,0x88,0x20,0x03,0x31,0x36, // dOpen...0.,...16 END
+	0x20,0x3B,0x84,0x9B,0x00,0x73,0x82,0x31,0x06,0x6F,0x6D,0x20,0x31,0x36,0x2D,0x62, // .;...s.1.om.16-b END
+	0x80,0x9C,0x83,0xC2,0x1E,0x69,0x6E,0x20,0x72,0x30,0x0A,0x3B,0x20,0x43,0x61,0x6C, // .....in.r0.;.Cal END
+	0x6C,0x20,0x72,0x61,0x6E,0x64,0x38,0x20,0x74,0x77,0x69,0x63,0x65,0x20,0x74,0x6F, // l.rand8.twice.to END
+	0x20,0x67,0x65,0x74,0x80,0x0C,0x0F,0x6F,0x20,0x38,0x20,0x62,0x69,0x74,0x20,0x76, // .get...o.8.bit.v END
+	0x61,0x6C,0x75,0x65,0x73,0x0A,0x63,0x86,0x28,0x05,0x0A,0x70,0x75,0x73,0x68,0x38, // alues.c.(..push8 END
+	0x81,0x3E,0x89,0x13,0x01,0x6F,0x70,0x80,0x12,0x00,0x31,0x81,0x51,0x05,0x6F,0x6D, // .>...op...1.Q.om END
+	0x62,0x69,0x6E,0x65,0x80,0x5E,0x00,0x20,0x80,0x56,0x80,0x13,0x81,0x52,0x0D,0x6D, // bine.^...V...R.m END
+	0x61,0x6B,0x65,0x20,0x73,0x69,0x6E,0x67,0x6C,0x65,0x20,0x31,0x36,0x87,0x57,0x0B, // ake.single.16.W. END
+	0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x38,0x0A,0x73,0x68,0x80,0x87,0x00,0x30, // .mov.r2.8.sh...0 END
+	0x82,0x02,0x03,0x32,0x0A,0x6F,0x72,0x85,0x0B,0x0A,0x31,0x0A,0x72,0x65,0x74,0x0A, // ...2.or...1.ret. END
+	0x0A,0x6C,0x61,0x62,0x65,0x83,0xA7,0x0C,0x4E,0x20,0x3B,0x20,0x28,0x72,0x30,0x3D, // .labe...N.;.(r0= END
+	0x6E,0x29,0x20,0x2D,0x20,0x80,0x1B,0x03,0x75,0x72,0x6E,0x73,0x82,0xC0,0x09,0x6F, // n).-....urns...o END
+	0x6D,0x20,0x69,0x6E,0x74,0x65,0x67,0x65,0x72,0x80,0x07,0x82,0x0A,0x00,0x72,0x80, // m.integer.....r. END
+	0xBA,0x05,0x20,0x5B,0x30,0x2C,0x6E,0x29,0x80,0xE8,0x09,0x47,0x65,0x6E,0x65,0x72, // ...[0,n)...Gener END
+	0x61,0x74,0x65,0x20,0x61,0x82,0x80,0x22,0x69,0x74,0x20,0x6E,0x75,0x6D,0x62,0x65, // ate.a.."it.numbe END
+	0x72,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x0A,0x63,0x61,0x6C,0x6C, // r.push16.r0.call END
+	0x20,0x72,0x61,0x6E,0x64,0x31,0x36,0x0A,0x70,0x6F,0x70,0x81,0x14,0x14,0x31,0x0A, // .rand16.pop...1. END
+	0x3B,0x20,0x55,0x73,0x65,0x20,0x6D,0x6F,0x64,0x20,0x74,0x6F,0x20,0x72,0x65,0x64, // ;.Use.mod.to.red END
+	0x75,0x63,0x65,0x82,0x23,0x0C,0x6F,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x64, // uce.#.om.value.d END
+	0x6F,0x77,0x6E,0x81,0x1B,0x06,0x63,0x6F,0x72,0x72,0x65,0x63,0x74,0x81,0x40,0x01, // own...correct.@. END
+	0x67,0x65,0x83,0x4B,0x80,0x35,0x07,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xFF,0xFF};
+#endif
@@ -0,0 +1,319 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_std_str_H
+#define PROGMEM_lib_std_str_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_std_strDATASIZE 4805u
+#define PROGMEM_lib_std_strCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_std_strDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_std_strData))
+static const uint8_t progmem_lib_std_strData[PROGMEM_lib_std_strDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_std_strDATAPTR ((uintptr_t)progmem_lib_std_strData)
+static const uint8_t progmem_lib_std_strData[PROGMEM_lib_std_strDATASIZE]={
+#endif
+	0x5A,0x18,0x80,0x00,0x37,0x00,0xC0,0x01,0x9C,0x02,0x66,0x03,0x42,0x04,0x05,0x04, // Z...7.....f.B... END
+	0xC0,0x05,0x77,0x06,0x54,0x07,0x23,0x07,0xE9,0x08,0xB7,0x09,0x9F,0x0A,0x90,0x0B, // ..w.T.#......... END
+	0x2E,0x0B,0xE3,0x0C,0x79,0x0D,0x05,0x0D,0xE2,0x0E,0xB2,0x0F,0x93,0x10,0x72,0x11, // ....y.........r. END
+	0x2E,0x11,0xC7,0x12,0x51,0x12,0xC5,0x0F,0x25,0xC3,0x04,0x1C,0x34,0x42,0x4B,0x56, // ....Q...%...4BKV END
+	0x5E,0x8E,0x96,0xA4,0xAA,0xB4,0xBC,0x00,0xED,0x00,0x12,0x02,0xF2,0x18,0x73,0x74, // ^.............st END
+	0x72,0x74,0x6F,0x69,0x6E,0x74,0x2E,0x73,0x00,0x3B,0x20,0x72,0x30,0x3D,0x85,0x0F, // rtoint.s.;.r0=.. END
+	0x00,0x28,0x80,0x18,0x21,0x3D,0x72,0x30,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6E, // .(..!=r0).return END
+	0x73,0x20,0x30,0x20,0x6F,0x6E,0x20,0x62,0x61,0x64,0x20,0x69,0x6E,0x70,0x75,0x74, // s.0.on.bad.input END
+	0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x85,0x3D,0x18,0x0A,0x3B,0x20,0x4C,0x6F,0x6F, // .label..=..;.Loo END
+	0x70,0x20,0x6F,0x76,0x65,0x72,0x20,0x65,0x61,0x63,0x68,0x20,0x63,0x68,0x61,0x72, // p.over.each.char END
+	0x61,0x63,0x74,0x80,0x0E,0x0B,0x69,0x6E,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76, // act...in.the.giv END
+	0x65,0x6E,0x81,0x30,0x0A,0x69,0x6E,0x67,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20, // en.0.ing.mov.r1. END
+	0x3D,0x30,0x20,0x3B,0x20,0x72,0x75,0x6E,0x6E,0x69,0x6E,0x67,0x20,0x74,0x6F,0x74, // =0.;.running.tot END
+	0x61,0x6C,0x2F,0x66,0x69,0x6E,0x61,0x6C,0x20,0x76,0x61,0x6C,0x75,0x65,0x0A,0x6C, // al/final.value.l END
+	0x61,0x62,0x65,0x6C,0x20,0x73,0x74,0x72,0x74,0x6F,0x69,0x6E,0x74,0x4C,0x6F,0x6F, // abel.strtointLoo END
+	0x70,0x53,0x74,0x61,0x72,0x74,0x0A,0x3B,0x20,0x52,0x65,0x61,0x64,0x20,0x73,0x80, // pStart.;.Read.s. END
+	0x35,0x19,0x6C,0x65,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x61, // 5.le.character.a END
+	0x6E,0x64,0x20,0x67,0x65,0x74,0x20,0x64,0x69,0x67,0x69,0x74,0x85,0x43,0x0E,0x6F, // nd.get.digit.C.o END
+	0x61,0x64,0x38,0x20,0x72,0x32,0x20,0x72,0x30,0x0A,0x64,0x65,0x63,0x34,0x82,0x0B, // ad8.r2.r0.dec4.. END
+	0x05,0x3B,0x20,0x73,0x75,0x62,0x74,0x81,0x35,0x09,0x20,0x27,0x30,0x27,0x20,0x61, // .;.subt.5..'0'.a END
+	0x73,0x63,0x69,0x69,0x83,0x73,0x80,0x85,0x82,0x42,0x02,0x72,0x61,0x77,0x8A,0x46, // scii.s...B.raw.F END
+	0x0D,0x3B,0x20,0x43,0x68,0x65,0x63,0x6B,0x20,0x66,0x6F,0x72,0x20,0x69,0x6E,0x80, // .;.Check.for.in. END
+	0x9E,0x01,0x69,0x64,0x88,0x78,0x0E,0x28,0x6F,0x75,0x74,0x73,0x69,0x64,0x65,0x20, // ..id.x.(outside. END
+	0x6F,0x66,0x20,0x30,0x2D,0x39,0x80,0x3D,0x10,0x6E,0x67,0x65,0x29,0x0A,0x6D,0x6F, // of.0-9.=.nge).mo END
+	0x76,0x20,0x72,0x33,0x20,0x30,0x0A,0x63,0x6D,0x70,0x81,0x08,0x81,0x85,0x07,0x33, // v.r3.0.cmp.....3 END
+	0x0A,0x73,0x6B,0x69,0x70,0x67,0x65,0x81,0x09,0x01,0x6A,0x6D,0x1D,0x70,0x20,0x73, // .skipge...jm.p.s END
+	0x74,0x72,0x74,0x6F,0x69,0x6E,0x74,0x4C,0x6F,0x6F,0x70,0x45,0x6E,0x64,0x0A,0x6D, // trtointLoopEnd.m END
+	0x6F,0x76,0x20,0x72,0x33,0x20,0x39,0x0A,0x63,0x6D,0x70,0x81,0x08,0x01,0x72,0x32, // ov.r3.9.cmp...r2 END
+	0x80,0x0E,0x06,0x0A,0x73,0x6B,0x69,0x70,0x6C,0x65,0x81,0x09,0x00,0x6A,0x80,0x16, // ....skiple...j.. END
+	0x8D,0x33,0x15,0x3B,0x20,0x41,0x64,0x64,0x20,0x64,0x69,0x67,0x69,0x74,0x20,0x74, // .3.;.Add.digit.t END
+	0x6F,0x20,0x72,0x75,0x6E,0x6E,0x69,0x6E,0x67,0x80,0x0A,0x08,0x74,0x61,0x6C,0x20, // o.running...tal. END
+	0x28,0x6D,0x75,0x6C,0x74,0x80,0x3D,0x00,0x79,0x81,0x12,0x04,0x65,0x78,0x69,0x73, // (mult.=.y...exis END
+	0x74,0x81,0x1B,0x8B,0x23,0x0F,0x76,0x61,0x6C,0x75,0x65,0x20,0x62,0x79,0x20,0x31, // t...#.value.by.1 END
+	0x30,0x20,0x66,0x69,0x72,0x73,0x82,0x46,0x04,0x73,0x68,0x69,0x66,0x74,0x83,0x55, // 0.firs.F.shift.U END
+	0x03,0x73,0x20,0x6C,0x65,0x80,0x0B,0x03,0x6F,0x6E,0x65,0x29,0x85,0xA0,0x02,0x31, // .s.le...one)...1 END
+	0x30,0x0A,0x80,0x58,0x02,0x20,0x72,0x31,0x82,0x02,0x02,0x33,0x0A,0x61,0x80,0x81, // 0..X..r1...3.a.. END
+	0x84,0x0C,0x00,0x32,0x82,0x90,0x04,0x76,0x61,0x6E,0x63,0x65,0x81,0x8E,0x14,0x6E, // ...2...vance...n END
+	0x65,0x78,0x74,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x0A,0x69,0x6E, // ext.character.in END
+	0x63,0x20,0x72,0x30,0x84,0xC7,0x17,0x72,0x74,0x6F,0x69,0x6E,0x74,0x4C,0x6F,0x6F, // c.r0...rtointLoo END
+	0x70,0x53,0x74,0x61,0x72,0x74,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x73,0x74,0x87, // pStart.label.st. END
+	0x17,0x23,0x45,0x6E,0x64,0x0A,0x3B,0x20,0x46,0x69,0x6E,0x69,0x73,0x68,0x65,0x64, // .#End.;.Finished END
+	0x20,0x2D,0x20,0x6D,0x6F,0x76,0x65,0x20,0x72,0x75,0x6E,0x6E,0x69,0x6E,0x67,0x20, // .-.move.running. END
+	0x74,0x6F,0x74,0x61,0x6C,0x20,0x80,0x42,0x03,0x6F,0x20,0x72,0x30,0x80,0x0D,0x0A, // total..B.o.r0... END
+	0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x20,0x66,0x69,0x6E,0x80,0x17,0x05,0x76,0x61, // .return.fin...va END
+	0x6C,0x75,0x65,0x0A,0x80,0x30,0x81,0x1C,0x02,0x72,0x31,0x0A,0x80,0x1C,0x01,0x0A, // lue..0...r1..... END
+	0xFF,0x8A,0x00,0x02,0x02,0xFD,0x18,0x80,0x6C,0x0C,0x70,0x61,0x64,0x2E,0x73,0x00, // ........l.pad.s. END
+	0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x81,0x7D,0x04,0x63,0x61,0x74,0x2E,0x73,0x80, // require.}.cat.s. END
+	0x2E,0x86,0x10,0x02,0x6C,0x65,0x6E,0x80,0x10,0x02,0x0A,0x64,0x62,0x81,0x9B,0x80, // ....len....db... END
+	0x2E,0x04,0x73,0x70,0x61,0x63,0x65,0x80,0xA6,0x07,0x20,0x27,0x20,0x27,0x2C,0x20, // ..space....'.',. END
+	0x30,0x0A,0x80,0xA2,0x83,0x47,0x06,0x66,0x72,0x6F,0x6E,0x74,0x28,0x64,0x80,0x1B, // 0....G.front(d.. END
+	0x0C,0x3D,0x72,0x30,0x2C,0x20,0x73,0x72,0x63,0x3D,0x72,0x31,0x2C,0x20,0x80,0x3F, // .=r0,.src=r1,..? END
+	0x03,0x3D,0x72,0x32,0x29,0x80,0xBE,0x05,0x63,0x6F,0x70,0x69,0x65,0x73,0x81,0x18, // .=r2)...copies.. END
+	0x81,0xAE,0x3D,0x64,0x65,0x73,0x74,0x2C,0x20,0x70,0x61,0x64,0x64,0x69,0x6E,0x67, // ..=dest,.padding END
+	0x20,0x77,0x69,0x74,0x68,0x20,0x73,0x70,0x61,0x63,0x65,0x73,0x20,0x69,0x66,0x20, // .with.spaces.if. END
+	0x73,0x72,0x63,0x20,0x69,0x73,0x20,0x73,0x6D,0x61,0x6C,0x6C,0x65,0x72,0x20,0x74, // src.is.smaller.t END
+	0x68,0x61,0x6E,0x20,0x6C,0x65,0x6E,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x73,0x74, // han.len.label.st END
+	0x72,0x80,0x37,0x0D,0x66,0x72,0x6F,0x6E,0x74,0x0A,0x0A,0x3B,0x20,0x4D,0x61,0x6B, // r.7.front..;.Mak END
+	0x65,0x20,0x81,0x4E,0x05,0x20,0x65,0x6D,0x70,0x74,0x79,0x81,0x1E,0x81,0x52,0x19, // e..N..empty...R. END
+	0x66,0x6F,0x72,0x20,0x6E,0x6F,0x77,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x30, // for.now.mov.r3.0 END
+	0x0A,0x73,0x74,0x6F,0x72,0x65,0x38,0x20,0x72,0x30,0x80,0x0E,0x81,0x37,0x03,0x46, // .store8.r0...7.F END
+	0x69,0x6E,0x64,0x81,0x55,0x00,0x67,0x80,0x7A,0x00,0x6F,0x82,0x73,0x06,0x0A,0x70, // ind.U.g.z.o.s..p END
+	0x75,0x73,0x68,0x31,0x36,0x80,0x22,0x86,0x09,0x00,0x31,0x86,0x13,0x01,0x32,0x0A, // ush16."...1...2. END
+	0x83,0x4A,0x80,0x3E,0x02,0x31,0x0A,0x63,0x80,0x98,0x81,0x87,0x81,0x94,0x84,0x60, // .J.>.1.c.......` END
+	0x80,0x34,0x03,0x0A,0x70,0x6F,0x70,0x83,0x2A,0x84,0x08,0x80,0x3D,0x83,0x11,0x80, // .4..pop.*...=... END
+	0x1B,0x00,0x3B,0x8B,0xD8,0x12,0x6C,0x6C,0x65,0x72,0x20,0x74,0x68,0x61,0x6E,0x20, // ..;...ller.than. END
+	0x6C,0x65,0x6E,0x2C,0x20,0x77,0x65,0x20,0x63,0x80,0x0B,0x16,0x70,0x61,0x64,0x0A, // len,.we.c...pad. END
+	0x63,0x6D,0x70,0x20,0x72,0x34,0x20,0x72,0x33,0x20,0x72,0x32,0x0A,0x73,0x6B,0x69, // cmp.r4.r3.r2.ski END
+	0x70,0x6C,0x74,0x80,0x0F,0x01,0x0A,0x6A,0x80,0x16,0x02,0x73,0x74,0x72,0x80,0x21, // plt....j...str.! END
+	0x18,0x63,0x6F,0x70,0x79,0x0A,0x0A,0x3B,0x20,0x61,0x70,0x70,0x65,0x6E,0x64,0x20, // .copy..;.append. END
+	0x73,0x70,0x61,0x63,0x65,0x73,0x0A,0x73,0x75,0x62,0x80,0x30,0x82,0x02,0x02,0x33, // spaces.sub.0...3 END
+	0x20,0x3B,0x81,0x0A,0x10,0x6E,0x6F,0x77,0x20,0x63,0x6F,0x6E,0x74,0x61,0x69,0x6E, // .;...now.contain END
+	0x73,0x20,0x6E,0x75,0x6D,0x62,0x80,0x71,0x01,0x6F,0x66,0x84,0x2F,0x02,0x20,0x74, // s.numb.q.of./..t END
+	0x6F,0x84,0x40,0x05,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x84,0x5B,0x83,0x4C,0x03,0x74, // o.@..label.[.L.t END
+	0x61,0x72,0x74,0x83,0x87,0x81,0x84,0x85,0x87,0x03,0x6E,0x65,0x71,0x7A,0x80,0x96, // art.......neqz.. END
+	0x88,0x89,0x82,0x7A,0x81,0x42,0x08,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30, // ...z.B.push16.r0 END
+	0x86,0x09,0x00,0x31,0x86,0x13,0x04,0x32,0x0A,0x6D,0x6F,0x76,0x80,0x10,0x8B,0x61, // ...1...2.mov...a END
+	0x15,0x72,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x73,0x74,0x72,0x63,0x61,0x74,0x0A,0x70, // .r.call.strcat.p END
+	0x6F,0x70,0x31,0x36,0x20,0x72,0x32,0x85,0x08,0x00,0x31,0x85,0x11,0x04,0x30,0x0A, // op16.r2...1...0. END
+	0x64,0x65,0x63,0x81,0x18,0x02,0x6A,0x6D,0x70,0x81,0x2C,0x11,0x70,0x61,0x64,0x73, // dec...jmp.,.pads END
+	0x70,0x61,0x63,0x65,0x73,0x74,0x61,0x72,0x74,0x0A,0x6C,0x61,0x62,0x65,0x82,0x43, // pacestart.labe.C END
+	0x85,0x16,0x03,0x65,0x6E,0x64,0x0A,0x8A,0x15,0x03,0x63,0x6F,0x70,0x79,0x8A,0x69, // ...end....copy.i END
+	0x0A,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xFF,0xFF,0x01,0xB6,0x0E,0x80,0x7B,0x14,0x74, // ..ret........{.t END
+	0x72,0x69,0x6D,0x6E,0x65,0x77,0x6C,0x69,0x6E,0x65,0x2E,0x73,0x00,0x72,0x65,0x71, // rimnewline.s.req END
+	0x75,0x69,0x72,0x65,0x81,0x94,0x07,0x6C,0x65,0x6E,0x2E,0x73,0x0A,0x0A,0x3B,0x81, // uire...len.s..;. END
+	0xA0,0x88,0x24,0x03,0x28,0x72,0x30,0x3D,0x80,0xB2,0x08,0x20,0x61,0x64,0x64,0x72, // ..$.(r0=....addr END
+	0x29,0x20,0x2D,0x20,0x81,0x3F,0x01,0x73,0x20,0x84,0x41,0x05,0x20,0x66,0x72,0x6F, // ).-..?.s..A..fro END
+	0x6D,0x20,0x80,0x82,0x0B,0x20,0x28,0x69,0x66,0x20,0x65,0x78,0x69,0x73,0x74,0x73, // m.....(if.exists END
+	0x29,0x87,0xA3,0x88,0x6B,0x80,0x57,0x32,0x46,0x69,0x6E,0x64,0x20,0x61,0x64,0x64, // )...k.W2Find.add END
+	0x72,0x20,0x6F,0x66,0x20,0x6C,0x61,0x73,0x74,0x20,0x63,0x68,0x61,0x72,0x0A,0x70, // r.of.last.char.p END
+	0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x0A,0x63,0x61,0x6C,0x6C,0x20,0x73,0x74, // ush16.r0.call.st END
+	0x72,0x6C,0x65,0x6E,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x81,0x15,0x02,0x70,0x6F, // rlen.mov.r1...po END
+	0x70,0x83,0x1E,0x06,0x0A,0x63,0x6D,0x70,0x20,0x72,0x32,0x82,0x16,0x09,0x31,0x0A, // p....cmp.r2...1. END
+	0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x7A,0x80,0x11,0x01,0x0A,0x6A,0x80,0x18,0x80, // skipneqz....j... END
+	0x37,0x0F,0x74,0x72,0x69,0x6D,0x6E,0x65,0x77,0x6C,0x69,0x6E,0x65,0x65,0x6E,0x64, // 7.trimnewlineend END
+	0x0A,0x0A,0x80,0x6B,0x82,0x2F,0x00,0x30,0x81,0x2F,0x02,0x64,0x65,0x63,0x81,0x2A, // ...k./.0./.dec.* END
+	0x0B,0x0A,0x3B,0x20,0x49,0x6E,0x73,0x65,0x72,0x74,0x20,0x6E,0x75,0x80,0x6D,0x21, // ..;.Insert.nu.m! END
+	0x62,0x79,0x74,0x65,0x20,0x74,0x6F,0x20,0x74,0x72,0x75,0x6E,0x63,0x61,0x74,0x65, // byte.to.truncate END
+	0x2C,0x20,0x62,0x75,0x74,0x20,0x6F,0x6E,0x6C,0x79,0x20,0x64,0x6F,0x20,0x73,0x6F, // ,.but.only.do.so END
+	0x20,0x69,0x88,0xAA,0x08,0x61,0x63,0x74,0x65,0x72,0x20,0x69,0x73,0x20,0x84,0x64, // .i...acter.is..d END
+	0x08,0x0A,0x6C,0x6F,0x61,0x64,0x38,0x20,0x72,0x33,0x81,0x83,0x82,0xB0,0x05,0x34, // ..load8.r3.....4 END
+	0x20,0x27,0x5C,0x6E,0x27,0x83,0xA8,0x00,0x34,0x82,0x18,0x01,0x34,0x0A,0x83,0xCA, // .'\n'...4...4... END
+	0x02,0x33,0x20,0x30,0x36,0x0A,0x73,0x6B,0x69,0x70,0x6E,0x65,0x71,0x20,0x72,0x34, // .3.06.skipneq.r4 END
+	0x0A,0x73,0x74,0x6F,0x72,0x65,0x38,0x20,0x72,0x32,0x20,0x72,0x33,0x0A,0x0A,0x6C, // .store8.r2.r3..l END
+	0x61,0x62,0x65,0x6C,0x20,0x73,0x74,0x72,0x74,0x72,0x69,0x6D,0x6E,0x65,0x77,0x6C, // abel.strtrimnewl END
+	0x69,0x6E,0x65,0x65,0x6E,0x64,0x0A,0x72,0x65,0x74,0x0A,0xFF,0x86,0x00,0x02,0x01, // ineend.ret...... END
+	0x0C,0x09,0x80,0x22,0x14,0x72,0x65,0x70,0x6C,0x61,0x63,0x65,0x2E,0x73,0x00,0x72, // ...".replace.s.r END
+	0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73, // equire.../...sys END
+	0x81,0x03,0x0C,0x63,0x61,0x6C,0x6C,0x2E,0x73,0x0A,0x0A,0x3B,0x20,0x72,0x30,0x3D, // ...call.s..;.r0= END
+	0x87,0x2E,0x0D,0x28,0x68,0x61,0x79,0x73,0x74,0x61,0x63,0x6B,0x3D,0x72,0x30,0x2C, // ...(haystack=r0, END
+	0x20,0x80,0x5D,0x07,0x64,0x6C,0x65,0x3D,0x72,0x31,0x2C,0x20,0x84,0x4E,0x0F,0x3D, // ..].dle=r1,..N.= END
+	0x72,0x32,0x29,0x20,0x2D,0x20,0x6E,0x6F,0x74,0x65,0x3A,0x20,0x66,0x6F,0x72,0x80, // r2).-.note:.for. END
+	0x09,0x0D,0x77,0x20,0x74,0x68,0x69,0x73,0x20,0x61,0x73,0x73,0x75,0x6D,0x65,0x73, // ..w.this.assumes END
+	0x81,0x9D,0x03,0x6C,0x65,0x6E,0x28,0x84,0x7E,0x01,0x29,0x3C,0x81,0x5C,0x81,0x10, // ...len(.~.)<.\.. END
+	0x83,0x4B,0x00,0x29,0x87,0xC3,0x84,0xA0,0x80,0x81,0x03,0x55,0x73,0x65,0x20,0x84, // .K.).......Use.. END
+	0x92,0x81,0x53,0x0F,0x20,0x73,0x70,0x65,0x65,0x64,0x0A,0x6D,0x6F,0x76,0x20,0x72, // ..S..speed.mov.r END
+	0x33,0x20,0x72,0x32,0x83,0x09,0x03,0x32,0x20,0x72,0x31,0x83,0x13,0x03,0x31,0x20, // 3.r2...2.r1...1. END
+	0x72,0x30,0x83,0x1D,0x16,0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64, // r0...0.SyscallId END
+	0x53,0x74,0x72,0x52,0x65,0x70,0x6C,0x61,0x63,0x65,0x0A,0x73,0x83,0x13,0x05,0x0A, // StrReplace.s.... END
+	0x72,0x65,0x74,0x0A,0xFF,0x90,0x00,0x13,0x01,0x44,0x0B,0x73,0x74,0x72,0x63,0x70, // ret......D.strcp END
+	0x79,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x80,0x10,0x04,0x6C, // y.s.require....l END
+	0x65,0x6E,0x2E,0x73,0x80,0x34,0x83,0x10,0x05,0x2E,0x2E,0x2F,0x6D,0x65,0x6D,0x81, // en.s.4...../mem. END
+	0x03,0x80,0x87,0x00,0x65,0x80,0x18,0x01,0x0A,0x3B,0x81,0x24,0x80,0x35,0x10,0x28, // ....e....;.$.5.( END
+	0x64,0x65,0x73,0x74,0x41,0x64,0x64,0x72,0x3D,0x72,0x30,0x2C,0x20,0x73,0x72,0x63, // destAddr=r0,.src END
+	0x83,0x0B,0x07,0x31,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x84,0x25,0x80,0x2E,0x06, // ...1).label.%... END
+	0x70,0x72,0x6F,0x74,0x65,0x63,0x74,0x81,0x5B,0x01,0x20,0x61,0x80,0x2F,0x0B,0x65, // protect.[..a./.e END
+	0x73,0x73,0x65,0x73,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x81,0xC2,0x85,0x09,0x00, // sses.push16..... END
+	0x31,0x80,0x5A,0x81,0xC4,0x84,0x84,0x00,0x20,0x1B,0x6F,0x6E,0x20,0x73,0x72,0x63, // 1.Z.......on.src END
+	0x20,0x73,0x74,0x72,0x69,0x6E,0x67,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x72, // .string.mov.r0.r END
+	0x31,0x0A,0x63,0x61,0x6C,0x6C,0x81,0x15,0x0C,0x6C,0x65,0x6E,0x0A,0x3B,0x20,0x75, // 1.call...len.;.u END
+	0x73,0x65,0x20,0x6D,0x65,0x6D,0x80,0x1E,0x10,0x65,0x20,0x74,0x6F,0x20,0x64,0x6F, // se.mem...e.to.do END
+	0x20,0x63,0x6F,0x70,0x79,0x20,0x6C,0x6F,0x6F,0x70,0x83,0x33,0x00,0x32,0x80,0x36, // .copy.loop.3.2.6 END
+	0x03,0x0A,0x69,0x6E,0x63,0x81,0x09,0x01,0x3B,0x20,0x80,0x08,0x06,0x72,0x65,0x6D, // ..inc...;....rem END
+	0x65,0x6E,0x74,0x20,0x80,0x3E,0x02,0x67,0x74,0x68,0x81,0x33,0x80,0x1C,0x06,0x6C, // ent..>.gth.3...l END
+	0x75,0x64,0x65,0x20,0x6E,0x75,0x80,0x58,0x0F,0x74,0x65,0x72,0x6D,0x69,0x6E,0x61, // ude.nu.X.termina END
+	0x74,0x6F,0x72,0x0A,0x70,0x6F,0x70,0x31,0x36,0x81,0x71,0x84,0x08,0x00,0x30,0x83, // tor.pop16.q...0. END
+	0x7A,0x84,0x6D,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0x98,0x00,0x02,0x00,0xFF,0x08, // z.m..ret........ END
+	0x80,0xBB,0x10,0x63,0x68,0x72,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65, // ...chr.s.require END
+	0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x81,0xC8,0x02,0x2E, // .../...sys...... END
+	0x73,0x0A,0x80,0xC4,0x02,0x72,0x30,0x3D,0x83,0x2A,0x00,0x28,0x80,0x09,0x07,0x68, // s....r0=.*.(...h END
+	0x61,0x79,0x73,0x74,0x61,0x63,0x6B,0x15,0x20,0x61,0x64,0x64,0x72,0x2C,0x20,0x72, // aystack..addr,.r END
+	0x31,0x3D,0x6E,0x65,0x65,0x64,0x6C,0x65,0x20,0x63,0x68,0x61,0x72,0x29,0x80,0x10, // 1=needle.char).. END
+	0x03,0x30,0x20,0x69,0x73,0x82,0x1C,0x20,0x20,0x6F,0x66,0x20,0x66,0x69,0x72,0x73, // .0.is....of.firs END
+	0x74,0x20,0x6F,0x63,0x63,0x75,0x72,0x65,0x6E,0x63,0x65,0x2C,0x20,0x6F,0x72,0x20, // t.occurence,.or. END
+	0x30,0x20,0x6F,0x6E,0x20,0x66,0x61,0x69,0x6C,0x80,0x13,0x29,0x0A,0x6C,0x61,0x62, // 0.on.fail..).lab END
+	0x65,0x6C,0x20,0x73,0x74,0x72,0x63,0x68,0x72,0x0A,0x3B,0x20,0x73,0x69,0x6D,0x70, // el.strchr.;.simp END
+	0x6C,0x79,0x20,0x75,0x73,0x65,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x20,0x61, // ly.use.syscall.a END
+	0x73,0x20,0x6B,0x65,0x72,0x6E,0x81,0x25,0x03,0x70,0x61,0x63,0x65,0x81,0x5D,0x03, // s.kern.%.pace.]. END
+	0x6D,0x75,0x63,0x68,0x80,0x41,0x0A,0x73,0x74,0x65,0x72,0x0A,0x6D,0x6F,0x76,0x20, // much.A.ster.mov. END
+	0x72,0x32,0x80,0x87,0x83,0x09,0x00,0x31,0x80,0x80,0x83,0x13,0x02,0x30,0x20,0x53, // r2.....1.....0.S END
+	0x83,0x41,0x05,0x49,0x64,0x53,0x74,0x72,0x43,0x80,0x5E,0x84,0x51,0x0D,0x0A,0x72, // .A.IdStrC.^.Q..r END
+	0x65,0x74,0x0A,0xFF,0x05,0xF0,0x30,0x69,0x6E,0x74,0x74,0x6F,0x80,0x7A,0x04,0x2E, // et....0intto.z.. END
+	0x73,0x00,0x3B,0x20,0x85,0x0C,0x00,0x28,0x80,0x8B,0x1F,0x3D,0x72,0x30,0x2C,0x20, // s.;....(...=r0,. END
+	0x78,0x3D,0x72,0x31,0x2C,0x20,0x70,0x61,0x64,0x46,0x6C,0x61,0x67,0x3D,0x72,0x32, // x=r1,.padFlag=r2 END
+	0x29,0x20,0x2D,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x78,0x80,0x2C,0x00,0x20,0x54, // ).-.write.x.,..T END
+	0x61,0x73,0x63,0x69,0x69,0x20,0x61,0x73,0x20,0x61,0x20,0x64,0x65,0x63,0x69,0x6D, // ascii.as.a.decim END
+	0x61,0x6C,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x74,0x6F,0x20,0x67,0x69,0x76,0x65, // al.value.to.give END
+	0x6E,0x20,0x73,0x74,0x72,0x69,0x6E,0x67,0x2C,0x20,0x6F,0x70,0x74,0x69,0x6F,0x6E, // n.string,.option END
+	0x61,0x6C,0x6C,0x79,0x20,0x70,0x61,0x64,0x64,0x65,0x64,0x20,0x77,0x69,0x74,0x68, // ally.padded.with END
+	0x20,0x7A,0x65,0x72,0x6F,0x73,0x0A,0x3B,0x20,0x6E,0x6F,0x74,0x65,0x3A,0x20,0x74, // .zeros.;.note:.t END
+	0x68,0x69,0x73,0x20,0x77,0x80,0x4E,0x04,0x6F,0x72,0x69,0x67,0x69,0x83,0x2D,0x03, // his.w.N.origi.-. END
+	0x64,0x6F,0x6E,0x65,0x83,0x2B,0x0B,0x61,0x20,0x6C,0x6F,0x6F,0x70,0x20,0x62,0x75, // done.+.a.loop.bu END
+	0x74,0x20,0x69,0x80,0x02,0x0C,0x73,0x20,0x73,0x69,0x67,0x6E,0x69,0x66,0x69,0x63, // t.i...s.signific END
+	0x61,0x6E,0x74,0x80,0x56,0x0C,0x66,0x61,0x73,0x74,0x65,0x72,0x20,0x75,0x6E,0x72, // ant.V.faster.unr END
+	0x6F,0x6C,0x6C,0x80,0x5F,0x02,0x61,0x6E,0x64,0x82,0x75,0x10,0x6D,0x69,0x73,0x65, // oll._.and.u.mise END
+	0x64,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x69,0x6E,0x74,0x74,0x6F,0x80,0x92,0x80, // d.label.intto... END
+	0x71,0x01,0x69,0x66,0x82,0x88,0x80,0x9C,0x09,0x20,0x66,0x6C,0x61,0x67,0x20,0x73, // q.if......flag.s END
+	0x65,0x74,0x2C,0x80,0x51,0x01,0x6D,0x70,0x80,0xA1,0x03,0x6A,0x75,0x6D,0x70,0x81, // et,.Q.mp...jump. END
+	0xB9,0x04,0x61,0x69,0x67,0x68,0x74,0x81,0xCB,0x00,0x70,0x80,0xC4,0x00,0x74,0x82, // ..aight...p...t. END
+	0x2A,0x05,0x69,0x72,0x73,0x74,0x20,0x64,0x80,0x9D,0x04,0x74,0x0A,0x63,0x6D,0x70, // *.irst.d...t.cmp END
+	0x02,0x20,0x72,0x32,0x83,0x02,0x07,0x0A,0x73,0x6B,0x69,0x70,0x65,0x71,0x7A,0x81, // ..r2....skipeqz. END
+	0x0A,0x0D,0x6A,0x6D,0x70,0x20,0x69,0x6E,0x74,0x74,0x6F,0x73,0x74,0x72,0x70,0x72, // ..jmp.inttostrpr END
+	0x80,0x09,0x1C,0x34,0x0A,0x3B,0x20,0x63,0x68,0x65,0x63,0x6B,0x20,0x69,0x66,0x20, // ...4.;.check.if. END
+	0x73,0x69,0x6E,0x67,0x6C,0x65,0x20,0x64,0x69,0x67,0x69,0x74,0x0A,0x6D,0x6F,0x76, // single.digit.mov END
+	0x81,0x42,0x03,0x31,0x30,0x0A,0x63,0x80,0x34,0x04,0x72,0x34,0x20,0x72,0x31,0x85, // .B.10.c.4.r4.r1. END
+	0x4C,0x01,0x67,0x65,0x80,0x0F,0x8F,0x4B,0x00,0x30,0x89,0x4B,0x02,0x74,0x77,0x6F, // L.ge...K.0.K.two END
+	0x83,0x48,0x00,0x73,0x83,0x49,0x00,0x33,0x80,0x49,0x8A,0x4A,0x00,0x33,0x99,0x4A, // .H.s.I.3.I.J.3.J END
+	0x00,0x31,0x8A,0x4A,0x02,0x68,0x72,0x65,0x84,0x95,0x80,0x4C,0x01,0x75,0x6C,0x81, // .1.J.hre...L.ul. END
+	0x4C,0x81,0xDC,0x17,0x33,0x20,0x3B,0x20,0x73,0x68,0x6F,0x72,0x74,0x65,0x72,0x20, // L...3.;.shorter. END
+	0x76,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x6F,0x66,0x20,0x60,0x83,0x6F,0x19,0x20, // version.of.`.o.. END
+	0x31,0x30,0x30,0x30,0x60,0x0A,0x63,0x6D,0x70,0x20,0x72,0x34,0x20,0x72,0x31,0x20, // 1000`.cmp.r4.r1. END
+	0x72,0x33,0x0A,0x73,0x6B,0x69,0x70,0x67,0x65,0x80,0x0F,0x01,0x0A,0x6A,0x80,0x16, // r3.skipge....j.. END
+	0x09,0x69,0x6E,0x74,0x74,0x6F,0x73,0x74,0x72,0x70,0x72,0x80,0x09,0x1E,0x32,0x0A, // .inttostrpr...2. END
+	0x3B,0x20,0x63,0x68,0x65,0x63,0x6B,0x20,0x69,0x66,0x20,0x66,0x6F,0x75,0x72,0x20, // ;.check.if.four. END
+	0x64,0x69,0x67,0x69,0x74,0x73,0x0A,0x6D,0x75,0x6C,0x20,0x72,0x32,0x82,0x02,0x1A, // digits.mul.r2... END
+	0x33,0x20,0x3B,0x20,0x73,0x68,0x6F,0x72,0x74,0x65,0x72,0x20,0x76,0x65,0x72,0x73, // 3.;.shorter.vers END
+	0x69,0x6F,0x6E,0x20,0x6F,0x66,0x20,0x60,0x6D,0x6F,0x76,0x81,0x22,0x81,0x70,0x8B, // ion.of.`mov.".p. END
+	0x71,0x00,0x32,0x99,0x71,0x00,0x33,0x80,0x71,0x08,0x65,0x6C,0x73,0x65,0x20,0x66, // q.2.q.3.q.else.f END
+	0x69,0x76,0x65,0x85,0x6D,0x01,0x3B,0x20,0x82,0x8D,0x0D,0x20,0x74,0x65,0x6E,0x2D, // ive.m.;.....ten- END
+	0x74,0x68,0x6F,0x75,0x73,0x61,0x6E,0x64,0x73,0x83,0x8A,0x05,0x0A,0x6C,0x61,0x62, // thousands....lab END
+	0x65,0x6C,0x8B,0xB5,0x01,0x34,0x0A,0x89,0x7B,0x02,0x0A,0x64,0x69,0x80,0x88,0x00, // el...4..{..di... END
+	0x33,0x83,0x7A,0x13,0x0A,0x6D,0x75,0x6C,0x20,0x72,0x34,0x20,0x72,0x33,0x20,0x72, // 3.z..mul.r4.r3.r END
+	0x32,0x0A,0x73,0x75,0x62,0x20,0x72,0x31,0x82,0x02,0x06,0x34,0x0A,0x69,0x6E,0x63, // 2.sub.r1...4.inc END
+	0x34,0x38,0x81,0x18,0x1B,0x3B,0x20,0x61,0x64,0x64,0x20,0x27,0x30,0x27,0x20,0x61, // 48...;.add.'0'.a END
+	0x73,0x63,0x69,0x69,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x0A,0x73,0x74,0x6F,0x72, // scii.offset.stor END
+	0x65,0x80,0x20,0x00,0x30,0x80,0x3C,0x81,0x2C,0x80,0x09,0x1E,0x0A,0x3B,0x20,0x70, // e...0.<.,....;.p END
+	0x72,0x69,0x6E,0x74,0x20,0x74,0x68,0x6F,0x75,0x73,0x61,0x6E,0x64,0x73,0x20,0x64, // rint.thousands.d END
+	0x69,0x67,0x69,0x74,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x80,0x19,0x04,0x74,0x6F, // igit.label....to END
+	0x73,0x74,0x72,0x82,0x23,0x04,0x33,0x0A,0x6D,0x6F,0x76,0x80,0x74,0x07,0x20,0x31, // str.#.3.mov.t..1 END
+	0x30,0x30,0x30,0x0A,0x64,0x69,0x80,0x0B,0x80,0x83,0x80,0x7C,0x00,0x32,0xD4,0x93, // 000.di.....|.2.. END
+	0x05,0x68,0x75,0x6E,0x64,0x72,0x65,0x8C,0x92,0x09,0x69,0x6E,0x74,0x74,0x6F,0x73, // .hundre...inttos END
+	0x74,0x72,0x70,0x72,0x80,0x09,0x0E,0x32,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20, // trpr...2.mov.r2. END
+	0x31,0x30,0x30,0x0A,0x64,0x69,0x80,0x0A,0x03,0x33,0x20,0x72,0x31,0x80,0x10,0x06, // 100.di...3.r1... END
+	0x0A,0x6D,0x75,0x6C,0x20,0x72,0x34,0x82,0x0F,0x04,0x32,0x0A,0x73,0x75,0x62,0x82, // .mul.r4...2.sub. END
+	0x16,0x80,0x19,0x06,0x34,0x0A,0x69,0x6E,0x63,0x34,0x38,0x81,0x28,0x1B,0x3B,0x20, // ....4.inc48.(.;. END
+	0x61,0x64,0x64,0x20,0x27,0x30,0x27,0x20,0x61,0x73,0x63,0x69,0x69,0x20,0x6F,0x66, // add.'0'.ascii.of END
+	0x66,0x73,0x65,0x74,0x0A,0x73,0x74,0x6F,0x72,0x65,0x80,0x20,0x00,0x30,0x80,0x4C, // fset.store...0.L END
+	0x81,0x2C,0x80,0x09,0x02,0x0A,0x3B,0x20,0x82,0x6E,0x11,0x20,0x74,0x65,0x6E,0x73, // .,....;..n..tens END
+	0x20,0x64,0x69,0x67,0x69,0x74,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x8A,0x8D,0x00, // .digit.label.... END
+	0x31,0x87,0x8D,0xD7,0x8C,0x1B,0x30,0x0A,0x3B,0x20,0x70,0x72,0x69,0x6E,0x74,0x20, // 1.....0.;.print. END
+	0x75,0x6E,0x69,0x74,0x73,0x20,0x64,0x69,0x67,0x69,0x74,0x0A,0x6C,0x61,0x62,0x65, // units.digit.labe END
+	0x6C,0x20,0x80,0x15,0x04,0x74,0x6F,0x73,0x74,0x72,0x82,0x1F,0x81,0x28,0x43,0x64, // l....tostr...(Cd END
+	0x69,0x76,0x69,0x73,0x6F,0x72,0x20,0x69,0x73,0x20,0x6F,0x6E,0x65,0x20,0x2D,0x20, // ivisor.is.one.-. END
+	0x6E,0x6F,0x74,0x68,0x69,0x6E,0x67,0x20,0x74,0x6F,0x20,0x64,0x6F,0x0A,0x69,0x6E, // nothing.to.do.in END
+	0x63,0x34,0x38,0x20,0x72,0x31,0x20,0x3B,0x20,0x61,0x64,0x64,0x20,0x27,0x30,0x27, // c48.r1.;.add.'0' END
+	0x20,0x61,0x73,0x63,0x69,0x69,0x20,0x6F,0x66,0x66,0x73,0x65,0x74,0x0A,0x73,0x74, // .ascii.offset.st END
+	0x6F,0x72,0x65,0x80,0x20,0x00,0x30,0x80,0x23,0x81,0x2C,0x80,0x09,0x80,0x7D,0x81, // ore...0.#.,...}. END
+	0x2A,0x0B,0x6E,0x75,0x6C,0x6C,0x20,0x74,0x65,0x72,0x6D,0x69,0x6E,0x61,0x80,0x24, // *.null.termina.$ END
+	0x08,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20,0x30,0x89,0x32,0x02,0x32,0x0A,0x72, // ..mov.r2.0.2.2.r END
+	0x80,0x43,0x00,0xFF,0x8C,0x00,0x02,0x00,0xEC,0x08,0x80,0xA1,0x14,0x72,0x63,0x68, // .C...........rch END
+	0x72,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x65,0x6E,0x64,0x20,0x2E, // r.s.requireend.. END
+	0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03,0x02,0x2E,0x73,0x0A,0x80,0xE6, // ./...sys....s... END
+	0x02,0x72,0x30,0x3D,0x84,0x2A,0x00,0x28,0x80,0x0A,0x06,0x68,0x61,0x79,0x73,0x74, // .r0=.*.(...hayst END
+	0x61,0x63,0x16,0x6B,0x20,0x61,0x64,0x64,0x72,0x2C,0x20,0x72,0x31,0x3D,0x6E,0x65, // ac.k.addr,.r1=ne END
+	0x65,0x64,0x6C,0x65,0x20,0x63,0x68,0x61,0x72,0x29,0x80,0x10,0x03,0x30,0x20,0x69, // edle.char)...0.i END
+	0x73,0x82,0x1C,0x1F,0x20,0x6F,0x66,0x20,0x6C,0x61,0x73,0x74,0x20,0x6F,0x63,0x63, // s....of.last.occ END
+	0x75,0x72,0x65,0x6E,0x63,0x65,0x2C,0x20,0x6F,0x72,0x20,0x30,0x20,0x6F,0x6E,0x20, // urence,.or.0.on. END
+	0x66,0x61,0x69,0x6C,0x80,0x13,0x24,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x73,0x74, // fail..$.label.st END
+	0x72,0x72,0x63,0x68,0x72,0x0A,0x3B,0x20,0x53,0x69,0x6D,0x70,0x6C,0x79,0x20,0x75, // rrchr.;.Simply.u END
+	0x73,0x65,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x20,0x66,0x80,0x33,0x01,0x73, // se.syscall.f.3.s END
+	0x70,0x80,0x63,0x06,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x80,0x72,0x83,0x09,0x00, // p.c..mov.r2.r... END
+	0x31,0x80,0x6B,0x83,0x13,0x02,0x30,0x20,0x53,0x83,0x2C,0x06,0x49,0x64,0x53,0x74, // 1.k...0.S.,.IdSt END
+	0x72,0x52,0x43,0x80,0x4A,0x84,0x3D,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0x90,0x00, // rRC.J.=..ret.... END
+	0x02,0x01,0xB0,0x0E,0x80,0x75,0x10,0x6C,0x65,0x6E,0x2E,0x73,0x00,0x72,0x65,0x71, // .....u.len.s.req END
+	0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x80,0x77,0x81,0x03,0x81,0x7B, // uire.../...w...{ END
+	0x02,0x2E,0x73,0x0A,0x80,0x93,0x02,0x72,0x30,0x3D,0x83,0x2A,0x00,0x28,0x83,0x09, // ..s....r0=.*.(.. END
+	0x82,0xF9,0x17,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x20,0x73,0x74,0x72,0x6C,0x65, // ...).label.strle END
+	0x6E,0x0A,0x3B,0x20,0x70,0x72,0x6F,0x74,0x65,0x63,0x74,0x81,0x10,0x22,0x69,0x6E, // n.;.protect.."in END
+	0x67,0x20,0x66,0x6F,0x72,0x20,0x6C,0x61,0x74,0x65,0x72,0x20,0x73,0x75,0x62,0x74, // g.for.later.subt END
+	0x72,0x61,0x63,0x74,0x69,0x6F,0x6E,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x33,0x20,0x72, // raction.mov.r3.r END
+	0x30,0x80,0x30,0x02,0x75,0x73,0x65,0x81,0x3D,0x04,0x63,0x68,0x72,0x6E,0x75,0x80, // 0.0.use.=.chrnu. END
+	0x47,0x18,0x79,0x73,0x63,0x61,0x6C,0x6C,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x20, // G.yscall.as.the. END
+	0x6F,0x76,0x65,0x72,0x68,0x65,0x61,0x64,0x20,0x69,0x73,0x80,0x5B,0x05,0x6D,0x69, // overhead.is.[.mi END
+	0x6E,0x69,0x6D,0x61,0x80,0x1C,0x06,0x6E,0x64,0x20,0x6B,0x65,0x72,0x6E,0x81,0x77, // nima...nd.kern.w END
+	0x03,0x70,0x61,0x63,0x65,0x80,0x1D,0x08,0x20,0x6D,0x75,0x63,0x68,0x20,0x66,0x61, // .pace....much.fa END
+	0x73,0x80,0x6A,0x83,0x5E,0x00,0x31,0x81,0x5E,0x82,0x68,0x02,0x30,0x20,0x53,0x83, // s.j.^.1.^.h.0.S. END
+	0x55,0x0A,0x49,0x64,0x53,0x74,0x72,0x43,0x68,0x72,0x4E,0x75,0x6C,0x83,0x82,0x08, // U.IdStrChrNul... END
+	0x32,0x20,0x30,0x20,0x3B,0x20,0x73,0x65,0x61,0x80,0x7E,0x82,0xAA,0x01,0x61,0x20, // 2.0.;.sea.~...a. END
+	0x80,0x84,0x0B,0x6C,0x20,0x62,0x79,0x74,0x65,0x2C,0x20,0x69,0x2E,0x65,0x2E,0x82, // ...l.byte,.i.e.. END
+	0x85,0x00,0x65,0x80,0x6F,0x01,0x6F,0x66,0x82,0x90,0x83,0xD6,0x00,0x0A,0x84,0xA6, // ..e.o.of........ END
+	0x01,0x0A,0x3B,0x23,0x20,0x77,0x65,0x20,0x6E,0x6F,0x77,0x20,0x68,0x61,0x76,0x65, // ..;#.we.now.have END
+	0x20,0x61,0x20,0x70,0x6F,0x69,0x6E,0x74,0x65,0x72,0x20,0x74,0x6F,0x20,0x74,0x68, // .a.pointer.to.th END
+	0x65,0x20,0x65,0x6E,0x64,0x20,0x6F,0x66,0x82,0x0A,0x14,0x73,0x74,0x72,0x69,0x6E, // e.end.of...strin END
+	0x67,0x2C,0x0A,0x3B,0x20,0x73,0x6F,0x20,0x73,0x75,0x62,0x74,0x72,0x61,0x63,0x74, // g,.;.so.subtract END
+	0x82,0x24,0x02,0x62,0x61,0x73,0x80,0x3A,0x05,0x64,0x64,0x72,0x65,0x73,0x73,0x81, // .$.bas.:.ddress. END
+	0x38,0x01,0x66,0x69,0x80,0x35,0x06,0x6C,0x65,0x6E,0x67,0x74,0x68,0x0A,0x80,0x28, // 8.fi.5.length..( END
+	0x02,0x20,0x72,0x30,0x82,0x02,0x06,0x33,0x0A,0x72,0x65,0x74,0x0A,0xFF,0x8C,0x00, // ..r0...3.ret.... END
+	0x02,0x00,0xAE,0x06,0x80,0x59,0x10,0x63,0x6D,0x70,0x2E,0x73,0x00,0x72,0x65,0x71, // .....Y.cmp.s.req END
+	0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x02,0x73,0x79,0x73,0x81,0x03, // uire.../...sys.. END
+	0x06,0x63,0x61,0x6C,0x6C,0x2E,0x73,0x0A,0x80,0x77,0x02,0x72,0x30,0x3D,0x83,0x2A, // .call.s..w.r0=.* END
+	0x03,0x28,0x70,0x31,0x41,0x80,0x6E,0x06,0x3D,0x72,0x30,0x2C,0x20,0x70,0x32,0x83, // .(p1A.n.=r0,.p2. END
+	0x0A,0x07,0x31,0x29,0x0A,0x6C,0x61,0x62,0x65,0x6C,0x81,0xA7,0x80,0x4D,0x80,0xA6, // ..1).label...M.. END
+	0x07,0x53,0x69,0x6D,0x70,0x6C,0x79,0x20,0x75,0x80,0x9C,0x84,0x46,0x13,0x20,0x66, // .Simply.u...F..f END
+	0x6F,0x72,0x20,0x73,0x70,0x65,0x65,0x64,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x32,0x20, // or.speed.mov.r2. END
+	0x72,0x31,0x09,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x12, // r1..mov.r1.r0... END
+	0x30,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x53,0x74,0x72,0x43,0x6D, // 0.SyscallIdStrCm END
+	0x70,0x0A,0x73,0x83,0x0F,0x05,0x0A,0x72,0x65,0x74,0x0A,0xFF,0x8E,0x00,0x13,0x01, // p.s....ret...... END
+	0x30,0x0A,0x73,0x74,0x72,0x63,0x61,0x74,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69, // 0.strcat.s.requi END
+	0x72,0x65,0x20,0x81,0x10,0x03,0x70,0x79,0x2E,0x73,0x80,0x32,0x86,0x10,0x02,0x6C, // re....py.s.2...l END
+	0x65,0x6E,0x80,0x10,0x01,0x0A,0x3B,0x82,0x1C,0x0A,0x61,0x74,0x28,0x72,0x30,0x3D, // en....;...at(r0= END
+	0x64,0x65,0x73,0x74,0x2C,0x80,0x7B,0x0A,0x3D,0x73,0x72,0x63,0x29,0x0A,0x6C,0x61, // dest,.{.=src).la END
+	0x62,0x65,0x6C,0x84,0x1D,0x81,0x27,0x04,0x46,0x69,0x6E,0x64,0x20,0x80,0x35,0x06, // bel...'.Find..5. END
+	0x67,0x74,0x68,0x20,0x6F,0x66,0x20,0x81,0x2C,0x06,0x0A,0x70,0x75,0x73,0x68,0x31, // gth.of..,..push1 END
+	0x36,0x81,0xAB,0x85,0x09,0x01,0x31,0x0A,0x81,0xAB,0x84,0x60,0x83,0xCB,0x00,0x32, // 6.....1....`...2 END
+	0x81,0xC4,0x00,0x3B,0x85,0x3A,0x01,0x69,0x6E,0x80,0x11,0x03,0x0A,0x70,0x6F,0x70, // ...;.:.in....pop END
+	0x83,0x2D,0x84,0x08,0x00,0x30,0x81,0x89,0x04,0x43,0x6F,0x70,0x79,0x20,0x18,0x73, // .-...0...Copy..s END
+	0x72,0x63,0x20,0x74,0x6F,0x20,0x65,0x6E,0x64,0x20,0x6F,0x66,0x20,0x64,0x65,0x73, // rc.to.end.of.des END
+	0x74,0x0A,0x61,0x64,0x64,0x20,0x72,0x30,0x82,0x02,0x02,0x32,0x20,0x3B,0x81,0x0A, // t.add.r0...2.;.. END
+	0x0A,0x73,0x74,0x61,0x72,0x74,0x73,0x20,0x77,0x69,0x74,0x68,0x82,0x22,0x00,0x2C, // .starts.with."., END
+	0x81,0x2F,0x88,0x0F,0x08,0x2B,0x6C,0x65,0x6E,0x0A,0x63,0x61,0x6C,0x6C,0x80,0x29, // ./...+len.call.) END
+	0x03,0x72,0x63,0x70,0x79,0x81,0x35,0x0D,0x31,0x20,0x61,0x6C,0x72,0x65,0x61,0x64, // .rcpy.5.1.alread END
+	0x79,0x20,0x68,0x61,0x73,0x20,0x80,0x66,0x06,0x0A,0x0A,0x72,0x65,0x74,0x0A,0xFF, // y.has..f...ret.. END
+	0x8C,0x00,0x02,0x00,0xEA,0x08,0x80,0x33,0x0F,0x2E,0x73,0x00,0x72,0x65,0x71,0x75, // .......3..s.requ END
+	0x69,0x72,0x65,0x20,0x69,0x6E,0x74,0x74,0x6F,0x82,0x12,0x80,0x2F,0x83,0x12,0x81, // ire.intto.../... END
+	0x54,0x01,0x61,0x74,0x8C,0x10,0x00,0x68,0x8C,0x21,0x8F,0x11,0x80,0x88,0x8C,0x44, // T.at...h.!.....D END
+	0x01,0x6D,0x70,0x8B,0x55,0x80,0xB6,0x10,0x2E,0x73,0x0A,0x72,0x65,0x71,0x75,0x69, // .mp.U....s.requi END
+	0x72,0x65,0x20,0x73,0x74,0x72,0x70,0x61,0x64,0x8B,0x10,0x05,0x65,0x70,0x6C,0x61, // re.strpad...epla END
+	0x63,0x65,0x8B,0x24,0x04,0x74,0x6F,0x69,0x6E,0x74,0x8C,0x12,0x05,0x72,0x69,0x6D, // ce.$.toint...rim END
+	0x6C,0x61,0x73,0x90,0x15,0x05,0x6E,0x65,0x77,0x6C,0x69,0x6E,0x81,0x41,0x00,0xFF, // las...newlin.A.. END
+	0x92,0x00,0x02,0x00,0xFA,0x08,0x8A,0x3F,0x00,0x00,0x88,0x8D,0x02,0x6C,0x65,0x6E, // .......?.....len END
+	0x80,0x9E,0x01,0x0A,0x3B,0x89,0x61,0x03,0x28,0x72,0x30,0x3D,0x80,0xA8,0x08,0x20, // ....;.a.(r0=.... END
+	0x61,0x64,0x64,0x72,0x29,0x20,0x2D,0x20,0x81,0x79,0x01,0x73,0x20,0x81,0x7B,0x0F, // addr).-..y.s..{. END
+	0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x0A,0x6C,0x61,0x62,0x65,0x6C, // .character.label END
+	0x89,0x97,0x81,0x44,0x03,0x46,0x69,0x6E,0x64,0x82,0x36,0x02,0x20,0x6F,0x66,0x87, // ...D.Find.6..of. END
+	0x30,0x1C,0x0A,0x70,0x75,0x73,0x68,0x31,0x36,0x20,0x72,0x30,0x0A,0x63,0x61,0x6C, // 0..push16.r0.cal END
+	0x6C,0x20,0x73,0x74,0x72,0x6C,0x65,0x6E,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x81, // l.strlen.mov.r1. END
+	0x15,0x02,0x70,0x6F,0x70,0x83,0x1E,0x06,0x0A,0x61,0x64,0x64,0x20,0x72,0x32,0x80, // ..pop....add.r2. END
+	0x29,0x80,0x19,0x03,0x0A,0x64,0x65,0x63,0x80,0x0C,0x0C,0x0A,0x0A,0x3B,0x20,0x49, // )....dec.....;.I END
+	0x6E,0x73,0x65,0x72,0x74,0x20,0x6E,0x75,0x80,0x3D,0x0F,0x62,0x79,0x74,0x65,0x20, // nsert.nu.=.byte. END
+	0x74,0x6F,0x20,0x74,0x72,0x75,0x6E,0x63,0x61,0x74,0x65,0x83,0x47,0x09,0x33,0x20, // to.truncate.G.3. END
+	0x30,0x0A,0x73,0x74,0x6F,0x72,0x65,0x38,0x82,0x3F,0x07,0x33,0x0A,0x0A,0x72,0x65, // 0.store8.?.3..re END
+	0x74,0x0A,0xFF,0x82,0x00};
+#endif
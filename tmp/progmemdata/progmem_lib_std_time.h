@@ -0,0 +1,63 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_std_time_H
+#define PROGMEM_lib_std_time_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_std_timeDATASIZE 706u
+#define PROGMEM_lib_std_timeCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_std_timeDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_std_timeData))
+static const uint8_t progmem_lib_std_timeData[PROGMEM_lib_std_timeDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_std_timeDATAPTR ((uintptr_t)progmem_lib_std_timeData)
+static const uint8_t progmem_lib_std_timeData[PROGMEM_lib_std_timeDATASIZE]={
+#endif
+	0x5A,0x03,0xF0,0x00,0x0D,0x00,0x7D,0x01,0x47,0x02,0x16,0x02,0xC2,0x05,0x22,0xFB, // Z.....}.G.....". END
+	0x20,0x2D,0xCF,0x00,0xF8,0x00,0x18,0x32,0x0D,0x74,0x69,0x6D,0x65,0x2E,0x73,0x00, // .-.....2.time.s. END
+	0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x73,0x6C,0x65,0x65,0x70,0x2E,0x73,0x0A, // require.sleep.s. END
+	0x85,0x0F,0x81,0x1E,0x08,0x6D,0x6F,0x6E,0x6F,0x74,0x6F,0x6E,0x69,0x63,0x80,0x17, // .....monotonic.. END
+	0x04,0xFF,0xFF,0x02,0x86,0xA2,0x84,0x24,0x86,0x34,0x02,0x2E,0x2E,0x2F,0x80,0x02, // .......$.4.../.. END
+	0x02,0x73,0x79,0x73,0x81,0x03,0x03,0x63,0x61,0x6C,0x6C,0x80,0x40,0x01,0x0A,0x3B, // .sys...call.@..; END
+	0x83,0x4B,0x0D,0x28,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x3D,0x72,0x30,0x29,0x20, // .K.(seconds=r0). END
+	0x2D,0x83,0x5F,0x08,0x20,0x66,0x6F,0x72,0x20,0x28,0x61,0x74,0x20,0x2C,0x6C,0x65, // -._..for.(at.,le END
+	0x61,0x73,0x74,0x29,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x6E,0x75,0x6D,0x62,0x65, // ast).given.numbe END
+	0x72,0x20,0x6F,0x66,0x20,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x0A,0x6C,0x61,0x62, // r.of.seconds.lab END
+	0x65,0x6C,0x20,0x73,0x6C,0x65,0x65,0x70,0x0A,0x0A,0x3B,0x83,0x08,0x09,0x20,0x69, // el.sleep..;....i END
+	0x6E,0x20,0x63,0x68,0x75,0x6E,0x6B,0x73,0x81,0x29,0x0E,0x61,0x74,0x20,0x6D,0x6F, // n.chunks.).at.mo END
+	0x73,0x74,0x20,0x36,0x30,0x73,0x2C,0x20,0x61,0x73,0x83,0x2B,0x10,0x6D,0x73,0x20, // st.60s,.as.+.ms. END
+	0x74,0x61,0x6B,0x65,0x73,0x20,0x61,0x20,0x31,0x36,0x20,0x62,0x69,0x74,0x88,0x5A, // takes.a.16.bit.Z END
+	0x04,0x6D,0x69,0x6C,0x6C,0x69,0x90,0x5F,0x0D,0x6C,0x6F,0x6F,0x70,0x0A,0x63,0x6D, // .milli._.loop.cm END
+	0x70,0x20,0x72,0x31,0x20,0x72,0x30,0x80,0x02,0x08,0x0A,0x73,0x6B,0x69,0x70,0x6E, // p.r1.r0....skipn END
+	0x65,0x71,0x7A,0x80,0x11,0x01,0x0A,0x6A,0x80,0x18,0x82,0x86,0x07,0x72,0x65,0x74, // eqz....j.....ret END
+	0x0A,0x0A,0x6D,0x6F,0x76,0x81,0x26,0x01,0x36,0x30,0x83,0x30,0x00,0x32,0x82,0x30, // ..mov.&.60.0.2.0 END
+	0x00,0x31,0x82,0x30,0x01,0x67,0x74,0x80,0x0F,0x87,0x2E,0x00,0x6C,0x80,0xDE,0x05, // .1.0.gt.....l... END
+	0x0A,0x0A,0x70,0x75,0x73,0x68,0x80,0x88,0x80,0x53,0x82,0x39,0x00,0x30,0x80,0xAD, // ..push...S.9.0.. END
+	0x80,0x00,0x03,0x0A,0x63,0x61,0x6C,0x1F,0x6C,0x20,0x73,0x6C,0x65,0x65,0x70,0x6D, // ....cal.l.sleepm END
+	0x73,0x0A,0x70,0x6F,0x70,0x31,0x36,0x20,0x72,0x30,0x0A,0x6D,0x6F,0x76,0x20,0x72, // s.pop16.r0.mov.r END
+	0x31,0x20,0x36,0x30,0x0A,0x73,0x75,0x62,0x80,0x10,0x82,0x02,0x04,0x31,0x0A,0x6A, // 1.60.sub.....1.j END
+	0x6D,0x70,0x83,0x2B,0x09,0x6C,0x6F,0x6F,0x70,0x0A,0x0A,0x6C,0x61,0x62,0x65,0x84, // mp.+.loop..labe. END
+	0x3C,0x03,0x6C,0x61,0x73,0x74,0x85,0x35,0x02,0x31,0x30,0x30,0x80,0x41,0x01,0x75, // <.last.5.100.A.u END
+	0x6C,0x87,0x37,0x02,0x63,0x61,0x6C,0x87,0x64,0x89,0x36,0x03,0x72,0x65,0x74,0x0A, // l.7.cal.d.6.ret. END
+	0x81,0x03,0x01,0x0A,0x3B,0x85,0x83,0x08,0x28,0x6D,0x73,0x3D,0x72,0x30,0x29,0x20, // ....;...(ms=r0). END
+	0x2D,0x83,0x94,0x0A,0x20,0x66,0x6F,0x72,0x20,0x28,0x61,0x74,0x20,0x6C,0x65,0x80, // -....for.(at.le. END
+	0x61,0x1F,0x29,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72, // a.).given.number END
+	0x20,0x6F,0x66,0x20,0x6D,0x69,0x6C,0x6C,0x69,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73, // .of.milliseconds END
+	0x2C,0x20,0x80,0x4E,0x0A,0x75,0x72,0x6E,0x69,0x6E,0x67,0x20,0x30,0x20,0x69,0x6E, // ,..N.urning.0.in END
+	0x81,0xB7,0x00,0x28,0x80,0x3E,0x03,0x31,0x20,0x69,0x66,0x80,0x0E,0x15,0x74,0x65, // ...(.>.1.if...te END
+	0x72,0x72,0x75,0x70,0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x61,0x20,0x73,0x69,0x67, // rrupted.by.a.sig END
+	0x6E,0x61,0x6C,0x29,0x80,0xC4,0x14,0x62,0x65,0x6C,0x20,0x73,0x6C,0x65,0x65,0x70, // nal)...bel.sleep END
+	0x6D,0x73,0x0A,0x6D,0x6F,0x76,0x20,0x72,0x31,0x20,0x72,0x30,0x83,0x09,0x0B,0x30, // ms.mov.r1.r0...0 END
+	0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x53,0x81,0x21,0x03,0x4D,0x73, // .SyscallIdS.!.Ms END
+	0x0A,0x73,0x83,0x10,0x24,0x0A,0x72,0x65,0x74,0x0A,0xFF,0xFF,0x00,0xB4,0x2D,0x74, // .s..$.ret.....-t END
+	0x69,0x6D,0x65,0x6D,0x6F,0x6E,0x6F,0x74,0x6F,0x6E,0x69,0x63,0x2E,0x73,0x00,0x72, // imemonotonic.s.r END
+	0x65,0x71,0x75,0x69,0x72,0x65,0x20,0x2E,0x2E,0x2F,0x80,0x02,0x80,0x2E,0x81,0x03, // equire.../...... END
+	0x81,0x43,0x04,0x2E,0x73,0x0A,0x0A,0x3B,0x80,0x5A,0x03,0x3D,0x67,0x65,0x74,0x8A, // .C..s..;.Z.=get. END
+	0x34,0x02,0x28,0x29,0x20,0x80,0x4D,0x26,0x75,0x72,0x6E,0x73,0x20,0x6E,0x75,0x6D, // 4.()..M&urns.num END
+	0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x20,0x73, // ber.of.seconds.s END
+	0x69,0x6E,0x63,0x65,0x20,0x62,0x6F,0x6F,0x74,0x69,0x6E,0x67,0x0A,0x6C,0x61,0x81, // ince.booting.la. END
+	0xAD,0x8D,0x40,0x8E,0xAC,0x00,0x54,0x80,0x93,0x00,0x4D,0x85,0x93,0x01,0x31,0x36, // ..@...T...M...16 END
+	0x8B,0xB5};
+#endif
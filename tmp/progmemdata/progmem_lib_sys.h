@@ -0,0 +1,213 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_lib_sys_H
+#define PROGMEM_lib_sys_H
+
+#include <stdint.h>
+
+#define PROGMEM_lib_sysDATASIZE 3110u
+#define PROGMEM_lib_sysCOMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_lib_sysDATAPTR ((uint32_t)pgm_get_far_address(progmem_lib_sysData))
+static const uint8_t progmem_lib_sysData[PROGMEM_lib_sysDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_lib_sysDATAPTR ((uintptr_t)progmem_lib_sysData)
+static const uint8_t progmem_lib_sysData[PROGMEM_lib_sysDATASIZE]={
+#endif
+	0x5A,0x16,0xC0,0x00,0x33,0x00,0x97,0x01,0x2A,0x01,0xAB,0x02,0x1E,0x02,0x93,0x03, // Z...3...*....... END
+	0x21,0x03,0xC4,0x04,0x3D,0x04,0xC8,0x05,0x48,0x05,0xD2,0x06,0x3F,0x06,0xC6,0x07, // !...=...H...?... END
+	0x3C,0x07,0xC1,0x08,0x2F,0x08,0x92,0x09,0x32,0x09,0xE6,0x0A,0x74,0x0A,0xD8,0x0B, // <.../...2...t... END
+	0xB8,0x0C,0x26,0x08,0x25,0xB5,0x04,0x07,0x0B,0x33,0xA9,0xB1,0x00,0xF5,0x00,0x14, // ..&.%....3...... END
+	0x5B,0x03,0x73,0x79,0x73,0x2E,0x73,0x00,0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x20, // [.sys.s.require. END
+	0x69,0x6F,0x2E,0x73,0x0A,0x85,0x0C,0x07,0x6D,0x65,0x67,0x61,0x32,0x35,0x36,0x30, // io.s....mega2560 END
+	0x88,0x12,0x03,0x70,0x72,0x6F,0x63,0x88,0x21,0x80,0x3C,0x03,0x63,0x61,0x6C,0x6C, // ...proc.!.<.call END
+	0x89,0x11,0x03,0x69,0x67,0x6E,0x61,0x81,0x10,0x00,0xFF,0x81,0x00,0x02,0x00,0x6A, // ...igna........j END
+	0x04,0x85,0x10,0x07,0x00,0x63,0x6F,0x6E,0x73,0x74,0x20,0x53,0x82,0x1F,0x07,0x49, // .....const.S...I END
+	0x64,0x49,0x6E,0x74,0x65,0x72,0x72,0x1A,0x75,0x70,0x74,0x20,0x30,0x0A,0x63,0x6F, // dInterr.upt.0.co END
+	0x6E,0x73,0x74,0x20,0x53,0x69,0x67,0x6E,0x61,0x6C,0x49,0x64,0x55,0x73,0x65,0x72, // nst.SignalIdUser END
+	0x31,0x20,0x31,0x90,0x15,0x02,0x32,0x20,0x32,0x8C,0x2B,0x0A,0x53,0x75,0x69,0x63, // 1.1...2.2.+.Suic END
+	0x69,0x64,0x65,0x20,0x33,0x0A,0xFF,0x92,0x00,0x0D,0x04,0xEC,0x28,0x6D,0x65,0x67, // ide.3.......(meg END
+	0x61,0x32,0x35,0x36,0x30,0x2E,0x73,0x00,0x83,0x67,0x0E,0x50,0x69,0x6E,0x49,0x6E, // a2560.s..g.PinIn END
+	0x76,0x61,0x6C,0x69,0x64,0x20,0x31,0x32,0x37,0x0A,0x84,0x7D,0x80,0x15,0x03,0x41, // valid.127..}...A END
+	0x30,0x20,0x34,0x85,0x8C,0x81,0x0E,0x02,0x31,0x20,0x34,0x85,0x85,0x81,0x1D,0x02, // 0.4.....1.4..... END
+	0x32,0x20,0x34,0x85,0x7E,0x81,0x2C,0x03,0x33,0x20,0x34,0x33,0x88,0x3B,0x03,0x34, // 2.4.~.,.3.43.;.4 END
+	0x20,0x34,0x34,0x88,0x4A,0x03,0x35,0x20,0x34,0x35,0x88,0x59,0x03,0x36,0x20,0x34, // .44.J.5.45.Y.6.4 END
+	0x36,0x88,0x68,0x03,0x37,0x20,0x34,0x37,0x82,0xF5,0x0E,0x74,0x20,0x50,0x69,0x6E, // 6.h.7.47...t.Pin END
+	0x41,0x38,0x20,0x38,0x30,0x0A,0x63,0x6F,0x6E,0x73,0x83,0x0E,0x03,0x39,0x20,0x38, // A8.80.cons...9.8 END
+	0x31,0x88,0x0E,0x04,0x31,0x30,0x20,0x38,0x32,0x89,0x0F,0x03,0x31,0x20,0x38,0x33, // 1...10.82...1.83 END
+	0x89,0x1F,0x03,0x32,0x20,0x38,0x34,0x89,0x2F,0x03,0x33,0x20,0x38,0x35,0x89,0x3F, // ...2.84./.3.85.? END
+	0x03,0x34,0x20,0x38,0x36,0x89,0x4F,0x04,0x35,0x20,0x38,0x37,0x0A,0x87,0x6F,0x03, // .4.86.O.5.87..o. END
+	0x44,0x30,0x20,0x33,0x88,0x5F,0x03,0x44,0x31,0x20,0x33,0x88,0x5E,0x03,0x44,0x32, // D0.3._.D1.3.^.D2 END
+	0x20,0x33,0x88,0x3D,0x04,0x44,0x33,0x20,0x33,0x37,0x88,0x3B,0x02,0x34,0x20,0x35, // .3.=.D3.37.;.4.5 END
+	0x89,0x2C,0x02,0x35,0x20,0x33,0x88,0x7A,0x04,0x44,0x36,0x20,0x35,0x39,0x88,0x68, // .,.5.3.z.D6.59.h END
+	0x02,0x37,0x20,0x36,0x88,0xE7,0x03,0x44,0x38,0x20,0x36,0x0F,0x31,0x0A,0x63,0x6F, // .7.6...D8.6.1.co END
+	0x6E,0x73,0x74,0x20,0x50,0x69,0x6E,0x44,0x39,0x20,0x36,0x32,0x88,0x0E,0x03,0x31, // nst.PinD9.62...1 END
+	0x30,0x20,0x31,0x8A,0x0F,0x03,0x31,0x20,0x31,0x33,0x89,0x1F,0x03,0x32,0x20,0x31, // 0.1...1.13...2.1 END
+	0x34,0x89,0x2F,0x03,0x33,0x20,0x31,0x35,0x89,0x3F,0x02,0x34,0x20,0x37,0x8A,0x2F, // 4./.3.15.?.4.7./ END
+	0x02,0x35,0x20,0x37,0x8A,0x5F,0x03,0x36,0x20,0x35,0x37,0x89,0x6F,0x03,0x37,0x20, // .5.7._.6.57.o.7. END
+	0x35,0x36,0x89,0x7F,0x02,0x38,0x20,0x32,0x8A,0x1F,0x02,0x39,0x20,0x32,0x89,0x1F, // 56...8.2...9.2.. END
+	0x03,0x32,0x30,0x20,0x32,0x89,0x6F,0x03,0x32,0x31,0x20,0x32,0x89,0x8F,0x03,0x32, // .20.2.o.21.2...2 END
+	0x32,0x20,0x30,0x89,0x2E,0x80,0x9E,0x89,0x3D,0x01,0x34,0x20,0x81,0xEC,0x0E,0x6E, // 2.0.....=.4....n END
+	0x73,0x74,0x20,0x50,0x69,0x6E,0x44,0x32,0x35,0x20,0x33,0x0A,0x63,0x6F,0x86,0x0E, // st.PinD25.3.co.. END
+	0x02,0x36,0x20,0x34,0x89,0x0E,0x02,0x37,0x20,0x35,0x89,0x1D,0x02,0x38,0x20,0x36, // .6.4...7.5...8.6 END
+	0x89,0x2C,0x02,0x39,0x20,0x37,0x88,0x3B,0x03,0x33,0x30,0x20,0x32,0x89,0x4B,0x04, // .,.9.7.;.30.2.K. END
+	0x33,0x31,0x20,0x32,0x32,0x89,0x1F,0x03,0x32,0x20,0x32,0x31,0x89,0x2F,0x03,0x33, // 31.22...2.21./.3 END
+	0x20,0x32,0x30,0x89,0x3F,0x03,0x34,0x20,0x31,0x39,0x89,0x4F,0x03,0x35,0x20,0x31, // .20.?.4.19.O.5.1 END
+	0x38,0x89,0x5F,0x02,0x36,0x20,0x31,0x8A,0x6F,0x02,0x37,0x20,0x31,0x89,0x8E,0x03, // 8._.6.1.o.7.1... END
+	0x33,0x38,0x20,0x33,0x8A,0x5F,0x02,0x39,0x20,0x35,0x89,0x5F,0x03,0x34,0x30,0x20, // 38.3._.9.5._.40. END
+	0x34,0x86,0x5F,0x0F,0x69,0x6E,0x44,0x34,0x31,0x20,0x34,0x38,0x0A,0x63,0x6F,0x6E, // 4._.inD41.48.con END
+	0x73,0x74,0x20,0x50,0x81,0x0F,0x03,0x32,0x20,0x39,0x35,0x89,0x0F,0x03,0x33,0x20, // st.P...2.95...3. END
+	0x39,0x34,0x89,0x1F,0x03,0x34,0x20,0x39,0x33,0x89,0x2F,0x03,0x35,0x20,0x39,0x32, // 94...4.93./.5.92 END
+	0x89,0x3F,0x03,0x36,0x20,0x39,0x31,0x89,0x4F,0x03,0x37,0x20,0x39,0x30,0x89,0x5F, // .?.6.91.O.7.90._ END
+	0x03,0x38,0x20,0x38,0x39,0x89,0x6F,0x02,0x39,0x20,0x38,0x89,0x7F,0x03,0x35,0x30, // .8.89.o.9.8...50 END
+	0x20,0x31,0x89,0x3F,0x03,0x35,0x31,0x20,0x31,0x89,0x3F,0x00,0x35,0x80,0x9F,0x89, // .1.?.51.1.?.5... END
+	0x2E,0x03,0x33,0x20,0x38,0x0A,0x87,0xBE,0x02,0x4C,0x65,0x64,0x82,0xC5,0x01,0x31, // ..3.8....Led...1 END
+	0x33,0x85,0x14,0x07,0x48,0x77,0x44,0x65,0x76,0x69,0x63,0x65,0x80,0xDB,0x08,0x4D, // 3...HwDevice...M END
+	0x61,0x78,0x20,0x38,0x20,0x3B,0x20,0x6D,0x80,0x07,0x05,0x70,0x69,0x6E,0x73,0x20, // ax.8.;.m...pins. END
+	0x70,0x3D,0x65,0x72,0x20,0x48,0x57,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x28, // p=er.HW.device.( END
+	0x6E,0x6F,0x74,0x20,0x69,0x6E,0x63,0x6C,0x75,0x64,0x69,0x6E,0x67,0x20,0x67,0x65, // not.including.ge END
+	0x6E,0x65,0x72,0x61,0x6C,0x20,0x70,0x69,0x6E,0x73,0x20,0x73,0x75,0x63,0x68,0x20, // neral.pins.such. END
+	0x61,0x73,0x20,0x74,0x68,0x6F,0x73,0x65,0x20,0x75,0x73,0x65,0x64,0x20,0x62,0x79, // as.those.used.by END
+	0x80,0x0D,0x0B,0x65,0x20,0x53,0x50,0x49,0x20,0x62,0x75,0x73,0x29,0x0A,0xFF,0x90, // ...e.SPI.bus)... END
+	0x00,0x0F,0x0E,0xB1,0x76,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x2E,0x73,0x00,0x3B, // ....vsyscall.s.; END
+	0x20,0x53,0x83,0x0B,0x09,0x20,0x69,0x64,0x73,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x85, // .S....ids.const. END
+	0x11,0x07,0x49,0x64,0x45,0x78,0x69,0x74,0x20,0x30,0x8D,0x15,0x07,0x47,0x65,0x74, // ..IdExit.0...Get END
+	0x50,0x69,0x64,0x20,0x31,0x8D,0x2D,0x05,0x41,0x72,0x67,0x63,0x20,0x32,0x90,0x15, // Pid.1.-.Argc.2.. END
+	0x03,0x76,0x4E,0x20,0x33,0x8D,0x5A,0x05,0x46,0x6F,0x72,0x6B,0x20,0x34,0x8F,0x70, // .vN.3.Z.Fork.4.p END
+	0x02,0x65,0x63,0x20,0x19,0x35,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20,0x53,0x79,0x73, // .ec..5.const.Sys END
+	0x63,0x61,0x6C,0x6C,0x49,0x64,0x57,0x61,0x69,0x74,0x50,0x69,0x64,0x20,0x36,0x8D, // callIdWaitPid.6. END
+	0x18,0x01,0x47,0x65,0x81,0x17,0x05,0x50,0x61,0x74,0x68,0x20,0x37,0x93,0x1B,0x06, // ..Ge...Path.7... END
+	0x53,0x74,0x61,0x74,0x65,0x20,0x38,0x90,0x38,0x0D,0x41,0x6C,0x6C,0x43,0x70,0x75, // State.8.8.AllCpu END
+	0x43,0x6F,0x75,0x6E,0x74,0x73,0x20,0x39,0x8D,0x72,0x06,0x4B,0x69,0x6C,0x6C,0x20, // Counts.9.r.Kill. END
+	0x31,0x30,0x93,0x70,0x05,0x52,0x61,0x6D,0x20,0x31,0x31,0x8D,0xA5,0x04,0x53,0x69, // 10.p.Ram.11...Si END
+	0x67,0x6E,0x61,0x80,0x34,0x00,0x32,0x93,0xA5,0x05,0x46,0x64,0x4E,0x20,0x31,0x33, // gna.4.2...FdN.13 END
+	0x8D,0xDA,0x07,0x45,0x78,0x65,0x63,0x32,0x20,0x31,0x34,0x89,0xF2,0x17,0x6C,0x6C, // ...Exec2.14...ll END
+	0x49,0x64,0x43,0x6C,0x6F,0x6E,0x65,0x20,0x31,0x35,0x0A,0x63,0x6F,0x6E,0x73,0x74, // IdClone.15.const END
+	0x20,0x53,0x79,0x73,0x63,0x61,0x81,0x17,0x0B,0x46,0x75,0x74,0x65,0x78,0x57,0x61, // .Sysca...FutexWa END
+	0x69,0x74,0x20,0x31,0x36,0x94,0x1B,0x00,0x6B,0x80,0x37,0x01,0x37,0x0A,0x8D,0x38, // it.16...k.7.7..8 END
+	0x06,0x52,0x65,0x61,0x64,0x20,0x32,0x35,0x8E,0x34,0x04,0x57,0x72,0x69,0x74,0x65, // .Read.25.4.Write END
+	0x80,0x18,0x00,0x37,0x8D,0x69,0x03,0x4F,0x70,0x65,0x6E,0x80,0x30,0x00,0x38,0x8D, // ...7.i.Open.0.8. END
+	0x81,0x80,0x99,0x00,0x73,0x81,0x30,0x00,0x39,0x8D,0x9A,0x0F,0x44,0x69,0x72,0x47, // ....s.0.9...DirG END
+	0x65,0x74,0x43,0x68,0x69,0x6C,0x64,0x4E,0x20,0x32,0x36,0x30,0x8D,0xBA,0x80,0x1C, // etChildN.260.... END
+	0x03,0x50,0x61,0x74,0x68,0x80,0x1A,0x00,0x31,0x8F,0x9C,0x06,0x73,0x69,0x7A,0x65, // .Path...1...size END
+	0x46,0x69,0x6C,0x80,0x89,0x01,0x36,0x32,0x1D,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20, // Fil...62..const. END
+	0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x47,0x65,0x74,0x46,0x69,0x6C,0x65, // SyscallIdGetFile END
+	0x4C,0x65,0x6E,0x20,0x32,0x36,0x33,0x8D,0x1D,0x0A,0x54,0x72,0x79,0x52,0x65,0x61, // Len.263...TryRea END
+	0x64,0x42,0x79,0x74,0x65,0x80,0x1E,0x00,0x34,0x8D,0x3C,0x04,0x49,0x73,0x44,0x69, // dByte...4.<.IsDi END
+	0x72,0x80,0x37,0x00,0x35,0x8D,0x55,0x81,0x52,0x05,0x45,0x78,0x69,0x73,0x74,0x73, // r.7.5.U.R.Exists END
+	0x80,0x55,0x00,0x36,0x8D,0x73,0x03,0x44,0x65,0x6C,0x65,0x82,0x50,0x00,0x37,0x8D, // .U.6.s.Dele.P.7. END
+	0x8D,0x81,0x6C,0x01,0x33,0x32,0x80,0x89,0x00,0x38,0x8D,0xA7,0x04,0x57,0x72,0x69, // ..l.32...8...Wri END
+	0x74,0x65,0x82,0x1A,0x00,0x39,0x8F,0x34,0x03,0x73,0x69,0x7A,0x65,0x81,0xC5,0x81, // te...9.4.size... END
+	0x3A,0x01,0x37,0x30,0x97,0xE2,0x80,0x5A,0x1C,0x32,0x37,0x31,0x0A,0x63,0x6F,0x6E, // :.70...Z.271.con END
+	0x73,0x74,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x41,0x70,0x70,0x65, // st.SyscallIdAppe END
+	0x6E,0x64,0x20,0x32,0x37,0x32,0x8D,0x19,0x04,0x46,0x6C,0x75,0x73,0x68,0x80,0x18, // nd.272...Flush.. END
+	0x00,0x33,0x8D,0x32,0x0B,0x54,0x72,0x79,0x57,0x72,0x69,0x74,0x65,0x42,0x79,0x74, // .3.2.TryWriteByt END
+	0x65,0x80,0x38,0x00,0x34,0x8D,0x52,0x0C,0x47,0x65,0x74,0x50,0x61,0x74,0x68,0x47, // e.8.4.R.GetPathG END
+	0x6C,0x6F,0x62,0x61,0x6C,0x80,0x59,0x00,0x35,0x8D,0x73,0x02,0x44,0x69,0x72,0x80, // lobal.Y.5.s.Dir. END
+	0x23,0x08,0x43,0x68,0x69,0x6C,0x64,0x4E,0x65,0x78,0x74,0x80,0x7C,0x00,0x36,0x98, // #.ChildNext.|.6. END
+	0x22,0x02,0x72,0x65,0x6E,0x80,0x9E,0x01,0x37,0x0A,0x8D,0xB9,0x02,0x45,0x6E,0x76, // ".ren...7....Env END
+	0x81,0x69,0x04,0x77,0x64,0x20,0x35,0x31,0x8E,0x83,0x80,0x1C,0x00,0x53,0x85,0x1C, // .i.wd.51.....S.. END
+	0x87,0x7F,0x1D,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x45,0x6E,0x76,0x47,0x65,0x74, // ...scallIdEnvGet END
+	0x50,0x61,0x74,0x68,0x20,0x35,0x31,0x36,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20,0x53, // Path.516.const.S END
+	0x79,0x87,0x1D,0x00,0x53,0x86,0x1D,0x01,0x37,0x0A,0x8D,0x1E,0x13,0x54,0x69,0x6D, // y...S...7....Tim END
+	0x65,0x4D,0x6F,0x6E,0x6F,0x74,0x6F,0x6E,0x69,0x63,0x31,0x36,0x73,0x20,0x37,0x36, // eMonotonic16s.76 END
+	0x38,0x9C,0x23,0x00,0x6D,0x81,0x24,0x00,0x39,0x9A,0x48,0x01,0x33,0x32,0x80,0x48, // 8.#.m.$.9.H.32.H END
+	0x01,0x37,0x30,0x9C,0x23,0x81,0x48,0x01,0x37,0x31,0x91,0x91,0x03,0x52,0x65,0x61, // .70.#.H.71...Rea END
+	0x6C,0x83,0x43,0x00,0x32,0x91,0xB0,0x06,0x54,0x6F,0x44,0x61,0x74,0x65,0x33,0x1B, // l.C.2...ToDate3. END
+	0x32,0x73,0x20,0x37,0x37,0x33,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20,0x53,0x79,0x73, // 2s.773.const.Sys END
+	0x63,0x61,0x6C,0x6C,0x49,0x64,0x53,0x6C,0x65,0x65,0x70,0x4D,0x81,0x1A,0x01,0x34, // callIdSleepM...4 END
+	0x0A,0x8D,0x1B,0x18,0x52,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x53,0x69,0x67,0x6E, // ....RegisterSign END
+	0x61,0x6C,0x48,0x61,0x6E,0x64,0x6C,0x65,0x72,0x20,0x31,0x30,0x32,0x8F,0x2A,0x0C, // alHandler.102.*. END
+	0x53,0x68,0x75,0x74,0x64,0x6F,0x77,0x6E,0x20,0x31,0x32,0x38,0x30,0x8D,0x63,0x04, // Shutdown.1280.c. END
+	0x4D,0x6F,0x75,0x6E,0x74,0x81,0x19,0x00,0x31,0x8D,0x7D,0x02,0x55,0x6E,0x6D,0x85, // Mount...1.}.Unm. END
+	0x1B,0x00,0x32,0x8D,0x99,0x04,0x49,0x6F,0x63,0x74,0x6C,0x81,0x4F,0x8E,0xB3,0x09, // ..2...Ioctl.O... END
+	0x47,0x65,0x74,0x4C,0x6F,0x67,0x4C,0x65,0x76,0x65,0x82,0x1F,0x00,0x34,0x8E,0xD3, // GetLogLeve...4.. END
+	0x8B,0x1F,0x00,0x35,0x83,0xF3,0x1C,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49, // ...5....SyscallI END
+	0x64,0x50,0x69,0x70,0x65,0x4F,0x70,0x65,0x6E,0x20,0x31,0x32,0x38,0x36,0x0A,0x63, // dPipeOpen.1286.c END
+	0x6F,0x6E,0x73,0x74,0x87,0x1C,0x06,0x52,0x65,0x6D,0x6F,0x75,0x6E,0x74,0x81,0x1B, // onst...Remount.. END
+	0x01,0x37,0x0A,0x8D,0x1C,0x09,0x53,0x74,0x72,0x43,0x68,0x72,0x20,0x31,0x35,0x33, // .7....StrChr.153 END
+	0x8E,0x37,0x83,0x1A,0x02,0x4E,0x75,0x6C,0x81,0x1D,0x00,0x37,0x8D,0x55,0x06,0x4D, // .7...Nul...7.U.M END
+	0x65,0x6D,0x4D,0x6F,0x76,0x65,0x81,0x39,0x00,0x38,0x90,0x1B,0x02,0x43,0x6D,0x70, // emMove.9.8...Cmp END
+	0x81,0x54,0x00,0x39,0x90,0x6F,0x00,0x52,0x83,0x70,0x01,0x34,0x30,0x91,0x8B,0x82, // .T.9.o.R.p.40... END
+	0x36,0x01,0x34,0x31,0x91,0x51,0x83,0x35,0x00,0x32,0x87,0xDE,0x1E,0x63,0x61,0x6C, // 6.41.Q.5.2...cal END
+	0x6C,0x49,0x64,0x53,0x74,0x72,0x52,0x65,0x70,0x6C,0x61,0x63,0x65,0x20,0x31,0x35, // lIdStrReplace.15 END
+	0x34,0x33,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20,0x53,0x79,0x73,0x83,0x1E,0x0B,0x50, // 43.const.Sys...P END
+	0x61,0x74,0x68,0x4E,0x6F,0x72,0x6D,0x61,0x6C,0x69,0x73,0x82,0x21,0x01,0x34,0x0A, // athNormalis.!.4. END
+	0x8D,0x22,0x14,0x48,0x77,0x44,0x65,0x76,0x69,0x63,0x65,0x52,0x65,0x67,0x69,0x73, // .".HwDeviceRegis END
+	0x74,0x65,0x72,0x20,0x31,0x37,0x39,0x32,0x95,0x24,0x02,0x44,0x65,0x72,0x88,0x26, // ter.1792.$.Der.& END
+	0x8E,0x6E,0x85,0x4B,0x05,0x47,0x65,0x74,0x54,0x79,0x70,0x80,0x92,0x02,0x37,0x39, // .n.K.GetTyp...79 END
+	0x34,0x95,0x6F,0x10,0x53,0x64,0x43,0x61,0x72,0x64,0x52,0x65,0x61,0x64,0x65,0x72, // 4.o.SdCardReader END
+	0x4D,0x6F,0x75,0x6E,0x74,0x81,0x78,0x00,0x35,0xA1,0x2D,0x02,0x55,0x6E,0x6D,0x80, // Mount.x.5.-.Unm. END
+	0x2F,0x30,0x74,0x20,0x31,0x37,0x39,0x36,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20,0x53, // /0t.1796.const.S END
+	0x79,0x73,0x63,0x61,0x6C,0x6C,0x49,0x64,0x48,0x77,0x44,0x65,0x76,0x69,0x63,0x65, // yscallIdHwDevice END
+	0x44,0x68,0x74,0x32,0x32,0x47,0x65,0x74,0x54,0x65,0x6D,0x70,0x65,0x72,0x61,0x74, // Dht22GetTemperat END
+	0x75,0x72,0x65,0x81,0x2F,0x00,0x37,0x9D,0x2F,0x07,0x48,0x75,0x6D,0x69,0x64,0x69, // ure./.7./.Humidi END
+	0x74,0x79,0x81,0x5C,0x00,0x38,0x95,0x5C,0x09,0x4B,0x65,0x79,0x70,0x61,0x64,0x4D, // ty.\.8.\.KeypadM END
+	0x6F,0x75,0x6E,0x82,0x84,0x00,0x39,0x9B,0x27,0x02,0x55,0x6E,0x6D,0x83,0x29,0x02, // oun...9.'.Unm.). END
+	0x38,0x30,0x30,0x9A,0xAE,0x84,0x50,0x02,0x38,0x30,0x31,0x9A,0xD5,0x84,0x4F,0x24, // 800...P.801...O$ END
+	0x20,0x31,0x38,0x30,0x32,0x0A,0x0A,0x63,0x6F,0x6E,0x73,0x74,0x20,0x53,0x79,0x73, // .1802..const.Sys END
+	0x63,0x61,0x6C,0x6C,0x49,0x64,0x49,0x6E,0x74,0x33,0x32,0x41,0x64,0x64,0x31,0x36, // callIdInt32Add16 END
+	0x20,0x32,0x30,0x34,0x38,0x95,0x1E,0x01,0x33,0x32,0x81,0x1E,0x00,0x39,0x92,0x3D, // .2048...32...9.= END
+	0x02,0x53,0x75,0x62,0x82,0x3D,0x01,0x35,0x30,0x95,0x1E,0x82,0x3D,0x01,0x35,0x31, // .Sub.=.50...=.51 END
+	0x92,0x7B,0x02,0x4D,0x75,0x6C,0x83,0x3D,0x00,0x32,0x95,0x1E,0x83,0x3D,0x00,0x33, // .{.Mul.=.2...=.3 END
+	0x92,0xB9,0x02,0x44,0x69,0x76,0x83,0x7B,0x00,0x34,0x95,0x1E,0x83,0x7B,0x02,0x35, // ...Div.{.4...{.5 END
+	0x0A,0x63,0x1C,0x6F,0x6E,0x73,0x74,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x49, // .c.onst.SyscallI END
+	0x64,0x49,0x6E,0x74,0x33,0x32,0x53,0x68,0x6C,0x20,0x32,0x30,0x35,0x36,0x0A,0x63, // dInt32Shl.2056.c END
+	0x92,0x1C,0x00,0x72,0x81,0x1C,0x0E,0x37,0x0A,0x0A,0x3B,0x20,0x45,0x78,0x65,0x63, // ...r...7..;.Exec END
+	0x20,0x66,0x6C,0x61,0x67,0x73,0x8B,0x2A,0x81,0x17,0x04,0x50,0x61,0x74,0x68,0x46, // .flags.*...PathF END
+	0x80,0x1A,0x08,0x4C,0x69,0x74,0x65,0x72,0x61,0x6C,0x20,0x30,0x97,0x22,0x07,0x53, // ...Literal.0.".S END
+	0x65,0x61,0x72,0x63,0x68,0x20,0x31,0x81,0x52,0x0C,0x57,0x61,0x69,0x74,0x50,0x69, // earch.1.R.WaitPi END
+	0x64,0x20,0x73,0x70,0x65,0x63,0x69,0x80,0x36,0x0B,0x72,0x65,0x74,0x75,0x72,0x6E, // d.speci.6.return END
+	0x20,0x76,0x61,0x6C,0x75,0x65,0x8C,0x65,0x81,0x2A,0x0F,0x70,0x69,0x64,0x53,0x74, // .value.e.*.pidSt END
+	0x61,0x74,0x75,0x73,0x53,0x75,0x63,0x63,0x65,0x73,0x73,0x8D,0x66,0x8A,0x23,0x80, // atusSuccess.f.#. END
+	0xDC,0x0D,0x65,0x72,0x72,0x75,0x70,0x74,0x65,0x64,0x20,0x36,0x35,0x35,0x33,0x31, // ..errupted.65531 END
+	0x81,0xE0,0x29,0x73,0x74,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x57,0x61,0x69, // ..)st.SyscallWai END
+	0x74,0x70,0x69,0x64,0x53,0x74,0x61,0x74,0x75,0x73,0x4E,0x6F,0x50,0x72,0x6F,0x63, // tpidStatusNoProc END
+	0x65,0x73,0x73,0x20,0x36,0x35,0x35,0x33,0x32,0x0A,0x63,0x6F,0x6E,0x94,0x29,0x05, // ess.65532.con.). END
+	0x4B,0x69,0x6C,0x6C,0x65,0x64,0x82,0x26,0x00,0x34,0x98,0x26,0x06,0x54,0x69,0x6D, // Killed.&.4.&.Tim END
+	0x65,0x6F,0x75,0x74,0x82,0x4E,0x3C,0x35,0x0A,0x0A,0x3B,0x20,0x44,0x69,0x72,0x47, // eout.N<5..;.DirG END
+	0x65,0x74,0x43,0x68,0x69,0x6C,0x64,0x72,0x65,0x6E,0x20,0x73,0x70,0x65,0x63,0x69, // etChildren.speci END
+	0x61,0x6C,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x20,0x76,0x61,0x6C,0x75,0x65,0x73, // al.return.values END
+	0x20,0x28,0x69,0x66,0x20,0x74,0x68,0x65,0x20,0x66,0x6C,0x61,0x67,0x20,0x69,0x73, // .(if.the.flag.is END
+	0x20,0x73,0x65,0x74,0x82,0x0F,0x0E,0x6C,0x6F,0x77,0x65,0x72,0x20,0x62,0x69,0x74, // .set...lower.bit END
+	0x73,0x20,0x67,0x69,0x76,0x65,0x82,0x23,0x03,0x62,0x75,0x66,0x66,0x80,0x14,0x0B, // s.give.#.buff... END
+	0x73,0x69,0x7A,0x65,0x20,0x6E,0x65,0x65,0x64,0x65,0x64,0x29,0x8B,0xB6,0x8B,0x71, // size.needed)...q END
+	0x00,0x42,0x82,0x2E,0x00,0x54,0x28,0x6F,0x6F,0x53,0x6D,0x61,0x6C,0x6C,0x46,0x6C, // .B...T(ooSmallFl END
+	0x61,0x67,0x20,0x33,0x32,0x37,0x36,0x38,0x0A,0x0A,0x3B,0x20,0x48,0x57,0x20,0x64, // ag.32768..;.HW.d END
+	0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x6F,0x6E,0x73,0x74,0x61,0x6E,0x74,0x73,0x0A, // evice.constants. END
+	0x82,0x09,0x04,0x20,0x53,0x79,0x73,0x63,0x80,0x2E,0x02,0x48,0x77,0x44,0x82,0x1F, // ....Sysc...HwD.. END
+	0x07,0x49,0x64,0x4D,0x61,0x78,0x20,0x34,0x0A,0x93,0x1D,0x0B,0x54,0x79,0x70,0x65, // .IdMax.4....Type END
+	0x55,0x6E,0x75,0x73,0x65,0x64,0x20,0x30,0x97,0x21,0x07,0x4B,0x65,0x79,0x70,0x61, // Unused.0.!.Keypa END
+	0x64,0x20,0x31,0x97,0x43,0x0D,0x53,0x64,0x43,0x61,0x72,0x64,0x52,0x65,0x61,0x64, // d.1.C.SdCardRead END
+	0x65,0x72,0x20,0x32,0x97,0x6B,0x06,0x44,0x68,0x74,0x32,0x32,0x20,0x33,0x81,0xC1, // er.2.k.Dht22.3.. END
+	0x06,0x4D,0x6F,0x75,0x6E,0x74,0x20,0x74,0x80,0x80,0x06,0x2F,0x66,0x6F,0x72,0x6D, // .Mount.t.../form END
+	0x61,0x74,0x95,0xC9,0x26,0x4D,0x6F,0x75,0x6E,0x74,0x46,0x6F,0x72,0x6D,0x61,0x74, // at..&MountFormat END
+	0x43,0x75,0x73,0x74,0x6F,0x6D,0x4D,0x69,0x6E,0x69,0x46,0x73,0x20,0x30,0x0A,0x63, // CustomMiniFs.0.c END
+	0x6F,0x6E,0x73,0x74,0x20,0x53,0x79,0x73,0x63,0x61,0x6C,0x6C,0x88,0x26,0x01,0x46, // onst.Syscall.&.F END
+	0x6C,0x80,0x03,0x04,0x69,0x6C,0x65,0x20,0x31,0x96,0x22,0x0B,0x50,0x61,0x72,0x74, // l...ile.1.".Part END
+	0x69,0x74,0x69,0x6F,0x6E,0x31,0x20,0x32,0x9F,0x24,0x02,0x32,0x20,0x33,0x9F,0x49, // ition1.2.$.2.3.I END
+	0x02,0x33,0x20,0x34,0x9F,0x6E,0x02,0x34,0x20,0x35,0x96,0xB6,0x08,0x43,0x69,0x72, // .3.4.n.4.5...Cir END
+	0x63,0x42,0x75,0x66,0x20,0x36,0x8B,0xD8,0x11,0x4D,0x6F,0x75,0x6E,0x74,0x46,0x6F, // cBuf.6...MountFo END
+	0x72,0x6D,0x61,0x74,0x46,0x61,0x74,0x20,0x37,0x0A,0xFF,0x8B,0x00,0x19,0x00,0xED, // rmatFat.7....... END
+	0x08,0x70,0x72,0x6F,0x63,0x2E,0x73,0x00,0x63,0x6F,0x6E,0x73,0x74,0x20,0x50,0x69, // .proc.s.const.Pi END
+	0x64,0x4D,0x61,0x78,0x20,0x31,0x36,0x0A,0x83,0x0F,0x05,0x41,0x72,0x67,0x4C,0x65, // dMax.16....ArgLe END
+	0x6E,0x81,0x12,0x01,0x36,0x34,0x84,0x12,0x09,0x45,0x6E,0x76,0x56,0x61,0x72,0x50, // n...64...EnvVarP END
+	0x61,0x74,0x68,0x82,0x29,0x01,0x32,0x38,0x84,0x2A,0x80,0x37,0x11,0x46,0x64,0x73, // ath.).28.*.7.Fds END
+	0x20,0x39,0x20,0x3B,0x20,0x6D,0x61,0x78,0x69,0x6D,0x75,0x6D,0x20,0x61,0x6D,0x81, // .9.;.maximum.am. END
+	0x7E,0x17,0x20,0x6F,0x66,0x20,0x6F,0x70,0x65,0x6E,0x20,0x66,0x69,0x6C,0x65,0x73, // ~..of.open.files END
+	0x20,0x61,0x20,0x73,0x69,0x6E,0x67,0x6C,0x65,0x20,0x81,0x78,0x3F,0x65,0x73,0x73, // .a.single..x?ess END
+	0x20,0x63,0x61,0x6E,0x20,0x68,0x61,0x76,0x65,0x20,0x28,0x61,0x6C,0x74,0x68,0x6F, // .can.have.(altho END
+	0x75,0x67,0x68,0x20,0x6C,0x6F,0x63,0x61,0x6C,0x20,0x66,0x64,0x3D,0x30,0x20,0x69, // ugh.local.fd=0.i END
+	0x73,0x20,0x75,0x73,0x65,0x64,0x20,0x66,0x6F,0x72,0x20,0x69,0x6E,0x76,0x61,0x6C, // s.used.for.inval END
+	0x69,0x64,0x20,0x73,0x6F,0x20,0x74,0x68,0x65,0x72,0x65,0x20,0x61,0x80,0x03,0x0D, // id.so.there.a... END
+	0x6F,0x6E,0x6C,0x79,0x20,0x38,0x20,0x61,0x76,0x61,0x69,0x6C,0x61,0x62,0x80,0x57, // only.8.availab.W END
+	0x81,0x29,0x02,0x75,0x73,0x29,0x82,0xC1,0x0D,0x74,0x20,0x41,0x72,0x67,0x4D,0x61, // .).us)...t.ArgMa END
+	0x78,0x20,0x32,0x35,0x35,0x0A,0xFF,0x8F,0x00,0x11,0x00,0x94,0x05,0x69,0x6F,0x2E, // x.255........io. END
+	0x73,0x00,0x63,0x6F,0x6E,0x73,0x74,0x20,0x50,0x61,0x74,0x68,0x81,0x2C,0x03,0x36, // s.const.Path.,.6 END
+	0x34,0x0A,0x0A,0x83,0x11,0x0A,0x46,0x64,0x49,0x6E,0x76,0x61,0x6C,0x69,0x64,0x20, // 4.....FdInvalid. END
+	0x30,0x86,0x11,0x06,0x53,0x74,0x64,0x69,0x6E,0x20,0x31,0x89,0x0F,0x04,0x6F,0x75, // 0...Stdin.1...ou END
+	0x74,0x20,0x32,0x87,0x33,0x07,0x4D,0x6F,0x64,0x65,0x4E,0x6F,0x6E,0x65,0x88,0x34, // t.2.3.ModeNone.4 END
+	0x81,0x12,0x01,0x52,0x4F,0x88,0x35,0x81,0x23,0x01,0x57,0x4F,0x80,0x35,0x8A,0x21, // ...RO.5.#.WO.5.! END
+	0x02,0x57,0x20,0x33,0x8A,0xA6};
+#endif
@@ -0,0 +1,1235 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_usr_bin_H
+#define PROGMEM_usr_bin_H
+
+#include <stdint.h>
+
+#define PROGMEM_usr_binDATASIZE 19456u
+#define PROGMEM_usr_binCOMPRESSED 0
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_usr_binDATAPTR ((uint32_t)pgm_get_far_address(progmem_usr_binData))
+static const uint8_t progmem_usr_binData[PROGMEM_usr_binDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_usr_binDATAPTR ((uintptr_t)progmem_usr_binData)
+static const uint8_t progmem_usr_binData[PROGMEM_usr_binDATASIZE]={
+#endif
+	0x35,0x97,0x01,0x04,0x05,0x0A,0x11,0x16,0x1D,0x1F,0x2B,0x33,0x39,0x3E,0x3F,0x43, // 5.........+39>?C END
+	0x47,0x4B,0x59,0x5C,0x5E,0x64,0x6B,0x6F,0x75,0x7F,0x81,0x86,0x00,0x00,0x00,0x00, // GKY\^dkou....... END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x01,0x24,0x03,0x68,0x77,0x64,0x68,0x74,0x32,0x32,0x6D,0x6E,0x74,0x00,0x2F,0x2F, // .$.hwdht22mnt.// END
+	0xDE,0x80,0x00,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x3D,0xD5,0xC4,0xFB,0x75, // .......@.X.=...u END
+	0x70,0xE1,0x80,0x83,0x93,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x3D,0xD5,0xC4,0xFB,0x75, // p......@.X.=...u END
+	0xFB,0x83,0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x3D,0xEE,0x40,0xFA,0xB4,0xE3, // ......@.X.=.@... END
+	0x80,0x06,0xD5,0x58,0xFB,0x75,0x80,0xD5,0xC0,0xFB,0x75,0xD0,0xF0,0xD5,0x6C,0xFB, // ...X.u....u...l. END
+	0x75,0x81,0xD5,0xC0,0xFB,0x75,0xEE,0x40,0xD8,0x07,0x05,0xC1,0xFB,0xF4,0xEE,0x40, // u....u.@.......@ END
+	0xD8,0x07,0x06,0xC1,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x07,0x09,0xC1, // ...........@.... END
+	0xFB,0xF4,0xEE,0x40,0xD8,0x07,0x0A,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89, // ...@.......@.... END
+	0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD5,0xE3,0xFB, // .@..p........... END
+	0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4, // u............... END
+	0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xA1,0xEE,0x89,0x90,0xC0,0xEE, // .@.....@........ END
+	0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80, // .r.....@........ END
+	0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40, // .......@.......@ END
+	0x80,0xC1,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xD7,0xDF,0xB9,0xF2,0xD3, // ................ END
+	0xF8,0xE8,0xD7,0xDF,0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xD7,0xC5,0xEE,0x09,0xFB, // ......K.J....... END
+	0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73, // ....@.........us END
+	0x61,0x67,0x65,0x3A,0x20,0x69,0x64,0x20,0x6D,0x6F,0x75,0x6E,0x74,0x50,0x6F,0x69, // age:.id.mountPoi END
+	0x6E,0x74,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x53,0x65,0x63,0x6F,0x6E, // nt.intervalSecon END
+	0x64,0x73,0x0A,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ds.............. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x18,0x01,0x65,0x64,0x69,0x74,0x6F,0x72,0x00,0x2F,0x2F,0xDE,0x80,0x00,0x80, // ...editor.//.... END
+	0xD5,0x0A,0xFB,0x75,0xEE,0x40,0x80,0xC1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ...u.@.......... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x02,0x57,0x05,0x77,0x61,0x74,0x63,0x68,0x00,0x2F,0x2F,0xDE,0x80,0x04,0xD7,0x29, // .W.watch.//....) END
+	0xFB,0x83,0xFB,0x8B,0xFB,0x93,0xD8,0x80,0x03,0x91,0x41,0xD9,0x80,0x02,0x09,0xD2, // ..........A..... END
+	0x10,0xF2,0x8A,0xF8,0x90,0xD7,0x21,0x8C,0xA3,0xC1,0xFA,0xB4,0xFA,0x74,0xFA,0x34, // ......!......t.4 END
+	0xFB,0xF4,0x82,0xC1,0x93,0xF2,0x01,0xF8,0x38,0xD7,0x9F,0xD8,0x80,0x02,0xD1,0x10, // ........8....... END
+	0x41,0xD8,0x80,0x03,0x90,0x41,0xD8,0x04,0x00,0x93,0xA7,0xC1,0x83,0x91,0xC1,0xDD, // A....A.......... END
+	0x01,0x9D,0xFB,0x75,0xD9,0x80,0x00,0xFA,0x41,0xD8,0x80,0x03,0x00,0xF2,0x00,0xF8, // ...u....A....... END
+	0x08,0xD7,0xA7,0x84,0xC1,0xD1,0x10,0xF2,0x41,0xF8,0x58,0xD7,0x6A,0xF8,0x50,0xD7, // ........A.X.j.P. END
+	0x96,0xD7,0x71,0x8E,0x92,0xD2,0xFF,0xC1,0xD7,0xA7,0xD9,0x80,0x02,0x48,0xDD,0x01, // ..q..........H.. END
+	0x8D,0xFB,0x75,0xD8,0x80,0x02,0xD1,0x10,0x41,0xD8,0x80,0x03,0x00,0xF2,0x00,0xF8, // ..u.....A....... END
+	0x08,0xD7,0xA7,0xD8,0x80,0x00,0xFA,0x02,0xDD,0x01,0xBC,0xFB,0x75,0xD7,0x50,0xD8, // ............u.P. END
+	0x02,0x3C,0xD5,0xAD,0xFB,0x75,0xD7,0xA7,0xD8,0x01,0xFD,0xD5,0xAD,0xFB,0x75,0xC0, // .<...u........u. END
+	0x80,0xDD,0x01,0x02,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0, // .....u.@.....@.. END
+	0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0xF0,0xFB,0x75,0xEF,0x00, // p............u.. END
+	0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80, // ..............@. END
+	0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xE3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1, // ....@.........r. END
+	0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE, // ....@........... END
+	0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE, // ....@.......@... END
+	0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE, // ....@........... END
+	0x09,0xDD,0x01,0xF0,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x01, // .....u.....t.4.. END
+	0x06,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x01,0xF0,0xFB,0x75,0xEE,0x80, // ..u..........u.. END
+	0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x01,0x12,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02, // .t.4......u..... END
+	0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B, // ....B../........ END
+	0xFB,0x83,0xDD,0x01,0x44,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x12, // ....D.u.@.4..... END
+	0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x02,0x4C,0xDD,0x01,0x2C, // .u.4.t......L.., END
+	0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x01,0x2C,0xFB,0x75,0xFB,0xF4,0xB1,0xEE,0x89, // .u.t.4..,.u..... END
+	0xEE,0x40,0x85,0xC1,0xFB,0xF4,0xEE,0x40,0xA0,0xDB,0xFF,0xFB,0x86,0xC1,0xF3,0x04, // .@.....@........ END
+	0xF9,0x10,0xE3,0xC7,0xFB,0xF4,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1, // ................ END
+	0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xE3, // ..........K.J... END
+	0xD9,0xEE,0x09,0xFB,0xF4,0xF2,0x40,0xF8,0x58,0xE1,0xE3,0xD1,0x3C,0xF2,0x81,0xF8, // ......@.X...<... END
+	0xB0,0xE1,0xD1,0xFB,0x83,0xD8,0xEA,0x60,0xDD,0x01,0xE8,0xFB,0x75,0xFA,0x34,0xD1, // .......`....u.4. END
+	0x3C,0xE6,0x01,0xE3,0xDF,0xD9,0x03,0xE8,0xE8,0x01,0xDD,0x01,0xE8,0xFB,0x75,0xFB, // <.............u. END
+	0xF4,0xEE,0x40,0xD8,0x03,0x06,0xC1,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01, // ..@.........@... END
+	0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x77,0x61,0x74, // ......usage:.wat END
+	0x63,0x68,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x20,0x70,0x72,0x6F,0x67, // ch.interval.prog END
+	0x72,0x61,0x6D,0x20,0x5B,0x70,0x72,0x6F,0x67,0x72,0x61,0x6D,0x61,0x72,0x67,0x31, // ram.[programarg1 END
+	0x20,0x5B,0x70,0x72,0x6F,0x67,0x72,0x61,0x6D,0x61,0x72,0x67,0x32,0x20,0x2E,0x2E, // .[programarg2... END
+	0x2E,0x5D,0x5D,0x0A,0x00,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x66, // .]]..could.not.f END
+	0x6F,0x72,0x6B,0x0A,0x00,0x2F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ork../.......... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x03,0x11,0x07,0x68,0x61,0x73,0x68,0x00,0x2F,0x2F,0xDE,0x80,0x4B,0xD8,0x04,0x00, // ...hash.//..K... END
+	0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x81,0x70,0xE1,0x80,0xD5,0x2B,0xFB,0x75, // .........p...+.u END
+	0xE3,0x80,0x06,0xE0,0x00,0xD7,0x11,0x80,0xDD,0x02,0x78,0xFB,0x75,0x81,0xDD,0x02, // ..........x.u... END
+	0x78,0xFB,0x75,0xEE,0x40,0x83,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x1F,0xEE,0x40,0xD8, // x.u.@...@.X...@. END
+	0x80,0x00,0xDD,0x02,0xC0,0xFB,0x75,0xD8,0x01,0x02,0xD9,0x80,0x00,0xA1,0xC1,0xD9, // ......u......... END
+	0x80,0x40,0x48,0xF2,0x40,0xF8,0x58,0xD7,0x25,0xD8,0x80,0x41,0xD9,0x15,0x05,0xFA, // .@H.@.X.%..A.... END
+	0x09,0xD8,0x80,0x43,0x90,0xD5,0xB6,0xFB,0x75,0xD8,0x80,0x40,0x00,0xD9,0x80,0x43, // ...C....u..@...C END
+	0xDD,0x01,0x82,0xFB,0x75,0xDA,0x01,0x00,0xF2,0x82,0xF8,0x90,0xD7,0x8F,0xDC,0x80, // ....u........... END
+	0x41,0xFA,0xA2,0xB5,0xF4,0x93,0xE4,0x90,0xFA,0xE2,0xE4,0x93,0xFB,0x11,0xD8,0x80, // A............... END
+	0x43,0xD5,0xA9,0xFB,0x75,0xD7,0x61,0xD8,0x80,0x41,0xFA,0x02,0xDD,0x01,0xF7,0xFB, // C...u.a..A...... END
+	0x75,0x8A,0xDD,0x01,0xC9,0xFB,0x75,0xD8,0x01,0x03,0xD9,0x80,0x40,0x09,0xC1,0xFB, // u.....u.....@... END
+	0xF4,0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08,0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xA0,0xFA, // ................ END
+	0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10, // ................ END
+	0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE, // ................ END
+	0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xEE,0x80,0xEE,0xC9,0x81,0x90, // ................ END
+	0xC0,0xFB,0x93,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00,0xD4,0x01,0xC1,0xF8, // ........@....... END
+	0x00,0xE1,0xCD,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1,0xC3,0xE0,0x80,0xD7, // ...#............ END
+	0xF1,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0x70,0xE1,0x80,0xFB,0x93,0xFB,0x9B, // ..X.4....p...... END
+	0xD8,0x80,0x47,0xD5,0xDC,0xFB,0x75,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x06,0xFB,0x93, // ..G...u......... END
+	0xEE,0xD2,0xEE,0x40,0xD8,0x01,0x0C,0xDA,0x80,0x47,0xD4,0x01,0xC1,0xF8,0x00,0xE1, // ...@.....G...... END
+	0xE0,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1,0xD6,0x71,0xE1,0x80,0xFB,0x93, // .#.........q.... END
+	0xFB,0x9B,0xD8,0x80,0x47,0xD5,0xA9,0xFB,0x75,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E, // ....G...u....... END
+	0xE3,0xED,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x01, // ...X.4.......@.. END
+	0x00,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00,0xF8,0x08,0xE1,0xC6,0xE3,0x80, // ................ END
+	0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x01, // .............@.. END
+	0x0C,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00,0xF8,0x08,0xE1,0xC6,0xE3,0x80, // ................ END
+	0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89, // ...........@.... END
+	0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x02,0xFA, // .@..p........... END
+	0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB, // .u.............. END
+	0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0, // ..@.....@....... END
+	0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3, // ..r.....@....... END
+	0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE, // ........@....... END
+	0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xAC,0xF6,0x4A,0xDD,0x02,0x66,0xFB,0x75, // @..p......J..f.u END
+	0xFA,0x74,0xE3,0x80,0x06,0x70,0xE1,0x80,0xFB,0x8B,0xA8,0xF6,0x4A,0xAF,0xF0,0x4A, // .t...p......J..J END
+	0xDD,0x02,0x66,0xFB,0x75,0xFA,0x74,0xE3,0x80,0x06,0x70,0xE1,0x80,0xFB,0x8B,0xA4, // ..f.u.t...p..... END
+	0xF6,0x4A,0xAF,0xF0,0x4A,0xDD,0x02,0x66,0xFB,0x75,0xFA,0x74,0xE3,0x80,0x06,0xAF, // .J..J..f.u.t.... END
+	0xF0,0x4A,0xDD,0x02,0x66,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80, // .J..f.u...@..p.. END
+	0x71,0xE1,0x80,0xA4,0xF6,0x4A,0xAF,0xF0,0x4A,0xDD,0x02,0x66,0xFB,0x75,0xE3,0x80, // q....J..J..f.u.. END
+	0x0E,0xE3,0x80,0x06,0xAF,0xF0,0x4A,0xDD,0x02,0x66,0xFB,0x75,0xFB,0xF4,0xBA,0xF2, // ......J..f.u.... END
+	0xCB,0xD2,0x30,0xE4,0x4A,0xF8,0xE0,0xE0,0x46,0xDD,0x01,0xD4,0xFB,0x75,0xFB,0xF4, // ..0.J...F....u.. END
+	0xEE,0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4, // .@.......@...... END
+	0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x02,0xFA,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA, // ..........u..... END
+	0x74,0xFA,0x34,0xDD,0x02,0x7C,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x02, // t.4..|.u........ END
+	0xFA,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x02,0x88,0xFB,0x75, // ..u...t.4......u END
+	0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93,0xF8, // .........B../... END
+	0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x02,0xBA,0xFB,0x75,0xEE,0x40,0xFA,0x34, // ...........u.@.4 END
+	0xFB,0x83,0xDD,0x02,0x88,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B,0xD9, // ......u.4.t..... END
+	0x03,0x07,0xDD,0x02,0xA2,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x02,0xA2,0xFB,0x75, // ......u.t.4....u END
+	0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x2F, // .....@........./ END
+	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x02,0x13,0x05,0x64,0x68,0x74,0x32,0x32,0x72,0x65,0x61,0x64,0x00,0x2F,0x2F,0xDE, // ...dht22read.//. END
+	0x80,0x00,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x78,0xDD,0x01,0xBF,0xFB,0x75, // ......@.X.x....u END
+	0x70,0xE1,0x80,0xD5,0x81,0xFB,0x75,0xFB,0x83,0x9A,0xEA,0x01,0xDD,0x01,0x65,0xFB, // p.....u.......e. END
+	0x75,0xD0,0x2E,0xD5,0xCC,0xFB,0x75,0xFA,0x34,0x9A,0xDD,0x01,0xB3,0xFB,0x75,0xDD, // u.....u.4.....u. END
+	0x01,0x65,0xFB,0x75,0xD0,0x43,0xD5,0xCC,0xFB,0x75,0xD0,0x20,0xD5,0xCC,0xFB,0x75, // .e.u.C...u.....u END
+	0x70,0xE1,0x80,0xD5,0x89,0xFB,0x75,0xFB,0x83,0x9A,0xEA,0x01,0xDD,0x01,0x65,0xFB, // p.....u.......e. END
+	0x75,0xD0,0x2E,0xD5,0xCC,0xFB,0x75,0xFA,0x34,0x9A,0xDD,0x01,0xB3,0xFB,0x75,0xDD, // u.....u.4.....u. END
+	0x01,0x65,0xFB,0x75,0xD0,0x25,0xD5,0xCC,0xFB,0x75,0x8A,0xD5,0xCC,0xFB,0x75,0x80, // .e.u.%...u....u. END
+	0xDD,0x01,0xBB,0xFB,0x75,0xD8,0x01,0xEB,0xD5,0xA5,0xFB,0x75,0xD7,0x72,0xEE,0x40, // ....u......u.r.@ END
+	0xD8,0x07,0x05,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x07,0x06,0xC1,0xFB,0xF4,0xEE,0xD2, // .......@........ END
+	0xEE,0x89,0xEE,0x40,0xD8,0x07,0x09,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x07,0x0A,0xC1, // ...@.......@.... END
+	0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB, // ...@.....@..p... END
+	0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0xDE,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA, // .........u...... END
+	0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ..........@..... END
+	0x40,0x82,0xD7,0xDB,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE, // @.........r..... END
+	0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE, // @............... END
+	0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A, // @............... END
+	0xF9,0x38,0xDF,0x01,0x55,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3, // .8..U.d...8..... END
+	0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10, // ..8.......8...'. END
+	0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA, // .....L..C....... END
+	0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6, // ...L..C...d..... END
+	0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43, // L..C........L..C END
+	0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82, // ...oA...B.....@. END
+	0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72, // ...@........p..r END
+	0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xD5,0xFA,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5, // .........u...... END
+	0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xD5,0xAF,0xFB,0x75, // ...I.H.........u END
+	0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFC,0xFB, // ........A.I.X... END
+	0x83,0xD0,0x2D,0xD5,0xCC,0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x01,0x65, // ..-...u.4......e END
+	0xEA,0x81,0xE8,0x91,0xE6,0x02,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF, // .........@...... END
+	0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA,0xE8, // ................ END
+	0x4B,0xE4,0x4A,0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8, // K.J...........@. END
+	0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x73, // ........usage:.s END
+	0x65,0x6E,0x73,0x6F,0x72,0x68,0x77,0x64,0x65,0x76,0x69,0x63,0x65,0x73,0x6C,0x6F, // ensorhwdeviceslo END
+	0x74,0x0A,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // t............... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x03,0x4E,0x07,0x70,0x73,0x00,0x2F,0x2F,0xDE,0x80,0xA7,0xD8,0x04,0x00,0x93,0xAD, // .N.ps.//........ END
+	0xC1,0xD7,0x10,0x80,0x91,0xC1,0xD8,0x03,0x27,0xDD,0x01,0x14,0xFB,0x75,0x89,0xD9, // ........'....u.. END
+	0x80,0x00,0xC1,0xD8,0x80,0x20,0x90,0xFA,0x09,0x90,0xDA,0x80,0x00,0xB0,0xD4,0x10, // ................ END
+	0xF3,0x1C,0xF9,0x10,0xD7,0x3A,0xFB,0x12,0xE4,0x4C,0xE0,0x81,0xE0,0xC0,0xD7,0x28, // .....:...L.....( END
+	0xD8,0x80,0x20,0xFA,0x09,0x80,0xD1,0x10,0xF2,0x41,0xF8,0x60,0xD7,0x56,0x70,0xE1, // .........A.`.Vp. END
+	0x80,0xD5,0x5C,0xFB,0x75,0xE3,0x80,0x06,0xE0,0x00,0xD7,0x40,0x80,0xDD,0x02,0x68, // ..\.u......@...h END
+	0xFB,0x75,0xD9,0x80,0x22,0x48,0x88,0xD9,0x80,0x22,0x09,0xDA,0x80,0x23,0xC1,0xF2, // .u.."H..."...#.. END
+	0x00,0xF8,0x08,0xD7,0x71,0xFB,0xF4,0xD8,0x80,0x22,0x00,0x92,0xDD,0x01,0xCD,0xFB, // ....q...."...... END
+	0x75,0xD0,0x20,0xDD,0x01,0x3B,0xFB,0x75,0xD0,0x20,0xDD,0x01,0x3B,0xFB,0x75,0xD8, // u....;.u....;.u. END
+	0x80,0x22,0x00,0x92,0xE8,0x01,0xD9,0x80,0x00,0xE4,0x01,0xFA,0x02,0xEE,0x40,0xD8, // ."............@. END
+	0x80,0xA3,0xD2,0x64,0xDD,0x02,0x52,0xFB,0x75,0xD8,0x80,0xA3,0xD9,0x80,0x20,0xFA, // ...d..R.u....... END
+	0x4A,0xDD,0x02,0x25,0xFB,0x75,0xD8,0x80,0xA3,0xDD,0x02,0x4C,0xFB,0x75,0x93,0xDD, // J..%.u.....L.u.. END
+	0x01,0xCD,0xFB,0x75,0xD0,0x20,0xDD,0x01,0x3B,0xFB,0x75,0x8B,0xD9,0x80,0x22,0x09, // ...u....;.u...". END
+	0xC1,0x94,0xDD,0x01,0xCD,0xFB,0x75,0xD0,0x20,0xDD,0x01,0x3B,0xFB,0x75,0xD8,0x80, // ......u....;.u.. END
+	0x63,0xD9,0x80,0x23,0xA8,0xDD,0x02,0xAA,0xFB,0x75,0xD8,0x80,0x63,0xDD,0x01,0x14, // c..#.....u..c... END
+	0xFB,0x75,0xD0,0x20,0xDD,0x01,0x3B,0xFB,0x75,0x87,0xD9,0x80,0x22,0x09,0xDA,0x80, // .u....;.u..."... END
+	0x63,0xC1,0xF2,0x00,0xF8,0x08,0xE1,0xC1,0xFB,0xF4,0xD8,0x80,0x63,0xDD,0x01,0x14, // c...........c... END
+	0xFB,0x75,0x8A,0xDD,0x01,0x3B,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89, // .u...;.u...@.... END
+	0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x02,0xEE, // .@..p........... END
+	0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB, // .u.............. END
+	0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0, // ..@.....@....... END
+	0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3, // ..r.....@....... END
+	0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2, // ........@....... END
+	0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x01,0xC4,0xD3,0x64,0xF3, // .........8....d. END
+	0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3, // ..8.......8..... END
+	0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF, // ..8...'......L.. END
+	0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0, // C..........L..C. END
+	0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA, // ..d.....L..C.... END
+	0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0, // ....L..C...oA... END
+	0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0, // B.....@....@.... END
+	0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x01, // ....p..r........ END
+	0x69,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4, // i.u.........I.H. END
+	0x93,0x90,0xE3,0x80,0x06,0xDD,0x01,0x1E,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80, // .........u...... END
+	0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFE,0xFB,0x83,0xD0,0x2D,0xDD,0x01,0x3B, // ..A.I.X.....-..; END
+	0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x01,0xD4,0xEE,0x89,0xEE,0x40,0xD8, // .u.4..........@. END
+	0x08,0x06,0xC1,0xFB,0xF4,0xEE,0xB6,0xE1,0x83,0xDD,0x02,0x3C,0xFB,0x75,0xE3,0x83, // ...........<.u.. END
+	0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4,0xFA,0x02, // .......@........ END
+	0xFB,0xF4,0xE0,0x01,0xFA,0x02,0xFB,0xF4,0xFB,0x83,0xFB,0x93,0xDD,0x02,0xFB,0xFB, // ................ END
+	0x75,0xFA,0x74,0xFA,0x34,0xC0,0xFC,0x0C,0xFB,0xF4,0xFC,0x0D,0xFB,0xF4,0xEE,0x40, // u.t.4..........@ END
+	0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83, // .......@........ END
+	0xFB,0x8B,0xEE,0x09,0xDD,0x02,0xEE,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA, // ........u.....t. END
+	0x34,0xDD,0x02,0x6C,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x02,0xEE,0xFB, // 4..l.u.......... END
+	0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x02,0x78,0xFB,0x75,0xFB,0xF4, // u...t.4....x.u.. END
+	0xB0,0x43,0xFB,0x83,0xFB,0x8B,0xFB,0x93,0xEE,0x09,0xDD,0x02,0xEE,0xFB,0x75,0xEE, // .C............u. END
+	0xC0,0xFA,0xB4,0xFA,0x74,0xFA,0x34,0xF3,0x1A,0xF9,0x20,0xE1,0xDF,0xE6,0x93,0xF2, // ....t.4......... END
+	0xD2,0xF8,0xD8,0xE1,0xD7,0xFB,0x83,0xFB,0x8B,0xFB,0x93,0xD9,0x03,0x46,0xDD,0x02, // .............F.. END
+	0x92,0xFB,0x75,0xFA,0xB4,0xFA,0x74,0xFA,0x34,0xE2,0x80,0xE3,0xDD,0xDD,0x02,0x92, // ..u...t.4....... END
+	0xFB,0x75,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB, // .u.....@........ END
+	0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13,0x02,0xFB, // ................ END
+	0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02,0xFB,0xF4, // ................ END
+	0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0x50,0x49,0x44, // .............PID END
+	0x20,0x43,0x50,0x55,0x20,0x52,0x41,0x4D,0x20,0x20,0x20,0x20,0x20,0x53,0x54,0x41, // .CPU.RAM.....STA END
+	0x54,0x45,0x20,0x43,0x4F,0x4D,0x4D,0x41,0x4E,0x44,0x0A,0x00,0x20,0x00,0xFF,0xFF, // TE.COMMAND...... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0xC2,0x02,0x68,0x77,0x64,0x65,0x72,0x65,0x67,0x00,0x2F,0x2F,0xDE,0x80,0x00, // ...hwdereg.//... END
+	0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x1D,0xD5,0x80,0xFB,0x75,0xEE,0x40,0xD8, // ....@.X.....u.@. END
+	0x07,0x01,0xC1,0x80,0xD5,0x7C,0xFB,0x75,0xD0,0xAC,0xD5,0x28,0xFB,0x75,0x81,0xD5, // .....|.u...(.u.. END
+	0x7C,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80, // |.u.@.....@..p.. END
+	0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD5,0x9F,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA, // .........u...... END
+	0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ..........@..... END
+	0x40,0x82,0xD7,0x5D,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE, // @..]......r..... END
+	0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE, // @............... END
+	0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF,0xB0, // @.......@....... END
+	0xF2,0xD3,0xF8,0xF8,0xD7,0x9B,0xB9,0xF2,0xD3,0xF8,0xE8,0xD7,0x9B,0xBA,0xE8,0x4B, // ...............K END
+	0xE4,0x4A,0xE0,0x00,0xD7,0x81,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06, // .J...........@.. END
+	0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x69,0x64, // .......usage:.id END
+	0x0A,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x05,0x9B,0x0C,0x74,0x72,0x65,0x65,0x00,0x2F,0x2F,0xDE,0x80,0x4C,0xD8,0x04,0x00, // ...tree.//..L... END
+	0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0xD8,0x80,0x00,0xD9,0x04,0xFB,0xDD,0x02, // ................ END
+	0x55,0xFB,0x75,0x80,0xD5,0x26,0xFB,0x75,0x80,0xDD,0x02,0x45,0xFB,0x75,0x70,0xE1, // U.u..&.u...E.up. END
+	0x80,0xEE,0x40,0xF2,0x09,0xF8,0x18,0xD7,0x41,0x71,0xE1,0x80,0xD0,0x20,0xD5,0xEA, // ..@.....Aq...... END
+	0xFB,0x75,0xE3,0x80,0x0E,0xE2,0x40,0xD7,0x2B,0xE3,0x80,0x06,0x91,0xF2,0x41,0xF8, // .u....@.+.....A. END
+	0x68,0xE0,0x00,0xD9,0x80,0x00,0xE4,0x01,0xD5,0xC3,0xFB,0x75,0xD0,0x20,0xD5,0xEA, // h..........u.... END
+	0xFB,0x75,0xD8,0x01,0x0F,0xD9,0x80,0x00,0xDA,0x80,0x40,0xC1,0xD8,0x80,0x40,0xD9, // .u........@...@. END
+	0x05,0x66,0xDD,0x01,0x18,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xD7,0x7D,0xD8,0x80,0x40, // .f....u.....}..@ END
+	0xDD,0x01,0x36,0xFB,0x75,0x8A,0xD5,0xEA,0xFB,0x75,0xD8,0x80,0x00,0xDD,0x02,0x6F, // ..6.u....u.....o END
+	0xFB,0x75,0xEF,0x00,0xD8,0x01,0x02,0xD9,0x80,0x00,0xA1,0xC1,0xF2,0x40,0xF8,0x58, // .u...........@.X END
+	0xD7,0xC1,0xEE,0x40,0xD8,0x01,0x14,0xDA,0x80,0x00,0xC1,0xF2,0x00,0xF8,0x18,0xD7, // ...@............ END
+	0xBD,0x71,0xE1,0x80,0x74,0xE1,0x80,0xEE,0x24,0xD5,0x26,0xFB,0x75,0xE3,0x80,0x26, // .q..t...$.&.u..& END
+	0xE3,0x80,0x0E,0xD7,0x9C,0xD8,0x01,0x03,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE, // ............@... END
+	0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x02, // ..@..p.......... END
+	0x6F,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1, // o.u............. END
+	0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xF9,0xEE,0x89,0x90, // ...@.....@...... END
+	0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1, // ...r.....@...... END
+	0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4, // .........@...... END
+	0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x40,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8, // ...@..@......@.. END
+	0x60,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x68,0x80,0xFB,0xF4,0xFB,0x83, // `......@..h..... END
+	0xD9,0x05,0x3D,0xDD,0x01,0x22,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xF2,0x49,0xF8,0x58, // ..=..".u.@.4.I.X END
+	0xE1,0xF7,0xFB,0x83,0xD9,0x05,0x39,0xDD,0x01,0x22,0xFB,0x75,0xEE,0x40,0xFA,0x34, // ......9..".u.@.4 END
+	0xF2,0x49,0xF8,0x58,0xDF,0x01,0xC3,0xFB,0x83,0xD9,0x05,0x35,0xDD,0x01,0x22,0xFB, // .I.X.......5..". END
+	0x75,0xEE,0x40,0xFA,0x34,0xF2,0x49,0xF8,0x58,0xDF,0x02,0x04,0xDD,0x02,0xB5,0xFB, // u.@.4.I.X....... END
+	0x75,0xD8,0x05,0x42,0xD5,0xC3,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xD9,0x05,0x3D,0xDA, // u..B...u......=. END
+	0x80,0x44,0xDD,0x02,0x93,0xFB,0x75,0xFA,0x34,0xDD,0x02,0xB5,0xFB,0x75,0xD0,0x2E, // .D....u.4....u.. END
+	0xD5,0xEA,0xFB,0x75,0xD8,0x80,0x44,0xD9,0x05,0x01,0xDD,0x02,0xB1,0xFB,0x75,0xD8, // ...u..D.......u. END
+	0x80,0x44,0xD9,0x05,0x3D,0xDD,0x02,0x86,0xFB,0x75,0xD8,0x80,0x44,0xDD,0x02,0xB5, // .D..=....u..D... END
+	0xFB,0x75,0xD8,0x05,0x47,0xD5,0xC3,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xD9,0x05,0x39, // .u..G...u......9 END
+	0xDA,0x80,0x44,0xDD,0x02,0x93,0xFB,0x75,0xFA,0x34,0xDD,0x02,0xB5,0xFB,0x75,0xD0, // ..D....u.4....u. END
+	0x2E,0xD5,0xEA,0xFB,0x75,0xD8,0x80,0x44,0xD9,0x05,0x01,0xDD,0x02,0xB1,0xFB,0x75, // ....u..D.......u END
+	0xD8,0x80,0x44,0xD9,0x05,0x39,0xDD,0x02,0x86,0xFB,0x75,0xD8,0x80,0x44,0xDD,0x02, // ..D..9....u..D.. END
+	0xB5,0xFB,0x75,0xD8,0x05,0x44,0xD5,0xC3,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xD9,0x05, // ..u..D...u...... END
+	0x35,0xDA,0x80,0x44,0xDD,0x02,0x93,0xFB,0x75,0xFA,0x34,0xDD,0x02,0xB5,0xFB,0x75, // 5..D....u.4....u END
+	0xD0,0x2E,0xD5,0xEA,0xFB,0x75,0xD8,0x80,0x44,0xD9,0x05,0x01,0xDD,0x02,0xB1,0xFB, // .....u..D....... END
+	0x75,0xD8,0x80,0x44,0xD9,0x05,0x35,0xDD,0x02,0x86,0xFB,0x75,0xD8,0x80,0x44,0xDD, // u..D..5....u..D. END
+	0x02,0xB5,0xFB,0x75,0xD8,0x05,0x41,0xD5,0xC3,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0x80, // ...u..A...u...@. END
+	0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB, // ......@......... END
+	0x8B,0xEE,0x09,0xDD,0x02,0x6F,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34, // .....o.u.....t.4 END
+	0xDD,0x02,0x49,0xFB,0x75,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1, // ..I.u.....@..... END
+	0xE6,0x03,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x06,0xC1,0xFB,0xF4,0xEE,0xB6, // .......@........ END
+	0xE1,0x83,0xDD,0x02,0x93,0xFB,0x75,0xE3,0x83,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE, // ......u......... END
+	0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x93,0xDD,0x03,0x10,0xFB,0x75, // @..............u END
+	0xFA,0x74,0xFA,0x34,0xC0,0xFC,0x0C,0xFB,0xF4,0xFC,0x0D,0xFB,0xF4,0x92,0xC0,0xA0, // .t.4............ END
+	0xC0,0xEE,0xF6,0xD4,0x0C,0xE5,0xB4,0x71,0xE1,0x80,0xFB,0x93,0xFB,0x9B,0xEE,0x40, // .......q.......@ END
+	0xEE,0x1B,0xDD,0x04,0x00,0xFB,0x75,0xFA,0xB4,0xFA,0x74,0xE3,0x80,0x06,0xD5,0xCD, // ......u...t..... END
+	0xFB,0x75,0xD4,0x0C,0xE7,0xB4,0xFB,0xF4,0xFB,0x83,0xD0,0x7B,0xD5,0xEA,0xFB,0x75, // .u.........{...u END
+	0xFA,0x34,0xFB,0x83,0xDD,0x03,0xF6,0xFB,0x75,0xDD,0x03,0xA7,0xFB,0x75,0xD0,0x2C, // .4......u....u., END
+	0xD5,0xEA,0xFB,0x75,0xFA,0x34,0xDD,0x03,0xFA,0xFB,0x75,0xDD,0x03,0xA7,0xFB,0x75, // ...u.4....u....u END
+	0xD0,0x7D,0xD5,0xEA,0xFB,0x75,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4, // .}...u.......... END
+	0xFA,0x09,0xA0,0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19, // ................ END
+	0xF4,0xCA,0xFE,0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE, // ................ END
+	0x0C,0x02,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF, // ..............8. END
+	0x03,0x97,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38, // ...d...8.......8 END
+	0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9, // .......8...'.... END
+	0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6, // ..L..C.......... END
+	0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF, // L..C...d.....L.. END
+	0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0, // C........L..C... END
+	0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE, // oA...B.....@.... END
+	0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB, // @........p..r... END
+	0x9B,0xEE,0x1B,0xDD,0x03,0x3C,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9, // .....<.u........ END
+	0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xD5,0xCD,0xFB,0x75,0xE3,0x85, // .I.H.........u.. END
+	0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFD,0xFB,0x83,0xD0, // ......A.I.X..... END
+	0x2D,0xD5,0xEA,0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x03,0xA7,0xFA,0x02, // -...u.4......... END
+	0xFB,0xF4,0xE0,0x01,0xFA,0x02,0xFB,0xF4,0xFB,0x83,0xD8,0x80,0x48,0xDD,0x03,0x36, // ............H..6 END
+	0xFB,0x75,0xFA,0x34,0xFB,0x83,0xD8,0x80,0x48,0xDD,0x04,0xC6,0xFB,0x75,0xE0,0x00, // .u.4....H....u.. END
+	0xEE,0x40,0xFA,0x34,0xE4,0x01,0x90,0x41,0xE2,0x00,0xFB,0x83,0xD8,0x80,0x48,0x9A, // .@.4...A......H. END
+	0xDD,0x02,0x7C,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xE0,0x6F,0x41,0xE2,0x00,0xFB,0x83, // ..|.u.@.4.oA.... END
+	0xD8,0x80,0x48,0xD9,0x05,0x66,0xDD,0x01,0x18,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8, // ..H..f....u.@.4. END
+	0x58,0xE3,0xE8,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0x90,0xDD,0x03,0x10,0xFB,0x75,0xFA, // X.............u. END
+	0x74,0xFA,0x34,0x11,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xE9,0xB9,0xF2,0xD3, // t.4............. END
+	0xF8,0xE8,0xE1,0xE2,0xFB,0x8B,0xFB,0x83,0x72,0xE1,0x80,0xD9,0x05,0x01,0xDD,0x02, // ........r....... END
+	0xB1,0xFB,0x75,0xE3,0x80,0x0E,0xFA,0x34,0xFB,0x83,0xDD,0x04,0x96,0xFB,0x75,0xFA, // ..u....4......u. END
+	0x34,0xFA,0x74,0xE0,0x40,0xE3,0xF3,0xFB,0xF4,0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08, // 4.t.@........... END
+	0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xEE,0x40,0xFA,0x0A,0xFA,0x07,0xD2,0x10,0xF2,0x82, // .......@........ END
+	0xF8,0x80,0xFB,0xF4,0xFE,0x0A,0x02,0xFA,0x07,0xE0,0x0F,0xFB,0xF4,0xDD,0x04,0x9E, // ................ END
+	0xFB,0x75,0xD1,0x1F,0xF2,0x81,0xF8,0xA8,0xE2,0x00,0xE6,0x08,0xFB,0xF4,0xFB,0x83, // .u.............. END
+	0xDD,0x04,0x9E,0xFB,0x75,0xD9,0x05,0x4A,0xE4,0x01,0x10,0xFA,0x34,0x72,0xE1,0x80, // ....u..J....4r.. END
+	0xFB,0x83,0xEE,0x12,0xE0,0x00,0xDD,0x04,0xF1,0xFB,0x75,0xFA,0x74,0xDD,0x01,0x2C, // ..........u.t.., END
+	0xFB,0x75,0xE3,0x80,0x0E,0xE4,0x01,0xFB,0xF4,0x94,0xE8,0x01,0xD9,0x05,0x6B,0xE4, // .u............k. END
+	0x01,0xFB,0xF4,0x2F,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00, // .../............ END
+	0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42, // d......'.......B END
+	0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00, // @........;...... END
+	0x3C,0x00,0x00,0x0E,0x10,0x00,0x01,0x51,0x80,0x77,0x35,0x94,0x00,0x00,0x00,0x04, // <......Q.w5..... END
+	0x00,0x00,0x10,0x00,0x00,0x40,0x00,0x00,0x00,0x6B,0x62,0x00,0x6D,0x62,0x00,0x67, // .....@...kb.mb.g END
+	0x62,0x00,0x08,0x08,0x08,0x08,0x08,0x07,0x07,0x07,0x06,0x06,0x06,0x06,0x05,0x05, // b............... END
+	0x05,0x04,0x04,0x04,0x03,0x03,0x03,0x03,0x02,0x02,0x02,0x01,0x01,0x01,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00, // ..............d. END
+	0x00,0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00, // .....'.......B@. END
+	0x98,0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0xFF,0xFF,0xFF,0xFF,0xFF, // .......;........ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x03,0x94,0x08,0x64,0x61,0x74,0x65,0x00,0x2F,0x2F,0xDE,0x80,0x13,0xD8,0x80,0x00, // ...date.//...... END
+	0xD5,0x33,0xFB,0x75,0xD8,0x80,0x04,0xD9,0x80,0x00,0xDD,0x01,0x15,0xFB,0x75,0xD8, // .3.u..........u. END
+	0x80,0x04,0xDD,0x01,0x3C,0xFB,0x75,0x8A,0xDD,0x01,0xE2,0xFB,0x75,0x80,0xDD,0x01, // ....<.u.....u... END
+	0xB7,0xFB,0x75,0xEE,0x40,0xD8,0x03,0x02,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x03,0x04, // ..u.@.......@... END
+	0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x80,0x0B,0xDD,0x03,0x3D,0xFB,0x75,0xD8,0x80,0x0B, // ....@.....=.u... END
+	0xD9,0x03,0x84,0xDD,0x02,0xD6,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xD7,0x83,0xD8,0x80, // .......u........ END
+	0x0F,0xD9,0x80,0x0B,0xDD,0x03,0x3D,0xFB,0x75,0xD8,0x80,0x0F,0xD9,0x03,0x84,0xDA, // ......=.u....... END
+	0x80,0x0B,0xDD,0x03,0x01,0xFB,0x75,0xD8,0x80,0x0F,0xDD,0x03,0x11,0xFB,0x75,0xDD, // ......u.......u. END
+	0x02,0x7B,0xFB,0x75,0xD0,0x64,0xDD,0x01,0xE2,0xFB,0x75,0xD8,0x80,0x0B,0xD9,0x03, // .{.u.d....u..... END
+	0x80,0xDD,0x02,0xD6,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xD7,0xC1,0xD8,0x80,0x0F,0xD9, // .....u.......... END
+	0x80,0x0B,0xDD,0x03,0x3D,0xFB,0x75,0xD8,0x80,0x0F,0xD9,0x03,0x80,0xDA,0x80,0x0B, // ....=.u......... END
+	0xDD,0x03,0x01,0xFB,0x75,0xD8,0x80,0x0F,0xDD,0x03,0x11,0xFB,0x75,0xDD,0x02,0x7B, // ....u.......u..{ END
+	0xFB,0x75,0xD0,0x68,0xDD,0x01,0xE2,0xFB,0x75,0xD8,0x80,0x0B,0xD9,0x03,0x7C,0xDD, // .u.h....u.....|. END
+	0x02,0xD6,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xD7,0xFF,0xD8,0x80,0x0F,0xD9,0x80,0x0B, // ...u............ END
+	0xDD,0x03,0x3D,0xFB,0x75,0xD8,0x80,0x0F,0xD9,0x03,0x7C,0xDA,0x80,0x0B,0xDD,0x03, // ..=.u.....|..... END
+	0x01,0xFB,0x75,0xD8,0x80,0x0F,0xDD,0x03,0x11,0xFB,0x75,0xDD,0x02,0x7B,0xFB,0x75, // ..u.......u..{.u END
+	0xD0,0x6D,0xDD,0x01,0xE2,0xFB,0x75,0xD8,0x80,0x0B,0xDD,0x03,0x11,0xFB,0x75,0xDD, // .m....u.......u. END
+	0x02,0x7B,0xFB,0x75,0xD0,0x73,0xDD,0x01,0xE2,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE, // .{.u.s....u..... END
+	0x40,0xD8,0x03,0x05,0xC1,0xFB,0xF4,0xFA,0x02,0xFB,0xF4,0xE0,0x01,0x00,0xFB,0xF4, // @............... END
+	0xE0,0x02,0x00,0xFB,0xF4,0xE0,0x03,0x00,0xFB,0xF4,0xE0,0x04,0x00,0xFB,0xF4,0xE0, // ................ END
+	0x05,0x00,0xFB,0xF4,0xFB,0x83,0xDD,0x01,0x28,0xFB,0x75,0x92,0xDD,0x02,0x74,0xFB, // ........(.u...t. END
+	0x75,0xD0,0x2F,0xDD,0x01,0xE2,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x23,0xFB, // u./....u.4....#. END
+	0x75,0x92,0xDD,0x02,0x74,0xFB,0x75,0xD0,0x2F,0xDD,0x01,0xE2,0xFB,0x75,0xFA,0x34, // u...t.u./....u.4 END
+	0xFB,0x83,0xDD,0x01,0x1F,0xFB,0x75,0x92,0xDD,0x02,0x74,0xFB,0x75,0xD0,0x20,0xDD, // ......u...t.u... END
+	0x01,0xE2,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x2D,0xFB,0x75,0x92,0xDD,0x02, // ...u.4....-.u... END
+	0x74,0xFB,0x75,0xD0,0x3A,0xDD,0x01,0xE2,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01, // t.u.:....u.4.... END
+	0x32,0xFB,0x75,0x92,0xDD,0x02,0x74,0xFB,0x75,0xD0,0x3A,0xDD,0x01,0xE2,0xFB,0x75, // 2.u...t.u.:....u END
+	0xFA,0x34,0xDD,0x01,0x37,0xFB,0x75,0x92,0xDD,0x02,0x74,0xFB,0x75,0xFB,0xF4,0xEE, // .4..7.u...t.u... END
+	0x40,0x80,0xC1,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80, // @...@.....@..p.. END
+	0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x03,0x43,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01, // ........C.u..... END
+	0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89, // ...........@.... END
+	0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89, // .@.........r.... END
+	0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89, // .@.............. END
+	0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3, // .@.............. END
+	0x0A,0xF9,0x38,0xDF,0x02,0x6B,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3, // ..8..k.d...8.... END
+	0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27, // ...8.......8...' END
+	0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA, // ......L..C...... END
+	0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A, // ....L..C...d.... END
+	0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF, // .L..C........L.. END
+	0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40, // C...oA...B.....@ END
+	0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80, // ....@........p.. END
+	0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x02,0x10,0xFB,0x75,0xFA,0xB4,0xE3,0x80, // r..........u.... END
+	0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xDD,0x01, // .....I.H........ END
+	0xC5,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58, // ..u........A.I.X END
+	0xE3,0xFE,0xFB,0x83,0xD0,0x2D,0xDD,0x01,0xE2,0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0, // .....-....u.4... END
+	0x00,0xDF,0x02,0x7B,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x40,0x80,0xFB,0xF4,0xFC,0x0F, // ...{...@..@..... END
+	0xEE,0x40,0x81,0xF8,0x60,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x68,0x80, // .@..`......@..h. END
+	0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x06,0xC1,0xFB,0xF4,0xEE,0xB6,0xE1,0x83, // .....@.......... END
+	0xDD,0x03,0x01,0xFB,0x75,0xE3,0x83,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8, // ....u.........@. END
+	0x08,0x07,0xC1,0xFB,0xF4,0xFA,0x02,0xFB,0xF4,0xE0,0x01,0xFA,0x02,0xFB,0xF4,0xA0, // ................ END
+	0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13,0x02,0xFB,0xF4,0xD3, // ................ END
+	0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02,0xFB,0xF4,0xFA,0x09, // ................ END
+	0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8, // ..............@. END
+	0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, // ................ END
+	0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10, // .......d......'. END
+	0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00, // ......B@........ END
+	0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x0E,0x10,0x00,0x01,0x51,0x80, // ;......<......Q. END
+	0x77,0x35,0x94,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // w5.............. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x02,0x85,0x06,0x68,0x65,0x78,0x64,0x75,0x6D,0x70,0x00,0x2F,0x2F,0xDE,0x80,0x45, // ...hexdump.//..E END
+	0xD8,0x04,0x00,0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x81,0x70,0xE1,0x80,0xD5, // ............p... END
+	0x2B,0xFB,0x75,0xE3,0x80,0x06,0xE0,0x00,0xD7,0x11,0x80,0xDD,0x01,0xDD,0xFB,0x75, // +.u............u END
+	0x81,0xDD,0x01,0xDD,0xFB,0x75,0xEE,0x40,0x83,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x25, // .....u.@...@.X.% END
+	0xFB,0x83,0xD9,0x02,0x76,0xDD,0x02,0x5F,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x48, // ....v.._.u.@.4.H END
+	0xD7,0x4F,0xC0,0x81,0xD9,0x80,0x40,0x48,0xD7,0x66,0xEE,0x40,0xD8,0x80,0x00,0xDD, // .O....@H.f.@.... END
+	0x02,0x25,0xFB,0x75,0xD8,0x01,0x02,0xD9,0x80,0x00,0xA1,0xC1,0xD9,0x80,0x40,0x48, // .%.u..........@H END
+	0xC0,0xF2,0x40,0xF8,0x58,0xD7,0x25,0xD8,0x80,0x41,0x90,0xD5,0xDB,0xFB,0x75,0xD8, // ..@.X.%..A....u. END
+	0x01,0x0C,0xD9,0x80,0x40,0x09,0xDA,0x80,0x41,0xDB,0x80,0x00,0xD4,0x40,0xC1,0xF3, // ....@...A....@.. END
+	0x00,0xF9,0x18,0xD7,0xBC,0x90,0x70,0xE1,0x80,0x71,0xE1,0x80,0xD8,0x80,0x00,0xE4, // ......p..q...... END
+	0x01,0x00,0xDD,0x01,0xA6,0xFB,0x75,0xD0,0x20,0xDD,0x01,0x2E,0xFB,0x75,0xE3,0x80, // ......u......u.. END
+	0x0E,0xE3,0x80,0x06,0xE0,0x40,0xF3,0x08,0xF9,0x38,0xD7,0x8B,0xEE,0x40,0xD8,0x80, // .....@...8...@.. END
+	0x41,0xD5,0xD3,0xFB,0x75,0xD7,0x74,0x81,0x09,0xF2,0x81,0xD8,0x01,0x03,0xF8,0x80, // A...u.t......... END
+	0xC1,0x8A,0xDD,0x01,0x2E,0xFB,0x75,0xFB,0xF4,0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08, // ......u......... END
+	0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09, // ................ END
+	0xA0,0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA, // ................ END
+	0xFE,0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02, // ................ END
+	0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB, // ...@.....@..p... END
+	0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x02,0x69,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA, // .......i.u...... END
+	0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ..........@..... END
+	0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE, // @.........r..... END
+	0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE, // @............... END
+	0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B, // @.......@..p.... END
+	0xAC,0xF6,0x4A,0xDD,0x01,0xCB,0xFB,0x75,0xFA,0x74,0xE3,0x80,0x06,0x70,0xE1,0x80, // ..J....u.t...p.. END
+	0xFB,0x8B,0xA8,0xF6,0x4A,0xAF,0xF0,0x4A,0xDD,0x01,0xCB,0xFB,0x75,0xFA,0x74,0xE3, // ....J..J....u.t. END
+	0x80,0x06,0x70,0xE1,0x80,0xFB,0x8B,0xA4,0xF6,0x4A,0xAF,0xF0,0x4A,0xDD,0x01,0xCB, // ..p......J..J... END
+	0xFB,0x75,0xFA,0x74,0xE3,0x80,0x06,0xAF,0xF0,0x4A,0xDD,0x01,0xCB,0xFB,0x75,0xFB, // .u.t.....J....u. END
+	0xF4,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0x71,0xE1,0x80,0xA4,0xF6,0x4A,0xAF,0xF0, // ..@..p..q....J.. END
+	0x4A,0xDD,0x01,0xCB,0xFB,0x75,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xAF,0xF0,0x4A,0xDD, // J....u........J. END
+	0x01,0xCB,0xFB,0x75,0xFB,0xF4,0xBA,0xF2,0xCB,0xD2,0x30,0xE4,0x4A,0xF8,0xE0,0xE0, // ...u......0.J... END
+	0x46,0xDD,0x01,0x39,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89, // F..9.u...@...... END
+	0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x02, // .@.............. END
+	0x69,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x01,0xE1,0xFB,0x75, // i.u.....t.4....u END
+	0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x02,0x69,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA, // ........i.u...t. END
+	0x34,0xE4,0x02,0xDD,0x01,0xED,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4, // 4......u........ END
+	0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD, // .B../........... END
+	0x02,0x1F,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x01,0xED,0xFB,0x75,0xFA, // ...u.@.4......u. END
+	0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x02,0x78,0xDD,0x02,0x07,0xFB,0x75,0xFA, // 4.t......x....u. END
+	0x74,0xFA,0x34,0xDD,0x02,0x07,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x06, // t.4....u.....@.. END
+	0x05,0xC1,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB, // .......@........ END
+	0xF4,0x2D,0x00,0x2F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // .-./............ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x02,0x10,0x05,0x66,0x61,0x63,0x74,0x6F,0x72,0x00,0x2F,0x2F,0xDE,0x80,0x00,0xD8, // ...factor.//.... END
+	0x04,0x00,0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x81,0x70,0xE1,0x80,0xD5,0x25, // ...........p...% END
+	0xFB,0x75,0xE3,0x80,0x06,0xE0,0x00,0xD7,0x11,0x80,0xDD,0x01,0x9C,0xFB,0x75,0xEE, // .u............u. END
+	0x40,0x83,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x1F,0xDD,0x01,0xA0,0xFB,0x75,0xF2,0x40, // @...@.X......u.@ END
+	0xF8,0x58,0xD7,0x8C,0xFB,0x83,0xDD,0x01,0x4E,0xFB,0x75,0xD8,0x02,0x03,0xD5,0x8E, // .X......N.u..... END
+	0xFB,0x75,0xFA,0x34,0xD9,0x01,0xCC,0xA2,0xF2,0x82,0xF8,0xB8,0xD7,0x87,0x11,0xF2, // .u.4............ END
+	0xD2,0xF8,0xD8,0xD7,0x82,0xEA,0xC2,0xE8,0xDA,0xF2,0xC3,0xF8,0xC0,0xD7,0x7E,0xEA, // ..............~. END
+	0x02,0xFB,0x83,0xFB,0x8B,0xEE,0x12,0xDD,0x01,0x4E,0xFB,0x75,0xD0,0x20,0xD5,0xB5, // .........N.u.... END
+	0xFB,0x75,0xFA,0x74,0xFA,0x34,0xD7,0x4D,0xE0,0x40,0xD7,0x4D,0xDD,0x01,0x4E,0xFB, // .u.t.4.M.@.M..N. END
+	0x75,0x8A,0xD5,0xB5,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40, // u....u...@.....@ END
+	0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0xBF,0xFB,0x75, // ..p............u END
+	0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE, // ................ END
+	0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xC4,0xEE,0x89,0x90,0xC0,0xEE,0xF6, // @.....@......... END
+	0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB, // r.....@......... END
+	0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8, // ......@......... END
+	0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x01,0x3E,0xD3,0x64,0xF3,0x0B,0xF9, // .......8..>.d... END
+	0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9, // 8.......8....... END
+	0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0, // 8...'......L..C. END
+	0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2, // .........L..C... END
+	0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9, // d.....L..C...... END
+	0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB, // ..L..C...oA...B. END
+	0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6, // ....@....@...... END
+	0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xD5,0xE3,0xFB,0x75, // ..p..r.........u END
+	0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3, // .........I.H.... END
+	0x80,0x06,0xD5,0x98,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2, // .....u........A. END
+	0x49,0xF8,0x58,0xE3,0xFC,0xFB,0x83,0xD0,0x2D,0xD5,0xB5,0xFB,0x75,0xFA,0x34,0xFA, // I.X.....-...u.4. END
+	0x00,0xE0,0x00,0xDF,0x01,0x4E,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF,0xB0,0xF2, // .....N.@........ END
+	0xD3,0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA,0xE8,0x4B,0xE4, // ..............K. END
+	0x4A,0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01, // J...........@... END
+	0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x02,0x03,0x05,0x07,0x0B,0x0D,0x11,0x13,0x17,0x1D, // ................ END
+	0x1F,0x25,0x29,0x2B,0x2F,0x35,0x3B,0x3D,0x43,0x47,0x49,0x4F,0x53,0x59,0x61,0x65, // .%)+/5;=CGIOSYae END
+	0x67,0x6B,0x6D,0x71,0x7F,0x83,0x89,0x8B,0x95,0x97,0x9D,0xA3,0xA7,0xAD,0xB3,0xB5, // gkmq............ END
+	0xBF,0xC1,0xC5,0xC7,0xD3,0xDF,0xE3,0xE5,0xE9,0xEF,0xF1,0xFB,0x00,0x3A,0x20,0x00, // .............:.. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x17,0x01,0x62,0x75,0x72,0x6E,0x00,0x2F,0x2F,0xD8,0x04,0x00,0x93,0xAA,0xC1, // ...burn.//...... END
+	0xD7,0x0D,0x80,0x91,0xC1,0xD7,0x0D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x01,0xE2,0x04,0x6C,0x73,0x6F,0x66,0x00,0x2F,0x2F,0xDE,0x80,0x82,0xD8,0x04,0x00, // ...lsof.//...... END
+	0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0xD8,0x80,0x00,0x90,0x41,0x87,0xD9,0x80, // ............A... END
+	0x00,0x09,0xDA,0x80,0x01,0xC1,0xF2,0x00,0xF8,0x18,0xD7,0xA3,0xD8,0x80,0x41,0x90, // ..............A. END
+	0x41,0x8D,0xD9,0x80,0x00,0x09,0xDA,0x80,0x41,0x12,0xC1,0xF2,0x40,0xF8,0x58,0xD7, // A.......A...@.X. END
+	0x93,0xEE,0x40,0xD8,0x01,0x13,0xDA,0x80,0x42,0xC1,0xF2,0x00,0xF8,0x18,0xD7,0x93, // ..@.....B....... END
+	0x71,0xE1,0x80,0xD8,0x80,0x00,0x00,0x92,0xDD,0x01,0x73,0xFB,0x75,0xD0,0x20,0xD5, // q.........s.u... END
+	0xE1,0xFB,0x75,0xD8,0x80,0x01,0xD5,0xBA,0xFB,0x75,0xD0,0x20,0xD5,0xE1,0xFB,0x75, // ..u......u.....u END
+	0xD8,0x80,0x41,0x00,0x92,0xDD,0x01,0x73,0xFB,0x75,0xD0,0x20,0xD5,0xE1,0xFB,0x75, // ..A....s.u.....u END
+	0xE3,0x80,0x06,0x92,0xDD,0x01,0x73,0xFB,0x75,0xD0,0x20,0xD5,0xE1,0xFB,0x75,0xD8, // ......s.u.....u. END
+	0x80,0x42,0xD5,0xBA,0xFB,0x75,0x8A,0xD5,0xE1,0xFB,0x75,0xD8,0x80,0x41,0x08,0xE0, // .B...u....u..A.. END
+	0x40,0x41,0xA9,0xF2,0x8A,0xF8,0xA0,0xD7,0xA3,0xD7,0x29,0xD8,0x80,0x00,0x08,0xE0, // @A........)..... END
+	0x40,0x41,0xD2,0x10,0xF2,0x8A,0xF8,0xA0,0xD7,0xB4,0xD7,0x15,0x80,0xDD,0x01,0xC9, // @A.............. END
+	0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB, // .u.@.....@..p... END
+	0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0xCD,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA, // .........u...... END
+	0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ..........@..... END
+	0x40,0x82,0xD7,0xF0,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE, // @.........r..... END
+	0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE, // @............... END
+	0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A, // @............... END
+	0xF9,0x38,0xDF,0x01,0x6A,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3, // .8..j.d...8..... END
+	0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10, // ..8.......8...'. END
+	0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA, // .....L..C....... END
+	0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6, // ...L..C...d..... END
+	0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43, // L..C........L..C END
+	0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82, // ...oA...B.....@. END
+	0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72, // ...@........p..r END
+	0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x01,0x0F,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E, // ..........u..... END
+	0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xD5,0xC4,0xFB, // ....I.H......... END
+	0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFD, // u........A.I.X.. END
+	0xFB,0x83,0xD0,0x2D,0xD5,0xE1,0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x01, // ...-...u.4...... END
+	0x7A,0xEE,0x40,0x80,0xC1,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03, // z.@.....@....... END
+	0xFB,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x01,0xE8,0x04,0x68,0x77,0x69,0x6E,0x66,0x6F,0x00,0x2F,0x2F,0xDE,0x80,0x00,0xD8, // ...hwinfo.//.... END
+	0x04,0x00,0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x90,0x71,0xE1,0x80,0xEE,0x09, // ...........q.... END
+	0xDD,0x01,0x4D,0xFB,0x75,0xD0,0x20,0xD5,0xB4,0xFB,0x75,0xE3,0x80,0x0E,0x71,0xE1, // ..M.u.....u...q. END
+	0x80,0xD8,0x07,0x02,0xC1,0x90,0xF2,0x41,0xF8,0x50,0xD7,0x50,0x91,0xF2,0x41,0xF8, // .......A.P.P..A. END
+	0x50,0xD7,0x59,0x92,0xF2,0x41,0xF8,0x50,0xD7,0x62,0x93,0xF2,0x41,0xF8,0x50,0xD7, // P.Y..A.P.b..A.P. END
+	0x6B,0xD8,0x01,0xD6,0xD5,0x8D,0xFB,0x75,0xD7,0x73,0xD8,0x01,0xAC,0xD5,0x8D,0xFB, // k......u.s...... END
+	0x75,0xD7,0x73,0xD8,0x01,0xB3,0xD5,0x8D,0xFB,0x75,0xD7,0x73,0xD8,0x01,0xBA,0xD5, // u.s......u.s.... END
+	0x8D,0xFB,0x75,0xD7,0x73,0xD8,0x01,0xC9,0xD5,0x8D,0xFB,0x75,0xC0,0x8A,0xD5,0xB4, // ..u.s......u.... END
+	0xFB,0x75,0xE3,0x80,0x0E,0xE0,0x40,0xD4,0x04,0xF3,0x0C,0xF9,0x20,0xD7,0x87,0xD7, // .u....@......... END
+	0x11,0x80,0xDD,0x01,0x9B,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82, // ......u.@.....@. END
+	0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0x9F,0xFB,0x75,0xEF, // .p............u. END
+	0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40, // ...............@ END
+	0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72, // .....@.........r END
+	0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4, // .....@.......... END
+	0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8,0x88, // .....@.......... END
+	0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x01,0x3D,0xD3,0x64,0xF3,0x0B,0xF9,0x38, // ......8..=.d...8 END
+	0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38, // .......8.......8 END
+	0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00, // ...'......L..C.. END
+	0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64, // ........L..C...d END
+	0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A, // .....L..C....... END
+	0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4, // .L..C...oA...B.. END
+	0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1, // ...@....@....... END
+	0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xD5,0xE2,0xFB,0x75,0xFA, // .p..r.........u. END
+	0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80, // ........I.H..... END
+	0x06,0xD5,0x97,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49, // ....u........A.I END
+	0xF8,0x58,0xE3,0xFC,0xFB,0x83,0xD0,0x2D,0xD5,0xB4,0xFB,0x75,0xFA,0x34,0xFA,0x00, // .X.....-...u.4.. END
+	0xE0,0x00,0xDF,0x01,0x4D,0xEE,0x40,0x80,0xC1,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01, // ....M.@.....@... END
+	0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x6E,0x75,0x73,0x65,0x64,0x00,0x6B,0x65,0x79, // ......unused.key END
+	0x70,0x61,0x64,0x00,0x53,0x44,0x20,0x63,0x61,0x72,0x64,0x20,0x72,0x65,0x61,0x64, // pad.SD.card.read END
+	0x65,0x72,0x00,0x44,0x48,0x54,0x32,0x32,0x20,0x53,0x65,0x6E,0x73,0x6F,0x72,0x00, // er.DHT22.Sensor. END
+	0x75,0x6E,0x6B,0x6E,0x6F,0x77,0x6E,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // unknown......... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x01,0xBC,0x04,0x6D,0x61,0x6E,0x00,0x2F,0x2F,0xDE,0x80,0xC0,0xD8,0x04,0x00,0x93, // ...man.//....... END
+	0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x89, // ...........@.X.. END
+	0xFB,0x83,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x89,0xFB,0x83,0xD8,0x80,0x40, // ......@.X......@ END
+	0xD9,0x01,0xA6,0xDD,0x01,0x27,0xFB,0x75,0xD8,0x80,0x40,0xFA,0x74,0xDD,0x01,0x03, // .....'.u..@.t... END
+	0xFB,0x75,0xD8,0x80,0x40,0xD9,0x01,0xAE,0xDD,0x01,0x03,0xFB,0x75,0xD8,0x80,0x40, // .u..@.......u..@ END
+	0xFA,0x74,0xDD,0x01,0x03,0xFB,0x75,0xD8,0x01,0x0A,0xD9,0x80,0x40,0xC1,0xF2,0x00, // .t....u.....@... END
+	0xF8,0x18,0xD7,0x95,0xD8,0x80,0x80,0xD9,0x01,0xB0,0xDD,0x01,0x27,0xFB,0x75,0xD8, // ............'.u. END
+	0x80,0x80,0xE0,0x03,0xD9,0x80,0x40,0xDD,0x01,0x27,0xFB,0x75,0x82,0xD9,0x80,0x80, // ......@..'.u.... END
+	0xD5,0xFA,0xFB,0x75,0xD8,0x01,0x85,0xD5,0xA1,0xFB,0x75,0x81,0xD5,0xF6,0xFB,0x75, // ...u......u....u END
+	0xD8,0x01,0x4E,0xD5,0xA1,0xFB,0x75,0x81,0xD5,0xF6,0xFB,0x75,0xD8,0x01,0x67,0xD5, // ..N...u....u..g. END
+	0xA1,0xFB,0x75,0x81,0xD5,0xF6,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40, // ..u....u.@.....@ END
+	0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0x41,0xFB,0x75, // ..p..........A.u END
+	0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE, // ................ END
+	0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xD7,0xEE,0x89,0x90,0xC0,0xEE,0xF6, // @.....@......... END
+	0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB, // r.....@......... END
+	0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80, // ......@.......@. END
+	0xC1,0xB1,0xEE,0x89,0xEE,0x40,0x85,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x01, // .....@.......... END
+	0x41,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x01,0x27,0xFB,0x75, // A.u...t.4....'.u END
+	0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83, // .......@........ END
+	0xFB,0x8B,0xEE,0x09,0xDD,0x01,0x41,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA, // ......A.u.....t. END
+	0x34,0xDD,0x01,0x1B,0xFB,0x75,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0, // 4....u.....@.... END
+	0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x6D,0x61,0x6E,0x20, // .....usage:.man. END
+	0x73,0x65,0x63,0x74,0x69,0x6F,0x6E,0x20,0x70,0x61,0x67,0x65,0x0A,0x00,0x65,0x72, // section.page..er END
+	0x72,0x6F,0x72,0x3A,0x20,0x6E,0x6F,0x74,0x20,0x73,0x75,0x63,0x68,0x20,0x6D,0x61, // ror:.not.such.ma END
+	0x6E,0x75,0x61,0x6C,0x20,0x65,0x6E,0x74,0x72,0x79,0x0A,0x00,0x65,0x72,0x72,0x6F, // nual.entry..erro END
+	0x72,0x3A,0x20,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x64,0x69,0x73, // r:.could.not.dis END
+	0x70,0x6C,0x61,0x79,0x20,0x6D,0x61,0x6E,0x75,0x61,0x6C,0x0A,0x00,0x2F,0x75,0x73, // play.manual../us END
+	0x72,0x2F,0x6D,0x61,0x6E,0x2F,0x00,0x63,0x61,0x74,0x00,0x00,0xFF,0xFF,0xFF,0xFF, // r/man/.cat...... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x06,0xA8,0x0E,0x70,0x73,0x74,0x61,0x74,0x00,0x2F,0x2F,0xDE,0x80,0xDC,0xD8,0x04, // ...pstat.//..... END
+	0x00,0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0xD8,0x05,0x50,0x91,0xDD,0x02,0x61, // ...........P...a END
+	0xFB,0x75,0xD9,0x80,0x00,0x48,0xF2,0x40,0xF8,0x48,0xD7,0x31,0xD8,0x05,0x5F,0xDD, // .u...H.@.H.1.._. END
+	0x02,0x6B,0xFB,0x75,0x81,0xDD,0x03,0x98,0xFB,0x75,0x83,0x91,0xD3,0x40,0xC1,0xF2, // .k.u.....u...@.. END
+	0x40,0xF8,0x58,0xD7,0x47,0xDD,0x03,0xA9,0xFB,0x75,0xD5,0x64,0xFB,0x75,0xD7,0x5E, // @.X.G....u.d.u.^ END
+	0x80,0xD1,0x10,0xF2,0x41,0xF8,0x60,0xD7,0x5E,0x70,0xE1,0x80,0xD5,0x64,0xFB,0x75, // ....A.`.^p...d.u END
+	0xE3,0x80,0x06,0xE0,0x00,0xD7,0x48,0x80,0xDD,0x03,0x98,0xFB,0x75,0xD9,0x80,0x01, // ......H.....u... END
+	0x48,0x87,0xD9,0x80,0x01,0x09,0xDA,0x80,0x02,0xC1,0xF2,0x00,0xF8,0x18,0xFB,0xF4, // H............... END
+	0xD8,0x80,0x00,0x00,0xD9,0x80,0x01,0x09,0xD2,0x90,0xE8,0x4A,0xDA,0x80,0x42,0xD3, // ...........J..B. END
+	0x90,0xDD,0x03,0x7C,0xFB,0x75,0xD1,0x90,0xF2,0x41,0xF8,0x40,0xFB,0xF4,0xD8,0x80, // ...|.u...A.@.... END
+	0x01,0x00,0x92,0xDD,0x03,0x24,0xFB,0x75,0xD0,0x20,0xDD,0x02,0x92,0xFB,0x75,0xD8, // .....$.u......u. END
+	0x80,0x02,0xDD,0x02,0x6B,0xFB,0x75,0x8A,0xDD,0x02,0x92,0xFB,0x75,0xD8,0x05,0x7E, // ....k.u.....u..~ END
+	0xDD,0x02,0x6B,0xFB,0x75,0xD8,0x80,0x42,0x94,0xE4,0x01,0xDD,0x02,0x02,0xFB,0x75, // ..k.u..B.......u END
+	0xD8,0x05,0x95,0xDD,0x02,0x6B,0xFB,0x75,0xD8,0x80,0x42,0x98,0xE4,0x01,0xDD,0x02, // .....k.u..B..... END
+	0x02,0xFB,0x75,0xD8,0x05,0x9D,0xDD,0x02,0x6B,0xFB,0x75,0xD8,0x80,0x42,0xD1,0x78, // ..u.....k.u..B.x END
+	0xE4,0x01,0xDD,0x02,0x02,0xFB,0x75,0x8A,0xDD,0x02,0x92,0xFB,0x75,0xD8,0x05,0xAA, // ......u.....u... END
+	0xD9,0x05,0xB5,0xAC,0xB9,0xDD,0x01,0x8D,0xFB,0x75,0xD8,0x05,0xDF,0xD9,0x05,0xE8, // .........u...... END
+	0xD2,0x7C,0xB5,0xDD,0x01,0x8D,0xFB,0x75,0x81,0x99,0xF2,0x41,0xF8,0x60,0xFB,0xF4, // .|.....u...A.`.. END
+	0x70,0xE1,0x80,0xDD,0x01,0x26,0xFB,0x75,0xE3,0x80,0x06,0xE0,0x00,0xE3,0xD5,0xD9, // p....&.u........ END
+	0x80,0xD2,0x48,0x8D,0xD9,0x80,0x01,0x09,0xDA,0x80,0xD2,0x12,0xC1,0xF2,0x00,0xF8, // ..H............. END
+	0x18,0xFB,0xF4,0xD8,0x06,0x07,0xDD,0x02,0x6B,0xFB,0x75,0xD8,0x80,0xD2,0x00,0xDD, // ........k.u..... END
+	0x03,0x2B,0xFB,0x75,0xD8,0x06,0x0D,0xDD,0x02,0x6B,0xFB,0x75,0xD8,0x80,0xD2,0x00, // .+.u.....k.u.... END
+	0x94,0xE8,0x01,0xD9,0x80,0x42,0xE4,0x01,0xD1,0x30,0xE4,0x01,0xDD,0x02,0x02,0xFB, // .....B...0...... END
+	0x75,0xD8,0x06,0x14,0xDD,0x02,0x6B,0xFB,0x75,0xD8,0x80,0xD2,0x00,0x94,0xE8,0x01, // u.....k.u....... END
+	0xD9,0x80,0x42,0xE4,0x01,0xD1,0x54,0xE4,0x01,0xDD,0x02,0x02,0xFB,0x75,0x8A,0xDD, // ..B...T......u.. END
+	0x02,0x92,0xFB,0x75,0xFB,0xF4,0xDC,0x80,0xD3,0xFB,0x09,0xDC,0x80,0xD5,0xFB,0x11, // ...u............ END
+	0xDC,0x80,0xD7,0x63,0xDD,0x02,0x6B,0xFB,0x75,0xD8,0x80,0xD7,0x00,0xF2,0x00,0xF8, // ...c..k.u....... END
+	0x18,0xDF,0x01,0xFA,0xD0,0x20,0xDD,0x02,0x92,0xFB,0x75,0xD8,0x80,0xD3,0xFA,0x02, // ..........u..... END
+	0xDD,0x02,0x6B,0xFB,0x75,0xD0,0x20,0xDD,0x02,0x92,0xFB,0x75,0xD8,0x80,0xD5,0xFA, // ..k.u......u.... END
+	0x02,0xD9,0x80,0x42,0xE4,0x01,0xDD,0x02,0x02,0xFB,0x75,0xD8,0x80,0xD3,0xFA,0x02, // ...B......u..... END
+	0xDD,0x03,0x9C,0xFB,0x75,0xE0,0x00,0xD9,0x80,0xD3,0xFA,0x8A,0xE4,0x90,0xFA,0x51, // ....u..........Q END
+	0xD8,0x80,0xD5,0xFA,0x42,0xE0,0x43,0xFA,0x09,0xD8,0x80,0xD7,0x08,0xE2,0x40,0x41, // ....B.C.......@A END
+	0xDF,0x01,0xA0,0x8A,0xDD,0x02,0x92,0xFB,0x75,0xFB,0xF4,0x92,0xC0,0xA0,0xC0,0xEE, // ........u....... END
+	0xF6,0xD4,0x0C,0xE5,0xB4,0x71,0xE1,0x80,0xFB,0x93,0xFB,0x9B,0xEE,0x40,0xEE,0x1B, // .....q.......@.. END
+	0xDD,0x03,0xD2,0xFB,0x75,0xFA,0xB4,0xFA,0x74,0xE3,0x80,0x06,0xDD,0x02,0x75,0xFB, // ....u...t.....u. END
+	0x75,0xD4,0x0C,0xE7,0xB4,0xFB,0xF4,0xFB,0x83,0xD0,0x7B,0xDD,0x02,0x92,0xFB,0x75, // u.........{....u END
+	0xFA,0x34,0xFB,0x83,0xDD,0x03,0xC8,0xFB,0x75,0xDD,0x03,0x2B,0xFB,0x75,0xD0,0x2C, // .4......u..+.u., END
+	0xDD,0x02,0x92,0xFB,0x75,0xFA,0x34,0xDD,0x03,0xCC,0xFB,0x75,0xDD,0x03,0x2B,0xFB, // ....u.4....u..+. END
+	0x75,0xD0,0x7D,0xDD,0x02,0x92,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x01, // u.}....u.....@.. END
+	0x02,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1, // .....@.....@..p. END
+	0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x03,0x9C,0xFB,0x75,0xEF,0x00,0xD8,0x01, // ...........u.... END
+	0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE, // ............@... END
+	0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE, // ..@.........r... END
+	0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE, // ..@............. END
+	0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA, // ..@............. END
+	0xF3,0x0A,0xF9,0x38,0xDF,0x03,0x1B,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8, // ...8....d...8... END
+	0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA, // ....8.......8... END
+	0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8, // '......L..C..... END
+	0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9, // .....L..C...d... END
+	0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0, // ..L..C........L. END
+	0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE, // .C...oA...B..... END
+	0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1, // @....@........p. END
+	0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x02,0xC0,0xFB,0x75,0xFA,0xB4,0xE3, // .r..........u... END
+	0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xDD, // ......I.H....... END
+	0x02,0x75,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8, // .u.u........A.I. END
+	0x58,0xE3,0xFE,0xFB,0x83,0xD0,0x2D,0xDD,0x02,0x92,0xFB,0x75,0xFA,0x34,0xFA,0x00, // X.....-....u.4.. END
+	0xE0,0x00,0xDF,0x03,0x2B,0xEF,0x1B,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00, // ....+.......@... END
+	0xC1,0xFB,0xF4,0xEF,0x1B,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x0C,0xC1,0xFB, // ..........@..... END
+	0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03, // ..@.....@....... END
+	0xFB,0xF4,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3, // ................ END
+	0xF8,0xE8,0xE1,0xC8,0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB, // ......K.J....... END
+	0xF4,0xFA,0x02,0xFB,0xF4,0xE0,0x01,0xFA,0x02,0xFB,0xF4,0xFB,0x83,0xD8,0x80,0xD8, // ................ END
+	0xDD,0x05,0x22,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xD8,0x80,0xD8,0xDD,0x04,0xBB,0xFB, // ..".u.4......... END
+	0x75,0xE0,0x00,0xEE,0x40,0xFA,0x34,0xE4,0x01,0x90,0x41,0xE2,0x00,0xFB,0x83,0xD8, // u...@.4...A..... END
+	0x80,0xD8,0x9A,0xDD,0x04,0x70,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xE0,0x6F,0x41,0xE2, // .....p.u.@.4.oA. END
+	0x00,0xFB,0x83,0xD8,0x80,0xD8,0xD9,0x06,0x72,0xDD,0x05,0x28,0xFB,0x75,0xF2,0x40, // ........r..(.u.@ END
+	0xFA,0x34,0xF8,0x58,0xE3,0xE8,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0x90,0xDD,0x04,0xFC, // .4.X............ END
+	0xFB,0x75,0xFA,0x74,0xFA,0x34,0x11,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xE9, // .u.t.4.......... END
+	0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xE2,0xFB,0x8B,0xFB,0x83,0x72,0xE1,0x80,0xD9,0x06, // ...........r.... END
+	0x22,0xDD,0x04,0xF8,0xFB,0x75,0xE3,0x80,0x0E,0xFA,0x34,0xFB,0x83,0xDD,0x04,0x68, // "....u....4....h END
+	0xFB,0x75,0xFA,0x34,0xFA,0x74,0xE0,0x40,0xE3,0xF3,0xFB,0xF4,0x91,0xFC,0x08,0xFB, // .u.4.t.@........ END
+	0xF4,0xFC,0x08,0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x06, // ............@... END
+	0xC1,0xFB,0xF4,0xEE,0xB6,0xE1,0x83,0xDD,0x04,0x87,0xFB,0x75,0xE3,0x83,0xFB,0xF4, // ...........u.... END
+	0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4,0xEE,0x40,0xFA,0x0A, // .....@.......@.. END
+	0xFA,0x07,0xD2,0x10,0xF2,0x82,0xF8,0x80,0xFB,0xF4,0xFE,0x0A,0x02,0xFA,0x07,0xE0, // ................ END
+	0x0F,0xFB,0xF4,0xDD,0x04,0x93,0xFB,0x75,0xD1,0x1F,0xF2,0x81,0xF8,0xA8,0xE2,0x00, // .......u........ END
+	0xE6,0x08,0xFB,0xF4,0xFB,0x83,0xDD,0x04,0x93,0xFB,0x75,0xD9,0x06,0x56,0xE4,0x01, // ..........u..V.. END
+	0x10,0xFA,0x34,0x72,0xE1,0x80,0xFB,0x83,0xEE,0x12,0xE0,0x00,0xDD,0x05,0x46,0xFB, // ..4r..........F. END
+	0x75,0xFA,0x74,0xDD,0x05,0x3C,0xFB,0x75,0xE3,0x80,0x0E,0xE4,0x01,0xFB,0xF4,0xFB, // u.t..<.u........ END
+	0x83,0xFB,0x93,0xDD,0x04,0xFC,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xC0,0xFC,0x0C,0xFB, // .......u.t.4.... END
+	0xF4,0xFC,0x0D,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0, // ................ END
+	0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE, // ................ END
+	0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB, // ................ END
+	0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x40,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81, // ....@..@......@. END
+	0xF8,0x60,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x68,0x80,0xFB,0xF4,0x94, // .`......@..h.... END
+	0xE8,0x01,0xD9,0x06,0x77,0xE4,0x01,0xFB,0xF4,0x2F,0x64,0x65,0x76,0x2F,0x70,0x72, // ....w..../dev/pr END
+	0x6F,0x63,0x73,0x74,0x61,0x74,0x73,0x00,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F, // ocstats.could.no END
+	0x74,0x20,0x6F,0x70,0x65,0x6E,0x20,0x2F,0x64,0x65,0x76,0x2F,0x70,0x72,0x6F,0x63, // t.open./dev/proc END
+	0x73,0x74,0x61,0x74,0x73,0x0A,0x00,0x20,0x20,0x69,0x6E,0x73,0x74,0x72,0x75,0x63, // stats....instruc END
+	0x74,0x69,0x6F,0x6E,0x73,0x28,0x6C,0x6F,0x77,0x33,0x32,0x29,0x20,0x00,0x20,0x74, // tions(low32)...t END
+	0x69,0x63,0x6B,0x73,0x20,0x00,0x20,0x72,0x61,0x6D,0x67,0x72,0x6F,0x77,0x74,0x68, // icks...ramgrowth END
+	0x73,0x20,0x00,0x20,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x73,0x00,0x70,0x72, // s....syscalls.pr END
+	0x6F,0x63,0x00,0x69,0x6F,0x00,0x65,0x6E,0x76,0x00,0x74,0x69,0x6D,0x65,0x00,0x73, // oc.io.env.time.s END
+	0x69,0x67,0x6E,0x61,0x6C,0x00,0x6D,0x69,0x73,0x63,0x00,0x73,0x74,0x72,0x00,0x68, // ignal.misc.str.h END
+	0x77,0x00,0x69,0x6E,0x74,0x33,0x32,0x00,0x20,0x20,0x77,0x61,0x69,0x74,0x6D,0x73, // w.int32...waitms END
+	0x00,0x77,0x61,0x69,0x74,0x70,0x69,0x64,0x00,0x72,0x65,0x61,0x64,0x00,0x77,0x72, // .waitpid.read.wr END
+	0x69,0x74,0x65,0x00,0x73,0x6C,0x65,0x65,0x70,0x00,0x66,0x75,0x74,0x65,0x78,0x00, // ite.sleep.futex. END
+	0x20,0x20,0x66,0x64,0x20,0x00,0x20,0x72,0x65,0x61,0x64,0x20,0x00,0x20,0x77,0x72, // ..fd...read...wr END
+	0x69,0x74,0x74,0x65,0x6E,0x20,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00, // itten........... END
+	0x00,0x00,0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00, // ..d......'...... END
+	0x0F,0x42,0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0x00, // .B@........;.... END
+	0x00,0x00,0x3C,0x00,0x00,0x0E,0x10,0x00,0x01,0x51,0x80,0x77,0x35,0x94,0x00,0x08, // ..<......Q.w5... END
+	0x08,0x08,0x08,0x08,0x07,0x07,0x07,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x04,0x04, // ................ END
+	0x04,0x03,0x03,0x03,0x03,0x02,0x02,0x02,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00,0x03,0xE8, // ...........d.... END
+	0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98,0x96,0x80, // ..'.......B@.... END
+	0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ....;........... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x01,0x75,0x03,0x6B,0x6C,0x6F,0x67,0x6C,0x65,0x76,0x65,0x6C,0x00,0x2F,0x2F,0xDE, // .u.kloglevel.//. END
+	0x80,0x00,0xD8,0x05,0x04,0xC1,0xD5,0xEB,0xFB,0x75,0x8A,0xD5,0x53,0xFB,0x75,0x83, // .........u..S.u. END
+	0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x26,0xDD,0x01,0x3C,0xFB,0x75,0xEE,0x40,0xD8, // ...@.X.&..<.u.@. END
+	0x05,0x05,0xC1,0x80,0xDD,0x01,0x38,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ......8.u.@..... END
+	0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0x5B,0xFB, // @..p..........[. END
+	0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4, // u............... END
+	0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0x62,0xEE,0x89,0x90,0xC0,0xEE, // .@.....@..b..... END
+	0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80, // .r.....@........ END
+	0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92, // .......@........ END
+	0xF8,0x88,0xD7,0xA6,0xAA,0xF3,0x0A,0xF9,0x38,0xD7,0xDB,0xD3,0x64,0xF3,0x0B,0xF9, // ........8...d... END
+	0x38,0xD7,0xCF,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xD7,0xC2,0xE8,0x93,0xF3,0x0A,0xF9, // 8.......8....... END
+	0x38,0xD7,0xB4,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0, // 8...'......L..C. END
+	0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2, // .........L..C... END
+	0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9, // d.....L..C...... END
+	0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB, // ..L..C...oA...B. END
+	0xF4,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xF1,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6, // ....@....@...... END
+	0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xD5,0x81,0xFB,0x75, // ..p..r.........u END
+	0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3, // .........I.H.... END
+	0x80,0x06,0xD5,0x36,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2, // ...6.u........A. END
+	0x49,0xF8,0x58,0xD7,0xEB,0xFB,0x83,0xD0,0x2D,0xD5,0x53,0xFB,0x75,0xFA,0x34,0xFA, // I.X.....-.S.u.4. END
+	0x00,0xE0,0x00,0xD7,0xEB,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3, // ......@......... END
+	0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA,0xE8,0x4B,0xE4,0x4A, // .............K.J END
+	0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0, // ...........@.... END
+	0xC1,0xE6,0x03,0xFB,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0xE0,0x02,0x68,0x77,0x6B,0x65,0x79,0x70,0x61,0x64,0x6D,0x6E,0x74,0x00,0x2F, // ...hwkeypadmnt./ END
+	0x2F,0xDE,0x80,0x00,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x2C,0xD5,0x8F,0xFB, // /.......@.X.,... END
+	0x75,0x70,0xE1,0x80,0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x2C,0xEE,0x80,0xD8, // up......@.X.,... END
+	0x07,0x07,0xE3,0x80,0x0E,0xC1,0x80,0xD5,0x8B,0xFB,0x75,0xD0,0xBB,0xD5,0x37,0xFB, // ..........u...7. END
+	0x75,0x81,0xD5,0x8B,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0, // u....u.@.....@.. END
+	0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xD5,0xAE,0xFB,0x75,0xEF,0x00,0xD8, // p...........u... END
+	0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0, // .............@.. END
+	0xEE,0x89,0xEE,0x40,0x82,0xD7,0x6C,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80, // ...@..l......r.. END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2, // ...@............ END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0x90,0x10, // ...@.......@.... END
+	0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xD7,0xAA,0xB9,0xF2,0xD3,0xF8,0xE8,0xD7,0xAA, // ................ END
+	0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xD7,0x90,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE, // ..K.J........... END
+	0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A, // @.........usage: END
+	0x20,0x69,0x64,0x20,0x6D,0x6F,0x75,0x6E,0x74,0x50,0x6F,0x69,0x6E,0x74,0x0A,0x00, // .id.mountPoint.. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x02,0xDC,0x06,0x67,0x65,0x74,0x70,0x69,0x6E,0x00,0x2F,0x2F,0xDE,0x80,0x00,0x83, // ...getpin.//.... END
+	0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x3B,0xD5,0xAE,0xFB,0x75,0x70,0xE1,0x80,0xD5, // ...@.X.;...up... END
+	0x89,0xFB,0x75,0xF2,0x00,0xF8,0x18,0xD7,0x49,0xE3,0x80,0x06,0xD5,0x57,0xFB,0x75, // ..u.....I....W.u END
+	0xF2,0x40,0xD8,0x02,0x6E,0xF8,0x58,0xD8,0x02,0x72,0xDD,0x01,0x08,0xFB,0x75,0x80, // .@..n.X..r....u. END
+	0xDD,0x01,0x5D,0xFB,0x75,0xD8,0x02,0x52,0xDD,0x01,0x08,0xFB,0x75,0x81,0xDD,0x01, // ..].u..R....u... END
+	0x5D,0xFB,0x75,0xD8,0x02,0x65,0xDD,0x01,0x08,0xFB,0x75,0x81,0xDD,0x01,0x5D,0xFB, // ].u..e....u...]. END
+	0x75,0xDD,0x01,0x61,0xFB,0x75,0xF2,0x40,0xF8,0x58,0xD7,0x86,0x70,0xE1,0x80,0x90, // u..a.u.@.X..p... END
+	0xDD,0x01,0x91,0xFB,0x75,0xD8,0x01,0x00,0xE3,0x80,0x0E,0xA0,0xEE,0xF6,0xD4,0x01, // ....u........... END
+	0xC1,0xEE,0x80,0xD8,0x01,0x03,0xC1,0xF2,0x92,0xF8,0x98,0xD7,0x86,0x06,0xFB,0xF4, // ................ END
+	0x80,0xFB,0xF4,0x90,0xF2,0x41,0xF8,0x78,0xD7,0xAB,0xD1,0x5F,0xF2,0x41,0xF8,0x68, // .....A.x..._.A.h END
+	0xD7,0xAB,0x93,0xF6,0x41,0xDA,0x02,0x77,0xE4,0x4A,0x09,0xA7,0xF0,0x82,0xF6,0x4A, // ....A..w.J.....J END
+	0xA1,0xF0,0x0A,0xFB,0xF4,0x80,0xFB,0xF4,0x08,0xD2,0x41,0xF2,0x8A,0xF8,0x90,0xD7, // ..........A..... END
+	0xD6,0xD2,0x61,0xF2,0x8A,0xF8,0x90,0xD7,0xD6,0xD2,0x44,0xF2,0x8A,0xF8,0x90,0xD7, // ..a.......D..... END
+	0xED,0xD2,0x64,0xF2,0x8A,0xF8,0x90,0xD7,0xED,0xDD,0x01,0x9C,0xFB,0x75,0xFB,0xF4, // ..d..........u.. END
+	0xE0,0x00,0xDD,0x01,0x9C,0xFB,0x75,0xD1,0x10,0xF2,0x41,0xF8,0x60,0xE1,0xDE,0xD9, // ......u...A.`... END
+	0x02,0x83,0xE4,0x01,0x00,0xFB,0xF4,0xE0,0x00,0xDD,0x01,0x9C,0xFB,0x75,0xD1,0x36, // .............u.6 END
+	0xF2,0x41,0xF8,0x60,0xE1,0xC7,0xD9,0x02,0x93,0xE4,0x01,0x00,0xFB,0xF4,0xD0,0x7F, // .A.`............ END
+	0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB, // ...@.....@..p... END
+	0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0xBB,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA, // .........u...... END
+	0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ..........@..... END
+	0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE, // @.........r..... END
+	0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE, // @............... END
+	0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0x76,0xD6,0x40,0xE5, // @.......@...v.@. END
+	0x8E,0x70,0xE1,0x80,0xEE,0x09,0xD9,0x02,0xC9,0xDD,0x02,0x38,0xFB,0x75,0xE3,0x80, // .p.........8.u.. END
+	0x0E,0xD0,0x40,0xE6,0x30,0xA8,0xE4,0x02,0xA0,0xDD,0x01,0xC8,0xFB,0x75,0xD8,0x01, // ..@.0........u.. END
+	0x02,0xD1,0x40,0xE7,0xB1,0xEE,0x76,0xA3,0xC1,0xFB,0xF4,0xEE,0xC9,0xEE,0x40,0xD8, // ..@...v.......@. END
+	0x05,0x03,0xA1,0xC1,0xFB,0xF4,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1, // ................ END
+	0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xE3, // ..........K.J... END
+	0xD9,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03, // ........@....... END
+	0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x02,0x23, // ............8..# END
+	0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3, // .d...8.......8.. END
+	0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6, // .....8...'...... END
+	0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0, // L..C..........L. END
+	0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0, // .C...d.....L..C. END
+	0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41, // .......L..C...oA END
+	0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1, // ...B.......@.... END
+	0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x01,0xBB,0xFB,0x75,0xEE,0x80,0xE0, // ............u... END
+	0x80,0xFA,0x74,0xFA,0x34,0xDD,0x02,0x2C,0xFB,0x75,0xFB,0xF4,0x75,0x73,0x61,0x67, // ..t.4..,.u..usag END
+	0x65,0x3A,0x20,0x67,0x65,0x74,0x70,0x69,0x6E,0x20,0x70,0x69,0x6E,0x0A,0x00,0x42, // e:.getpin.pin..B END
+	0x61,0x64,0x20,0x70,0x69,0x6E,0x0A,0x00,0x6F,0x6E,0x0A,0x00,0x6F,0x66,0x66,0x0A, // ad.pin..on..off. END
+	0x00,0xFF,0xFF,0xFF,0x8F,0x3B,0xFF,0x27,0x7B,0x00,0x03,0xFF,0xFF,0x28,0x29,0x2A, // .....;.'{....()* END
+	0x2B,0x2C,0x2D,0x2E,0x2F,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x20,0x21,0x24, // +,-./PQRSTUVW.!$ END
+	0x25,0x35,0x23,0x3B,0x3C,0x3D,0x3E,0x0C,0x0D,0x0E,0x0F,0x49,0x48,0x39,0x38,0x1B, // %5#;<=>....IH98. END
+	0x1A,0x19,0x18,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x17,0x16,0x15,0x14,0x13, // ................ END
+	0x12,0x11,0x10,0x1F,0x32,0x31,0x30,0x5F,0x5E,0x5D,0x5C,0x5B,0x5A,0x59,0x58,0x0B, // ....210_^]\[ZYX. END
+	0x0A,0x09,0x08,0x2F,0x64,0x65,0x76,0x2F,0x70,0x69,0x6E,0x00,0xFF,0xFF,0xFF,0xFF, // .../dev/pin..... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x03,0x7D,0x07,0x75,0x70,0x74,0x69,0x6D,0x65,0x00,0x2F,0x2F,0xDE,0x80,0x0C,0xD8, // .}.uptime.//.... END
+	0x80,0x00,0xD5,0x76,0xFB,0x75,0xD8,0x80,0x00,0xD5,0x86,0xFB,0x75,0x8A,0xD5,0x44, // ...v.u......u..D END
+	0xFB,0x75,0x80,0xD5,0x72,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82, // .u..r.u.@.....@. END
+	0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0xF9,0xFB,0x75,0xEF, // .p............u. END
+	0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40, // ...............@ END
+	0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0x53,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72, // .....@..S......r END
+	0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4, // .....@.......... END
+	0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1, // .....@.......@.. END
+	0xEE,0x40,0xD8,0x03,0x02,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x03,0x04,0xC1,0xFB,0xF4, // .@.......@...... END
+	0xEE,0x40,0xD8,0x80,0x04,0xDD,0x03,0x31,0xFB,0x75,0xD8,0x80,0x04,0xD9,0x03,0x6B, // .@.....1.u.....k END
+	0xDD,0x02,0xCA,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xD7,0xCD,0xD8,0x80,0x08,0xD9,0x80, // ....u........... END
+	0x04,0xDD,0x03,0x31,0xFB,0x75,0xD8,0x80,0x08,0xD9,0x03,0x6B,0xDA,0x80,0x04,0xDD, // ...1.u.....k.... END
+	0x02,0xF5,0xFB,0x75,0xD8,0x80,0x08,0xDD,0x03,0x05,0xFB,0x75,0xDD,0x02,0x71,0xFB, // ...u.......u..q. END
+	0x75,0xD0,0x64,0xD5,0x44,0xFB,0x75,0xD8,0x80,0x04,0xD9,0x03,0x67,0xDD,0x02,0xCA, // u.d.D.u.....g... END
+	0xFB,0x75,0xF2,0x00,0xF8,0x08,0xE1,0xEB,0xD8,0x80,0x08,0xD9,0x80,0x04,0xDD,0x03, // .u.............. END
+	0x31,0xFB,0x75,0xD8,0x80,0x08,0xD9,0x03,0x67,0xDA,0x80,0x04,0xDD,0x02,0xF5,0xFB, // 1.u.....g....... END
+	0x75,0xD8,0x80,0x08,0xDD,0x03,0x05,0xFB,0x75,0xDD,0x02,0x71,0xFB,0x75,0xD0,0x68, // u.......u..q.u.h END
+	0xD5,0x44,0xFB,0x75,0xD8,0x80,0x04,0xD9,0x03,0x63,0xDD,0x02,0xCA,0xFB,0x75,0xF2, // .D.u.....c....u. END
+	0x00,0xF8,0x08,0xE1,0xEB,0xD8,0x80,0x08,0xD9,0x80,0x04,0xDD,0x03,0x31,0xFB,0x75, // .............1.u END
+	0xD8,0x80,0x08,0xD9,0x03,0x63,0xDA,0x80,0x04,0xDD,0x02,0xF5,0xFB,0x75,0xD8,0x80, // .....c.......u.. END
+	0x08,0xDD,0x03,0x05,0xFB,0x75,0xDD,0x02,0x71,0xFB,0x75,0xD0,0x6D,0xD5,0x44,0xFB, // .....u..q.u.m.D. END
+	0x75,0xD8,0x80,0x04,0xDD,0x03,0x05,0xFB,0x75,0xDD,0x02,0x71,0xFB,0x75,0xD0,0x73, // u.......u..q.u.s END
+	0xD5,0x44,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x03,0x05,0xC1,0xFB,0xF4, // .D.u.....@...... END
+	0xFA,0x02,0xFB,0xF4,0xE0,0x01,0x00,0xFB,0xF4,0xE0,0x02,0x00,0xFB,0xF4,0xE0,0x03, // ................ END
+	0x00,0xFB,0xF4,0xE0,0x04,0x00,0xFB,0xF4,0xE0,0x05,0x00,0xFB,0xF4,0xFB,0x83,0xDD, // ................ END
+	0x01,0x6F,0xFB,0x75,0x92,0xDD,0x02,0x6A,0xFB,0x75,0xD0,0x2F,0xD5,0x44,0xFB,0x75, // .o.u...j.u./.D.u END
+	0xFA,0x34,0xFB,0x83,0xDD,0x01,0x6A,0xFB,0x75,0x92,0xDD,0x02,0x6A,0xFB,0x75,0xD0, // .4....j.u...j.u. END
+	0x2F,0xD5,0x44,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x66,0xFB,0x75,0x92,0xDD, // /.D.u.4....f.u.. END
+	0x02,0x6A,0xFB,0x75,0xD0,0x20,0xD5,0x44,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01, // .j.u...D.u.4.... END
+	0x74,0xFB,0x75,0x92,0xDD,0x02,0x6A,0xFB,0x75,0xD0,0x3A,0xD5,0x44,0xFB,0x75,0xFA, // t.u...j.u.:.D.u. END
+	0x34,0xFB,0x83,0xDD,0x01,0x79,0xFB,0x75,0x92,0xDD,0x02,0x6A,0xFB,0x75,0xD0,0x3A, // 4....y.u...j.u.: END
+	0xD5,0x44,0xFB,0x75,0xFA,0x34,0xDD,0x01,0x7E,0xFB,0x75,0x92,0xDD,0x02,0x6A,0xFB, // .D.u.4..~.u...j. END
+	0x75,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4, // u.....@......... END
+	0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x02,0x61,0xD3,0x64, // ..........8..a.d END
+	0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93, // ...8.......8.... END
+	0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0, // ...8...'......L. END
+	0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43, // .C..........L..C END
+	0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA, // ...d.....L..C... END
+	0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00, // .....L..C...oA.. END
+	0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0, // .B.....@....@... END
+	0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD, // .....p..r....... END
+	0x02,0x06,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48, // ...u.........I.H END
+	0xE4,0x93,0x90,0xE3,0x80,0x06,0xD5,0x27,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80, // .......'.u...... END
+	0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFD,0xFB,0x83,0xD0,0x2D,0xD5,0x44,0xFB, // ..A.I.X.....-.D. END
+	0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x02,0x71,0xFC,0x0F,0xEE,0x40,0x81,0xF8, // u.4......q...@.. END
+	0x40,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x60,0x80,0xFB,0xF4,0xFC,0x0F, // @......@..`..... END
+	0xEE,0x40,0x81,0xF8,0x68,0x80,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x06,0xC1, // .@..h......@.... END
+	0xFB,0xF4,0xEE,0xB6,0xE1,0x83,0xDD,0x02,0xF5,0xFB,0x75,0xE3,0x83,0xFB,0xF4,0xEE, // ..........u..... END
+	0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4,0xFA,0x02,0xFB,0xF4,0xE0, // ....@........... END
+	0x01,0xFA,0x02,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0, // ................ END
+	0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE, // ................ END
+	0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB, // ................ END
+	0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00, // ................ END
+	0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42, // d......'.......B END
+	0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00, // @........;...... END
+	0x3C,0x00,0x00,0x0E,0x10,0x00,0x01,0x51,0x80,0x77,0x35,0x94,0x00,0xFF,0xFF,0xFF, // <......Q.w5..... END
+	0x01,0x8C,0x04,0x68,0x77,0x72,0x65,0x67,0x00,0x2F,0x2F,0xDE,0x80,0x08,0x83,0x91, // ...hwreg.//..... END
+	0xC1,0xF2,0x40,0xF8,0x58,0xD7,0xA6,0xDD,0x01,0x23,0xFB,0x75,0x70,0xE1,0x80,0x83, // ..@.X....#.up... END
+	0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0xA6,0xFB,0x83,0xD9,0x01,0x69,0xDD,0x01,0x19, // ...@.X......i... END
+	0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0x57,0xFB,0x83,0xD9,0x01,0x70,0xDD, // .u.@.4.X.W....p. END
+	0x01,0x19,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0x5D,0xFB,0x83,0xD9,0x01, // ...u.@.4.X.].... END
+	0x7D,0xDD,0x01,0x19,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xD7,0x63,0xD7,0xB3, // }....u.@.4.X.c.. END
+	0x81,0x70,0xE1,0x80,0xD7,0x68,0x82,0x70,0xE1,0x80,0xD7,0x68,0x83,0x70,0xE1,0x80, // .p...h.p...h.p.. END
+	0xC0,0x93,0xDA,0x80,0x00,0xB8,0xE0,0xC2,0xF2,0xCB,0xF8,0xE0,0xD7,0x93,0x83,0xC1, // ................ END
+	0xF2,0xC0,0xF8,0xD8,0xD7,0x93,0x71,0xE1,0x80,0xFB,0x93,0xDD,0x01,0x23,0xFB,0x75, // ......q......#.u END
+	0xFA,0xB4,0xE3,0x80,0x0E,0x50,0xE0,0x40,0xE0,0x80,0xD7,0x6C,0xD8,0x07,0x00,0xE3, // .....P.@...l.... END
+	0x80,0x16,0xE3,0x80,0x0E,0xDB,0x80,0x00,0xC1,0x80,0xDD,0x01,0x15,0xFB,0x75,0xD8, // ..............u. END
+	0x01,0x4F,0xD5,0xC0,0xFB,0x75,0x81,0xDD,0x01,0x15,0xFB,0x75,0xD8,0x01,0x5F,0xD5, // .O...u.....u.._. END
+	0xC0,0xFB,0x75,0x81,0xDD,0x01,0x15,0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ..u.....u.@..... END
+	0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0x42,0xFB, // @..p..........B. END
+	0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4, // u............... END
+	0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xD7,0xF6,0xEE,0x89,0x90,0xC0,0xEE, // .@.....@........ END
+	0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80, // .r.....@........ END
+	0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40, // .......@.......@ END
+	0x80,0xC1,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x05,0xC1,0xFB,0xF4,0x90,0x10,0xE2,0xAF, // .....@.......... END
+	0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA,0xE8, // ................ END
+	0x4B,0xE4,0x4A,0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8, // K.J...........@. END
+	0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x69, // ........usage:.i END
+	0x64,0x20,0x74,0x79,0x70,0x65,0x0A,0x00,0x42,0x61,0x64,0x20,0x74,0x79,0x70,0x65, // d.type..Bad.type END
+	0x0A,0x00,0x6B,0x65,0x79,0x70,0x61,0x64,0x00,0x73,0x64,0x63,0x61,0x72,0x64,0x72, // ..keypad.sdcardr END
+	0x65,0x61,0x64,0x65,0x72,0x00,0x64,0x68,0x74,0x32,0x32,0x00,0xFF,0xFF,0xFF,0xFF, // eader.dht22..... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x02,0xCB,0x06,0x73,0x65,0x74,0x70,0x69,0x6E,0x00,0x2F,0x2F,0xDE,0x80,0x00,0x83, // ...setpin.//.... END
+	0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x3C,0xD5,0xA0,0xFB,0x75,0x70,0xE1,0x80,0xD5, // ...@.X.<...up... END
+	0x7B,0xFB,0x75,0xF2,0x40,0xF8,0x58,0xD7,0x49,0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58, // {.u.@.X.I....@.X END
+	0xD7,0x3C,0xDD,0x01,0x53,0xFB,0x75,0xEE,0x40,0xE3,0x80,0x06,0xD5,0x56,0xFB,0x75, // .<..S.u.@....V.u END
+	0x80,0xDD,0x01,0x4F,0xFB,0x75,0xD8,0x02,0x44,0xD5,0xFA,0xFB,0x75,0x81,0xDD,0x01, // ...O.u..D...u... END
+	0x4F,0xFB,0x75,0xD8,0x02,0x5D,0xD5,0xFA,0xFB,0x75,0x81,0xDD,0x01,0x4F,0xFB,0x75, // O.u..]...u...O.u END
+	0x71,0xE1,0x80,0xDD,0x01,0x72,0xFB,0x75,0x70,0xE1,0x80,0x91,0xDD,0x01,0xA2,0xFB, // q....r.up....... END
+	0x75,0xD8,0x01,0x01,0xE3,0x80,0x0E,0xA0,0xE3,0x80,0xEE,0xF6,0xD4,0x01,0xC1,0xD8, // u............... END
+	0x01,0x03,0xC1,0xFB,0xF4,0x90,0xF2,0x41,0xF8,0x78,0xD7,0x9D,0xD1,0x5F,0xF2,0x41, // .......A.x..._.A END
+	0xF8,0x68,0xD7,0x9D,0x93,0xF6,0x41,0xDA,0x02,0x66,0xE4,0x4A,0x09,0xA7,0xF0,0x82, // .h....A..f.J.... END
+	0xF6,0x4A,0xA1,0xF0,0x0A,0xFB,0xF4,0x80,0xFB,0xF4,0x08,0xD2,0x41,0xF2,0x8A,0xF8, // .J..........A... END
+	0x90,0xD7,0xC8,0xD2,0x61,0xF2,0x8A,0xF8,0x90,0xD7,0xC8,0xD2,0x44,0xF2,0x8A,0xF8, // ....a.......D... END
+	0x90,0xD7,0xDF,0xD2,0x64,0xF2,0x8A,0xF8,0x90,0xD7,0xDF,0xDD,0x01,0x53,0xFB,0x75, // ....d........S.u END
+	0xFB,0xF4,0xE0,0x00,0xDD,0x01,0x53,0xFB,0x75,0xD1,0x10,0xF2,0x41,0xF8,0x60,0xD7, // ......S.u...A.`. END
+	0xF6,0xD9,0x02,0x72,0xE4,0x01,0x00,0xFB,0xF4,0xE0,0x00,0xDD,0x01,0x53,0xFB,0x75, // ...r.........S.u END
+	0xD1,0x36,0xF2,0x41,0xF8,0x60,0xD7,0xF6,0xD9,0x02,0x82,0xE4,0x01,0x00,0xFB,0xF4, // .6.A.`.......... END
+	0xD0,0x7F,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1, // .....@.....@..p. END
+	0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0xAD,0xFB,0x75,0xEF,0x00,0xD8,0x01, // ...........u.... END
+	0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE, // ............@... END
+	0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE, // ..@.........r... END
+	0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE, // ..@............. END
+	0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2, // ..@.......@..... END
+	0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA, // ................ END
+	0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB,0xF4,0xEE,0x76,0xD6,0x40, // .K.J.........v.@ END
+	0xE5,0x8E,0x70,0xE1,0x80,0xEE,0x09,0xD9,0x02,0xB8,0xDD,0x02,0x2A,0xFB,0x75,0xE3, // ..p.........*.u. END
+	0x80,0x0E,0xD0,0x40,0xE6,0x30,0xA8,0xE4,0x02,0xA0,0xDD,0x01,0xBA,0xFB,0x75,0xD8, // ...@.0........u. END
+	0x01,0x02,0xD1,0x40,0xE7,0xB1,0xEE,0x76,0xA3,0xC1,0xFB,0xF4,0xEE,0xC9,0xEE,0x40, // ...@...v.......@ END
+	0xD8,0x05,0x03,0xA1,0xC1,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1, // ..........@..... END
+	0xE6,0x03,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF, // ..............8. END
+	0x02,0x15,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38, // ...d...8.......8 END
+	0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9, // .......8...'.... END
+	0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6, // ..L..C.......... END
+	0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF, // L..C...d.....L.. END
+	0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0, // C........L..C... END
+	0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06, // oA...B.......@.. END
+	0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x01,0xAD,0xFB,0x75,0xEE, // ..............u. END
+	0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x02,0x1E,0xFB,0x75,0xFB,0xF4,0x75,0x73, // ....t.4....u..us END
+	0x61,0x67,0x65,0x3A,0x20,0x73,0x65,0x74,0x70,0x69,0x6E,0x20,0x70,0x69,0x6E,0x20, // age:.setpin.pin. END
+	0x73,0x74,0x61,0x74,0x65,0x0A,0x00,0x42,0x61,0x64,0x20,0x70,0x69,0x6E,0x0A,0x00, // state..Bad.pin.. END
+	0xFF,0xFF,0xFF,0x8F,0x3B,0xFF,0x27,0x7B,0x00,0x03,0xFF,0xFF,0x28,0x29,0x2A,0x2B, // ....;.'{....()*+ END
+	0x2C,0x2D,0x2E,0x2F,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x20,0x21,0x24,0x25, // ,-./PQRSTUVW.!$% END
+	0x35,0x23,0x3B,0x3C,0x3D,0x3E,0x0C,0x0D,0x0E,0x0F,0x49,0x48,0x39,0x38,0x1B,0x1A, // 5#;<=>....IH98.. END
+	0x19,0x18,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x17,0x16,0x15,0x14,0x13,0x12, // ................ END
+	0x11,0x10,0x1F,0x32,0x31,0x30,0x5F,0x5E,0x5D,0x5C,0x5B,0x5A,0x59,0x58,0x0B,0x0A, // ...210_^]\[ZYX.. END
+	0x09,0x08,0x2F,0x64,0x65,0x76,0x2F,0x70,0x69,0x6E,0x00,0xFF,0xFF,0xFF,0xFF,0xFF, // ../dev/pin...... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x04,0xA4,0x0A,0x74,0x69,0x6D,0x65,0x00,0x2F,0x2F,0xDE,0x80,0x11,0xD7,0x18,0xD8, // ...time.//...... END
+	0x80,0x08,0x00,0xD1,0x10,0xF2,0x41,0xF8,0x50,0xFB,0xF4,0x8C,0xA3,0xC1,0xFB,0xF4, // ......A.P....... END
+	0xD0,0x10,0xD9,0x80,0x08,0x48,0xD8,0x04,0x00,0x93,0xA7,0xC1,0xD8,0x80,0x00,0xD5, // .....H.......... END
+	0x8B,0xFB,0x75,0x84,0xC1,0xD1,0x10,0xF2,0x41,0xF8,0x58,0xD7,0x3B,0xF8,0x50,0xD7, // ..u.....A.X.;.P. END
+	0x4D,0xD7,0x42,0x8E,0x91,0xD2,0xFF,0xC1,0xD7,0x7D,0xD9,0x80,0x08,0x48,0xDD,0x02, // M.B......}...H.. END
+	0xF7,0xFB,0x75,0xD7,0x57,0xD8,0x04,0x4E,0xDD,0x02,0x17,0xFB,0x75,0xD7,0x7D,0xD8, // ..u.W..N....u.}. END
+	0x80,0x04,0xD5,0x8B,0xFB,0x75,0xD8,0x80,0x04,0xD9,0x80,0x00,0xD5,0x87,0xFB,0x75, // .....u.........u END
+	0xD8,0x04,0x47,0xDD,0x02,0x17,0xFB,0x75,0xD8,0x80,0x04,0xD5,0x9B,0xFB,0x75,0x8A, // ..G....u......u. END
+	0xDD,0x02,0x3E,0xFB,0x75,0x80,0xDD,0x02,0x6C,0xFB,0x75,0xFC,0x0A,0xFB,0xF4,0xFC, // ..>.u...l.u..... END
+	0x0B,0xFB,0xF4,0xEE,0x40,0xD8,0x03,0x02,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x03,0x04, // ....@.......@... END
+	0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x80,0x09,0xDD,0x04,0x34,0xFB,0x75,0xD8,0x80,0x09, // ....@.....4.u... END
+	0xD9,0x04,0x94,0xDD,0x03,0xCD,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xD7,0xE3,0xD8,0x80, // .......u........ END
+	0x0D,0xD9,0x80,0x09,0xDD,0x04,0x34,0xFB,0x75,0xD8,0x80,0x0D,0xD9,0x04,0x94,0xDA, // ......4.u....... END
+	0x80,0x09,0xDD,0x03,0xF8,0xFB,0x75,0xD8,0x80,0x0D,0xDD,0x04,0x08,0xFB,0x75,0xDD, // ......u.......u. END
+	0x03,0x72,0xFB,0x75,0xD0,0x64,0xDD,0x02,0x3E,0xFB,0x75,0xD8,0x80,0x09,0xD9,0x04, // .r.u.d..>.u..... END
+	0x90,0xDD,0x03,0xCD,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xE1,0xEC,0xD8,0x80,0x0D,0xD9, // .....u.......... END
+	0x80,0x09,0xDD,0x04,0x34,0xFB,0x75,0xD8,0x80,0x0D,0xD9,0x04,0x90,0xDA,0x80,0x09, // ....4.u......... END
+	0xDD,0x03,0xF8,0xFB,0x75,0xD8,0x80,0x0D,0xDD,0x04,0x08,0xFB,0x75,0xDD,0x03,0x72, // ....u.......u..r END
+	0xFB,0x75,0xD0,0x68,0xDD,0x02,0x3E,0xFB,0x75,0xD8,0x80,0x09,0xD9,0x04,0x8C,0xDD, // .u.h..>.u....... END
+	0x03,0xCD,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xE1,0xEC,0xD8,0x80,0x0D,0xD9,0x80,0x09, // ...u............ END
+	0xDD,0x04,0x34,0xFB,0x75,0xD8,0x80,0x0D,0xD9,0x04,0x8C,0xDA,0x80,0x09,0xDD,0x03, // ..4.u........... END
+	0xF8,0xFB,0x75,0xD8,0x80,0x0D,0xDD,0x04,0x08,0xFB,0x75,0xDD,0x03,0x72,0xFB,0x75, // ..u.......u..r.u END
+	0xD0,0x6D,0xDD,0x02,0x3E,0xFB,0x75,0xD8,0x80,0x09,0xDD,0x04,0x08,0xFB,0x75,0xDD, // .m..>.u.......u. END
+	0x03,0x72,0xFB,0x75,0xD0,0x73,0xDD,0x02,0x3E,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE, // .r.u.s..>.u..... END
+	0x40,0xD8,0x03,0x05,0xC1,0xFB,0xF4,0xFA,0x02,0xFB,0xF4,0xE0,0x01,0x00,0xFB,0xF4, // @............... END
+	0xE0,0x02,0x00,0xFB,0xF4,0xE0,0x03,0x00,0xFB,0xF4,0xE0,0x04,0x00,0xFB,0xF4,0xE0, // ................ END
+	0x05,0x00,0xFB,0xF4,0xFB,0x83,0xDD,0x01,0x88,0xFB,0x75,0x92,0xDD,0x03,0x6B,0xFB, // ..........u...k. END
+	0x75,0xD0,0x2F,0xDD,0x02,0x3E,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x83,0xFB, // u./..>.u.4...... END
+	0x75,0x92,0xDD,0x03,0x6B,0xFB,0x75,0xD0,0x2F,0xDD,0x02,0x3E,0xFB,0x75,0xFA,0x34, // u...k.u./..>.u.4 END
+	0xFB,0x83,0xDD,0x01,0x7F,0xFB,0x75,0x92,0xDD,0x03,0x6B,0xFB,0x75,0xD0,0x20,0xDD, // ......u...k.u... END
+	0x02,0x3E,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x8D,0xFB,0x75,0x92,0xDD,0x03, // .>.u.4......u... END
+	0x6B,0xFB,0x75,0xD0,0x3A,0xDD,0x02,0x3E,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01, // k.u.:..>.u.4.... END
+	0x92,0xFB,0x75,0x92,0xDD,0x03,0x6B,0xFB,0x75,0xD0,0x3A,0xDD,0x02,0x3E,0xFB,0x75, // ..u...k.u.:..>.u END
+	0xFA,0x34,0xDD,0x01,0x97,0xFB,0x75,0x92,0xDD,0x03,0x6B,0xFB,0x75,0xFB,0xF4,0xEE, // .4....u...k.u... END
+	0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93, // @.....@..p...... END
+	0xEE,0x12,0xDD,0x04,0x3A,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4, // ....:.u......... END
+	0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1, // .......@.....@.. END
+	0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01, // .......r.....@.. END
+	0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01, // .............@.. END
+	0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06, // .....@.......@.. END
+	0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x04,0x3A,0xFB,0x75,0xEE, // ............:.u. END
+	0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x02,0x70,0xFB,0x75,0xFB,0xF4,0xFB,0x83, // ....t.4..p.u.... END
+	0xFB,0x8B,0xDD,0x04,0x3A,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD, // ....:.u...t.4... END
+	0x02,0x7C,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3, // .|.u.........B.. END
+	0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x02,0xAE,0xFB,0x75, // /..............u END
+	0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x02,0x7C,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB, // .@.4....|.u.4.t. END
+	0x83,0xFB,0x8B,0xD9,0x04,0x5E,0xDD,0x02,0x96,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD, // .....^....u.t.4. END
+	0x02,0x96,0xFB,0x75,0xFB,0xF4,0xB1,0xEE,0x89,0xEE,0x40,0x85,0xC1,0xFB,0xF4,0xEE, // ...u......@..... END
+	0x40,0xA0,0xDB,0xFF,0xFB,0x86,0xC1,0xF3,0x04,0xF9,0x10,0xE3,0xC7,0xFB,0xF4,0xF2, // @............... END
+	0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x03,0x62,0xD3,0x64,0xF3, // .........8..b.d. END
+	0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3, // ..8.......8..... END
+	0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF, // ..8...'......L.. END
+	0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0, // C..........L..C. END
+	0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA, // ..d.....L..C.... END
+	0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0, // ....L..C...oA... END
+	0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0, // B.....@....@.... END
+	0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x03, // ....p..r........ END
+	0x07,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4, // ..u.........I.H. END
+	0x93,0x90,0xE3,0x80,0x06,0xDD,0x02,0x21,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80, // .......!.u...... END
+	0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFE,0xFB,0x83,0xD0,0x2D,0xDD,0x02,0x3E, // ..A.I.X.....-..> END
+	0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x03,0x72,0xFC,0x0F,0xEE,0x40,0x81, // .u.4......r...@. END
+	0xF8,0x40,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x60,0x80,0xFB,0xF4,0xFC, // .@......@..`.... END
+	0x0F,0xEE,0x40,0x81,0xF8,0x68,0x80,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x06, // ..@..h......@... END
+	0xC1,0xFB,0xF4,0xEE,0xB6,0xE1,0x83,0xDD,0x03,0xF8,0xFB,0x75,0xE3,0x83,0xFB,0xF4, // ...........u.... END
+	0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4,0xFA,0x02,0xFB,0xF4, // .....@.......... END
+	0xE0,0x01,0xFA,0x02,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09, // ................ END
+	0xA0,0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA, // ................ END
+	0xFE,0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02, // ................ END
+	0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x74, // .....@.........t END
+	0x6F,0x6F,0x6B,0x3A,0x20,0x00,0x63,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20, // ook:..could.not. END
+	0x66,0x6F,0x72,0x6B,0x0A,0x00,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01, // fork../......... END
+	0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10, // .......d......'. END
+	0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00, // ......B@........ END
+	0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x0E,0x10,0x00,0x01,0x51,0x80, // ;......<......Q. END
+	0x77,0x35,0x94,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // w5.............. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0xDC,0x02,0x68,0x77,0x73,0x64,0x6D,0x6E,0x74,0x00,0x2F,0x2F,0xDE,0x80,0x00, // ...hwsdmnt.//... END
+	0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x2C,0xD5,0x8F,0xFB,0x75,0x70,0xE1,0x80, // ....@.X.,...up.. END
+	0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x2C,0xEE,0x80,0xD8,0x07,0x03,0xE3,0x80, // ....@.X.,....... END
+	0x0E,0xC1,0x80,0xD5,0x8B,0xFB,0x75,0xD0,0xBB,0xD5,0x37,0xFB,0x75,0x81,0xD5,0x8B, // ......u...7.u... END
+	0xFB,0x75,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB, // .u.@.....@..p... END
+	0x8B,0xFB,0x93,0xEE,0x12,0xD5,0xAE,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4, // ........u....... END
+	0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40, // .........@.....@ END
+	0x82,0xD7,0x6C,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40, // ..l......r.....@ END
+	0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40, // ...............@ END
+	0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF,0xB0,0xF2, // .......@........ END
+	0xD3,0xF8,0xF8,0xD7,0xAA,0xB9,0xF2,0xD3,0xF8,0xE8,0xD7,0xAA,0xBA,0xE8,0x4B,0xE4, // ..............K. END
+	0x4A,0xE0,0x00,0xD7,0x90,0xEE,0x09,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01, // J...........@... END
+	0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x69,0x64,0x20, // ......usage:.id. END
+	0x6D,0x6F,0x75,0x6E,0x74,0x50,0x6F,0x69,0x6E,0x74,0x0A,0x00,0xFF,0xFF,0xFF,0xFF, // mountPoint...... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x02,0x37,0x05,0x72,0x65,0x73,0x65,0x74,0x00,0x2F,0x2F,0xDE,0x80,0x00,0xD5,0x45, // .7.reset.//....E END
+	0xFB,0x75,0x81,0xD5,0x60,0xFB,0x75,0xD5,0x17,0xFB,0x75,0x80,0xD5,0xE8,0xFB,0x75, // .u..`.u...u....u END
+	0xD5,0x57,0xFB,0x75,0x81,0xD5,0x3E,0xFB,0x75,0xD5,0x2C,0xFB,0x75,0x80,0x90,0xD5, // .W.u..>.u.,.u... END
+	0x6A,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x09,0xD5,0xEC,0xFB,0x75,0xFB,0xF4,0xD8,0x02, // j.u........u.... END
+	0x0E,0xD5,0xEC,0xFB,0x75,0xFB,0xF4,0xF2,0x00,0xF8,0x18,0xD7,0x4E,0xC0,0xD8,0x02, // ....u.......N... END
+	0x20,0xD5,0xEC,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x27,0xD5,0xEC,0xFB,0x75,0xFB,0xF4, // ....u....'...u.. END
+	0xD8,0x02,0x1B,0xD5,0xEC,0xFB,0x75,0xFB,0xF4,0xEE,0xC0,0xD8,0x05,0x03,0x92,0xA0, // ......u......... END
+	0xC1,0xFB,0xF4,0xE0,0x00,0xE0,0x40,0x70,0xE1,0x80,0x71,0xE1,0x80,0xD0,0x1B,0xDD, // ......@p..q..... END
+	0x01,0x13,0xFB,0x75,0xD0,0x5B,0xDD,0x01,0x13,0xFB,0x75,0xE3,0x80,0x06,0xDD,0x01, // ...u.[....u..... END
+	0xAC,0xFB,0x75,0xD0,0x3B,0xDD,0x01,0x13,0xFB,0x75,0xE3,0x80,0x06,0xDD,0x01,0xAC, // ..u.;....u...... END
+	0xFB,0x75,0xD0,0x48,0xDD,0x01,0x13,0xFB,0x75,0xFB,0xF4,0x72,0xE1,0x80,0x71,0xE1, // .u.H....u..r..q. END
+	0x80,0x70,0xE1,0x80,0xD8,0x02,0x13,0xD5,0xEC,0xFB,0x75,0xE3,0x80,0x06,0xDD,0x01, // .p........u..... END
+	0xAC,0xFB,0x75,0xD0,0x3B,0xDD,0x01,0x13,0xFB,0x75,0xE3,0x80,0x06,0xDD,0x01,0xAC, // ..u.;....u...... END
+	0xFB,0x75,0xD0,0x3B,0xDD,0x01,0x13,0xFB,0x75,0xE3,0x80,0x06,0xDD,0x01,0xAC,0xFB, // .u.;....u....... END
+	0x75,0xD0,0x6D,0xDD,0x01,0x13,0xFB,0x75,0xFB,0xF4,0xD8,0x01,0x08,0x91,0xC1,0xFB, // u.m....u........ END
+	0xF4,0xEE,0x40,0x80,0xC1,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70, // ..@...@.....@..p END
+	0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x01,0xFC,0xFB,0x75,0xEF,0x00,0xD8, // ............u... END
+	0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0, // .............@.. END
+	0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80, // ...@.........r.. END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2, // ...@............ END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF, // ...@............ END
+	0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x01,0x9C,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8, // ....8....d...8.. END
+	0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD, // .....8.......8.. END
+	0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03, // .'......L..C.... END
+	0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA, // ......L..C...d.. END
+	0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C, // ...L..C........L END
+	0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89, // ..C...oA...B.... END
+	0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70, // .@....@........p END
+	0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x01,0x41,0xFB,0x75,0xFA,0xB4, // ..r........A.u.. END
+	0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06, // .......I.H...... END
+	0xD5,0xF6,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8, // ...u........A.I. END
+	0x58,0xE3,0xFD,0xFB,0x83,0xD0,0x2D,0xDD,0x01,0x13,0xFB,0x75,0xFA,0x34,0xFA,0x00, // X.....-....u.4.. END
+	0xE0,0x00,0xDF,0x01,0xAC,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03, // ........@....... END
+	0xFB,0xF4,0x1B,0x5B,0x32,0x4A,0x00,0x1B,0x5B,0x32,0x4B,0x00,0x1B,0x5B,0x33,0x38, // ...[2J..[2K..[38 END
+	0x3B,0x32,0x3B,0x00,0x1B,0x5B,0x30,0x6D,0x00,0x1B,0x5B,0x3F,0x32,0x35,0x68,0x00, // ;2;..[0m..[?25h. END
+	0x1B,0x5B,0x3F,0x32,0x35,0x6C,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // .[?25l.......... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x08,0xED,0x12,0x66,0x64,0x69,0x73,0x6B,0x00,0x2F,0x2F,0xDE,0x80,0x5D,0xD8,0x80, // ...fdisk.//..].. END
+	0x54,0x90,0x41,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x73,0xEE,0x40,0xD8,0x80, // T.A....@.X.s.@.. END
+	0x14,0xDD,0x05,0x62,0xFB,0x75,0xD8,0x80,0x14,0x91,0xDD,0x03,0x62,0xFB,0x75,0x90, // ...b.u......b.u. END
+	0xF2,0x41,0xF8,0x50,0xD7,0x7D,0xD9,0x80,0x54,0x48,0xD8,0x80,0x54,0x00,0xD9,0x01, // .A.P.}..TH..T... END
+	0xFE,0xDD,0x03,0x22,0xFB,0x75,0xD1,0x55,0xF2,0x41,0xF8,0x40,0xD7,0x87,0xD8,0x80, // ...".u.U.A.@.... END
+	0x54,0x00,0xD9,0x01,0xFF,0xDD,0x03,0x22,0xFB,0x75,0xD1,0xAA,0xF2,0x41,0xF8,0x40, // T......".u...A.@ END
+	0xD7,0x87,0x80,0x70,0xE1,0x80,0xD5,0x91,0xFB,0x75,0xE3,0x80,0x06,0xE0,0x00,0x94, // ...p.....u...... END
+	0xF2,0x41,0xF8,0x40,0xD7,0x5A,0x80,0xDD,0x05,0x1A,0xFB,0x75,0xD8,0x07,0xB1,0xDD, // .A.@.Z.....u.... END
+	0x03,0x6C,0xFB,0x75,0xD7,0x6D,0xD8,0x07,0xC4,0xDD,0x03,0x6C,0xFB,0x75,0xD7,0x6D, // .l.u.m.....l.u.m END
+	0xD8,0x07,0xD9,0xDD,0x03,0x6C,0xFB,0x75,0xD7,0x6D,0x70,0xE1,0x80,0xD8,0x07,0xEA, // .....l.u.mp..... END
+	0xDD,0x03,0x6C,0xFB,0x75,0xE3,0x80,0x06,0x70,0xE1,0x80,0xE0,0x00,0xDD,0x04,0x2C, // ..l.u...p......, END
+	0xFB,0x75,0xD0,0x3A,0xDD,0x03,0x93,0xFB,0x75,0x8A,0xDD,0x03,0x93,0xFB,0x75,0xD8, // .u.:....u.....u. END
+	0x80,0x54,0x00,0xE3,0x80,0x0E,0xD2,0x10,0xE8,0x4A,0xDA,0x01,0xBE,0xE4,0x4A,0xDA, // .T.......J....J. END
+	0x80,0x04,0xD3,0x10,0xDD,0x04,0xFE,0xFB,0x75,0xD1,0x10,0xF2,0x01,0xF8,0x00,0xDF, // ........u....... END
+	0x01,0x6D,0xD8,0x08,0x0B,0xDD,0x03,0x6C,0xFB,0x75,0xD8,0x80,0x04,0x00,0xDD,0x04, // .m.....l.u...... END
+	0xC7,0xFB,0x75,0x8A,0xDD,0x03,0x93,0xFB,0x75,0xD8,0x08,0x1B,0xDD,0x03,0x6C,0xFB, // ..u.....u.....l. END
+	0x75,0xD8,0x80,0x04,0xE0,0x03,0x00,0xDD,0x04,0xC7,0xFB,0x75,0x8A,0xDD,0x03,0x93, // u..........u.... END
+	0xFB,0x75,0xD8,0x08,0x25,0xDD,0x03,0x6C,0xFB,0x75,0xD8,0x80,0x04,0xE0,0x0B,0xDD, // .u..%..l.u...... END
+	0x05,0x9C,0xFB,0x75,0xD8,0x80,0x04,0xE0,0x0B,0xDD,0x05,0xB2,0xFB,0x75,0x8A,0xDD, // ...u.........u.. END
+	0x03,0x93,0xFB,0x75,0xD8,0x08,0x34,0xDD,0x03,0x6C,0xFB,0x75,0xD8,0x80,0x04,0xE0, // ...u..4..l.u.... END
+	0x07,0xDD,0x05,0x9C,0xFB,0x75,0xD8,0x80,0x04,0xE0,0x07,0xDD,0x05,0xB2,0xFB,0x75, // .....u.........u END
+	0x8A,0xDD,0x03,0x93,0xFB,0x75,0xD8,0x08,0x44,0xDD,0x03,0x6C,0xFB,0x75,0xD8,0x80, // .....u..D..l.u.. END
+	0x04,0xE0,0x0B,0xDD,0x01,0x77,0xFB,0x75,0x8A,0xDD,0x03,0x93,0xFB,0x75,0x8A,0xDD, // .....w.u.....u.. END
+	0x03,0x93,0xFB,0x75,0xFB,0xF4,0xD8,0x07,0xF5,0xDD,0x03,0x6C,0xFB,0x75,0xFB,0xF4, // ...u.......l.u.. END
+	0xFB,0x83,0xD9,0x08,0x54,0xDD,0x07,0x93,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xF2,0x49, // ....T....u.@.4.I END
+	0xF8,0x58,0xDF,0x01,0xCF,0xFB,0x83,0xD9,0x08,0x50,0xDD,0x07,0x93,0xFB,0x75,0xEE, // .X.......P....u. END
+	0x40,0xFA,0x34,0xF2,0x49,0xF8,0x58,0xDF,0x02,0x12,0xFB,0x83,0xD9,0x08,0x4C,0xDD, // @.4.I.X.......L. END
+	0x07,0x93,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xF2,0x49,0xF8,0x58,0xDF,0x02,0x55,0xFB, // ...u.@.4.I.X..U. END
+	0x83,0x99,0xDD,0x06,0x27,0xFB,0x75,0xFA,0x34,0xDD,0x05,0xB2,0xFB,0x75,0xD8,0x08, // ....'.u.4....u.. END
+	0x59,0xDD,0x03,0x6C,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xD9,0x08,0x54,0xDA,0x80,0x00, // Y..l.u......T... END
+	0xDD,0x07,0x2A,0xFB,0x75,0xFA,0x34,0xDD,0x05,0xB2,0xFB,0x75,0xD0,0x2E,0xDD,0x03, // ..*.u.4....u.... END
+	0x93,0xFB,0x75,0xD8,0x80,0x00,0xD9,0x08,0x67,0xDD,0x06,0x23,0xFB,0x75,0xD8,0x80, // ..u.....g..#.u.. END
+	0x00,0xD9,0x08,0x54,0xDD,0x07,0x1D,0xFB,0x75,0xD8,0x80,0x00,0xDD,0x05,0xB2,0xFB, // ...T....u....... END
+	0x75,0xD8,0x08,0x5E,0xDD,0x03,0x6C,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xD9,0x08,0x50, // u..^..l.u......P END
+	0xDA,0x80,0x00,0xDD,0x07,0x2A,0xFB,0x75,0xFA,0x34,0xDD,0x05,0xB2,0xFB,0x75,0xD0, // .....*.u.4....u. END
+	0x2E,0xDD,0x03,0x93,0xFB,0x75,0xD8,0x80,0x00,0xD9,0x08,0x67,0xDD,0x06,0x23,0xFB, // .....u.....g..#. END
+	0x75,0xD8,0x80,0x00,0xD9,0x08,0x50,0xDD,0x07,0x1D,0xFB,0x75,0xD8,0x80,0x00,0xDD, // u.....P....u.... END
+	0x05,0xB2,0xFB,0x75,0xD8,0x08,0x5B,0xDD,0x03,0x6C,0xFB,0x75,0xFB,0xF4,0xFB,0x83, // ...u..[..l.u.... END
+	0xD9,0x08,0x4C,0xDA,0x80,0x00,0xDD,0x07,0x2A,0xFB,0x75,0xFA,0x34,0xDD,0x05,0xB2, // ..L.....*.u.4... END
+	0xFB,0x75,0xD0,0x2E,0xDD,0x03,0x93,0xFB,0x75,0xD8,0x80,0x00,0xD9,0x08,0x67,0xDD, // .u......u.....g. END
+	0x06,0x23,0xFB,0x75,0xD8,0x80,0x00,0xD9,0x08,0x4C,0xDD,0x07,0x1D,0xFB,0x75,0xD8, // .#.u.....L....u. END
+	0x80,0x00,0xDD,0x05,0xB2,0xFB,0x75,0xD8,0x08,0x58,0xDD,0x03,0x6C,0xFB,0x75,0xFB, // ......u..X..l.u. END
+	0xF4,0xEE,0x40,0xD8,0x01,0x03,0xC1,0xFB,0xF4,0xEE,0x80,0xEE,0xC9,0x81,0x90,0xC0, // ..@............. END
+	0xFB,0x93,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00,0xD4,0x01,0xC1,0xF8,0x00, // .......@........ END
+	0xE1,0xCD,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1,0xC3,0xE0,0x80,0xE3,0xD7, // ..#............. END
+	0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0x70,0xE1,0x80,0xFB,0x93,0xFB,0x9B,0xD8, // .X.4....p....... END
+	0x80,0x55,0xDD,0x06,0x65,0xFB,0x75,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x06,0xFB,0x93, // .U..e.u......... END
+	0xEE,0xD2,0xEE,0x40,0xD8,0x01,0x0C,0xDA,0x80,0x55,0xD4,0x01,0xC1,0xF8,0x00,0xE1, // ...@.....U...... END
+	0xE1,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1,0xD7,0x71,0xE1,0x80,0xFB,0x93, // .#.........q.... END
+	0xFB,0x9B,0xD8,0x80,0x55,0xDD,0x06,0x32,0xFB,0x75,0xFA,0xF4,0xFA,0xB4,0xE3,0x80, // ....U..2.u...... END
+	0x0E,0xE3,0xEE,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8, // ....X.4.......@. END
+	0x01,0x00,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00,0xF8,0x08,0xE1,0xC6,0xE3, // ................ END
+	0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8, // ..............@. END
+	0x01,0x0C,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00,0xF8,0x08,0xE1,0xC6,0xE3, // ................ END
+	0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8, // ..............@. END
+	0x01,0x02,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70, // ......@.....@..p END
+	0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x06,0x6B,0xFB,0x75,0xEF,0x00,0xD8, // ..........k.u... END
+	0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0, // .............@.. END
+	0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80, // ...@.........r.. END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2, // ...@............ END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF, // ...@............ END
+	0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x04,0x1C,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8, // ....8....d...8.. END
+	0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD, // .....8.......8.. END
+	0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03, // .'......L..C.... END
+	0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA, // ......L..C...d.. END
+	0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C, // ...L..C........L END
+	0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89, // ..C...oA...B.... END
+	0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70, // .@....@........p END
+	0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x03,0xC1,0xFB,0x75,0xFA,0xB4, // ..r..........u.. END
+	0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06, // .......I.H...... END
+	0xDD,0x03,0x76,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49, // ..v.u........A.I END
+	0xF8,0x58,0xE3,0xFE,0xFB,0x83,0xD0,0x2D,0xDD,0x03,0x93,0xFB,0x75,0xFA,0x34,0xFA, // .X.....-....u.4. END
+	0x00,0xE0,0x00,0xDF,0x04,0x2C,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xAC, // .....,.@..p..... END
+	0xF6,0x4A,0xDD,0x04,0xEC,0xFB,0x75,0xFA,0x74,0xE3,0x80,0x06,0x70,0xE1,0x80,0xFB, // .J....u.t...p... END
+	0x8B,0xA8,0xF6,0x4A,0xAF,0xF0,0x4A,0xDD,0x04,0xEC,0xFB,0x75,0xFA,0x74,0xE3,0x80, // ...J..J....u.t.. END
+	0x06,0x70,0xE1,0x80,0xFB,0x8B,0xA4,0xF6,0x4A,0xAF,0xF0,0x4A,0xDD,0x04,0xEC,0xFB, // .p......J..J.... END
+	0x75,0xFA,0x74,0xE3,0x80,0x06,0xAF,0xF0,0x4A,0xDD,0x04,0xEC,0xFB,0x75,0xFB,0xF4, // u.t.....J....u.. END
+	0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0x71,0xE1,0x80,0xA4,0xF6,0x4A,0xAF,0xF0,0x4A, // .@..p..q....J..J END
+	0xDD,0x04,0xEC,0xFB,0x75,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xAF,0xF0,0x4A,0xDD,0x04, // ....u........J.. END
+	0xEC,0xFB,0x75,0xFB,0xF4,0xBA,0xF2,0xCB,0xD2,0x30,0xE4,0x4A,0xF8,0xE0,0xE0,0x46, // ..u......0.J...F END
+	0xDD,0x03,0x9E,0xFB,0x75,0xFB,0xF4,0xEF,0x1B,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8, // ....u.........@. END
+	0x01,0x00,0xC1,0xFB,0xF4,0xEF,0x1B,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x0C, // ............@... END
+	0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02, // ....@.......@... END
+	0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x06,0x6B,0xFB,0x75,0xEE,0x80, // ...........k.u.. END
+	0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x05,0x1E,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB, // ...t.4....u..... END
+	0x8B,0xDD,0x06,0x6B,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x05, // ...k.u...t.4.... END
+	0x2A,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F, // *.u.........B../ END
+	0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x05,0x5C,0xFB,0x75,0xEE, // ............\.u. END
+	0x40,0xFA,0x34,0xFB,0x83,0xDD,0x05,0x2A,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83, // @.4....*.u.4.t.. END
+	0xFB,0x8B,0xD9,0x08,0x61,0xDD,0x05,0x44,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x05, // ....a..D.u.t.4.. END
+	0x44,0xFB,0x75,0xFB,0xF4,0x08,0xFE,0x80,0x03,0xFE,0x09,0x03,0x42,0xFE,0x40,0x01, // D.u.........B.@. END
+	0xFE,0x80,0x02,0xFE,0x09,0x02,0xFE,0x11,0x01,0xFB,0xF4,0x92,0xC0,0xA0,0xC0,0xEE, // ................ END
+	0xF6,0xD4,0x0C,0xE5,0xB4,0x71,0xE1,0x80,0xFB,0x93,0xFB,0x9B,0xEE,0x40,0xEE,0x1B, // .....q.......@.. END
+	0xDD,0x06,0x82,0xFB,0x75,0xFA,0xB4,0xFA,0x74,0xE3,0x80,0x06,0xDD,0x03,0x76,0xFB, // ....u...t.....v. END
+	0x75,0xD4,0x0C,0xE7,0xB4,0xFB,0xF4,0xFB,0x83,0xD0,0x7B,0xDD,0x03,0x93,0xFB,0x75, // u.........{....u END
+	0xFA,0x34,0xFB,0x83,0xDD,0x06,0x78,0xFB,0x75,0xDD,0x04,0x2C,0xFB,0x75,0xD0,0x2C, // .4....x.u..,.u., END
+	0xDD,0x03,0x93,0xFB,0x75,0xFA,0x34,0xDD,0x06,0x7C,0xFB,0x75,0xDD,0x04,0x2C,0xFB, // ....u.4..|.u..,. END
+	0x75,0xD0,0x7D,0xDD,0x03,0x93,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x93,0xDD,0x06, // u.}....u........ END
+	0x3F,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xC0,0xFC,0x0C,0xFB,0xF4,0xFC,0x0D,0xFB,0xF4, // ?.u.t.4......... END
+	0xFC,0x0E,0xFB,0xF4,0xA0,0xE6,0x51,0xFC,0x0E,0xFB,0xF4,0x91,0xFC,0x08,0xFB,0xF4, // ......Q......... END
+	0xFC,0x08,0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4, // ................ END
+	0xFA,0x09,0xA0,0xFE,0x13,0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19, // ................ END
+	0xF4,0xCA,0xFE,0x1B,0x02,0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE, // ................ END
+	0x0C,0x02,0xFB,0xF4,0xEE,0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB, // .......@........ END
+	0xF4,0xFA,0x02,0xFB,0xF4,0xE0,0x01,0xFA,0x02,0xFB,0xF4,0xFB,0x83,0xD8,0x80,0x59, // ...............Y END
+	0xDD,0x06,0x65,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xD8,0x80,0x59,0xDD,0x07,0x5E,0xFB, // ..e.u.4....Y..^. END
+	0x75,0xE0,0x00,0xEE,0x40,0xFA,0x34,0xE4,0x01,0x90,0x41,0xE2,0x00,0xFB,0x83,0xD8, // u...@.4...A..... END
+	0x80,0x59,0x9A,0xDD,0x07,0x13,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xE0,0x6F,0x41,0xE2, // .Y.....u.@.4.oA. END
+	0x00,0xFB,0x83,0xD8,0x80,0x59,0xD9,0x08,0xB7,0xDD,0x07,0x89,0xFB,0x75,0xF2,0x40, // .....Y.......u.@ END
+	0xFA,0x34,0xF8,0x58,0xE3,0xE8,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0x90,0xDD,0x06,0x3F, // .4.X...........? END
+	0xFB,0x75,0xFA,0x74,0xFA,0x34,0x11,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xE9, // .u.t.4.......... END
+	0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xE2,0xFB,0x8B,0xFB,0x83,0x72,0xE1,0x80,0xD9,0x08, // ...........r.... END
+	0x67,0xDD,0x06,0x23,0xFB,0x75,0xE3,0x80,0x0E,0xFA,0x34,0xFB,0x83,0xDD,0x06,0x37, // g..#.u....4....7 END
+	0xFB,0x75,0xFA,0x34,0xFA,0x74,0xE0,0x40,0xE3,0xF3,0xFB,0xF4,0xEE,0x89,0xEE,0x40, // .u.4.t.@.......@ END
+	0xD8,0x08,0x06,0xC1,0xFB,0xF4,0xEE,0xB6,0xE1,0x83,0xDD,0x07,0x2A,0xFB,0x75,0xE3, // ............*.u. END
+	0x83,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4,0xEE, // ........@....... END
+	0x40,0xFA,0x0A,0xFA,0x07,0xD2,0x10,0xF2,0x82,0xF8,0x80,0xFB,0xF4,0xFE,0x0A,0x02, // @............... END
+	0xFA,0x07,0xE0,0x0F,0xFB,0xF4,0xDD,0x07,0x36,0xFB,0x75,0xD1,0x1F,0xF2,0x81,0xF8, // ........6.u..... END
+	0xA8,0xE2,0x00,0xE6,0x08,0xFB,0xF4,0xFB,0x83,0xDD,0x07,0x36,0xFB,0x75,0xD9,0x08, // ...........6.u.. END
+	0x9B,0xE4,0x01,0x10,0xFA,0x34,0x72,0xE1,0x80,0xFB,0x83,0xEE,0x12,0xE0,0x00,0xDD, // .....4r......... END
+	0x07,0xA7,0xFB,0x75,0xFA,0x74,0xDD,0x07,0x9D,0xFB,0x75,0xE3,0x80,0x0E,0xE4,0x01, // ...u.t....u..... END
+	0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x40,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40, // .....@..@......@ END
+	0x81,0xF8,0x60,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x68,0x80,0xFB,0xF4, // ..`......@..h... END
+	0x94,0xE8,0x01,0xD9,0x08,0xBC,0xE4,0x01,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A, // ..........usage: END
+	0x20,0x66,0x64,0x69,0x73,0x6B,0x20,0x70,0x61,0x74,0x68,0x0A,0x00,0x43,0x6F,0x75, // .fdisk.path..Cou END
+	0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x6F,0x70,0x65,0x6E,0x20,0x64,0x69,0x73,0x6B, // ld.not.open.disk END
+	0x0A,0x00,0x42,0x61,0x64,0x20,0x6D,0x61,0x67,0x69,0x63,0x20,0x62,0x79,0x74,0x65, // ..Bad.magic.byte END
+	0x73,0x0A,0x00,0x50,0x61,0x72,0x74,0x69,0x74,0x69,0x6F,0x6E,0x20,0x00,0x09,0x63, // s..Partition...c END
+	0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x72,0x65,0x61,0x64,0x20,0x65,0x6E, // ould.not.read.en END
+	0x74,0x72,0x79,0x00,0x09,0x41,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x73,0x3A, // try..Attributes: END
+	0x20,0x30,0x78,0x00,0x09,0x54,0x79,0x70,0x65,0x3A,0x20,0x30,0x78,0x00,0x09,0x4E, // .0x..Type:.0x..N END
+	0x75,0x6D,0x20,0x53,0x65,0x63,0x74,0x6F,0x72,0x73,0x3A,0x20,0x00,0x09,0x53,0x74, // um.Sectors:...St END
+	0x61,0x72,0x74,0x20,0x53,0x65,0x63,0x74,0x6F,0x72,0x3A,0x20,0x00,0x09,0x53,0x69, // art.Sector:...Si END
+	0x7A,0x65,0x3A,0x20,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x08,0x00,0x00,0x20,0x00, // ze:............. END
+	0x00,0x6B,0x62,0x00,0x6D,0x62,0x00,0x67,0x62,0x00,0x2F,0x00,0x00,0x00,0x00,0x01, // .kb.mb.gb./..... END
+	0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10, // .......d......'. END
+	0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00, // ......B@........ END
+	0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x0E,0x10,0x00,0x01,0x51,0x80, // ;......<......Q. END
+	0x77,0x35,0x94,0x00,0x08,0x08,0x08,0x08,0x08,0x07,0x07,0x07,0x06,0x06,0x06,0x06, // w5.............. END
+	0x05,0x05,0x05,0x04,0x04,0x04,0x03,0x03,0x03,0x03,0x02,0x02,0x02,0x01,0x01,0x01, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00, // ................ END
+	0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42, // d......'.......B END
+	0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0xFF,0xFF,0xFF, // @........;...... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF // ................ END
+};
+#endif
@@ -0,0 +1,220 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_usr_datalogger_H
+#define PROGMEM_usr_datalogger_H
+
+#include <stdint.h>
+
+#define PROGMEM_usr_dataloggerDATASIZE 3216u
+#define PROGMEM_usr_dataloggerCOMPRESSED 0
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_usr_dataloggerDATAPTR ((uint32_t)pgm_get_far_address(progmem_usr_dataloggerData))
+static const uint8_t progmem_usr_dataloggerData[PROGMEM_usr_dataloggerDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_usr_dataloggerDATAPTR ((uintptr_t)progmem_usr_dataloggerData)
+static const uint8_t progmem_usr_dataloggerData[PROGMEM_usr_dataloggerDATASIZE]={
+#endif
+	0x24,0xC8,0x08,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // $..U............ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x04,0xCD,0x4D,0x73,0x61,0x6D,0x70,0x6C,0x65,0x00,0x2F,0x2F,0xDE,0x80,0x88,0x83, // ..Msample.//.... END
+	0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x69,0xDD,0x03,0x02,0xFB,0x75,0x70,0xE1,0x80, // ...@.X.i....up.. END
+	0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x69,0xEE,0x40,0xD8,0x80,0x40,0xDD,0x02, // ....@.X.i.@..@.. END
+	0xC4,0xFB,0x75,0xE3,0x80,0x06,0x70,0xE1,0x80,0xD5,0x73,0xFB,0x75,0xD9,0x80,0x00, // ..u...p...s.u... END
+	0xE0,0x43,0xFA,0x41,0xE3,0x80,0x06,0xD5,0x7B,0xFB,0x75,0xD9,0x80,0x00,0xE0,0x45, // .C.A....{.u....E END
+	0xFA,0x41,0xD8,0x80,0x00,0xD5,0x9F,0xFB,0x75,0xD8,0x80,0x40,0xD9,0x80,0x00,0xA8, // .A......u..@.... END
+	0xDD,0x02,0x74,0xFB,0x75,0xD8,0x80,0x40,0xDD,0x02,0x23,0xFB,0x75,0x80,0xDD,0x02, // ..t.u..@..#.u... END
+	0xFE,0xFB,0x75,0xD8,0x04,0x61,0xDD,0x02,0x2B,0xFB,0x75,0xD7,0x63,0xEE,0x40,0xD8, // ..u..a..+.u.c.@. END
+	0x07,0x05,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x07,0x06,0xC1,0xFB,0xF4,0xEE,0xD2,0xEE, // ......@......... END
+	0x89,0xEE,0x40,0xD8,0x07,0x09,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x07,0x0A,0xC1,0xFB, // ..@.......@..... END
+	0xF4,0xEE,0x40,0xD8,0x03,0x02,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x03,0x04,0xC1,0xFB, // ..@.......@..... END
+	0xF4,0xEE,0x40,0xD8,0x80,0x80,0xDD,0x04,0x4E,0xFB,0x75,0xD8,0x80,0x80,0xD9,0x04, // ..@.....N.u..... END
+	0xBB,0xDD,0x03,0xE7,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xD7,0xEF,0xD8,0x80,0x84,0xD9, // .....u.......... END
+	0x80,0x80,0xDD,0x04,0x4E,0xFB,0x75,0xD8,0x80,0x84,0xD9,0x04,0xBB,0xDA,0x80,0x80, // ....N.u......... END
+	0xDD,0x04,0x12,0xFB,0x75,0xD8,0x80,0x84,0xDD,0x04,0x22,0xFB,0x75,0xDD,0x03,0x8C, // ....u.....".u... END
+	0xFB,0x75,0xD0,0x64,0xDD,0x02,0x52,0xFB,0x75,0xD8,0x80,0x80,0xD9,0x04,0xB7,0xDD, // .u.d..R.u....... END
+	0x03,0xE7,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xE1,0xEC,0xD8,0x80,0x84,0xD9,0x80,0x80, // ...u............ END
+	0xDD,0x04,0x4E,0xFB,0x75,0xD8,0x80,0x84,0xD9,0x04,0xB7,0xDA,0x80,0x80,0xDD,0x04, // ..N.u........... END
+	0x12,0xFB,0x75,0xD8,0x80,0x84,0xDD,0x04,0x22,0xFB,0x75,0xDD,0x03,0x8C,0xFB,0x75, // ..u.....".u....u END
+	0xD0,0x68,0xDD,0x02,0x52,0xFB,0x75,0xD8,0x80,0x80,0xD9,0x04,0xB3,0xDD,0x03,0xE7, // .h..R.u......... END
+	0xFB,0x75,0xF2,0x00,0xF8,0x08,0xE1,0xEC,0xD8,0x80,0x84,0xD9,0x80,0x80,0xDD,0x04, // .u.............. END
+	0x4E,0xFB,0x75,0xD8,0x80,0x84,0xD9,0x04,0xB3,0xDA,0x80,0x80,0xDD,0x04,0x12,0xFB, // N.u............. END
+	0x75,0xD8,0x80,0x84,0xDD,0x04,0x22,0xFB,0x75,0xDD,0x03,0x8C,0xFB,0x75,0xD0,0x6D, // u.....".u....u.m END
+	0xDD,0x02,0x52,0xFB,0x75,0xD8,0x80,0x80,0xDD,0x04,0x22,0xFB,0x75,0xDD,0x03,0x8C, // ..R.u.....".u... END
+	0xFB,0x75,0xD0,0x73,0xDD,0x02,0x52,0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8, // .u.s..R.u.....@. END
+	0x03,0x05,0xC1,0xFB,0xF4,0xFA,0x02,0xFB,0xF4,0xE0,0x01,0x00,0xFB,0xF4,0xE0,0x02, // ................ END
+	0x00,0xFB,0xF4,0xE0,0x03,0x00,0xFB,0xF4,0xE0,0x04,0x00,0xFB,0xF4,0xE0,0x05,0x00, // ................ END
+	0xFB,0xF4,0xFB,0x83,0xDD,0x01,0x94,0xFB,0x75,0x92,0xDD,0x03,0x85,0xFB,0x75,0xD0, // ........u.....u. END
+	0x2F,0xDD,0x02,0x52,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x8F,0xFB,0x75,0x92, // /..R.u.4......u. END
+	0xDD,0x03,0x85,0xFB,0x75,0xD0,0x2F,0xDD,0x02,0x52,0xFB,0x75,0xFA,0x34,0xFB,0x83, // ....u./..R.u.4.. END
+	0xDD,0x01,0x8B,0xFB,0x75,0x92,0xDD,0x03,0x85,0xFB,0x75,0xD0,0x20,0xDD,0x02,0x52, // ....u.....u....R END
+	0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x99,0xFB,0x75,0x92,0xDD,0x03,0x85,0xFB, // .u.4......u..... END
+	0x75,0xD0,0x3A,0xDD,0x02,0x52,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x01,0x9E,0xFB, // u.:..R.u.4...... END
+	0x75,0x92,0xDD,0x03,0x85,0xFB,0x75,0xD0,0x3A,0xDD,0x02,0x52,0xFB,0x75,0xFA,0x34, // u.....u.:..R.u.4 END
+	0xDD,0x01,0xA3,0xFB,0x75,0x92,0xDD,0x03,0x85,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0xD8, // ....u.....u...@. END
+	0x01,0x11,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70, // ......@.....@..p END
+	0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x04,0x54,0xFB,0x75,0xEF,0x00,0xD8, // ..........T.u... END
+	0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0, // .............@.. END
+	0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80, // ...@.........r.. END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2, // ...@............ END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40, // ...@...........@ END
+	0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x04,0x54,0xFB, // ..............T. END
+	0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x02,0x80,0xFB,0x75,0xFB,0xF4, // u.....t.4....u.. END
+	0xFB,0x83,0xFB,0x8B,0xDD,0x04,0x54,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4, // ......T.u...t.4. END
+	0x02,0xDD,0x02,0x8C,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42, // .....u.........B END
+	0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x02,0xBE, // ../............. END
+	0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x02,0x8C,0xFB,0x75,0xFA,0x34,0xFA, // .u.@.4......u.4. END
+	0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x04,0x85,0xDD,0x02,0xA6,0xFB,0x75,0xFA,0x74,0xFA, // t...........u.t. END
+	0x34,0xDD,0x02,0xA6,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0x80,0xC1,0x90,0x10,0xE2,0xAF, // 4....u...@...... END
+	0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA,0xE8, // ................ END
+	0x4B,0xE4,0x4A,0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1, // K.J............. END
+	0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x03,0x7C,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1, // .....8..|.d...8. END
+	0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1, // ......8.......8. END
+	0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA, // ..'......L..C... END
+	0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA, // .......L..C...d. END
+	0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6, // ....L..C........ END
+	0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE, // L..C...oA...B... END
+	0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85, // ..@....@........ END
+	0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x03,0x21,0xFB,0x75,0xFA, // p..r........!.u. END
+	0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80, // ........I.H..... END
+	0x06,0xDD,0x02,0x35,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2, // ...5.u........A. END
+	0x49,0xF8,0x58,0xE3,0xFE,0xFB,0x83,0xD0,0x2D,0xDD,0x02,0x52,0xFB,0x75,0xFA,0x34, // I.X.....-..R.u.4 END
+	0xFA,0x00,0xE0,0x00,0xDF,0x03,0x8C,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x40,0x80,0xFB, // ..........@..@.. END
+	0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x60,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81, // ....@..`......@. END
+	0xF8,0x68,0x80,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x06,0xC1,0xFB,0xF4,0xEE, // .h......@....... END
+	0xB6,0xE1,0x83,0xDD,0x04,0x12,0xFB,0x75,0xE3,0x83,0xFB,0xF4,0xEE,0xD2,0xEE,0x89, // .......u........ END
+	0xEE,0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4,0xFA,0x02,0xFB,0xF4,0xE0,0x01,0xFA,0x02, // .@.............. END
+	0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13,0x02, // ................ END
+	0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02,0xFB, // ................ END
+	0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xEE,0xC0, // ................ END
+	0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65, // .@.........usage END
+	0x3A,0x20,0x73,0x65,0x6E,0x73,0x6F,0x72,0x68,0x77,0x64,0x65,0x76,0x69,0x63,0x65, // :.sensorhwdevice END
+	0x73,0x6C,0x6F,0x74,0x20,0x64,0x61,0x74,0x61,0x66,0x69,0x6C,0x65,0x0A,0x00,0x2F, // slot.datafile../ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00, // ................ END
+	0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42, // d......'.......B END
+	0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00, // @........;...... END
+	0x3C,0x00,0x00,0x0E,0x10,0x00,0x01,0x51,0x80,0x77,0x35,0x94,0x00,0xFF,0xFF,0xFF, // <......Q.w5..... END
+	0x07,0x32,0x74,0x76,0x69,0x65,0x77,0x00,0x2F,0x2F,0xDE,0x80,0x98,0xD8,0x80,0x8B, // .2tview.//...... END
+	0x90,0x41,0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0xE9,0xEE,0x40,0xD8,0x80,0x40, // .A....@.X...@..@ END
+	0xDD,0x04,0x61,0xFB,0x75,0x83,0x92,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0xE9,0xEE,0x40, // ..a.u....@.X...@ END
+	0xD8,0x80,0x87,0xDD,0x01,0xBE,0xFB,0x75,0xD8,0x80,0x40,0x91,0xDD,0x03,0x96,0xFB, // .......u..@..... END
+	0x75,0x90,0xF2,0x41,0xF8,0x50,0xD7,0xF3,0xD9,0x80,0x8B,0x48,0xD8,0x80,0x87,0x93, // u..A.P.....H.... END
+	0xDD,0x01,0x66,0xFB,0x75,0xD8,0x80,0x8B,0x00,0xD9,0x80,0x87,0xDA,0x80,0x00,0xB8, // ..f.u........... END
+	0xDD,0x04,0x03,0xFB,0x75,0x98,0xF2,0x01,0xF8,0x00,0xD7,0xFD,0xD8,0x80,0x80,0xD9, // ....u........... END
+	0x80,0x00,0xDD,0x02,0xEC,0xFB,0x75,0xD8,0x80,0x80,0xDD,0x03,0x13,0xFB,0x75,0xD0, // ......u.......u. END
+	0x20,0xDD,0x03,0xC7,0xFB,0x75,0xD8,0x80,0x00,0xE0,0x03,0xFA,0x02,0xFB,0x83,0x9A, // .....u.......... END
+	0xEA,0x01,0xDD,0x05,0x06,0xFB,0x75,0xD0,0x2E,0xDD,0x03,0xC7,0xFB,0x75,0xFA,0x34, // ......u......u.4 END
+	0x9A,0xDD,0x04,0x11,0xFB,0x75,0xDD,0x05,0x06,0xFB,0x75,0xD0,0x43,0xDD,0x03,0xC7, // .....u....u.C... END
+	0xFB,0x75,0xD0,0x20,0xDD,0x03,0xC7,0xFB,0x75,0xD8,0x80,0x00,0xE0,0x05,0xFA,0x02, // .u......u....... END
+	0xFB,0x83,0x9A,0xEA,0x01,0xDD,0x05,0x06,0xFB,0x75,0xD0,0x2E,0xDD,0x03,0xC7,0xFB, // .........u...... END
+	0x75,0xFA,0x34,0x9A,0xDD,0x04,0x11,0xFB,0x75,0xDD,0x05,0x06,0xFB,0x75,0xD0,0x25, // u.4.....u....u.% END
+	0xDD,0x03,0xC7,0xFB,0x75,0x8A,0xDD,0x03,0xC7,0xFB,0x75,0x80,0xDD,0x04,0x19,0xFB, // ....u.....u..... END
+	0x75,0xD8,0x06,0x5B,0xDD,0x03,0xA0,0xFB,0x75,0xD7,0xE3,0xD8,0x06,0x76,0xDD,0x03, // u..[....u....v.. END
+	0xA0,0xFB,0x75,0xD7,0xE3,0xD8,0x06,0x90,0xDD,0x03,0xA0,0xFB,0x75,0xD7,0xE3,0x92, // ..u.........u... END
+	0xC0,0xA0,0xC0,0xEE,0xF6,0xD4,0x0C,0xE5,0xB4,0x71,0xE1,0x80,0xFB,0x93,0xFB,0x9B, // .........q...... END
+	0xEE,0x40,0xEE,0x1B,0xDD,0x01,0x71,0xFB,0x75,0xFA,0xB4,0xFA,0x74,0xE3,0x80,0x06, // .@....q.u...t... END
+	0xDD,0x03,0xAA,0xFB,0x75,0xD4,0x0C,0xE7,0xB4,0xFB,0xF4,0xFB,0x83,0xD0,0x7B,0xDD, // ....u.........{. END
+	0x03,0xC7,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x05,0x57,0xFB,0x75,0xDD,0x05,0x06, // ...u.4....W.u... END
+	0xFB,0x75,0xD0,0x2C,0xDD,0x03,0xC7,0xFB,0x75,0xFA,0x34,0xDD,0x05,0x5B,0xFB,0x75, // .u.,....u.4..[.u END
+	0xDD,0x05,0x06,0xFB,0x75,0xD0,0x7D,0xDD,0x03,0xC7,0xFB,0x75,0xFB,0xF4,0xFC,0x0E, // ....u.}....u.... END
+	0xFB,0xF4,0xA0,0xE6,0x51,0xFC,0x0E,0xFB,0xF4,0xFB,0x83,0xD8,0x80,0x8C,0xDD,0x06, // ....Q........... END
+	0x20,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xD8,0x80,0x8C,0xDD,0x05,0xB9,0xFB,0x75,0xE0, // ..u.4.........u. END
+	0x00,0xEE,0x40,0xFA,0x34,0xE4,0x01,0x90,0x41,0xE2,0x00,0xFB,0x83,0xD8,0x80,0x8C, // ..@.4...A....... END
+	0x9A,0xDD,0x05,0x6E,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xE0,0x6F,0x41,0xE2,0x00,0xFB, // ...n.u.@.4.oA... END
+	0x83,0xD8,0x80,0x8C,0xD9,0x06,0xFD,0xDD,0x06,0x26,0xFB,0x75,0xF2,0x40,0xFA,0x34, // .........&.u.@.4 END
+	0xF8,0x58,0xE3,0xE8,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0x90,0xDD,0x05,0xFA,0xFB,0x75, // .X.............u END
+	0xFA,0x74,0xFA,0x34,0x11,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xE9,0xB9,0xF2, // .t.4............ END
+	0xD3,0xF8,0xE8,0xE1,0xE2,0xFB,0x8B,0xFB,0x83,0x72,0xE1,0x80,0xD9,0x06,0xAB,0xDD, // .........r...... END
+	0x05,0xF6,0xFB,0x75,0xE3,0x80,0x0E,0xFA,0x34,0xFB,0x83,0xDD,0x05,0x66,0xFB,0x75, // ...u....4....f.u END
+	0xFA,0x34,0xFA,0x74,0xE0,0x40,0xE3,0xF3,0xFB,0xF4,0xEE,0x40,0xD8,0x03,0x02,0xC1, // .4.t.@.....@.... END
+	0xFB,0xF4,0xEE,0x40,0xD8,0x03,0x04,0xC1,0xFB,0xF4,0xEE,0x40,0xD8,0x80,0x90,0xDD, // ...@.......@.... END
+	0x06,0x20,0xFB,0x75,0xD8,0x80,0x90,0xD9,0x06,0xD7,0xDD,0x06,0x30,0xFB,0x75,0xF2, // ...u........0.u. END
+	0x00,0xF8,0x08,0xE1,0xEC,0xD8,0x80,0x94,0xD9,0x80,0x90,0xDD,0x06,0x20,0xFB,0x75, // ...............u END
+	0xD8,0x80,0x94,0xD9,0x06,0xD7,0xDA,0x80,0x90,0xDD,0x05,0x85,0xFB,0x75,0xD8,0x80, // .............u.. END
+	0x94,0xDD,0x05,0x5B,0xFB,0x75,0xDD,0x05,0x06,0xFB,0x75,0xD0,0x64,0xDD,0x03,0xC7, // ...[.u....u.d... END
+	0xFB,0x75,0xD8,0x80,0x90,0xD9,0x06,0xD3,0xDD,0x06,0x30,0xFB,0x75,0xF2,0x00,0xF8, // .u........0.u... END
+	0x08,0xE1,0xEC,0xD8,0x80,0x94,0xD9,0x80,0x90,0xDD,0x06,0x20,0xFB,0x75,0xD8,0x80, // .............u.. END
+	0x94,0xD9,0x06,0xD3,0xDA,0x80,0x90,0xDD,0x05,0x85,0xFB,0x75,0xD8,0x80,0x94,0xDD, // ...........u.... END
+	0x05,0x5B,0xFB,0x75,0xDD,0x05,0x06,0xFB,0x75,0xD0,0x68,0xDD,0x03,0xC7,0xFB,0x75, // .[.u....u.h....u END
+	0xD8,0x80,0x90,0xD9,0x06,0xCF,0xDD,0x06,0x30,0xFB,0x75,0xF2,0x00,0xF8,0x08,0xE1, // ........0.u..... END
+	0xEC,0xD8,0x80,0x94,0xD9,0x80,0x90,0xDD,0x06,0x20,0xFB,0x75,0xD8,0x80,0x94,0xD9, // ...........u.... END
+	0x06,0xCF,0xDA,0x80,0x90,0xDD,0x05,0x85,0xFB,0x75,0xD8,0x80,0x94,0xDD,0x05,0x5B, // .........u.....[ END
+	0xFB,0x75,0xDD,0x05,0x06,0xFB,0x75,0xD0,0x6D,0xDD,0x03,0xC7,0xFB,0x75,0xD8,0x80, // .u....u.m....u.. END
+	0x90,0xDD,0x05,0x5B,0xFB,0x75,0xDD,0x05,0x06,0xFB,0x75,0xD0,0x73,0xDD,0x03,0xC7, // ...[.u....u.s... END
+	0xFB,0x75,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x03,0x05,0xC1,0xFB,0xF4,0xFA,0x02, // .u.....@........ END
+	0xFB,0xF4,0xE0,0x01,0x00,0xFB,0xF4,0xE0,0x02,0x00,0xFB,0xF4,0xE0,0x03,0x00,0xFB, // ................ END
+	0xF4,0xE0,0x04,0x00,0xFB,0xF4,0xE0,0x05,0x00,0xFB,0xF4,0xFB,0x83,0xDD,0x02,0xFF, // ................ END
+	0xFB,0x75,0x92,0xDD,0x04,0xFF,0xFB,0x75,0xD0,0x2F,0xDD,0x03,0xC7,0xFB,0x75,0xFA, // .u.....u./....u. END
+	0x34,0xFB,0x83,0xDD,0x02,0xFA,0xFB,0x75,0x92,0xDD,0x04,0xFF,0xFB,0x75,0xD0,0x2F, // 4......u.....u./ END
+	0xDD,0x03,0xC7,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x02,0xF6,0xFB,0x75,0x92,0xDD, // ....u.4......u.. END
+	0x04,0xFF,0xFB,0x75,0xD0,0x20,0xDD,0x03,0xC7,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD, // ...u......u.4... END
+	0x03,0x04,0xFB,0x75,0x92,0xDD,0x04,0xFF,0xFB,0x75,0xD0,0x3A,0xDD,0x03,0xC7,0xFB, // ...u.....u.:.... END
+	0x75,0xFA,0x34,0xFB,0x83,0xDD,0x03,0x09,0xFB,0x75,0x92,0xDD,0x04,0xFF,0xFB,0x75, // u.4......u.....u END
+	0xD0,0x3A,0xDD,0x03,0xC7,0xFB,0x75,0xFA,0x34,0xDD,0x03,0x0E,0xFB,0x75,0x92,0xDD, // .:....u.4....u.. END
+	0x04,0xFF,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0xD8,0x01,0x03,0xC1,0xFB,0xF4,0xEE,0x89, // ...u...@........ END
+	0xEE,0x40,0xD8,0x01,0x02,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40, // .@.......@.....@ END
+	0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x06,0x44,0xFB,0x75, // ..p..........D.u END
+	0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE, // ................ END
+	0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6, // @.....@......... END
+	0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB, // r.....@......... END
+	0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEF,0x1B,0xEE, // ......@......... END
+	0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00,0xC1,0xFB,0xF4,0xEF,0x1B,0xEE,0xD2,0xEE, // ....@........... END
+	0x89,0xEE,0x40,0xD8,0x01,0x0C,0xC1,0xFB,0xF4,0xEA,0x81,0xE8,0x91,0xE6,0x02,0xFB, // ..@............. END
+	0xF4,0xEE,0x40,0x80,0xC1,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB, // ..@.......@..... END
+	0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x06,0x44,0xFB,0x75,0xEE,0x80,0xE0,0x80, // .........D.u.... END
+	0xFA,0x74,0xFA,0x34,0xDD,0x04,0x1D,0xFB,0x75,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD, // .t.4....u....... END
+	0x06,0x44,0xFB,0x75,0xEE,0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x04,0x29,0xFB, // .D.u...t.4....). END
+	0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4,0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93, // u.........B../.. END
+	0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD,0x04,0x5B,0xFB,0x75,0xEE,0x40,0xFA, // ..........[.u.@. END
+	0x34,0xFB,0x83,0xDD,0x04,0x29,0xFB,0x75,0xFA,0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B, // 4....).u.4.t.... END
+	0xD9,0x06,0xDF,0xDD,0x04,0x43,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xDD,0x04,0x43,0xFB, // .....C.u.t.4..C. END
+	0x75,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x04, // u............8.. END
+	0xF6,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1, // ..d...8.......8. END
+	0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A, // ......8...'..... END
+	0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C, // .L..C..........L END
+	0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43, // ..C...d.....L..C END
+	0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F, // ........L..C...o END
+	0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40, // A...B.....@....@ END
+	0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B, // ........p..r.... END
+	0xEE,0x1B,0xDD,0x04,0x9B,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2, // ......u......... END
+	0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xDD,0x03,0xAA,0xFB,0x75,0xE3,0x85, // I.H..........u.. END
+	0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFE,0xFB,0x83,0xD0, // ......A.I.X..... END
+	0x2D,0xDD,0x03,0xC7,0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x05,0x06,0xFA, // -....u.4........ END
+	0x02,0xFB,0xF4,0xE0,0x01,0xFA,0x02,0xFB,0xF4,0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08, // ................ END
+	0xFB,0xF4,0xFC,0x09,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x08,0x06,0xC1,0xFB,0xF4, // .........@...... END
+	0xEE,0xB6,0xE1,0x83,0xDD,0x05,0x85,0xFB,0x75,0xE3,0x83,0xFB,0xF4,0xEE,0xD2,0xEE, // ........u....... END
+	0x89,0xEE,0x40,0xD8,0x08,0x07,0xC1,0xFB,0xF4,0xEE,0x40,0xFA,0x0A,0xFA,0x07,0xD2, // ..@.......@..... END
+	0x10,0xF2,0x82,0xF8,0x80,0xFB,0xF4,0xFE,0x0A,0x02,0xFA,0x07,0xE0,0x0F,0xFB,0xF4, // ................ END
+	0xDD,0x05,0x91,0xFB,0x75,0xD1,0x1F,0xF2,0x81,0xF8,0xA8,0xE2,0x00,0xE6,0x08,0xFB, // ....u........... END
+	0xF4,0xFB,0x83,0xDD,0x05,0x91,0xFB,0x75,0xD9,0x06,0xE1,0xE4,0x01,0x10,0xFA,0x34, // .......u.......4 END
+	0x72,0xE1,0x80,0xFB,0x83,0xEE,0x12,0xE0,0x00,0xDD,0x06,0x51,0xFB,0x75,0xFA,0x74, // r..........Q.u.t END
+	0xDD,0x06,0x3A,0xFB,0x75,0xE3,0x80,0x0E,0xE4,0x01,0xFB,0xF4,0xFB,0x83,0xFB,0x93, // ..:.u........... END
+	0xDD,0x05,0xFA,0xFB,0x75,0xFA,0x74,0xFA,0x34,0xC0,0xFC,0x0C,0xFB,0xF4,0xFC,0x0D, // ....u.t.4....... END
+	0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13,0x02, // ................ END
+	0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02,0xFB, // ................ END
+	0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xFC,0x0F, // ................ END
+	0xEE,0x40,0x81,0xF8,0x40,0x80,0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x60,0x80, // .@..@......@..`. END
+	0xFB,0xF4,0xFC,0x0F,0xEE,0x40,0x81,0xF8,0x68,0x80,0xFB,0xF4,0xEE,0xC0,0xEE,0x40, // .....@..h......@ END
+	0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0x94,0xE8,0x01,0xD9,0x07,0x02,0xE4, // ................ END
+	0x01,0xFB,0xF4,0x75,0x73,0x61,0x67,0x65,0x3A,0x20,0x64,0x61,0x74,0x61,0x66,0x69, // ...usage:.datafi END
+	0x6C,0x65,0x20,0x73,0x61,0x6D,0x70,0x6C,0x65,0x6E,0x75,0x6D,0x0A,0x00,0x43,0x6F, // le.samplenum..Co END
+	0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x6F,0x70,0x65,0x6E,0x20,0x64,0x61,0x74, // uld.not.open.dat END
+	0x61,0x20,0x66,0x69,0x6C,0x65,0x0A,0x00,0x43,0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F, // a.file..Could.no END
+	0x74,0x20,0x72,0x65,0x61,0x64,0x20,0x73,0x61,0x6D,0x70,0x6C,0x65,0x0A,0x00,0x00, // t.read.sample... END
+	0x00,0x00,0x01,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00,0x03,0xE8,0x00, // ..........d..... END
+	0x00,0x27,0x10,0x00,0x01,0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98,0x96,0x80,0x05, // .'.......B@..... END
+	0xF5,0xE1,0x00,0x3B,0x9A,0xCA,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x0E,0x10,0x00, // ...;......<..... END
+	0x01,0x51,0x80,0x77,0x35,0x94,0x00,0x2F,0x00,0x08,0x08,0x08,0x08,0x08,0x07,0x07, // .Q.w5../........ END
+	0x07,0x06,0x06,0x06,0x06,0x05,0x05,0x05,0x04,0x04,0x04,0x03,0x03,0x03,0x03,0x02, // ................ END
+	0x02,0x02,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00, // ................ END
+	0x00,0x0A,0x00,0x00,0x00,0x64,0x00,0x00,0x03,0xE8,0x00,0x00,0x27,0x10,0x00,0x01, // .....d......'... END
+	0x86,0xA0,0x00,0x0F,0x42,0x40,0x00,0x98,0x96,0x80,0x05,0xF5,0xE1,0x00,0x3B,0x9A, // ....B@........;. END
+	0xCA,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF // ................ END
+};
+#endif
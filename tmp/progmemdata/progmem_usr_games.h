@@ -0,0 +1,567 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_usr_games_H
+#define PROGMEM_usr_games_H
+
+#include <stdint.h>
+
+#define PROGMEM_usr_gamesDATASIZE 8768u
+#define PROGMEM_usr_gamesCOMPRESSED 0
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_usr_gamesDATAPTR ((uint32_t)pgm_get_far_address(progmem_usr_gamesData))
+static const uint8_t progmem_usr_gamesData[PROGMEM_usr_gamesDATASIZE] PROGMEM ={
+#else
+#define PROGMEM_usr_gamesDATAPTR ((uintptr_t)progmem_usr_gamesData)
+static const uint8_t progmem_usr_gamesData[PROGMEM_usr_gamesDATASIZE]={
+#endif
+	0x26,0x88,0x02,0x05,0x07,0x19,0x1C,0x20,0x22,0x25,0x5E,0x00,0x00,0x00,0x00,0x00, // &......."%^..... END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0xBE,0x03,0x74,0x67,0x62,0x6D,0x35,0x2E,0x73,0x6F,0x6B,0x00,0x20,0x23,0x23, // ...tgbm5.sok..## END
+	0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x0A,0x20,0x23,0x2E,0x2E,0x20,0x2E,0x2E, // ########..#..... END
+	0x2E,0x2E,0x2E,0x23,0x0A,0x20,0x23,0x40,0x24,0x20,0x20,0x23,0x20,0x23,0x23,0x23, // ...#..#@$..#.### END
+	0x0A,0x20,0x23,0x23,0x23,0x23,0x24,0x23,0x20,0x20,0x23,0x23,0x0A,0x20,0x23,0x23, // ..####$#..##..## END
+	0x23,0x23,0x20,0x23,0x23,0x20,0x20,0x23,0x23,0x23,0x23,0x0A,0x20,0x23,0x20,0x24, // ##.##..####..#.$ END
+	0x20,0x20,0x20,0x23,0x23,0x24,0x23,0x20,0x20,0x23,0x0A,0x20,0x23,0x20,0x20,0x20, // ...##$#..#..#... END
+	0x20,0x20,0x23,0x20,0x20,0x23,0x20,0x20,0x23,0x0A,0x23,0x23,0x24,0x24,0x23,0x23, // ..#..#..#.##$$## END
+	0x23,0x23,0x24,0x20,0x20,0x20,0x20,0x23,0x0A,0x23,0x20,0x20,0x20,0x24,0x2E,0x2E, // ##$....#.#...$.. END
+	0x20,0x20,0x20,0x20,0x20,0x23,0x0A,0x23,0x20,0x20,0x20,0x23,0x23,0x24,0x23,0x20, // .....#.#...##$#. END
+	0x20,0x20,0x23,0x23,0x0A,0x23,0x23,0x23,0x23,0x23,0x20,0x20,0x23,0x23,0x23,0x23, // ..##.#####..#### END
+	0x23,0x0A,0x20,0x20,0x20,0x20,0x23,0x20,0x20,0x23,0x0A,0x20,0x20,0x20,0x20,0x23, // #.....#..#.....# END
+	0x20,0x20,0x23,0x0A,0x20,0x20,0x20,0x20,0x23,0x23,0x23,0x23,0x0A,0x0A,0xFF,0xFF, // ..#.....####.... END
+	0x00,0x76,0x02,0x74,0x67,0x62,0x6D,0x36,0x2E,0x73,0x6F,0x6B,0x00,0x23,0x23,0x23, // .v.tgbm6.sok.### END
+	0x23,0x23,0x23,0x0A,0x23,0x20,0x20,0x20,0x20,0x23,0x0A,0x23,0x20,0x23,0x23,0x20, // ###.#....#.#.##. END
+	0x23,0x23,0x23,0x23,0x0A,0x23,0x20,0x23,0x23,0x20,0x20,0x20,0x20,0x23,0x0A,0x23, // ####.#.##....#.# END
+	0x20,0x23,0x23,0x24,0x23,0x23,0x20,0x23,0x0A,0x23,0x20,0x23,0x2E,0x20,0x2E,0x23, // .##$##.#.#.#...# END
+	0x20,0x23,0x0A,0x23,0x2E,0x20,0x24,0x40,0x20,0x24,0x20,0x23,0x0A,0x23,0x23,0x23, // .#.#..$@.$.#.### END
+	0x20,0x20,0x2E,0x23,0x20,0x23,0x0A,0x20,0x20,0x23,0x23,0x24,0x23,0x23,0x20,0x23, // ...#.#...##$##.# END
+	0x0A,0x20,0x20,0x20,0x23,0x20,0x20,0x20,0x20,0x23,0x0A,0x20,0x20,0x20,0x23,0x23, // ....#....#....## END
+	0x23,0x23,0x23,0x23,0x0A,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ####............ END
+	0x04,0x6F,0x12,0x68,0x69,0x67,0x68,0x6C,0x6F,0x77,0x00,0x2F,0x2F,0xDE,0x80,0x11, // .o.highlow.//... END
+	0xD8,0x04,0x00,0x93,0xAD,0xC1,0xD7,0x10,0x80,0x91,0xC1,0xD8,0x80,0x04,0x90,0x41, // ...............A END
+	0xD8,0x03,0x69,0xDD,0x01,0x95,0xFB,0x75,0xD8,0x80,0x05,0x98,0xD5,0xD3,0xFB,0x75, // ..i....u.......u END
+	0xD8,0x80,0x05,0xDD,0x02,0xFC,0xFB,0x75,0xD9,0x80,0x00,0xFA,0x41,0x92,0xF2,0x41, // .......u....A..A END
+	0xF8,0x78,0xD7,0xC9,0xD8,0x03,0xBE,0xDD,0x01,0x95,0xFB,0x75,0xD8,0x80,0x00,0xFA, // .x.........u.... END
+	0x02,0xDD,0x02,0x55,0xFB,0x75,0xD8,0x03,0xBB,0xDD,0x01,0x95,0xFB,0x75,0xD8,0x80, // ...U.u.......u.. END
+	0x00,0xFA,0x02,0xDD,0x02,0xEC,0xFB,0x75,0xE0,0x00,0xD9,0x80,0x02,0xFA,0x41,0xD8, // .......u......A. END
+	0x80,0x04,0x08,0xE0,0x40,0x41,0xD8,0x03,0xEE,0xDD,0x01,0x95,0xFB,0x75,0xD8,0x80, // ....@A.......u.. END
+	0x04,0x00,0xDD,0x02,0x55,0xFB,0x75,0xD8,0x03,0xF7,0xDD,0x01,0x95,0xFB,0x75,0xD8, // ....U.u.......u. END
+	0x80,0x05,0x98,0xD5,0xD3,0xFB,0x75,0xD8,0x80,0x05,0xDD,0x02,0xFC,0xFB,0x75,0xD9, // ......u.......u. END
+	0x80,0x02,0xFA,0x4A,0xF2,0x81,0xF8,0x90,0xD7,0xA5,0xF8,0xB0,0xD7,0xAF,0xD7,0xB9, // ...J............ END
+	0xD8,0x04,0x0C,0xDD,0x01,0x95,0xFB,0x75,0xD7,0xC3,0xD8,0x04,0x24,0xDD,0x01,0x95, // .......u....$... END
+	0xFB,0x75,0xD7,0x64,0xD8,0x04,0x3D,0xDD,0x01,0x95,0xFB,0x75,0xD7,0x64,0x80,0xDD, // .u.d..=....u.d.. END
+	0x02,0xA6,0xFB,0x75,0xD8,0x03,0x7F,0xDD,0x01,0x95,0xFB,0x75,0xD7,0xC3,0xEE,0x80, // ...u.......u.... END
+	0xEE,0xC9,0x81,0x90,0xC0,0xFB,0x93,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00, // ............@... END
+	0xD4,0x01,0xC1,0xF8,0x00,0xD7,0xFA,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xD7, // .......#........ END
+	0xFA,0xE0,0x80,0xD7,0xE2,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4,0x70,0xE1,0x80, // ......X.4....p.. END
+	0xFB,0x93,0xFB,0x9B,0xD8,0x80,0x0D,0xDD,0x03,0x4E,0xFB,0x75,0xFA,0xF4,0xFA,0xB4, // .........N.u.... END
+	0xE3,0x80,0x06,0xFB,0x93,0xEE,0xD2,0xEE,0x40,0xD8,0x01,0x0C,0xDA,0x80,0x0D,0xD4, // ........@....... END
+	0x01,0xC1,0xF8,0x00,0xE1,0xE1,0x23,0xE0,0xC0,0x8A,0xF2,0x20,0xF8,0x10,0xE1,0xD7, // ......#......... END
+	0x71,0xE1,0x80,0xFB,0x93,0xFB,0x9B,0xD8,0x80,0x0D,0xDD,0x03,0x1B,0xFB,0x75,0xFA, // q.............u. END
+	0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xE3,0xEE,0x80,0x58,0xFB,0x34,0xE6,0x1C,0xFB,0xF4, // .........X.4.... END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00, // ...@............ END
+	0xF8,0x08,0xE1,0xC6,0xE3,0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4, // ................ END
+	0xEE,0x89,0xEE,0x40,0xD8,0x01,0x0C,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1,0xF2,0x00, // ...@............ END
+	0xF8,0x08,0xE1,0xC6,0xE3,0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06,0xFB,0xF4, // ................ END
+	0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB, // .@.....@..p..... END
+	0x93,0xEE,0x12,0xDD,0x03,0x54,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA, // .....T.u........ END
+	0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82, // ........@.....@. END
+	0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE,0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8, // ........r.....@. END
+	0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8, // ..............@. END
+	0x01,0x10,0xC1,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38, // ...............8 END
+	0xDF,0x02,0x45,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9, // ..E.d...8....... END
+	0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA, // 8.......8...'... END
+	0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A, // ...L..C......... END
+	0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0, // .L..C...d.....L. END
+	0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00, // .C........L..C.. END
+	0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5, // .oA...B.....@... END
+	0xEE,0x40,0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80, // .@........p..r.. END
+	0xFB,0x9B,0xEE,0x1B,0xDD,0x01,0xEA,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6, // ........u....... END
+	0xD9,0xF2,0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xDD,0x01,0x9F,0xFB,0x75, // ..I.H..........u END
+	0xE3,0x85,0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFE,0xFB, // ........A.I.X... END
+	0x83,0xD0,0x2D,0xDD,0x01,0xBC,0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x02, // ..-....u.4...... END
+	0x55,0xEE,0x40,0x80,0xC1,0xD8,0x01,0x02,0xD9,0x04,0x57,0xA1,0xC1,0xF2,0x40,0xF8, // U.@.......W...@. END
+	0x58,0xE1,0xD9,0x70,0xE1,0x80,0x90,0xDD,0x01,0x55,0xFB,0x75,0xEE,0x80,0xD8,0x01, // X..p.....U.u.... END
+	0x03,0xE3,0x80,0x0E,0xC1,0xEE,0x12,0xD1,0xFF,0xF0,0x01,0xFB,0xF4,0x80,0xFB,0xF4, // ................ END
+	0xDD,0x02,0xAA,0xFB,0x75,0x70,0xE1,0x80,0xDD,0x02,0xAA,0xFB,0x75,0xE3,0x80,0x0E, // ....up......u... END
+	0xA8,0xF4,0x02,0xEE,0x01,0xFB,0xF4,0xFB,0x83,0xDD,0x02,0xD5,0xFB,0x75,0xFA,0x74, // .............u.t END
+	0xDD,0x03,0x61,0xFB,0x75,0xFB,0xF4,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8, // ..a.u........... END
+	0xE1,0xCF,0xB9,0xF2,0xD3,0xF8,0xE8,0xE1,0xC8,0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00, // ...........K.J.. END
+	0xE3,0xD9,0xEE,0x09,0xFB,0xF4,0x91,0xFC,0x08,0xFB,0xF4,0xFC,0x08,0xFB,0xF4,0xFC, // ................ END
+	0x09,0xFB,0xF4,0xA0,0xFA,0x11,0xFE,0x0B,0x02,0xFB,0xF4,0xFA,0x09,0xA0,0xFE,0x13, // ................ END
+	0x02,0xFB,0xF4,0xD3,0x10,0xE6,0xDA,0xF6,0xCB,0xFA,0x19,0xF4,0xCA,0xFE,0x1B,0x02, // ................ END
+	0xFB,0xF4,0xFA,0x09,0xFE,0x13,0x02,0xFB,0xF4,0xA4,0xFE,0x0C,0x02,0xFB,0xF4,0xEE, // ................ END
+	0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xEA,0x81,0xE8,0x91, // ..@............. END
+	0xE6,0x02,0xFB,0xF4,0x45,0x6E,0x74,0x65,0x72,0x20,0x6D,0x61,0x78,0x69,0x6D,0x75, // ....Enter.maximu END
+	0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x3A,0x20,0x00,0x42,0x61,0x64,0x20,0x6D,0x61, // m.value:..Bad.ma END
+	0x78,0x69,0x6D,0x75,0x6D,0x20,0x76,0x61,0x6C,0x75,0x65,0x20,0x2D,0x20,0x70,0x6C, // ximum.value.-.pl END
+	0x65,0x61,0x73,0x65,0x20,0x65,0x6E,0x74,0x65,0x72,0x20,0x61,0x6E,0x20,0x69,0x6E, // ease.enter.an.in END
+	0x74,0x65,0x67,0x65,0x72,0x20,0x67,0x72,0x65,0x61,0x74,0x65,0x72,0x20,0x74,0x68, // teger.greater.th END
+	0x61,0x6E,0x20,0x6F,0x6E,0x65,0x2E,0x0A,0x00,0x49,0x20,0x68,0x61,0x76,0x65,0x20, // an.one...I.have. END
+	0x61,0x20,0x63,0x68,0x6F,0x73,0x65,0x6E,0x20,0x61,0x20,0x72,0x61,0x6E,0x64,0x6F, // a.chosen.a.rando END
+	0x6D,0x20,0x69,0x6E,0x74,0x65,0x67,0x65,0x72,0x20,0x62,0x65,0x74,0x77,0x65,0x65, // m.integer.betwee END
+	0x6E,0x20,0x31,0x20,0x61,0x6E,0x64,0x20,0x00,0x41,0x74,0x74,0x65,0x6D,0x70,0x74, // n.1.and..Attempt END
+	0x20,0x00,0x2C,0x20,0x65,0x6E,0x74,0x65,0x72,0x20,0x79,0x6F,0x75,0x72,0x20,0x67, // ..,.enter.your.g END
+	0x75,0x65,0x73,0x73,0x3A,0x20,0x00,0x59,0x6F,0x75,0x20,0x67,0x75,0x65,0x73,0x73, // uess:..You.guess END
+	0x65,0x64,0x20,0x63,0x6F,0x72,0x72,0x65,0x63,0x74,0x6C,0x79,0x21,0x0A,0x00,0x59, // ed.correctly!..Y END
+	0x6F,0x75,0x72,0x20,0x67,0x75,0x65,0x73,0x73,0x20,0x77,0x61,0x73,0x20,0x74,0x6F, // our.guess.was.to END
+	0x6F,0x20,0x6C,0x6F,0x77,0x2E,0x0A,0x00,0x59,0x6F,0x75,0x72,0x20,0x67,0x75,0x65, // o.low...Your.gue END
+	0x73,0x73,0x20,0x77,0x61,0x73,0x20,0x74,0x6F,0x6F,0x20,0x68,0x69,0x67,0x68,0x2E, // ss.was.too.high. END
+	0x0A,0x00,0x2F,0x64,0x65,0x76,0x2F,0x75,0x72,0x61,0x6E,0x64,0x6F,0x6D,0x00,0xFF, // ../dev/urandom.. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x87,0x03,0x74,0x67,0x62,0x6D,0x32,0x2E,0x73,0x6F,0x6B,0x00,0x20,0x20,0x20, // ...tgbm2.sok.... END
+	0x20,0x20,0x23,0x23,0x23,0x23,0x0A,0x23,0x23,0x23,0x23,0x23,0x23,0x20,0x20,0x23, // ..####.######..# END
+	0x23,0x0A,0x23,0x20,0x20,0x20,0x23,0x20,0x20,0x20,0x20,0x23,0x0A,0x23,0x20,0x24, // #.#...#....#.#.$ END
+	0x20,0x23,0x23,0x20,0x24,0x20,0x23,0x0A,0x23,0x20,0x20,0x20,0x20,0x2E,0x2E,0x23, // .##.$.#.#......# END
+	0x23,0x23,0x0A,0x23,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x23,0x0A,0x20, // ##.##.#.#.#.##.. END
+	0x23,0x23,0x23,0x2E,0x2E,0x20,0x20,0x20,0x20,0x23,0x0A,0x20,0x23,0x20,0x24,0x20, // ###......#..#.$. END
+	0x23,0x23,0x24,0x20,0x20,0x23,0x0A,0x20,0x23,0x20,0x20,0x20,0x20,0x23,0x20,0x20, // ##$..#..#....#.. END
+	0x40,0x23,0x0A,0x20,0x23,0x23,0x20,0x20,0x23,0x23,0x23,0x23,0x23,0x23,0x0A,0x20, // @#..##..######.. END
+	0x20,0x23,0x23,0x23,0x23,0x0A,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // .####........... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0xCD,0x04,0x74,0x67,0x62,0x6D,0x33,0x2E,0x73,0x6F,0x6B,0x00,0x20,0x20,0x20, // ...tgbm3.sok.... END
+	0x20,0x20,0x20,0x23,0x23,0x23,0x0A,0x20,0x23,0x23,0x23,0x23,0x23,0x23,0x2E,0x23, // ...###..######.# END
+	0x23,0x23,0x23,0x23,0x0A,0x20,0x23,0x20,0x40,0x20,0x23,0x20,0x2E,0x2E,0x2E,0x2E, // ####..#.@.#..... END
+	0x2E,0x23,0x0A,0x20,0x23,0x20,0x20,0x20,0x20,0x20,0x2E,0x2E,0x2E,0x2E,0x2E,0x23, // .#..#..........# END
+	0x0A,0x20,0x23,0x23,0x23,0x23,0x23,0x2E,0x2E,0x2E,0x2E,0x23,0x23,0x23,0x0A,0x20, // ..#####....###.. END
+	0x20,0x23,0x20,0x20,0x23,0x23,0x24,0x23,0x23,0x23,0x23,0x0A,0x20,0x20,0x23,0x20, // .#..##$####...#. END
+	0x20,0x20,0x24,0x20,0x24,0x20,0x20,0x23,0x0A,0x20,0x20,0x23,0x24,0x20,0x20,0x23, // ..$.$..#...#$..# END
+	0x20,0x20,0x20,0x20,0x23,0x0A,0x20,0x20,0x23,0x20,0x24,0x20,0x23,0x20,0x24,0x24, // ....#...#.$.#.$$ END
+	0x24,0x23,0x0A,0x23,0x23,0x23,0x20,0x20,0x20,0x23,0x24,0x20,0x20,0x20,0x23,0x0A, // $#.###...#$...#. END
+	0x23,0x20,0x20,0x24,0x24,0x24,0x23,0x20,0x24,0x20,0x24,0x23,0x23,0x23,0x0A,0x23, // #..$$$#.$.$###.# END
+	0x20,0x20,0x20,0x20,0x20,0x24,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x0A,0x23,0x23, // .....$......#.## END
+	0x23,0x23,0x23,0x23,0x23,0x20,0x20,0x20,0x20,0x20,0x20,0x23,0x0A,0x20,0x20,0x20, // #####......#.... END
+	0x20,0x20,0x20,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x0A,0x0A,0xFF,0xFF,0xFF, // ...########..... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x49,0x02,0x74,0x67,0x62,0x6D,0x34,0x2E,0x73,0x6F,0x6B,0x00,0x20,0x20,0x23, // .I.tgbm4.sok...# END
+	0x23,0x23,0x23,0x0A,0x20,0x20,0x23,0x20,0x20,0x23,0x0A,0x23,0x23,0x23,0x24,0x20, // ###...#..#.###$. END
+	0x23,0x23,0x0A,0x23,0x20,0x24,0x20,0x20,0x40,0x23,0x0A,0x23,0x20,0x2E,0x2E,0x2E, // ##.#.$..@#.#.... END
+	0x20,0x23,0x0A,0x23,0x23,0x24,0x20,0x20,0x23,0x23,0x0A,0x20,0x23,0x20,0x20,0x23, // .#.##$..##..#..# END
+	0x23,0x0A,0x20,0x23,0x23,0x23,0x23,0x0A,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // #..####......... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x00,0x95,0x03,0x74,0x67,0x62,0x6D,0x31,0x2E,0x73,0x6F,0x6B,0x00,0x23,0x23,0x23, // ...tgbm1.sok.### END
+	0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x23,0x0A,0x23,0x20,0x20,0x20, // ###########.#... END
+	0x20,0x20,0x23,0x23,0x20,0x20,0x20,0x20,0x20,0x23,0x0A,0x23,0x20,0x24,0x24,0x20, // ..##.....#.#.$$. END
+	0x20,0x23,0x23,0x20,0x24,0x24,0x24,0x20,0x23,0x0A,0x23,0x20,0x20,0x24,0x20,0x20, // .##.$$$.#.#..$.. END
+	0x23,0x23,0x20,0x20,0x20,0x20,0x20,0x23,0x0A,0x23,0x23,0x20,0x23,0x23,0x20,0x23, // ##.....#.##.##.# END
+	0x23,0x20,0x23,0x23,0x20,0x23,0x23,0x0A,0x23,0x20,0x20,0x20,0x23,0x23,0x23,0x23, // #.##.##.#...#### END
+	0x23,0x23,0x20,0x20,0x20,0x23,0x0A,0x23,0x20,0x2E,0x2E,0x2E,0x20,0x40,0x20,0x2E, // ##...#.#.....@.. END
+	0x2E,0x2E,0x20,0x20,0x23,0x0A,0x23,0x20,0x20,0x23,0x23,0x23,0x23,0x23,0x23,0x23, // ....#.#..####### END
+	0x23,0x20,0x20,0x23,0x0A,0x23,0x23,0x23,0x23,0x20,0x20,0x20,0x20,0x20,0x20,0x23, // #..#.####......# END
+	0x23,0x23,0x23,0x0A,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ###............. END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // ................ END
+	0x0E,0x3D,0x39,0x63,0x68,0x65,0x73,0x73,0x00,0x2F,0x2F,0xDE,0x80,0x92,0xD7,0x09, // .=9chess.//..... END
+	0xD7,0x1F,0xD8,0x04,0x00,0x93,0xA7,0xC1,0x80,0xDD,0x03,0x0F,0xFB,0x75,0xD5,0x30, // .............u.0 END
+	0xFB,0x75,0xD5,0x41,0xFB,0x75,0xD7,0x19,0x81,0xDD,0x03,0x0F,0xFB,0x75,0xDD,0x02, // .u.A.u.......u.. END
+	0xBE,0xFB,0x75,0x80,0xDD,0x05,0x74,0xFB,0x75,0xDD,0x02,0xD7,0xFB,0x75,0xDD,0x07, // ..u...t.u....u.. END
+	0xBA,0xFB,0x75,0xDD,0x08,0x1C,0xFB,0x75,0xFB,0xF4,0x80,0x9B,0xDD,0x03,0x1E,0xFB, // ..u....u........ END
+	0x75,0xDD,0x02,0xE1,0xFB,0x75,0xD8,0x0B,0x46,0xDD,0x03,0xF9,0xFB,0x75,0x80,0x9A, // u....u..F....u.. END
+	0xDD,0x03,0x1E,0xFB,0x75,0xDD,0x02,0xE1,0xFB,0x75,0xD8,0x0B,0x36,0xDD,0x03,0xF9, // ....u....u..6... END
+	0xFB,0x75,0x8F,0x9A,0xDD,0x03,0x1E,0xFB,0x75,0xDD,0x03,0x96,0xFB,0x75,0xD9,0x01, // .u......u....u.. END
+	0x00,0xF2,0x41,0xF8,0x50,0xD7,0x70,0x70,0xE1,0x80,0xDD,0x02,0x84,0xFB,0x75,0xE3, // ..A.P.pp......u. END
+	0x80,0x06,0xD1,0x63,0xF2,0x41,0xF8,0x50,0xD7,0xD9,0xD1,0x6D,0xF2,0x41,0xF8,0x50, // ...c.A.P...m.A.P END
+	0xDF,0x01,0x12,0xD1,0x6C,0xF2,0x41,0xF8,0x50,0xDF,0x01,0x2D,0xD1,0x70,0xF2,0x41, // ....l.A.P..-.p.A END
+	0xF8,0x50,0xDF,0x01,0x43,0xD1,0x71,0xF2,0x41,0xF8,0x50,0xD7,0x1F,0xD1,0x72,0xF2, // .P..C.q.A.P...r. END
+	0x41,0xF8,0x50,0xDF,0x02,0x07,0x70,0xE1,0x80,0x80,0x9C,0xDD,0x03,0x1E,0xFB,0x75, // A.P...p........u END
+	0xD8,0x0B,0x9B,0xDD,0x03,0xF9,0xFB,0x75,0xE3,0x80,0x06,0xDD,0x04,0x21,0xFB,0x75, // .......u.....!.u END
+	0xD7,0x69,0xDD,0x08,0xCB,0xFB,0x75,0xFB,0x83,0x80,0x9C,0xDD,0x03,0x1E,0xFB,0x75, // .i....u........u END
+	0xD8,0x0C,0x02,0xDD,0x03,0xF9,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x06,0x6A,0xFB, // .......u.4....j. END
+	0x75,0xFA,0x34,0x90,0xF2,0x41,0xF8,0x50,0xE1,0xC6,0xDD,0x05,0xA6,0xFB,0x75,0xFB, // u.4..A.P......u. END
+	0xF4,0xD8,0x0C,0x12,0xDD,0x03,0xF9,0xFB,0x75,0xFB,0xF4,0xDD,0x02,0x0D,0xFB,0x75, // ........u......u END
+	0x80,0x9A,0xDD,0x03,0x1E,0xFB,0x75,0xDD,0x02,0xE1,0xFB,0x75,0xD8,0x0B,0x36,0xDD, // ......u....u..6. END
+	0x03,0xF9,0xFB,0x75,0xFB,0xF4,0x80,0x9C,0xDD,0x03,0x1E,0xFB,0x75,0xD8,0x0B,0xAD, // ...u........u... END
+	0xDD,0x03,0xF9,0xFB,0x75,0xDD,0x08,0xBA,0xFB,0x75,0xFB,0xF4,0xDD,0x01,0xD4,0xFB, // ....u....u...... END
+	0x75,0x90,0xF2,0x41,0xF8,0x70,0xDF,0x01,0xC3,0x70,0xE1,0x80,0x80,0x9C,0xDD,0x03, // u..A.p...p...... END
+	0x1E,0xFB,0x75,0xD8,0x0B,0xFA,0xDD,0x03,0xF9,0xFB,0x75,0xE3,0x80,0x06,0xEE,0x40, // ..u.......u....@ END
+	0x81,0x71,0xE1,0x80,0x70,0xE1,0x80,0xDD,0x04,0xB1,0xFB,0x75,0xD0,0x20,0xDD,0x04, // .q..p......u.... END
+	0x21,0xFB,0x75,0xDD,0x05,0x97,0xFB,0x75,0xD9,0x80,0x08,0xFA,0x41,0xE3,0x80,0x06, // !.u....u....A... END
+	0x70,0xE1,0x80,0xDD,0x08,0xEC,0xFB,0x75,0xDD,0x04,0xB1,0xFB,0x75,0xD0,0x20,0xDD, // p......u....u... END
+	0x04,0x21,0xFB,0x75,0xDD,0x05,0x97,0xFB,0x75,0xD9,0x80,0x08,0xFA,0x4A,0xE6,0x01, // .!.u....u....J.. END
+	0xDD,0x04,0xF4,0xFB,0x75,0x8A,0xDD,0x04,0x21,0xFB,0x75,0xE3,0x80,0x06,0xE3,0x80, // ....u...!.u..... END
+	0x0E,0xE0,0x00,0xF2,0x81,0xF8,0xB0,0xDF,0x01,0x68,0xFB,0xF4,0x80,0x9C,0xDD,0x03, // .........h...... END
+	0x1E,0xFB,0x75,0xD8,0x0B,0xF0,0xDD,0x03,0xF9,0xFB,0x75,0xFB,0xF4,0x80,0x9A,0xDD, // ..u.......u..... END
+	0x03,0x1E,0xFB,0x75,0xDD,0x02,0xE1,0xFB,0x75,0xD8,0x0B,0xDC,0xDD,0x03,0xF9,0xFB, // ...u....u....... END
+	0x75,0x81,0xDD,0x03,0x0F,0xFB,0x75,0xD8,0x80,0x00,0x98,0xDD,0x03,0xA2,0xFB,0x75, // u.....u........u END
+	0x80,0xDD,0x03,0x0F,0xFB,0x75,0xD8,0x80,0x00,0xDD,0x05,0x78,0xFB,0x75,0xFB,0xF4, // .....u.....x.u.. END
+	0xD5,0x30,0xFB,0x75,0xFB,0xF4,0xDD,0x02,0x51,0xFB,0x75,0x90,0xF2,0x41,0xF8,0x50, // .0.u....Q.u..A.P END
+	0xE1,0xD5,0xFB,0x83,0xDD,0x06,0xF1,0xFB,0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xE1, // ........u.@.4.X. END
+	0xD7,0xDD,0x05,0xA6,0xFB,0x75,0xFB,0xF4,0x80,0x9C,0xDD,0x03,0x1E,0xFB,0x75,0xD8, // .....u........u. END
+	0x0B,0xC2,0xDD,0x03,0xF9,0xFB,0x75,0xFB,0xF4,0x80,0x9C,0xDD,0x03,0x1E,0xFB,0x75, // ......u........u END
+	0xD8,0x0B,0xCF,0xDD,0x03,0xF9,0xFB,0x75,0xFB,0xF4,0x80,0x9A,0xDD,0x03,0x1E,0xFB, // .......u........ END
+	0x75,0xDD,0x02,0xE1,0xFB,0x75,0xD8,0x0B,0xB5,0xDD,0x03,0xF9,0xFB,0x75,0x81,0xDD, // u....u.......u.. END
+	0x03,0x0F,0xFB,0x75,0xD8,0x80,0x00,0x98,0xDD,0x03,0xA2,0xFB,0x75,0x80,0xDD,0x03, // ...u........u... END
+	0x0F,0xFB,0x75,0xD8,0x80,0x00,0xDD,0x06,0x80,0xFB,0x75,0xFB,0xF4,0x80,0x9C,0xDD, // ..u.......u..... END
+	0x03,0x1E,0xFB,0x75,0xDD,0x02,0xE1,0xFB,0x75,0x8A,0xDD,0x04,0x21,0xFB,0x75,0xDD, // ...u....u...!.u. END
+	0x02,0xE1,0xFB,0x75,0x8A,0xDD,0x04,0x21,0xFB,0x75,0xDD,0x02,0xE1,0xFB,0x75,0x8A, // ...u...!.u....u. END
+	0xDD,0x04,0x21,0xFB,0x75,0xDD,0x02,0xE1,0xFB,0x75,0x8A,0xDD,0x04,0x21,0xFB,0x75, // ..!.u....u...!.u END
+	0xDD,0x02,0xE1,0xFB,0x75,0xFB,0xF4,0xDD,0x03,0x05,0xFB,0x75,0x81,0xDD,0x02,0xEB, // ....u......u.... END
+	0xFB,0x75,0xDD,0x02,0xD7,0xFB,0x75,0x80,0x90,0xDD,0x03,0x1E,0xFB,0x75,0xFB,0xF4, // .u....u......u.. END
+	0xD8,0x0C,0x27,0xDD,0x03,0xF9,0xFB,0x75,0xFB,0xF4,0xD8,0x0C,0x2C,0xDD,0x03,0xF9, // ..'....u....,... END
+	0xFB,0x75,0xFB,0xF4,0xF2,0x00,0xF8,0x18,0xE1,0xC9,0xD8,0x0C,0x3E,0xDD,0x03,0xF9, // .u..........>... END
+	0xFB,0x75,0xFB,0xF4,0xD8,0x0C,0x45,0xDD,0x03,0xF9,0xFB,0x75,0xFB,0xF4,0xD8,0x0C, // .u....E....u.... END
+	0x39,0xDD,0x03,0xF9,0xFB,0x75,0xFB,0xF4,0xEE,0xC0,0xD8,0x02,0x06,0xC1,0xEE,0x40, // 9....u.........@ END
+	0xD8,0x05,0x03,0xA0,0xC1,0xFB,0xF4,0xE0,0x00,0xE0,0x40,0x70,0xE1,0x80,0x71,0xE1, // ..........@p..q. END
+	0x80,0xD0,0x1B,0xDD,0x04,0x21,0xFB,0x75,0xD0,0x5B,0xDD,0x04,0x21,0xFB,0x75,0xE3, // .....!.u.[..!.u. END
+	0x80,0x06,0xDD,0x04,0xB1,0xFB,0x75,0xD0,0x3B,0xDD,0x04,0x21,0xFB,0x75,0xE3,0x80, // ......u.;..!.u.. END
+	0x06,0xDD,0x04,0xB1,0xFB,0x75,0xD0,0x48,0xDD,0x04,0x21,0xFB,0x75,0xFB,0xF4,0x72, // .....u.H..!.u..r END
+	0xE1,0x80,0x71,0xE1,0x80,0x70,0xE1,0x80,0xD8,0x0C,0x31,0xDD,0x03,0xF9,0xFB,0x75, // ..q..p....1....u END
+	0xE3,0x80,0x06,0xDD,0x04,0xB1,0xFB,0x75,0xD0,0x3B,0xDD,0x04,0x21,0xFB,0x75,0xE3, // .......u.;..!.u. END
+	0x80,0x06,0xDD,0x04,0xB1,0xFB,0x75,0xD0,0x3B,0xDD,0x04,0x21,0xFB,0x75,0xE3,0x80, // ......u.;..!.u.. END
+	0x06,0xDD,0x04,0xB1,0xFB,0x75,0xD0,0x6D,0xDD,0x04,0x21,0xFB,0x75,0xFB,0xF4,0xD8, // .....u.m..!.u... END
+	0x02,0x00,0xC1,0xEE,0x40,0xD8,0x01,0x08,0xC1,0xFB,0xF4,0xEE,0x80,0xEE,0xC9,0x90, // ....@........... END
+	0xD8,0x02,0x00,0xC1,0xFB,0x93,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00,0xD4, // ...........@.... END
+	0x01,0xC1,0xF2,0x00,0xF8,0x00,0xE1,0xD1,0x23,0x8A,0xF2,0x20,0xF8,0x00,0xE1,0xC3, // ........#....... END
+	0xE0,0xC0,0xE1,0xC5,0xE0,0x80,0xE0,0xC0,0xE3,0xDD,0x80,0x58,0xFB,0x34,0xE6,0x1C, // ...........X.4.. END
+	0xFB,0xF4,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x00,0xEE,0xF6,0xE1,0x80,0xD4,0x01,0xC1, // .....@.......... END
+	0xF2,0x00,0xF8,0x08,0xE1,0xC6,0xE3,0x80,0xD8,0x01,0x00,0xFB,0xF4,0xE3,0x80,0x06, // ................ END
+	0xFB,0xF4,0xEE,0x40,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x02,0x06,0xC1,0x70,0xE1,0x80, // ...@....@....p.. END
+	0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x0B,0x01,0xFB,0x75,0xEF,0x00,0xD8,0x01,0x01, // ..........u..... END
+	0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xEE,0x89,0xEE, // ...........@.... END
+	0x40,0xD8,0x02,0x06,0xC1,0xE1,0xC2,0xEE,0x89,0x90,0xEE,0xF6,0x72,0xE1,0x80,0xEE, // @...........r... END
+	0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80,0xFB,0xF4,0xF2,0x92,0xF8, // ..@............. END
+	0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x04,0x9F,0xD3,0x64,0xF3,0x0B,0xF9, // .......8....d... END
+	0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1,0xE3,0xE8,0x93,0xF3,0x0A,0xF9, // 8.......8....... END
+	0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0, // 8...'......L..C. END
+	0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xD2, // .........L..C... END
+	0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xAA,0xEA,0xCA,0xE9, // d.....L..C...... END
+	0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F,0x41,0xE0,0x00,0xA0,0x42,0xFB, // ..L..C...oA...B. END
+	0xF4,0xEE,0x40,0xD8,0x02,0x06,0xC1,0xA1,0xE1,0xC6,0xEE,0x40,0xD8,0x02,0x06,0xC1, // ..@........@.... END
+	0xA0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0xFB,0x9B,0xEE,0x1B,0xDD,0x04,0x44,0xFB, // .....p........D. END
+	0x75,0xFA,0xB4,0x90,0xE3,0x80,0x06,0xDD,0x04,0x04,0xFB,0x75,0xE3,0x85,0xFB,0xF4, // u..........u.... END
+	0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xF0,0xFB,0x83,0xD0,0x2D,0xDD, // ....A.I.X.....-. END
+	0x04,0x21,0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x04,0xB1,0xEE,0x40,0xD8, // .!.u.4........@. END
+	0x02,0x06,0xC1,0xDA,0x0E,0x10,0xEA,0x8A,0xF2,0xD2,0xF8,0xD8,0xE1,0xE8,0xFB,0x93, // ................ END
+	0xFB,0x8B,0x70,0xE1,0x80,0xEE,0x52,0xDD,0x04,0xB7,0xFB,0x75,0xE3,0x80,0x06,0x70, // ..p...R....u...p END
+	0xE1,0x80,0xD1,0x68,0xDD,0x04,0x2E,0xFB,0x75,0xE3,0x80,0x06,0xFA,0x74,0xFA,0xB4, // ...h....u....t.. END
+	0xDB,0x0E,0x10,0xE8,0x93,0xE6,0x4A,0xD2,0x3C,0xEA,0x8A,0xF2,0xD2,0xF8,0xD8,0xE1, // ......J.<....... END
+	0xE7,0xFB,0x93,0xFB,0x8B,0x70,0xE1,0x80,0xEE,0x52,0xDD,0x04,0xB7,0xFB,0x75,0xE3, // .....p...R....u. END
+	0x80,0x06,0x70,0xE1,0x80,0xD1,0x6D,0xDD,0x04,0x2E,0xFB,0x75,0xE3,0x80,0x06,0xFA, // ..p...m....u.... END
+	0x74,0xFA,0xB4,0xD3,0x3C,0xE8,0x93,0xE6,0x4A,0x70,0xE1,0x80,0xDD,0x04,0xB7,0xFB, // t...<...Jp...... END
+	0x75,0xE3,0x80,0x06,0xD1,0x73,0xDD,0x04,0x2E,0xFB,0x75,0xFB,0xF4,0xEE,0x40,0x80, // u....s....u...@. END
+	0xC1,0x90,0x10,0xE2,0xAF,0xB0,0xF2,0xD3,0xF8,0xF8,0xE1,0xCF,0xB9,0xF2,0xD3,0xF8, // ................ END
+	0xE8,0xE1,0xC8,0xBA,0xE8,0x4B,0xE4,0x4A,0xE0,0x00,0xE3,0xD9,0xEE,0x09,0xFB,0xF4, // .....K.J........ END
+	0xD8,0x03,0x00,0xC1,0xFB,0xF4,0x80,0xFB,0xF4,0xD9,0x80,0x8A,0x09,0xE3,0xC8,0xFB, // ................ END
+	0x83,0xDD,0x05,0xCE,0xFB,0x75,0xFA,0x34,0xFB,0x83,0xDD,0x06,0x5A,0xFB,0x75,0xDD, // .....u.4....Z.u. END
+	0x08,0x85,0xFB,0x75,0xFA,0x34,0xDD,0x06,0x64,0xFB,0x75,0xDD,0x08,0x85,0xFB,0x75, // ...u.4..d.u....u END
+	0xDD,0x08,0x5F,0xFB,0x75,0xFB,0xF4,0xD9,0x80,0x8C,0x11,0xE2,0x80,0x4A,0xD9,0x80, // .._.u........J.. END
+	0x8D,0x11,0xE0,0x80,0x4A,0xA7,0xF6,0x42,0xD2,0x7F,0xF0,0x4A,0xDA,0x80,0x0A,0xE4, // ....J..B...J.... END
+	0x8A,0x1A,0xD4,0x00,0x54,0xD2,0x7F,0xF0,0x42,0xDA,0x80,0x0A,0xE4,0x8A,0x22,0xD5, // ....T...B.....". END
+	0x7F,0xF1,0x5D,0x55,0xD8,0x80,0x8A,0x08,0xD2,0x60,0xEC,0x4A,0x41,0xEE,0x1B,0xD5, // ..]U.....`.JA... END
+	0x08,0xF4,0x05,0xEE,0x04,0xFB,0xF4,0xFB,0x8B,0xFB,0x83,0xD8,0x80,0x8A,0x08,0xD2, // ................ END
+	0x60,0xEC,0x4A,0x41,0xFA,0x34,0xD1,0x7F,0xF0,0x41,0xDA,0x80,0x0A,0xE4,0x4A,0xFA, // `.JA.4...A....J. END
+	0xB4,0xD3,0xFF,0xF0,0xD3,0x4B,0x97,0xF6,0x41,0xD3,0x7F,0xF0,0x4B,0xDB,0x80,0x0A, // .....K..A...K... END
+	0xE4,0x4B,0xB8,0xF6,0x93,0x4A,0xD9,0x80,0x8C,0x11,0xE0,0x80,0x4A,0xD9,0x80,0x8D, // .K...J......J... END
+	0x11,0xE2,0x80,0x4A,0xFB,0xF4,0xA0,0xB7,0xF4,0x03,0xEE,0x01,0xBE,0xF4,0x93,0xEE, // ...J............ END
+	0x02,0xFB,0xF4,0xD5,0x07,0xF6,0x05,0xD5,0x7F,0xF0,0x05,0xFB,0xF4,0xD5,0x7F,0xF0, // ................ END
+	0x05,0xFB,0xF4,0xEE,0x76,0xE1,0x85,0xDD,0x07,0x70,0xFB,0x75,0xEE,0x36,0xE2,0x05, // ....v....p.u.6.. END
+	0xDD,0x03,0xF9,0xFB,0x75,0xE3,0x85,0xFB,0xF4,0xD4,0x00,0x08,0xE0,0x00,0xD2,0x61, // ....u..........a END
+	0xE6,0x4A,0xA0,0xF2,0x8A,0xF8,0xB8,0xDF,0x06,0xEE,0xA7,0xF2,0x8A,0xF8,0xA8,0xDF, // .J.............. END
+	0x06,0xEE,0xB7,0xF4,0x4B,0xEF,0x21,0x08,0xE0,0x00,0xD2,0x31,0xE6,0x4A,0xA0,0xF2, // ....K.!....1.J.. END
+	0x8A,0xF8,0xB8,0xDF,0x06,0xEE,0xA7,0xF2,0x8A,0xF8,0xA8,0xE1,0xF9,0xBB,0xF4,0x4B, // ...............K END
+	0xEF,0x21,0x08,0xE0,0x00,0xD2,0x61,0xE6,0x4A,0xA0,0xF2,0x8A,0xF8,0xB8,0xE1,0xE6, // .!....a.J....... END
+	0xA7,0xF2,0x8A,0xF8,0xA8,0xE1,0xDF,0xEF,0x21,0x08,0xE0,0x00,0xD2,0x31,0xE6,0x4A, // ........!....1.J END
+	0xA0,0xF2,0x8A,0xF8,0xB8,0xE1,0xCF,0xA7,0xF2,0x8A,0xF8,0xA8,0xE1,0xC8,0xB4,0xF4, // ................ END
+	0x4B,0xEF,0x21,0xEE,0x24,0xFB,0xF4,0x80,0xFB,0xF4,0xFB,0x83,0xDD,0x07,0x34,0xFB, // K.!.$.........4. END
+	0x75,0xF2,0x40,0xFA,0x34,0xF8,0x58,0xE1,0xF0,0xFB,0x83,0xDD,0x05,0xCE,0xFB,0x75, // u.@.4.X........u END
+	0xEE,0x40,0xFA,0x34,0xFB,0x8B,0xFB,0x83,0xDD,0x07,0xF7,0xFB,0x75,0xDD,0x05,0xA0, // .@.4........u... END
+	0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFA,0xB4,0x71,0xE1,0x80,0xEE,0x52,0xDD,0x06,0x0E, // .u.@.4..q...R... END
+	0xFB,0x75,0xE3,0x80,0x0E,0x81,0xEC,0x01,0xFB,0xF4,0x80,0xFB,0xF4,0xFB,0x83,0xDD, // .u.............. END
+	0x06,0x64,0xFB,0x75,0xDD,0x08,0x0D,0xFB,0x75,0xD9,0x80,0x8A,0x09,0xF0,0x01,0xF2, // .d.u....u....... END
+	0x40,0xFA,0x34,0xF8,0x48,0xE1,0xDE,0xFB,0x83,0xDD,0x06,0x5A,0xFB,0x75,0xDD,0x08, // @.4.H......Z.u.. END
+	0x0D,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xDA,0x80,0x8A,0x12,0xF0,0x8A,0xF2,0x92,0xF8, // ..u.@.4......... END
+	0x98,0xE3,0xF8,0x81,0xFB,0xF4,0x80,0xFB,0xF4,0xA0,0xF2,0x82,0xF8,0x90,0xE1,0xF6, // ................ END
+	0xB7,0xF6,0x83,0xB7,0xF0,0x93,0xD3,0x61,0xE4,0x93,0x4A,0xE0,0x40,0xBB,0xF6,0x83, // .......a..J.@... END
+	0xB7,0xF0,0x93,0xD3,0x31,0xE4,0x93,0x4A,0xE0,0x40,0xEE,0x80,0xB7,0xF0,0x93,0xD3, // ....1..J.@...... END
+	0x61,0xE4,0x93,0x4A,0xE0,0x40,0xB4,0xF6,0x83,0xB7,0xF0,0x93,0xD3,0x31,0xE4,0x93, // a..J.@.......1.. END
+	0x4A,0xE0,0x40,0xA0,0x4A,0xFB,0xF4,0xEE,0x09,0xD9,0x0C,0x4C,0xDD,0x0B,0x10,0xFB, // J.@.J......L.... END
+	0x75,0xFB,0xF4,0xD8,0x80,0x0A,0xD9,0x0C,0x51,0xD2,0x80,0xDD,0x0B,0x2A,0xFB,0x75, // u.......Q....*.u END
+	0xD8,0x80,0x8A,0xD1,0x20,0x41,0xFB,0xF4,0xD1,0x10,0xEE,0x41,0x80,0x70,0xE1,0x80, // .....A.....A.p.. END
+	0x71,0xE1,0x80,0xDD,0x08,0x0D,0xFB,0x75,0xF0,0x81,0xF2,0x91,0xE3,0x80,0x0E,0xE3, // q......u........ END
+	0x80,0x06,0xF8,0x90,0xE1,0xC7,0xE0,0x08,0xD2,0x77,0xF0,0x02,0xE3,0xE0,0xFB,0xF4, // .........w...... END
+	0xDD,0x07,0xFE,0xFB,0x75,0xE3,0xEE,0xD8,0x80,0x8A,0x00,0xD1,0x60,0xEC,0x01,0xFB, // ....u.......`... END
+	0xF4,0xDD,0x0A,0xFA,0xFB,0x75,0xDD,0x08,0x15,0xFB,0x75,0x00,0xFB,0xF4,0xDD,0x80, // .....u....u..... END
+	0x0A,0xE4,0x05,0xFB,0xF4,0x80,0x90,0xDD,0x03,0x1E,0xFB,0x75,0x97,0x80,0x70,0xE1, // ...........u..p. END
+	0x80,0x71,0xE1,0x80,0xDD,0x08,0x9F,0xFB,0x75,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xD5, // .q......u....... END
+	0x07,0xF3,0x45,0xF9,0x50,0xE1,0xC3,0xE0,0x00,0xE3,0xDC,0x71,0xE1,0x80,0x8A,0xDD, // ..E.P......q.... END
+	0x04,0x21,0xFB,0x75,0xE3,0x80,0x0E,0xF3,0x49,0xF9,0x58,0xE1,0xC3,0xE2,0x40,0xE3, // .!.u....I.X...@. END
+	0xF3,0xDD,0x08,0x66,0xFB,0x75,0xFB,0xF4,0x80,0x98,0xDD,0x03,0x1E,0xFB,0x75,0xD8, // ...f.u........u. END
+	0x0C,0xD9,0xDD,0x03,0xF9,0xFB,0x75,0xD8,0x0C,0xE8,0xD9,0x80,0x8A,0x09,0xD2,0x40, // ......u........@ END
+	0xF2,0x4A,0xF8,0x50,0xD8,0x0C,0xEE,0xDD,0x03,0xF9,0xFB,0x75,0xFB,0xF4,0x94,0xF6, // .J.P.......u.... END
+	0x41,0xA7,0xF0,0x02,0x70,0xE1,0x80,0x71,0xE1,0x80,0xA7,0xE6,0x51,0xDD,0x03,0x1E, // A...p..q....Q... END
+	0xFB,0x75,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xDD,0x08,0x08,0xFB,0x75,0x97,0xF0,0x41, // .u..........u..A END
+	0xDA,0x0C,0xD1,0xE4,0x4A,0x09,0xD2,0x20,0xF0,0x82,0xEC,0x0A,0xDD,0x04,0x21,0xFB, // ....J.........!. END
+	0x75,0xFB,0xF4,0x81,0xD9,0x80,0x8C,0x48,0x80,0xD9,0x80,0x8D,0x48,0xD8,0x80,0x8B, // u......H....H... END
+	0x91,0x41,0xE1,0xF8,0x81,0xD9,0x80,0x8C,0x48,0x80,0xD9,0x80,0x8D,0x48,0xD8,0x80, // .A......H....H.. END
+	0x8B,0x90,0x41,0xD8,0x80,0x90,0x90,0xFA,0x09,0xDD,0x09,0x04,0xFB,0x75,0xD8,0x80, // ..A..........u.. END
+	0x90,0xFA,0x02,0xFB,0xF4,0x70,0xE1,0x80,0xD8,0x80,0x8E,0x90,0xFA,0x09,0xE3,0x80, // .....p.......... END
+	0x06,0xDD,0x08,0xCC,0xFB,0x75,0xD8,0x80,0x8E,0xFA,0x02,0xFB,0xF4,0xD8,0x80,0x8C, // .....u.......... END
+	0x00,0xF2,0x00,0xF8,0x08,0xE1,0xCB,0xD9,0x80,0x8E,0xFA,0x8A,0xE0,0x80,0xFA,0x51, // ...............Q END
+	0x80,0xFB,0xF4,0x80,0x70,0xE1,0x80,0xDD,0x08,0x0D,0xFB,0x75,0xEE,0x40,0xE3,0x80, // ....p......u.@.. END
+	0x06,0xDA,0x80,0x8A,0x12,0xF0,0x8A,0xF2,0x92,0xF8,0x98,0xDF,0x0A,0xD6,0xDA,0x0C, // ................ END
+	0xF4,0xE4,0x91,0x12,0xE4,0x92,0xDB,0x0D,0xF4,0xE4,0x93,0xFA,0xD2,0xF3,0x1B,0xF9, // ................ END
+	0x18,0xDF,0x0A,0xD6,0xEE,0xC0,0xFB,0x12,0xE4,0xDC,0xD4,0x88,0xF1,0x1C,0xF3,0x24, // ...............$ END
+	0xF9,0x08,0xDF,0x0A,0xD1,0x70,0xE1,0x80,0xEE,0x1B,0xDD,0x08,0x0D,0xFB,0x75,0xEF, // .....p........u. END
+	0x00,0xE3,0x80,0x06,0xDD,0x80,0x8A,0x2D,0xF1,0x65,0xF3,0x6D,0xF9,0x48,0xDF,0x0A, // .......-.e.m.H.. END
+	0xD1,0x74,0xE1,0x80,0xD5,0x1F,0xF1,0x0D,0xD5,0x0A,0xF3,0x65,0xE3,0x80,0x26,0xF9, // .t.........e..&. END
+	0x40,0xE1,0xDC,0xF3,0x24,0xD5,0x01,0xF9,0x18,0xD5,0x00,0x75,0xE1,0x80,0xFB,0x12, // @...$......u.... END
+	0xD5,0x01,0xF1,0x25,0xE3,0x80,0x2E,0xED,0x25,0xF3,0x24,0xF9,0x08,0xDF,0x0A,0xD1, // ...%....%.$..... END
+	0xEF,0x00,0xD5,0x07,0xF5,0x25,0xEF,0x23,0x70,0xE1,0x80,0x71,0xE1,0x80,0xFB,0x93, // .....%.#p..q.... END
+	0x73,0xE1,0x80,0xFB,0xA3,0xEE,0x24,0xDD,0x05,0xCE,0xFB,0x75,0xEF,0x40,0xFB,0x34, // s.....$....u.@.4 END
+	0xE3,0x80,0x1E,0xFA,0xB4,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xFB,0xAB,0x70,0xE1,0x80, // .............p.. END
+	0x71,0xE1,0x80,0xFB,0x93,0x73,0xE1,0x80,0xFB,0xA3,0xDD,0x07,0xF7,0xFB,0x75,0xDD, // q....s........u. END
+	0x05,0xA0,0xFB,0x75,0xEF,0x40,0xFB,0x34,0xE3,0x80,0x1E,0xFA,0xB4,0xE3,0x80,0x0E, // ...u.@.4........ END
+	0xE3,0x80,0x06,0xF3,0x6D,0xF9,0x48,0xDF,0x0A,0x68,0xDD,0x80,0x8B,0x2D,0xF3,0x6D, // ....m.H..h...-.m END
+	0xF9,0x58,0xE1,0xE9,0x70,0xE1,0x80,0x71,0xE1,0x80,0xFB,0x93,0x73,0xE1,0x80,0xFB, // .X..p..q....s... END
+	0xA3,0xEE,0x24,0xDD,0x06,0x6A,0xFB,0x75,0xD0,0x20,0xDD,0x04,0x21,0xFB,0x75,0xFB, // ..$..j.u....!.u. END
+	0x34,0xE3,0x80,0x1E,0xFA,0xB4,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xE1,0xF2,0x70,0xE1, // 4.............p. END
+	0x80,0x71,0xE1,0x80,0xFB,0x93,0x73,0xE1,0x80,0xFB,0xA3,0xDD,0x09,0x04,0xFB,0x75, // .q....s........u END
+	0xD8,0x80,0x8D,0x00,0x91,0xF2,0x01,0xF8,0x00,0xE1,0xC8,0xFA,0x34,0xFB,0x83,0xD9, // ............4... END
+	0x80,0x90,0xFA,0x41,0xFB,0x34,0xE3,0x80,0x1E,0xFA,0xB4,0xE3,0x80,0x0E,0xE3,0x80, // ...A.4.......... END
+	0x06,0xFB,0x74,0xFB,0xAB,0x70,0xE1,0x80,0x71,0xE1,0x80,0xFB,0x93,0x73,0xE1,0x80, // ..t..p..q....s.. END
+	0xEE,0x24,0xEE,0x6D,0xDD,0x06,0x0E,0xFB,0x75,0xE3,0x80,0x1E,0xFA,0xB4,0xE3,0x80, // .$.m....u....... END
+	0x0E,0xE3,0x80,0x06,0xFB,0x34,0xD5,0xFF,0xF1,0x25,0xF3,0x24,0xF9,0x08,0xE1,0xF9, // .....4...%.$.... END
+	0xD4,0x1F,0xD5,0x0A,0xF1,0x0C,0xF3,0x25,0xF9,0x00,0xE1,0xE0,0xD4,0x80,0xF1,0x0C, // .......%........ END
+	0xF3,0x24,0xF9,0x18,0xE1,0xE3,0xFB,0x52,0xD4,0x01,0xF1,0x25,0xF3,0x24,0xF9,0x08, // .$.....R...%.$.. END
+	0xE1,0xD7,0xE5,0x45,0xF3,0x5D,0xF9,0x40,0xE1,0xCF,0xDF,0x09,0x4D,0xD5,0x08,0xF1, // ...E.].@....M... END
+	0x4D,0xF3,0x6D,0xF9,0x48,0xE1,0xC2,0xDF,0x09,0x4D,0xE0,0x81,0xDF,0x09,0x42,0xD5, // M.m.H....M....B. END
+	0x77,0xF3,0x45,0xF9,0x50,0xE1,0xC8,0xE0,0x08,0xD5,0x77,0xF0,0x05,0xDF,0x09,0x1B, // w.E.P.....w..... END
+	0x80,0xFB,0xF4,0xD5,0x07,0xF0,0x05,0xFB,0xF4,0xD5,0x04,0xF6,0x05,0xD5,0x07,0xF0, // ................ END
+	0x05,0xFB,0xF4,0xA4,0xF4,0x4A,0xEE,0x01,0xFB,0xF4,0xFB,0x83,0xEE,0x40,0xD8,0x06, // .....J.......@.. END
+	0x01,0xA0,0xC1,0xFA,0x74,0xE6,0x01,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD, // ....t........... END
+	0x0B,0x01,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x0B,0x2A,0xFB, // ...u.....t.4..*. END
+	0x75,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x06,0x02,0xC1,0xFB,0xF4,0x45, // u.......@......E END
+	0x6E,0x74,0x65,0x72,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x3A,0x20,0x00,0x28, // nter.command:..( END
+	0x6D,0x20,0x2D,0x20,0x70,0x6C,0x61,0x79,0x65,0x72,0x20,0x6D,0x6F,0x76,0x65,0x2C, // m.-.player.move, END
+	0x20,0x63,0x20,0x2D,0x20,0x63,0x6F,0x6D,0x70,0x75,0x74,0x65,0x72,0x20,0x6D,0x6F, // .c.-.computer.mo END
+	0x76,0x65,0x2C,0x20,0x6C,0x20,0x2D,0x20,0x6C,0x69,0x73,0x74,0x20,0x6D,0x6F,0x76, // ve,.l.-.list.mov END
+	0x65,0x73,0x2C,0x20,0x70,0x20,0x2D,0x20,0x70,0x65,0x72,0x66,0x74,0x2C,0x20,0x72, // es,.p.-.perft,.r END
+	0x20,0x2D,0x20,0x72,0x65,0x73,0x65,0x74,0x2C,0x20,0x71,0x20,0x2D,0x20,0x71,0x75, // .-.reset,.q.-.qu END
+	0x69,0x74,0x29,0x00,0x49,0x6E,0x76,0x61,0x6C,0x69,0x64,0x20,0x63,0x6F,0x6D,0x6D, // it).Invalid.comm END
+	0x61,0x6E,0x64,0x3A,0x20,0x00,0x4D,0x6F,0x76,0x65,0x73,0x3A,0x20,0x00,0x45,0x6E, // and:..Moves:..En END
+	0x74,0x65,0x72,0x20,0x6D,0x6F,0x76,0x65,0x3A,0x20,0x00,0x49,0x6E,0x76,0x61,0x6C, // ter.move:..Inval END
+	0x69,0x64,0x20,0x6D,0x6F,0x76,0x65,0x00,0x49,0x6C,0x6C,0x65,0x67,0x61,0x6C,0x20, // id.move.Illegal. END
+	0x6D,0x6F,0x76,0x65,0x00,0x45,0x6E,0x74,0x65,0x72,0x20,0x64,0x65,0x70,0x74,0x68, // move.Enter.depth END
+	0x20,0x6C,0x69,0x6D,0x69,0x74,0x3A,0x20,0x00,0x42,0x61,0x64,0x20,0x64,0x65,0x70, // .limit:..Bad.dep END
+	0x74,0x68,0x00,0x50,0x65,0x72,0x66,0x74,0x3A,0x0A,0x00,0x43,0x6F,0x6D,0x70,0x75, // th.Perft:..Compu END
+	0x74,0x65,0x72,0x20,0x6D,0x6F,0x76,0x65,0x3A,0x20,0x00,0x43,0x6F,0x75,0x6C,0x64, // ter.move:..Could END
+	0x20,0x6E,0x6F,0x74,0x20,0x66,0x69,0x6E,0x64,0x20,0x6D,0x6F,0x76,0x65,0x2E,0x00, // .not.find.move.. END
+	0x1B,0x5B,0x32,0x4A,0x00,0x1B,0x5B,0x32,0x4B,0x00,0x1B,0x5B,0x33,0x38,0x3B,0x32, // .[2J..[2K..[38;2 END
+	0x3B,0x00,0x1B,0x5B,0x30,0x6D,0x00,0x1B,0x5B,0x3F,0x32,0x35,0x68,0x00,0x1B,0x5B, // ;..[0m..[?25h..[ END
+	0x3F,0x32,0x35,0x6C,0x00,0x3F,0x3F,0x3F,0x3F,0x00,0xA5,0xAB,0xA6,0xA1,0xBC,0xA6, // ?25l.????....... END
+	0xAB,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA, // ................ END
+	0xAA,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA, // ................ END
+	0xCA,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0xCB,0xC6,0xC1,0xDC,0xC6, // ................ END
+	0xCB,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x71,0x70,0x6E,0x6B,0x72, // ...........qpnkr END
+	0x62,0x3F,0x53,0x69,0x64,0x65,0x20,0x74,0x6F,0x20,0x6D,0x6F,0x76,0x65,0x3A,0x20, // b?Side.to.move:. END
+	0x00,0x77,0x68,0x69,0x74,0x65,0x00,0x62,0x6C,0x61,0x63,0x6B,0x00,0x00,0x00,0x00, // .white.black.... END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x00, // ................ END
+	0x00,0x00,0x0E,0x13,0x00,0x00,0x00,0x18,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x00,0x0A,0x00, // ................ END
+	0x00,0x00,0x0E,0x13,0x00,0x00,0x00,0x1C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x00, // ................ END
+	0x00,0x00,0x0E,0x13,0x00,0x00,0x00,0x18,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x00,0x0A,0x00, // ................ END
+	0x00,0x00,0x0E,0x13,0x00,0x00,0x00,0x1C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // ................ END
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF, // ................ END
+	0xDF,0xFF,0xE1,0xFF,0xEE,0xFF,0xF2,0x00,0x0E,0x00,0x12,0x00,0x1F,0x00,0x21,0x00, // ..............!. END
+	0x00,0xFF,0xEF,0xFF,0xF1,0x00,0x0F,0x00,0x11,0xFF,0xF0,0xFF,0xFF,0x00,0x01,0x00, // ................ END
+	0x10,0x00,0x00,0xFF,0xEF,0xFF,0xF1,0x00,0x0F,0x00,0x11,0x00,0x00,0x00,0x10,0x00, // ................ END
+	0x0F,0x00,0x11,0x00,0x00,0xFF,0xF0,0xFF,0xEF,0xFF,0xF1,0x00,0x00,0xFF,0xFF,0xFF, // ................ END
+	0x0A,0xA8,0x2B,0x73,0x6F,0x6B,0x6F,0x62,0x61,0x6E,0x00,0x2F,0x2F,0xDE,0x81,0x43, // ..+sokoban.//..C END
+	0x83,0x91,0xC1,0xF2,0x40,0xF8,0x58,0xD7,0x91,0xD5,0xAD,0xFB,0x75,0xF2,0x00,0xF8, // ....@.X.....u... END
+	0x18,0xD7,0x9F,0x80,0xDD,0x06,0x45,0xFB,0x75,0xDD,0x05,0xF3,0xFB,0x75,0xDD,0x06, // ......E.u....u.. END
+	0x31,0xFB,0x75,0xD8,0x09,0x67,0xDD,0x06,0xCE,0xFB,0x75,0xDD,0x01,0x43,0xFB,0x75, // 1.u..g....u..C.u END
+	0x80,0x90,0xDD,0x06,0x4F,0xFB,0x75,0xDD,0x06,0xC7,0xFB,0x75,0xD9,0x01,0x00,0xF2, // ....O.u....u.... END
+	0x41,0xF8,0x50,0xD7,0x35,0xD1,0x72,0xF2,0x41,0xF8,0x50,0xD7,0x1E,0xD1,0x71,0xF2, // A.P.5.r.A.P...q. END
+	0x41,0xF8,0x50,0xD7,0x80,0xD1,0x61,0xF2,0x41,0xF8,0x50,0xDF,0x02,0x37,0xD1,0x64, // A.P...a.A.P..7.d END
+	0xF2,0x41,0xF8,0x50,0xDF,0x03,0x26,0xD1,0x77,0xF2,0x41,0xF8,0x50,0xDF,0x04,0x15, // .A.P..&.w.A.P... END
+	0xD1,0x73,0xF2,0x41,0xF8,0x50,0xDF,0x05,0x04,0xD7,0x35,0xDD,0x05,0xF3,0xFB,0x75, // .s.A.P....5....u END
+	0x81,0xDD,0x06,0x45,0xFB,0x75,0x80,0xDD,0x07,0x23,0xFB,0x75,0xD8,0x0A,0x13,0xDD, // ...E.u...#.u.... END
+	0x06,0xCE,0xFB,0x75,0x81,0xDD,0x07,0x23,0xFB,0x75,0xD8,0x0A,0x2D,0xDD,0x06,0xCE, // ...u...#.u..-... END
+	0xFB,0x75,0x81,0xDD,0x07,0x23,0xFB,0x75,0x91,0xDD,0x07,0x27,0xFB,0x75,0xF2,0x40, // .u...#.u...'.u.@ END
+	0xF8,0x58,0xDF,0x01,0x40,0xA0,0xD4,0x00,0xD5,0x00,0x70,0xE1,0x80,0x74,0xE1,0x80, // .X..@.....p..t.. END
+	0xEE,0x40,0xD8,0x01,0x00,0xDB,0x81,0x02,0xD4,0x01,0xC1,0xE0,0x80,0xEE,0x40,0xE3, // .@............@. END
+	0x80,0x26,0xE3,0x80,0x06,0xF2,0x49,0xF8,0x58,0xDF,0x01,0x37,0xD9,0x81,0x02,0x09, // .&....I.X..7.... END
+	0xD3,0x2B,0xF2,0xCB,0xF8,0xD0,0xD7,0xF7,0xD3,0x40,0xF2,0xCB,0xF8,0xD0,0xE1,0xD1, // .+.......@...... END
+	0xE1,0xDE,0xD9,0x81,0x02,0xD3,0x2E,0x4B,0xDB,0x81,0x00,0x5D,0xDB,0x81,0x01,0x5C, // .......K...]...\ END
+	0xE1,0xCE,0xD9,0x81,0x02,0xD3,0x20,0x4B,0xDB,0x81,0x00,0x5D,0xDB,0x81,0x01,0x5C, // .......K...]...\ END
+	0xC0,0xD9,0x80,0x00,0xE4,0x4D,0xD3,0x10,0xE8,0xDC,0xE4,0x4B,0xDB,0x81,0x02,0x1B, // .....M.....K.... END
+	0x4B,0x9A,0xF2,0x59,0xF8,0x40,0xE1,0xC5,0xE1,0x00,0xD5,0x00,0xD7,0xBF,0xE1,0x40, // K..Y.@.........@ END
+	0xD7,0xBF,0xEE,0x40,0xD8,0x01,0x03,0xC1,0x81,0xFB,0xF4,0x80,0xFB,0xF4,0xD4,0x00, // ...@............ END
+	0xB0,0x73,0xE1,0x80,0x74,0xE1,0x80,0xEE,0x1B,0xEE,0x64,0xDD,0x01,0x9D,0xFB,0x75, // .s..t.....d....u END
+	0xE3,0x80,0x26,0xE3,0x80,0x1E,0x70,0xE1,0x80,0x73,0xE1,0x80,0x74,0xE1,0x80,0xDD, // ..&...p..s..t... END
+	0x02,0x05,0xFB,0x75,0xE3,0x80,0x26,0xE3,0x80,0x1E,0xE3,0x80,0x06,0x9A,0xF2,0x41, // ...u..&........A END
+	0xF8,0x40,0xE1,0xC9,0xF2,0x5B,0xF8,0x58,0xE1,0xCD,0xE1,0x00,0xE3,0xFD,0xE0,0xC0, // .@...[.X........ END
+	0xDF,0x01,0x46,0xE1,0x00,0xDF,0x01,0x45,0xFB,0xF4,0xDA,0x80,0x00,0xE4,0x02,0xD2, // ..F....E........ END
+	0x10,0xE8,0x91,0xE4,0x02,0x00,0xFB,0xF4,0x70,0xE1,0x80,0x71,0xE1,0x80,0xDD,0x01, // ........p..q.... END
+	0x8F,0xFB,0x75,0xEE,0x80,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xDB,0x81,0x00,0x1B,0xF2, // ..u............. END
+	0xC3,0xF8,0xC0,0xE1,0xD7,0xDB,0x81,0x01,0x1B,0xF2,0xCB,0xF8,0xC0,0xE1,0xCD,0xD0, // ................ END
+	0x20,0xF2,0x02,0xF8,0x00,0xE1,0xC3,0xD2,0x40,0xE1,0xC1,0xD2,0x2B,0xEE,0x12,0xFB, // ........@...+... END
+	0xF4,0xDB,0x80,0x00,0xE4,0x03,0xD3,0x10,0xE8,0xD9,0xE4,0x03,0x42,0xFB,0xF4,0x70, // ............B..p END
+	0xE1,0x80,0x71,0xE1,0x80,0xE0,0x44,0xDD,0x06,0x4F,0xFB,0x75,0xE3,0x80,0x0E,0xE3, // ..q...D..O.u.... END
+	0x80,0x06,0xDD,0x01,0x9D,0xFB,0x75,0xEE,0x80,0xDD,0x02,0x05,0xFB,0x75,0xFB,0xF4, // ......u......u.. END
+	0xEE,0x80,0xD8,0x0A,0x58,0xD1,0x2B,0xF2,0x51,0xF8,0x60,0xD8,0x0A,0x50,0xD1,0x2A, // ....X.+.Q.`..P.* END
+	0xF2,0x4A,0xF8,0x50,0xD8,0x0A,0x6C,0xD1,0x24,0xF2,0x4A,0xF8,0x50,0xD8,0x0A,0x60, // .J.P..l.$.J.P..` END
+	0x72,0xE1,0x80,0xDD,0x06,0xCE,0xFB,0x75,0xE3,0x80,0x06,0xDD,0x06,0xF5,0xFB,0x75, // r......u.......u END
+	0xFB,0xF4,0xD8,0x81,0x00,0x00,0xE2,0x00,0xD9,0x81,0x01,0x09,0xDD,0x01,0x8F,0xFB, // ................ END
+	0x75,0xD1,0x23,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1,0x20,0xF2,0x41,0xF8,0x50,0xDF, // u.#.A.P.5...A.P. END
+	0x02,0xFD,0xD1,0x2E,0xF2,0x41,0xF8,0x50,0xDF,0x02,0xFD,0xD8,0x81,0x00,0x00,0xE2, // .....A.P........ END
+	0x01,0xD9,0x81,0x01,0x09,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x23,0xF2,0x41,0xF8,0x50, // .........u.#.A.P END
+	0xD7,0x35,0xD1,0x24,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1,0x2A,0xF2,0x41,0xF8,0x50, // .5.$.A.P.5.*.A.P END
+	0xD7,0x35,0xD1,0x2E,0xF2,0x41,0xF8,0x40,0xE1,0xD2,0xD8,0x81,0x00,0x00,0xE2,0x01, // .5...A.@........ END
+	0xD9,0x81,0x01,0x09,0xD2,0x2A,0xDD,0x01,0xD6,0xFB,0x75,0xE1,0xD0,0xD8,0x81,0x00, // .....*....u..... END
+	0x00,0xE2,0x01,0xD9,0x81,0x01,0x09,0xD2,0x24,0xDD,0x01,0xD6,0xFB,0x75,0xD8,0x81, // ........$....u.. END
+	0x00,0x00,0xE2,0x01,0xD9,0x81,0x01,0x09,0xDD,0x01,0xE4,0xFB,0x75,0xD8,0x81,0x00, // ............u... END
+	0x00,0xE2,0x00,0xD9,0x81,0x01,0x09,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x2A,0xF2,0x41, // ...........u.*.A END
+	0xF8,0x40,0xE1,0xD2,0xD8,0x81,0x00,0x00,0xE2,0x00,0xD9,0x81,0x01,0x09,0xD2,0x2E, // .@.............. END
+	0xDD,0x01,0xD6,0xFB,0x75,0xE1,0xD0,0xD8,0x81,0x00,0x00,0xE2,0x00,0xD9,0x81,0x01, // ....u........... END
+	0x09,0xD2,0x20,0xDD,0x01,0xD6,0xFB,0x75,0xD8,0x81,0x00,0x08,0xE2,0x40,0x41,0xD8, // .......u.....@A. END
+	0x81,0x00,0x00,0xD9,0x81,0x01,0x09,0x70,0xE1,0x80,0x71,0xE1,0x80,0xDD,0x01,0xE4, // .......p..q..... END
+	0xFB,0x75,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xE0,0x00,0xDD,0x01,0xE4,0xFB,0x75,0xD7, // .u............u. END
+	0x35,0xD8,0x81,0x00,0x00,0xE0,0x00,0xD9,0x81,0x01,0x09,0xDD,0x01,0x8F,0xFB,0x75, // 5..............u END
+	0xD1,0x23,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1,0x20,0xF2,0x41,0xF8,0x50,0xDF,0x03, // .#.A.P.5...A.P.. END
+	0xEC,0xD1,0x2E,0xF2,0x41,0xF8,0x50,0xDF,0x03,0xEC,0xD8,0x81,0x00,0x00,0xE0,0x01, // ....A.P......... END
+	0xD9,0x81,0x01,0x09,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x23,0xF2,0x41,0xF8,0x50,0xD7, // ........u.#.A.P. END
+	0x35,0xD1,0x24,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1,0x2A,0xF2,0x41,0xF8,0x50,0xD7, // 5.$.A.P.5.*.A.P. END
+	0x35,0xD1,0x2E,0xF2,0x41,0xF8,0x40,0xE1,0xD2,0xD8,0x81,0x00,0x00,0xE0,0x01,0xD9, // 5...A.@......... END
+	0x81,0x01,0x09,0xD2,0x2A,0xDD,0x01,0xD6,0xFB,0x75,0xE1,0xD0,0xD8,0x81,0x00,0x00, // ....*....u...... END
+	0xE0,0x01,0xD9,0x81,0x01,0x09,0xD2,0x24,0xDD,0x01,0xD6,0xFB,0x75,0xD8,0x81,0x00, // .......$....u... END
+	0x00,0xE0,0x01,0xD9,0x81,0x01,0x09,0xDD,0x01,0xE4,0xFB,0x75,0xD8,0x81,0x00,0x00, // ...........u.... END
+	0xE0,0x00,0xD9,0x81,0x01,0x09,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x2A,0xF2,0x41,0xF8, // ..........u.*.A. END
+	0x40,0xE1,0xD2,0xD8,0x81,0x00,0x00,0xE0,0x00,0xD9,0x81,0x01,0x09,0xD2,0x2E,0xDD, // @............... END
+	0x01,0xD6,0xFB,0x75,0xE1,0xD0,0xD8,0x81,0x00,0x00,0xE0,0x00,0xD9,0x81,0x01,0x09, // ...u............ END
+	0xD2,0x20,0xDD,0x01,0xD6,0xFB,0x75,0xD8,0x81,0x00,0x08,0xE0,0x40,0x41,0xD8,0x81, // ......u.....@A.. END
+	0x00,0x00,0xD9,0x81,0x01,0x09,0x70,0xE1,0x80,0x71,0xE1,0x80,0xDD,0x01,0xE4,0xFB, // ......p..q...... END
+	0x75,0xE3,0x80,0x0E,0xE3,0x80,0x06,0xE2,0x00,0xDD,0x01,0xE4,0xFB,0x75,0xD7,0x35, // u............u.5 END
+	0xD8,0x81,0x00,0x00,0xD9,0x81,0x01,0x09,0xE2,0x40,0xDD,0x01,0x8F,0xFB,0x75,0xD1, // .........@....u. END
+	0x23,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1,0x20,0xF2,0x41,0xF8,0x50,0xDF,0x04,0xDB, // #.A.P.5...A.P... END
+	0xD1,0x2E,0xF2,0x41,0xF8,0x50,0xDF,0x04,0xDB,0xD8,0x81,0x00,0x00,0xD9,0x81,0x01, // ...A.P.......... END
+	0x09,0xE2,0x41,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x23,0xF2,0x41,0xF8,0x50,0xD7,0x35, // ..A....u.#.A.P.5 END
+	0xD1,0x24,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1,0x2A,0xF2,0x41,0xF8,0x50,0xD7,0x35, // .$.A.P.5.*.A.P.5 END
+	0xD1,0x2E,0xF2,0x41,0xF8,0x40,0xE1,0xD2,0xD8,0x81,0x00,0x00,0xD9,0x81,0x01,0x09, // ...A.@.......... END
+	0xE2,0x41,0xD2,0x2A,0xDD,0x01,0xD6,0xFB,0x75,0xE1,0xD0,0xD8,0x81,0x00,0x00,0xD9, // .A.*....u....... END
+	0x81,0x01,0x09,0xE2,0x41,0xD2,0x24,0xDD,0x01,0xD6,0xFB,0x75,0xD8,0x81,0x00,0x00, // ....A.$....u.... END
+	0xD9,0x81,0x01,0x09,0xE2,0x41,0xDD,0x01,0xE4,0xFB,0x75,0xD8,0x81,0x00,0x00,0xD9, // .....A....u..... END
+	0x81,0x01,0x09,0xE2,0x40,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x2A,0xF2,0x41,0xF8,0x40, // ....@....u.*.A.@ END
+	0xE1,0xD2,0xD8,0x81,0x00,0x00,0xD9,0x81,0x01,0x09,0xE2,0x40,0xD2,0x2E,0xDD,0x01, // ...........@.... END
+	0xD6,0xFB,0x75,0xE1,0xD0,0xD8,0x81,0x00,0x00,0xD9,0x81,0x01,0x09,0xE2,0x40,0xD2, // ..u...........@. END
+	0x20,0xDD,0x01,0xD6,0xFB,0x75,0xD8,0x81,0x01,0x08,0xE2,0x40,0x41,0xD8,0x81,0x00, // .....u.....@A... END
+	0x00,0xD9,0x81,0x01,0x09,0x70,0xE1,0x80,0x71,0xE1,0x80,0xDD,0x01,0xE4,0xFB,0x75, // .....p..q......u END
+	0xE3,0x80,0x0E,0xE3,0x80,0x06,0xE0,0x40,0xDD,0x01,0xE4,0xFB,0x75,0xD7,0x35,0xD8, // .......@....u.5. END
+	0x81,0x00,0x00,0xD9,0x81,0x01,0x09,0xE0,0x40,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x23, // ........@....u.# END
+	0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1,0x20,0xF2,0x41,0xF8,0x50,0xDF,0x05,0xCA,0xD1, // .A.P.5...A.P.... END
+	0x2E,0xF2,0x41,0xF8,0x50,0xDF,0x05,0xCA,0xD8,0x81,0x00,0x00,0xD9,0x81,0x01,0x09, // ..A.P........... END
+	0xE0,0x41,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x23,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1, // .A....u.#.A.P.5. END
+	0x24,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1,0x2A,0xF2,0x41,0xF8,0x50,0xD7,0x35,0xD1, // $.A.P.5.*.A.P.5. END
+	0x2E,0xF2,0x41,0xF8,0x40,0xE1,0xD2,0xD8,0x81,0x00,0x00,0xD9,0x81,0x01,0x09,0xE0, // ..A.@........... END
+	0x41,0xD2,0x2A,0xDD,0x01,0xD6,0xFB,0x75,0xE1,0xD0,0xD8,0x81,0x00,0x00,0xD9,0x81, // A.*....u........ END
+	0x01,0x09,0xE0,0x41,0xD2,0x24,0xDD,0x01,0xD6,0xFB,0x75,0xD8,0x81,0x00,0x00,0xD9, // ...A.$....u..... END
+	0x81,0x01,0x09,0xE0,0x41,0xDD,0x01,0xE4,0xFB,0x75,0xD8,0x81,0x00,0x00,0xD9,0x81, // ....A....u...... END
+	0x01,0x09,0xE0,0x40,0xDD,0x01,0x8F,0xFB,0x75,0xD1,0x2A,0xF2,0x41,0xF8,0x40,0xE1, // ...@....u.*.A.@. END
+	0xD2,0xD8,0x81,0x00,0x00,0xD9,0x81,0x01,0x09,0xE0,0x40,0xD2,0x2E,0xDD,0x01,0xD6, // ..........@..... END
+	0xFB,0x75,0xE1,0xD0,0xD8,0x81,0x00,0x00,0xD9,0x81,0x01,0x09,0xE0,0x40,0xD2,0x20, // .u...........@.. END
+	0xDD,0x01,0xD6,0xFB,0x75,0xD8,0x81,0x01,0x08,0xE0,0x40,0x41,0xD8,0x81,0x00,0x00, // ....u.....@A.... END
+	0xD9,0x81,0x01,0x09,0x70,0xE1,0x80,0x71,0xE1,0x80,0xDD,0x01,0xE4,0xFB,0x75,0xE3, // ....p..q......u. END
+	0x80,0x0E,0xE3,0x80,0x06,0xE2,0x40,0xDD,0x01,0xE4,0xFB,0x75,0xD7,0x35,0xDD,0x06, // ......@....u.5.. END
+	0x3B,0xFB,0x75,0x81,0xDD,0x06,0x20,0xFB,0x75,0xDD,0x06,0x0C,0xFB,0x75,0x80,0x90, // ;.u.....u....u.. END
+	0xDD,0x06,0x4F,0xFB,0x75,0xFB,0xF4,0xD8,0x0A,0x74,0xDD,0x06,0xCE,0xFB,0x75,0xFB, // ..O.u....t....u. END
+	0xF4,0xD8,0x0A,0x79,0xDD,0x06,0xCE,0xFB,0x75,0xFB,0xF4,0xF2,0x00,0xF8,0x18,0xE1, // ...y....u....... END
+	0xCA,0xC0,0xD8,0x0A,0x8B,0xDD,0x06,0xCE,0xFB,0x75,0xFB,0xF4,0xD8,0x0A,0x92,0xDD, // .........u...... END
+	0x06,0xCE,0xFB,0x75,0xFB,0xF4,0xD8,0x0A,0x86,0xDD,0x06,0xCE,0xFB,0x75,0xFB,0xF4, // ...u.........u.. END
+	0xEE,0xC0,0xD8,0x05,0x03,0x92,0xA0,0xC1,0xFB,0xF4,0xE0,0x00,0xE0,0x40,0x70,0xE1, // .............@p. END
+	0x80,0x71,0xE1,0x80,0xD0,0x1B,0xDD,0x06,0xF5,0xFB,0x75,0xD0,0x5B,0xDD,0x06,0xF5, // .q........u.[... END
+	0xFB,0x75,0xE3,0x80,0x06,0xDD,0x07,0xB3,0xFB,0x75,0xD0,0x3B,0xDD,0x06,0xF5,0xFB, // .u.......u.;.... END
+	0x75,0xE3,0x80,0x06,0xDD,0x07,0xB3,0xFB,0x75,0xD0,0x48,0xDD,0x06,0xF5,0xFB,0x75, // u.......u.H....u END
+	0xFB,0xF4,0x72,0xE1,0x80,0x71,0xE1,0x80,0x70,0xE1,0x80,0xD8,0x0A,0x7E,0xDD,0x06, // ..r..q..p....~.. END
+	0xCE,0xFB,0x75,0xE3,0x80,0x06,0xDD,0x07,0xB3,0xFB,0x75,0xD0,0x3B,0xDD,0x06,0xF5, // ..u.......u.;... END
+	0xFB,0x75,0xE3,0x80,0x06,0xDD,0x07,0xB3,0xFB,0x75,0xD0,0x3B,0xDD,0x06,0xF5,0xFB, // .u.......u.;.... END
+	0x75,0xE3,0x80,0x06,0xDD,0x07,0xB3,0xFB,0x75,0xD0,0x6D,0xDD,0x06,0xF5,0xFB,0x75, // u.......u.m....u END
+	0xFB,0xF4,0xD8,0x01,0x08,0x91,0xC1,0xFB,0xF4,0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE, // ..........@..... END
+	0x40,0x82,0xC0,0x70,0xE1,0x80,0xFB,0x8B,0xFB,0x93,0xEE,0x12,0xDD,0x08,0x04,0xFB, // @..p............ END
+	0x75,0xEF,0x00,0xD8,0x01,0x01,0xFA,0xF4,0xFA,0xB4,0xE3,0x80,0x0E,0xC1,0xFB,0xF4, // u............... END
+	0xEE,0x40,0x80,0xC0,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC3,0xEE,0x89,0x90,0xC0,0xEE, // .@.....@........ END
+	0xF6,0x72,0xE1,0x80,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x01,0xD4,0x01,0xC1,0xE3,0x80, // .r.....@........ END
+	0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40,0xD8,0x01,0x10,0xC1,0xFB,0xF4,0xEE,0x40, // .......@.......@ END
+	0x80,0xC1,0xEE,0xC9,0xEE,0x40,0xEE,0x36,0xD2,0x40,0xE5,0xB2,0x73,0xE1,0x80,0xDD, // .....@.6.@..s... END
+	0x08,0x11,0xFB,0x75,0xE3,0x80,0x16,0xD8,0x01,0x02,0xD1,0x40,0xE6,0x71,0xC1,0xEF, // ...u.......@.q.. END
+	0x89,0xFB,0xF4,0xF2,0x92,0xF8,0x88,0xE1,0xDF,0xAA,0xF3,0x0A,0xF9,0x38,0xDF,0x07, // .............8.. END
+	0xA3,0xD3,0x64,0xF3,0x0B,0xF9,0x38,0xE1,0xF8,0xE8,0xD3,0xF3,0x0B,0xF9,0x38,0xE1, // ..d...8.......8. END
+	0xE3,0xE8,0x93,0xF3,0x0A,0xF9,0x38,0xE1,0xCD,0xDA,0x27,0x10,0xEA,0xCA,0xE9,0x1A, // ......8...'..... END
+	0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xDA,0x03,0xE8,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C, // .L..C..........L END
+	0xE0,0xEF,0x43,0xE0,0x00,0xD2,0x64,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43, // ..C...d.....L..C END
+	0xE0,0x00,0xAA,0xEA,0xCA,0xE9,0x1A,0xE6,0x4C,0xE0,0xEF,0x43,0xE0,0x00,0xE0,0x6F, // ........L..C...o END
+	0x41,0xE0,0x00,0xA0,0x42,0xFB,0xF4,0xEE,0x89,0xEE,0x40,0x82,0xE1,0xC5,0xEE,0x40, // A...B.....@....@ END
+	0x82,0xC0,0xA0,0xC0,0xEE,0xF6,0xE1,0x85,0x70,0xE1,0x80,0x72,0xE1,0x80,0xFB,0x9B, // ........p..r.... END
+	0xEE,0x1B,0xDD,0x07,0x48,0xFB,0x75,0xFA,0xB4,0xE3,0x80,0x0E,0xB5,0xE6,0xD9,0xF2, // ....H.u......... END
+	0x49,0xF8,0x48,0xE4,0x93,0x90,0xE3,0x80,0x06,0xDD,0x06,0xD8,0xFB,0x75,0xE3,0x85, // I.H..........u.. END
+	0xFB,0xF4,0xD9,0x80,0x00,0xF0,0x41,0xF2,0x49,0xF8,0x58,0xE3,0xFE,0xFB,0x83,0xD0, // ......A.I.X..... END
+	0x2D,0xDD,0x06,0xF5,0xFB,0x75,0xFA,0x34,0xFA,0x00,0xE0,0x00,0xDF,0x07,0xB3,0xEE, // -....u.4........ END
+	0xC0,0xEE,0x40,0xD8,0x06,0x01,0xA0,0xC1,0xE6,0x03,0xFB,0xF4,0xFB,0x83,0xFB,0x8B, // ..@............. END
+	0xDD,0x09,0x4D,0xFB,0x75,0xFA,0x74,0xFB,0x8B,0xD8,0x81,0x03,0xDD,0x09,0x4D,0xFB, // ..M.u.t.......M. END
+	0x75,0xFA,0x74,0xFA,0x34,0xFB,0x83,0xFB,0x8B,0xD1,0x2F,0xDD,0x09,0x43,0xFB,0x75, // u.t.4...../..C.u END
+	0xF2,0x80,0xFA,0x74,0xFA,0x34,0xF8,0x88,0xDF,0x08,0xD8,0xEE,0x80,0xEE,0xC9,0xD8, // ...t.4.......... END
+	0x02,0x04,0xC1,0xEE,0x40,0xEE,0x12,0xEE,0x89,0xEE,0x5B,0xFB,0x83,0xFB,0x8B,0xFB, // ....@.....[..... END
+	0x93,0xEE,0x12,0xD1,0x3A,0xDD,0x09,0x43,0xFB,0x75,0xEE,0xC0,0xF3,0x1B,0xFA,0xB4, // ....:..C.u...... END
+	0xFA,0x74,0xFA,0x34,0xF9,0x18,0xDF,0x08,0xD1,0xFB,0x9B,0xFB,0x93,0xFB,0x83,0xFB, // .t.4............ END
+	0x8B,0xD8,0x81,0x03,0xE7,0x1A,0xE4,0x04,0xD4,0x00,0x44,0xD8,0x81,0x03,0xEE,0x52, // ..........D....R END
+	0xE6,0x9A,0xDD,0x09,0x1F,0xFB,0x75,0xD8,0x81,0x03,0xD9,0x0A,0x99,0xDD,0x09,0x2B, // ......u........+ END
+	0xFB,0x75,0xD8,0x81,0x03,0xFA,0x74,0xFB,0x8B,0xDD,0x09,0x2B,0xFB,0x75,0xFA,0x74, // .u....t....+.u.t END
+	0xFA,0x34,0xFA,0xB4,0xFA,0xF4,0xFB,0x83,0xFB,0x8B,0xD8,0x01,0x0A,0xD9,0x81,0x03, // .4.............. END
+	0xC1,0xF3,0x00,0xFA,0x74,0xFA,0x34,0xF9,0x18,0xE1,0xC9,0xD9,0x81,0x03,0xDD,0x09, // ....t.4......... END
+	0x4D,0xFB,0x75,0xFB,0xF4,0xEE,0x9B,0xE0,0x80,0xDF,0x08,0x50,0xDD,0x08,0xE5,0xFB, // M.u........P.... END
+	0x75,0xFB,0xF4,0xDD,0x08,0xE5,0xFB,0x75,0xFB,0xF4,0xD8,0x02,0x02,0xC1,0xFB,0xF4, // u......u........ END
+	0xA0,0x42,0x11,0xD3,0x2F,0xF2,0x93,0xF8,0x90,0xE1,0xE7,0xFB,0x8B,0xFB,0x83,0xDD, // .B../........... END
+	0x08,0xDF,0xFB,0x75,0xEE,0x40,0xFA,0x34,0xFB,0x83,0xDD,0x09,0x4D,0xFB,0x75,0xFA, // ...u.@.4....M.u. END
+	0x34,0xFA,0x74,0xFB,0x83,0xFB,0x8B,0xD9,0x0A,0x9B,0xDD,0x09,0x2B,0xFB,0x75,0xFA, // 4.t.........+.u. END
+	0x74,0xFA,0x34,0xDD,0x09,0x2B,0xFB,0x75,0xFB,0xF4,0xEE,0xD2,0xEE,0x89,0xEE,0x40, // t.4..+.u.......@ END
+	0xD8,0x06,0x02,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xDD,0x08,0x04,0xFB,0x75,0xEE, // ..............u. END
+	0x80,0xFA,0x74,0xFA,0x34,0xE4,0x02,0xDD,0x09,0x4D,0xFB,0x75,0xFB,0xF4,0xEE,0x89, // ..t.4....M.u.... END
+	0xEE,0x40,0xD8,0x06,0x00,0xC1,0xFB,0xF4,0xFB,0x83,0xFB,0x8B,0xEE,0x09,0xDD,0x08, // .@.............. END
+	0x04,0xFB,0x75,0xEE,0x80,0xE0,0x80,0xFA,0x74,0xFA,0x34,0xDD,0x09,0x1F,0xFB,0x75, // ..u.....t.4....u END
+	0xFB,0xF4,0x0A,0x0A,0x77,0x61,0x73,0x64,0x20,0x6D,0x6F,0x76,0x65,0x2F,0x70,0x75, // ....wasd.move/pu END
+	0x73,0x68,0x2C,0x20,0x72,0x20,0x72,0x65,0x64,0x72,0x61,0x77,0x2C,0x20,0x71,0x20, // sh,.r.redraw,.q. END
+	0x71,0x75,0x69,0x74,0x0A,0x1B,0x5B,0x33,0x30,0x3B,0x31,0x6D,0x23,0x1B,0x5B,0x30, // quit..[30;1m#.[0 END
+	0x6D,0x20,0x77,0x61,0x6C,0x6C,0x2C,0x20,0x1B,0x5B,0x33,0x33,0x3B,0x31,0x6D,0x40, // m.wall,..[33;1m@ END
+	0x1B,0x5B,0x30,0x6D,0x20,0x70,0x6C,0x61,0x79,0x65,0x72,0x2C,0x20,0x1B,0x5B,0x33, // .[0m.player,..[3 END
+	0x33,0x3B,0x31,0x6D,0x2B,0x1B,0x5B,0x30,0x6D,0x20,0x70,0x6C,0x61,0x79,0x65,0x72, // 3;1m+.[0m.player END
+	0x2D,0x6F,0x6E,0x2D,0x67,0x6F,0x61,0x6C,0x2C,0x20,0x1B,0x5B,0x33,0x38,0x3B,0x35, // -on-goal,..[38;5 END
+	0x3B,0x31,0x33,0x30,0x6D,0x24,0x1B,0x5B,0x30,0x6D,0x20,0x62,0x6F,0x78,0x2C,0x20, // ;130m$.[0m.box,. END
+	0x1B,0x5B,0x33,0x32,0x3B,0x31,0x6D,0x2A,0x1B,0x5B,0x30,0x6D,0x20,0x62,0x6F,0x78, // .[32;1m*.[0m.box END
+	0x20,0x6F,0x6E,0x20,0x67,0x6F,0x61,0x6C,0x2C,0x20,0x1B,0x5B,0x33,0x33,0x3B,0x31, // .on.goal,..[33;1 END
+	0x6D,0x2E,0x1B,0x5B,0x30,0x6D,0x20,0x67,0x6F,0x61,0x6C,0x0A,0x0A,0x00,0x75,0x73, // m..[0m.goal...us END
+	0x61,0x67,0x65,0x3A,0x20,0x73,0x6F,0x6B,0x6F,0x62,0x61,0x6E,0x20,0x4C,0x45,0x56, // age:.sokoban.LEV END
+	0x45,0x4C,0x50,0x41,0x54,0x48,0x0A,0x00,0x65,0x72,0x72,0x6F,0x72,0x3A,0x20,0x63, // ELPATH..error:.c END
+	0x6F,0x75,0x6C,0x64,0x20,0x6E,0x6F,0x74,0x20,0x6C,0x6F,0x61,0x64,0x20,0x67,0x69, // ould.not.load.gi END
+	0x76,0x65,0x6E,0x20,0x6C,0x65,0x76,0x65,0x6C,0x0A,0x00,0x1B,0x5B,0x33,0x33,0x3B, // ven.level...[33; END
+	0x31,0x6D,0x00,0x1B,0x5B,0x33,0x30,0x3B,0x31,0x6D,0x00,0x1B,0x5B,0x33,0x38,0x3B, // 1m..[30;1m..[38; END
+	0x35,0x3B,0x31,0x33,0x30,0x6D,0x00,0x1B,0x5B,0x33,0x32,0x3B,0x31,0x6D,0x00,0x1B, // 5;130m..[32;1m.. END
+	0x5B,0x32,0x4A,0x00,0x1B,0x5B,0x32,0x4B,0x00,0x1B,0x5B,0x33,0x38,0x3B,0x32,0x3B, // [2J..[2K..[38;2; END
+	0x00,0x1B,0x5B,0x30,0x6D,0x00,0x1B,0x5B,0x3F,0x32,0x35,0x68,0x00,0x1B,0x5B,0x3F, // ..[0m..[?25h..[? END
+	0x32,0x35,0x6C,0x00,0x2F,0x00,0x2F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, // 25l././......... END
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF // ................ END
+};
+#endif
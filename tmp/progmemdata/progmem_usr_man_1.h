@@ -0,0 +1,733 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_usr_man_1_H
+#define PROGMEM_usr_man_1_H
+
+#include <stdint.h>
+
+#define PROGMEM_usr_man_1DATASIZE 11431u
+#define PROGMEM_usr_man_1COMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_usr_man_1DATAPTR ((uint32_t)pgm_get_far_address(progmem_usr_man_1Data))
+static const uint8_t progmem_usr_man_1Data[PROGMEM_usr_man_1DATASIZE] PROGMEM ={
+#else
+#define PROGMEM_usr_man_1DATAPTR ((uintptr_t)progmem_usr_man_1Data)
+static const uint8_t progmem_usr_man_1Data[PROGMEM_usr_man_1DATASIZE]={
+#endif
+	0x5A,0x3B,0x00,0x00,0x7B,0x01,0x20,0x01,0xEC,0x02,0xCB,0x03,0x96,0x04,0x54,0x05, // Z;..{.........T. END
+	0x0A,0x05,0xC3,0x06,0x72,0x07,0x2E,0x07,0xEF,0x08,0xAE,0x09,0x56,0x0A,0x18,0x0A, // ....r.......V... END
+	0xE1,0x0B,0x9E,0x0C,0x68,0x0D,0x26,0x0D,0xF8,0x0E,0xB2,0x0F,0x65,0x10,0x26,0x10, // ....h.&.....e.&. END
+	0xCB,0x11,0x20,0x11,0xD7,0x12,0x98,0x13,0x7B,0x14,0x61,0x15,0x3A,0x15,0xF4,0x16, // ........{.a.:... END
+	0xC6,0x17,0x8B,0x18,0x4D,0x19,0x2D,0x1A,0x06,0x1A,0xF4,0x1B,0xD3,0x1C,0x82,0x1D, // ....M.-......... END
+	0x2B,0x1D,0xEA,0x1E,0xA2,0x1F,0x5D,0x20,0x2E,0x20,0xE5,0x21,0xA6,0x22,0x44,0x23, // +.....]....!."D# END
+	0x17,0x23,0xD0,0x24,0x74,0x25,0x3C,0x25,0xFC,0x26,0xC3,0x27,0x77,0x28,0x36,0x28, // .#.$t%<%.&.'w(6( END
+	0xF9,0x29,0xA7,0x2A,0x79,0x2B,0x30,0x2B,0xF0,0x2C,0xA7,0x2D,0x26,0xEB,0x02,0x0E, // .).*y+0+.,.-&... END
+	0x11,0x14,0x17,0x27,0x2C,0x30,0x36,0x3A,0x3E,0x43,0x4A,0x4E,0x51,0x5C,0x5F,0x62, // ...',06:>CJNQ\_b END
+	0x66,0x6B,0x72,0x76,0x7B,0x7E,0x82,0x92,0x98,0x9C,0xA2,0xA6,0xA9,0xAD,0xB4,0xB9, // fkrv{~.......... END
+	0xBC,0xC0,0xC9,0xCD,0xD0,0xD4,0xDA,0xE4,0xE8,0x00,0xCF,0x00,0x32,0x02,0xDD,0x0C, // ............2... END
+	0x68,0x77,0x64,0x68,0x74,0x32,0x32,0x6D,0x6E,0x74,0x00,0x48,0x57,0x44,0x48,0x54, // hwdht22mnt.HWDHT END
+	0x32,0x32,0x4D,0x4E,0x54,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20, // 22MNT(1).-.User. END
+	0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20, // Commands..NAME.. END
+	0x82,0x00,0x87,0x34,0x80,0x26,0x02,0x4D,0x6F,0x75,0x80,0x07,0x01,0x61,0x20,0x82, // ...4.&.Mou...a.. END
+	0x3C,0x0C,0x20,0x73,0x65,0x6E,0x73,0x6F,0x72,0x20,0x75,0x73,0x69,0x6E,0x67,0x80, // <..sensor.using. END
+	0x14,0x1D,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x48,0x57,0x20, // ..registered.HW. END
+	0x64,0x65,0x76,0x69,0x63,0x65,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53, // device..SYNOPSIS END
+	0x01,0x0A,0x20,0x82,0x00,0x15,0x68,0x77,0x64,0x68,0x74,0x32,0x32,0x6D,0x6E,0x74, // ......hwdht22mnt END
+	0x20,0x69,0x64,0x20,0x6D,0x6F,0x75,0x6E,0x74,0x70,0x6F,0x69,0x81,0x0D,0x1A,0x6E, // .id.mountpoi...n END
+	0x74,0x65,0x72,0x76,0x61,0x6C,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x0A,0x0A,0x44, // tervalseconds..D END
+	0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x3B,0x0A,0x41,0x74,0x74, // ESCRIPTION.;.Att END
+	0x65,0x6D,0x70,0x74,0x73,0x20,0x74,0x6F,0x83,0x39,0x11,0x20,0x61,0x20,0x44,0x48, // empts.to.9..a.DH END
+	0x54,0x32,0x32,0x20,0x73,0x65,0x6E,0x73,0x6F,0x72,0x20,0x61,0x73,0x80,0x11,0x05, // T22.sensor.as... END
+	0x63,0x68,0x61,0x72,0x61,0x63,0x80,0x4C,0x13,0x20,0x64,0x65,0x76,0x69,0x63,0x65, // charac.L..device END
+	0x20,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6E,0x84,0x37,0x82, // .at.the.given.7. END
+	0x72,0x06,0x2C,0x20,0x75,0x73,0x69,0x6E,0x67,0x82,0x1C,0x01,0x48,0x57,0x85,0x2D, // r.,.using...HW.- END
+	0x03,0x77,0x69,0x74,0x68,0x88,0x2F,0x0A,0x69,0x64,0x2E,0x20,0x52,0x65,0x71,0x75, // .with./.id..Requ END
+	0x69,0x72,0x65,0x80,0x77,0x00,0x68,0x80,0x4B,0x01,0x73,0x61,0x80,0xB8,0x87,0x2F, // ire.w.h.K.sa.../ END
+	0x00,0x68,0x80,0x74,0x01,0x62,0x65,0x80,0x59,0x04,0x72,0x65,0x67,0x69,0x73,0x80, // .h.t.be.Y.regis. END
+	0xC3,0x01,0x65,0x64,0x83,0x87,0x89,0x99,0x02,0x2E,0x0A,0x20,0x00,0x20,0x81,0x00, // ..ed............ END
+	0x2F,0x54,0x68,0x65,0x20,0x73,0x65,0x6E,0x73,0x6F,0x72,0x20,0x69,0x73,0x20,0x74, // /The.sensor.is.t END
+	0x68,0x65,0x6E,0x20,0x73,0x61,0x6D,0x70,0x6C,0x65,0x64,0x20,0x65,0x76,0x65,0x72, // hen.sampled.ever END
+	0x79,0x20,0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x73,0x65,0x63,0x6F,0x6E,0x64, // y.intervalsecond END
+	0x73,0x80,0x2C,0x83,0x07,0x0B,0x28,0x61,0x74,0x20,0x6C,0x65,0x61,0x73,0x74,0x20, // s.,...(at.least. END
+	0x32,0x29,0x80,0x24,0x81,0x3A,0x10,0x20,0x62,0x61,0x63,0x6B,0x67,0x72,0x6F,0x75, // 2).$.:..backgrou END
+	0x6E,0x64,0x2E,0x20,0x45,0x61,0x63,0x68,0x84,0x4A,0x10,0x20,0x63,0x61,0x6E,0x20, // nd..Each.J..can. END
+	0x62,0x65,0x20,0x72,0x65,0x61,0x64,0x20,0x66,0x72,0x6F,0x6D,0x82,0x2C,0x00,0x6D, // be.read.from.,.m END
+	0x80,0x27,0x03,0x74,0x20,0x70,0x6F,0x80,0x60,0x0B,0x20,0x61,0x73,0x20,0x38,0x20, // .'.t.po.`..as.8. END
+	0x62,0x79,0x74,0x65,0x73,0x3A,0x82,0x48,0x80,0x29,0x05,0x6C,0x20,0x74,0x69,0x6D, // bytes:.H.).l.tim END
+	0x65,0x81,0x59,0x86,0x71,0x07,0x33,0x32,0x20,0x62,0x69,0x74,0x29,0x2C,0x83,0xA6, // e.Y.q.32.bit),.. END
+	0x81,0x70,0x0E,0x74,0x65,0x6D,0x70,0x65,0x72,0x61,0x74,0x75,0x72,0x65,0x20,0x61, // .p.temperature.a END
+	0x6E,0x64,0x82,0x84,0x0B,0x68,0x75,0x6D,0x69,0x64,0x69,0x74,0x79,0x20,0x28,0x31, // nd...humidity.(1 END
+	0x36,0x81,0x2F,0x01,0x20,0x65,0x80,0x89,0x80,0x33,0x80,0x4D,0x03,0x73,0x20,0x31, // 6./..e...3.M.s.1 END
+	0x30,0x80,0x3E,0x02,0x61,0x6C,0x6C,0x80,0x48,0x00,0x67,0x23,0x20,0x65,0x6E,0x64, // 0.>.all.H.g#.end END
+	0x69,0x61,0x6E,0x2E,0x20,0x53,0x61,0x6D,0x70,0x6C,0x65,0x73,0x20,0x61,0x72,0x65, // ian..Samples.are END
+	0x20,0x64,0x72,0x6F,0x70,0x70,0x65,0x64,0x20,0x69,0x66,0x20,0x74,0x68,0x65,0x79, // .dropped.if.they END
+	0x82,0x13,0x0C,0x6E,0x6F,0x74,0x20,0x72,0x65,0x61,0x64,0x20,0x62,0x65,0x66,0x6F, // ...not.read.befo END
+	0x80,0x23,0x80,0x18,0x21,0x20,0x6B,0x65,0x72,0x6E,0x65,0x6C,0x27,0x73,0x20,0x73, // .#..!.kernel's.s END
+	0x6D,0x61,0x6C,0x6C,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x69,0x6C,0x6C, // mall.buffer.fill END
+	0x73,0x20,0x75,0x70,0x2E,0x0A,0xFF,0x9F,0x00,0x0F,0x00,0xBE,0x03,0x72,0x6D,0x00, // s.up.........rm. END
+	0x52,0x4D,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x80,0x3F,0x0F,0x43,0x6F,0x6D, // RM(1).-.Us.?.Com END
+	0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x01, // mands..NAME..... END
+	0x72,0x6D,0x80,0x1E,0x05,0x72,0x65,0x6D,0x6F,0x76,0x65,0x81,0x60,0x0A,0x65,0x0A, // rm...remove.`.e. END
+	0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x87,0x20,0x83,0x17,0x0A,0x44,0x45, // .SYNOPSIS.....DE END
+	0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x3B,0x04,0x44,0x65,0x6C,0x65, // SCRIPTION.;.Dele END
+	0x74,0x80,0xDA,0x04,0x67,0x69,0x76,0x65,0x6E,0x82,0x3D,0x09,0x2C,0x20,0x77,0x68, // t...given.=.,.wh END
+	0x69,0x63,0x68,0x20,0x63,0x61,0x26,0x6E,0x20,0x62,0x65,0x20,0x61,0x20,0x64,0x69, // ich.ca&n.be.a.di END
+	0x72,0x65,0x63,0x74,0x6F,0x72,0x79,0x20,0x28,0x69,0x6E,0x20,0x77,0x68,0x69,0x63, // rectory.(in.whic END
+	0x68,0x20,0x63,0x61,0x73,0x65,0x20,0x69,0x74,0x20,0x6D,0x75,0x73,0x74,0x81,0x25, // h.case.it.must.% END
+	0x41,0x65,0x6D,0x70,0x74,0x79,0x20,0x74,0x6F,0x20,0x73,0x75,0x63,0x63,0x65,0x65, // Aempty.to.succee END
+	0x64,0x29,0x2E,0x0A,0xFF,0xFF,0x00,0xA5,0x03,0x75,0x6E,0x6D,0x6F,0x75,0x6E,0x74, // d).......unmount END
+	0x00,0x55,0x4E,0x4D,0x4F,0x55,0x4E,0x54,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73, // .UNMOUNT(1).-.Us END
+	0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D, // er.Commands..NAM END
+	0x45,0x0A,0x20,0x82,0x00,0x84,0x2E,0x80,0x23,0x85,0x09,0x09,0x66,0x69,0x6C,0x65, // E.......#...file END
+	0x73,0x79,0x73,0x74,0x65,0x6D,0x80,0x29,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49, // system.).SYNOPSI END
+	0x53,0x8C,0x2D,0x80,0xA0,0x0C,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54, // S.-.....DESCRIPT END
+	0x49,0x4F,0x4E,0x84,0x4C,0x00,0x55,0x83,0x7B,0x0A,0x73,0x20,0x74,0x68,0x65,0x20, // ION.L.U.{.s.the. END
+	0x67,0x69,0x76,0x65,0x6E,0x81,0xCA,0x05,0x2C,0x20,0x73,0x65,0x65,0x20,0x85,0x8D, // given...,.see... END
+	0x81,0xA6,0x96,0x01,0x2A,0x00,0xB6,0x03,0x65,0x64,0x69,0x74,0x6F,0x72,0x00,0x45, // ....*...editor.E END
+	0x44,0x49,0x54,0x4F,0x52,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20, // DITOR(1).-.User. END
+	0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20, // Commands..NAME.. END
+	0x82,0x00,0x83,0x2C,0x80,0x22,0x0F,0x69,0x6E,0x74,0x65,0x72,0x61,0x63,0x74,0x69, // ...,.".interacti END
+	0x76,0x65,0x20,0x74,0x65,0x78,0x74,0x84,0x19,0x09,0x0A,0x0A,0x53,0x59,0x4E,0x4F, // ve.text.....SYNO END
+	0x50,0x53,0x49,0x53,0x8B,0x30,0x10,0x46,0x49,0x4C,0x45,0x0A,0x0A,0x44,0x45,0x53, // PSIS.0.FILE..DES END
+	0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x4F,0x0A,0x50,0x72,0x6F,0x76,0x69, // CRIPTION.O.Provi END
+	0x64,0x65,0x73,0x20,0x61,0x6E,0x83,0x52,0x02,0x66,0x61,0x63,0x80,0x50,0x07,0x6F, // des.an.R.fac.P.o END
+	0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x80,0x16,0x00,0x64,0x82,0x73,0x83,0x63,0x08, // .create...d.s.c. END
+	0x66,0x69,0x6C,0x65,0x73,0x2E,0x0A,0x0A,0xFF,0x86,0x00,0x0F,0x03,0xF4,0x10,0x73, // files..........s END
+	0x69,0x67,0x6E,0x61,0x6C,0x00,0x53,0x49,0x47,0x4E,0x41,0x4C,0x9D,0xBF,0x83,0x2C, // ignal.SIGNAL..., END
+	0x80,0xE2,0x01,0x73,0x65,0x80,0x59,0x01,0x61,0x20,0x1E,0x73,0x69,0x67,0x6E,0x61, // ...se.Y.a..signa END
+	0x6C,0x20,0x74,0x6F,0x20,0x61,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x0A,0x0A, // l.to.a.process.. END
+	0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x0A,0x20,0x82,0x00,0x84,0x23,0x02,0x70, // SYNOPSIS.....#.p END
+	0x69,0x64,0x84,0x0A,0x0E,0x69,0x64,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50, // id...id..DESCRIP END
+	0x54,0x49,0x4F,0x4E,0x84,0x26,0x0D,0x53,0x65,0x6E,0x64,0x20,0x74,0x68,0x65,0x20, // TION.&.Send.the. END
+	0x67,0x69,0x76,0x65,0x6E,0x85,0x35,0x80,0x59,0x81,0x13,0x84,0x5B,0x0E,0x20,0x72, // given.5.Y...[..r END
+	0x65,0x70,0x72,0x65,0x73,0x65,0x6E,0x74,0x65,0x64,0x20,0x62,0x79,0x88,0x2E,0x80, // epresented.by... END
+	0x5D,0x01,0x2E,0x0A,0x84,0x70,0x00,0x54,0x80,0x44,0x08,0x66,0x6F,0x6C,0x6C,0x6F, // ]....p.T.D.follo END
+	0x77,0x69,0x6E,0x67,0x84,0x7E,0x0F,0x73,0x20,0x61,0x72,0x65,0x20,0x61,0x76,0x61, // wing.~.s.are.ava END
+	0x69,0x6C,0x61,0x62,0x6C,0x65,0x3A,0x84,0x9B,0x08,0x49,0x64,0x20,0x7C,0x20,0x4E, // ilable:...Id.|.N END
+	0x61,0x6D,0x65,0x83,0xAA,0x0C,0x7C,0x20,0x44,0x65,0x73,0x63,0x72,0x69,0x70,0x74, // ame...|.Descript END
+	0x69,0x6F,0x6E,0x84,0xBE,0x03,0x2D,0x2D,0x2D,0x7C,0x80,0x03,0x85,0x02,0x89,0x0B, // ion...---|...... END
+	0x01,0x2D,0x2D,0x01,0x0A,0x20,0x83,0x00,0x0C,0x30,0x20,0x7C,0x20,0x49,0x6E,0x74, // .--......0.|.Int END
+	0x65,0x72,0x72,0x75,0x70,0x74,0x80,0x0B,0x2F,0x53,0x65,0x6E,0x74,0x20,0x74,0x6F, // errupt../Sent.to END
+	0x20,0x61,0x6C,0x6C,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x65,0x73,0x20,0x77, // .all.processes.w END
+	0x68,0x69,0x63,0x68,0x20,0x68,0x61,0x76,0x65,0x20,0x2F,0x64,0x65,0x76,0x2F,0x74, // hich.have./dev/t END
+	0x74,0x79,0x53,0x30,0x20,0x6F,0x70,0x65,0x6E,0x85,0x47,0x00,0x20,0x80,0x47,0x87, // tyS0.open.G...G. END
+	0x00,0x07,0x7C,0x20,0x28,0x67,0x65,0x6E,0x65,0x72,0x80,0x45,0x03,0x79,0x20,0x6F, // ..|.(gener.E.y.o END
+	0x6E,0x80,0x04,0x09,0x74,0x68,0x65,0x20,0x73,0x68,0x65,0x6C,0x6C,0x2C,0x84,0x4C, // n...the.shell,.L END
+	0x80,0x10,0x06,0x6E,0x20,0x6B,0x69,0x6C,0x6C,0x73,0x81,0x1B,0x95,0x46,0x09,0x66, // ...n.kills...F.f END
+	0x6F,0x72,0x65,0x67,0x72,0x6F,0x75,0x6E,0x64,0x85,0x8D,0x08,0x2C,0x20,0x69,0x66, // oreground...,.if END
+	0x20,0x61,0x6E,0x79,0x29,0x80,0x94,0x80,0x41,0x81,0x57,0x03,0x75,0x73,0x65,0x72, // .any)...A.W.user END
+	0x80,0xAC,0x82,0xAA,0x95,0x8F,0x06,0x43,0x74,0x72,0x6C,0x2B,0x43,0x2E,0x85,0xF6, // .......Ctrl+C... END
+	0x00,0x31,0x08,0x20,0x7C,0x20,0x55,0x73,0x65,0x72,0x31,0x20,0x81,0x00,0x85,0x0B, // .1..|.User1..... END
+	0x02,0x61,0x6E,0x64,0x82,0x15,0x1B,0x32,0x20,0x61,0x72,0x65,0x20,0x73,0x69,0x67, // .and...2.are.sig END
+	0x6E,0x61,0x6C,0x73,0x20,0x6E,0x6F,0x74,0x20,0x75,0x73,0x65,0x64,0x20,0x62,0x79, // nals.not.used.by END
+	0x20,0x74,0x68,0x80,0x17,0x05,0x79,0x73,0x74,0x65,0x6D,0x0A,0x82,0x39,0x83,0x3D, // .th...ystem..9.= END
+	0x87,0x00,0x00,0x7C,0x82,0x43,0x01,0x69,0x6E,0x80,0x21,0x01,0x61,0x64,0x82,0x45, // ...|.C.in.!.ad.E END
+	0x01,0x72,0x65,0x80,0x66,0x00,0x76,0x80,0x3D,0x02,0x66,0x6F,0x72,0x81,0x46,0x04, // .re.f.v.=.for.F. END
+	0x72,0x73,0x70,0x61,0x63,0x85,0x5C,0x04,0x6C,0x69,0x6E,0x67,0x2E,0x85,0x49,0x00, // rspac.\.ling..I. END
+	0x32,0x84,0x93,0x00,0x32,0x84,0x93,0x02,0x53,0x65,0x65,0x83,0xA3,0x86,0x21,0x00, // 2...2...See...!. END
+	0x33,0x81,0x15,0x05,0x75,0x69,0x63,0x69,0x64,0x65,0x82,0xB5,0x00,0x54,0x80,0x8D, // 3...uicide...T.. END
+	0x05,0x72,0x65,0x63,0x65,0x69,0x76,0x80,0x47,0x21,0x20,0x70,0x72,0x6F,0x63,0x65, // .receiv.G!.proce END
+	0x73,0x73,0x20,0x69,0x73,0x20,0x74,0x6F,0x20,0x74,0x69,0x64,0x79,0x20,0x75,0x70, // ss.is.to.tidy.up END
+	0x20,0x28,0x63,0x6C,0x6F,0x73,0x65,0x20,0x66,0x69,0x6C,0x65,0x89,0xB2,0x00,0x20, // .(close.file.... END
+	0x86,0x00,0x2A,0x7C,0x20,0x64,0x65,0x73,0x63,0x72,0x69,0x70,0x74,0x6F,0x72,0x73, // ..*|.descriptors END
+	0x2C,0x20,0x65,0x74,0x63,0x2E,0x29,0x20,0x61,0x6E,0x64,0x20,0x63,0x61,0x6C,0x6C, // ,.etc.).and.call END
+	0x20,0x65,0x78,0x69,0x74,0x2C,0x20,0x61,0x73,0x20,0x73,0x6F,0x6F,0x6E,0x81,0x07, // .exit,.as.soon.. END
+	0x08,0x70,0x6F,0x73,0x73,0x69,0x62,0x6C,0x65,0x0A,0x88,0x40,0x89,0x4C,0x05,0x28, // .possible..@.L.( END
+	0x69,0x74,0x20,0x77,0x69,0x80,0x39,0x13,0x70,0x72,0x6F,0x62,0x61,0x62,0x6C,0x79, // it.wi.9.probably END
+	0x20,0x62,0x65,0x20,0x66,0x6F,0x72,0x63,0x65,0x66,0x75,0x6C,0x80,0x0D,0x00,0x6B, // .be.forceful...k END
+	0x80,0x1B,0x0F,0x65,0x64,0x20,0x61,0x20,0x66,0x65,0x77,0x20,0x73,0x65,0x63,0x6F, // ...ed.a.few.seco END
+	0x6E,0x64,0x73,0x95,0x4B,0x04,0x6C,0x61,0x74,0x65,0x72,0x80,0x8B,0x07,0x79,0x77, // nds.K.later...yw END
+	0x61,0x79,0x29,0x2E,0x0A,0xFF,0x88,0x00,0x15,0x01,0x29,0x05,0x77,0x61,0x74,0x63, // ay).......).watc END
+	0x68,0x00,0x57,0x41,0x54,0x43,0x48,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x80, // h.WATCH(1).-.Us. END
+	0x2D,0x03,0x43,0x6F,0x6D,0x6D,0x80,0xBD,0x06,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45, // -.Comm...s..NAME END
+	0x84,0xA5,0x82,0x2A,0x80,0x21,0x01,0x72,0x75,0x80,0xC3,0x81,0x99,0x00,0x67,0x26, // ...*.!.ru.....g& END
+	0x72,0x61,0x6D,0x20,0x72,0x65,0x70,0x65,0x61,0x74,0x65,0x64,0x6C,0x79,0x20,0x77, // ram.repeatedly.w END
+	0x69,0x74,0x68,0x20,0x61,0x20,0x64,0x65,0x6C,0x61,0x79,0x0A,0x0A,0x53,0x59,0x4E, // ith.a.delay..SYN END
+	0x4F,0x50,0x53,0x49,0x53,0x0A,0x20,0x82,0x00,0x12,0x77,0x61,0x74,0x63,0x68,0x20, // OPSIS.....watch. END
+	0x69,0x6E,0x74,0x65,0x72,0x76,0x61,0x6C,0x20,0x70,0x72,0x6F,0x67,0x81,0x3E,0x00, // interval.prog.>. END
+	0x5B,0x84,0x08,0x03,0x61,0x72,0x67,0x31,0x89,0x0C,0x13,0x32,0x20,0x2E,0x2E,0x2E, // [...arg1...2.... END
+	0x5D,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84, // ]]..DESCRIPTION. END
+	0x49,0x0D,0x52,0x75,0x6E,0x73,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6E, // I.Runs.the.given END
+	0x86,0x49,0x00,0x28,0x82,0x7E,0x87,0x17,0x80,0x51,0x04,0x73,0x2C,0x20,0x69,0x66, // .I.(.~...Q.s,.if END
+	0x80,0x6A,0x0C,0x65,0x73,0x65,0x6E,0x74,0x29,0x20,0x69,0x6D,0x6D,0x65,0x64,0x69, // .j.esent).immedi END
+	0x80,0xAC,0x12,0x6C,0x79,0x2C,0x20,0x61,0x6E,0x64,0x20,0x61,0x67,0x61,0x69,0x6E, // ...ly,.and.again END
+	0x20,0x65,0x76,0x65,0x72,0x79,0x87,0x99,0x05,0x73,0x65,0x63,0x6F,0x6E,0x64,0x82, // .every...second. END
+	0x61,0x03,0x72,0x65,0x61,0x66,0x80,0xAF,0x02,0x2E,0x0A,0xFF,0x93,0x00,0x26,0x00, // a.reaf........&. END
+	0xD1,0x04,0x68,0x61,0x73,0x68,0x00,0x48,0x41,0x53,0x48,0x28,0x31,0x29,0x20,0x2D, // ..hash.HASH(1).- END
+	0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A, // .User.Commands.. END
+	0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x81,0x28,0x80,0x20,0x04,0x70,0x72,0x69, // NAME.....(...pri END
+	0x6E,0x74,0x83,0x0C,0x0E,0x6F,0x66,0x20,0x66,0x69,0x6C,0x65,0x20,0x63,0x6F,0x6E, // nt...of.file.con END
+	0x74,0x65,0x6E,0x74,0x80,0x2E,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x89, // tent...SYNOPSIS. END
+	0x32,0x05,0x5B,0x46,0x49,0x4C,0x45,0x31,0x83,0x06,0x13,0x32,0x20,0x2E,0x2E,0x2E, // 2.[FILE1...2.... END
+	0x5D,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84, // ]]..DESCRIPTION. END
+	0x5E,0x07,0x46,0x6F,0x72,0x20,0x65,0x61,0x63,0x68,0x83,0x52,0x05,0x67,0x69,0x76, // ^.For.each.R.giv END
+	0x65,0x6E,0x2C,0x84,0x6C,0x07,0x61,0x20,0x34,0x2D,0x64,0x69,0x67,0x69,0x80,0x76, // en,.l.a.4-digi.v END
+	0x01,0x65,0x78,0x86,0x7A,0x02,0x74,0x68,0x65,0x82,0x7E,0x01,0x27,0x73,0x86,0x80, // .ex.z.the.~.'s.. END
+	0x02,0x2E,0x0A,0xFF,0xAB,0x00,0x2C,0x01,0x60,0x06,0x72,0x65,0x6D,0x6F,0x75,0x6E, // ......,.`.remoun END
+	0x74,0x00,0x52,0x45,0x4D,0x4F,0x55,0x4E,0x54,0x28,0x31,0x29,0x20,0x2D,0x20,0x55, // t.REMOUNT(1).-.U END
+	0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41, // ser.Commands..NA END
+	0x4D,0x45,0x0A,0x20,0x82,0x00,0x84,0x2E,0x80,0x23,0x85,0x09,0x09,0x66,0x69,0x6C, // ME.......#...fil END
+	0x65,0x73,0x79,0x73,0x74,0x65,0x6D,0x80,0x29,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53, // esystem.).SYNOPS END
+	0x49,0x53,0x8C,0x2D,0x06,0x6E,0x65,0x77,0x54,0x79,0x70,0x65,0x81,0x07,0x19,0x44, // IS.-.newType...D END
+	0x65,0x76,0x69,0x63,0x65,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x0A,0x0A,0x44,0x45, // evice.target..DE END
+	0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x61,0x09,0x41,0x63,0x74,0x73, // SCRIPTION.a.Acts END
+	0x20,0x61,0x73,0x20,0x75,0x6E,0x82,0x98,0x0F,0x69,0x6E,0x67,0x20,0x74,0x68,0x65, // .as.un...ing.the END
+	0x20,0x6F,0x72,0x69,0x67,0x69,0x6E,0x61,0x6C,0x84,0x39,0x00,0x20,0x80,0x99,0x00, // .original.9..... END
+	0x20,0x8A,0x20,0x87,0x5B,0x03,0x69,0x6E,0x20,0x69,0x80,0x43,0x09,0x70,0x6C,0x61, // ....[.in.i.C.pla END
+	0x63,0x65,0x2E,0x20,0x41,0x6C,0x6C,0x83,0xA3,0x06,0x2F,0x63,0x6F,0x6E,0x74,0x65, // ce..All.../conte END
+	0x6E,0x80,0x5D,0x01,0x6F,0x66,0x84,0x52,0x2C,0x69,0x67,0x69,0x6E,0x61,0x6C,0x20, // n.].of.R,iginal. END
+	0x74,0x61,0x72,0x67,0x65,0x74,0x20,0x61,0x72,0x65,0x20,0x63,0x6F,0x70,0x69,0x65, // target.are.copie END
+	0x64,0x20,0x69,0x6E,0x74,0x6F,0x20,0x74,0x68,0x65,0x20,0x6E,0x65,0x77,0x20,0x6F, // d.into.the.new.o END
+	0x6E,0x65,0x2E,0x0A,0x0A,0x20,0x82,0x00,0x24,0x53,0x65,0x65,0x20,0x4D,0x4F,0x55, // ne......$See.MOU END
+	0x4E,0x54,0x28,0x31,0x29,0x20,0x66,0x6F,0x72,0x20,0x61,0x20,0x6C,0x69,0x73,0x74, // NT(1).for.a.list END
+	0x20,0x6F,0x66,0x20,0x76,0x61,0x6C,0x69,0x64,0x20,0x74,0x79,0x70,0x65,0x81,0x0A, // .of.valid.type.. END
+	0x05,0x75,0x65,0x73,0x2E,0x0A,0xFF,0x9C,0x00,0x07,0x00,0xC5,0x04,0x63,0x70,0x00, // .ues.........cp. END
+	0x43,0x50,0x81,0x4C,0x14,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D, // CP.L.-.User.Comm END
+	0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x84,0x75,0x01,0x63,0x70,0x80, // ands..NAME.u.cp. END
+	0x1E,0x80,0x9A,0x05,0x79,0x20,0x66,0x69,0x6C,0x65,0x80,0x1B,0x07,0x53,0x59,0x4E, // ....y.file...SYN END
+	0x4F,0x50,0x53,0x49,0x53,0x87,0x1F,0x17,0x73,0x6F,0x75,0x72,0x63,0x65,0x20,0x64, // OPSIS...source.d END
+	0x65,0x73,0x74,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E, // est..DESCRIPTION END
+	0x84,0xB7,0x00,0x43,0x81,0x3C,0x84,0x23,0x81,0x43,0x00,0x20,0x80,0xDF,0x01,0x64, // ...C.<.#.C.....d END
+	0x65,0x05,0x73,0x74,0x20,0x28,0x64,0x65,0x80,0x05,0x18,0x63,0x61,0x6E,0x6E,0x6F, // e.st.(de...canno END
+	0x74,0x20,0x62,0x65,0x20,0x70,0x61,0x72,0x74,0x69,0x61,0x6C,0x20,0x2D,0x20,0x69, // t.be.partial.-.i END
+	0x74,0x20,0x6D,0x75,0x80,0x21,0x0E,0x73,0x70,0x65,0x63,0x69,0x66,0x79,0x20,0x61, // t.mu.!.specify.a END
+	0x20,0x66,0x69,0x6C,0x65,0x20,0x81,0x27,0x0D,0x61,0x20,0x64,0x69,0x72,0x65,0x63, // .file..'.a.direc END
+	0x74,0x6F,0x72,0x79,0x29,0x0A,0xFF,0xB7,0x00,0x0A,0x00,0xE9,0x04,0x70,0x73,0x00, // tory)........ps. END
+	0x50,0x53,0x28,0x31,0x29,0x80,0x70,0x14,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D, // PS(1).p.User.Com END
+	0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x01, // mands..NAME..... END
+	0x70,0x73,0x80,0x8F,0x29,0x64,0x69,0x73,0x70,0x6C,0x61,0x79,0x20,0x69,0x6E,0x66, // ps..)display.inf END
+	0x6F,0x20,0x6F,0x6E,0x20,0x63,0x75,0x72,0x72,0x65,0x6E,0x74,0x6C,0x79,0x20,0x72, // o.on.currently.r END
+	0x75,0x6E,0x6E,0x69,0x6E,0x67,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x65,0x80, // unning.processe. END
+	0x3C,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x86,0x40,0x0C,0x0A,0x0A,0x44, // <.SYNOPSIS.@...D END
+	0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x56,0x00,0x4C,0x1A,0x69, // ESCRIPTION.V.L.i END
+	0x73,0x74,0x73,0x20,0x61,0x6C,0x6C,0x20,0x72,0x75,0x6E,0x6E,0x69,0x6E,0x67,0x20, // sts.all.running. END
+	0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x65,0x73,0x2C,0x80,0x16,0x00,0x6F,0x80,0x10, // processes,...o.. END
+	0x0F,0x73,0x75,0x63,0x68,0x20,0x69,0x6E,0x66,0x6F,0x72,0x6D,0x61,0x74,0x69,0x6F, // .such.informatio END
+	0x6E,0x83,0x10,0x0C,0x61,0x73,0x20,0x74,0x68,0x65,0x69,0x72,0x20,0x73,0x74,0x61, // n...as.their.sta END
+	0x74,0x81,0x2C,0x02,0x52,0x41,0x4D,0x81,0x47,0x01,0x6F,0x63,0x82,0x24,0x80,0x53, // t.,.RAM.G.oc.$.S END
+	0x0F,0x6E,0x64,0x20,0x43,0x50,0x55,0x20,0x75,0x73,0x61,0x67,0x65,0x73,0x2E,0x0A, // .nd.CPU.usages.. END
+	0xFF,0x93,0x00,0x20,0x01,0x1A,0x05,0x68,0x77,0x64,0x65,0x72,0x65,0x67,0x00,0x48, // .......hwdereg.H END
+	0x57,0x44,0x45,0x52,0x45,0x47,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72, // WDEREG(1).-.User END
+	0x20,0x43,0x6F,0x6D,0x6D,0x80,0x47,0x08,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A, // .Comm.G.s..NAME. END
+	0x20,0x82,0x00,0x84,0x2E,0x80,0x23,0x00,0x44,0x81,0x36,0x80,0xC0,0x80,0x29,0x06, // ......#.D.6...). END
+	0x48,0x57,0x20,0x64,0x65,0x76,0x69,0x80,0xB9,0x09,0x0A,0x0A,0x53,0x59,0x4E,0x4F, // HW.devi.....SYNO END
+	0x50,0x53,0x49,0x53,0x8C,0x2F,0x0E,0x69,0x64,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52, // PSIS./.id..DESCR END
+	0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x4D,0x21,0x44,0x65,0x72,0x65,0x67,0x69,0x73, // IPTION.M!Deregis END
+	0x74,0x65,0x72,0x73,0x20,0x74,0x68,0x65,0x20,0x68,0x61,0x72,0x64,0x77,0x61,0x72, // ters.the.hardwar END
+	0x65,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x69,0x6E,0x82,0x16,0x03,0x73,0x6C, // e.device.in...sl END
+	0x6F,0x74,0x80,0x12,0x80,0x26,0x07,0x6D,0x69,0x6E,0x65,0x64,0x20,0x62,0x79,0x82, // ot...&.mined.by. END
+	0x2D,0x0B,0x67,0x69,0x76,0x65,0x6E,0x20,0x69,0x64,0x2E,0x0A,0x0A,0x20,0x82,0x00, // -.given.id...... END
+	0x00,0x53,0x81,0x27,0x04,0x73,0x68,0x6F,0x75,0x6C,0x80,0x23,0x86,0x3D,0x08,0x72, // .S.'.shoul.#.=.r END
+	0x61,0x6E,0x67,0x65,0x20,0x30,0x2D,0x33,0x87,0x27,0x11,0x65,0x65,0x20,0x48,0x57, // ange.0-3.'.ee.HW END
+	0x52,0x45,0x47,0x28,0x31,0x29,0x20,0x66,0x6F,0x72,0x20,0x6D,0x6F,0x80,0x73,0x01, // REG(1).for.mo.s. END
+	0x69,0x6E,0x80,0x0A,0x08,0x6D,0x61,0x74,0x69,0x6F,0x6E,0x2E,0x0A,0xFF,0xA2,0x00, // in...mation..... END
+	0x11,0x01,0x8E,0x07,0x68,0x65,0x78,0x64,0x75,0x6D,0x70,0x00,0x48,0x45,0x58,0x44, // ....hexdump.HEXD END
+	0x55,0x4D,0x50,0x81,0x51,0x14,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D, // UMP.Q.-.User.Com END
+	0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x84,0xA2,0x84,0x2E,0x80, // mands..NAME..... END
+	0x23,0x03,0x50,0x72,0x69,0x6E,0x21,0x74,0x20,0x66,0x69,0x6C,0x65,0x20,0x63,0x6F, // #.Prin!t.file.co END
+	0x6E,0x74,0x65,0x6E,0x74,0x73,0x20,0x69,0x6E,0x20,0x68,0x65,0x78,0x0A,0x0A,0x53, // ntents.in.hex..S END
+	0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x0A,0x20,0x82,0x00,0x80,0x13,0x0A,0x64,0x75, // YNOPSIS.......du END
+	0x6D,0x70,0x20,0x5B,0x46,0x49,0x4C,0x45,0x31,0x83,0x06,0x13,0x32,0x20,0x2E,0x2E, // mp.[FILE1...2... END
+	0x2E,0x5D,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E, // .]]..DESCRIPTION END
+	0x84,0x2E,0x07,0x46,0x6F,0x72,0x20,0x65,0x61,0x63,0x68,0x83,0x5C,0x0D,0x67,0x69, // ...For.each.\.gi END
+	0x76,0x65,0x6E,0x2C,0x20,0x70,0x72,0x69,0x6E,0x74,0x20,0x69,0x80,0x64,0x86,0x6D, // ven,.print.i.d.m END
+	0x00,0x61,0x80,0x02,0x0E,0x20,0x73,0x65,0x72,0x69,0x65,0x73,0x20,0x6F,0x66,0x20, // .a....series.of. END
+	0x70,0x61,0x69,0x72,0x82,0x08,0x80,0x82,0x0C,0x61,0x64,0x65,0x63,0x69,0x6D,0x61, // pair.....adecima END
+	0x6C,0x20,0x76,0x61,0x6C,0x75,0x80,0x1E,0x00,0x2D,0x83,0x50,0x05,0x72,0x65,0x70, // l.valu...-.P.rep END
+	0x72,0x65,0x73,0x80,0xAA,0x02,0x69,0x6E,0x67,0x81,0x3B,0x80,0x06,0x80,0xBE,0x03, // res...ing.;..... END
+	0x62,0x79,0x74,0x65,0x85,0x21,0x08,0x73,0x65,0x70,0x61,0x72,0x61,0x74,0x65,0x64, // byte.!.separated END
+	0x80,0x15,0x87,0x21,0x06,0x73,0x70,0x61,0x63,0x65,0x2E,0x0A,0x84,0xCE,0x06,0x49, // ...!.space.....I END
+	0x6E,0x73,0x74,0x65,0x61,0x64,0x80,0x73,0x13,0x20,0x61,0x20,0x66,0x69,0x6C,0x65, // nstead.s..a.file END
+	0x20,0x73,0x79,0x73,0x74,0x65,0x6D,0x20,0x70,0x61,0x74,0x68,0x2C,0x80,0x13,0x0E, // .system.path,... END
+	0x64,0x61,0x73,0x68,0x20,0x27,0x2D,0x27,0x20,0x63,0x61,0x6E,0x20,0x62,0x65,0x80, // dash.'-'.can.be. END
+	0x17,0x09,0x73,0x73,0x65,0x64,0x20,0x74,0x6F,0x20,0x75,0x73,0x80,0x2C,0x18,0x74, // ..ssed.to.us.,.t END
+	0x64,0x69,0x6E,0x20,0x66,0x6F,0x72,0x20,0x74,0x68,0x61,0x74,0x20,0x61,0x72,0x67, // din.for.that.arg END
+	0x75,0x6D,0x65,0x6E,0x74,0x2E,0x0A,0xFF,0xAE,0x00,0x2A,0x00,0xCD,0x04,0x66,0x61, // ument.....*...fa END
+	0x63,0x74,0x6F,0x72,0x00,0x46,0x41,0x43,0x54,0x4F,0x52,0x28,0x31,0x29,0x20,0x2D, // ctor.FACTOR(1).- END
+	0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A, // .User.Commands.. END
+	0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x83,0x2C,0x80,0x22,0x84,0x08,0x06,0x69, // NAME.....,."...i END
+	0x6E,0x74,0x65,0x67,0x65,0x72,0x80,0x24,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49, // nteger.$.SYNOPSI END
+	0x53,0x8B,0x28,0x05,0x4E,0x55,0x4D,0x31,0x20,0x5B,0x80,0x05,0x12,0x32,0x20,0x2E, // S.(.NUM1.[...2.. END
+	0x2E,0x2E,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E, // ..]..DESCRIPTION END
+	0x81,0x52,0x21,0x20,0x20,0x20,0x54,0x61,0x6B,0x65,0x20,0x69,0x6E,0x74,0x65,0x67, // .R!...Take.integ END
+	0x65,0x72,0x73,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x61,0x73,0x20,0x61,0x72,0x67, // ers.given.as.arg END
+	0x75,0x6D,0x65,0x6E,0x74,0x80,0x09,0x04,0x6E,0x64,0x20,0x70,0x72,0x80,0x21,0x0F, // ument...nd.pr.!. END
+	0x20,0x61,0x20,0x6C,0x69,0x73,0x74,0x20,0x6F,0x66,0x20,0x74,0x68,0x65,0x69,0x72, // .a.list.of.their END
+	0x81,0x15,0x0C,0x6D,0x65,0x20,0x66,0x61,0x63,0x74,0x6F,0x72,0x73,0x2E,0x0A,0xFF, // ...me.factors... END
+	0xAF,0x00,0x1A,0x00,0xA5,0x03,0x62,0x75,0x72,0x6E,0x00,0x42,0x55,0x52,0x4E,0x28, // ......burn.BURN( END
+	0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x80,0x76, // 1).-.User.Comm.v END
+	0x07,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x80,0xA5,0x80,0xA8,0x81,0x28,0x80, // .s..NAME......(. END
+	0x20,0x82,0x06,0x08,0x43,0x50,0x55,0x20,0x63,0x79,0x63,0x6C,0x65,0x80,0x22,0x07, // ....CPU.cycle.". END
+	0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x88,0x26,0x0C,0x0A,0x0A,0x44,0x45,0x53, // SYNOPSIS.&...DES END
+	0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x3E,0x00,0x42,0x8B,0x37,0x05,0x20, // CRIPTION.>.B.7.. END
+	0x62,0x79,0x20,0x64,0x6F,0x25,0x69,0x6E,0x67,0x20,0x61,0x6E,0x20,0x69,0x6E,0x66, // by.do%ing.an.inf END
+	0x69,0x6E,0x69,0x74,0x65,0x20,0x6C,0x6F,0x6F,0x70,0x2E,0x20,0x44,0x6F,0x65,0x73, // inite.loop..Does END
+	0x20,0x6E,0x6F,0x74,0x20,0x65,0x78,0x69,0x74,0x2E,0x0A,0xFF,0x97,0x00,0x26,0x02, // .not.exit.....&. END
+	0xA1,0x0B,0x6C,0x73,0x6F,0x66,0x00,0x4C,0x53,0x4F,0x46,0x28,0x31,0x29,0x20,0x2D, // ..lsof.LSOF(1).- END
+	0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A, // .User.Commands.. END
+	0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x81,0x28,0x80,0x20,0x0D,0x73,0x68,0x6F, // NAME.....(...sho END
+	0x77,0x20,0x6F,0x70,0x65,0x6E,0x20,0x66,0x69,0x6C,0x65,0x80,0x22,0x07,0x53,0x59, // w.open.file.".SY END
+	0x4E,0x4F,0x50,0x53,0x49,0x53,0x88,0x26,0x0C,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52, // NOPSIS.&...DESCR END
+	0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x3E,0x0D,0x50,0x72,0x69,0x6E,0x74,0x73,0x20, // IPTION.>.Prints. END
+	0x61,0x20,0x6C,0x69,0x73,0x74,0x20,0x80,0x4A,0x82,0x3E,0x83,0x49,0x00,0x70,0x80, // a.list..J.>.I.p. END
+	0x73,0x08,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x2E,0x0A,0x84,0x6E,0x03,0x45,0x61, // s.process...n.Ea END
+	0x63,0x68,0x82,0x62,0x04,0x2C,0x20,0x74,0x68,0x61,0x80,0xCB,0x81,0x0F,0x84,0x24, // ch.b.,.tha.....$ END
+	0x02,0x20,0x68,0x61,0x83,0x39,0x27,0x20,0x70,0x72,0x6F,0x64,0x75,0x63,0x65,0x73, // ..ha.9'.produces END
+	0x20,0x69,0x74,0x73,0x20,0x6F,0x77,0x6E,0x20,0x6C,0x69,0x6E,0x65,0x20,0x6F,0x66, // .its.own.line.of END
+	0x20,0x6F,0x75,0x74,0x70,0x75,0x74,0x20,0x77,0x68,0x69,0x63,0x68,0x0A,0x20,0x82, // .output.which... END
+	0x00,0x00,0x69,0x80,0x21,0x24,0x66,0x20,0x74,0x68,0x65,0x20,0x66,0x6F,0x72,0x6D, // ..i.!$f.the.form END
+	0x3A,0x20,0x50,0x49,0x44,0x20,0x45,0x58,0x45,0x43,0x50,0x41,0x54,0x48,0x20,0x4C, // :.PID.EXECPATH.L END
+	0x4F,0x43,0x41,0x4C,0x46,0x44,0x20,0x47,0x4C,0x4F,0x42,0x82,0x08,0x01,0x46,0x44, // OCALFD.GLOB...FD END
+	0x81,0x17,0x00,0x0A,0x84,0x3B,0x05,0x45,0x78,0x61,0x6D,0x70,0x6C,0x80,0x59,0x82, // .....;.Exampl.Y. END
+	0x56,0x00,0x3A,0x84,0x51,0x12,0x20,0x20,0x30,0x30,0x20,0x2F,0x62,0x69,0x6E,0x2F, // V.:.Q...00./bin/ END
+	0x69,0x6E,0x69,0x74,0x20,0x30,0x31,0x20,0x36,0x80,0x0F,0x08,0x64,0x65,0x76,0x2F, // init.01.6...dev/ END
+	0x74,0x74,0x79,0x53,0x30,0x94,0x25,0x03,0x32,0x20,0x35,0x39,0x92,0x25,0x00,0x31, // ttyS0.%.2.59.%.1 END
+	0x83,0x4B,0x01,0x73,0x68,0x98,0x49,0x88,0x23,0x80,0x47,0x0D,0x39,0x20,0x2F,0x64, // .K.sh.I.#.G.9./d END
+	0x65,0x76,0x2F,0x74,0x74,0x79,0x53,0x30,0x0A,0x20,0x84,0x00,0x15,0x30,0x32,0x20, // ev/ttyS0.....02. END
+	0x2F,0x75,0x73,0x72,0x2F,0x62,0x69,0x6E,0x2F,0x68,0x61,0x73,0x68,0x20,0x30,0x31, // /usr/bin/hash.01 END
+	0x20,0x36,0x30,0xA3,0x29,0x02,0x32,0x20,0x35,0xA4,0x53,0x02,0x33,0x20,0x35,0x80, // .60.).2.5.S.3.5. END
+	0x67,0x81,0x7D,0x06,0x75,0x72,0x61,0x6E,0x64,0x6F,0x6D,0x87,0x7F,0x00,0x33,0x87, // g.}.urandom...3. END
+	0x7F,0x03,0x6C,0x73,0x6F,0x66,0x98,0x7F,0x8E,0x29,0x8D,0x7F,0x00,0xFF,0x9B,0x00, // ..lsof...)...... END
+	0x28,0x00,0xA6,0x03,0x66,0x61,0x6C,0x73,0x65,0x00,0x46,0x41,0x4C,0x53,0x45,0x28, // (...false.FALSE( END
+	0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E, // 1).-.User.Comman END
+	0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x82,0x2A,0x80,0x21, // ds..NAME.....*.! END
+	0x23,0x64,0x6F,0x20,0x6E,0x6F,0x74,0x68,0x69,0x6E,0x67,0x2C,0x20,0x75,0x6E,0x73, // #do.nothing,.uns END
+	0x75,0x63,0x63,0x65,0x73,0x73,0x66,0x75,0x6C,0x6C,0x79,0x0A,0x0A,0x53,0x59,0x4E, // uccessfully..SYN END
+	0x4F,0x50,0x53,0x49,0x53,0x89,0x32,0x0C,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49, // OPSIS.2...DESCRI END
+	0x50,0x54,0x49,0x4F,0x4E,0x84,0x4B,0x1E,0x45,0x78,0x69,0x74,0x20,0x77,0x69,0x74, // PTION.K.Exit.wit END
+	0x68,0x20,0x61,0x20,0x73,0x74,0x61,0x74,0x75,0x73,0x20,0x63,0x6F,0x64,0x65,0x20, // h.a.status.code. END
+	0x69,0x6E,0x64,0x69,0x63,0x61,0x74,0x80,0x5B,0x80,0x6E,0x07,0x69,0x6C,0x75,0x72, // indicat.[.n.ilur END
+	0x65,0x2E,0x0A,0xFF,0x96,0x00,0x09,0x00,0xAF,0x03,0x79,0x65,0x73,0x00,0x59,0x45, // e.........yes.YE END
+	0x53,0x9D,0xBB,0x80,0x26,0x80,0xDB,0x04,0x70,0x72,0x69,0x6E,0x74,0x80,0x6F,0x80, // S...&...print.o. END
+	0x06,0x04,0x67,0x20,0x65,0x6E,0x64,0x11,0x6C,0x65,0x73,0x73,0x6C,0x79,0x0A,0x0A, // ..g.end.lessly.. END
+	0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x0A,0x20,0x82,0x00,0x18,0x79,0x65,0x73, // SYNOPSIS.....yes END
+	0x20,0x5B,0x53,0x54,0x52,0x49,0x4E,0x47,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52, // .[STRING]..DESCR END
+	0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x1F,0x09,0x50,0x72,0x69,0x6E,0x74,0x73,0x20, // IPTION...Prints. END
+	0x6C,0x69,0x6E,0x80,0x28,0x0E,0x6F,0x66,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76, // lin.(.of.the.giv END
+	0x65,0x6E,0x20,0x73,0x74,0x80,0x1A,0x19,0x67,0x2C,0x20,0x6F,0x72,0x20,0x27,0x79, // en.st...g,.or.'y END
+	0x27,0x2C,0x20,0x75,0x6E,0x74,0x69,0x6C,0x20,0x6B,0x69,0x6C,0x6C,0x65,0x64,0x2E, // ',.until.killed. END
+	0x0A,0xFF,0x8D,0x00,0x2C,0x00,0xFF,0x04,0x73,0x68,0x75,0x74,0x64,0x6F,0x77,0x6E, // ....,...shutdown END
+	0x00,0x53,0x48,0x55,0x54,0x44,0x4F,0x57,0x4E,0x28,0x31,0x29,0x20,0x2D,0x20,0x55, // .SHUTDOWN(1).-.U END
+	0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41, // ser.Commands..NA END
+	0x4D,0x45,0x84,0x9C,0x85,0x30,0x80,0x24,0x03,0x62,0x65,0x67,0x69,0x80,0x73,0x80, // ME...0.$.begi.s. END
+	0x41,0x00,0x74,0x80,0x75,0x00,0x20,0x82,0x15,0x81,0x8B,0x05,0x73,0x79,0x73,0x74, // A.t.u.......syst END
+	0x65,0x6D,0x8E,0xD6,0x85,0x6A,0x87,0xD2,0x04,0x49,0x4F,0x4E,0x0A,0x20,0x82,0x00, // em...j...ION.... END
+	0x27,0x49,0x6E,0x69,0x74,0x69,0x61,0x74,0x65,0x73,0x20,0x73,0x68,0x75,0x74,0x74, // 'Initiates.shutt END
+	0x69,0x6E,0x67,0x20,0x64,0x6F,0x77,0x6E,0x20,0x74,0x68,0x65,0x20,0x73,0x79,0x73, // ing.down.the.sys END
+	0x74,0x65,0x6D,0x20,0x28,0x73,0x65,0x6E,0x64,0x81,0x18,0x05,0x73,0x75,0x69,0x63, // tem.(send...suic END
+	0x69,0x64,0x80,0x17,0x23,0x69,0x67,0x6E,0x61,0x6C,0x73,0x20,0x74,0x6F,0x20,0x61, // id..#ignals.to.a END
+	0x6C,0x6C,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x65,0x73,0x2C,0x20,0x62,0x65, // ll.processes,.be END
+	0x66,0x6F,0x72,0x65,0x20,0x6B,0x69,0x6C,0x6C,0x81,0x49,0x01,0x69,0x66,0x81,0x47, // fore.kill.I.if.G END
+	0x05,0x79,0x20,0x74,0x61,0x6B,0x65,0x80,0x2D,0x32,0x6F,0x20,0x6C,0x6F,0x6E,0x67, // .y.take.-2o.long END
+	0x29,0x2E,0x0A,0xFF,0x01,0x38,0x05,0x68,0x77,0x69,0x6E,0x66,0x6F,0x00,0x48,0x57, // )....8.hwinfo.HW END
+	0x49,0x4E,0x46,0x4F,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43, // INFO(1).-.User.C END
+	0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x84,0xA5,0x83, // ommands..NAME... END
+	0x2C,0x80,0x22,0x05,0x50,0x72,0x69,0x6E,0x74,0x20,0x81,0x39,0x07,0x72,0x6D,0x61, // ,.".Print..9.rma END
+	0x74,0x69,0x6F,0x6E,0x20,0x80,0x02,0x06,0x48,0x57,0x20,0x64,0x65,0x76,0x69,0x80, // tion....HW.devi. END
+	0x84,0x09,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8A,0x38,0x09,0x0A, // ....SYNOPSIS.8.. END
+	0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x84,0xF8,0x35,0x20,0x20,0x20,0x50, // .DESCRIPT..5...P END
+	0x72,0x69,0x6E,0x74,0x73,0x20,0x61,0x20,0x6C,0x69,0x6E,0x65,0x20,0x66,0x6F,0x72, // rints.a.line.for END
+	0x20,0x65,0x61,0x63,0x68,0x20,0x68,0x61,0x72,0x64,0x77,0x61,0x72,0x65,0x20,0x64, // .each.hardware.d END
+	0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x6C,0x6F,0x74,0x20,0x77,0x69,0x74,0x68,0x20, // evice.slot.with. END
+	0x69,0x6E,0x80,0x24,0x2E,0x6D,0x61,0x74,0x69,0x6F,0x6E,0x20,0x61,0x62,0x6F,0x75, // in.$.mation.abou END
+	0x74,0x20,0x69,0x74,0x20,0x2D,0x20,0x70,0x72,0x69,0x6D,0x61,0x72,0x69,0x6C,0x79, // t.it.-.primarily END
+	0x20,0x74,0x68,0x65,0x20,0x63,0x75,0x72,0x72,0x65,0x6E,0x74,0x20,0x74,0x79,0x70, // .the.current.typ END
+	0x65,0x20,0x6F,0x66,0x85,0x45,0x04,0x75,0x73,0x69,0x6E,0x67,0x81,0x2F,0x00,0x28, // e.of.E.using./.( END
+	0x80,0x67,0x11,0x75,0x6E,0x75,0x73,0x65,0x64,0x20,0x69,0x66,0x20,0x6E,0x6F,0x6E, // .g.unused.if.non END
+	0x65,0x29,0x2E,0x0A,0x0A,0x80,0x8E,0x80,0x91,0x0B,0x53,0x65,0x65,0x20,0x48,0x57, // e)........See.HW END
+	0x52,0x45,0x47,0x28,0x31,0x29,0x82,0x90,0x01,0x6D,0x6F,0x80,0x87,0x88,0x76,0x02, // REG(1)...mo...v. END
+	0x2E,0x0A,0xFF,0x84,0x00,0x07,0x01,0x98,0x07,0x73,0x68,0x00,0x53,0x48,0x81,0x29, // .........sh.SH.) END
+	0x14,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73, // .-.User.Commands END
+	0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x84,0x52,0x01,0x73,0x68,0x80,0xA1,0x04,0x62,0x61, // ..NAME.R.sh...ba END
+	0x73,0x69,0x63,0x80,0x0A,0x0A,0x65,0x6C,0x6C,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50, // sic...ell..SYNOP END
+	0x53,0x03,0x49,0x53,0x0A,0x20,0x82,0x00,0x0A,0x73,0x68,0x20,0x5B,0x53,0x43,0x52, // S.IS.....sh.[SCR END
+	0x49,0x50,0x54,0x31,0x85,0x08,0x0A,0x32,0x20,0x2E,0x2E,0x2E,0x5D,0x5D,0x0A,0x0A, // IPT1...2....]].. END
+	0x44,0x45,0x83,0x19,0x02,0x49,0x4F,0x4E,0x84,0x2D,0x06,0x41,0x20,0x62,0x61,0x73, // DE...ION.-.A.bas END
+	0x69,0x63,0x80,0x35,0x0B,0x65,0x6C,0x6C,0x20,0x69,0x6E,0x74,0x65,0x72,0x70,0x72, // ic.5.ell.interpr END
+	0x65,0x80,0x05,0x22,0x2E,0x20,0x52,0x75,0x6E,0x73,0x20,0x74,0x68,0x65,0x20,0x73, // e.."..Runs.the.s END
+	0x63,0x72,0x69,0x70,0x74,0x73,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x61,0x73,0x20, // cripts.given.as. END
+	0x61,0x72,0x67,0x75,0x6D,0x65,0x6E,0x80,0x12,0x1F,0x28,0x69,0x66,0x20,0x61,0x6E, // argumen...(if.an END
+	0x79,0x29,0x2C,0x20,0x62,0x65,0x66,0x6F,0x72,0x65,0x20,0x72,0x65,0x61,0x64,0x69, // y),.before.readi END
+	0x6E,0x67,0x20,0x66,0x72,0x6F,0x6D,0x20,0x73,0x74,0x80,0x0B,0x02,0x2E,0x20,0x49, // ng.from.st.....I END
+	0x82,0x23,0x86,0x46,0x01,0x63,0x61,0x80,0x69,0x0B,0x65,0x78,0x69,0x74,0x2C,0x20, // .#.F.ca.i.exit,. END
+	0x6E,0x6F,0x20,0x66,0x75,0x72,0x80,0x63,0x00,0x72,0x86,0x64,0x00,0x61,0x81,0x44, // no.fur.c.r.d.a.D END
+	0x01,0x61,0x6E,0x81,0x1B,0x03,0x72,0x20,0x69,0x73,0x83,0x43,0x82,0x56,0x07,0x2E, // .an...r.is.C.V.. END
+	0x20,0x53,0x75,0x70,0x70,0x6F,0x72,0x81,0x42,0x00,0x64,0x80,0x75,0x00,0x64,0x82, // .Suppor.B.d.u.d. END
+	0x44,0x07,0x20,0x62,0x75,0x69,0x6C,0x74,0x2D,0x69,0x0A,0x6E,0x73,0x2C,0x20,0x61, // D..built-i.ns,.a END
+	0x73,0x20,0x77,0x65,0x6C,0x6C,0x81,0x07,0x20,0x72,0x75,0x6E,0x6E,0x69,0x6E,0x67, // s.well...running END
+	0x20,0x61,0x20,0x63,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x20,0x69,0x6E,0x20,0x74,0x68, // .a.command.in.th END
+	0x65,0x20,0x62,0x61,0x63,0x6B,0x67,0x72,0x6F,0x75,0x80,0x11,0x08,0x62,0x79,0x20, // e.backgrou...by. END
+	0x61,0x70,0x70,0x65,0x6E,0x64,0x82,0x28,0x17,0x6E,0x20,0x27,0x26,0x27,0x20,0x63, // append.(.n.'&'.c END
+	0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x74,0x6F,0x20,0x69,0x74,0x2E,0x0A, // haracter.to.it.. END
+	0xFF,0xA4,0x00,0x13,0x00,0xE3,0x04,0x6B,0x69,0x6C,0x6C,0x00,0x4B,0x49,0x4C,0x4C, // .......kill.KILL END
+	0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x80,0x45,0x00,0x43,0x83,0x7D,0x08,0x73, // (1).-.Us.E.C.}.s END
+	0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x81,0x28,0x80,0x20,0x82,0x06, // ..NAME.....(.... END
+	0x07,0x61,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x80,0x21,0x07,0x53,0x59,0x4E,0x4F, // .a.proces.!.SYNO END
+	0x50,0x53,0x49,0x53,0x89,0x25,0x0F,0x70,0x69,0x64,0x0A,0x0A,0x44,0x45,0x53,0x43, // PSIS.%.pid..DESC END
+	0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x41,0x00,0x4B,0x81,0x41,0x81,0xCE,0x84, // RIPTION.A.K.A... END
+	0x3C,0x01,0x20,0x72,0x24,0x65,0x66,0x65,0x72,0x72,0x65,0x64,0x20,0x74,0x6F,0x20, // <..r$eferred.to. END
+	0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x70,0x69,0x64, // by.the.given.pid END
+	0x2E,0x0A,0x0A,0x4E,0x4F,0x54,0x45,0x53,0x0A,0x20,0x82,0x00,0x00,0x54,0x80,0x1B, // ...NOTES.....T.. END
+	0x0B,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x20,0x77,0x69,0x74,0x68,0x81,0x22,0x17, // .process.with.". END
+	0x20,0x30,0x20,0x28,0x69,0x6E,0x69,0x74,0x29,0x20,0x63,0x61,0x6E,0x6E,0x6F,0x74, // .0.(init).cannot END
+	0x20,0x62,0x65,0x20,0x6B,0x69,0x6C,0x6C,0x81,0x50,0x01,0x68,0x69,0x80,0x27,0x04, // .be.kill.P.hi.'. END
+	0x61,0x79,0x2E,0x0A,0xFF,0x99,0x00,0x1E,0x01,0x0F,0x05,0x73,0x69,0x7A,0x65,0x00, // ay.........size. END
+	0x53,0x49,0x5A,0x45,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43, // SIZE(1).-.User.C END
+	0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x80,0x82,0x02,0x41,0x4D,0x45,0x84,0x81,0x81, // ommands...AME... END
+	0x28,0x80,0x20,0x0D,0x50,0x72,0x69,0x6E,0x74,0x20,0x61,0x20,0x66,0x69,0x6C,0x65, // (...Print.a.file END
+	0x27,0x73,0x83,0x15,0x01,0x69,0x6E,0x80,0x10,0x01,0x68,0x75,0x80,0x33,0x18,0x20, // 's...in...hu.3.. END
+	0x72,0x65,0x61,0x64,0x61,0x62,0x6C,0x65,0x20,0x66,0x6F,0x72,0x6D,0x61,0x74,0x0A, // readable.format. END
+	0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x85,0xC7,0x82,0x45,0x08,0x46,0x49,0x4C, // .SYNOPSI...E.FIL END
+	0x45,0x0A,0x0A,0x44,0x45,0x53,0x09,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x0A, // E..DES.CRIPTION. END
+	0x20,0x82,0x00,0x10,0x50,0x72,0x69,0x6E,0x74,0x20,0x74,0x68,0x65,0x20,0x73,0x69, // ....Print.the.si END
+	0x7A,0x65,0x20,0x6F,0x66,0x82,0x0B,0x1B,0x67,0x69,0x76,0x65,0x6E,0x20,0x66,0x69, // ze.of...given.fi END
+	0x6C,0x65,0x20,0x69,0x6E,0x20,0x61,0x20,0x68,0x75,0x6D,0x61,0x6E,0x20,0x72,0x65, // le.in.a.human.re END
+	0x61,0x64,0x61,0x62,0x80,0x13,0x26,0x66,0x6F,0x72,0x6D,0x61,0x74,0x2E,0x20,0x44, // adab..&format..D END
+	0x69,0x72,0x65,0x63,0x74,0x6F,0x72,0x69,0x65,0x73,0x20,0x61,0x6E,0x64,0x20,0x63, // irectories.and.c END
+	0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x64,0x65,0x76,0x69,0x63,0x81,0x15, // haracter.devic.. END
+	0x03,0x72,0x65,0x20,0x74,0x80,0x37,0x0C,0x74,0x65,0x64,0x20,0x61,0x73,0x20,0x68, // .re.t.7.ted.as.h END
+	0x61,0x76,0x69,0x6E,0x67,0x83,0x6A,0x06,0x7A,0x65,0x72,0x6F,0x2E,0x0A,0xFF,0xAD, // aving.j.zero.... END
+	0x00,0x02,0x00,0xA4,0x03,0x80,0x8B,0x0B,0x00,0x4D,0x41,0x4E,0x28,0x31,0x29,0x20, // .........MAN(1). END
+	0x2D,0x20,0x55,0x73,0x80,0x6E,0x02,0x43,0x6F,0x6D,0x80,0xA0,0x07,0x64,0x73,0x0A, // -.Us.n.Com...ds. END
+	0x0A,0x4E,0x41,0x4D,0x45,0x84,0xDA,0x81,0xB2,0x08,0x2D,0x20,0x64,0x69,0x73,0x70, // .NAME.....-.disp END
+	0x6C,0x61,0x79,0x81,0x0D,0x04,0x75,0x61,0x6C,0x73,0x0A,0x0A,0x0A,0x53,0x59,0x4E, // lay...uals...SYN END
+	0x4F,0x50,0x53,0x49,0x53,0x0A,0x20,0x82,0x00,0x1C,0x6D,0x61,0x6E,0x20,0x73,0x65, // OPSIS.....man.se END
+	0x63,0x74,0x69,0x6F,0x6E,0x20,0x70,0x61,0x67,0x65,0x0A,0x0A,0x44,0x45,0x53,0x43, // ction.page..DESC END
+	0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x23,0x0C,0x44,0x69,0x73,0x70,0x6C,0x61, // RIPTION.#.Displa END
+	0x79,0x20,0x67,0x69,0x76,0x65,0x6E,0x81,0x31,0x02,0x75,0x61,0x6C,0x82,0x2C,0x06, // y.given.1.ual.,. END
+	0x20,0x61,0x74,0x20,0x74,0x68,0x65,0x84,0x18,0x84,0x46,0x02,0x2E,0x0A,0xFF,0x98, // .at.the...F..... END
+	0x00,0x19,0x00,0xF4,0x04,0x69,0x6E,0x69,0x74,0x00,0x49,0x4E,0x49,0x54,0x28,0x31, // .....init.INIT(1 END
+	0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x80,0x89,0x07,0x64, // ).-.User.Com...d END
+	0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x84,0x9B,0x81,0x28,0x80,0x20,0x1E,0x73,0x74, // s..NAME...(...st END
+	0x61,0x72,0x74,0x73,0x20,0x61,0x20,0x73,0x68,0x65,0x6C,0x6C,0x20,0x62,0x65,0x66, // arts.a.shell.bef END
+	0x6F,0x72,0x65,0x20,0x73,0x6C,0x65,0x65,0x70,0x69,0x6E,0x67,0x20,0x81,0x0D,0x03, // ore.sleeping.... END
+	0x76,0x65,0x72,0x0A,0x8D,0xD9,0x11,0x5B,0x6E,0x6F,0x74,0x20,0x63,0x61,0x6C,0x6C, // ver....[not.call END
+	0x65,0x64,0x20,0x66,0x72,0x6F,0x6D,0x20,0x75,0x80,0x68,0x00,0x73,0x13,0x70,0x61, // ed.from.u.h.s.pa END
+	0x63,0x65,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E, // ce]..DESCRIPTION END
+	0x0A,0x20,0x82,0x00,0x30,0x46,0x6F,0x72,0x6B,0x20,0x74,0x6F,0x20,0x73,0x74,0x61, // ....0Fork.to.sta END
+	0x72,0x74,0x20,0x61,0x20,0x73,0x68,0x65,0x6C,0x6C,0x2C,0x20,0x77,0x68,0x69,0x6C, // rt.a.shell,.whil END
+	0x65,0x20,0x77,0x61,0x69,0x74,0x69,0x6E,0x67,0x20,0x69,0x6E,0x64,0x65,0x66,0x69, // e.waiting.indefi END
+	0x6E,0x69,0x74,0x65,0x6C,0x79,0x80,0x0C,0x21,0x20,0x74,0x68,0x65,0x20,0x70,0x61, // nitely..!.the.pa END
+	0x72,0x65,0x6E,0x74,0x2E,0x20,0x46,0x61,0x69,0x6C,0x73,0x20,0x69,0x66,0x20,0x61, // rent..Fails.if.a END
+	0x6C,0x72,0x65,0x61,0x64,0x79,0x20,0x72,0x75,0x6E,0x6E,0x80,0x34,0x02,0x2E,0x0A, // lready.runn.4... END
+	0xFF,0x88,0x00,0x03,0x03,0xEA,0x10,0x70,0x80,0x62,0x1F,0x74,0x00,0x50,0x53,0x54, // .......p.b.t.PST END
+	0x41,0x54,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D, // AT(1).-.User.Com END
+	0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x84,0x94,0x82,0x2A,0x80, // mands..NAME...*. END
+	0x21,0x0D,0x64,0x69,0x73,0x70,0x6C,0x61,0x79,0x20,0x70,0x65,0x72,0x66,0x6F,0x72, // !.display.perfor END
+	0x80,0x27,0x0D,0x63,0x65,0x20,0x63,0x6F,0x75,0x6E,0x74,0x65,0x72,0x73,0x20,0x6F, // .'.ce.counters.o END
+	0x66,0x85,0x6A,0x08,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x65,0x80,0x45,0x07, // f.j..processe.E. END
+	0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8A,0x49,0x01,0x5B,0x70,0x11,0x69,0x64, // SYNOPSIS.I.[p.id END
+	0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x0A,0x20, // ]..DESCRIPTION.. END
+	0x82,0x00,0x11,0x50,0x72,0x69,0x6E,0x74,0x73,0x20,0x74,0x68,0x65,0x20,0x63,0x6F, // ...Prints.the.co END
+	0x75,0x6E,0x74,0x65,0x72,0x83,0x0C,0x05,0x6B,0x65,0x72,0x6E,0x65,0x6C,0x80,0x06, // unter...kernel.. END
+	0x2A,0x65,0x70,0x73,0x20,0x66,0x6F,0x72,0x20,0x65,0x61,0x63,0x68,0x20,0x70,0x72, // *eps.for.each.pr END
+	0x6F,0x63,0x65,0x73,0x73,0x20,0x73,0x69,0x6E,0x63,0x65,0x20,0x69,0x74,0x20,0x77, // ocess.since.it.w END
+	0x61,0x73,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x64,0x20,0x28,0x80,0x25,0x03,0x6F, // as.created.(.%.o END
+	0x6E,0x6C,0x79,0x82,0x2E,0x81,0x50,0x0B,0x67,0x69,0x76,0x65,0x6E,0x20,0x70,0x69, // nly...P.given.pi END
+	0x64,0x29,0x2C,0x20,0x80,0x27,0x80,0x26,0x0B,0x64,0x20,0x66,0x72,0x6F,0x6D,0x20, // d),..'.&.d.from. END
+	0x2F,0x64,0x65,0x76,0x2F,0x81,0x4B,0x05,0x73,0x74,0x61,0x74,0x73,0x3A,0x84,0x8A, // /dev/.K.stats:.. END
+	0x11,0x69,0x6E,0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6F,0x6E,0x73,0x20,0x65,0x78, // .instructions.ex END
+	0x65,0x63,0x75,0x83,0x55,0x81,0x52,0x81,0x9F,0x0A,0x6C,0x6F,0x77,0x65,0x72,0x20, // ecu.U.R...lower. END
+	0x33,0x32,0x20,0x62,0x69,0x80,0xB1,0x01,0x6F,0x66,0x88,0xA7,0x04,0x27,0x73,0x20, // 32.bi...of...'s. END
+	0x36,0x34,0x81,0x17,0x83,0xC4,0x03,0x2C,0x20,0x73,0x6F,0x80,0xD2,0x05,0x69,0x73, // 64.....,.so...is END
+	0x20,0x77,0x72,0x61,0x84,0xBF,0x19,0x6C,0x6F,0x6E,0x67,0x2D,0x72,0x75,0x6E,0x6E, // .wra...long-runn END
+	0x69,0x6E,0x67,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x65,0x73,0x29,0x2C,0x0A, // ing.processes),. END
+	0x20,0x82,0x00,0x1E,0x73,0x63,0x68,0x65,0x64,0x75,0x6C,0x65,0x72,0x20,0x74,0x69, // ....scheduler.ti END
+	0x63,0x6B,0x73,0x20,0x69,0x74,0x20,0x72,0x61,0x6E,0x20,0x69,0x6E,0x2C,0x20,0x6E, // cks.it.ran.in,.n END
+	0x75,0x6D,0x62,0x80,0x17,0x01,0x6F,0x66,0x80,0x1A,0x01,0x6D,0x65,0x81,0x1A,0x22, // umb...of...me.." END
+	0x73,0x20,0x52,0x41,0x4D,0x20,0x68,0x61,0x64,0x20,0x74,0x6F,0x20,0x67,0x72,0x6F, // s.RAM.had.to.gro END
+	0x77,0x2C,0x20,0x73,0x79,0x73,0x63,0x61,0x6C,0x6C,0x73,0x20,0x6D,0x61,0x64,0x65, // w,.syscalls.made END
+	0x20,0x62,0x79,0x81,0x16,0x1D,0x75,0x70,0x2C,0x20,0x6D,0x69,0x6C,0x6C,0x69,0x73, // .by...up,.millis END
+	0x65,0x63,0x6F,0x6E,0x64,0x73,0x20,0x73,0x70,0x65,0x6E,0x74,0x20,0x62,0x6C,0x6F, // econds.spent.blo END
+	0x63,0x6B,0x65,0x64,0x81,0x24,0x03,0x74,0x79,0x70,0x65,0x84,0x80,0x80,0x5E,0x07, // cked.$.type...^. END
+	0x77,0x61,0x69,0x74,0x2C,0x20,0x61,0x6E,0x81,0x1A,0x00,0x74,0x80,0x68,0x16,0x72, // wait,.an...t.h.r END
+	0x65,0x61,0x64,0x2F,0x77,0x72,0x69,0x74,0x74,0x65,0x6E,0x20,0x76,0x69,0x61,0x20, // ead/written.via. END
+	0x65,0x61,0x63,0x68,0x20,0x6F,0x80,0x44,0x0D,0x20,0x66,0x64,0x20,0x28,0x73,0x69, // each.o.D..fd.(si END
+	0x6E,0x63,0x65,0x20,0x74,0x68,0x65,0x81,0x0D,0x02,0x77,0x61,0x73,0x82,0x19,0x04, // nce.the...was... END
+	0x65,0x64,0x29,0x2E,0x0A,0x84,0xD3,0x04,0x2F,0x64,0x65,0x76,0x2F,0x81,0xEA,0x03, // ed)...../dev/... END
+	0x73,0x74,0x61,0x74,0x0B,0x73,0x20,0x6F,0x6E,0x6C,0x79,0x20,0x65,0x78,0x69,0x73, // stat.s.only.exis END
+	0x74,0x81,0x0B,0x0C,0x20,0x74,0x68,0x65,0x20,0x50,0x43,0x20,0x76,0x65,0x72,0x73, // t....the.PC.vers END
+	0x69,0x80,0x0E,0x01,0x6F,0x66,0x82,0x11,0x09,0x6B,0x65,0x72,0x6E,0x65,0x6C,0x2E, // i...of...kernel. END
+	0x0A,0x0A,0x20,0x82,0x00,0x0E,0x45,0x78,0x61,0x6D,0x70,0x6C,0x65,0x20,0x6F,0x75, // ......Example.ou END
+	0x74,0x70,0x75,0x74,0x3A,0x84,0x15,0x0B,0x20,0x20,0x30,0x31,0x20,0x2F,0x62,0x69, // tput:.....01./bi END
+	0x6E,0x2F,0x73,0x68,0x86,0x12,0x09,0x20,0x20,0x69,0x6E,0x73,0x74,0x72,0x75,0x63, // n/sh.....instruc END
+	0x74,0x80,0x4E,0x25,0x73,0x28,0x6C,0x6F,0x77,0x33,0x32,0x29,0x20,0x34,0x38,0x32, // t.N%s(low32).482 END
+	0x31,0x31,0x20,0x74,0x69,0x63,0x6B,0x73,0x20,0x31,0x35,0x30,0x32,0x20,0x72,0x61, // 11.ticks.1502.ra END
+	0x6D,0x67,0x72,0x6F,0x77,0x74,0x68,0x73,0x20,0x36,0x88,0x3B,0x1B,0x73,0x79,0x73, // mgrowths.6.;.sys END
+	0x63,0x61,0x6C,0x6C,0x73,0x20,0x70,0x72,0x6F,0x63,0x20,0x34,0x20,0x69,0x6F,0x20, // calls.proc.4.io. END
+	0x32,0x31,0x32,0x20,0x65,0x6E,0x76,0x20,0x33,0x80,0x3E,0x11,0x6D,0x65,0x20,0x30, // 212.env.3.>.me.0 END
+	0x20,0x73,0x69,0x67,0x6E,0x61,0x6C,0x20,0x31,0x20,0x6D,0x69,0x73,0x63,0x81,0x0F, // .signal.1.misc.. END
+	0x07,0x74,0x72,0x20,0x34,0x35,0x20,0x68,0x77,0x80,0x1B,0x06,0x69,0x6E,0x74,0x33, // .tr.45.hw...int3 END
+	0x32,0x20,0x30,0x88,0x8D,0x05,0x77,0x61,0x69,0x74,0x6D,0x73,0x82,0x06,0x03,0x70, // 2.0...waitms...p END
+	0x69,0x64,0x20,0x1B,0x35,0x31,0x32,0x30,0x20,0x72,0x65,0x61,0x64,0x20,0x38,0x30, // id..5120.read.80 END
+	0x30,0x34,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x30,0x20,0x73,0x6C,0x65,0x65,0x70, // 04.write.0.sleep END
+	0x80,0x07,0x08,0x66,0x75,0x74,0x65,0x78,0x20,0x30,0x0A,0x20,0x86,0x00,0x03,0x66, // ...futex.0.....f END
+	0x64,0x20,0x31,0x83,0x30,0x01,0x31,0x32,0x82,0x2E,0x02,0x74,0x65,0x6E,0x8D,0x20, // d.1.0.12...ten.. END
+	0x00,0x32,0x83,0x51,0x00,0x30,0x86,0x1F,0x04,0x33,0x34,0x30,0x0A,0xFF,0x92,0x00, // .2.Q.0...340.... END
+	0x2E,0x01,0x41,0x06,0x6B,0x6C,0x6F,0x67,0x6C,0x65,0x76,0x65,0x6C,0x00,0x4B,0x4C, // ..A.kloglevel.KL END
+	0x4F,0x47,0x4C,0x45,0x56,0x45,0x4C,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65, // OGLEVEL(1).-.Use END
+	0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45, // r.Commands..NAME END
+	0x84,0x88,0x86,0x32,0x80,0x25,0x0B,0x67,0x65,0x74,0x2F,0x73,0x65,0x74,0x20,0x6B, // ...2.%.get/set.k END
+	0x65,0x72,0x6E,0x80,0x10,0x80,0x4C,0x04,0x67,0x69,0x6E,0x67,0x20,0x82,0x51,0x09, // ern...L.ging..Q. END
+	0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8E,0x38,0x00,0x5B,0x82,0x72, // ..SYNOPSIS.8.[.r END
+	0x00,0x5D,0x0E,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E, // .]...DESCRIPTION END
+	0x0A,0x20,0x82,0x00,0x20,0x50,0x72,0x69,0x6E,0x74,0x73,0x20,0x63,0x75,0x72,0x72, // .....Prints.curr END
+	0x65,0x6E,0x74,0x20,0x6B,0x65,0x72,0x6E,0x65,0x6C,0x20,0x6C,0x6F,0x67,0x67,0x69, // ent.kernel.loggi END
+	0x6E,0x67,0x20,0x6C,0x65,0x76,0x80,0x0D,0x0A,0x28,0x30,0x20,0x2D,0x20,0x61,0x6C, // ng.lev...(0.-.al END
+	0x6C,0x2C,0x20,0x31,0x80,0x08,0x03,0x77,0x61,0x72,0x6E,0x80,0x1B,0x0C,0x73,0x20, // l,.1...warn...s. END
+	0x2B,0x20,0x65,0x72,0x72,0x6F,0x72,0x73,0x2C,0x20,0x32,0x80,0x1F,0x85,0x0B,0x00, // +.errors,.2..... END
+	0x33,0x80,0x2B,0x06,0x6E,0x6F,0x6E,0x65,0x29,0x2E,0x0A,0x84,0x62,0x0A,0x49,0x66, // 3.+.none)...b.If END
+	0x20,0x61,0x6E,0x20,0x61,0x72,0x67,0x75,0x6D,0x81,0x62,0x0A,0x69,0x73,0x20,0x70, // .an.argum.b.is.p END
+	0x61,0x73,0x73,0x65,0x64,0x20,0x69,0x82,0x0C,0x80,0x7F,0x05,0x65,0x72,0x70,0x72, // assed.i.....erpr END
+	0x65,0x74,0x80,0x11,0x07,0x61,0x73,0x20,0x61,0x20,0x6E,0x65,0x77,0x8C,0x80,0x08, // et...as.a.new... END
+	0x74,0x6F,0x20,0x73,0x65,0x74,0x2E,0x0A,0xFF,0xBB,0x00,0x2E,0x00,0xEE,0x04,0x74, // to.set.........t END
+	0x72,0x75,0x6E,0x63,0x61,0x74,0x65,0x00,0x54,0x52,0x55,0x4E,0x43,0x41,0x54,0x45, // runcate.TRUNCATE END
+	0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61, // (1).-.User.Comma END
+	0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x85,0x30,0x80, // nds..NAME.....0. END
+	0x24,0x85,0x3B,0x0B,0x2F,0x65,0x78,0x74,0x65,0x6E,0x64,0x20,0x66,0x69,0x6C,0x65, // $.;./extend.file END
+	0x80,0x2C,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8D,0x30,0x15,0x53,0x49, // .,.SYNOPSIS.0.SI END
+	0x5A,0x45,0x20,0x46,0x49,0x4C,0x45,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50, // ZE.FILE..DESCRIP END
+	0x54,0x49,0x4F,0x4E,0x84,0x56,0x0F,0x52,0x65,0x73,0x69,0x7A,0x65,0x20,0x74,0x68, // TION.V.Resize.th END
+	0x65,0x20,0x67,0x69,0x76,0x65,0x6E,0x82,0x4C,0x02,0x20,0x74,0x6F,0x88,0x11,0x81, // e.given.L..to... END
+	0x20,0x09,0x2E,0x20,0x41,0x74,0x74,0x65,0x6D,0x70,0x74,0x73,0x81,0x1B,0x02,0x63, // ....Attempts...c END
+	0x72,0x65,0x81,0x89,0x81,0x34,0x82,0x2E,0x16,0x69,0x66,0x20,0x69,0x74,0x20,0x64, // re...4...if.it.d END
+	0x6F,0x65,0x73,0x20,0x6E,0x6F,0x74,0x20,0x65,0x78,0x69,0x73,0x74,0x20,0x61,0x6C, // oes.not.exist.al END
+	0x80,0x25,0x04,0x64,0x79,0x2E,0x0A,0xFF,0x8E,0x00,0x30,0x01,0x49,0x06,0x68,0x77, // .%.dy.....0.I.hw END
+	0x6B,0x65,0x79,0x70,0x61,0x64,0x6D,0x6E,0x74,0x00,0x48,0x57,0x53,0x44,0x4D,0x4E, // keypadmnt.HWSDMN END
+	0x54,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D, // T(1).-.User.Comm END
+	0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x88,0x32, // ands..NAME.....2 END
+	0x80,0x27,0x02,0x4D,0x6F,0x75,0x80,0x07,0x01,0x61,0x20,0x83,0x46,0x80,0x08,0x1D, // .'.Mou...a..F... END
+	0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x48,0x57,0x20,0x64,0x65, // registered.HW.de END
+	0x76,0x69,0x63,0x65,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x90,0x43, // vice..SYNOPSIS.C END
+	0x03,0x69,0x64,0x20,0x6D,0x81,0x44,0x11,0x70,0x6F,0x69,0x6E,0x74,0x0A,0x0A,0x44, // .id.m.D.point..D END
+	0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x70,0x0A,0x41,0x74,0x74, // ESCRIPTION.p.Att END
+	0x65,0x6D,0x70,0x74,0x73,0x20,0x74,0x6F,0x83,0x29,0x87,0x6E,0x80,0x11,0x08,0x74, // empts.to.).n...t END
+	0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6E,0x84,0x1B,0x82,0x46,0x06,0x2C,0x20,0x75, // he.given...F.,.u END
+	0x73,0x69,0x6E,0x67,0x82,0x1C,0x86,0x85,0x04,0x20,0x77,0x69,0x74,0x68,0x88,0x2F, // sing......with./ END
+	0x00,0x69,0x3B,0x64,0x2E,0x20,0x52,0x65,0x71,0x75,0x69,0x72,0x65,0x73,0x20,0x74, // .i;d..Requires.t END
+	0x68,0x61,0x74,0x20,0x73,0x61,0x69,0x64,0x20,0x48,0x57,0x20,0x64,0x65,0x76,0x69, // hat.said.HW.devi END
+	0x63,0x65,0x20,0x68,0x61,0x73,0x20,0x62,0x65,0x65,0x6E,0x20,0x72,0x65,0x67,0x69, // ce.has.been.regi END
+	0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x61,0x6C,0x72,0x65,0x61,0x64,0x79,0x20,0x80, // stered.already.. END
+	0x1A,0x0A,0x61,0x20,0x6B,0x65,0x79,0x70,0x61,0x64,0x2E,0x0A,0xFF,0xB3,0x00,0x28, // ..a.keypad.....( END
+	0x00,0xE0,0x04,0x73,0x6C,0x65,0x65,0x70,0x00,0x53,0x4C,0x45,0x45,0x50,0x28,0x31, // ...sleep.SLEEP(1 END
+	0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64, // ).-.User.Command END
+	0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x82,0x2A,0x80,0x21,0x21, // s..NAME.....*.!! END
+	0x64,0x65,0x6C,0x61,0x79,0x20,0x66,0x6F,0x72,0x20,0x61,0x6D,0x6F,0x75,0x6E,0x74, // delay.for.amount END
+	0x20,0x6F,0x66,0x20,0x74,0x69,0x6D,0x65,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53, // .of.time..SYNOPS END
+	0x49,0x53,0x8A,0x30,0x15,0x5B,0x53,0x45,0x43,0x4F,0x4E,0x44,0x53,0x5D,0x0A,0x0A, // IS.0.[SECONDS].. END
+	0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x82,0x53,0x32,0x20,0x20, // DESCRIPTION.S2.. END
+	0x44,0x65,0x6C,0x61,0x79,0x73,0x20,0x66,0x6F,0x72,0x20,0x61,0x74,0x20,0x6C,0x65, // Delays.for.at.le END
+	0x61,0x73,0x74,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x6E,0x75, // ast.the.given.nu END
+	0x6D,0x62,0x65,0x72,0x20,0x6F,0x66,0x20,0x73,0x65,0x63,0x6F,0x6E,0x64,0x73,0x2C, // mber.of.seconds, END
+	0x20,0x80,0x28,0x21,0x72,0x65,0x74,0x75,0x72,0x6E,0x73,0x20,0x69,0x6D,0x6D,0x65, // ..(!returns.imme END
+	0x64,0x69,0x61,0x74,0x65,0x6C,0x79,0x20,0x69,0x66,0x20,0x6E,0x6F,0x20,0x61,0x72, // diately.if.no.ar END
+	0x67,0x75,0x6D,0x65,0x6E,0x74,0x83,0x3E,0x02,0x2E,0x0A,0xFF,0x9C,0x00,0x11,0x00, // gument.>........ END
+	0x99,0x03,0x70,0x77,0x64,0x00,0x50,0x57,0x44,0x28,0x31,0x29,0x20,0x2D,0x20,0x55, // ..pwd.PWD(1).-.U END
+	0x73,0x80,0x6D,0x04,0x43,0x6F,0x6D,0x6D,0x61,0x80,0x6B,0x07,0x0A,0x0A,0x4E,0x41, // s.m.Comma.k...NA END
+	0x4D,0x45,0x0A,0x20,0x82,0x00,0x80,0x26,0x80,0x1F,0x02,0x70,0x72,0x69,0x80,0x5C, // ME.....&...pri.\ END
+	0x03,0x70,0x72,0x65,0x73,0x81,0x64,0x1A,0x77,0x6F,0x72,0x6B,0x69,0x6E,0x67,0x20, // .pres.d.working. END
+	0x64,0x69,0x72,0x65,0x63,0x74,0x6F,0x72,0x79,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50, // directory..SYNOP END
+	0x53,0x49,0x53,0x87,0x35,0x0C,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54, // SIS.5...DESCRIPT END
+	0x49,0x4F,0x4E,0x84,0x4C,0x00,0x50,0x81,0x46,0x03,0x73,0x20,0x63,0x75,0x19,0x72, // ION.L.P.F.s.cu.r END
+	0x72,0x65,0x6E,0x74,0x20,0x77,0x6F,0x72,0x6B,0x69,0x6E,0x67,0x20,0x64,0x69,0x72, // rent.working.dir END
+	0x65,0x63,0x74,0x6F,0x72,0x79,0x2E,0x0A,0xFF,0xA3,0x00,0x26,0x00,0xE1,0x04,0x65, // ectory.....&...e END
+	0x63,0x68,0x6F,0x00,0x45,0x43,0x48,0x4F,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73, // cho.ECHO(1).-.Us END
+	0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D, // er.Commands..NAM END
+	0x45,0x0A,0x20,0x82,0x00,0x81,0x28,0x80,0x20,0x02,0x70,0x72,0x69,0x80,0x72,0x04, // E.....(...pri.r. END
+	0x61,0x72,0x67,0x75,0x6D,0x80,0x7B,0x14,0x73,0x20,0x74,0x6F,0x20,0x73,0x74,0x64, // argum.{.s.to.std END
+	0x6F,0x75,0x74,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x89,0x30,0x07, // out..SYNOPSIS.0. END
+	0x5B,0x53,0x54,0x52,0x49,0x4E,0x47,0x31,0x85,0x08,0x13,0x32,0x20,0x2E,0x2E,0x2E, // [STRING1...2.... END
+	0x5D,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84, // ]]..DESCRIPTION. END
+	0x60,0x00,0x50,0x82,0x59,0x03,0x65,0x61,0x63,0x68,0x86,0x5E,0x87,0x5D,0x0C,0x20, // `.P.Y.each.^.].. END
+	0x69,0x6E,0x20,0x74,0x65,0x72,0x6D,0x2C,0x20,0x77,0x69,0x74,0x80,0x20,0x05,0x20, // in.term,.wit.... END
+	0x73,0x70,0x61,0x63,0x65,0x21,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72, // space!.character END
+	0x20,0x70,0x72,0x69,0x6E,0x74,0x65,0x64,0x20,0x62,0x65,0x74,0x77,0x65,0x65,0x6E, // .printed.between END
+	0x20,0x65,0x61,0x63,0x68,0x2E,0x0A,0xFF,0x9B,0x00,0x17,0x01,0x9F,0x07,0x67,0x65, // .each.........ge END
+	0x74,0x70,0x69,0x6E,0x00,0x47,0x45,0x54,0x50,0x49,0x4E,0x28,0x31,0x29,0x20,0x2D, // tpin.GETPIN(1).- END
+	0x20,0x55,0x73,0x80,0x4F,0x0F,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A, // .Us.O.Commands.. END
+	0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x83,0x2C,0x80,0x22,0x80,0x35,0x08,0x20, // NAME.....,.".5.. END
+	0x41,0x72,0x64,0x75,0x69,0x6E,0x6F,0x20,0x81,0x11,0x04,0x73,0x74,0x61,0x74,0x65, // Arduino....state END
+	0x80,0x2B,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8B,0x2F,0x80,0x60,0x0C, // .+.SYNOPSIS./.`. END
+	0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x4D,0x00, // ..DESCRIPTION.M. END
+	0x50,0x81,0xB2,0x0F,0x73,0x20,0x27,0x6F,0x6E,0x27,0x2F,0x27,0x6F,0x66,0x66,0x27, // P...s.'on'/'off' END
+	0x20,0x62,0x61,0x73,0x80,0xC2,0x09,0x6F,0x6E,0x20,0x63,0x75,0x72,0x72,0x65,0x6E, // .bas...on.curren END
+	0x74,0x83,0x57,0x06,0x20,0x6F,0x66,0x20,0x67,0x69,0x76,0x80,0xD4,0x80,0xA9,0x01, // t.W..of.giv..... END
+	0x2E,0x0A,0x84,0x8B,0x81,0x88,0x16,0x63,0x61,0x6E,0x20,0x62,0x65,0x20,0x6F,0x66, // .......can.be.of END
+	0x20,0x74,0x68,0x65,0x20,0x66,0x6F,0x6C,0x6C,0x6F,0x77,0x69,0x6E,0x67,0x80,0x09, // .the.following.. END
+	0x05,0x72,0x6D,0x73,0x3A,0x0A,0x20,0x82,0x00,0x2E,0x2A,0x20,0x41,0x78,0x20,0x2D, // .rms:.....*.Ax.- END
+	0x20,0x61,0x6E,0x61,0x6C,0x6F,0x67,0x75,0x65,0x20,0x70,0x69,0x6E,0x2C,0x20,0x77, // .analogue.pin,.w END
+	0x68,0x65,0x72,0x65,0x20,0x78,0x20,0x69,0x73,0x20,0x69,0x6E,0x20,0x72,0x61,0x6E, // here.x.is.in.ran END
+	0x67,0x65,0x20,0x5B,0x30,0x2C,0x31,0x35,0x5D,0x86,0x35,0x00,0x44,0x81,0x35,0x06, // ge.[0,15].5.D.5. END
+	0x64,0x69,0x67,0x69,0x74,0x61,0x6C,0x9A,0x34,0x01,0x35,0x33,0x87,0x34,0x81,0x69, // digital.4.53.4.i END
+	0x02,0x72,0x61,0x77,0x81,0x64,0x06,0x20,0x6E,0x75,0x6D,0x62,0x65,0x72,0x97,0x6B, // .raw.d..number.k END
+	0x17,0x32,0x37,0x5D,0x20,0x62,0x75,0x74,0x20,0x6E,0x6F,0x74,0x20,0x61,0x6C,0x6C, // .27].but.not.all END
+	0x20,0x76,0x61,0x6C,0x75,0x65,0x73,0x20,0x61,0x80,0x98,0x80,0x0A,0x03,0x69,0x64, // .values.a.....id END
+	0x0A,0xFF,0x9D,0x00,0x24,0x01,0x14,0x05,0x63,0x61,0x74,0x00,0x43,0x41,0x54,0x28, // ....$...cat.CAT( END
+	0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E, // 1).-.User.Comman END
+	0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x80,0x26,0x80,0x1F, // ds..NAME.....&.. END
+	0x02,0x63,0x6F,0x6E,0x80,0x2F,0x01,0x65,0x6E,0x80,0x03,0x06,0x20,0x66,0x69,0x6C, // .con./.en....fil END
+	0x65,0x73,0x20,0x80,0x28,0x19,0x20,0x70,0x72,0x69,0x6E,0x74,0x20,0x74,0x6F,0x20, // es..(..print.to. END
+	0x73,0x74,0x64,0x6F,0x75,0x74,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53, // stdout..SYNOPSIS END
+	0x88,0x3B,0x05,0x5B,0x46,0x49,0x4C,0x45,0x31,0x83,0x06,0x13,0x32,0x20,0x2E,0x2E, // .;.[FILE1...2... END
+	0x2E,0x5D,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E, // .]]..DESCRIPTION END
+	0x84,0x66,0x02,0x57,0x72,0x69,0x80,0x5A,0x03,0x65,0x61,0x63,0x68,0x82,0x5F,0x87, // .f.Wri.Z.each._. END
+	0x54,0x14,0x20,0x69,0x6E,0x20,0x74,0x75,0x72,0x6E,0x2C,0x20,0x65,0x66,0x66,0x65, // T..in.turn,.effe END
+	0x63,0x74,0x69,0x76,0x65,0x6C,0x79,0x88,0x8F,0x09,0x69,0x6E,0x67,0x20,0x74,0x68, // ctively...ing.th END
+	0x65,0x6D,0x2E,0x0A,0x84,0xB0,0x18,0x49,0x66,0x20,0x61,0x20,0x64,0x61,0x73,0x68, // em.....If.a.dash END
+	0x20,0x27,0x2D,0x27,0x20,0x69,0x73,0x20,0x70,0x61,0x73,0x73,0x65,0x64,0x20,0x61, // .'-'.is.passed.a END
+	0x80,0xB3,0x84,0x5B,0x01,0x68,0x65,0x14,0x6E,0x20,0x72,0x65,0x61,0x64,0x73,0x20, // ...[.he.n.reads. END
+	0x66,0x72,0x6F,0x6D,0x20,0x73,0x74,0x64,0x69,0x6E,0x2E,0x0A,0xFF,0xA8,0x00,0x2A, // from.stdin.....* END
+	0x00,0xB8,0x03,0x75,0x70,0x74,0x69,0x6D,0x65,0x00,0x55,0x50,0x54,0x49,0x4D,0x45, // ...uptime.UPTIME END
+	0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61, // (1).-.User.Comma END
+	0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x83,0x2C,0x80, // nds..NAME.....,. END
+	0x22,0x23,0x69,0x6E,0x64,0x69,0x63,0x61,0x74,0x65,0x20,0x68,0x6F,0x77,0x20,0x6C, // "#indicate.how.l END
+	0x6F,0x6E,0x67,0x20,0x74,0x68,0x65,0x20,0x73,0x79,0x73,0x74,0x65,0x6D,0x20,0x68, // ong.the.system.h END
+	0x61,0x73,0x20,0x62,0x65,0x65,0x80,0x9C,0x0F,0x75,0x6E,0x6E,0x69,0x6E,0x67,0x0A, // as.bee...unning. END
+	0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8A,0x46,0x07,0x0A,0x0A,0x44,0x45, // .SYNOPSIS.F...DE END
+	0x53,0x43,0x52,0x49,0x80,0x79,0x01,0x4F,0x4E,0x84,0x60,0x08,0x50,0x72,0x69,0x6E, // SCRI.y.ON.`.Prin END
+	0x74,0x73,0x20,0x68,0x75,0x80,0x7B,0x00,0x2D,0x81,0xDB,0x04,0x61,0x62,0x6C,0x65, // ts.hu.{.-...able END
+	0x20,0x82,0x74,0x09,0x73,0x69,0x6E,0x63,0x65,0x20,0x62,0x6F,0x6F,0x74,0x87,0xE3, // ..t.since.boot.. END
+	0x22,0x00,0xC7,0x04,0x6C,0x73,0x00,0x4C,0x53,0x28,0x31,0x29,0x20,0x2D,0x20,0x55, // "...ls.LS(1).-.U END
+	0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41, // ser.Commands..NA END
+	0x4D,0x45,0x0A,0x20,0x82,0x00,0x01,0x6C,0x73,0x80,0x1E,0x06,0x64,0x69,0x73,0x70, // ME.....ls...disp END
+	0x6C,0x61,0x79,0x80,0x07,0x0E,0x72,0x65,0x63,0x74,0x6F,0x72,0x79,0x20,0x63,0x6F, // lay...rectory.co END
+	0x6E,0x74,0x65,0x6E,0x74,0x80,0x2B,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53, // ntent.+.SYNOPSIS END
+	0x87,0x2F,0x00,0x5B,0x80,0x26,0x0D,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49, // ./.[.&.]..DESCRI END
+	0x50,0x54,0x49,0x4F,0x4E,0x84,0x4B,0x12,0x4C,0x69,0x73,0x74,0x20,0x66,0x69,0x6C, // PTION.K.List.fil END
+	0x65,0x73,0x20,0x69,0x6E,0x20,0x67,0x69,0x76,0x65,0x6E,0x87,0x52,0x08,0x2C,0x20, // es.in.given.R.,. END
+	0x6F,0x72,0x20,0x70,0x72,0x65,0x73,0x80,0x56,0x07,0x20,0x77,0x6F,0x72,0x6B,0x69, // or.pres.V..worki END
+	0x6E,0x67,0x88,0x70,0x04,0x69,0x66,0x20,0x6E,0x6F,0x88,0x80,0x82,0x3D,0x02,0x2E, // ng.p.if.no...=.. END
+	0x0A,0xFF,0xB5,0x00,0x28,0x02,0x36,0x09,0x68,0x77,0x72,0x65,0x67,0x00,0x48,0x57, // ....(.6.hwreg.HW END
+	0x52,0x45,0x47,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F, // REG(1).-.User.Co END
+	0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00, // mmands..NAME.... END
+	0x82,0x2A,0x80,0x21,0x05,0x52,0x65,0x67,0x69,0x73,0x74,0x80,0x25,0x08,0x48,0x57, // .*.!.Regist.%.HW END
+	0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x80,0x27,0x07,0x53,0x59,0x4E,0x4F,0x50,0x53, // .device.'.SYNOPS END
+	0x49,0x53,0x8A,0x2B,0x0F,0x73,0x6C,0x6F,0x74,0x20,0x74,0x79,0x70,0x65,0x20,0x5B, // IS.+.slot.type.[ END
+	0x70,0x69,0x6E,0x30,0x2C,0x82,0x06,0x00,0x31,0x80,0x06,0x12,0x2E,0x2E,0x2E,0x5D, // pin0,...1......] END
+	0x5D,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84, // ]]..DESCRIPTION. END
+	0x64,0x85,0x5C,0x0B,0x73,0x20,0x61,0x20,0x68,0x61,0x72,0x64,0x77,0x61,0x72,0x65, // d.\.s.a.hardware END
+	0x84,0x65,0x14,0x20,0x6F,0x66,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6E, // .e..of.the.given END
+	0x20,0x6B,0x69,0x6E,0x64,0x20,0x69,0x6E,0x88,0x11,0x81,0x6D,0x06,0x2C,0x20,0x75, // .kind.in...m.,.u END
+	0x73,0x69,0x6E,0x67,0x88,0x27,0x80,0x78,0x80,0xC6,0x83,0xC1,0x00,0x54,0x81,0x8A, // sing.'.x.....T.. END
+	0x04,0x63,0x61,0x6E,0x20,0x62,0x80,0x4C,0x02,0x6E,0x65,0x20,0x04,0x6F,0x66,0x3A, // .can.b.L.ne..of: END
+	0x0A,0x20,0x82,0x00,0x0F,0x2A,0x20,0x6B,0x65,0x79,0x70,0x61,0x64,0x20,0x2D,0x20, // .....*.keypad.-. END
+	0x61,0x20,0x34,0x78,0x34,0x85,0x0E,0x29,0x77,0x69,0x74,0x68,0x20,0x30,0x2D,0x39, // a.4x4..)with.0-9 END
+	0x20,0x61,0x6E,0x64,0x20,0x41,0x2D,0x5A,0x20,0x28,0x72,0x65,0x71,0x75,0x69,0x72, // .and.A-Z.(requir END
+	0x65,0x73,0x20,0x38,0x20,0x70,0x69,0x6E,0x73,0x2F,0x63,0x68,0x61,0x6E,0x6E,0x65, // es.8.pins/channe END
+	0x6C,0x73,0x80,0x1D,0x01,0x48,0x29,0x86,0x4D,0x0B,0x73,0x64,0x63,0x61,0x72,0x64, // ls...H).M.sdcard END
+	0x72,0x65,0x61,0x64,0x65,0x72,0x80,0x53,0x10,0x66,0x6F,0x72,0x20,0x53,0x50,0x49, // reader.S.for.SPI END
+	0x20,0x62,0x61,0x73,0x65,0x64,0x20,0x53,0x44,0x20,0x81,0x1D,0x00,0x20,0x83,0x1E, // .based.SD....... END
+	0x00,0x73,0x88,0x53,0x02,0x70,0x6F,0x77,0x80,0x2F,0x80,0x57,0x82,0x6F,0x0B,0x73, // .s.S.pow./.W.o.s END
+	0x6C,0x61,0x76,0x65,0x20,0x73,0x65,0x6C,0x65,0x63,0x74,0x81,0x6C,0x87,0x5E,0x04, // lave.select.l.^. END
+	0x64,0x68,0x74,0x32,0x32,0x84,0x57,0x02,0x44,0x48,0x54,0x80,0x0B,0x0A,0x74,0x65, // dht22.W.DHT...te END
+	0x6D,0x70,0x65,0x72,0x61,0x74,0x75,0x72,0x65,0x82,0xAB,0x07,0x68,0x75,0x6D,0x69, // mperature...humi END
+	0x64,0x69,0x74,0x79,0x80,0x3E,0x02,0x6E,0x73,0x6F,0x94,0x64,0x0F,0x61,0x6E,0x64, // dity.>.nso.d.and END
+	0x20,0x64,0x61,0x74,0x61,0x20,0x70,0x69,0x6E,0x29,0x0A,0x0A,0x20,0x82,0x00,0x21, // .data.pin).....! END
+	0x53,0x6C,0x6F,0x74,0x20,0x73,0x68,0x6F,0x75,0x6C,0x64,0x20,0x62,0x65,0x20,0x69, // Slot.should.be.i END
+	0x6E,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x6E,0x67,0x65,0x20,0x30,0x2D,0x33,0x2E, // n.the.range.0-3. END
+	0x0A,0xFF,0x86,0x00,0x05,0x00,0xE6,0x04,0x73,0x65,0x74,0x80,0x3C,0x15,0x00,0x53, // ........set.<..S END
+	0x45,0x54,0x50,0x49,0x4E,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20, // ETPIN(1).-.User. END
+	0x43,0x6F,0x6D,0x6D,0x80,0x5E,0x06,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x84,0x5A, // Comm.^.s..NAME.Z END
+	0x83,0x2C,0x80,0x22,0x80,0x35,0x07,0x20,0x41,0x72,0x64,0x75,0x69,0x6E,0x6F,0x81, // .,.".5..Arduino. END
+	0x7B,0x05,0x20,0x73,0x74,0x61,0x74,0x65,0x80,0x2B,0x07,0x53,0x59,0x4E,0x4F,0x50, // {..state.+.SYNOP END
+	0x53,0x49,0x53,0x8B,0x2F,0x86,0x21,0x0C,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49, // SIS./.!...DESCRI END
+	0x50,0x54,0x49,0x4F,0x4E,0x85,0xAE,0x07,0x65,0x74,0x73,0x20,0x67,0x69,0x76,0x65, // PTION...ets.give END
+	0x83,0x27,0x01,0x74,0x6F,0x84,0x0C,0x82,0x52,0x11,0x20,0x28,0x31,0x2F,0x30,0x20, // .'.to...R..(1/0. END
+	0x66,0x6F,0x72,0x20,0x6F,0x6E,0x2F,0x6F,0x66,0x66,0x29,0x2E,0x86,0xE5,0x03,0x65, // for.on/off)....e END
+	0x65,0x20,0x47,0x26,0x45,0x54,0x50,0x49,0x4E,0x28,0x31,0x29,0x20,0x66,0x6F,0x72, // e.G&ETPIN(1).for END
+	0x20,0x64,0x65,0x74,0x61,0x69,0x6C,0x73,0x20,0x6F,0x6E,0x20,0x70,0x69,0x6E,0x20, // .details.on.pin. END
+	0x61,0x72,0x67,0x75,0x6D,0x65,0x6E,0x74,0x2E,0x0A,0xFF,0x96,0x00,0x0B,0x00,0xA0, // argument........ END
+	0x03,0x74,0x72,0x75,0x65,0x00,0x54,0x52,0x55,0x45,0x81,0x46,0x16,0x2D,0x20,0x55, // .true.TRUE.F.-.U END
+	0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41, // ser.Commands..NA END
+	0x4D,0x45,0x0A,0x20,0x82,0x00,0x81,0x28,0x80,0x20,0x21,0x64,0x6F,0x20,0x6E,0x6F, // ME.....(..!do.no END
+	0x74,0x68,0x69,0x6E,0x67,0x2C,0x20,0x73,0x75,0x63,0x63,0x65,0x73,0x73,0x66,0x75, // thing,.successfu END
+	0x6C,0x6C,0x79,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x88,0x2F,0x0C, // lly..SYNOPSIS./. END
+	0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x47,0x1E, // ..DESCRIPTION.G. END
+	0x45,0x78,0x69,0x74,0x20,0x77,0x69,0x74,0x68,0x20,0x61,0x20,0x73,0x74,0x61,0x74, // Exit.with.a.stat END
+	0x75,0x73,0x20,0x63,0x6F,0x64,0x65,0x20,0x69,0x6E,0x64,0x69,0x63,0x61,0x74,0x80, // us.code.indicat. END
+	0x58,0x85,0x57,0x99,0xB9,0x83,0xD3,0x26,0x00,0xF1,0x04,0x74,0x69,0x6D,0x65,0x00, // X.W....&...time. END
+	0x54,0x49,0x4D,0x45,0x28,0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43, // TIME(1).-.User.C END
+	0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82, // ommands..NAME... END
+	0x00,0x81,0x28,0x80,0x20,0x82,0x06,0x12,0x61,0x20,0x70,0x72,0x6F,0x67,0x72,0x61, // ..(.....a.progra END
+	0x6D,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x89,0x25,0x84,0x1C,0x01, // m..SYNOPSIS.%... END
+	0x20,0x5B,0x84,0x25,0x03,0x61,0x72,0x67,0x31,0x89,0x0C,0x13,0x32,0x20,0x2E,0x2E, // .[.%.arg1...2... END
+	0x2E,0x5D,0x5D,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E, // .]]..DESCRIPTION END
+	0x84,0x65,0x0D,0x52,0x75,0x6E,0x73,0x20,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65, // .e.Runs.the.give END
+	0x6E,0x86,0x49,0x04,0x28,0x77,0x69,0x74,0x68,0x88,0x17,0x80,0x51,0x0A,0x73,0x2C, // n.I.(with...Q.s, END
+	0x20,0x69,0x66,0x20,0x61,0x6E,0x79,0x29,0x2C,0x80,0x05,0x19,0x64,0x20,0x72,0x65, // .if.any),...d.re END
+	0x70,0x6F,0x72,0x74,0x73,0x20,0x68,0x6F,0x77,0x20,0x6C,0x6F,0x6E,0x67,0x20,0x69, // ports.how.long.i END
+	0x74,0x20,0x74,0x6F,0x6F,0x6B,0x80,0x04,0x0A,0x20,0x65,0x78,0x65,0x63,0x75,0x74, // t.took....execut END
+	0x65,0x2E,0x0A,0xFF,0x8B,0x00,0x2C,0x01,0x43,0x06,0x68,0x77,0x73,0x64,0x6D,0x6E, // e.....,.C.hwsdmn END
+	0x74,0x00,0x48,0x57,0x53,0x44,0x4D,0x4E,0x54,0x28,0x31,0x29,0x20,0x2D,0x20,0x55, // t.HWSDMNT(1).-.U END
+	0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41, // ser.Commands..NA END
+	0x4D,0x45,0x0A,0x20,0x82,0x00,0x84,0x2E,0x80,0x23,0x02,0x4D,0x6F,0x75,0x80,0x07, // ME.......#.Mou.. END
+	0x2B,0x61,0x6E,0x20,0x53,0x44,0x20,0x75,0x73,0x69,0x6E,0x67,0x20,0x61,0x20,0x72, // +an.SD.using.a.r END
+	0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x48,0x57,0x20,0x64,0x65,0x76, // egistered.HW.dev END
+	0x69,0x63,0x65,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8C,0x42,0x03, // ice..SYNOPSIS.B. END
+	0x69,0x64,0x20,0x6D,0x81,0x43,0x11,0x70,0x6F,0x69,0x6E,0x74,0x0A,0x0A,0x44,0x45, // id.m.C.point..DE END
+	0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x6B,0x0A,0x41,0x74,0x74,0x65, // SCRIPTION.k.Atte END
+	0x6D,0x70,0x74,0x73,0x20,0x74,0x6F,0x83,0x29,0x84,0x6D,0x03,0x63,0x61,0x72,0x64, // mpts.to.).m.card END
+	0x81,0x13,0x08,0x74,0x68,0x65,0x20,0x67,0x69,0x76,0x65,0x6E,0x84,0x1D,0x82,0x48, // ...the.given...H END
+	0x00,0x2C,0x84,0x8C,0x81,0x1C,0x86,0x83,0x04,0x20,0x77,0x69,0x74,0x68,0x88,0x2F, // .,........with./ END
+	0x07,0x69,0x64,0x2E,0x20,0x52,0x65,0x71,0x75,0x2C,0x69,0x72,0x65,0x73,0x20,0x74, // .id..Requ,ires.t END
+	0x68,0x61,0x74,0x20,0x73,0x61,0x69,0x64,0x20,0x48,0x57,0x20,0x64,0x65,0x76,0x69, // hat.said.HW.devi END
+	0x63,0x65,0x20,0x68,0x61,0x73,0x20,0x62,0x65,0x65,0x6E,0x20,0x72,0x65,0x67,0x69, // ce.has.been.regi END
+	0x73,0x74,0x65,0x72,0x65,0x64,0x20,0x80,0x12,0x09,0x61,0x6E,0x20,0x53,0x44,0x20, // stered....an.SD. END
+	0x63,0x61,0x72,0x64,0x80,0x18,0x06,0x61,0x64,0x65,0x72,0x2E,0x0A,0xFF,0xB9,0x00, // card...ader..... END
+	0x28,0x02,0x50,0x0A,0x6D,0x6F,0x75,0x6E,0x74,0x00,0x4D,0x4F,0x55,0x4E,0x54,0x28, // (.P.mount.MOUNT( END
+	0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E, // 1).-.User.Comman END
+	0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x82,0x2A,0x80,0x21, // ds..NAME.....*.! END
+	0x83,0x07,0x05,0x66,0x69,0x6C,0x65,0x73,0x79,0x80,0x9B,0x00,0x6D,0x80,0x25,0x07, // ...filesy...m.%. END
+	0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8A,0x29,0x03,0x74,0x79,0x70,0x65,0x85, // SYNOPSIS.).type. END
+	0xD0,0x12,0x74,0x61,0x72,0x67,0x65,0x74,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49, // ..target..DESCRI END
+	0x50,0x54,0x49,0x4F,0x4E,0x80,0x55,0x00,0x20,0x80,0x00,0x13,0x4D,0x6F,0x75,0x6E, // PTION.U.....Moun END
+	0x74,0x73,0x20,0x74,0x68,0x65,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74, // ts.the.device.at END
+	0x82,0x0D,0x0D,0x67,0x69,0x76,0x65,0x6E,0x20,0x70,0x61,0x74,0x68,0x2C,0x20,0x6F, // ...given.path,.o END
+	0x66,0x88,0x12,0x07,0x74,0x79,0x70,0x65,0x2C,0x20,0x74,0x6F,0x89,0x12,0x07,0x61, // f...type,.to...a END
+	0x72,0x67,0x65,0x74,0x2E,0x0A,0x0A,0x81,0x51,0x02,0x20,0x20,0x54,0x80,0x21,0x09, // rget....Q...T.!. END
+	0x20,0x63,0x61,0x6E,0x20,0x62,0x65,0x20,0x6F,0x6E,0x80,0x03,0x01,0x66,0x3A,0x84, // .can.be.on...f:. END
+	0x19,0x02,0x2A,0x20,0x66,0x80,0x5E,0x1F,0x2D,0x20,0x46,0x61,0x74,0x31,0x36,0x2F, // ..*.f.^.-.Fat16/ END
+	0x33,0x32,0x20,0x73,0x75,0x70,0x70,0x6F,0x72,0x74,0x69,0x6E,0x67,0x20,0x76,0x6F, // 32.supporting.vo END
+	0x6C,0x75,0x6D,0x65,0x73,0x20,0x75,0x70,0x81,0x5C,0x0A,0x34,0x67,0x62,0x20,0x69, // lumes.up.\.4gb.i END
+	0x6E,0x20,0x73,0x69,0x7A,0x65,0x86,0x3B,0x0B,0x63,0x75,0x73,0x74,0x6F,0x6D,0x6D, // n.size.;.customm END
+	0x69,0x6E,0x69,0x66,0x73,0x80,0x44,0x00,0x41,0x80,0x1D,0x12,0x6E,0x67,0x6C,0x65, // inifs.D.A...ngle END
+	0x2D,0x64,0x69,0x72,0x65,0x63,0x74,0x6F,0x72,0x79,0x20,0x66,0x6F,0x72,0x6D,0x80, // -directory.form. END
+	0xBF,0x80,0x06,0x86,0x4E,0x80,0xBB,0x01,0x61,0x72,0x80,0xE4,0x07,0x64,0x20,0x31, // ....N...ar...d.1 END
+	0x2D,0x31,0x36,0x6B,0x62,0x87,0x89,0x00,0x6C,0x11,0x61,0x74,0x66,0x69,0x6C,0x65, // -16kb...l.atfile END
+	0x20,0x2D,0x20,0x41,0x20,0x73,0x69,0x6E,0x67,0x6C,0x65,0x2D,0x82,0x0F,0x18,0x66, // .-.A.single-...f END
+	0x6F,0x72,0x6D,0x61,0x74,0x20,0x28,0x65,0x73,0x73,0x65,0x6E,0x74,0x69,0x61,0x6C, // ormat.(essential END
+	0x6C,0x79,0x20,0x61,0x20,0x27,0x72,0x75,0x80,0x0C,0x13,0x6D,0x65,0x27,0x20,0x6C, // ly.a.'ru...me'.l END
+	0x69,0x6E,0x6B,0x2F,0x73,0x68,0x6F,0x72,0x74,0x63,0x75,0x74,0x29,0x0A,0x20,0x82, // ink/shortcut)... END
+	0x00,0x17,0x2A,0x20,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6F,0x6E,0x4E,0x20,0x28, // ..*.partitionN.( END
+	0x4E,0x3D,0x31,0x2C,0x32,0x2C,0x33,0x2C,0x34,0x29,0x80,0x5D,0x02,0x4D,0x61,0x70, // N=1,2,3,4).].Map END
+	0x80,0x3F,0x82,0x1E,0x04,0x63,0x75,0x6C,0x61,0x72,0x87,0x29,0x07,0x20,0x74,0x6F, // .?...cular.)..to END
+	0x20,0x67,0x69,0x76,0x65,0x80,0x08,0x04,0x61,0x72,0x67,0x65,0x74,0x86,0x4B,0x06, // .give...arget.K. END
+	0x63,0x69,0x72,0x63,0x62,0x75,0x66,0x82,0x9A,0x81,0x0B,0x82,0x36,0x80,0x10,0x09, // circbuf.....6... END
+	0x66,0x65,0x72,0x20,0x69,0x6D,0x70,0x6C,0x65,0x6D,0x81,0x99,0x01,0x6E,0x67,0x80, // fer.implem...ng. END
+	0x97,0x0B,0x46,0x49,0x46,0x4F,0x20,0x71,0x75,0x65,0x75,0x65,0x0A,0xFF,0xAC,0x00, // ..FIFO.queue.... END
+	0x28,0x00,0xF2,0x04,0x66,0x64,0x69,0x73,0x6B,0x00,0x46,0x44,0x49,0x53,0x4B,0x28, // (...fdisk.FDISK( END
+	0x31,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E, // 1).-.User.Comman END
+	0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x82,0x2A,0x80,0x21, // ds..NAME.....*.! END
+	0x05,0x50,0x72,0x69,0x6E,0x74,0x20,0x82,0x0C,0x1D,0x70,0x61,0x72,0x74,0x69,0x74, // .Print....partit END
+	0x69,0x6F,0x6E,0x20,0x74,0x61,0x62,0x6C,0x65,0x20,0x69,0x6E,0x66,0x6F,0x0A,0x0A, // ion.table.info.. END
+	0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x8A,0x37,0x10,0x50,0x41,0x54,0x48,0x0A, // SYNOPSIS.7.PATH. END
+	0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x55,0x16,0x44, // .DESCRIPTION.U.D END
+	0x65,0x74,0x65,0x72,0x6D,0x69,0x6E,0x65,0x73,0x20,0x69,0x66,0x20,0x74,0x68,0x65, // etermines.if.the END
+	0x20,0x67,0x69,0x76,0x65,0x6E,0x83,0x5F,0x04,0x68,0x61,0x73,0x20,0x61,0x8D,0x65, // .given._.has.a.e END
+	0x01,0x2C,0x20,0x80,0x9A,0x81,0x2C,0x04,0x73,0x6F,0x2C,0x20,0x70,0x81,0x8C,0x80, // .,....,.so,.p... END
+	0x3A,0x80,0x78,0x02,0x72,0x6D,0x61,0x82,0x8A,0x80,0x09,0x04,0x20,0x65,0x61,0x63, // :.x.rma......eac END
+	0x68,0x88,0x9D,0x00,0x69,0x80,0xA0,0x05,0x75,0x72,0x6E,0x2E,0x0A,0xFF,0x8A,0x00, // h...i...urn..... END
+	0x24,0x00,0xE7,0x04,0x74,0x74,0x79,0x00,0x54,0x54,0x59,0x28,0x31,0x29,0x20,0x2D, // $...tty.TTY(1).- END
+	0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A, // .User.Commands.. END
+	0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x80,0x26,0x80,0x1F,0x35,0x70,0x72,0x69, // NAME.....&..5pri END
+	0x6E,0x74,0x20,0x70,0x61,0x74,0x68,0x20,0x6F,0x66,0x20,0x66,0x69,0x6C,0x65,0x20, // nt.path.of.file. END
+	0x72,0x65,0x70,0x72,0x65,0x73,0x65,0x6E,0x74,0x69,0x6E,0x67,0x20,0x74,0x68,0x65, // representing.the END
+	0x20,0x74,0x65,0x72,0x6D,0x69,0x6E,0x61,0x6C,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50, // .terminal..SYNOP END
+	0x53,0x49,0x53,0x87,0x42,0x0C,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54, // SIS.B...DESCRIPT END
+	0x49,0x4F,0x4E,0x84,0x59,0x00,0x50,0x81,0x53,0x00,0x73,0x82,0x3A,0x85,0x58,0x81, // ION.Y.P.S.s.:.X. END
+	0x46,0x0D,0x76,0x69,0x72,0x74,0x75,0x61,0x6C,0x20,0x64,0x65,0x76,0x69,0x63,0x65, // F.virtual.device END
+	0x83,0x6B,0x04,0x77,0x68,0x69,0x63,0x68,0x97,0x71,0x0C,0x20,0x28,0x67,0x65,0x6E, // .k.which.q..(gen END
+	0x65,0x72,0x61,0x6C,0x6C,0x79,0x20,0x2F,0x80,0x37,0x00,0x2F,0x80,0xDB,0x05,0x53, // erally./.7./...S END
+	0x30,0x29,0x2E,0x0A,0xFF,0x95,0x00};
+#endif
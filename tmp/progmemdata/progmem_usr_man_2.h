@@ -0,0 +1,43 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_usr_man_2_H
+#define PROGMEM_usr_man_2_H
+
+#include <stdint.h>
+
+#define PROGMEM_usr_man_2DATASIZE 392u
+#define PROGMEM_usr_man_2COMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_usr_man_2DATAPTR ((uint32_t)pgm_get_far_address(progmem_usr_man_2Data))
+static const uint8_t progmem_usr_man_2Data[PROGMEM_usr_man_2DATASIZE] PROGMEM ={
+#else
+#define PROGMEM_usr_man_2DATAPTR ((uintptr_t)progmem_usr_man_2Data)
+static const uint8_t progmem_usr_man_2Data[PROGMEM_usr_man_2DATASIZE]={
+#endif
+	0x5A,0x02,0x38,0x00,0x0B,0x00,0x87,0x01,0x57,0x01,0x88,0x03,0x22,0x8D,0x20,0x00, // Z.8.....W..."... END
+	0xF9,0x00,0x25,0x01,0xB5,0x6E,0x65,0x78,0x69,0x74,0x00,0x45,0x58,0x49,0x54,0x28, // ..%..nexit.EXIT( END
+	0x32,0x29,0x20,0x2D,0x20,0x53,0x79,0x73,0x74,0x65,0x6D,0x20,0x43,0x61,0x6C,0x6C, // 2).-.System.Call END
+	0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x81,0x27,0x80,0x1F,0x0E, // s..NAME.....'... END
+	0x74,0x65,0x72,0x6D,0x69,0x6E,0x61,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x63,0x80, // terminate.the.c. END
+	0x26,0x1B,0x69,0x6E,0x67,0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x20,0x77,0x69, // &.ing.process.wi END
+	0x74,0x68,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x73,0x74,0x61,0x74,0x75,0x80,0x42, // th.given.statu.B END
+	0x07,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x84,0x46,0x01,0x72,0x30,0x80,0x64, // .SYNOPSIS.F.r0.d END
+	0x03,0x69,0x64,0x3D,0x30,0x82,0x56,0x1B,0x20,0x20,0x72,0x31,0x20,0x2D,0x20,0x73, // .id=0.V...r1.-.s END
+	0x74,0x61,0x74,0x75,0x73,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49, // tatus..DESCRIPTI END
+	0x4F,0x4E,0x0A,0x20,0x82,0x00,0x20,0x54,0x68,0x65,0x20,0x65,0x78,0x69,0x74,0x20, // ON.....The.exit. END
+	0x73,0x79,0x73,0x74,0x65,0x6D,0x20,0x63,0x61,0x6C,0x6C,0x20,0x74,0x65,0x72,0x6D, // system.call.term END
+	0x69,0x6E,0x61,0x74,0x65,0x73,0x20,0x74,0x80,0x1F,0x81,0x13,0x12,0x69,0x6E,0x67, // inates.t.....ing END
+	0x20,0x70,0x72,0x6F,0x63,0x65,0x73,0x73,0x20,0x22,0x69,0x6D,0x6D,0x65,0x64,0x69, // .process."immedi END
+	0x80,0x1F,0x03,0x6C,0x79,0x22,0x2E,0x88,0x48,0x04,0x76,0x61,0x6C,0x75,0x65,0x84, // ...ly"..H.value. END
+	0x6C,0x17,0x20,0x69,0x73,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x65,0x64,0x20,0x74, // l..is.returned.t END
+	0x6F,0x20,0x61,0x6E,0x79,0x20,0x77,0x61,0x69,0x74,0x88,0x48,0x80,0x5E,0x03,0x28, // o.any.wait.H.^.( END
+	0x73,0x65,0x65,0x82,0x16,0x08,0x70,0x69,0x64,0x28,0x32,0x29,0x29,0x20,0x61,0x83, // see...pid(2)).a. END
+	0x72,0x83,0x92,0x82,0xB5,0x0E,0x2E,0x0A,0x0A,0x52,0x45,0x54,0x55,0x52,0x4E,0x20, // r........RETURN. END
+	0x56,0x41,0x4C,0x55,0x45,0x86,0xB7,0x80,0x5F,0x0E,0x66,0x75,0x6E,0x63,0x74,0x69, // VALUE..._.functi END
+	0x6F,0x6E,0x20,0x64,0x6F,0x20,0x6E,0x6F,0x74,0x84,0x6F,0x80,0x30,0x08,0x53,0x45, // on.do.not.o.0.SE END
+	0x45,0x20,0x41,0x4C,0x53,0x4F,0x0A,0x00,0x20,0x82,0x00,0x0C,0x65,0x78,0x65,0x63, // E.ALSO......exec END
+	0x28,0x32,0x29,0x2C,0x20,0x66,0x6F,0x72,0x6B,0x82,0x08,0x03,0x6B,0x69,0x6C,0x6C, // (2),.fork...kill END
+	0x82,0x11,0x06,0x77,0x61,0x69,0x74,0x70,0x69,0x64,0x82,0x1D,0x0A,0x65,0x78,0x69, // ...waitpid...exi END
+	0x74,0x28,0x33,0x29,0x0A,0xFF,0xFF,0xFF};
+#endif
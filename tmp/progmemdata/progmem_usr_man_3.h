@@ -0,0 +1,46 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_usr_man_3_H
+#define PROGMEM_usr_man_3_H
+
+#include <stdint.h>
+
+#define PROGMEM_usr_man_3DATASIZE 440u
+#define PROGMEM_usr_man_3COMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_usr_man_3DATAPTR ((uint32_t)pgm_get_far_address(progmem_usr_man_3Data))
+static const uint8_t progmem_usr_man_3Data[PROGMEM_usr_man_3DATASIZE] PROGMEM ={
+#else
+#define PROGMEM_usr_man_3DATAPTR ((uintptr_t)progmem_usr_man_3Data)
+static const uint8_t progmem_usr_man_3Data[PROGMEM_usr_man_3DATASIZE]={
+#endif
+	0x5A,0x02,0x6C,0x00,0x0B,0x00,0x8A,0x01,0x57,0x01,0xB8,0x03,0x22,0x9A,0x20,0x00, // Z.l.....W..."... END
+	0xF9,0x00,0x29,0x01,0xEA,0x7B,0x65,0x78,0x69,0x74,0x00,0x45,0x58,0x49,0x54,0x28, // ..)..{exit.EXIT( END
+	0x33,0x29,0x20,0x2D,0x20,0x53,0x74,0x61,0x6E,0x64,0x61,0x72,0x64,0x20,0x4C,0x69, // 3).-.Standard.Li END
+	0x62,0x72,0x61,0x72,0x79,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A,0x20,0x82,0x00,0x81, // brary..NAME..... END
+	0x2B,0x80,0x23,0x38,0x74,0x65,0x72,0x6D,0x69,0x6E,0x61,0x74,0x65,0x20,0x74,0x68, // +.#8terminate.th END
+	0x65,0x20,0x63,0x61,0x6C,0x6C,0x69,0x6E,0x67,0x20,0x70,0x72,0x6F,0x63,0x65,0x73, // e.calling.proces END
+	0x73,0x20,0x77,0x69,0x74,0x68,0x20,0x67,0x69,0x76,0x65,0x6E,0x20,0x73,0x74,0x61, // s.with.given.sta END
+	0x74,0x75,0x73,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53,0x84,0x46,0x09, // tus..SYNOPSIS.F. END
+	0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x65,0x6E,0x64,0x16,0x20,0x6C,0x69,0x62,0x2F, // requireend..lib/ END
+	0x73,0x74,0x64,0x2F,0x70,0x72,0x6F,0x63,0x2F,0x65,0x78,0x69,0x74,0x2E,0x73,0x0A, // std/proc/exit.s. END
+	0x0A,0x20,0x82,0x00,0x10,0x6D,0x6F,0x76,0x20,0x72,0x30,0x20,0x30,0x20,0x3B,0x20, // .....mov.r0.0.;. END
+	0x73,0x74,0x61,0x74,0x75,0x73,0x84,0x17,0x04,0x63,0x61,0x6C,0x6C,0x20,0x81,0x2A, // status...call..* END
+	0x0C,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x34, // ...DESCRIPTION.4 END
+	0x0B,0x54,0x68,0x65,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F,0x6E,0x82,0x24,0x00, // .The.function.$. END
+	0x28,0x83,0x3B,0x0D,0x29,0x20,0x74,0x65,0x72,0x6D,0x69,0x6E,0x61,0x74,0x65,0x73, // (.;.).terminates END
+	0x20,0x74,0x80,0x24,0x81,0x45,0x03,0x69,0x6E,0x67,0x20,0x81,0x78,0x0A,0x65,0x73, // .t.$.E.ing..x.es END
+	0x73,0x20,0x22,0x69,0x6D,0x6D,0x65,0x64,0x69,0x80,0x1F,0x03,0x6C,0x79,0x22,0x2E, // s."immedi...ly". END
+	0x88,0x4D,0x04,0x76,0x61,0x6C,0x75,0x65,0x84,0x81,0x17,0x20,0x69,0x73,0x20,0x72, // .M.value....is.r END
+	0x65,0x74,0x75,0x72,0x6E,0x65,0x64,0x20,0x74,0x6F,0x20,0x61,0x6E,0x79,0x20,0x77, // eturned.to.any.w END
+	0x61,0x69,0x74,0x88,0x48,0x80,0x5E,0x03,0x28,0x73,0x65,0x65,0x82,0x16,0x08,0x70, // ait.H.^.(see...p END
+	0x69,0x64,0x28,0x32,0x29,0x29,0x20,0x61,0x83,0x72,0x81,0xDE,0x84,0xCA,0x07,0x2E, // id(2)).a.r...... END
+	0x0A,0x0A,0x52,0x45,0x54,0x55,0x52,0x08,0x4E,0x20,0x56,0x41,0x4C,0x55,0x45,0x0A, // ..RETUR.N.VALUE. END
+	0x20,0x82,0x00,0x25,0x54,0x68,0x69,0x73,0x20,0x66,0x75,0x6E,0x63,0x74,0x69,0x6F, // ...%This.functio END
+	0x6E,0x20,0x64,0x6F,0x20,0x6E,0x6F,0x74,0x20,0x72,0x65,0x74,0x75,0x72,0x6E,0x2E, // n.do.not.return. END
+	0x0A,0x0A,0x53,0x45,0x45,0x20,0x41,0x4C,0x53,0x4F,0x84,0x2C,0x0C,0x65,0x78,0x65, // ..SEE.ALSO.,.exe END
+	0x63,0x28,0x32,0x29,0x2C,0x20,0x66,0x6F,0x72,0x6B,0x82,0x08,0x03,0x6B,0x69,0x6C, // c(2),.fork...kil END
+	0x6C,0x82,0x11,0x06,0x77,0x61,0x69,0x74,0x70,0x69,0x64,0x82,0x1D,0x03,0x65,0x78, // l...waitpid...ex END
+	0x69,0x74,0x80,0x26,0x02,0x0A,0xFF,0xFF};
+#endif
@@ -0,0 +1,53 @@
+// NOTE: File auto-generated (see minifsbuilder)
+
+#ifndef PROGMEM_usr_man_6_H
+#define PROGMEM_usr_man_6_H
+
+#include <stdint.h>
+
+#define PROGMEM_usr_man_6DATASIZE 550u
+#define PROGMEM_usr_man_6COMPRESSED 1
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#define PROGMEM_usr_man_6DATAPTR ((uint32_t)pgm_get_far_address(progmem_usr_man_6Data))
+static const uint8_t progmem_usr_man_6Data[PROGMEM_usr_man_6DATASIZE] PROGMEM ={
+#else
+#define PROGMEM_usr_man_6DATAPTR ((uintptr_t)progmem_usr_man_6Data)
+static const uint8_t progmem_usr_man_6Data[PROGMEM_usr_man_6DATASIZE]={
+#endif
+	0x5A,0x02,0xF0,0x00,0x0B,0x00,0x80,0x01,0x5E,0x02,0x26,0x05,0x22,0xBB,0x20,0x4F, // Z.......^.&."..O END
+	0x86,0x00,0xF8,0x00,0x2B,0xB9,0x2F,0x68,0x69,0x67,0x68,0x6C,0x6F,0x77,0x00,0x48, // ....+./highlow.H END
+	0x49,0x47,0x48,0x4C,0x4F,0x57,0x28,0x36,0x29,0x20,0x2D,0x20,0x55,0x73,0x65,0x72, // IGHLOW(6).-.User END
+	0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41,0x4D,0x45,0x0A, // .Commands..NAME. END
+	0x20,0x82,0x00,0x84,0x2E,0x80,0x23,0x03,0x6E,0x75,0x6D,0x62,0x80,0x25,0x16,0x67, // ......#.numb.%.g END
+	0x75,0x65,0x73,0x73,0x69,0x6E,0x67,0x20,0x67,0x61,0x6D,0x65,0x0A,0x0A,0x53,0x59, // uessing.game..SY END
+	0x4E,0x4F,0x50,0x53,0x49,0x53,0x8C,0x2E,0x16,0x4C,0x45,0x56,0x45,0x4C,0x50,0x41, // NOPSIS...LEVELPA END
+	0x54,0x48,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x0A, // TH..DESCRIPTION. END
+	0x00,0x20,0x82,0x00,0x25,0x49,0x6D,0x70,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x61,0x74, // ....%Implementat END
+	0x69,0x6F,0x6E,0x20,0x6F,0x66,0x20,0x63,0x6C,0x61,0x73,0x73,0x69,0x63,0x20,0x68, // ion.of.classic.h END
+	0x69,0x67,0x68,0x2F,0x6C,0x6F,0x77,0x20,0x67,0x75,0x65,0x80,0x10,0x11,0x6E,0x67, // igh/low.gue...ng END
+	0x20,0x67,0x61,0x6D,0x65,0x2E,0x0A,0x0A,0xFF,0xFF,0xFF,0x00,0xDA,0x37,0x63,0x68, // .game........7ch END
+	0x80,0x15,0x1F,0x00,0x43,0x48,0x45,0x53,0x53,0x28,0x36,0x29,0x20,0x2D,0x20,0x55, // ....CHESS(6).-.U END
+	0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41, // ser.Commands..NA END
+	0x4D,0x45,0x0A,0x83,0x63,0x82,0x2A,0x80,0x21,0x83,0x07,0x81,0x45,0x11,0x20,0x77, // ME..c.*.!...E..w END
+	0x69,0x74,0x68,0x20,0x41,0x49,0x0A,0x0A,0x53,0x59,0x4E,0x4F,0x50,0x53,0x49,0x53, // ith.AI..SYNOPSIS END
+	0x89,0x2A,0x0C,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E, // .*...DESCRIPTION END
+	0x84,0x43,0x21,0x50,0x72,0x6F,0x76,0x69,0x64,0x65,0x73,0x20,0x61,0x6E,0x20,0x69, // .C!Provides.an.i END
+	0x6E,0x74,0x65,0x72,0x66,0x61,0x63,0x65,0x20,0x74,0x6F,0x20,0x70,0x6C,0x61,0x79, // nterface.to.play END
+	0x20,0x61,0x20,0x73,0x74,0x80,0x76,0x02,0x61,0x72,0x64,0x83,0x5E,0x81,0xC6,0x81, // .a.st.v.ard.^... END
+	0x9F,0x04,0x2E,0x20,0x4D,0x6F,0x76,0x80,0x34,0x00,0x63,0x80,0x35,0x02,0x62,0x65, // ....Mov.4.c.5.be END
+	0x20,0x80,0x9A,0x05,0x75,0x61,0x6C,0x6C,0x79,0x20,0x80,0xEF,0x00,0x65,0x44,0x72, // ....ually....eDr END
+	0x65,0x64,0x20,0x6F,0x72,0x20,0x62,0x65,0x20,0x67,0x65,0x6E,0x65,0x72,0x61,0x74, // ed.or.be.generat END
+	0x65,0x64,0x2E,0x0A,0x0A,0xFF,0xFF,0x00,0xD8,0x36,0x73,0x6F,0x6B,0x6F,0x62,0x61, // ed.......6sokoba END
+	0x6E,0x00,0x53,0x4F,0x4B,0x4F,0x42,0x41,0x4E,0x28,0x36,0x29,0x20,0x2D,0x20,0x55, // n.SOKOBAN(6).-.U END
+	0x73,0x65,0x72,0x20,0x43,0x6F,0x6D,0x6D,0x61,0x6E,0x64,0x73,0x0A,0x0A,0x4E,0x41, // ser.Commands..NA END
+	0x4D,0x45,0x0A,0x20,0x82,0x00,0x84,0x2E,0x80,0x23,0x19,0x62,0x6F,0x78,0x20,0x70, // ME.......#.box.p END
+	0x75,0x73,0x68,0x69,0x6E,0x67,0x20,0x67,0x61,0x6D,0x65,0x0A,0x0A,0x53,0x59,0x4E, // ushing.game..SYN END
+	0x4F,0x50,0x53,0x49,0x53,0x8C,0x2A,0x15,0x4C,0x45,0x56,0x45,0x4C,0x50,0x41,0x54, // OPSIS.*.LEVELPAT END
+	0x48,0x0A,0x0A,0x44,0x45,0x53,0x43,0x52,0x49,0x50,0x54,0x49,0x4F,0x4E,0x84,0x4F, // H..DESCRIPTION.O END
+	0x19,0x41,0x6E,0x20,0x69,0x6D,0x70,0x6C,0x65,0x6D,0x65,0x6E,0x74,0x61,0x74,0x69, // .An.implementati END
+	0x6F,0x6E,0x20,0x6F,0x66,0x20,0x74,0x68,0x65,0x20,0x53,0x84,0x68,0x00,0x27,0x88, // on.of.the.S.h.'. END
+	0x67,0x00,0x27,0x82,0x68,0x00,0x2E,0x81,0x9E,0x0D,0x20,0x77,0x61,0x73,0x64,0x20, // g.'.h......wasd. END
+	0x74,0x6F,0x20,0x6D,0x6F,0x76,0x65,0x20,0x80,0xA6,0x01,0x20,0x71,0x81,0x0D,0x03, // to.move.....q... END
+	0x71,0x75,0x69,0x74,0x80,0xD9};
+#endif